@@ -0,0 +1,231 @@
+// Copyright (c) 2026 CINN Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/cinn/auto_schedule/cost_model/regression_cost_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+
+#include "paddle/common/enforce.h"
+
+namespace cinn {
+namespace auto_schedule {
+
+RegressionCostModel::RegressionCostModel(float learning_rate,
+                                         int num_epochs,
+                                         float l2_penalty)
+    : learning_rate_(learning_rate),
+      num_epochs_(num_epochs),
+      l2_penalty_(l2_penalty) {}
+
+void RegressionCostModel::Train(const std::vector<std::vector<float>>& samples,
+                                const std::vector<float>& labels) {
+  PADDLE_ENFORCE_EQ(samples.size(),
+                    labels.size(),
+                    ::common::errors::InvalidArgument(
+                        "The number of samples and labels must be equal, but "
+                        "received %d samples and %d labels.",
+                        samples.size(),
+                        labels.size()));
+  PADDLE_ENFORCE_EQ(samples.empty(),
+                    false,
+                    ::common::errors::InvalidArgument(
+                        "Cannot train a cost model on an empty sample set."));
+  const size_t feature_size = samples.front().size();
+
+  feature_mean_.assign(feature_size, 0.0f);
+  feature_stddev_.assign(feature_size, 0.0f);
+  for (const auto& sample : samples) {
+    PADDLE_ENFORCE_EQ(sample.size(),
+                      feature_size,
+                      ::common::errors::InvalidArgument(
+                          "All samples must have the same feature size %d, "
+                          "but received one of size %d.",
+                          feature_size,
+                          sample.size()));
+    for (size_t i = 0; i < feature_size; ++i) {
+      feature_mean_[i] += sample[i];
+    }
+  }
+  for (size_t i = 0; i < feature_size; ++i) {
+    feature_mean_[i] /= samples.size();
+  }
+  for (const auto& sample : samples) {
+    for (size_t i = 0; i < feature_size; ++i) {
+      const float diff = sample[i] - feature_mean_[i];
+      feature_stddev_[i] += diff * diff;
+    }
+  }
+  for (size_t i = 0; i < feature_size; ++i) {
+    feature_stddev_[i] = std::sqrt(feature_stddev_[i] / samples.size());
+    // Constant features carry no signal; a unit stddev keeps them at zero
+    // after normalization instead of dividing by zero.
+    if (feature_stddev_[i] < 1e-6f) feature_stddev_[i] = 1.0f;
+  }
+
+  weights_.assign(feature_size, 0.0f);
+  bias_ = 0.0f;
+  RunGradientDescent(samples, labels, num_epochs_);
+}
+
+void RegressionCostModel::Update(const std::vector<std::vector<float>>& samples,
+                                 const std::vector<float>& labels) {
+  if (!Trained()) {
+    Train(samples, labels);
+    return;
+  }
+  PADDLE_ENFORCE_EQ(samples.size(),
+                    labels.size(),
+                    ::common::errors::InvalidArgument(
+                        "The number of samples and labels must be equal, but "
+                        "received %d samples and %d labels.",
+                        samples.size(),
+                        labels.size()));
+  // Keep the normalization statistics of the original training set so old
+  // and new records stay on the same scale, and take a few refinement epochs
+  // over the new batch.
+  RunGradientDescent(samples, labels, std::max(num_epochs_ / 10, 1));
+}
+
+std::vector<float> RegressionCostModel::Predict(
+    const std::vector<std::vector<float>>& samples) const {
+  PADDLE_ENFORCE_EQ(
+      Trained(),
+      true,
+      ::common::errors::PreconditionNotMet(
+          "The cost model must be trained or loaded before Predict."));
+  std::vector<float> predictions;
+  predictions.reserve(samples.size());
+  for (const auto& sample : samples) {
+    const std::vector<float> normalized = Normalize(sample);
+    float log_cost = bias_;
+    for (size_t i = 0; i < weights_.size(); ++i) {
+      log_cost += weights_[i] * normalized[i];
+    }
+    predictions.push_back(std::exp(log_cost));
+  }
+  return predictions;
+}
+
+std::vector<int> RegressionCostModel::PickTopK(
+    const std::vector<std::vector<float>>& samples, int k) const {
+  const std::vector<float> predictions = Predict(samples);
+  std::vector<int> indices(predictions.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  k = std::min<int>(k, indices.size());
+  std::partial_sort(indices.begin(),
+                    indices.begin() + k,
+                    indices.end(),
+                    [&](int lhs, int rhs) {
+                      return predictions[lhs] < predictions[rhs];
+                    });
+  indices.resize(k);
+  return indices;
+}
+
+void RegressionCostModel::Save(const std::string& path) {
+  PADDLE_ENFORCE_EQ(Trained(),
+                    true,
+                    ::common::errors::PreconditionNotMet(
+                        "The cost model must be trained before Save."));
+  std::ofstream os(path);
+  PADDLE_ENFORCE_EQ(os.good(),
+                    true,
+                    ::common::errors::InvalidArgument(
+                        "Cannot open the file to write: %s", path));
+  os << weights_.size() << " " << bias_ << "\n";
+  for (size_t i = 0; i < weights_.size(); ++i) {
+    os << feature_mean_[i] << " " << feature_stddev_[i] << " " << weights_[i]
+       << "\n";
+  }
+}
+
+void RegressionCostModel::Load(const std::string& path) {
+  std::ifstream is(path);
+  PADDLE_ENFORCE_EQ(is.good(),
+                    true,
+                    ::common::errors::InvalidArgument(
+                        "Cannot open the cost model file: %s", path));
+  size_t feature_size = 0;
+  is >> feature_size >> bias_;
+  feature_mean_.assign(feature_size, 0.0f);
+  feature_stddev_.assign(feature_size, 1.0f);
+  weights_.assign(feature_size, 0.0f);
+  for (size_t i = 0; i < feature_size; ++i) {
+    is >> feature_mean_[i] >> feature_stddev_[i] >> weights_[i];
+  }
+  PADDLE_ENFORCE_EQ(is.fail(),
+                    false,
+                    ::common::errors::InvalidArgument(
+                        "The cost model file is malformed: %s", path));
+}
+
+void RegressionCostModel::RunGradientDescent(
+    const std::vector<std::vector<float>>& samples,
+    const std::vector<float>& labels,
+    int num_epochs) {
+  std::vector<std::vector<float>> normalized;
+  std::vector<float> log_labels;
+  normalized.reserve(samples.size());
+  log_labels.reserve(labels.size());
+  for (size_t i = 0; i < samples.size(); ++i) {
+    normalized.push_back(Normalize(samples[i]));
+    // Execution costs span orders of magnitude; fitting log cost keeps slow
+    // outliers from dominating the loss.
+    log_labels.push_back(std::log(std::max(labels[i], 1e-9f)));
+  }
+
+  const float scale = 1.0f / samples.size();
+  std::vector<float> gradient(weights_.size());
+  for (int epoch = 0; epoch < num_epochs; ++epoch) {
+    std::fill(gradient.begin(), gradient.end(), 0.0f);
+    float bias_gradient = 0.0f;
+    for (size_t i = 0; i < normalized.size(); ++i) {
+      float residual = bias_ - log_labels[i];
+      for (size_t j = 0; j < weights_.size(); ++j) {
+        residual += weights_[j] * normalized[i][j];
+      }
+      for (size_t j = 0; j < weights_.size(); ++j) {
+        gradient[j] += residual * normalized[i][j];
+      }
+      bias_gradient += residual;
+    }
+    for (size_t j = 0; j < weights_.size(); ++j) {
+      weights_[j] -= learning_rate_ *
+                     (gradient[j] * scale + l2_penalty_ * weights_[j]);
+    }
+    bias_ -= learning_rate_ * bias_gradient * scale;
+  }
+}
+
+std::vector<float> RegressionCostModel::Normalize(
+    const std::vector<float>& sample) const {
+  PADDLE_ENFORCE_EQ(sample.size(),
+                    feature_mean_.size(),
+                    ::common::errors::InvalidArgument(
+                        "The sample feature size %d mismatches the size %d "
+                        "the model was trained with.",
+                        sample.size(),
+                        feature_mean_.size()));
+  std::vector<float> normalized(sample.size());
+  for (size_t i = 0; i < sample.size(); ++i) {
+    normalized[i] = (sample[i] - feature_mean_[i]) / feature_stddev_[i];
+  }
+  return normalized;
+}
+
+}  // namespace auto_schedule
+}  // namespace cinn
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 CINN Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "paddle/cinn/common/cost_model.h"
+
+namespace cinn {
+namespace auto_schedule {
+
+/**
+ * A ridge regression cost model over schedule feature vectors.
+ *
+ * It learns to rank candidate schedules from the (features, execution_cost)
+ * pairs recorded by measurement (see TuningRecord in auto_schedule.proto), so
+ * a tuning job warmed up with a saved model can prune most candidates before
+ * touching the device. The model is linear on z-normalized features and is
+ * trained with gradient descent on log cost, which keeps it cheap to train
+ * in-process and trivially portable: Save/Load use a small text file that can
+ * be shipped with jobs.
+ */
+class RegressionCostModel : public CostModel {
+ public:
+  explicit RegressionCostModel(float learning_rate = 0.05f,
+                               int num_epochs = 200,
+                               float l2_penalty = 1e-3f);
+
+  void Train(const std::vector<std::vector<float>>& samples,
+             const std::vector<float>& labels) override;
+
+  std::vector<float> Predict(
+      const std::vector<std::vector<float>>& samples) const override;
+
+  // Refine the trained model with a new batch of measurement records.
+  void Update(const std::vector<std::vector<float>>& samples,
+              const std::vector<float>& labels) override;
+
+  void Save(const std::string& path) override;
+
+  void Load(const std::string& path) override;
+
+  bool Trained() const { return !weights_.empty(); }
+
+  // Return the indices of the k samples with the smallest predicted cost,
+  // best first. Used to decide which candidates are worth measuring.
+  std::vector<int> PickTopK(const std::vector<std::vector<float>>& samples,
+                            int k) const;
+
+ private:
+  void RunGradientDescent(const std::vector<std::vector<float>>& samples,
+                          const std::vector<float>& labels,
+                          int num_epochs);
+
+  std::vector<float> Normalize(const std::vector<float>& sample) const;
+
+  float learning_rate_;
+  int num_epochs_;
+  float l2_penalty_;
+
+  // Per-feature z-normalization statistics of the training set.
+  std::vector<float> feature_mean_;
+  std::vector<float> feature_stddev_;
+  std::vector<float> weights_;
+  float bias_{0.0f};
+};
+
+}  // namespace auto_schedule
+}  // namespace cinn
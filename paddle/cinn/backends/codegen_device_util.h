@@ -16,6 +16,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <algorithm>
+
 #include <string>
 #include <tuple>
 #include <vector>
@@ -237,9 +239,10 @@ struct CollectBucketStrategyHostFunctionVisitor
       predicate_priority.push_back(
           std::make_pair(op->priorities[i], func_pair));
     }
-    sort(
+    // Use a stable sort so buckets with equal priority keep their lowering
+    // order, which keeps the generated dispatch chain deterministic.
+    std::stable_sort(
         predicate_priority.begin(), predicate_priority.end(), compare_priority);
-    predicate_priority[0].second.first;
 
     for (int i = 0; i < op->functions.size(); ++i) {
       ProcessLoweredFunc(predicate_priority[i].second.first,
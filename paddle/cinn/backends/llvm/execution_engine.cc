@@ -19,6 +19,7 @@
 #include <llvm/AsmParser/Parser.h>
 #include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/JITSymbol.h>
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
 #include <llvm/ExecutionEngine/Orc/Core.h>
 #include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
@@ -26,7 +27,6 @@
 #include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
-#include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/PassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/IRReader/IRReader.h>
@@ -89,6 +89,7 @@ void InitializeLLVMPasses() {
 }  // namespace
 void NaiveObjectCache::notifyObjectCompiled(const llvm::Module *m,
                                             llvm::MemoryBufferRef obj_buffer) {
+  std::lock_guard<std::mutex> lock(cache_mu_);
   cached_objects_[m->getModuleIdentifier()] =
       llvm::MemoryBuffer::getMemBufferCopy(obj_buffer.getBuffer(),
                                            obj_buffer.getBufferIdentifier());
@@ -96,6 +97,7 @@ void NaiveObjectCache::notifyObjectCompiled(const llvm::Module *m,
 
 std::unique_ptr<llvm::MemoryBuffer> NaiveObjectCache::getObject(
     const llvm::Module *m) {
+  std::lock_guard<std::mutex> lock(cache_mu_);
   auto it = cached_objects_.find(m->getModuleIdentifier());
   if (it == cached_objects_.end()) {
     VLOG(1) << "No object for " << m->getModuleIdentifier()
@@ -107,6 +109,19 @@ std::unique_ptr<llvm::MemoryBuffer> NaiveObjectCache::getObject(
   return llvm::MemoryBuffer::getMemBuffer(it->second->getMemBufferRef());
 }
 
+std::vector<std::unique_ptr<llvm::MemoryBuffer>>
+NaiveObjectCache::CopyAllObjects() const {
+  std::lock_guard<std::mutex> lock(cache_mu_);
+  std::vector<std::unique_ptr<llvm::MemoryBuffer>> objects;
+  objects.reserve(cached_objects_.size());
+  for (const auto &item : cached_objects_) {
+    objects.push_back(
+        llvm::MemoryBuffer::getMemBufferCopy(item.second->getBuffer(),
+                                             item.first()));
+  }
+  return objects;
+}
+
 /*static*/ std::unique_ptr<ExecutionEngine> ExecutionEngine::Create(
     const ExecutionOptions &config) {
   return Create(config, {});
@@ -130,12 +145,11 @@ std::unique_ptr<llvm::MemoryBuffer> NaiveObjectCache::getObject(
       [&engine](llvm::orc::JITTargetMachineBuilder jtmb)
       -> llvm::Expected<
           std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
-    auto machine = llvm::cantFail(jtmb.createTargetMachine());
     VLOG(1) << "create llvm compile layer";
-    VLOG(1) << "Target Name: " << machine->getTarget().getName();
-    VLOG(1) << "Target CPU: " << machine->getTargetCPU().str() << std::endl;
-    return std::make_unique<llvm::orc::TMOwningSimpleCompiler>(
-        std::move(machine), engine->cache_.get());
+    // ConcurrentIRCompiler builds a TargetMachine per compile, so it stays
+    // safe when materialization runs on the dedicated compile threads.
+    return std::make_unique<llvm::orc::ConcurrentIRCompiler>(
+        std::move(jtmb), engine->cache_.get());
   };
 
   auto object_layer_creator = [&](llvm::orc::ExecutionSession &session,
@@ -151,11 +165,13 @@ std::unique_ptr<llvm::MemoryBuffer> NaiveObjectCache::getObject(
   };
 
   VLOG(2) << "create jit execution engine";
-  engine->jit_ =
-      llvm::cantFail(llvm::orc::LLJITBuilder()
-                         .setCompileFunctionCreator(compile_layer_creator)
-                         .setObjectLinkingLayerCreator(object_layer_creator)
-                         .create());
+  llvm::orc::LLJITBuilder jit_builder;
+  jit_builder.setCompileFunctionCreator(compile_layer_creator)
+      .setObjectLinkingLayerCreator(object_layer_creator);
+  if (config.num_compile_threads > 0) {
+    jit_builder.setNumCompileThreads(config.num_compile_threads);
+  }
+  engine->jit_ = llvm::cantFail(jit_builder.create());
   engine->jit_->getMainJITDylib().addGenerator(llvm::cantFail(
       llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
           engine->jit_->getDataLayout().getGlobalPrefix())));
@@ -196,11 +212,10 @@ void ExecutionEngine::Link(const ir::Module &module, bool add_module) {
     VLOG(5) << "function: " << DumpToString(f);
   }
 
-  llvm::raw_svector_ostream rawstream(buffer_);
-  llvm::legacy::PassManager pass_manager;
-  machine->addPassesToEmitFile(
-      pass_manager, rawstream, nullptr, llvm::CGFT_ObjectFile);
-  pass_manager.run(*m);
+  // Native code generation is left to the ORC compile layer, which only runs
+  // when a symbol of the module is first looked up; emitting an object file
+  // here as well would compile every module a second time before any kernel
+  // can run.
 
   if (add_module) {
     AddSelfModule();
@@ -240,8 +255,18 @@ bool ExecutionEngine::AddSelfModule() {
 }
 
 void ExecutionEngine::ExportObject(const std::string &path) {
+  auto objects = cache_->CopyAllObjects();
+  if (objects.empty()) {
+    LOG(WARNING) << "No compiled object to export to " << path
+                 << ", objects are generated when a symbol of the module is "
+                    "first looked up.";
+    return;
+  }
   FILE *of = fopen(path.c_str(), "w");
-  fwrite(buffer_.data(), 1, buffer_.size(), of);
+  CHECK(of) << "Failed to open file: " << path;
+  for (const auto &object : objects) {
+    fwrite(object->getBufferStart(), 1, object->getBufferSize(), of);
+  }
   fclose(of);
 }
 
@@ -56,15 +56,24 @@ class NaiveObjectCache : public llvm::ObjectCache {
                             llvm::MemoryBufferRef) override;
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *) override;
 
+  //! Copy out every object compiled so far, e.g. to export them to disk.
+  std::vector<std::unique_ptr<llvm::MemoryBuffer>> CopyAllObjects() const;
+
  private:
+  // Compile threads report objects concurrently, guard the map.
+  mutable std::mutex cache_mu_;
   llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> cached_objects_;
 };
 
 struct ExecutionOptions {
   int opt_level{3};
   bool enable_debug_info{false};
-  // TODO(fc500110)
-  // int num_compile_threads{1};
+  // Number of dedicated ORC compile threads. Modules added to the engine are
+  // only materialized when one of their symbols is first looked up, and with
+  // compile threads that materialization is dispatched off the lookup thread,
+  // so several modules compile concurrently. 0 compiles synchronously on the
+  // caller's thread.
+  int num_compile_threads{0};
   // bool enable_fast_math;
 };
 
@@ -106,7 +115,6 @@ class ExecutionEngine {
 
  private:
   mutable std::mutex mu_;
-  llvm::SmallString<0> buffer_;
   std::unique_ptr<llvm::orc::LLJIT> jit_;
   std::unique_ptr<NaiveObjectCache> cache_;
   RuntimeSymbols module_symbols_;
@@ -21,8 +21,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "paddle/cinn/backends/cuda_util.h"
 #include "paddle/cinn/backends/nvrtc/header_generator.h"
@@ -34,6 +38,7 @@ PD_DECLARE_string(cinn_nvcc_cmd_path);
 PD_DECLARE_string(nvidia_package_dir);
 PD_DECLARE_bool(nvrtc_compile_to_cubin);
 PD_DECLARE_bool(cinn_nvrtc_cubin_with_fmad);
+PD_DECLARE_string(cinn_compilation_cache_dir);
 
 namespace cinn {
 namespace backends {
@@ -65,12 +70,114 @@ static std::vector<std::string> GetNvidiaAllIncludePath(
   return include_paths;
 }
 
+// The persistent compilation cache stores the compiled PTX/CUBIN on disk,
+// content-addressed by a hash of the source code plus everything else that
+// influences the produced binary. On a cache hit the stored key material is
+// compared byte-for-byte against the current one, so a hash collision
+// degrades to a recompile instead of loading a wrong binary.
+static std::string HashForCacheKey(const std::string& content) {
+  // FNV-1a, 64 bit. Stable across processes, which std::hash does not
+  // guarantee; collisions are caught by the key-file comparison.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : content) {
+    hash = (hash ^ c) * 0x100000001b3ULL;
+  }
+  char buf[17];
+  snprintf(buf, sizeof(buf), "%016" PRIx64, hash);
+  return std::string(buf);
+}
+
+static std::string ReadWholeFile(const std::string& path) {
+  std::ifstream ifs(path, std::ios::in | std::ios::binary);
+  if (!ifs.is_open()) {
+    return "";
+  }
+  std::ostringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+static bool MakeCacheDirectory(const std::string& dirname) {
+  struct stat st;
+  std::string path;
+  for (size_t i = 0; i < dirname.size(); ++i) {
+    path.push_back(dirname[i]);
+    if (!(dirname[i] == '/' || i + 1 == dirname.size())) {
+      continue;
+    }
+    if (stat(path.c_str(), &st) == 0) {
+      if (S_ISDIR(st.st_mode)) {
+        continue;
+      }
+      LOG(WARNING) << path << " is not a directory, compilation cache "
+                   << "disabled for this run.";
+      return false;
+    }
+    if (mkdir(path.c_str(), S_IRWXU | S_IRGRP | S_IXGRP) != 0 &&
+        errno != EEXIST) {
+      LOG(WARNING) << "Fail to make compilation cache directory: " << path;
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool WriteCacheFile(const std::string& path,
+                           const std::string& content) {
+  // Write to a process-unique temporary and rename, so concurrent workers
+  // populating the same entry never observe a half-written file.
+  std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+  std::ofstream ofs(tmp_path, std::ios::out | std::ios::binary);
+  if (!ofs.is_open()) {
+    return false;
+  }
+  ofs.write(content.data(), content.size());
+  ofs.close();
+  if (!ofs.good() || rename(tmp_path.c_str(), path.c_str()) != 0) {
+    remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
 std::string Compiler::operator()(const std::string& code,
                                  bool include_headers) {
   if (runtime::CanUseNvccCompiler()) {
+    // The nvcc path returns a file path rather than the binary itself and
+    // already persists its outputs; leave it out of the cache.
     return CompileWithNvcc(code);
   }
-  return CompileCudaSource(code, include_headers);
+  if (FLAGS_cinn_compilation_cache_dir.empty()) {
+    return CompileCudaSource(code, include_headers);
+  }
+
+  std::stringstream key;
+  key << "arch:" << GetDeviceArch() << ";cubin:" << compile_to_cubin_
+      << ";cuda:" << CUDA_VERSION
+      << ";fmad:" << FLAGS_cinn_nvrtc_cubin_with_fmad
+      << ";headers:" << include_headers << "\n"
+      << code;
+  const std::string key_material = key.str();
+  const std::string base = FLAGS_cinn_compilation_cache_dir + "/nvrtc_" +
+                           HashForCacheKey(key_material);
+
+  if (ReadWholeFile(base + ".key") == key_material) {
+    std::string cached = ReadWholeFile(base + ".bin");
+    if (!cached.empty()) {
+      VLOG(3) << "Loaded compiled kernel from cache: " << base << ".bin";
+      return cached;
+    }
+  }
+
+  auto data = CompileCudaSource(code, include_headers);
+  if (!data.empty() &&
+      MakeCacheDirectory(FLAGS_cinn_compilation_cache_dir) &&
+      WriteCacheFile(base + ".bin", data)) {
+    // The key file lands last: its presence implies a complete binary.
+    WriteCacheFile(base + ".key", key_material);
+    VLOG(3) << "Stored compiled kernel into cache: " << base << ".bin";
+  }
+  return data;
 }
 
 Compiler::Compiler() {
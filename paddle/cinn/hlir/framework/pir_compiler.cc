@@ -56,10 +56,16 @@ class CompilationContextMapper {
 
 static size_t GetThreadNum(size_t task_size) {
   size_t thread_size = task_size;
-  if (!FLAGS_enable_cinn_compile_cache) {
-    thread_size = 1;
-  } else if (FLAGS_cinn_compile_thread_num > 0) {
+  if (FLAGS_cinn_compile_thread_num > 0) {
+    // An explicit thread count wins even in lazy mode, so multi-group
+    // batches (e.g. the leaf groups of one broadcast tree) can still be
+    // compiled in parallel with the cache disabled.
     thread_size = FLAGS_cinn_compile_thread_num;
+  } else if (!FLAGS_enable_cinn_compile_cache) {
+    // Lazy mode defaults to sequential compilation, which keeps
+    // FLAGS_enable_cinn_compile_cache=false usable as a deterministic
+    // debugging switch.
+    thread_size = 1;
   }
   return thread_size;
 }
@@ -196,6 +196,14 @@ TileConfigMap FileTileConfigDatabase::GetConfigs(
     const common::Target& target, const IterSpaceType& iter_space_type) const {
   // Step 1: Read from json file and convert json to proto message
   std::string file_path = IterSpaceTypeToDir(target, iter_space_type);
+  {
+    std::lock_guard<std::mutex> lock(parsed_configs_mutex_);
+    auto it = parsed_configs_.find(file_path);
+    if (it != parsed_configs_.end()) {
+      VLOG(3) << "Reuse parsed tile configs of " << file_path;
+      return it->second;
+    }
+  }
   auto json_lines = ReadLinesFromFile(file_path);
   size_t line_length = json_lines.size();
 
@@ -232,6 +240,10 @@ TileConfigMap FileTileConfigDatabase::GetConfigs(
     // TODO(XiaZichao): Add function to cut one lattice into smaller ones
   }
   // TODO(XiaZichao): update json file using top view of tileconfigMap
+  {
+    std::lock_guard<std::mutex> lock(parsed_configs_mutex_);
+    parsed_configs_[file_path] = tile_config_map;
+  }
   return tile_config_map;
 }
 
@@ -243,6 +255,11 @@ void FileTileConfigDatabase::AddConfig(const common::Target& target,
   auto status = FileTileConfigDatabase::ToFile(target, priority);
   if (status == true) {
     target_config_data_.clear();
+    // The file changed on disk; drop memoized parses so the next GetConfigs
+    // picks up the new entry. Writes only happen during tuning, so clearing
+    // everything is cheap.
+    std::lock_guard<std::mutex> lock(parsed_configs_mutex_);
+    parsed_configs_.clear();
     return;
   } else {
     PADDLE_THROW(
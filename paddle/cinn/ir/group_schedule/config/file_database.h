@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <string>
+
 #include "paddle/cinn/ir/group_schedule/config/database.h"
 #include "paddle/cinn/ir/group_schedule/config/tile_config_desc.pb.h"
 namespace cinn {
@@ -30,6 +34,11 @@ class FileTileConfigDatabase final : public TileConfigDatabase {
 
  private:
   TileConfigMap target_config_data_;
+  // Parsed configs memoized per json file, so compiling N groups costs one
+  // file read and parse per (target, iter space) instead of N. Guarded by a
+  // mutex because groups are compiled by a thread pool.
+  mutable std::map<std::string, TileConfigMap> parsed_configs_;
+  mutable std::mutex parsed_configs_mutex_;
   bool ToFile(const common::Target& target, int priority);
 };
 
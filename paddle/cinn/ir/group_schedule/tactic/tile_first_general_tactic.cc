@@ -19,6 +19,9 @@
 #include "paddle/cinn/ir/ir.h"
 #include "paddle/cinn/ir/ir_analyzer/ir_analyzer.h"
 #include "paddle/cinn/ir/schedule/ir_schedule_util.h"
+#include "paddle/common/flags.h"
+
+PD_DECLARE_bool(cinn_use_cuda_vectorize);
 
 namespace cinn {
 namespace ir {
@@ -74,6 +77,8 @@ class TileFirstGeneralTactic final : public ScheduleTactic {
   void Apply(ir::IRSchedule* sch, const std::string& block_id) override;
   void ApplyContinuousDataTile(ir::IRSchedule* sch,
                                const std::string& block_id);
+  bool TryVectorizedSpatialTile(ir::IRSchedule* sch,
+                                const std::string& block_id);
 
   std::string TacticName() const override { return "TileFirstGeneralTactic"; }
 
@@ -192,6 +197,17 @@ void TileFirstGeneralTactic::ApplyContinuousDataTile(
           << "], loop nest:\n"
           << sch->GetModule().GetExprs().front();
 
+  // Prefer the vectorized tile for pure spatial groups: each thread handles
+  // a run of consecutive elements, so the vectorize pass can merge its
+  // loads/stores into float4-style builtin vector accesses.
+  if (TryVectorizedSpatialTile(sch, block_id)) {
+    VLOG(4) << "After TryVectorizedSpatialTile on block: [" << block_id
+            << "], loop nest:\n"
+            << sch->GetModule().GetExprs().front();
+    VariableTypeAssignment(sch, block_id);
+    return;
+  }
+
   // Split spatial axes -> [sp_block, sp_loop, sp_thread]
   int current_reduce_axis = 0;
   if (vec_flatten_axis_.size() > 0) {
@@ -264,6 +280,35 @@ void TileFirstGeneralTactic::ApplyContinuousDataTile(
   SetReduceType(sch, block_id);
 }
 
+bool TileFirstGeneralTactic::TryVectorizedSpatialTile(
+    ir::IRSchedule* sch, const std::string& block_id) {
+  if (!FLAGS_cinn_use_cuda_vectorize) return false;
+  if (HasReduceAxis(context_->config)) return false;
+  if (vec_flatten_axis_.empty()) return false;
+  constexpr int kVectorFactor = 4;
+  const auto sp_thread = context_->config.tile_config.warp_num * 32 /
+                         context_->config.tile_config.tree_reduce_num;
+  if (sp_thread <= 0) return false;
+
+  auto loops = sch->GetLoops(block_id);
+  if (loops.size() != 1) return false;
+  const auto* loop_node = loops[0].As<ir::For>();
+  if (!loop_node || !loop_node->extent.As<ir::IntImm>()) return false;
+  const int64_t extent = loop_node->extent.As<ir::IntImm>()->value;
+  // A tail block would leave the inner loop behind a guard, which the
+  // vectorize pass refuses, so the extent must divide evenly. Unaligned or
+  // dynamic shapes fall back to the scalar tile below.
+  if (extent % (sp_thread * kVectorFactor) != 0) return false;
+
+  sch->Split(loops[0],
+             std::vector<int>{-1, static_cast<int>(sp_thread), kVectorFactor});
+  loops = sch->GetLoops(block_id);
+  sch->Bind(loops[0], "blockIdx.x");
+  sch->Bind(loops[1], "threadIdx.x");
+  sch->Vectorize(loops[2], kVectorFactor);
+  return true;
+}
+
 void TileFirstGeneralTactic::MergeFlattenAxis(ir::IRSchedule* sch,
                                               const std::string& block_id) {
   if (vec_flatten_axis_.size() >= 2) {
@@ -242,8 +242,8 @@ PatternNodePtr<T> PatternGraph<T>::MergeNode(
   }
   for (const auto& downstream_node : merged_node->downstream()) {
     downstream_node->AddNodeToUpstream(merged_node);
-    downstream_node->RemoveNodeFromDownstream(upstream);
-    downstream_node->RemoveNodeFromDownstream(downstream);
+    downstream_node->RemoveNodeFromUpstream(upstream);
+    downstream_node->RemoveNodeFromUpstream(downstream);
   }
 
   const auto vec_unique = [](const std::vector<PatternNodePtr<T>>& vec) {
@@ -310,8 +310,11 @@ struct CanFuseRxTMatcher {
 struct CanFuseReduceTreeMatcher {
   template <typename T>
   bool operator()(const PatternGraph<T>& graph, const PatternNodePtr<T>& node) {
+    // MergeReduceTreeOperation only supports a single consumer, so a
+    // multi-consumer reduce tree must stay unfused instead of failing the
+    // precondition check there.
     return StmtPatternGraphMatcher<ReduceTreePattern<T>>()(graph, node) &&
-           !node->downstream().empty() &&
+           node->downstream().size() == 1 &&
            std::holds_alternative<ReduceTreePattern<T>>(
                node->downstream().at(0)->stmt_pattern()) &&
            graph.policy_manager().CanFuse(node, node->downstream().at(0));
@@ -322,7 +325,7 @@ struct CanFuseReduceTreeAndTrivialMatcher {
   template <typename T>
   bool operator()(const PatternGraph<T>& graph, const PatternNodePtr<T>& node) {
     return StmtPatternGraphMatcher<ReduceTreePattern<T>>()(graph, node) &&
-           !node->downstream().empty() &&
+           node->downstream().size() == 1 &&
            std::holds_alternative<TrivialPattern<T>>(
                node->downstream().at(0)->stmt_pattern()) &&
            graph.policy_manager().CanFuse(node, node->downstream().at(0));
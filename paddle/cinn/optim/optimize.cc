@@ -32,6 +32,7 @@
 #include "paddle/cinn/optim/remove_schedule_block.h"
 #include "paddle/cinn/optim/replace_const_param_to_integer.h"
 #include "paddle/cinn/optim/replace_cross_thread_reduction.h"
+#include "paddle/cinn/optim/reuse_temp_buffers.h"
 #include "paddle/cinn/optim/trans_buffer_with_dynamic_shape.h"
 #include "paddle/cinn/optim/transform_gpu_forloop.h"
 #include "paddle/cinn/optim/transform_polyfor_to_for.h"
@@ -102,6 +103,11 @@ Expr Optimize(Expr e,
   IfFusion(&copied);
   VLOG(10) << "After Optimize IfFusion" << copied;
 
+  if (copied.as_lowered_func()) {
+    ReuseTempBuffers(&copied);
+    VLOG(10) << "After Optimize ReuseTempBuffers" << copied;
+  }
+
   if (runtime_debug_info) {
     LOG(WARNING) << "Turn on runtime debug information output";
     InsertDebugLogCallee(&copied);
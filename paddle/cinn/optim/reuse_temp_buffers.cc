@@ -0,0 +1,210 @@
+// Copyright (c) 2026 CINN Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "paddle/cinn/optim/reuse_temp_buffers.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "paddle/cinn/ir/ir_mutator.h"
+#include "paddle/cinn/ir/ir_printer.h"
+#include "paddle/cinn/ir/lowered_func.h"
+
+namespace cinn {
+namespace optim {
+
+namespace {
+
+// Position interval of a buffer's accesses in the function body, counted in
+// visiting order of the tensor references.
+struct LiveRange {
+  int first{std::numeric_limits<int>::max()};
+  int last{-1};
+};
+
+class CollectTempBufferLiveRanges : public ir::IRMutator<> {
+ public:
+  explicit CollectTempBufferLiveRanges(
+      const std::unordered_set<std::string>& candidates)
+      : candidates_(candidates) {}
+
+  void operator()(Expr* expr) { ir::IRMutator<>::Visit(expr, expr); }
+
+  const std::map<std::string, LiveRange>& ranges() const { return ranges_; }
+
+ private:
+  void Visit(const ir::_Tensor_* op, Expr* expr) override {
+    if (op->buffer.defined() && candidates_.count(op->buffer->name)) {
+      LiveRange& range = ranges_[op->buffer->name];
+      range.first = std::min(range.first, pos_);
+      range.last = pos_;
+    }
+    ++pos_;
+    ir::IRMutator<>::Visit(op, expr);
+  }
+
+  // A buffer accessed inside a loop may carry values between iterations, so
+  // widen its live range to the whole outermost loop enclosing the access.
+  void Visit(const ir::For* op, Expr* expr) override {
+    const int entry = pos_;
+    ++loop_depth_;
+    ir::IRMutator<>::Visit(op, expr);
+    --loop_depth_;
+    if (loop_depth_ == 0) {
+      WidenRangesInLoop(entry);
+    }
+  }
+
+  void Visit(const ir::PolyFor* op, Expr* expr) override {
+    const int entry = pos_;
+    ++loop_depth_;
+    ir::IRMutator<>::Visit(op, expr);
+    --loop_depth_;
+    if (loop_depth_ == 0) {
+      WidenRangesInLoop(entry);
+    }
+  }
+
+  void WidenRangesInLoop(int entry) {
+    for (auto& item : ranges_) {
+      if (item.second.last >= entry) {
+        item.second.first = std::min(item.second.first, entry);
+        item.second.last = pos_;
+      }
+    }
+  }
+
+  const std::unordered_set<std::string>& candidates_;
+  std::map<std::string, LiveRange> ranges_;
+  int pos_{0};
+  int loop_depth_{0};
+};
+
+class ReplaceTensorBufferMutator : public ir::IRMutator<> {
+ public:
+  explicit ReplaceTensorBufferMutator(
+      const std::unordered_map<std::string, ir::Buffer>& replacement)
+      : replacement_(replacement) {}
+
+  void operator()(Expr* expr) { ir::IRMutator<>::Visit(expr, expr); }
+
+ private:
+  void Visit(const ir::_Tensor_* op, Expr* expr) override {
+    auto* node = expr->As<ir::_Tensor_>();
+    if (node->buffer.defined()) {
+      auto it = replacement_.find(node->buffer->name);
+      if (it != replacement_.end()) {
+        node->buffer = it->second;
+      }
+    }
+    ir::IRMutator<>::Visit(op, expr);
+  }
+
+  const std::unordered_map<std::string, ir::Buffer>& replacement_;
+};
+
+bool GetConstantShape(const ir::Buffer& buffer, std::vector<int64_t>* shape) {
+  for (const Expr& dim : buffer->shape) {
+    const ir::IntImm* int_dim = dim.As<ir::IntImm>();
+    if (!int_dim) return false;
+    shape->push_back(int_dim->value);
+  }
+  return true;
+}
+
+}  // namespace
+
+void ReuseTempBuffers(ir::Expr* expr) {
+  ir::_LoweredFunc_* func = expr->as_lowered_func();
+  if (!func) return;
+
+  // Step 1. Pick the buffers whose allocation we may plan: heap temp buffers
+  // with fully constant shapes. Buffers bound to dynamic shapes keep their own
+  // allocation, since their sizes are unknown until execution.
+  std::unordered_set<std::string> candidates;
+  std::unordered_map<std::string, ir::Buffer> name_to_buffer;
+  std::unordered_map<std::string, std::vector<int64_t>> name_to_shape;
+  for (const ir::Buffer& buf : func->temp_bufs) {
+    if (buf->memory_type != ir::MemoryType::Heap) continue;
+    if (buf->shape.empty() || buf->type() == Void()) continue;
+    std::vector<int64_t> shape;
+    if (!GetConstantShape(buf, &shape)) continue;
+    candidates.insert(buf->name);
+    name_to_buffer[buf->name] = buf;
+    name_to_shape[buf->name] = std::move(shape);
+  }
+  if (candidates.size() < 2) return;
+
+  CollectTempBufferLiveRanges collector(candidates);
+  collector(&func->body);
+
+  // Step 2. Greedily assign each buffer, in order of first use, to the first
+  // earlier buffer of the same dtype and shape whose live range has already
+  // ended. Unmatched buffers become representatives that later ones can join.
+  std::vector<std::pair<std::string, LiveRange>> ordered(
+      collector.ranges().begin(), collector.ranges().end());
+  std::sort(ordered.begin(),
+            ordered.end(),
+            [](const std::pair<std::string, LiveRange>& a,
+               const std::pair<std::string, LiveRange>& b) {
+              return a.second.first < b.second.first;
+            });
+
+  std::unordered_map<std::string, ir::Buffer> replacement;
+  std::vector<std::pair<ir::Buffer, LiveRange>> representatives;
+  for (const auto& [name, range] : ordered) {
+    const ir::Buffer& buffer = name_to_buffer.at(name);
+    bool reused = false;
+    for (auto& [rep_buffer, rep_range] : representatives) {
+      if (range.first <= rep_range.last) continue;
+      if (rep_buffer->dtype != buffer->dtype) continue;
+      if (name_to_shape.at(rep_buffer->name) != name_to_shape.at(name)) {
+        continue;
+      }
+      VLOG(4) << "ReuseTempBuffers: bind " << name << " to "
+              << rep_buffer->name;
+      replacement[name] = rep_buffer;
+      rep_range.last = range.last;
+      reused = true;
+      break;
+    }
+    if (!reused) {
+      representatives.emplace_back(buffer, range);
+    }
+  }
+  if (replacement.empty()) return;
+
+  // Step 3. Rebind the tensors of merged buffers and drop the merged buffers
+  // from temp_bufs, so codegen emits one malloc/free pair per representative.
+  ReplaceTensorBufferMutator mutator(replacement);
+  mutator(&func->body);
+  std::vector<ir::Buffer> kept_bufs;
+  kept_bufs.reserve(func->temp_bufs.size() - replacement.size());
+  for (const ir::Buffer& buf : func->temp_bufs) {
+    if (!replacement.count(buf->name)) {
+      kept_bufs.push_back(buf);
+    }
+  }
+  func->temp_bufs = std::move(kept_bufs);
+  VLOG(4) << "ReuseTempBuffers merged " << replacement.size()
+          << " temp buffers in function " << func->name;
+}
+
+}  // namespace optim
+}  // namespace cinn
@@ -0,0 +1,35 @@
+// Copyright (c) 2026 CINN Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "paddle/cinn/ir/ir.h"
+
+namespace cinn {
+namespace optim {
+
+/**
+ * Plan the storage of a lowered function's heap temp buffers at compile time.
+ * It computes a live range for every temp buffer from the order of its
+ * accesses in the function body, then binds buffers whose live ranges do not
+ * overlap to one shared allocation. Each merged buffer removes one runtime
+ * malloc/free pair from the generated function and lowers its peak memory.
+ *
+ * Only host (Heap) buffers with constant shapes take part: GPU shared/local
+ * buffers are accessed by many threads at once, so the sequential live range
+ * computed here would not be a safe reuse criterion for them.
+ */
+void ReuseTempBuffers(ir::Expr* expr);
+
+}  // namespace optim
+}  // namespace cinn
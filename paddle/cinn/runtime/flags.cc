@@ -142,6 +142,12 @@ PD_DEFINE_bool(cinn_use_cuda_vectorize,
                BoolFromEnv("FLAGS_cinn_use_cuda_vectorize", false),
                "Whether use cuda vectorize on schedule config");
 
+PD_DEFINE_bool(cinn_use_cuda_graph,
+               BoolFromEnv("FLAGS_cinn_use_cuda_graph", false),
+               "Whether to capture the kernel launches of static-shape CINN "
+               "groups into CUDA graphs at first run and replay them on "
+               "later runs.");
+
 PD_DEFINE_bool(use_reduce_split_pass,
                BoolFromEnv("FLAGS_use_reduce_split_pass", false),
                "Whether use reduce split pass.");
@@ -168,6 +174,14 @@ PD_DEFINE_bool(
     "technique which contract fp multiplication and addition/subtraction into "
     "multiply-add operation. It may result in different fp precision.");
 
+PD_DEFINE_string(
+    cinn_compilation_cache_dir,
+    StringFromEnv("FLAGS_cinn_compilation_cache_dir", ""),
+    "Specify the directory of the persistent compilation cache. Compiled "
+    "device binaries (PTX/CUBIN) are stored there keyed by source hash and "
+    "target, so on a restart identical kernels are loaded from disk instead "
+    "of being recompiled. Empty (the default) disables the cache.");
+
 // FLAGS for performance analysis and accuracy debug
 PD_DEFINE_bool(cinn_sync_run,
                BoolFromEnv("FLAGS_cinn_sync_run", false),
@@ -115,20 +115,6 @@ std::string DDim::to_str() const {
   return ss.str();
 }
 
-struct ProductVisitor {
-  template <int D>
-  inline int64_t operator()(const Dim<D>& dim) {
-    return product(dim);
-  }
-};
-
-int64_t product(const DDim& ddim) {
-  if (ddim.size() == -1) {
-    return 0;
-  }
-  return ddim.apply_visitor(ProductVisitor());
-}
-
 bool contain_unknown_dim(const DDim& ddim) {
   for (int i = 0; i < ddim.size(); ++i) {
     if (ddim[i] < 0) {
@@ -214,12 +200,49 @@ DDim flatten_to_2d(const DDim& src, int num_col_dims) {
 
 DDim flatten_to_1d(const DDim& src) { return DDim({product(src)}); }
 
+namespace {
+
+// Rank-templated so the backward multiply chains below unroll completely for
+// each rank instead of looping with a runtime bound.
+struct StrideVisitor {
+  explicit StrideVisitor(int64_t* strides) : strides_(strides) {}
+
+  template <int D>
+  inline void operator()(const Dim<D>& dim) const {
+    if (D > 0) {
+      strides_[D - 1] = 1;
+      for (int i = D - 2; i >= 0; --i) {
+        strides_[i] = strides_[i + 1] * dim[i + 1];
+      }
+    }
+  }
+
+  int64_t* strides_;
+};
+
+struct StrideNumelVisitor {
+  explicit StrideNumelVisitor(int64_t* strides) : strides_(strides) {}
+
+  template <int D>
+  inline void operator()(const Dim<D>& dim) const {
+    if (D > 0) {
+      strides_[D - 1] = dim[D - 1];
+      for (int i = D - 2; i >= 0; --i) {
+        strides_[i] = strides_[i + 1] * dim[i];
+      }
+    }
+  }
+
+  int64_t* strides_;
+};
+
+}  // namespace
+
 DDim stride(const DDim& ddim) {
   DDim strides;
   strides.rank_ = ddim.size();
-  if (ddim.size() > 0) strides[ddim.size() - 1] = 1;
-  for (int i = ddim.size() - 2; i >= 0; --i) {
-    strides[i] = strides[i + 1] * ddim[i + 1];
+  if (ddim.size() > 0) {
+    ddim.apply_visitor(StrideVisitor(strides.GetMutable()));
   }
   return strides;
 }
@@ -227,9 +250,8 @@ DDim stride(const DDim& ddim) {
 DDim stride_numel(const DDim& ddim) {
   DDim strides;
   strides.rank_ = ddim.size();
-  if (ddim.size() > 0) strides[ddim.size() - 1] = ddim[ddim.size() - 1];
-  for (int i = ddim.size() - 2; i >= 0; --i) {
-    strides[i] = strides[i + 1] * ddim[i];
+  if (ddim.size() > 0) {
+    ddim.apply_visitor(StrideNumelVisitor(strides.GetMutable()));
   }
   return strides;
 }
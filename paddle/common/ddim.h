@@ -192,7 +192,24 @@ std::vector<T> vectorize(const DDim& ddim) {
   return result;
 }
 
-TEST_API int64_t product(const DDim& ddim);
+namespace detail {
+struct ProductVisitor {
+  template <int D>
+  inline int64_t operator()(const Dim<D>& dim) const {
+    return product(dim);
+  }
+};
+}  // namespace detail
+
+// Inline so that the rank-unrolled multiply chain folds into callers such as
+// DenseTensor::numel() instead of paying an out-of-line visitor dispatch on
+// every shape query.
+inline int64_t product(const DDim& ddim) {
+  if (ddim.size() == -1) {
+    return 0;
+  }
+  return ddim.apply_visitor(detail::ProductVisitor());
+}
 
 TEST_API bool contain_unknown_dim(const DDim& ddim);
 
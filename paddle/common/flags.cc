@@ -650,6 +650,25 @@ PHI_DEFINE_EXPORTED_bool(custom_device_mem_record,
 
 #endif
 
+/**
+ * Memory related FLAG
+ * Name: FLAGS_tensor_copy_on_write
+ * Since Version: 2.7.0
+ * Value Range: bool, default=false
+ * Example:
+ * Note: If set true, TensorCopy between tensors on the same place shares the
+ *       source allocation instead of cloning it, and the clone is deferred
+ *       until one of the two tensors is actually written.
+ */
+PHI_DEFINE_EXPORTED_bool(
+    tensor_copy_on_write,
+    false,
+    "Whether TensorCopy onto the same place shares the source allocation "
+    "copy-on-write instead of cloning it eagerly. The deep copy is deferred "
+    "until one of the tensors is written through its mutable data "
+    "interfaces. Aliasing an allocation through raw Holder()/ResetHolder "
+    "calls bypasses the write barrier, so this is off by default.");
+
 /**
  * Scope related FLAG
  * Name: local_exe_sub_scope_limit
@@ -754,6 +773,25 @@ PHI_DEFINE_EXPORTED_int32(
  */
 PHI_DEFINE_EXPORTED_bool(set_to_1d, false, "set 0D Tensor to 1D numpy");
 
+/**
+ * Interop related FLAG
+ * Name: eager_numpy_zero_copy
+ * Since Version: 3.0.0
+ * Value Range: bool, default=false
+ * Example:
+ * Note: Share buffers between eager CPU tensors and numpy arrays instead of
+ * copying them. Tensor.numpy() returns a view over a contiguous CPU tensor's
+ * own allocation (the array pins the tensor through its base object), and
+ * creating a tensor from a C-contiguous writable ndarray adopts the ndarray's
+ * memory. The two sides then alias: writes through one are visible through
+ * the other, which is why this is off by default.
+ */
+PHI_DEFINE_EXPORTED_bool(eager_numpy_zero_copy,
+                         false,
+                         "Share buffers between eager CPU tensors and numpy "
+                         "arrays in Tensor.numpy()/ingestion instead of "
+                         "copying");
+
 /**
  * Debug related FLAG
  * Name: tracer_onednn_ops_on
@@ -1158,6 +1196,23 @@ PHI_DEFINE_EXPORTED_uint64(executor_log_deps_every_microseconds,
                            0,
                            "Enable new executor log deps every n microseconds");
 
+/*
+ * Executor related FLAG
+ * Name: FLAGS_executor_program_cache_dir
+ * Since Version: 3.0
+ * Value Range: string, default=""
+ * Example: FLAGS_executor_program_cache_dir="/tmp/prog_cache" persists the
+ * optimized programs built for dy2static execution under that directory and
+ * reuses them across process restarts.
+ */
+PHI_DEFINE_EXPORTED_string(
+    executor_program_cache_dir,
+    "",
+    "If non-empty, persist the optimized programs built for dy2static "
+    "execution under this directory, keyed by a hash of the source program, "
+    "and reuse them across process restarts instead of rerunning the "
+    "lowering passes.");
+
 PD_DEFINE_int32(record_pool_max_size,
                 2000000,
                 "SlotRecordDataset slot record pool max size");
@@ -1173,6 +1228,38 @@ PD_DEFINE_bool(enable_slotrecord_reset_shrink,  // NOLINT
 PD_DEFINE_bool(enable_ins_parser_file,  // NOLINT
                false,
                "enable parser ins file, default false");
+PD_DEFINE_bool(enable_gpu_direct_batch_decompress,  // NOLINT
+               false,
+               "upload compressed feed batches and decompress them on the "
+               "device, default false");
+PD_DEFINE_int32(reader_file_block_size_mb,  // NOLINT
+                0,
+                "split local input files into blocks of this many MB so that "
+                "reader threads can share a large file, 0 means whole files");
+PD_DEFINE_int32(reader_load_prefetch_depth,  // NOLINT
+                0,
+                "block size of the input channel while loading into memory, "
+                "i.e. how many records a reader buffers before publishing "
+                "them, 0 keeps the channel default");
+PD_DEFINE_int32(load_combine_thread_num,  // NOLINT
+                0,
+                "number of threads used to deserialize the records of a "
+                "combined parameter file, 0 picks up to 8 hardware threads, "
+                "1 falls back to sequential deserialization");
+PD_DEFINE_bool(checkpoint_direct_io,  // NOLINT
+               false,
+               "stream checkpoint files through an O_DIRECT writer with "
+               "aligned double buffering instead of buffered stdio, so "
+               "large saves do not evict warm pages from the page cache; "
+               "falls back to buffered writes where O_DIRECT is "
+               "unsupported");
+PD_DEFINE_int32(lockfree_feed_channel_capacity,  // NOLINT
+                0,
+                "if > 0, back the dataset input channel with a bounded "
+                "lock-free ring of this many records (rounded up to a power "
+                "of two) instead of the mutex based channel, 0 keeps the "
+                "default. The ring does not support snapshotting the channel "
+                "contents (e.g. GPUPS pass building)");
 PHI_DEFINE_EXPORTED_bool(
     gpugraph_enable_hbm_table_collision_stat,
     false,
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/common/hot_counter.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace common {
+
+HotCounter::Cell* HotCounter::CellForThisThread() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  cells_.emplace_back(new Cell());
+  return cells_.back().get();
+}
+
+uint64_t HotCounter::Value() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  uint64_t total = 0;
+  for (const auto& cell : cells_) {
+    total += cell->value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void HotCounter::Reset() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& cell : cells_) {
+    cell->value.store(0, std::memory_order_relaxed);
+  }
+}
+
+CounterRegistry& CounterRegistry::Instance() {
+  static CounterRegistry instance;
+  return instance;
+}
+
+HotCounter& CounterRegistry::GetCounter(const std::string& name) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto& counter = counters_[name];
+  if (counter == nullptr) {
+    counter.reset(new HotCounter(name));
+  }
+  return *counter;
+}
+
+namespace {
+
+std::vector<std::pair<std::string, uint64_t>> SortedSnapshot(
+    const std::unordered_map<std::string, std::unique_ptr<HotCounter>>&
+        counters) {
+  std::vector<std::pair<std::string, uint64_t>> snapshot;
+  snapshot.reserve(counters.size());
+  for (const auto& item : counters) {
+    snapshot.emplace_back(item.first, item.second->Value());
+  }
+  std::sort(snapshot.begin(), snapshot.end());
+  return snapshot;
+}
+
+}  // namespace
+
+std::string CounterRegistry::ReportText() const {
+  std::vector<std::pair<std::string, uint64_t>> snapshot;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    snapshot = SortedSnapshot(counters_);
+  }
+  std::ostringstream os;
+  for (const auto& item : snapshot) {
+    os << item.first << " " << item.second << "\n";
+  }
+  return os.str();
+}
+
+std::string CounterRegistry::ReportJson() const {
+  std::vector<std::pair<std::string, uint64_t>> snapshot;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    snapshot = SortedSnapshot(counters_);
+  }
+  std::ostringstream os;
+  os << "{";
+  bool first = true;
+  for (const auto& item : snapshot) {
+    if (!first) {
+      os << ",";
+    }
+    first = false;
+    os << "\"" << item.first << "\":" << item.second;
+  }
+  os << "}";
+  return os.str();
+}
+
+void CounterRegistry::ResetAll() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& item : counters_) {
+    item.second->Reset();
+  }
+}
+
+}  // namespace common
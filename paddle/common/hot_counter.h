@@ -0,0 +1,103 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "paddle/common/macros.h"
+
+namespace common {
+
+// Counting sibling of PerformanceStatistician: the statistician records
+// labelled time ranges under a mutex, which is fine for CINN compilation
+// but far too heavy for per-dispatch bookkeeping. HotCounter is built
+// for hot paths instead: each counter shards its value over per-thread
+// cache-line-padded cells, so an increment is a single relaxed fetch_add
+// on a line no other thread writes, and the cells are only summed when a
+// report is pulled. Cells of exited threads are kept (the counters are
+// monotonic, so their contribution stays valid).
+//
+// Use through the macros below, which cache the registry and cell lookup
+// in function-local statics per call site:
+//
+//   COMMON_HOT_COUNTER_INC("kernel_factory.select");
+//   COMMON_HOT_COUNTER_ADD("allocator.bytes", size);
+class HotCounter {
+ public:
+  struct alignas(64) Cell {
+    std::atomic<uint64_t> value{0};
+  };
+
+  explicit HotCounter(std::string name) : name_(std::move(name)) {}
+
+  // This thread's cell, created on first use. The returned pointer stays
+  // valid for the process lifetime, so call sites may cache it in a
+  // thread_local.
+  Cell* CellForThisThread();
+
+  // Sum over all cells; approximate while other threads are incrementing.
+  uint64_t Value() const;
+
+  void Reset();
+
+  const std::string& name() const { return name_; }
+
+ private:
+  const std::string name_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<Cell>> cells_;
+};
+
+class CounterRegistry {
+ public:
+  static CounterRegistry& Instance();
+
+  // Finds or creates the named counter; the reference never invalidates.
+  HotCounter& GetCounter(const std::string& name);
+
+  // One "name value" line per counter, sorted by name.
+  std::string ReportText() const;
+
+  // {"name":value,...}, sorted by name.
+  std::string ReportJson() const;
+
+  void ResetAll();
+
+ private:
+  CounterRegistry() = default;
+  DISABLE_COPY_AND_ASSIGN(CounterRegistry);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<HotCounter>> counters_;
+};
+
+}  // namespace common
+
+#define COMMON_HOT_COUNTER_ADD(name, n)                               \
+  do {                                                                \
+    static ::common::HotCounter& __hot_counter__ =                    \
+        ::common::CounterRegistry::Instance().GetCounter(name);       \
+    static thread_local ::common::HotCounter::Cell* __hot_cell__ =    \
+        __hot_counter__.CellForThisThread();                          \
+    __hot_cell__->value.fetch_add((n), std::memory_order_relaxed);    \
+  } while (0)
+
+#define COMMON_HOT_COUNTER_INC(name) COMMON_HOT_COUNTER_ADD(name, 1)
@@ -18,25 +18,48 @@
 namespace paddle {
 namespace distributed {
 
-AsyncLoad::Task::Task(const Place& place)
-    : load_event_(place, platform::GenerateDeviceEventFlag()),
-      task_place_(place) {}
-
-AsyncLoad::Task::~Task() {}
+AsyncLoad::Task::Task(const Place& place,
+                      std::unique_ptr<platform::DeviceEvent> event,
+                      std::shared_ptr<EventPool> pool)
+    : load_event_(std::move(event)),
+      task_place_(place),
+      pool_(std::move(pool)) {}
+
+AsyncLoad::Task::~Task() {
+  // Hand the event back so the next task reuses it instead of creating a
+  // fresh one.
+  if (pool_ != nullptr && load_event_ != nullptr) {
+    std::lock_guard<std::mutex> guard(pool_->mutex);
+    pool_->events.push_back(std::move(load_event_));
+  }
+}
 
-bool AsyncLoad::Task::IsCompleted() { return load_event_.Query(); }
+bool AsyncLoad::Task::IsCompleted() { return load_event_->Query(); }
 
 void AsyncLoad::Task::Synchronize() {
   const auto* calc_ctx = phi::DeviceContextPool::Instance().Get(task_place_);
-  load_event_.Wait(platform::Place2DeviceType(task_place_), calc_ctx);
+  load_event_->Wait(platform::Place2DeviceType(task_place_), calc_ctx);
 }
 
 void AsyncLoad::Task::UpdateWaitChain(const phi::DeviceContext& ctx) {
-  load_event_.Record(&ctx);
+  load_event_->Record(&ctx);
 }
 
 std::shared_ptr<AsyncLoad::Task> AsyncLoad::CreateTask(const Place& place) {
-  return std::make_shared<AsyncLoad::Task>(place);
+  std::unique_ptr<platform::DeviceEvent> event;
+  {
+    std::lock_guard<std::mutex> guard(event_pool_->mutex);
+    if (!event_pool_->events.empty()) {
+      event = std::move(event_pool_->events.back());
+      event_pool_->events.pop_back();
+    }
+  }
+  if (event == nullptr) {
+    event = std::make_unique<platform::DeviceEvent>(
+        place, platform::GenerateDeviceEventFlag());
+  }
+  return std::make_shared<AsyncLoad::Task>(
+      place, std::move(event), event_pool_);
 }
 
 void AsyncLoad::SyncCalcuStream(const Place& place,
@@ -50,23 +73,35 @@ void AsyncLoad::SyncCalcuStream(const Place& place,
 
 std::shared_ptr<AsyncLoad::Task> AsyncLoad::Offload(
     phi::DenseTensor* dst, const phi::DenseTensor& src) {
-  // GPU -> GPUPinned
-  const auto& place = src.place();
-
-  PADDLE_ENFORCE_EQ(
-      phi::is_gpu_place(place),
-      true,
-      phi::errors::InvalidArgument(
-          "AsyncLoad::Offload only support GPU -> GPUPinned now."));
+  return OffloadBatch({dst}, {src});
+}
 
-  dst->Resize(src.dims());
-  auto size = src.numel() * phi::SizeOf(src.dtype());
-  auto* dev_ctx = static_cast<phi::GPUContext*>(
-      phi::DeviceContextPool::Instance().Get(place));
-  auto* dst_ptr = dev_ctx->Alloc(dst, src.dtype(), size, true);
-  auto* src_ptr = src.data();
+std::shared_ptr<AsyncLoad::Task> AsyncLoad::OffloadBatch(
+    const std::vector<phi::DenseTensor*>& dsts,
+    const std::vector<phi::DenseTensor>& srcs) {
+  // GPU -> GPUPinned
+  PADDLE_ENFORCE_EQ(dsts.size(),
+                    srcs.size(),
+                    phi::errors::InvalidArgument(
+                        "AsyncLoad::OffloadBatch requires as many dst tensors "
+                        "as src tensors, but got %d and %d.",
+                        dsts.size(),
+                        srcs.size()));
+  PADDLE_ENFORCE_EQ(srcs.empty(),
+                    false,
+                    phi::errors::InvalidArgument(
+                        "AsyncLoad::OffloadBatch got an empty batch."));
+
+  const auto& place = srcs.front().place();
+  for (const auto& src : srcs) {
+    PADDLE_ENFORCE_EQ(
+        phi::is_gpu_place(src.place()),
+        true,
+        phi::errors::InvalidArgument(
+            "AsyncLoad::Offload only support GPU -> GPUPinned now."));
+  }
 
-  // 1. wait calc stream to finish
+  // 1. wait calc stream to finish, once for the whole batch
   std::string key = "load";
 
   if (!is_initialized_) {
@@ -78,12 +113,21 @@ std::shared_ptr<AsyncLoad::Task> AsyncLoad::Offload(
   }
   SyncCalcuStream(gpu_place_, load_ctx_.get(), place_to_calc_event_.at(key));
 
-  // 2. copy data from src to dst
+  // 2. copy data from srcs to dsts on the load stream
+  auto* dev_ctx = static_cast<phi::GPUContext*>(
+      phi::DeviceContextPool::Instance().Get(place));
   auto stream = load_ctx_->stream();
-  phi::memory_utils::Copy(
-      dst->place(), dst_ptr, src.place(), src_ptr, size, stream);
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    const phi::DenseTensor& src = srcs[i];
+    phi::DenseTensor* dst = dsts[i];
+    dst->Resize(src.dims());
+    auto size = src.numel() * phi::SizeOf(src.dtype());
+    auto* dst_ptr = dev_ctx->Alloc(dst, src.dtype(), size, true);
+    phi::memory_utils::Copy(
+        dst->place(), dst_ptr, src.place(), src.data(), size, stream);
+  }
 
-  // 3. record event on offload stream
+  // 3. record one event on the offload stream covering all copies
   auto task = CreateTask(place);
   task->UpdateWaitChain(*load_ctx_);
   return task;
@@ -91,38 +135,58 @@ std::shared_ptr<AsyncLoad::Task> AsyncLoad::Offload(
 
 std::shared_ptr<AsyncLoad::Task> AsyncLoad::Reload(
     phi::DenseTensor* dst, const phi::DenseTensor& src) {
+  return ReloadBatch({dst}, {src});
+}
+
+std::shared_ptr<AsyncLoad::Task> AsyncLoad::ReloadBatch(
+    const std::vector<phi::DenseTensor*>& dsts,
+    const std::vector<phi::DenseTensor>& srcs) {
   // GPUPinned -> GPU
-  const auto& place = src.place();
-  PADDLE_ENFORCE_EQ(
-      phi::is_cuda_pinned_place(place),
-      true,
-      phi::errors::InvalidArgument(
-          "AsyncLoad::Reload only support GPUPinned -> GPU now."));
+  PADDLE_ENFORCE_EQ(dsts.size(),
+                    srcs.size(),
+                    phi::errors::InvalidArgument(
+                        "AsyncLoad::ReloadBatch requires as many dst tensors "
+                        "as src tensors, but got %d and %d.",
+                        dsts.size(),
+                        srcs.size()));
+  PADDLE_ENFORCE_EQ(srcs.empty(),
+                    false,
+                    phi::errors::InvalidArgument(
+                        "AsyncLoad::ReloadBatch got an empty batch."));
+  for (const auto& src : srcs) {
+    PADDLE_ENFORCE_EQ(
+        phi::is_cuda_pinned_place(src.place()),
+        true,
+        phi::errors::InvalidArgument(
+            "AsyncLoad::Reload only support GPUPinned -> GPU now."));
+  }
 
   PADDLE_ENFORCE_EQ(is_initialized_,
                     true,
                     phi::errors::PreconditionNotMet(
                         "You should call Offload before Reload."));
 
-  auto* dev_ctx = static_cast<phi::GPUContext*>(
-      phi::DeviceContextPool::Instance().Get(gpu_place_));
-
-  dst->Resize(src.dims());
-  auto size = src.numel() * phi::SizeOf(src.dtype());
-  auto* dst_ptr = dev_ctx->Alloc(dst, src.dtype(), size, false);
-  auto* src_ptr = src.data();
-
-  // 1. wait calc stream to finish
+  // 1. wait calc stream to finish, once for the whole batch
   std::string key = "load";
 
   SyncCalcuStream(gpu_place_, load_ctx_.get(), place_to_calc_event_.at(key));
 
-  // 2. copy data from src to dst
+  // 2. copy data from srcs to dsts on the load stream, in the given order so
+  // that callers can schedule prefetch-back along the backward pass
+  auto* dev_ctx = static_cast<phi::GPUContext*>(
+      phi::DeviceContextPool::Instance().Get(gpu_place_));
   auto stream = load_ctx_->stream();
-  phi::memory_utils::Copy(
-      dst->place(), dst_ptr, src.place(), src_ptr, size, stream);
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    const phi::DenseTensor& src = srcs[i];
+    phi::DenseTensor* dst = dsts[i];
+    dst->Resize(src.dims());
+    auto size = src.numel() * phi::SizeOf(src.dtype());
+    auto* dst_ptr = dev_ctx->Alloc(dst, src.dtype(), size, false);
+    phi::memory_utils::Copy(
+        dst->place(), dst_ptr, src.place(), src.data(), size, stream);
+  }
 
-  // 3. record event on offload stream
+  // 3. record one event on the offload stream covering all copies
   auto task = CreateTask(gpu_place_);
   task->UpdateWaitChain(*load_ctx_);
   return task;
@@ -16,6 +16,7 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,22 +35,40 @@ using Place = phi::Place;
 
 class AsyncLoad {
  public:
+  // A ring of completion events shared by all tasks of one AsyncLoad. Tasks
+  // draw a recycled event instead of creating a fresh one per offload call
+  // and return it when they are destroyed.
+  struct EventPool {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<platform::DeviceEvent>> events;
+  };
+
   class Task {
    public:
-    explicit Task(const Place& place);
+    Task(const Place& place,
+         std::unique_ptr<platform::DeviceEvent> event,
+         std::shared_ptr<EventPool> pool);
     virtual ~Task();
     bool IsCompleted();
     void Synchronize();
     void UpdateWaitChain(const phi::DeviceContext& ctx);
 
    private:
-    platform::DeviceEvent load_event_;  // event on offload stream
+    std::unique_ptr<platform::DeviceEvent>
+        load_event_;  // event on offload stream
     Place task_place_;
+    std::shared_ptr<EventPool> pool_;
   };
 
   std::shared_ptr<AsyncLoad::Task> Offload(phi::DenseTensor* dst,
                                            const phi::DenseTensor& src);
 
+  // Offloads a bucket of tensors with one calc-stream sync and a single
+  // completion event covering every copy. The two vectors pair up by index.
+  std::shared_ptr<AsyncLoad::Task> OffloadBatch(
+      const std::vector<phi::DenseTensor*>& dsts,
+      const std::vector<phi::DenseTensor>& srcs);
+
   void PrepareLoadEnv(const std::string& key, const Place& place);
   void SyncCalcuStream(const Place& place,
                        phi::GPUContext* ctx,
@@ -57,12 +76,20 @@ class AsyncLoad {
   std::shared_ptr<AsyncLoad::Task> Reload(phi::DenseTensor* dst,
                                           const phi::DenseTensor& src);
 
+  // Batched counterpart of Reload. Copies are issued on the load stream in
+  // the order given, so a caller driving ZeRO-style prefetch passes tensors
+  // in backward execution order and waits on one task per bucket.
+  std::shared_ptr<AsyncLoad::Task> ReloadBatch(
+      const std::vector<phi::DenseTensor*>& dsts,
+      const std::vector<phi::DenseTensor>& srcs);
+
  private:
   std::unordered_map<std::string, platform::DeviceEvent>
       place_to_calc_event_;  // event on calc stream
   bool is_initialized_{false};
   std::unique_ptr<phi::GPUContext> load_ctx_;
   Place gpu_place_;
+  std::shared_ptr<EventPool> event_pool_ = std::make_shared<EventPool>();
   std::shared_ptr<AsyncLoad::Task> CreateTask(const Place& place);
 };
 
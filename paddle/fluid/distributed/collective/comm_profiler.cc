@@ -0,0 +1,196 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/distributed/collective/comm_profiler.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "paddle/fluid/platform/enforce.h"
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_bool(
+    enable_nccl_comm_profiling,
+    false,
+    "Whether ProcessGroupNCCL records per-collective size, duration, "
+    "queue wait and realized bus bandwidth, aggregated per communicator "
+    "and exported by core.nccl_comm_profile_summary().");
+
+namespace paddle {
+namespace distributed {
+
+namespace {
+
+gpuEvent_t CreateTimingEvent() {
+  gpuEvent_t event;
+  // Flag 0 keeps timing enabled, unlike gpuEventDisableTiming used for
+  // the synchronization-only events elsewhere in this directory.
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventCreateWithFlags(&event, 0));
+  return event;
+}
+
+float ElapsedMs(gpuEvent_t start, gpuEvent_t end) {
+  float ms = 0.0f;
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(hipEventElapsedTime(&ms, start, end));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventElapsedTime(&ms, start, end));
+#endif
+  return ms;
+}
+
+// Bus bandwidth correction factors from nccl-tests: the ratio of bytes
+// actually moved over the busiest link to the message size.
+double BusBandwidthFactor(phi::distributed::CommType comm_type, int nranks) {
+  using phi::distributed::CommType;
+  double n = static_cast<double>(std::max(nranks, 1));
+  switch (comm_type) {
+    case CommType::ALLREDUCE:
+    case CommType::ALLREDUCE_SPARSE:
+      return 2.0 * (n - 1.0) / n;
+    case CommType::ALLGATHER:
+    case CommType::REDUCE_SCATTER:
+    case CommType::ALLTOALL:
+      return (n - 1.0) / n;
+    default:
+      return 1.0;
+  }
+}
+
+}  // namespace
+
+NCCLCommProfiler& NCCLCommProfiler::Instance() {
+  static NCCLCommProfiler instance;
+  return instance;
+}
+
+NCCLCommProfiler::~NCCLCommProfiler() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& record : pending_) {
+    ReleaseEvents(record.get());
+  }
+  pending_.clear();
+}
+
+bool NCCLCommProfiler::IsEnabled() { return FLAGS_enable_nccl_comm_profiling; }
+
+std::unique_ptr<NCCLCommProfiler::PendingRecord>
+NCCLCommProfiler::StartCollective(int gid,
+                                  const std::string& comm_key,
+                                  phi::distributed::CommType comm_type,
+                                  int nranks,
+                                  int64_t size_bytes,
+                                  uint64_t seq,
+                                  gpuStream_t calc_stream,
+                                  gpuStream_t comm_stream) {
+  auto record = std::make_unique<PendingRecord>();
+  record->gid = gid;
+  record->comm_key = comm_key;
+  record->comm_type = comm_type;
+  record->nranks = nranks;
+  record->size_bytes = size_bytes;
+  record->seq = seq;
+  record->enqueue_event = CreateTimingEvent();
+  record->start_event = CreateTimingEvent();
+  record->end_event = CreateTimingEvent();
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      gpuEventRecord(record->enqueue_event, calc_stream));
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventRecord(record->start_event, comm_stream));
+  return record;
+}
+
+void NCCLCommProfiler::EndCollective(std::unique_ptr<PendingRecord> record,
+                                     gpuStream_t comm_stream) {
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventRecord(record->end_event, comm_stream));
+  std::lock_guard<std::mutex> guard(mutex_);
+  pending_.push_back(std::move(record));
+}
+
+void NCCLCommProfiler::ReleaseEvents(PendingRecord* record) {
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventDestroy(record->enqueue_event));
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventDestroy(record->start_event));
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventDestroy(record->end_event));
+}
+
+void NCCLCommProfiler::CollectCompleted() {
+  for (auto iter = pending_.begin(); iter != pending_.end();) {
+    PendingRecord* record = iter->get();
+    gpuError_t status = gpuEventQuery(record->end_event);
+    if (status == gpuErrorNotReady) {
+      ++iter;
+      continue;
+    }
+    PADDLE_ENFORCE_GPU_SUCCESS(status);
+
+    double duration_ms = ElapsedMs(record->start_event, record->end_event);
+    double queue_wait_ms =
+        std::max(0.0,
+                 static_cast<double>(
+                     ElapsedMs(record->enqueue_event, record->start_event)));
+    double bus_bw_gbps = 0.0;
+    if (duration_ms > 0.0) {
+      double alg_bw_gbps =
+          static_cast<double>(record->size_bytes) / (duration_ms * 1e6);
+      bus_bw_gbps =
+          alg_bw_gbps * BusBandwidthFactor(record->comm_type, record->nranks);
+    }
+
+    std::string key = std::to_string(record->gid) + "/" + record->comm_key +
+                      "/" +
+                      phi::distributed::CommTypeToString(record->comm_type);
+    CommStats& stats = stats_[key];
+    ++stats.count;
+    stats.total_bytes += record->size_bytes;
+    stats.total_duration_ms += duration_ms;
+    stats.total_queue_wait_ms += queue_wait_ms;
+    stats.max_queue_wait_ms = std::max(stats.max_queue_wait_ms, queue_wait_ms);
+    stats.total_bus_bw_gbps += bus_bw_gbps;
+
+    ReleaseEvents(record);
+    iter = pending_.erase(iter);
+  }
+}
+
+std::string NCCLCommProfiler::Summary() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  CollectCompleted();
+  std::ostringstream os;
+  os << "{";
+  bool first = true;
+  for (const auto& item : stats_) {
+    const CommStats& s = item.second;
+    double count = static_cast<double>(s.count);
+    if (!first) {
+      os << ",";
+    }
+    first = false;
+    os << "\"" << item.first << "\":{"
+       << "\"count\":" << s.count << ",\"bytes\":" << s.total_bytes
+       << ",\"avg_duration_ms\":" << s.total_duration_ms / count
+       << ",\"avg_queue_wait_ms\":" << s.total_queue_wait_ms / count
+       << ",\"max_queue_wait_ms\":" << s.max_queue_wait_ms
+       << ",\"avg_bus_bw_gbps\":" << s.total_bus_bw_gbps / count << "}";
+  }
+  os << "}";
+  return os.str();
+}
+
+void NCCLCommProfiler::Reset() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  CollectCompleted();
+  stats_.clear();
+}
+
+}  // namespace distributed
+}  // namespace paddle
@@ -0,0 +1,111 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <string>
+
+#include "paddle/fluid/platform/device/gpu/gpu_types.h"
+#include "paddle/phi/core/distributed/utils.h"
+
+namespace paddle {
+namespace distributed {
+
+// Per-collective profiling for ProcessGroupNCCL, enabled with
+// FLAGS_enable_nccl_comm_profiling. For every collective it records the
+// message size, the GPU-timed duration between events bracketing the
+// NCCL launch on the comm stream, the queue wait (elapsed between an
+// enqueue marker on the calc stream and the collective's start event, so
+// it captures how long the collective sat behind earlier stream work),
+// and the realized bus bandwidth using the nccl-tests factors per
+// collective type. Records are aggregated per communicator
+// (gid + place/peer key + collective type) and exported as JSON through
+// core.nccl_comm_profile_summary(), to be joined with the step trace on
+// the communicator key and sequence number.
+class NCCLCommProfiler {
+ public:
+  // One in-flight collective; finalized lazily once its end event has
+  // completed, so profiling never synchronizes the comm stream.
+  struct PendingRecord {
+    int gid;
+    std::string comm_key;
+    phi::distributed::CommType comm_type;
+    int nranks;
+    int64_t size_bytes;
+    uint64_t seq;
+    gpuEvent_t enqueue_event;  // on the calc stream, at enqueue
+    gpuEvent_t start_event;    // on the comm stream, before the launch
+    gpuEvent_t end_event;      // on the comm stream, after the launch
+  };
+
+  struct CommStats {
+    uint64_t count{0};
+    int64_t total_bytes{0};
+    double total_duration_ms{0.0};
+    double total_queue_wait_ms{0.0};
+    double max_queue_wait_ms{0.0};
+    // Sum of per-collective bus bandwidths, for averaging on export.
+    double total_bus_bw_gbps{0.0};
+  };
+
+  static NCCLCommProfiler& Instance();
+
+  static bool IsEnabled();
+
+  // Records the enqueue marker and start event; call immediately before
+  // launching the collective. The returned record must be passed to
+  // EndCollective right after the launch.
+  std::unique_ptr<PendingRecord> StartCollective(
+      int gid,
+      const std::string& comm_key,
+      phi::distributed::CommType comm_type,
+      int nranks,
+      int64_t size_bytes,
+      uint64_t seq,
+      gpuStream_t calc_stream,
+      gpuStream_t comm_stream);
+
+  void EndCollective(std::unique_ptr<PendingRecord> record,
+                     gpuStream_t comm_stream);
+
+  // Folds all completed pending records into the aggregates and returns
+  // them as JSON keyed by "<gid>/<comm_key>/<comm_type>". Pending
+  // collectives whose end event has not fired yet stay queued.
+  std::string Summary();
+
+  void Reset();
+
+ private:
+  NCCLCommProfiler() = default;
+  ~NCCLCommProfiler();
+  NCCLCommProfiler(const NCCLCommProfiler&) = delete;
+  NCCLCommProfiler& operator=(const NCCLCommProfiler&) = delete;
+
+  // Drains completed records; called under mutex_.
+  void CollectCompleted();
+
+  void ReleaseEvents(PendingRecord* record);
+
+  std::mutex mutex_;
+  std::deque<std::unique_ptr<PendingRecord>> pending_;
+  std::map<std::string, CommStats> stats_;
+};
+
+}  // namespace distributed
+}  // namespace paddle
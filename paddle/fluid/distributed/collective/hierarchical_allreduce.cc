@@ -0,0 +1,160 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/distributed/collective/hierarchical_allreduce.h"
+
+#include "paddle/phi/core/device_context.h"
+#include "paddle/phi/core/enforce.h"
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
+
+namespace paddle {
+namespace distributed {
+
+HierarchicalAllReduce::HierarchicalAllReduce(
+    std::shared_ptr<ProcessGroup> intra_group,
+    std::shared_ptr<ProcessGroup> inter_group,
+    Strategy strategy)
+    : intra_group_(std::move(intra_group)),
+      inter_group_(std::move(inter_group)),
+      strategy_(strategy) {
+  PADDLE_ENFORCE_NOT_NULL(
+      intra_group_,
+      phi::errors::InvalidArgument(
+          "The intra-node group of HierarchicalAllReduce must not be null."));
+  if (strategy_ != Strategy::kLeader) {
+    // With kSharded (and therefore kAuto, which may pick it) every rank
+    // joins an inter-node group; a rank with no inter group would diverge
+    // from its peers and hang the collective.
+    PADDLE_ENFORCE_NOT_NULL(
+        inter_group_,
+        phi::errors::InvalidArgument(
+            "A null inter-node group is only allowed with Strategy::kLeader, "
+            "where non-leader ranks skip the inter-node stage."));
+  }
+}
+
+std::shared_ptr<ProcessGroup::Task> HierarchicalAllReduce::AllReduce(
+    phi::DenseTensor* out_tensor,
+    const phi::DenseTensor& in_tensor,
+    const AllreduceOptions& opts,
+    bool sync_op) {
+  PADDLE_ENFORCE_NE(
+      opts.reduce_op,
+      ReduceOp::AVG,
+      phi::errors::InvalidArgument(
+          "HierarchicalAllReduce does not support ReduceOp::AVG: averaging "
+          "in both stages would divide twice. Use SUM and scale by 1/nranks "
+          "on the caller side."));
+
+  // The strategy choice depends only on the tensor shape and the group
+  // sizes, which are identical on every rank, so all ranks take the same
+  // branch.
+  Strategy strategy = strategy_;
+  if (strategy == Strategy::kAuto) {
+    strategy = (in_tensor.numel() % intra_group_->GetSize() == 0)
+                   ? Strategy::kSharded
+                   : Strategy::kLeader;
+  }
+  if (strategy == Strategy::kSharded) {
+    return ShardedAllReduce(out_tensor, in_tensor, opts, sync_op);
+  }
+  return LeaderAllReduce(out_tensor, in_tensor, opts, sync_op);
+}
+
+std::shared_ptr<ProcessGroup::Task> HierarchicalAllReduce::ShardedAllReduce(
+    phi::DenseTensor* out_tensor,
+    const phi::DenseTensor& in_tensor,
+    const AllreduceOptions& opts,
+    bool sync_op) {
+  int intra_size = intra_group_->GetSize();
+  PADDLE_ENFORCE_EQ(
+      in_tensor.numel() % intra_size,
+      0,
+      phi::errors::InvalidArgument(
+          "The sharded hierarchical allreduce needs the tensor numel (%d) to "
+          "split evenly over the %d intra-node ranks. Pad the tensor or use "
+          "Strategy::kLeader.",
+          in_tensor.numel(),
+          intra_size));
+
+  auto* dev_ctx = intra_group_->GetDeviceContext(in_tensor.place());
+  phi::DenseTensor shard;
+  shard.Resize({in_tensor.numel() / intra_size});
+  dev_ctx->Alloc(&shard, in_tensor.dtype());
+  out_tensor->Resize(in_tensor.dims());
+  dev_ctx->Alloc(out_tensor, in_tensor.dtype());
+
+  // Each stage's Wait() makes the next group's streams wait on the
+  // previous comm event device-side, so nothing blocks the host here.
+  ReduceScatterOptions rs_opts;
+  rs_opts.reduce_op = opts.reduce_op;
+  intra_group_->ReduceScatter(&shard, in_tensor, rs_opts, /*sync_op=*/false)
+      ->Wait();
+
+  // This rank's inter-node group spans its same-local-rank peers, so the
+  // shard it owns after the reduce-scatter is exactly what they reduce.
+  inter_group_->AllReduce(&shard, shard, opts, /*sync_op=*/false)->Wait();
+
+  auto task = intra_group_->AllGather(out_tensor, shard, sync_op);
+  if (sync_op) {
+    task->Wait();
+  }
+  return task;
+}
+
+std::shared_ptr<ProcessGroup::Task> HierarchicalAllReduce::LeaderAllReduce(
+    phi::DenseTensor* out_tensor,
+    const phi::DenseTensor& in_tensor,
+    const AllreduceOptions& opts,
+    bool sync_op) {
+  auto* dev_ctx = intra_group_->GetDeviceContext(in_tensor.place());
+  out_tensor->Resize(in_tensor.dims());
+  dev_ctx->Alloc(out_tensor, in_tensor.dtype());
+
+  // Local rank 0 is the node leader; the reduce lands the node-local sum in
+  // its out_tensor, the broadcast overwrites everyone else's afterwards.
+  ReduceOptions reduce_opts;
+  reduce_opts.reduce_op = opts.reduce_op;
+  reduce_opts.root_rank = 0;
+  intra_group_->Reduce(out_tensor, in_tensor, reduce_opts, /*sync_op=*/false)
+      ->Wait();
+
+  if (inter_group_ != nullptr) {
+    inter_group_->AllReduce(out_tensor, *out_tensor, opts, /*sync_op=*/false)
+        ->Wait();
+  }
+
+  BroadcastOptions bcast_opts;
+  bcast_opts.source_rank = 0;
+  auto task =
+      intra_group_->Broadcast(out_tensor, *out_tensor, bcast_opts, sync_op);
+  if (sync_op) {
+    task->Wait();
+  }
+  return task;
+}
+
+int HierarchicalAllReduce::DeviceCountPerNode() {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  return phi::backends::gpu::GetGPUDeviceCount();
+#else
+  return 0;
+#endif
+}
+
+}  //  namespace distributed
+}  //  namespace paddle
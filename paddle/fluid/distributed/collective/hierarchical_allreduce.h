@@ -0,0 +1,91 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "paddle/fluid/distributed/collective/process_group.h"
+#include "paddle/phi/core/dense_tensor.h"
+
+namespace paddle {
+namespace distributed {
+
+// Composes an allreduce out of an intra-node and an inter-node stage so the
+// fast local links (NVLink) and the slow fabric (IB) each carry only the
+// traffic they are good at, instead of one flat ring over every GPU.
+//
+// Two stage layouts are supported:
+//
+//   kSharded  intra reduce-scatter -> inter allreduce of the local shard ->
+//             intra allgather. Every rank joins an inter-node group with the
+//             same-local-rank peers of the other nodes, so the fabric is
+//             driven by all GPUs at 1/ranks-per-node of the payload each.
+//   kLeader   intra reduce to the local root -> inter allreduce among the
+//             node leaders -> intra broadcast. Ranks without an inter-node
+//             group pass nullptr for it and only take part in the intra
+//             stages.
+//
+// The sub-groups themselves are ordinary process groups created by the
+// caller (the usual new_group splits); this class only sequences them, so it
+// works with any ProcessGroup backend. Only associative reductions compose
+// across the stages; AVG is rejected.
+class HierarchicalAllReduce {
+ public:
+  enum class Strategy {
+    // kSharded when the tensor splits evenly over the node, else kLeader.
+    kAuto,
+    kSharded,
+    kLeader,
+  };
+
+  // inter_group may only be nullptr with Strategy::kLeader, on ranks that
+  // are not node leaders.
+  HierarchicalAllReduce(std::shared_ptr<ProcessGroup> intra_group,
+                        std::shared_ptr<ProcessGroup> inter_group,
+                        Strategy strategy = Strategy::kAuto);
+
+  // in_tensor and out_tensor may alias. Returns the task of the final
+  // stage; the stages chain on device through the groups' comm events, so
+  // waiting on it covers the whole sequence.
+  std::shared_ptr<ProcessGroup::Task> AllReduce(
+      phi::DenseTensor* out_tensor,
+      const phi::DenseTensor& in_tensor,
+      const AllreduceOptions& opts,
+      bool sync_op);
+
+  // Devices visible to this process - the usual ranks-per-node when one
+  // rank drives one device. A convenience for building the sub-groups.
+  static int DeviceCountPerNode();
+
+ private:
+  std::shared_ptr<ProcessGroup::Task> ShardedAllReduce(
+      phi::DenseTensor* out_tensor,
+      const phi::DenseTensor& in_tensor,
+      const AllreduceOptions& opts,
+      bool sync_op);
+
+  std::shared_ptr<ProcessGroup::Task> LeaderAllReduce(
+      phi::DenseTensor* out_tensor,
+      const phi::DenseTensor& in_tensor,
+      const AllreduceOptions& opts,
+      bool sync_op);
+
+  std::shared_ptr<ProcessGroup> intra_group_;
+  std::shared_ptr<ProcessGroup> inter_group_;
+  Strategy strategy_;
+};
+
+}  //  namespace distributed
+}  //  namespace paddle
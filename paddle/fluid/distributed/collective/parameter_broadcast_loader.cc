@@ -0,0 +1,250 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/distributed/collective/parameter_broadcast_loader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "paddle/fluid/framework/io/flat_tensor_container.h"
+#include "paddle/phi/backends/context_pool.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/core/enforce.h"
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#endif
+
+namespace paddle {
+namespace distributed {
+
+namespace {
+
+void* CopyStreamOf(phi::DeviceContext* dev_ctx) {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (phi::is_gpu_place(dev_ctx->GetPlace())) {
+    return static_cast<phi::GPUContext*>(dev_ctx)->stream();
+  }
+#endif
+  return nullptr;
+}
+
+template <typename T>
+void AppendPod(std::string* blob, T value) {
+  blob->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ConsumePod(const char** cursor) {
+  T value;
+  std::memcpy(&value, *cursor, sizeof(T));
+  *cursor += sizeof(T);
+  return value;
+}
+
+// Broadcasts a host byte string from src through the group. The bytes
+// travel as device tensors since the comm backends operate on those; two
+// rounds are needed because only the source knows the length.
+std::string BroadcastBlob(ProcessGroup* group,
+                          int src,
+                          const std::string& in,
+                          const phi::Place& place,
+                          phi::DeviceContext* dev_ctx) {
+  void* stream = CopyStreamOf(dev_ctx);
+  BroadcastOptions opts;
+  opts.source_rank = src;
+
+  phi::DenseTensor len_tensor;
+  len_tensor.Resize({1});
+  dev_ctx->Alloc(&len_tensor, phi::DataType::INT64);
+  if (group->GetRank() == src) {
+    int64_t len = static_cast<int64_t>(in.size());
+    phi::memory_utils::Copy(place,
+                            len_tensor.data(),
+                            phi::CPUPlace(),
+                            &len,
+                            sizeof(int64_t),
+                            stream);
+  }
+  group->Broadcast(&len_tensor, len_tensor, opts, /*sync_op=*/false)->Wait();
+  int64_t len = 0;
+  phi::memory_utils::Copy(
+      phi::CPUPlace(), &len, place, len_tensor.data(), sizeof(int64_t), stream);
+  dev_ctx->Wait();
+
+  phi::DenseTensor blob_tensor;
+  blob_tensor.Resize({len});
+  dev_ctx->Alloc(&blob_tensor, phi::DataType::UINT8);
+  if (group->GetRank() == src) {
+    phi::memory_utils::Copy(place,
+                            blob_tensor.data(),
+                            phi::CPUPlace(),
+                            in.data(),
+                            static_cast<size_t>(len),
+                            stream);
+  }
+  group->Broadcast(&blob_tensor, blob_tensor, opts, /*sync_op=*/false)->Wait();
+  std::string out(static_cast<size_t>(len), '\0');
+  phi::memory_utils::Copy(phi::CPUPlace(),
+                          &out[0],
+                          place,
+                          blob_tensor.data(),
+                          static_cast<size_t>(len),
+                          stream);
+  dev_ctx->Wait();
+  return out;
+}
+
+}  // namespace
+
+ParameterBroadcastLoader::ParameterBroadcastLoader(
+    std::shared_ptr<ProcessGroup> group, int src_rank, size_t chunk_bytes)
+    : group_(std::move(group)), src_rank_(src_rank), chunk_bytes_(chunk_bytes) {
+  PADDLE_ENFORCE_NOT_NULL(
+      group_,
+      phi::errors::InvalidArgument(
+          "The process group of ParameterBroadcastLoader must not be null."));
+  PADDLE_ENFORCE_GT(chunk_bytes_,
+                    static_cast<size_t>(0),
+                    phi::errors::InvalidArgument(
+                        "The broadcast chunk size must be positive."));
+}
+
+void ParameterBroadcastLoader::Load(const std::string& file_path,
+                                    const std::vector<std::string>& names,
+                                    const std::vector<phi::DenseTensor*>& outs,
+                                    const phi::Place& place) {
+  PADDLE_ENFORCE_EQ(names.size(),
+                    outs.size(),
+                    phi::errors::InvalidArgument(
+                        "The number of names (%d) does not match the number "
+                        "of output tensors (%d).",
+                        names.size(),
+                        outs.size()));
+  if (names.empty()) {
+    return;
+  }
+  const bool is_src = group_->GetRank() == src_rank_;
+  auto* dev_ctx = phi::DeviceContextPool::Instance().Get(place);
+  void* stream = CopyStreamOf(dev_ctx);
+
+  // Metadata stage: the source reads the container header and broadcasts
+  // name/dtype/shape per tensor so every rank can allocate. The names go
+  // along only to catch groups whose ranks disagree on the list.
+  std::unique_ptr<framework::FlatTensorContainerReader> reader;
+  std::vector<phi::DenseTensor> src_views;  // alias the mapped checkpoint
+  std::string meta;
+  if (is_src) {
+    reader = std::make_unique<framework::FlatTensorContainerReader>(file_path);
+    AppendPod<uint64_t>(&meta, names.size());
+    for (const auto& name : names) {
+      PADDLE_ENFORCE_EQ(reader->HasTensor(name),
+                        true,
+                        phi::errors::NotFound(
+                            "Tensor %s is not found in the checkpoint %s.",
+                            name,
+                            file_path));
+      src_views.push_back(reader->GetTensor(name));
+      const auto& tensor = src_views.back();
+      AppendPod<uint64_t>(&meta, name.size());
+      meta.append(name);
+      AppendPod<int32_t>(&meta, static_cast<int32_t>(tensor.dtype()));
+      auto dims = common::vectorize(tensor.dims());
+      AppendPod<uint64_t>(&meta, dims.size());
+      for (int64_t d : dims) {
+        AppendPod<int64_t>(&meta, d);
+      }
+    }
+  }
+  if (group_->GetSize() > 1) {
+    meta = BroadcastBlob(group_.get(), src_rank_, meta, place, dev_ctx);
+  }
+
+  const char* cursor = meta.data();
+  uint64_t count = ConsumePod<uint64_t>(&cursor);
+  PADDLE_ENFORCE_EQ(count,
+                    names.size(),
+                    phi::errors::PreconditionNotMet(
+                        "The source rank broadcast %d tensors but this rank "
+                        "asked for %d; the ranks of one group must pass the "
+                        "same name list.",
+                        count,
+                        names.size()));
+  for (size_t i = 0; i < names.size(); ++i) {
+    uint64_t name_len = ConsumePod<uint64_t>(&cursor);
+    std::string name(cursor, name_len);
+    cursor += name_len;
+    PADDLE_ENFORCE_EQ(name,
+                      names[i],
+                      phi::errors::PreconditionNotMet(
+                          "The source rank broadcast tensor %s at position %d "
+                          "but this rank asked for %s; the ranks of one group "
+                          "must pass the same name list in the same order.",
+                          name,
+                          i,
+                          names[i]));
+    auto dtype = static_cast<phi::DataType>(ConsumePod<int32_t>(&cursor));
+    uint64_t ndim = ConsumePod<uint64_t>(&cursor);
+    std::vector<int64_t> dims(ndim);
+    for (uint64_t d = 0; d < ndim; ++d) {
+      dims[d] = ConsumePod<int64_t>(&cursor);
+    }
+    outs[i]->Resize(common::make_ddim(dims));
+    dev_ctx->Alloc(outs[i], dtype);
+  }
+
+  // Payload stage: every chunk is broadcast in place on a view of the
+  // destination tensor, so no rank pays an extra device-side copy. The
+  // source's host-to-device copies never wait on the comm stream (each
+  // chunk targets fresh memory), so the page-ins from the mapped file for
+  // chunk k+1 proceed while chunk k is still on the wire.
+  BroadcastOptions opts;
+  opts.source_rank = src_rank_;
+  std::vector<std::shared_ptr<ProcessGroup::Task>> tasks;
+  for (size_t i = 0; i < names.size(); ++i) {
+    phi::DenseTensor* out = outs[i];
+    if (out->numel() == 0) {
+      continue;
+    }
+    size_t elem_bytes = phi::SizeOf(out->dtype());
+    int64_t chunk_numel = static_cast<int64_t>(
+        std::max<size_t>(1, chunk_bytes_ / elem_bytes));
+    auto* dst_bytes = static_cast<char*>(out->data());
+    const char* src_bytes =
+        is_src ? static_cast<const char*>(src_views[i].data()) : nullptr;
+    for (int64_t begin = 0; begin < out->numel(); begin += chunk_numel) {
+      int64_t numel = std::min(chunk_numel, out->numel() - begin);
+      if (is_src) {
+        phi::memory_utils::Copy(place,
+                                dst_bytes + begin * elem_bytes,
+                                phi::CPUPlace(),
+                                src_bytes + begin * elem_bytes,
+                                static_cast<size_t>(numel) * elem_bytes,
+                                stream);
+      }
+      if (group_->GetSize() > 1) {
+        auto part = GetPartialTensor(*out, begin, numel);
+        tasks.push_back(
+            group_->Broadcast(&part, part, opts, /*sync_op=*/false));
+      }
+    }
+  }
+  for (auto& task : tasks) {
+    task->Wait();
+  }
+  dev_ctx->Wait();
+}
+
+}  //  namespace distributed
+}  //  namespace paddle
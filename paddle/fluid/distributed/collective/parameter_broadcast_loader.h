@@ -0,0 +1,67 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paddle/fluid/distributed/collective/process_group.h"
+#include "paddle/phi/core/dense_tensor.h"
+
+namespace paddle {
+namespace distributed {
+
+// Parameter initialization path for large jobs where every rank loading
+// the checkpoint from shared storage turns startup into a thundering
+// herd against the filestore. Instead, one source rank reads the
+// checkpoint once and streams it to the group over the interconnect:
+// tensor metadata is broadcast first so the other ranks can allocate,
+// then payloads are broadcast in fixed-size chunks written straight into
+// the destination tensors. On the source rank the host-side disk reads
+// (page-ins of the mapped checkpoint) feed the copy of chunk k+1 while
+// the broadcast of chunk k is still in flight on the comm stream, so
+// startup is bounded by the slower of disk and interconnect rather than
+// by nranks concurrent readers.
+//
+// The checkpoint is a flat tensor container (framework/io). With sharded
+// setups the fleet layer passes each shard group its own name list and
+// source rank; the ranks of one group must call Load with the same names
+// in the same order.
+class ParameterBroadcastLoader {
+ public:
+  static constexpr size_t kDefaultChunkBytes = 64 << 20;
+
+  explicit ParameterBroadcastLoader(std::shared_ptr<ProcessGroup> group,
+                                    int src_rank = 0,
+                                    size_t chunk_bytes = kDefaultChunkBytes);
+
+  // Loads the container at `file_path` into `outs`, which are resized and
+  // allocated on `place` on every rank. Only the source rank touches the
+  // file; shapes and dtypes come from its header. Blocks until the
+  // destination tensors are ready to use.
+  void Load(const std::string& file_path,
+            const std::vector<std::string>& names,
+            const std::vector<phi::DenseTensor*>& outs,
+            const phi::Place& place);
+
+ private:
+  std::shared_ptr<ProcessGroup> group_;
+  int src_rank_;
+  size_t chunk_bytes_;
+};
+
+}  //  namespace distributed
+}  //  namespace paddle
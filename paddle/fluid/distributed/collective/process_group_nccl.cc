@@ -14,6 +14,7 @@
 
 #include "paddle/fluid/distributed/collective/process_group_nccl.h"
 #include "paddle/common/flags.h"
+#include "paddle/fluid/distributed/collective/comm_profiler.h"
 #include "paddle/fluid/distributed/collective/common.h"
 #include "paddle/fluid/platform/cuda_device_guard.h"
 #include "paddle/fluid/platform/device/gpu/nccl_helper.h"
@@ -65,13 +66,27 @@ ProcessGroupNCCL::NCCLTask::NCCLTask(const Place& place,
 
 ProcessGroupNCCL::NCCLTask::~NCCLTask() = default;
 
-bool ProcessGroupNCCL::NCCLTask::IsCompleted() { return comm_event_.Query(); }
+bool ProcessGroupNCCL::NCCLTask::IsCompleted() {
+  if (IsDeferred()) {
+    FlushCoalescedInGroup();
+  }
+  return comm_event_.Query();
+}
 
 void ProcessGroupNCCL::NCCLTask::UpdateWaitChain(
     const phi::DeviceContext& ctx) {
   comm_event_.Record(&ctx);
 }
 
+void ProcessGroupNCCL::NCCLTask::FlushCoalescedInGroup() {
+  auto map = distributed::ProcessGroupMapFromGid::getInstance();
+  distributed::ProcessGroup* pg = map->get(gid_);
+  if (!pg) return;
+  auto* pg_nccl = dynamic_cast<ProcessGroupNCCL*>(pg);
+  if (!pg_nccl) return;
+  pg_nccl->FlushCoalesced();
+}
+
 void ProcessGroupNCCL::NCCLTask::RemoveHolderStreamInGroup() {
   auto map = distributed::ProcessGroupMapFromGid::getInstance();
   distributed::ProcessGroup* pg = map->get(gid_);
@@ -90,6 +105,12 @@ bool ProcessGroupNCCL::NCCLTask::Wait(std::chrono::milliseconds timeout) {
     return true;
   }
 
+  if (IsDeferred()) {
+    // Still parked in a coalescing batch; the comm event is only recorded
+    // once the fused launch goes out, so flush before waiting on it.
+    FlushCoalescedInGroup();
+  }
+
   const auto* calc_ctx = phi::DeviceContextPool::Instance().Get(task_place_);
   comm_event_.Wait(platform::Place2DeviceType(task_place_), calc_ctx);
 
@@ -138,6 +159,12 @@ ProcessGroupNCCL::ProcessGroupNCCL(
 }
 ProcessGroupNCCL::~ProcessGroupNCCL() {
   LOG(INFO) << "ProcessGroupNCCL destruct ";
+  {
+    // Whatever is still parked in the coalescing batch must go out before
+    // the communicators are torn down.
+    std::lock_guard<std::mutex> lock(coalescing_mutex_);
+    FlushCoalescedLocked();
+  }
   if (FLAGS_enable_async_trace) {
     auto& comm_task_manager = phi::distributed::CommTaskManager::GetInstance();
     comm_task_manager.Stop();
@@ -243,6 +270,11 @@ std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::AllReduce(
   CheckTensorContiguous(in_tensor);
   CheckTensorContiguous(*out_tensor);
 
+  if (auto_coalescing_enabled_.load(std::memory_order_acquire) && !sync_op &&
+      !use_calc_stream && !is_coalescing_) {
+    return EnqueueCoalescedAllReduce(out_tensor, in_tensor, opts);
+  }
+
   return Collective(
       [&](phi::distributed::NCCLCommContext* comm_context, gpuStream_t stream) {
         VLOG(3) << "[ncclAllReduce] "
@@ -851,6 +883,19 @@ std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::Collective(
 
   auto nccl_comm_ctx = this->GetCommContext(&store_key);
 
+  std::unique_ptr<NCCLCommProfiler::PendingRecord> profile_record;
+  if (NCCLCommProfiler::IsEnabled()) {
+    profile_record = NCCLCommProfiler::Instance().StartCollective(
+        gid_,
+        key,
+        comm_type,
+        size_,
+        tensor.numel() * phi::SizeOf(tensor.dtype()),
+        comm_seq_,
+        calc_ctx->stream(),
+        nccl_stream);
+  }
+
   if (!FLAGS_enable_async_trace) {
     fn(nccl_comm_ctx, nccl_stream);
   } else {
@@ -878,6 +923,11 @@ std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::Collective(
     comm_task_manager.CommTaskEnqueue(std::move(comm_task));
   }
 
+  if (profile_record) {
+    NCCLCommProfiler::Instance().EndCollective(std::move(profile_record),
+                                               nccl_stream);
+  }
+
   if (!use_calc_stream) {
     if (!is_coalescing_) {
       if (FLAGS_use_stream_safe_cuda_allocator ||
@@ -988,6 +1038,19 @@ std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::Point2Point(
 
   auto nccl_comm_ctx = this->GetCommContext(&store_key);
 
+  std::unique_ptr<NCCLCommProfiler::PendingRecord> profile_record;
+  if (NCCLCommProfiler::IsEnabled()) {
+    profile_record = NCCLCommProfiler::Instance().StartCollective(
+        gid_,
+        key,
+        comm_type,
+        p2p_nrank,
+        tensor.numel() * phi::SizeOf(tensor.dtype()),
+        p2p_comm_seq_[key],
+        calc_ctx->stream(),
+        nccl_stream);
+  }
+
   if (!FLAGS_enable_async_trace) {
     fn(nccl_comm_ctx, nccl_stream, p2p_target_rank);
   } else {
@@ -1000,6 +1063,11 @@ std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::Point2Point(
     comm_task_manager.CommTaskEnqueue(std::move(comm_task));
   }
 
+  if (profile_record) {
+    NCCLCommProfiler::Instance().EndCollective(std::move(profile_record),
+                                               nccl_stream);
+  }
+
   if (!use_calc_stream) {
     if (!is_coalescing_) {
       if (FLAGS_use_stream_safe_cuda_allocator ||
@@ -1115,4 +1183,165 @@ void ProcessGroupNCCL::EndCoalescing(
   colaescing_place_keys_.clear();
 }
 
+void ProcessGroupNCCL::EnableAutoCoalescing(size_t bytes_threshold) {
+  std::lock_guard<std::mutex> lock(coalescing_mutex_);
+  coalescing_bytes_threshold_ = bytes_threshold == 0 ? 1 : bytes_threshold;
+  auto_coalescing_enabled_.store(true, std::memory_order_release);
+}
+
+void ProcessGroupNCCL::DisableAutoCoalescing() {
+  std::lock_guard<std::mutex> lock(coalescing_mutex_);
+  auto_coalescing_enabled_.store(false, std::memory_order_release);
+  FlushCoalescedLocked();
+}
+
+void ProcessGroupNCCL::FlushCoalesced() {
+  std::lock_guard<std::mutex> lock(coalescing_mutex_);
+  FlushCoalescedLocked();
+}
+
+std::shared_ptr<ProcessGroup::Task> ProcessGroupNCCL::EnqueueCoalescedAllReduce(
+    phi::DenseTensor* out_tensor,
+    const phi::DenseTensor& in_tensor,
+    const AllreduceOptions& opts) {
+  const auto& place = in_tensor.place();
+  const auto& key = GetKeyFromPlace(place);
+
+  platform::CUDADeviceGuard cuda_guard(place);
+
+  std::string store_key;
+  GetStoreKey(key, CommType::ALLREDUCE, &store_key);
+
+  if (place_to_comm_ctx_.find(key) == place_to_comm_ctx_.end()) {
+    CreateNCCLEnvCache(place, key, store_key, CommType::ALLREDUCE);
+  }
+
+  // The comm stream has to observe the producers of in_tensor exactly as an
+  // immediate launch would, so the calc-stream sync happens at enqueue time.
+  SyncCalcStream(place, key);
+
+  auto task = CreateTask(place,
+                         rank_,
+                         CommType::ALLREDUCE,
+                         /*sync_op*/ false,
+                         /*use_calc_stream*/ false,
+                         gid_);
+  task->MarkDeferred();
+
+  size_t bytes = in_tensor.numel() * phi::SizeOf(in_tensor.dtype());
+
+  std::lock_guard<std::mutex> lock(coalescing_mutex_);
+  pending_allreduces_.push_back({std::make_shared<phi::DenseTensor>(in_tensor),
+                                 std::make_shared<phi::DenseTensor>(*out_tensor),
+                                 opts.reduce_op,
+                                 key,
+                                 store_key,
+                                 task});
+  pending_bytes_ += bytes;
+  if (pending_bytes_ >= coalescing_bytes_threshold_) {
+    FlushCoalescedLocked();
+  }
+  return task;
+}
+
+void ProcessGroupNCCL::FlushCoalescedLocked() {
+  if (pending_allreduces_.empty()) {
+    return;
+  }
+  std::vector<PendingAllReduce> batch;
+  batch.swap(pending_allreduces_);
+  pending_bytes_ = 0;
+
+  // Bucket by communicator, dtype and reduction, preserving enqueue order.
+  // Every rank enqueues the same collective sequence and all flush triggers
+  // (byte threshold, task wait, explicit flush) are deterministic across
+  // ranks, so the buckets - and thus the fused NCCL calls - match up.
+  std::vector<std::vector<size_t>> buckets;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    bool placed = false;
+    for (auto& bucket : buckets) {
+      const auto& head = batch[bucket.front()];
+      if (head.place_key == batch[i].place_key &&
+          head.in->dtype() == batch[i].in->dtype() &&
+          head.reduce_op == batch[i].reduce_op) {
+        bucket.push_back(i);
+        placed = true;
+        break;
+      }
+    }
+    if (!placed) {
+      buckets.push_back({i});
+    }
+  }
+  VLOG(3) << "Flushing " << batch.size() << " coalesced allreduce(s) in "
+          << buckets.size() << " fused call(s)";
+
+  for (auto& bucket : buckets) {
+    auto& head = batch[bucket.front()];
+    const auto& place = head.in->place();
+    platform::CUDADeviceGuard cuda_guard(place);
+    const auto& comm_ctx = place_to_comm_ctx_.at(head.place_key);
+    auto nccl_stream = comm_ctx->stream();
+    auto nccl_comm_ctx = GetCommContext(&head.store_key);
+    auto red_type = ToNCCLRedType(head.reduce_op);
+
+    if (bucket.size() == 1) {
+      nccl_comm_ctx->AllReduce(
+          head.out.get(), *head.in, red_type, nccl_stream);
+    } else {
+      int64_t total_numel = 0;
+      for (size_t i : bucket) {
+        total_numel += batch[i].in->numel();
+      }
+      auto dtype = head.in->dtype();
+      size_t elem_bytes = phi::SizeOf(dtype);
+      phi::DenseTensor fused;
+      fused.Resize({total_numel});
+      comm_ctx->Alloc(&fused, dtype);
+      auto* fused_data = static_cast<char*>(fused.data());
+
+      size_t offset = 0;
+      for (size_t i : bucket) {
+        size_t piece = batch[i].in->numel() * elem_bytes;
+        phi::memory_utils::Copy(place,
+                                fused_data + offset,
+                                place,
+                                batch[i].in->data(),
+                                piece,
+                                nccl_stream);
+        offset += piece;
+      }
+      nccl_comm_ctx->AllReduce(&fused, fused, red_type, nccl_stream);
+      offset = 0;
+      for (size_t i : bucket) {
+        size_t piece = batch[i].in->numel() * elem_bytes;
+        phi::memory_utils::Copy(place,
+                                batch[i].out->data(),
+                                place,
+                                fused_data + offset,
+                                piece,
+                                nccl_stream);
+        offset += piece;
+      }
+      if (FLAGS_use_stream_safe_cuda_allocator ||
+          FLAGS_use_cuda_malloc_async_allocator) {
+        memory::RecordStream(fused.Holder(), nccl_stream);
+      }
+    }
+
+    for (size_t i : bucket) {
+      auto& pending = batch[i];
+      if (FLAGS_use_stream_safe_cuda_allocator ||
+          FLAGS_use_cuda_malloc_async_allocator) {
+        memory::RecordStream(pending.in->Holder(), nccl_stream);
+        memory::RecordStream(pending.out->Holder(), nccl_stream);
+      }
+      pending.task->UpdateWaitChain(*comm_ctx);
+      allocation_stream_pairs_.emplace_back(pending.in->Holder(), nccl_stream);
+      allocation_stream_pairs_.emplace_back(pending.out->Holder(), nccl_stream);
+      pending.task->MarkFlushed();
+    }
+  }
+}
+
 }  // namespace paddle::distributed
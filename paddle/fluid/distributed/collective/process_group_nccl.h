@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -55,6 +57,15 @@ class ProcessGroupNCCL final : public ProcessGroupWithStream {
     bool IsBlockCPUInWait() const { return block_cpu_in_wait_; }
     void SetBlockCPUInWait() { block_cpu_in_wait_ = true; }
 
+    // A deferred task belongs to a pending coalescing batch: its comm event
+    // has not been recorded yet, so Wait/IsCompleted first flush the batch.
+    void MarkDeferred() { deferred_.store(true, std::memory_order_release); }
+    void MarkFlushed() { deferred_.store(false, std::memory_order_release); }
+    bool IsDeferred() const {
+      return deferred_.load(std::memory_order_acquire);
+    }
+    void FlushCoalescedInGroup();
+
     // TODO(sunyilun): methods below will be removed later
     NCCLTask(const std::vector<Place>& places,
              int rank,
@@ -65,6 +76,7 @@ class ProcessGroupNCCL final : public ProcessGroupWithStream {
 
    private:
     bool block_cpu_in_wait_{false};
+    std::atomic<bool> deferred_{false};
     platform::DeviceEvent comm_event_;  // event on comm stream
     Place task_place_;
     int gid_;
@@ -177,6 +189,22 @@ class ProcessGroupNCCL final : public ProcessGroupWithStream {
 
   static void GroupEnd();
 
+  // Coalesce small async allreduces transparently: once enabled, every
+  // async (non-sync-op, comm-stream) AllReduce is held back and packed with
+  // its neighbors of the same communicator/dtype/reduction into one fused
+  // buffer and a single ncclAllReduce, then unpacked. The returned task
+  // handles behave as usual: Wait/IsCompleted on any of them flushes the
+  // batch first. Flushes happen when pending payload reaches bytes_threshold,
+  // when a task is waited on, or on an explicit FlushCoalesced() call; all
+  // three are deterministic across ranks, which grouped NCCL calls require.
+  void EnableAutoCoalescing(size_t bytes_threshold = 4 * 1024 * 1024);
+
+  // Flush anything pending and stop coalescing new allreduces.
+  void DisableAutoCoalescing();
+
+  // Launch all pending coalesced allreduces now.
+  void FlushCoalesced();
+
   ncclComm_t NCCLComm(const Place& place) const;
 
   const bool GetNCCLCommInitOption() { return nccl_comm_init_option_; }
@@ -239,6 +267,14 @@ class ProcessGroupNCCL final : public ProcessGroupWithStream {
       std::optional<std::vector<std::shared_ptr<ProcessGroup::Task>>>
           tasks_opt = std::nullopt);
 
+  std::shared_ptr<ProcessGroup::Task> EnqueueCoalescedAllReduce(
+      phi::DenseTensor* out_tensor,
+      const phi::DenseTensor& in_tensor,
+      const AllreduceOptions& opts);
+
+  // Caller holds coalescing_mutex_.
+  void FlushCoalescedLocked();
+
  private:
   std::shared_ptr<phi::distributed::Store> store_;
 
@@ -267,6 +303,22 @@ class ProcessGroupNCCL final : public ProcessGroupWithStream {
   bool is_coalescing_{false};
   std::vector<std::shared_ptr<phi::DenseTensor>> colaescing_tensors_;
   std::vector<std::string> colaescing_place_keys_;
+
+  // For transparent allreduce coalescing (EnableAutoCoalescing). The shared
+  // tensor copies keep the callers' allocations alive until the fused launch.
+  struct PendingAllReduce {
+    std::shared_ptr<phi::DenseTensor> in;
+    std::shared_ptr<phi::DenseTensor> out;
+    ReduceOp reduce_op;
+    std::string place_key;
+    std::string store_key;
+    std::shared_ptr<NCCLTask> task;
+  };
+  std::atomic<bool> auto_coalescing_enabled_{false};
+  size_t coalescing_bytes_threshold_{4 * 1024 * 1024};
+  std::mutex coalescing_mutex_;
+  std::vector<PendingAllReduce> pending_allreduces_;
+  size_t pending_bytes_{0};
 };
 
 }  //  namespace distributed
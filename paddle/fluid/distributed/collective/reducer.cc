@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include "paddle/fluid/distributed/collective/reducer.h"
+
+#include <chrono>
+#include <numeric>
+
 #include "paddle/common/flags.h"
 #include "paddle/phi/api/lib/data_transform.h"
 #include "paddle/phi/backends/device_guard.h"
@@ -687,11 +691,71 @@ void EagerReducer::TraverseBackwardGraph(const std::vector<Tensor> &outputs) {
   }
 }
 
+void EagerReducer::EnableAutoTune(size_t warmup_steps) {
+  auto_tune_enabled_ = true;
+  auto_tune_done_ = false;
+  auto_tune_warmup_steps_ = warmup_steps == 0 ? 1 : warmup_steps;
+  auto_tune_steps_seen_ = 0;
+  arrival_position_sum_.assign(tensors_.size(), 0.0);
+  lat_samples_ = 0;
+  lat_sum_bytes_ = 0;
+  lat_sum_secs_ = 0;
+  lat_sum_bytes_sq_ = 0;
+  lat_sum_bytes_secs_ = 0;
+}
+
+void EagerReducer::SetCompressionHook(
+    std::shared_ptr<GradCompressionHook> hook) {
+  compression_hook_ = std::move(hook);
+}
+
+void EagerReducer::EnableFP16Compression() {
+  SetCompressionHook(std::make_shared<FP16CompressionHook>());
+}
+
+void EagerReducer::SetBucketCompletionCallback(
+    BucketCompletionCallback callback) {
+  bucket_completion_callback_ = std::move(callback);
+}
+
+void EagerReducer::EnableShardedGrads() { sharded_grads_enabled_ = true; }
+
+Tensor FP16CompressionHook::Encode(size_t group_index, const Tensor &bucket) {
+  if (bucket.dtype() != phi::DataType::FLOAT32) {
+    return bucket;
+  }
+  if (residuals_.size() <= group_index) {
+    residuals_.resize(group_index + 1);
+  }
+  auto &residual = residuals_[group_index];
+  Tensor input = residual.initialized()
+                     ? paddle::experimental::add(bucket, residual)
+                     : bucket;
+  Tensor compressed =
+      paddle::experimental::cast(input, phi::DataType::FLOAT16);
+  // carry what the cast dropped into the next step, so repeated rounding
+  // does not bias the update
+  residual = paddle::experimental::subtract(
+      input, paddle::experimental::cast(compressed, phi::DataType::FLOAT32));
+  return compressed;
+}
+
+Tensor FP16CompressionHook::Decode(size_t group_index UNUSED,
+                                   const Tensor &compressed) {
+  if (compressed.dtype() != phi::DataType::FLOAT16) {
+    return compressed;
+  }
+  return paddle::experimental::cast(compressed, phi::DataType::FLOAT32);
+}
+
 void EagerReducer::PrepareForBackward(const std::vector<Tensor> &outputs) {
   VLOG(3) << "after forward, then reset count for backward.";
   grad_need_hooks_ = true;
 
   next_group_ = 0;
+  arrival_seq_ = 0;
+  group_launch_time_.assign(groups_.size(), 0.0);
+  compressed_contents_.assign(groups_.size(), Tensor());
   std::for_each(groups_.begin(), groups_.end(), [](EagerGroup &group) {
     group.pending_ = group.tensor_indices_.size();
     group.sparse_contents_ = Tensor();
@@ -794,6 +858,11 @@ void EagerReducer::MarkVarReady(const size_t var_index,
                                 const bool is_used_var) {
   VLOG(3) << "Tensor[" << var_index << "][" << tensors_[var_index].name()
           << "] is marked ready.";
+  if (auto_tune_enabled_ && !auto_tune_done_) {
+    // Accumulate each gradient's position in the backward arrival sequence;
+    // the warm-up average decides the tuned bucket order.
+    arrival_position_sum_[var_index] += static_cast<double>(arrival_seq_++);
+  }
   // error happened, if the var is ready before.
   if (vars_marked_ready_[var_index]) {
     auto error_info = string::Sprintf(
@@ -1061,14 +1130,51 @@ void EagerReducer::ProcessUnusedDenseVars() {
 void EagerReducer::FinalizeBackward() {
   groups_need_finalize_ = false;
   grad_need_hooks_ = false;
-  for (auto &group : groups_) {
+  for (size_t group_index = 0; group_index < groups_.size(); ++group_index) {
+    auto &group = groups_[group_index];
     if (!group.is_sparse_) {
       group.task->Synchronize();
-      if (!IsStreamSafeAllocator()) {
+      if (auto_tune_enabled_ && !auto_tune_done_ &&
+          group_launch_time_[group_index] > 0.0) {
+        // Host-visible allreduce latency for this bucket. Waiting behind an
+        // earlier bucket inflates the sample, but that only biases the fit
+        // toward slightly larger buckets, which is the safe direction.
+        double now = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+        double secs = now - group_launch_time_[group_index];
+        double bytes = static_cast<double>(group.all_length_) *
+                       static_cast<double>(phi::SizeOf(group.dtype_));
+        lat_samples_ += 1.0;
+        lat_sum_bytes_ += bytes;
+        lat_sum_secs_ += secs;
+        lat_sum_bytes_sq_ += bytes * bytes;
+        lat_sum_bytes_secs_ += bytes * secs;
+      }
+      if (compression_hook_ != nullptr &&
+          group_index < compressed_contents_.size() &&
+          compressed_contents_[group_index].initialized()) {
+        group.dense_contents_ = compression_hook_->Decode(
+            group_index, compressed_contents_[group_index]);
+        compressed_contents_[group_index] = Tensor();
+        auto *default_ctx =
+            phi::DeviceContextPool::Instance().Get(inner_place_);
+        group.SplitTensors(*default_ctx);
+      } else if (!group.is_scattered_ && !IsStreamSafeAllocator()) {
         auto *default_ctx =
             phi::DeviceContextPool::Instance().Get(inner_place_);
         group.SplitTensors(*default_ctx);
       }
+      if (bucket_completion_callback_) {
+        // Fired before later buckets are waited on, so shard updates and
+        // prioritized allgathers overlap the remaining communication.
+        bucket_completion_callback_(
+            group_index,
+            group.tensor_indices_,
+            group.is_scattered_ ? group.shard_contents_
+                                : group.dense_contents_,
+            group.is_scattered_ ? group.shard_offset_ : 0);
+      }
     }
   }
 
@@ -1079,9 +1185,132 @@ void EagerReducer::FinalizeBackward() {
     VLOG(3) << "ProcessUnusedDenseVars is finished.";
   }
 
+  // Rebuild last: the unused-vars pass above still reads this step's
+  // locators and groups.
+  if (auto_tune_enabled_ && !auto_tune_done_ &&
+      ++auto_tune_steps_seen_ >= auto_tune_warmup_steps_) {
+    RebuildGroupsForAutoTune();
+    auto_tune_done_ = true;
+  }
+
   VLOG(3) << "In the batch, Reducer is finished.";
 }
 
+void EagerReducer::RebuildGroupsForAutoTune() {
+  // Every rank must repack identically or the fused allreduces stop
+  // matching up across the group, so pool the measurements first. Summed
+  // arrival positions sort the same as rank-averaged ones, and the latency
+  // fit simply gains nranks times the samples.
+  std::vector<double> stats(arrival_position_sum_);
+  stats.push_back(lat_samples_);
+  stats.push_back(lat_sum_bytes_);
+  stats.push_back(lat_sum_secs_);
+  stats.push_back(lat_sum_bytes_sq_);
+  stats.push_back(lat_sum_bytes_secs_);
+
+  auto stats_tensor = paddle::experimental::empty(
+      IntArray({static_cast<int32_t>(stats.size())}),
+      DataType::FLOAT64,
+      inner_place_);
+  const auto *dev_ctx = phi::DeviceContextPool::Instance().Get(inner_place_);
+  auto *stats_dense =
+      std::dynamic_pointer_cast<phi::DenseTensor>(stats_tensor.impl()).get();
+  framework::TensorFromVector<double>(stats, *dev_ctx, stats_dense);
+
+  distributed::AllreduceOptions opts;
+  opts.reduce_op = ReduceOp::SUM;
+  std::vector<phi::DenseTensor> in_out = {*stats_dense};
+  process_group_->AllReduce(in_out, in_out, opts)->Synchronize();
+
+  framework::TensorToVector<double>(*stats_dense, *dev_ctx, &stats);
+  dev_ctx->Wait();
+
+  std::copy(stats.begin(),
+            stats.begin() + arrival_position_sum_.size(),
+            arrival_position_sum_.begin());
+  size_t tail = arrival_position_sum_.size();
+  lat_samples_ = stats[tail];
+  lat_sum_bytes_ = stats[tail + 1];
+  lat_sum_secs_ = stats[tail + 2];
+  lat_sum_bytes_sq_ = stats[tail + 3];
+  lat_sum_bytes_secs_ = stats[tail + 4];
+
+  // Pick a bucket byte size from the warm-up latency samples. With the
+  // linear model time(b) = overhead + b / bandwidth, a bucket of
+  // 9 * overhead * bandwidth bytes keeps per-call overhead under 10% of its
+  // allreduce time; smaller buckets would pay proportionally more overhead,
+  // larger ones would delay the first launch without saving anything.
+  size_t tuned_limit = group_size_limits_.empty()
+                           ? static_cast<size_t>(25 * 1024 * 1024)
+                           : group_size_limits_.back();
+  double denom = lat_samples_ * lat_sum_bytes_sq_ -
+                 lat_sum_bytes_ * lat_sum_bytes_;
+  if (lat_samples_ >= 2.0 && denom > 0.0) {
+    double secs_per_byte =
+        (lat_samples_ * lat_sum_bytes_secs_ - lat_sum_bytes_ * lat_sum_secs_) /
+        denom;
+    double overhead =
+        (lat_sum_secs_ - secs_per_byte * lat_sum_bytes_) / lat_samples_;
+    if (secs_per_byte > 0.0 && overhead > 0.0) {
+      constexpr double kMinBucketBytes = 4.0 * 1024 * 1024;
+      constexpr double kMaxBucketBytes = 128.0 * 1024 * 1024;
+      double bytes = 9.0 * overhead / secs_per_byte;
+      bytes = (std::max)(kMinBucketBytes, (std::min)(kMaxBucketBytes, bytes));
+      tuned_limit = static_cast<size_t>(bytes);
+    }
+  }
+
+  // Repack exactly the variables the current groups cover, walking them in
+  // mean backward-arrival order so the bucket that fills up first is also
+  // the first one MarkGroupReady is allowed to launch.
+  std::vector<size_t> covered;
+  for (const auto &indices : group_indices_) {
+    covered.insert(covered.end(), indices.begin(), indices.end());
+  }
+  std::sort(covered.begin(),
+            covered.end(),
+            [this](size_t lhs, size_t rhs) {
+              if (arrival_position_sum_[lhs] != arrival_position_sum_[rhs]) {
+                return arrival_position_sum_[lhs] < arrival_position_sum_[rhs];
+              }
+              return lhs < rhs;
+            });
+
+  std::vector<std::vector<size_t>> new_indices;
+  std::map<phi::DataType, std::pair<std::vector<size_t>, size_t>> open_groups;
+  for (const auto var_index : covered) {
+    if (is_sparse_gradient_[var_index]) {
+      // sparse vars keep their one-var groups, slotted at arrival position
+      new_indices.push_back({var_index});
+      continue;
+    }
+    const auto &var = tensors_[var_index];
+    const auto var_dtype = var.dtype();
+    auto &group_info = open_groups[var_dtype];
+    group_info.first.push_back(var_index);
+    group_info.second +=
+        phi::SizeOf(var_dtype) *
+        std::dynamic_pointer_cast<phi::DenseTensor>(var.impl())->numel();
+    if (group_info.second >= tuned_limit) {
+      new_indices.emplace_back(std::move(group_info.first));
+      group_info = std::pair<std::vector<size_t>, size_t>();
+    }
+  }
+  for (auto &open_group : open_groups) {
+    if (!open_group.second.first.empty()) {
+      new_indices.emplace_back(std::move(open_group.second.first));
+    }
+  }
+
+  VLOG(3) << "Auto-tune repacked " << group_indices_.size()
+          << " bucket(s) into " << new_indices.size()
+          << " with byte limit " << tuned_limit;
+
+  group_indices_ = new_indices;
+  group_size_limits_.assign(1, tuned_limit);
+  InitializeGroups(group_indices_);
+}
+
 void EagerReducer::FusedAllReduceSchedule(EagerGroup *group,
                                           const int curr_group_index) {
   // The overall timeline: concat > div_nranks > allreduce > split
@@ -1097,8 +1326,47 @@ void EagerReducer::FusedAllReduceSchedule(EagerGroup *group,
   paddle::experimental::scale_(
       group->dense_contents_, 1.0 / nranks_, 0.0, false);  // NOLINT
 
+  // reduce_scatter for sharded optimizers: each rank only needs the shard
+  // its optimizer owns, so this moves 1/nranks of the allreduce volume and
+  // skips the split back into gradients entirely. Buckets that do not
+  // shard evenly fall back to allreduce.
+  group->is_scattered_ = sharded_grads_enabled_ &&
+                         compression_hook_ == nullptr &&
+                         group->all_length_ % nranks_ == 0;
+  if (group->is_scattered_) {
+    const int64_t shard_numel = group->all_length_ / nranks_;
+    group->shard_contents_ = paddle::experimental::empty(
+        IntArray({shard_numel}), group->dtype_, inner_place_);
+    group->shard_offset_ = shard_numel * process_group_->GetRank();
+    distributed::ReduceScatterOptions rs_opts;
+    rs_opts.reduce_op = ReduceOp::SUM;
+    auto *in_dense = std::dynamic_pointer_cast<phi::DenseTensor>(
+                         group->dense_contents_.impl())
+                         .get();
+    auto *out_dense = std::dynamic_pointer_cast<phi::DenseTensor>(
+                          group->shard_contents_.impl())
+                          .get();
+    group->task = process_group_->ReduceScatter(
+        out_dense, *in_dense, rs_opts, /*sync_op*/ false);
+    if (auto_tune_enabled_ && !auto_tune_done_) {
+      group_launch_time_[curr_group_index] =
+          std::chrono::duration<double>(
+              std::chrono::steady_clock::now().time_since_epoch())
+              .count();
+    }
+    return;
+  }
+
   // all_reduce
-  std::vector<Tensor> reduce_tensors = {group->dense_contents_};
+  Tensor comm_tensor = group->dense_contents_;
+  if (compression_hook_ != nullptr) {
+    // Encode on the calc stream; the process group's stream sync makes the
+    // collective wait for it, so overlap is preserved.
+    comm_tensor =
+        compression_hook_->Encode(curr_group_index, group->dense_contents_);
+    compressed_contents_[curr_group_index] = comm_tensor;
+  }
+  std::vector<Tensor> reduce_tensors = {comm_tensor};
   std::vector<phi::DenseTensor> in_out;
   in_out.reserve(reduce_tensors.size());
   for (auto &t : reduce_tensors) {
@@ -1106,9 +1374,16 @@ void EagerReducer::FusedAllReduceSchedule(EagerGroup *group,
   }
   group->task = process_group_->AllReduce(in_out, in_out, opts);
 
+  if (auto_tune_enabled_ && !auto_tune_done_) {
+    group_launch_time_[curr_group_index] =
+        std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+  }
+
   auto *context = process_group_->GetDeviceContext(inner_place_);
 
-  if (IsStreamSafeAllocator()) {
+  if (IsStreamSafeAllocator() && compression_hook_ == nullptr) {
     // NOTE(shenliang03): The best_fit allocator strategy is multi-stream
     // insecure. In the Split operator, additional memory will be applied for
     // calculation, and if it is asynchronous, an illegal memory access may be
@@ -1116,6 +1391,8 @@ void EagerReducer::FusedAllReduceSchedule(EagerGroup *group,
     group->SplitTensors(*context);
     group->task->UpdateWaitChain(*context);
   }
+  // Compressed buckets are decoded and split in FinalizeBackward, after the
+  // collective has been synchronized.
 }
 
 void EagerReducer::AllReduceSparse(EagerGroup *group,
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -44,12 +45,48 @@ std::vector<std::vector<size_t>> Eager_AssignGroupBySize(
     const std::vector<size_t> &group_size_limits,
     const std::vector<int64_t> &tensor_indices = {});
 
+// Pluggable gradient compression at the bucket/process-group boundary.
+// Encode runs on the calculation stream right before a fused bucket is
+// handed to the process group, Decode after the collective has been
+// synchronized and before the bucket is split back into gradients, so
+// strategies compose with communication/computation overlap. Hooks own any
+// per-bucket state they need (e.g. error-feedback residuals).
+class GradCompressionHook {
+ public:
+  virtual ~GradCompressionHook() {}
+  // Returns the tensor to communicate in place of the bucket.
+  virtual Tensor Encode(size_t group_index, const Tensor &bucket) = 0;
+  // Rebuilds the bucket from the communicated tensor.
+  virtual Tensor Decode(size_t group_index, const Tensor &compressed) = 0;
+};
+
+// Built-in fp16 compression with error feedback: the quantization error of
+// each step is added back into the bucket on the next one, so the bias of
+// repeated rounding cancels over time. Buckets that are not fp32 pass
+// through unchanged.
+class FP16CompressionHook : public GradCompressionHook {
+ public:
+  Tensor Encode(size_t group_index, const Tensor &bucket) override;
+  Tensor Decode(size_t group_index, const Tensor &compressed) override;
+
+ private:
+  std::vector<Tensor> residuals_;
+};
+
 class EagerGroup {
  public:
   Tensor dense_contents_;
   Tensor sparse_contents_;
   bool is_sparse_ = false;
 
+  // Set when the bucket was reduce-scattered instead of allreduced
+  // (EagerReducer::EnableShardedGrads): shard_contents_ holds this rank's
+  // reduced shard and shard_offset_ its element offset within the fused
+  // bucket. Scattered buckets are never split back into gradients.
+  bool is_scattered_ = false;
+  Tensor shard_contents_;
+  int64_t shard_offset_ = 0;
+
   // for concat kernel
   std::vector<phi::DenseTensor> dense_tensors_;
   std::vector<int64_t> length_;
@@ -103,6 +140,46 @@ class EagerReducer {
   void InitializeDenseGroups(const std::vector<size_t> &tensor_indices_,
                              EagerGroup *p_group);
   void PrepareForBackward(const std::vector<Tensor> &outputs);
+
+  // Re-partition gradient buckets from runtime measurements instead of the
+  // static byte-size knob. During the first warmup_steps backward passes the
+  // reducer records when each gradient arrives and how long each bucket's
+  // fused allreduce takes; it then fits a latency model to pick a bucket
+  // byte size that amortizes per-call overhead, repacks buckets in gradient
+  // arrival order so the earliest-ready bucket launches first, and rebuilds
+  // the groups once. Call before the first backward pass.
+  void EnableAutoTune(size_t warmup_steps = 3);
+
+  // Overlap scheduler for ZeRO-style sharded optimizers. The callback fires
+  // once per dense bucket from FinalizeBackward, as soon as that bucket's
+  // collective has been synchronized and before later buckets are waited
+  // on, i.e. in completion order while the remaining communication is still
+  // in flight. grad_shard is this rank's reduced shard and shard_offset its
+  // element offset within the fused bucket when sharded grads are enabled;
+  // otherwise the whole reduced bucket with offset 0. A sharded optimizer
+  // can update each shard as it arrives and launch the parameter allgather
+  // for already-updated shards first, pipelining the step tail instead of
+  // running reduce, update and allgather as sequential phases. Sparse
+  // buckets keep their own path and never trigger the callback.
+  using BucketCompletionCallback =
+      std::function<void(size_t group_index,
+                         const std::vector<size_t> &tensor_indices,
+                         const Tensor &grad_shard,
+                         int64_t shard_offset)>;
+  void SetBucketCompletionCallback(BucketCompletionCallback callback);
+  // Communicate dense buckets with reduce-scatter instead of allreduce, so
+  // each rank only receives the shard its optimizer owns. Buckets whose
+  // length is not divisible by nranks, and all buckets when a compression
+  // hook is installed, fall back to allreduce. Scattered buckets leave the
+  // per-tensor gradients untouched; the sharding layer consumes the shard
+  // through the completion callback.
+  void EnableShardedGrads();
+
+  // Install a compression hook at the bucket boundary (nullptr removes it).
+  // Applies to dense buckets only; sparse gradients keep their own path.
+  void SetCompressionHook(std::shared_ptr<GradCompressionHook> hook);
+  // Convenience for the built-in fp16-with-error-feedback strategy.
+  void EnableFP16Compression();
   void AddDistHook(size_t var_index);
   void MarkVarReady(const size_t var_index, const bool is_used_var);
   void MarkGroupReady(const size_t group_index);
@@ -139,6 +216,32 @@ class EagerReducer {
   bool find_unused_vars_once_{true};
   bool groups_need_finalize_{false};
   Tensor global_used_vars_;
+
+  // Overlap scheduling for sharded optimizers (EnableShardedGrads,
+  // SetBucketCompletionCallback)
+  bool sharded_grads_enabled_{false};
+  BucketCompletionCallback bucket_completion_callback_;
+
+  // Gradient compression (SetCompressionHook); compressed_contents_ keeps
+  // each bucket's in-flight communicated tensor alive until Decode.
+  std::shared_ptr<GradCompressionHook> compression_hook_;
+  std::vector<Tensor> compressed_contents_;
+
+  // Auto-tuning of bucket sizing and order (EnableAutoTune)
+  void RebuildGroupsForAutoTune();
+  bool auto_tune_enabled_{false};
+  bool auto_tune_done_{false};
+  size_t auto_tune_warmup_steps_{3};
+  size_t auto_tune_steps_seen_{0};
+  size_t arrival_seq_{0};
+  std::vector<double> arrival_position_sum_;
+  std::vector<double> group_launch_time_;
+  // accumulators for the (bucket bytes -> allreduce seconds) linear fit
+  double lat_samples_{0};
+  double lat_sum_bytes_{0};
+  double lat_sum_secs_{0};
+  double lat_sum_bytes_sq_{0};
+  double lat_sum_bytes_secs_{0};
 };
 
 }  //  namespace distributed
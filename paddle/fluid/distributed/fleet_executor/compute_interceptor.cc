@@ -20,6 +20,17 @@
 #include "paddle/fluid/framework/executor_gc_helper.h"
 #include "paddle/fluid/framework/operator.h"
 #include "paddle/fluid/jit/serializer.h"
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_int64(
+    fleet_executor_message_batch_size,
+    1,
+    "Number of microbatch notifications a compute interceptor accumulates "
+    "per peer before sending them as one message. The default 1 keeps the "
+    "one-message-per-microbatch protocol. Larger values cut the per-message "
+    "overhead on deep pipelines with many microbatches at the cost of a "
+    "slightly longer pipeline fill; only linear compute pipelines support "
+    "batching, graphs with cond interceptors must keep it at 1.");
 
 namespace paddle {
 namespace distributed {
@@ -140,14 +151,14 @@ void ComputeInterceptor::IncreaseReady(int64_t up_id, int64_t scope_id) {
   it->second.second.at(scope_id) = ready_scope_map.at(scope_id) + 1;
 }
 
-void ComputeInterceptor::DecreaseBuff(int64_t down_id) {
+void ComputeInterceptor::DecreaseBuff(int64_t down_id, int64_t credits) {
   auto it = out_buffs_.find(down_id);
   PADDLE_ENFORCE_NE(it,
                     out_buffs_.end(),
                     platform::errors::NotFound(
                         "Cannot find downstream=%lld in out_buffs.", down_id));
   auto used_size = it->second.second;
-  used_size -= 1;
+  used_size -= credits;
   PADDLE_ENFORCE_GE(
       used_size,
       0,
@@ -227,6 +238,9 @@ bool ComputeInterceptor::CanWriteOutput() {
 
 void ComputeInterceptor::SendDataReadyToDownStream() {
   bool need_send_vars = !(node_->vars_to_dtype().empty());
+  // Messages carrying serialized vars are per-scope and cannot be batched.
+  bool batch_msgs =
+      (FLAGS_fleet_executor_message_batch_size > 1) && !need_send_vars;
   InterceptorMessage ready_msg;
   ready_msg.set_start_micro_step(start_micro_step_);
   ready_msg.set_num_micro_step(num_micro_step_);
@@ -254,6 +268,17 @@ void ComputeInterceptor::SendDataReadyToDownStream() {
     }
     outs.second.second = used_size;
 
+    if (batch_msgs) {
+      // The credit is consumed above; only the notification is deferred so
+      // one message covers every microbatch accumulated for this downstream.
+      pending_ready_scopes_[down_id].push_back(cur_scope_id_);
+      if (static_cast<int64_t>(pending_ready_scopes_[down_id].size()) >=
+          FLAGS_fleet_executor_message_batch_size) {
+        FlushBatchedMessages();
+      }
+      continue;
+    }
+
     if (need_send_vars) {
       VLOG(3) << "ComputeInterceptor " << interceptor_id_
               << " Send data_with_vars msg to " << down_id
@@ -282,6 +307,16 @@ void ComputeInterceptor::ReplyCompletedToUpStream() {
             ready_size));
     ins.second.second[cur_scope_id_] = ready_size;
 
+    if (FLAGS_fleet_executor_message_batch_size > 1) {
+      // Defer the reply; the batched message returns all accumulated
+      // credits to the upstream at once.
+      pending_credits_[up_id] += 1;
+      if (pending_credits_[up_id] >= FLAGS_fleet_executor_message_batch_size) {
+        FlushBatchedMessages();
+      }
+      continue;
+    }
+
     VLOG(3) << "ComputeInterceptor " << interceptor_id_
             << " Reply data_is_useless msg to " << up_id
             << " in scope: " << cur_scope_id_;
@@ -293,6 +328,45 @@ void ComputeInterceptor::ReplyCompletedToUpStream() {
   }
 }
 
+void ComputeInterceptor::FlushBatchedMessages() {
+  for (auto& pending : pending_ready_scopes_) {
+    auto down_id = pending.first;
+    auto& scopes = pending.second;
+    if (scopes.empty()) {
+      continue;
+    }
+    InterceptorMessage ready_msg;
+    ready_msg.set_message_type(DATA_IS_READY);
+    ready_msg.set_start_micro_step(start_micro_step_);
+    ready_msg.set_num_micro_step(num_micro_step_);
+    ready_msg.set_scope_idx(scopes.front());
+    for (auto scope_id : scopes) {
+      ready_msg.add_scope_idxs(scope_id);
+    }
+    VLOG(3) << "ComputeInterceptor " << interceptor_id_
+            << " Send batched data_is_ready msg to " << down_id << " covering "
+            << scopes.size() << " scopes";
+    Send(down_id, ready_msg);
+    scopes.clear();
+  }
+  for (auto& pending : pending_credits_) {
+    auto up_id = pending.first;
+    auto& credits = pending.second;
+    if (credits == 0) {
+      continue;
+    }
+    InterceptorMessage reply_msg;
+    reply_msg.set_message_type(DATA_IS_USELESS);
+    reply_msg.set_scope_idx(cur_scope_id_);
+    reply_msg.set_num_credits(credits);
+    VLOG(3) << "ComputeInterceptor " << interceptor_id_
+            << " Reply batched data_is_useless msg to " << up_id << " with "
+            << credits << " credits";
+    Send(up_id, reply_msg);
+    credits = 0;
+  }
+}
+
 void ComputeInterceptor::RunOps() {
   if (!cores_.empty() || !node_->ops().empty()) {
     PADDLE_ENFORCE_LT(cur_scope_id_,
@@ -358,6 +432,10 @@ void ComputeInterceptor::Run() {
       }
     }
   }
+  // Nothing more can run locally: let the deferred notifications out so the
+  // peers can make progress. Flushing on every blocking exit keeps the
+  // protocol deadlock free whatever the batch size is.
+  FlushBatchedMessages();
 }
 
 void ComputeInterceptor::Compute(const InterceptorMessage& msg) {
@@ -367,13 +445,20 @@ void ComputeInterceptor::Compute(const InterceptorMessage& msg) {
             << msg.scope_idx() << " ";
     start_micro_step_ = msg.start_micro_step();
     num_micro_step_ = msg.num_micro_step();
-    IncreaseReady(msg.src_id(), msg.scope_idx());
+    if (msg.scope_idxs_size() > 0) {
+      // a batched notification covering several microbatches
+      for (auto scope_id : msg.scope_idxs()) {
+        IncreaseReady(msg.src_id(), scope_id);
+      }
+    } else {
+      IncreaseReady(msg.src_id(), msg.scope_idx());
+    }
     Run();
   } else if (msg.message_type() == DATA_IS_USELESS) {
     VLOG(3) << "Compute interceptor " << interceptor_id_
             << " receive data_is_useless " << msg.src_id() << " "
-            << msg.scope_idx() << " ";
-    DecreaseBuff(msg.src_id());
+            << msg.scope_idx() << " with " << msg.num_credits() << " credits";
+    DecreaseBuff(msg.src_id(), msg.num_credits());
     Run();
   } else if (msg.message_type() == DATA_WITH_VARS) {
     VLOG(3) << "Compute interceptor " << interceptor_id_
@@ -35,7 +35,7 @@ class ComputeInterceptor : public Interceptor {
   virtual void Compute(const InterceptorMessage& msg);
   void Run();
   void IncreaseReady(int64_t up_id, int64_t scope_id);
-  void DecreaseBuff(int64_t down_id);
+  void DecreaseBuff(int64_t down_id, int64_t credits = 1);
 
   int64_t cur_scope_id_ = 0;
 
@@ -52,6 +52,16 @@ class ComputeInterceptor : public Interceptor {
 
   bool IsInputReady();
   bool CanWriteOutput();
+  void FlushBatchedMessages();
+
+  // With FLAGS_fleet_executor_message_batch_size > 1, ready notifications
+  // and useless replies are accumulated here per peer and sent as one
+  // message covering several microbatches. Credits are consumed/returned in
+  // the local accounting immediately; only the wire messages are deferred.
+  // downstream_id-->scopes with deferred DATA_IS_READY
+  std::map<int64_t, std::vector<int64_t>> pending_ready_scopes_;
+  // upstream_id-->deferred DATA_IS_USELESS credits
+  std::map<int64_t, int64_t> pending_credits_;
   std::map<int64_t, std::map<int64_t, bool>>
       gen_step_to_scope_id_to_finish_flag_;
   int64_t start_micro_step_{-1};
@@ -21,8 +21,16 @@
 
 #include "paddle/fluid/distributed/fleet_executor/carrier.h"
 #include "paddle/fluid/distributed/fleet_executor/global.h"
+#include "paddle/fluid/platform/flags.h"
 #include "paddle/fluid/platform/gen_comm_id_helper.h"
 
+PADDLE_DEFINE_EXPORTED_bool(
+    fleet_executor_shm_message_bus,
+    true,
+    "Deliver interceptor messages between ranks on the same host through a "
+    "shared-memory ring instead of brpc. Oversized messages and full rings "
+    "fall back to brpc automatically.");
+
 namespace paddle::distributed {
 
 void MessageBus::Init(
@@ -66,12 +74,21 @@ void MessageBus::Init(
 #endif
 
   ListenPort();
+
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+  StartShmRing();
+#endif
 }
 
 bool MessageBus::IsInit() const { return is_init_; }
 
 MessageBus::~MessageBus() {
   VLOG(3) << "Message bus releases resource.";
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+  StopShmRing();
+#endif
 #if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB)
   server_.Stop(1000);
   server_.Join();
@@ -93,6 +110,20 @@ bool MessageBus::Send(int64_t dst_rank,
       true,
       platform::errors::PreconditionNotMet(
           "Using message bus since it has not been initialized."));
+  if (IsSameProcess(dst_rank)) {
+    VLOG(3) << "Message bus delivers to rank " << dst_rank
+            << " in the same process directly.";
+    return SendIntraProcess(interceptor_message);
+  }
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+  if (FLAGS_fleet_executor_shm_message_bus && IsSameHost(dst_rank) &&
+      SendViaShm(dst_rank, interceptor_message)) {
+    VLOG(3) << "Message bus sends to same-host rank " << dst_rank
+            << " through the shared-memory ring.";
+    return true;
+  }
+#endif
 #if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB)
   int retry_time = 0;  // message bus will retry sending for 10 times
   while (retry_time < 10) {
@@ -172,6 +203,26 @@ bool MessageBus::DispatchMsgToCarrier(
       ->EnqueueInterceptorMessage(interceptor_message);
 }
 
+bool MessageBus::IsSameProcess(int64_t dst_rank) const {
+  if (dst_rank == rank_) {
+    return true;
+  }
+  // two ranks listening on the same addr can only be the same bus
+  auto iter = rank_to_addr_.find(dst_rank);
+  return !addr_.empty() && iter != rank_to_addr_.end() &&
+         iter->second == addr_;
+}
+
+bool MessageBus::SendIntraProcess(
+    const InterceptorMessage& interceptor_message) {
+  // same handling as the brpc service, minus the wire round trip
+  if (interceptor_message.ctrl_message()) {
+    IncreaseBarrierCount();
+    return true;
+  }
+  return DispatchMsgToCarrier(interceptor_message);
+}
+
 void MessageBus::ListenPort() {
   if (addr_.empty()) {
     LOG(INFO) << "No need listen to port since training on single card.";
@@ -249,4 +300,116 @@ bool MessageBus::SendInterRank(int64_t dst_rank,
 
 #endif
 
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+
+namespace {
+std::string HostOf(const std::string& addr) {
+  return addr.substr(0, addr.find(':'));
+}
+
+std::string ShmRingName(const std::string& addr) {
+  // the listen port is unique per host, so it also names the ring
+  std::string name = "/paddle_fleet_exe_ring_" + addr;
+  for (auto& c : name) {
+    if (c == ':' || c == '.') {
+      c = '_';
+    }
+  }
+  return name;
+}
+}  // namespace
+
+bool MessageBus::IsSameHost(int64_t dst_rank) const {
+  auto iter = rank_to_addr_.find(dst_rank);
+  if (addr_.empty() || iter == rank_to_addr_.end()) {
+    return false;
+  }
+  // conservative: only a literal host match counts, 127.0.0.1 vs a real NIC
+  // address of the same machine still goes through brpc
+  return HostOf(iter->second) == HostOf(addr_);
+}
+
+void MessageBus::StartShmRing() {
+  if (!FLAGS_fleet_executor_shm_message_bus || addr_.empty()) {
+    return;
+  }
+  shm_ring_.reset(ShmMessageRing::Create(ShmRingName(addr_)));
+  if (shm_ring_ == nullptr || !shm_ring_->IsValid()) {
+    shm_ring_.reset();
+    return;
+  }
+  shm_stop_.store(false);
+  shm_drain_thread_ = std::thread([this] { DrainShmRing(); });
+  VLOG(3) << "Message bus starts the shared-memory ring for " << addr_ << ".";
+}
+
+void MessageBus::StopShmRing() {
+  if (shm_drain_thread_.joinable()) {
+    shm_stop_.store(true);
+    shm_drain_thread_.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(shm_senders_mutex_);
+    shm_senders_.clear();
+  }
+  shm_ring_.reset();
+}
+
+void MessageBus::DrainShmRing() {
+  char buffer[ShmMessageRing::kSlotPayload];
+  size_t size = 0;
+  while (!shm_stop_.load()) {
+    if (!shm_ring_->Dequeue(buffer, &size)) {
+      // idle; a short sleep keeps the hop well under the brpc latency
+      // without burning a core
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      continue;
+    }
+    InterceptorMessage interceptor_message;
+    if (!interceptor_message.ParseFromArray(buffer,
+                                            static_cast<int>(size))) {
+      LOG(WARNING) << "Message bus: failed to parse a shared-memory ring "
+                      "message, dropping it.";
+      continue;
+    }
+    if (interceptor_message.ctrl_message()) {
+      IncreaseBarrierCount();
+    } else {
+      DispatchMsgToCarrier(interceptor_message);
+    }
+  }
+}
+
+bool MessageBus::SendViaShm(int64_t dst_rank,
+                            const InterceptorMessage& interceptor_message) {
+  size_t size = interceptor_message.ByteSizeLong();
+  if (size > ShmMessageRing::kSlotPayload) {
+    // DATA_WITH_VARS messages can carry tensors; leave those to brpc
+    return false;
+  }
+  ShmMessageRing* ring = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(shm_senders_mutex_);
+    auto iter = shm_senders_.find(dst_rank);
+    if (iter == shm_senders_.end()) {
+      std::unique_ptr<ShmMessageRing> attached(
+          ShmMessageRing::Attach(ShmRingName(GetAddr(dst_rank))));
+      if (attached == nullptr || !attached->IsValid()) {
+        // peer's ring is not up yet (or it disabled the fast path)
+        return false;
+      }
+      iter = shm_senders_.emplace(dst_rank, std::move(attached)).first;
+    }
+    ring = iter->second.get();
+  }
+  char buffer[ShmMessageRing::kSlotPayload];
+  if (!interceptor_message.SerializeToArray(buffer, static_cast<int>(size))) {
+    return false;
+  }
+  return ring->Enqueue(buffer, size);
+}
+
+#endif
+
 }  // namespace paddle::distributed
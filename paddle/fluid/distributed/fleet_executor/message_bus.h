@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -25,6 +27,10 @@
 #include "brpc/server.h"
 #include "paddle/fluid/distributed/fleet_executor/message_service.h"
 #endif
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+#include "paddle/fluid/distributed/fleet_executor/shm_message_ring.h"
+#endif
 
 #include "paddle/fluid/distributed/fleet_executor/interceptor_message.pb.h"
 #include "paddle/fluid/platform/enforce.h"
@@ -63,12 +69,29 @@ class MessageBus final {
 
   const std::string& GetAddr(int64_t rank) const;
 
+  // dst_rank's bus lives in this process, hand the message over directly
+  // without touching the network stack
+  bool IsSameProcess(int64_t dst_rank) const;
+  bool SendIntraProcess(const InterceptorMessage& interceptor_message);
+
 #if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB)
   // send the message inter rank (dst is different rank with src)
   bool SendInterRank(int64_t dst_rank,
                      const InterceptorMessage& interceptor_message);
 #endif
 
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+  // same-host fast path: serialized messages go through a shared-memory
+  // ring owned by the destination rank instead of brpc
+  bool IsSameHost(int64_t dst_rank) const;
+  bool SendViaShm(int64_t dst_rank,
+                  const InterceptorMessage& interceptor_message);
+  void StartShmRing();
+  void StopShmRing();
+  void DrainShmRing();
+#endif
+
   bool is_init_{false};
 
   int64_t rank_;
@@ -85,6 +108,17 @@ class MessageBus final {
   brpc::Server server_;
 #endif
 
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+  // ring this rank drains; peers on the same host enqueue into it
+  std::unique_ptr<ShmMessageRing> shm_ring_;
+  std::thread shm_drain_thread_;
+  std::atomic<bool> shm_stop_{false};
+  // producer-side attachments, one per same-host destination rank
+  std::unordered_map<int64_t, std::unique_ptr<ShmMessageRing>> shm_senders_;
+  std::mutex shm_senders_mutex_;
+#endif
+
   // for barrier
   std::mutex mutex_;
   std::condition_variable cv_;
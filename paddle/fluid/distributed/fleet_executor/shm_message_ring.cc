@@ -0,0 +1,146 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/distributed/fleet_executor/shm_message_ring.h"
+
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "glog/logging.h"
+
+namespace paddle {
+namespace distributed {
+
+namespace {
+constexpr uint32_t kRingMagic = 0x464c4545;  // 'FLEE'
+
+void* MapSegment(int fd, size_t bytes) {
+  void* addr =
+      mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  return addr == MAP_FAILED ? nullptr : addr;
+}
+}  // namespace
+
+ShmMessageRing* ShmMessageRing::Create(const std::string& name) {
+  // A stale segment may survive a crashed predecessor with the same port;
+  // remove it so the sequence numbers below start from a clean state.
+  shm_unlink(name.c_str());
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    LOG(WARNING) << "ShmMessageRing: shm_open(" << name
+                 << ") failed, same-host messages will use rpc instead.";
+    return nullptr;
+  }
+  if (ftruncate(fd, sizeof(Control)) != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+  auto* control = reinterpret_cast<Control*>(MapSegment(fd, sizeof(Control)));
+  close(fd);
+  if (control == nullptr) {
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+  control->head.store(0, std::memory_order_relaxed);
+  control->tail.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < kSlotCount; ++i) {
+    control->slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  // Publish only after the slots are initialized; Attach checks the magic.
+  control->magic.store(kRingMagic, std::memory_order_release);
+  return new ShmMessageRing(name, control, /*is_owner=*/true);
+}
+
+ShmMessageRing* ShmMessageRing::Attach(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+  auto* control = reinterpret_cast<Control*>(MapSegment(fd, sizeof(Control)));
+  close(fd);
+  if (control == nullptr) {
+    return nullptr;
+  }
+  if (control->magic.load(std::memory_order_acquire) != kRingMagic) {
+    munmap(control, sizeof(Control));
+    return nullptr;
+  }
+  return new ShmMessageRing(name, control, /*is_owner=*/false);
+}
+
+ShmMessageRing::~ShmMessageRing() {
+  if (control_ != nullptr) {
+    munmap(control_, sizeof(Control));
+  }
+  if (is_owner_) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+bool ShmMessageRing::Enqueue(const void* data, size_t size) {
+  if (size > kSlotPayload) {
+    return false;
+  }
+  // Bounded MPMC scheme: each slot carries a sequence number which tells
+  // whether it is free for the ticket a producer holds. Producers from
+  // different processes race on head with CAS only.
+  uint64_t pos = control_->head.load(std::memory_order_relaxed);
+  Slot* slot = nullptr;
+  while (true) {
+    slot = &control_->slots[pos & (kSlotCount - 1)];
+    uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+    int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+    if (dif == 0) {
+      if (control_->head.compare_exchange_weak(
+              pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      return false;  // ring is full
+    } else {
+      pos = control_->head.load(std::memory_order_relaxed);
+    }
+  }
+  slot->size = static_cast<uint32_t>(size);
+  std::memcpy(slot->payload, data, size);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool ShmMessageRing::Dequeue(void* buffer, size_t* size) {
+  uint64_t pos = control_->tail.load(std::memory_order_relaxed);
+  Slot* slot = &control_->slots[pos & (kSlotCount - 1)];
+  uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+  if (static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1) < 0) {
+    return false;  // ring is empty
+  }
+  *size = slot->size;
+  std::memcpy(buffer, slot->payload, slot->size);
+  slot->sequence.store(pos + kSlotCount, std::memory_order_release);
+  control_->tail.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+}  // namespace distributed
+}  // namespace paddle
+
+#endif
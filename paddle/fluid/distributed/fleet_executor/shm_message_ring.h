@@ -0,0 +1,86 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(PADDLE_WITH_DISTRIBUTE) && !defined(PADDLE_WITH_PSLIB) && \
+    !defined(_WIN32)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "paddle/fluid/platform/macros.h"
+
+namespace paddle {
+namespace distributed {
+
+// A bounded multi-producer ring in POSIX shared memory, used by the message
+// bus to hand serialized InterceptorMessages between ranks on the same host
+// without going through brpc. The rank that listens on a port owns (creates
+// and drains) the ring named after that port; any same-host peer attaches as
+// a producer. Payloads larger than a slot are rejected so the caller can fall
+// back to the rpc path.
+class ShmMessageRing final {
+ public:
+  static constexpr size_t kSlotPayload = 4096;
+  static constexpr size_t kSlotCount = 1024;  // must be a power of two
+
+  // The owner creates and truncates the segment; producers attach to an
+  // existing one. Attach fails (IsValid() == false) until the owner has
+  // finished initializing, callers should simply retry via brpc meanwhile.
+  static ShmMessageRing* Create(const std::string& name);
+  static ShmMessageRing* Attach(const std::string& name);
+
+  ~ShmMessageRing();
+
+  bool IsValid() const { return control_ != nullptr; }
+
+  // Copies [data, data + size) into a free slot. Returns false when the ring
+  // is full or size exceeds kSlotPayload; never blocks.
+  bool Enqueue(const void* data, size_t size);
+
+  // Single consumer only (the owning rank's drain thread). Returns false
+  // when the ring is empty, otherwise fills buffer and *size.
+  bool Dequeue(void* buffer, size_t* size);
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence;
+    uint32_t size;
+    char payload[kSlotPayload];
+  };
+
+  struct Control {
+    std::atomic<uint32_t> magic;  // set last by the creator, checked by Attach
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+    Slot slots[kSlotCount];
+  };
+
+  ShmMessageRing(const std::string& name, Control* control, bool is_owner)
+      : name_(name), control_(control), is_owner_(is_owner) {}
+
+  DISABLE_COPY_AND_ASSIGN(ShmMessageRing);
+
+  std::string name_;
+  Control* control_;
+  bool is_owner_;
+};
+
+}  // namespace distributed
+}  // namespace paddle
+
+#endif
@@ -44,22 +44,26 @@ void SinkInterceptor::StopCarrierIfComplete() {
   }
 }
 
-void SinkInterceptor::ReplyCompletedToUpStream(int64_t upstream_id) {
+void SinkInterceptor::ReplyCompletedToUpStream(int64_t upstream_id,
+                                               int64_t num_steps) {
   int64_t micro_step = upstream_step_.at(upstream_id);
   int64_t scope_idx = micro_step % max_run_times_;
   InterceptorMessage msg;
   msg.set_message_type(DATA_IS_USELESS);
   msg.set_scope_idx(scope_idx);
+  // one reply returns every credit of the batched notification
+  msg.set_num_credits(num_steps);
   Send(upstream_id, msg);
-  upstream_step_.at(upstream_id) = micro_step + 1;
-  if (micro_step == max_run_times_ - 1) {
+  upstream_step_.at(upstream_id) = micro_step + num_steps;
+  if (micro_step + num_steps >= max_run_times_) {
     StopCarrierIfComplete();
   }
 }
 
 void SinkInterceptor::Run(const InterceptorMessage& msg) {
   if (msg.message_type() == DATA_IS_READY) {
-    ReplyCompletedToUpStream(msg.src_id());
+    int64_t num_steps = msg.scope_idxs_size() > 0 ? msg.scope_idxs_size() : 1;
+    ReplyCompletedToUpStream(msg.src_id(), num_steps);
   }
 }
 
@@ -30,7 +30,7 @@ class SinkInterceptor final : public Interceptor {
   SinkInterceptor(int64_t interceptor_id, TaskNode* node);
 
  private:
-  void ReplyCompletedToUpStream(int64_t up_id);
+  void ReplyCompletedToUpStream(int64_t up_id, int64_t num_steps = 1);
   void Run(const InterceptorMessage& msg);
   void StopCarrierIfComplete();
   int64_t max_run_times_;
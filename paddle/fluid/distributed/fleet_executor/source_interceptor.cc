@@ -29,17 +29,25 @@ SourceInterceptor::SourceInterceptor(int64_t interceptor_id, TaskNode* node)
   RegisterMsgHandle([this](const InterceptorMessage& msg) { Run(msg); });
 }
 
-void SourceInterceptor::SendDataReadyToDownStream(int64_t downstream_id) {
+void SourceInterceptor::SendDataReadyToDownStream(int64_t downstream_id,
+                                                  int64_t num_steps) {
   int64_t micro_step = downstream_step_.at(downstream_id);
   if (micro_step >= max_run_times_) {
     return;
   }
-  int64_t scope_idx = micro_step % max_run_times_;
   InterceptorMessage ready_msg;
   ready_msg.set_message_type(DATA_IS_READY);
-  ready_msg.set_scope_idx(scope_idx);
+  ready_msg.set_scope_idx(micro_step % max_run_times_);
+  // when several credits come back at once, one message announces the
+  // matching number of scopes
+  for (int64_t i = 0; i < num_steps && micro_step < max_run_times_;
+       ++i, ++micro_step) {
+    if (num_steps > 1) {
+      ready_msg.add_scope_idxs(micro_step % max_run_times_);
+    }
+  }
   Send(downstream_id, ready_msg);
-  downstream_step_.at(downstream_id) = micro_step + 1;
+  downstream_step_.at(downstream_id) = micro_step;
 }
 
 void SourceInterceptor::Run(const InterceptorMessage& msg) {
@@ -50,7 +58,7 @@ void SourceInterceptor::Run(const InterceptorMessage& msg) {
       SendDataReadyToDownStream(down.first);
     }
   } else if (msg.message_type() == DATA_IS_USELESS) {
-    SendDataReadyToDownStream(msg.src_id());
+    SendDataReadyToDownStream(msg.src_id(), msg.num_credits());
   }
 }
 
@@ -30,7 +30,7 @@ class SourceInterceptor final : public Interceptor {
   SourceInterceptor(int64_t interceptor_id, TaskNode* node);
 
  private:
-  void SendDataReadyToDownStream(int64_t down_id);
+  void SendDataReadyToDownStream(int64_t down_id, int64_t num_steps = 1);
   void Run(const InterceptorMessage& msg);
   int64_t max_run_times_;
   // downstream_id->cur_step
@@ -96,7 +96,8 @@ void StartInterceptor::Compute(const InterceptorMessage& msg) {
   } else if (msg.message_type() == DATA_IS_USELESS) {
     VLOG(3) << "Start interceptor receive data_is_useless " << msg.src_id()
             << " " << finish_count_;
-    finish_count_--;
+    // a batched reply returns several credits at once
+    finish_count_ -= msg.num_credits();
     if (finish_count_ == 0) {
       auto end = std::chrono::system_clock::now();
       auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
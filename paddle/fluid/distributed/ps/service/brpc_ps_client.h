@@ -266,6 +266,9 @@ class BrpcPsClient : public PSClient {
                                                const uint64_t *keys,
                                                size_t num,
                                                bool is_training);
+  virtual std::future<int32_t> PrefetchSparse(size_t table_id,
+                                              const uint64_t *keys,
+                                              size_t num);
 
   virtual std::future<int32_t> PrintTableStat(uint32_t table_id);
 
@@ -149,6 +149,19 @@ class PSClient {
     return fut;
   }
 
+  // hint the servers that these keys appear in an upcoming pull, so tiered
+  // tables can warm them from slow storage before the pull arrives; the
+  // future resolves once every server has accepted the hint
+  virtual std::future<int32_t> PrefetchSparse(size_t table_id UNUSED,
+                                              const uint64_t *keys UNUSED,
+                                              size_t num UNUSED) {
+    VLOG(0) << "Did not implement";
+    std::promise<int32_t> promise;
+    std::future<int> fut = promise.get_future();
+    promise.set_value(-1);
+    return fut;
+  }
+
   virtual ::std::future<int32_t> PullSparsePtr(
       int shard_id UNUSED,
       char **select_values UNUSED,
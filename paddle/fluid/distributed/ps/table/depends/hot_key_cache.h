@@ -0,0 +1,369 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <utility>
+#include <vector>
+
+namespace paddle {
+namespace distributed {
+
+// Read-mostly cache for the hottest feasign values, sitting in front of the
+// SparseTableShard array. A handful of keys absorbs most pull traffic and
+// serializes on the per-shard task queues; serving those keys from here lets
+// pull threads answer them without ever entering a shard.
+//
+// Concurrency scheme:
+//  - Readers are lock-free. Each cache entry is published seqlock-style (an
+//    even/odd tag around key+value updates) and cached value buffers are
+//    immutable once published, so a reader either copies a consistent value
+//    or reports a miss.
+//  - Retired buffers are reclaimed with epochs: a pull thread publishes the
+//    global epoch for the duration of a batch (ReadGuard), writers retire
+//    replaced buffers with the epoch at swap time and only free them once
+//    every published reader epoch has moved past it.
+//  - Promotion is driven by access counts recorded on the shard threads:
+//    once a key has missed promote_threshold times inside the current
+//    counting window it is copied into the cache. Pushes invalidate the
+//    cached copy; the key is promoted again when it reheats. The counting
+//    window resets periodically so yesterday's hot keys decay.
+class HotKeyCache {
+ public:
+  class ReadGuard {
+   public:
+    // A null cache yields an inactive guard, so call sites can create one
+    // unconditionally and let every Lookup miss.
+    explicit ReadGuard(HotKeyCache *cache) : cache_(cache), slot_(-1) {
+      if (cache_ == nullptr) {
+        return;
+      }
+      slot_ = cache_->AcquireReaderSlot();
+      if (slot_ >= 0) {
+        // seq_cst so the epoch publication is visible before any entry
+        // loads inside the guarded section (classic SMR store-load order).
+        cache_->_reader_slots[slot_].epoch.store(
+            cache_->_global_epoch.load(std::memory_order_relaxed),
+            std::memory_order_seq_cst);
+      }
+    }
+    ~ReadGuard() {
+      if (slot_ >= 0) {
+        cache_->_reader_slots[slot_].epoch.store(0, std::memory_order_release);
+        cache_->ReleaseReaderSlot(slot_);
+      }
+    }
+    bool active() const { return slot_ >= 0; }
+
+   private:
+    HotKeyCache *cache_;
+    int slot_;
+  };
+
+  HotKeyCache(size_t capacity, uint32_t promote_threshold)
+      : _promote_threshold(promote_threshold) {
+    _capacity = 64;
+    while (_capacity < capacity) {
+      _capacity <<= 1;
+    }
+    _entries.reset(new Entry[_capacity]);
+    _counts.reset(new std::atomic<uint32_t>[_capacity]);
+    for (size_t i = 0; i < _capacity; ++i) {
+      _counts[i].store(0, std::memory_order_relaxed);
+    }
+    _count_window = _capacity * 64;
+    for (int i = kReaderSlots - 1; i >= 0; --i) {
+      _free_reader_slots.push_back(i);
+    }
+  }
+
+  ~HotKeyCache() {
+    Clear();
+    std::lock_guard<std::mutex> guard(_retire_mutex);
+    for (auto &item : _retired) {
+      delete item.second;
+    }
+  }
+
+  // Lock-free read path. On hit copies at most max_size floats of the cached
+  // value into out, stores the value's true length in *size and returns
+  // true. A guard without a slot (reader oversubscription) always misses, so
+  // callers transparently fall back to the shards.
+  bool Lookup(const ReadGuard &guard,
+              uint64_t key,
+              float *out,
+              size_t max_size,
+              size_t *size) {
+    if (!guard.active()) {
+      return false;
+    }
+    size_t index = Bucket(key);
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+      Entry &entry = _entries[(index + probe) & (_capacity - 1)];
+      uint64_t tag = entry.tag.load(std::memory_order_acquire);
+      if (tag & 1) {
+        continue;  // being rewritten
+      }
+      if (entry.key.load(std::memory_order_relaxed) != key) {
+        continue;
+      }
+      CachedValue *value = entry.value.load(std::memory_order_acquire);
+      if (value == nullptr) {
+        return false;
+      }
+      // The buffer is immutable and epoch-protected; only the slot binding
+      // can change under us, which the tag re-check below catches.
+      size_t copy_size = value->size < max_size ? value->size : max_size;
+      memcpy(out, value->data, copy_size * sizeof(float));
+      *size = value->size;
+      if (entry.tag.load(std::memory_order_acquire) != tag) {
+        return false;
+      }
+      entry.hits.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  // Called on the shard threads after a miss was answered from the shard.
+  // Promotes the key once it has been requested promote_threshold times in
+  // the current window.
+  void RecordAccess(uint64_t key, const float *data, size_t size) {
+    MaybeResetWindow();
+    uint32_t count =
+        _counts[Bucket(key)].fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count == _promote_threshold) {
+      Promote(key, data, size);
+    }
+  }
+
+  // Drops the cached copy after a push rewrote the key's value; the key is
+  // re-promoted once it reheats.
+  void Invalidate(uint64_t key) {
+    size_t index = Bucket(key);
+    bool present = false;
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+      Entry &entry = _entries[(index + probe) & (_capacity - 1)];
+      if (entry.key.load(std::memory_order_relaxed) == key &&
+          entry.value.load(std::memory_order_relaxed) != nullptr) {
+        present = true;
+        break;
+      }
+    }
+    if (!present) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(_write_mutex);
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+      Entry &entry = _entries[(index + probe) & (_capacity - 1)];
+      if (entry.key.load(std::memory_order_relaxed) != key) {
+        continue;
+      }
+      CachedValue *old = entry.value.load(std::memory_order_relaxed);
+      if (old == nullptr) {
+        return;
+      }
+      entry.tag.fetch_add(1, std::memory_order_acq_rel);
+      entry.value.store(nullptr, std::memory_order_release);
+      entry.hits.store(0, std::memory_order_relaxed);
+      entry.tag.fetch_add(1, std::memory_order_release);
+      Retire(old);
+      return;
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> guard(_write_mutex);
+    for (size_t i = 0; i < _capacity; ++i) {
+      Entry &entry = _entries[i];
+      CachedValue *old = entry.value.load(std::memory_order_relaxed);
+      if (old == nullptr) {
+        continue;
+      }
+      entry.tag.fetch_add(1, std::memory_order_acq_rel);
+      entry.value.store(nullptr, std::memory_order_release);
+      entry.hits.store(0, std::memory_order_relaxed);
+      entry.tag.fetch_add(1, std::memory_order_release);
+      Retire(old);
+    }
+    for (size_t i = 0; i < _capacity; ++i) {
+      _counts[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  struct CachedValue {
+    CachedValue(const float *src, size_t n) : size(n), data(new float[n]) {
+      memcpy(data, src, n * sizeof(float));
+    }
+    ~CachedValue() { delete[] data; }
+    size_t size;
+    float *data;
+  };
+
+  struct alignas(64) Entry {
+    std::atomic<uint64_t> tag{0};
+    std::atomic<uint64_t> key{0};
+    std::atomic<CachedValue *> value{nullptr};
+    std::atomic<uint32_t> hits{0};
+  };
+
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{0};
+  };
+
+  static const size_t kProbeLimit = 4;
+  static const int kReaderSlots = 512;
+
+  size_t Bucket(uint64_t key) const {
+    // feasigns are multiplied into the high bits poorly by identity hashing;
+    // finalize with a 64-bit mix (splitmix64) before masking.
+    uint64_t h = key + 0x9e3779b97f4a7c15ULL;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    h = h ^ (h >> 31);
+    return h & (_capacity - 1);
+  }
+
+  void Promote(uint64_t key, const float *data, size_t size) {
+    std::lock_guard<std::mutex> guard(_write_mutex);
+    size_t index = Bucket(key);
+    Entry *victim = nullptr;
+    uint32_t victim_hits = UINT32_MAX;
+    for (size_t probe = 0; probe < kProbeLimit; ++probe) {
+      Entry &entry = _entries[(index + probe) & (_capacity - 1)];
+      CachedValue *current = entry.value.load(std::memory_order_relaxed);
+      if (current != nullptr &&
+          entry.key.load(std::memory_order_relaxed) == key) {
+        return;  // already promoted by a concurrent shard thread
+      }
+      uint32_t hits =
+          current == nullptr ? 0 : entry.hits.load(std::memory_order_relaxed);
+      if (current == nullptr) {
+        victim = &entry;
+        break;
+      }
+      if (hits < victim_hits) {
+        victim = &entry;
+        victim_hits = hits;
+      }
+    }
+    CachedValue *old = victim->value.load(std::memory_order_relaxed);
+    CachedValue *fresh = new CachedValue(data, size);
+    victim->tag.fetch_add(1, std::memory_order_acq_rel);
+    victim->key.store(key, std::memory_order_relaxed);
+    victim->value.store(fresh, std::memory_order_release);
+    victim->hits.store(0, std::memory_order_relaxed);
+    victim->tag.fetch_add(1, std::memory_order_release);
+    if (old != nullptr) {
+      Retire(old);
+    }
+  }
+
+  void Retire(CachedValue *value) {
+    // Caller holds _write_mutex.
+    uint64_t epoch = _global_epoch.load(std::memory_order_relaxed);
+    {
+      std::lock_guard<std::mutex> guard(_retire_mutex);
+      _retired.emplace_back(epoch, value);
+    }
+    _global_epoch.fetch_add(1, std::memory_order_seq_cst);
+    TryReclaim();
+  }
+
+  void TryReclaim() {
+    uint64_t min_active = UINT64_MAX;
+    for (int i = 0; i < kReaderSlots; ++i) {
+      uint64_t e = _reader_slots[i].epoch.load(std::memory_order_seq_cst);
+      if (e != 0 && e < min_active) {
+        min_active = e;
+      }
+    }
+    std::vector<CachedValue *> to_free;
+    {
+      std::lock_guard<std::mutex> guard(_retire_mutex);
+      size_t kept = 0;
+      for (size_t i = 0; i < _retired.size(); ++i) {
+        if (_retired[i].first < min_active) {
+          to_free.push_back(_retired[i].second);
+        } else {
+          _retired[kept++] = _retired[i];
+        }
+      }
+      _retired.resize(kept);
+    }
+    for (auto *value : to_free) {
+      delete value;
+    }
+  }
+
+  void MaybeResetWindow() {
+    uint64_t total = _accesses.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (total >= _count_window) {
+      uint64_t expected = total;
+      if (_accesses.compare_exchange_strong(
+              expected, 0, std::memory_order_relaxed)) {
+        // Lossy reset racing concurrent increments is fine; the counters
+        // only gate promotion.
+        for (size_t i = 0; i < _capacity; ++i) {
+          _counts[i].store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+  int AcquireReaderSlot() {
+    thread_local int cached_slot = -1;
+    if (cached_slot >= 0) {
+      return cached_slot;
+    }
+    std::lock_guard<std::mutex> guard(_reader_slot_mutex);
+    if (_free_reader_slots.empty()) {
+      return -1;
+    }
+    cached_slot = _free_reader_slots.back();
+    _free_reader_slots.pop_back();
+    return cached_slot;
+  }
+
+  void ReleaseReaderSlot(int slot) {
+    // Slots stay bound to their thread (thread_local above); nothing to do
+    // per guard. Kept as a hook so the guard's lifetime is explicit.
+    (void)slot;
+  }
+
+  size_t _capacity;
+  uint32_t _promote_threshold;
+  uint64_t _count_window;
+  std::unique_ptr<Entry[]> _entries;
+  std::unique_ptr<std::atomic<uint32_t>[]> _counts;
+  std::atomic<uint64_t> _accesses{0};
+
+  std::mutex _write_mutex;
+
+  ReaderSlot _reader_slots[kReaderSlots];
+  std::mutex _reader_slot_mutex;
+  std::vector<int> _free_reader_slots;
+
+  std::atomic<uint64_t> _global_epoch{1};
+  std::mutex _retire_mutex;
+  std::vector<std::pair<uint64_t, CachedValue *>> _retired;
+};
+
+}  // namespace distributed
+}  // namespace paddle
@@ -38,6 +38,17 @@ PD_DEFINE_bool(pserver_enable_create_feasign_randomly,
 PD_DEFINE_int32(pserver_table_save_max_retry,
                 3,
                 "pserver_table_save_max_retry");
+PD_DEFINE_bool(pserver_enable_hot_key_cache,
+               false,
+               "serve the hottest keys from a lock-free cache in front of "
+               "the sparse shards");
+PD_DEFINE_int32(pserver_hot_key_cache_capacity,
+                65536,
+                "slot count of the hot key cache");
+PD_DEFINE_int32(pserver_hot_key_cache_promote_threshold,
+                100,
+                "pulls within one counting window before a key is promoted "
+                "into the hot key cache");
 
 namespace paddle::distributed {
 
@@ -50,6 +61,14 @@ int32_t MemorySparseTable::Initialize() {
   for (auto &shards_task : _shards_task_pool) {
     shards_task.reset(new ::ThreadPool(1));
   }
+  if (FLAGS_pserver_enable_hot_key_cache) {
+    _hot_key_cache.reset(
+        new HotKeyCache(FLAGS_pserver_hot_key_cache_capacity,
+                        FLAGS_pserver_hot_key_cache_promote_threshold));
+    VLOG(0) << "MemorySparseTable hot key cache enabled, capacity: "
+            << FLAGS_pserver_hot_key_cache_capacity << " promote_threshold: "
+            << FLAGS_pserver_hot_key_cache_promote_threshold;
+  }
   VLOG(0) << "initalize MemorySparseTable succ";
   return 0;
 }
@@ -307,6 +326,9 @@ void MemorySparseTable::Revert() {
   for (int i = 0; i < _real_local_shard_num; ++i) {
     _local_shards_new[i].clear();
   }
+  if (_hot_key_cache != nullptr) {
+    _hot_key_cache->Clear();
+  }
 }
 
 void MemorySparseTable::CheckSavePrePatchDone() {
@@ -989,10 +1011,29 @@ int32_t MemorySparseTable::PullSparse(float *pull_values,
   std::vector<std::vector<std::pair<uint64_t, int>>> task_keys(
       _real_local_shard_num);
   size_t num = pull_value.numel_;
+  // Hot keys are answered directly on the pull thread from the cache; only
+  // the misses fan out to the shard task queues.
+  HotKeyCache::ReadGuard cache_guard(_hot_key_cache.get());
+  float cache_buffer[value_size];  // NOLINT
+  float *cache_buffer_ptr = cache_buffer;
   for (size_t i = 0; i < num; ++i) {
-    int shard_id = (pull_value.feasigns_[i] % _sparse_table_shard_num) %
-                   _avg_local_shard_num;
-    task_keys[shard_id].push_back({pull_value.feasigns_[i], i});
+    uint64_t key = pull_value.feasigns_[i];
+    if (_hot_key_cache != nullptr) {
+      size_t cached_size = 0;
+      if (_hot_key_cache->Lookup(
+              cache_guard, key, cache_buffer, value_size, &cached_size) &&
+          cached_size <= value_size) {
+        for (size_t mf_idx = cached_size; mf_idx < value_size; ++mf_idx) {
+          cache_buffer[mf_idx] = 0.0;
+        }
+        float *select_data = pull_values + select_value_size * i;
+        _value_accessor->Select(
+            &select_data, (const float **)&cache_buffer_ptr, 1);
+        continue;
+      }
+    }
+    int shard_id = (key % _sparse_table_shard_num) % _avg_local_shard_num;
+    task_keys[shard_id].push_back({key, i});
   }
   for (int shard_id = 0; shard_id < _real_local_shard_num; ++shard_id) {
     tasks[shard_id] =
@@ -1030,6 +1071,10 @@ int32_t MemorySparseTable::PullSparse(float *pull_values,
                   memcpy(data_buffer_ptr,
                          itr.value().data(),
                          data_size * sizeof(float));
+                  if (_hot_key_cache != nullptr) {
+                    _hot_key_cache->RecordAccess(
+                        key, itr.value().data(), data_size);
+                  }
                 }
                 for (size_t mf_idx = data_size; mf_idx < value_size; ++mf_idx) {
                   data_buffer[mf_idx] = 0.0;
@@ -1181,6 +1226,9 @@ int32_t MemorySparseTable::PushSparse(const uint64_t *keys,
               }
               memcpy(value_data, data_buffer_ptr, value_size * sizeof(float));
             }
+            if (_hot_key_cache != nullptr) {
+              _hot_key_cache->Invalidate(key);
+            }
             if (_config.enable_revert()) {
               FixedFeatureValue *feature_value_new = &(local_shard_new[key]);
               auto new_size = feature_value.size();
@@ -1257,6 +1305,9 @@ int32_t MemorySparseTable::PushSparse(const uint64_t *keys,
               }
               memcpy(value_data, data_buffer_ptr, value_size * sizeof(float));
             }
+            if (_hot_key_cache != nullptr) {
+              _hot_key_cache->Invalidate(key);
+            }
           }
           return 0;
         });
@@ -1290,6 +1341,11 @@ int32_t MemorySparseTable::Shrink(const std::string &param) {
     }
     shrink_size_all += feasign_size;
   }
+  // Shrunk keys may still be cached; drop all cached copies so they get
+  // re-promoted from live shard entries only.
+  if (_hot_key_cache != nullptr) {
+    _hot_key_cache->Clear();
+  }
   VLOG(0) << "MemorySparseTable::Shrink success, shrink size:"
           << shrink_size_all;
   return 0;
@@ -29,6 +29,7 @@
 #include "paddle/fluid/distributed/ps/table/accessor.h"
 #include "paddle/fluid/distributed/ps/table/common_table.h"
 #include "paddle/fluid/distributed/ps/table/depends/feature_value.h"
+#include "paddle/fluid/distributed/ps/table/depends/hot_key_cache.h"
 #include "paddle/utils/string/string_helper.h"
 
 #define PSERVER_SAVE_SUFFIX ".shard"
@@ -125,6 +126,10 @@ class MemorySparseTable : public Table {
   int _sparse_table_shard_num;
   std::vector<std::shared_ptr<::ThreadPool>> _shards_task_pool;
   std::unique_ptr<shard_type[]> _local_shards;
+  // Lock-free read-mostly cache for the hottest keys, so pull storms on a
+  // few feasigns stop serializing on the shard task queues. Enabled via
+  // FLAGS_pserver_enable_hot_key_cache.
+  std::unique_ptr<HotKeyCache> _hot_key_cache;
 
   // for patch model
   int _m_avg_local_shard_num;
@@ -178,6 +178,52 @@ int32_t SSDSparseTable::PullSparse(float* pull_values,
   return 0;
 }
 
+int32_t SSDSparseTable::Prefetch(const uint64_t* keys, size_t num) {
+  CostTimer timer("pserver_ssd_sparse_prefetch");
+  auto task_keys = std::make_shared<std::vector<std::vector<uint64_t>>>();
+  task_keys->resize(_real_local_shard_num);
+  for (size_t i = 0; i < num; ++i) {
+    int shard_id = (keys[i] % _sparse_table_shard_num) % _avg_local_shard_num;
+    (*task_keys)[shard_id].push_back(keys[i]);
+  }
+  for (int shard_id = 0; shard_id < _real_local_shard_num; ++shard_id) {
+    if ((*task_keys)[shard_id].empty()) {
+      continue;
+    }
+    // Fire-and-forget: the per-shard pools are single threaded, so a pull
+    // arriving while the prefetch still runs queues behind it and then hits
+    // memory instead of rocksdb.
+    _shards_task_pool[shard_id % _shards_task_pool.size()]->enqueue(
+        [this, shard_id, task_keys]() -> int {
+          auto& shard_keys = (*task_keys)[shard_id];
+          auto& local_shard = _local_shards[shard_id];
+          for (uint64_t key : shard_keys) {
+            auto itr = local_shard.find(key);
+            if (itr != local_shard.end()) {
+              continue;  // already resident
+            }
+            std::string tmp_string("");
+            if (_db->get(shard_id,
+                         reinterpret_cast<char*>(&key),
+                         sizeof(uint64_t),
+                         tmp_string) > 0) {
+              continue;  // not on ssd either; the pull path will create it
+            }
+            size_t data_size = tmp_string.size() / sizeof(float);
+            auto& feature_value = local_shard[key];
+            feature_value.resize(data_size);
+            memcpy(const_cast<float*>(feature_value.data()),
+                   ::paddle::string::str_to_float(tmp_string),
+                   data_size * sizeof(float));
+            _db->del_data(
+                shard_id, reinterpret_cast<char*>(&key), sizeof(uint64_t));
+          }
+          return 0;
+        });
+  }
+  return 0;
+}
+
 int32_t SSDSparseTable::PullSparsePtr(int shard_id,
                                       char** pull_values,
                                       const uint64_t* pull_keys,
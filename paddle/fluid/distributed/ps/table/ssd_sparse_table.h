@@ -78,6 +78,9 @@ class SSDSparseTable : public MemorySparseTable {
                         const uint64_t* keys,
                         size_t num,
                         uint16_t pass_id);
+  // warm keys of an upcoming pull from rocksdb into the memory shards in the
+  // background, so the pull itself never waits on SSD reads
+  int32_t Prefetch(const uint64_t* keys, size_t num) override;
   int32_t PushSparse(const uint64_t* keys, const float* values, size_t num);
   int32_t PushSparse(const uint64_t* keys, const float** values, size_t num);
 
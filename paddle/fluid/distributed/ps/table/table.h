@@ -77,6 +77,12 @@ class Table {
   virtual int32_t Pull(TableContext &context) = 0;  // NOLINT
   virtual int32_t Push(TableContext &context) = 0;  // NOLINT
 
+  // hint that these keys will be pulled soon; tiered tables warm them from
+  // slow storage in the background, others ignore it
+  virtual int32_t Prefetch(const uint64_t *keys UNUSED, size_t num UNUSED) {
+    return 0;
+  }
+
   // only for barrier
   virtual int32_t Barrier(const uint32_t trainer_id UNUSED,
                           const std::string barrier_type UNUSED) {
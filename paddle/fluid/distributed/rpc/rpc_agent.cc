@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "paddle/fluid/platform/enforce.h"
+#include "paddle/fluid/platform/place.h"
 
 namespace paddle::distributed {
 
@@ -50,6 +51,11 @@ int RpcAgent::StartWorker() {
   // Start the server.
   int port = info.port_;
   brpc::ServerOptions options;
+#if BRPC_WITH_RDMA
+  // brpc registers attachment memory with the RDMA device itself, so tensor
+  // buffers shipped via InvokeTensorRpc go out without staging copies.
+  options.use_rdma = true;
+#endif
   PADDLE_ENFORCE_EQ(server_.Start(port, &options),
                     0,
                     platform::errors::Fatal("Fail to start worker: %s", name_));
@@ -65,6 +71,9 @@ int RpcAgent::StartClient() {
   channel_options.connection_type = "pooled";
   channel_options.connect_timeout_ms = kConnectTimeoutMs;
   channel_options.max_retry = kMaxRetry;
+#if BRPC_WITH_RDMA
+  channel_options.use_rdma = true;
+#endif
   channels_.resize(name_to_infos_.size());
   // build connection from client to all servers
   for (std::size_t i = 0; i < channels_.size(); i++) {
@@ -103,6 +112,19 @@ void OnRpcDone::Run() {
           << " latency=" << cntl_.latency_us() << "us";
 }
 
+void OnTensorRpcDone::Run() {
+  // delete this after Run
+  std::unique_ptr<OnTensorRpcDone> self_guard(this);
+  PADDLE_ENFORCE_EQ(
+      cntl_.Failed(), false, platform::errors::Fatal(cntl_.ErrorText()));
+  promise_->set_value(
+      TensorFromMetaAndIOBuf(response_.meta(), cntl_.response_attachment()));
+  VLOG(2) << "Received tensor response from " << cntl_.remote_side() << " to "
+          << cntl_.local_side()
+          << " (attachment bytes=" << cntl_.response_attachment().size() << ")"
+          << " latency=" << cntl_.latency_us() << "us";
+}
+
 std::future<std::string> RpcAgent::InvokeRpc(const std::string &py_func,
                                              const std::string &to,
                                              int timeout_ms = kTimeoutMs) {
@@ -124,6 +146,42 @@ std::future<std::string> RpcAgent::InvokeRpc(const std::string &py_func,
   return fut;
 }
 
+std::future<phi::DenseTensor> RpcAgent::InvokeTensorRpc(
+    const phi::DenseTensor &tensor,
+    const std::string &to,
+    int timeout_ms = kTimeoutMs) {
+  auto it = name_to_infos_.find(to);
+  PADDLE_ENFORCE_NE(
+      it,
+      name_to_infos_.end(),
+      platform::errors::OutOfRange("Worker %s doesn't exist!", to));
+  PADDLE_ENFORCE_EQ(
+      platform::is_cpu_place(tensor.place()),
+      true,
+      platform::errors::InvalidArgument(
+          "InvokeTensorRpc ships the tensor buffer as a brpc attachment and "
+          "requires a CPU tensor; copy device tensors to host first."));
+  uint32_t id = it->second.id_;
+  auto channel = channels_[id];
+  // `done` must be allocated on the heap because its life cycle is after
+  // calling done.Run().
+  OnTensorRpcDone *done = new OnTensorRpcDone;
+  done->cntl_.set_timeout_ms(timeout_ms);
+  FillTensorMeta(tensor, done->request_.mutable_meta());
+  size_t bytes = tensor.numel() * phi::SizeOf(tensor.dtype());
+  if (bytes > 0) {
+    // Copy-free send: the attachment references the tensor's buffer, and
+    // the pin registry keeps the allocation alive until brpc has finished
+    // writing it to the socket.
+    done->cntl_.request_attachment().append_user_data(
+        PinTensorForIOBuf(tensor), bytes, &UnpinTensorBuffer);
+  }
+  std::future<phi::DenseTensor> fut = done->GetFuture();
+  RpcBaseService_Stub stub(channel.get());
+  stub.SendTensor(&done->cntl_, &done->request_, &done->response_, done);
+  return fut;
+}
+
 std::shared_ptr<RpcAgent> RpcAgent::RpcAgentInstance() {
   PADDLE_ENFORCE_NE(rpc_agent_instance_,
                     nullptr,
@@ -59,6 +59,22 @@ class OnRpcDone : public google::protobuf::Closure {
   std::shared_ptr<std::promise<std::string>> promise_;
 };
 
+class OnTensorRpcDone : public google::protobuf::Closure {
+ public:
+  OnTensorRpcDone() {
+    promise_ = std::make_shared<std::promise<phi::DenseTensor>>();
+  }
+  // process callback of response
+  void Run();
+  std::future<phi::DenseTensor> GetFuture() {
+    return std::future<phi::DenseTensor>(promise_->get_future());
+  }
+  TensorRpcResponse response_;
+  TensorRpcRequest request_;
+  brpc::Controller cntl_;
+  std::shared_ptr<std::promise<phi::DenseTensor>> promise_;
+};
+
 class RpcAgent {
  public:
   static std::shared_ptr<RpcAgent> RpcAgentInstance();
@@ -95,6 +111,16 @@ class RpcAgent {
                                      const std::string &to,
                                      int timeout_ms);
 
+  // Zero-copy tensor send: only shape and dtype go through protobuf, the
+  // buffer itself rides as the brpc attachment referencing the tensor's
+  // allocation, so multi-MB payloads are not serialized at all. Requires a
+  // CPU tensor; the buffer is kept alive until brpc has written it out.
+  // The future resolves to the tensor returned by the remote handler (see
+  // RpcService::SetTensorHandler).
+  std::future<phi::DenseTensor> InvokeTensorRpc(const phi::DenseTensor &tensor,
+                                                const std::string &to,
+                                                int timeout_ms);
+
  private:
   DISABLE_COPY_AND_ASSIGN(RpcAgent);
   static std::shared_ptr<RpcAgent> rpc_agent_instance_;
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/distributed/rpc/rpc_service.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "paddle/fluid/framework/convert_utils.h"
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle::distributed {
+
+namespace {
+std::mutex handler_mutex;
+TensorRpcHandler tensor_rpc_handler = nullptr;
+
+// Buffers handed to brpc via append_user_data stay referenced by the IOBuf
+// until the socket finishes writing them, which can be after the service
+// callback or the caller's frame has returned. Holding a copy of the tensor
+// here (the copy shares the allocation, it does not duplicate the bytes)
+// pins the allocation until brpc invokes the deleter. A multimap so that
+// the same buffer can be in flight on several RPCs at once.
+std::mutex pinned_mutex;
+std::unordered_multimap<void *, phi::DenseTensor> pinned_tensors;
+}  // namespace
+
+void RpcService::SetTensorHandler(TensorRpcHandler handler) {
+  std::lock_guard<std::mutex> guard(handler_mutex);
+  tensor_rpc_handler = std::move(handler);
+}
+
+TensorRpcHandler RpcService::GetTensorHandler() {
+  std::lock_guard<std::mutex> guard(handler_mutex);
+  return tensor_rpc_handler;
+}
+
+void *PinTensorForIOBuf(const phi::DenseTensor &tensor) {
+  void *data = const_cast<void *>(tensor.data());
+  std::lock_guard<std::mutex> guard(pinned_mutex);
+  pinned_tensors.emplace(data, tensor);
+  return data;
+}
+
+void UnpinTensorBuffer(void *data) {
+  std::lock_guard<std::mutex> guard(pinned_mutex);
+  auto it = pinned_tensors.find(data);
+  if (it != pinned_tensors.end()) {
+    pinned_tensors.erase(it);
+  }
+}
+
+void FillTensorMeta(const phi::DenseTensor &tensor, TensorMeta *meta) {
+  meta->set_dtype(static_cast<int32_t>(
+      framework::TransToProtoVarType(tensor.dtype())));
+  for (auto &dim : common::vectorize(tensor.dims())) {
+    meta->add_dims(dim);
+  }
+}
+
+phi::DenseTensor TensorFromMetaAndIOBuf(const TensorMeta &meta,
+                                        const butil::IOBuf &iobuf) {
+  phi::DenseTensor tensor;
+  std::vector<int64_t> dims(meta.dims().begin(), meta.dims().end());
+  tensor.Resize(common::make_ddim(dims));
+  auto dtype = framework::TransToPhiDataType(
+      static_cast<framework::proto::VarType::Type>(meta.dtype()));
+  void *data = tensor.mutable_data(phi::CPUPlace(), dtype);
+  size_t bytes = tensor.numel() * phi::SizeOf(dtype);
+  PADDLE_ENFORCE_EQ(
+      iobuf.size(),
+      bytes,
+      platform::errors::InvalidArgument(
+          "Tensor attachment carries %d bytes but the metadata describes a "
+          "tensor of %d bytes.",
+          iobuf.size(),
+          bytes));
+  iobuf.copy_to(data, bytes);
+  return tensor;
+}
+
+}  // namespace paddle::distributed
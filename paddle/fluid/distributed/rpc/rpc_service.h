@@ -16,13 +16,34 @@
 
 #include <brpc/server.h>
 
+#include <functional>
 #include <string>
 
 #include "paddle/fluid/distributed/rpc/python_rpc_handler.h"
 #include "paddle/fluid/distributed/rpc/rpc.pb.h"
+#include "paddle/phi/common/data_type.h"
+#include "paddle/phi/core/dense_tensor.h"
 
 namespace paddle {
 namespace distributed {
+// Server-side callback for SendTensor. Receives the deserialized CPU tensor
+// and returns the tensor to ship back; when none is registered the input is
+// echoed back unchanged.
+using TensorRpcHandler = std::function<phi::DenseTensor(const phi::DenseTensor &)>;
+
+// Keeps the tensor's allocation alive while brpc still references its buffer
+// from an IOBuf; returns the buffer pointer to pass to append_user_data.
+// UnpinTensorBuffer is the matching IOBuf deleter.
+void *PinTensorForIOBuf(const phi::DenseTensor &tensor);
+void UnpinTensorBuffer(void *data);
+
+void FillTensorMeta(const phi::DenseTensor &tensor, TensorMeta *meta);
+// Rebuilds a CPU tensor from the proto metadata and the attachment bytes.
+// The single copy here (socket buffers -> tensor) is the only one on the
+// whole receive path.
+phi::DenseTensor TensorFromMetaAndIOBuf(const TensorMeta &meta,
+                                        const butil::IOBuf &iobuf);
+
 class RpcService : public RpcBaseService {
  public:
   RpcService() {}
@@ -51,6 +72,36 @@ class RpcService : public RpcBaseService {
     std::string res_str = python_handler->Serialize(res);
     response->set_message(res_str);
   }
+
+  virtual void SendTensor(google::protobuf::RpcController *cntl_base,
+                          const TensorRpcRequest *request,
+                          TensorRpcResponse *response,
+                          google::protobuf::Closure *done) {
+    brpc::ClosureGuard done_guard(done);
+
+    brpc::Controller *cntl = static_cast<brpc::Controller *>(cntl_base);
+    VLOG(2) << "SendTensor API: Received request[log_id=" << cntl->log_id()
+            << "] from " << cntl->remote_side() << " to " << cntl->local_side()
+            << " (attachment bytes=" << cntl->request_attachment().size()
+            << ")";
+    phi::DenseTensor in_tensor =
+        TensorFromMetaAndIOBuf(request->meta(), cntl->request_attachment());
+    TensorRpcHandler handler = GetTensorHandler();
+    phi::DenseTensor out_tensor =
+        handler ? handler(in_tensor) : in_tensor;
+    FillTensorMeta(out_tensor, response->mutable_meta());
+    size_t bytes = out_tensor.numel() * phi::SizeOf(out_tensor.dtype());
+    if (bytes > 0) {
+      // The attachment references the tensor's buffer directly; the pin
+      // registry keeps the allocation alive until the socket has written
+      // it out and brpc calls the deleter.
+      cntl->response_attachment().append_user_data(
+          PinTensorForIOBuf(out_tensor), bytes, &UnpinTensorBuffer);
+    }
+  }
+
+  static void SetTensorHandler(TensorRpcHandler handler);
+  static TensorRpcHandler GetTensorHandler();
 };
 }  // namespace distributed
 }  // namespace paddle
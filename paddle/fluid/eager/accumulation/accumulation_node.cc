@@ -215,11 +215,18 @@ GradNodeAccumulation::operator()(
 
 void GradNodeAccumulation::RegisterReduceHook(
     std::shared_ptr<VoidHook>&& hook) {
-  reduce_hooks_.emplace_back(std::move(hook));
+  if (!reduce_hooks_) {
+    reduce_hooks_ = std::make_unique<
+        paddle::small_vector<std::shared_ptr<VoidHook>, 2>>();
+  }
+  reduce_hooks_->emplace_back(std::move(hook));
 }
 
 void GradNodeAccumulation::ApplyReduceHooks() {
-  for (auto& hook : reduce_hooks_) {
+  if (!reduce_hooks_) {
+    return;
+  }
+  for (auto& hook : *reduce_hooks_) {
     (*hook)();
   }
 }
@@ -57,7 +57,7 @@ class TEST_API GradNodeAccumulation : public GradNodeBase {
   /**
    * Apply ReduceHook here
    * **/
-  inline bool ReduceHooksRegistered() { return reduce_hooks_.size() != 0; }
+  inline bool ReduceHooksRegistered() { return reduce_hooks_ != nullptr; }
   void ApplyReduceHooks();
 
   std::shared_ptr<GradNodeBase> Copy() const override {
@@ -71,7 +71,9 @@ class TEST_API GradNodeAccumulation : public GradNodeBase {
   // TODO(Jiabin): remove this when we make our clear gradient really cleared;
   bool is_fake_empty_ = {false};
   std::weak_ptr<paddle::Tensor> weak_grad_;
-  std::vector<std::shared_ptr<VoidHook>> reduce_hooks_;
+  // Null unless a reduce hook was registered; probed on every accumulation.
+  std::unique_ptr<paddle::small_vector<std::shared_ptr<VoidHook>, 2>>
+      reduce_hooks_;
   std::function<paddle::Tensor(const paddle::Tensor&)> retain_grad_hook_;
 };
 
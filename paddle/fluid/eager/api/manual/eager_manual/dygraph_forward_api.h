@@ -55,6 +55,25 @@ paddle::Tensor reshard_ad_function(
     const paddle::Tensor& tensor,
     const phi::distributed::TensorDistAttr dist_attr);
 
+// Foreach-style batched entry points: a whole tensor list goes through one
+// dispatch, with the per-element eager functions looped over in C++. The
+// inplace variants mutate the list elements and return nothing.
+std::vector<paddle::Tensor> foreach_scale_ad_func(
+    const std::vector<paddle::Tensor>& x,
+    float scale,
+    float bias,
+    bool bias_after_scale);
+void foreach_scale__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                            float scale,
+                            float bias,
+                            bool bias_after_scale);
+std::vector<paddle::Tensor> foreach_add_ad_func(
+    const std::vector<paddle::Tensor>& x, const std::vector<paddle::Tensor>& y);
+void foreach_add__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                          const std::vector<paddle::Tensor>& y);
+void foreach_multiply__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                               const std::vector<paddle::Tensor>& y);
+
 namespace sparse {
 std::tuple<paddle::Tensor,
            paddle::Tensor&,
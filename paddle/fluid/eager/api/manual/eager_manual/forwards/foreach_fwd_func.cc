@@ -0,0 +1,106 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/eager/api/generated/eager_generated/forwards/dygraph_functions.h"
+#include "paddle/fluid/eager/api/manual/eager_manual/dygraph_forward_api.h"
+#include "paddle/fluid/platform/enforce.h"
+#include "paddle/fluid/platform/profiler/event_tracing.h"
+
+// Foreach-style batched entry points. Optimizer and EMA update loops issue
+// one eager call per parameter, so a model with thousands of parameters pays
+// thousands of Python -> C++ transitions per step. These wrappers take the
+// whole tensor list through a single dispatch and run the per-tensor eager
+// functions in one C++ loop (with the GIL already released by the binding);
+// each element keeps full autograd/AMP handling from the function it
+// delegates to. Dedicated multi-tensor kernels (merged_adam_,
+// merged_momentum_) remain the right tool where they exist.
+
+namespace {
+
+void CheckForeachListSizes(const std::vector<paddle::Tensor>& x,
+                           const std::vector<paddle::Tensor>& y,
+                           const char* api_name) {
+  PADDLE_ENFORCE_EQ(
+      x.size(),
+      y.size(),
+      paddle::platform::errors::InvalidArgument(
+          "%s expects both tensor lists to have the same length, "
+          "but received %d and %d.",
+          api_name,
+          x.size(),
+          y.size()));
+}
+
+}  // namespace
+
+std::vector<paddle::Tensor> foreach_scale_ad_func(
+    const std::vector<paddle::Tensor>& x,
+    float scale,
+    float bias,
+    bool bias_after_scale) {
+  paddle::platform::RecordEvent dygraph_entrance_record_event(
+      "foreach_scale dygraph", paddle::platform::TracerEventType::Operator, 1);
+  std::vector<paddle::Tensor> out;
+  out.reserve(x.size());
+  for (auto& t : x) {
+    out.push_back(::scale_ad_func(t, scale, bias, bias_after_scale));
+  }
+  return out;
+}
+
+void foreach_scale__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                            float scale,
+                            float bias,
+                            bool bias_after_scale) {
+  paddle::platform::RecordEvent dygraph_entrance_record_event(
+      "foreach_scale_ dygraph", paddle::platform::TracerEventType::Operator, 1);
+  for (auto& t : x) {
+    ::scale__ad_func(t, scale, bias, bias_after_scale);
+  }
+}
+
+std::vector<paddle::Tensor> foreach_add_ad_func(
+    const std::vector<paddle::Tensor>& x, const std::vector<paddle::Tensor>& y) {
+  paddle::platform::RecordEvent dygraph_entrance_record_event(
+      "foreach_add dygraph", paddle::platform::TracerEventType::Operator, 1);
+  CheckForeachListSizes(x, y, "foreach_add");
+  std::vector<paddle::Tensor> out;
+  out.reserve(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    out.push_back(::add_ad_func(x[i], y[i]));
+  }
+  return out;
+}
+
+void foreach_add__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                          const std::vector<paddle::Tensor>& y) {
+  paddle::platform::RecordEvent dygraph_entrance_record_event(
+      "foreach_add_ dygraph", paddle::platform::TracerEventType::Operator, 1);
+  CheckForeachListSizes(x, y, "foreach_add_");
+  for (size_t i = 0; i < x.size(); ++i) {
+    ::add__ad_func(x[i], y[i]);
+  }
+}
+
+void foreach_multiply__ad_func(std::vector<paddle::Tensor>& x,  // NOLINT
+                               const std::vector<paddle::Tensor>& y) {
+  paddle::platform::RecordEvent dygraph_entrance_record_event(
+      "foreach_multiply_ dygraph",
+      paddle::platform::TracerEventType::Operator,
+      1);
+  CheckForeachListSizes(x, y, "foreach_multiply_");
+  for (size_t i = 0; i < x.size(); ++i) {
+    multiply__ad_func(x[i], y[i]);
+  }
+}
@@ -69,15 +69,15 @@ def FindParsingFunctionFromAttributeType(atype):
 # Refactored Functions #
 ########################
 PARSE_PYTHON_C_TENSORS_TEMPLATE = (
-    "    auto {} = {}(\"{}\", \"{}\", args, {}, {});\n"
+    "    auto {} = {}(\"{}\", \"{}\", args, nargs, {}, {});\n"
 )
 
 PARSE_PYTHON_C_TENSOR_REF_TEMPLATE = (
-    "    auto& {} = {}(\"{}\", \"{}\", args, {}, {});\n"
+    "    auto& {} = {}(\"{}\", \"{}\", args, nargs, {}, {});\n"
 )
 
 CONVERT_TO_DISTTENSOR_AND_PARSE_PYTHON_C_TENSORS_TEMPLATE = (
-    "    {} = {}(\"{}\", \"{}\", args, {}, {}, mesh);\n"
+    "    {} = {}(\"{}\", \"{}\", args, nargs, {}, {}, mesh);\n"
 )
 
 CONVERT_INPUT_TENSORS_TO_DIST_TENSOR_WITH_SINGLE_TENSOR_TEMPLATE = """
@@ -95,8 +95,8 @@ CONVERT_INPUT_TENSORS_TO_DIST_TENSOR_WITHOUT_SINGLE_TENSOR_TEMPLATE = """
     }}
 """
 
-PARSE_PYTHON_C_ARGS_TEMPLATE = """    PyObject* {}_obj = PyTuple_GET_ITEM(args, {});
-    {} {} = {}({}_obj, \"{}\", {});
+PARSE_PYTHON_C_ARGS_TEMPLATE = """    PyObject* {0}_obj = (nargs > {1}) ? args[{1}] : nullptr;
+    {2} {3} = {4}({5}_obj, \"{6}\", {7});
 """
 
 
@@ -109,13 +109,13 @@ RETURN_INPLACE_PYOBJECT_TEMPLATE = """
 
 
 PYTHON_C_FUNCTION_TEMPLATE = """
-PyObject * eager_api_{}(PyObject *self, PyObject *args, PyObject *kwargs) {{
+PyObject * eager_api_{}(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames) {{
   {}
   PyThreadState *tstate = nullptr;
   try {{
     VLOG(6) << "Running Eager Final State API: {}";
 
-    VLOG(8) << "args count: " << (PyTuple_Size(args) / 2);
+    VLOG(8) << "args count: " << nargs;
     // Get EagerTensors from args
 {}
     // Parse Attributes if needed
@@ -177,7 +177,7 @@ FUNCTION_SET_DEVICE_TEMPLATE = """{}
 FUNCTION_NAME_TEMPLATE = "{}{}{}"
 
 
-PYTHON_C_FUNCTION_REG_TEMPLATE = "  {{\"{}{}\", (PyCFunction)(void(*)(void)) {}eager_api_{}, METH_VARARGS | METH_KEYWORDS, \"C++ interface function for {} in dygraph.\"}},\n"
+PYTHON_C_FUNCTION_REG_TEMPLATE = "  {{\"{}{}\", (PyCFunction)(void(*)(void)) {}eager_api_{}, METH_FASTCALL | METH_KEYWORDS, \"C++ interface function for {} in dygraph.\"}},\n"
 
 
 PYTHON_C_WRAPPER_TEMPLATE = """
@@ -294,7 +294,7 @@ namespace pybind {{
 """
 
 PYTHON_C_FUNCTION_DECLARE_TEMPLATE = """
-PyObject *eager_api_{name}(PyObject *self, PyObject *args, PyObject *kwargs);
+PyObject *eager_api_{name}(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
 """
 
 
@@ -68,6 +68,15 @@ class AutogradMeta : public AbstractAutogradMeta {
 
   ~AutogradMeta() override = default;
 
+  // Recycled through the same per-thread freelist as grad nodes; one
+  // AutogradMeta is created per traced tensor, so the churn is comparable.
+  static void* operator new(std::size_t size) {
+    return AutogradObjectPool::ThreadLocal().Allocate(size);
+  }
+  static void operator delete(void* ptr, std::size_t size) {
+    AutogradObjectPool::ThreadLocal().Deallocate(ptr, size);
+  }
+
   const paddle::Tensor& Grad() const {
     PADDLE_ENFORCE_NOT_NULL(
         grad_.get(),
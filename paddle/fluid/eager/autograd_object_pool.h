@@ -0,0 +1,102 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace egr {
+
+/**
+ * Per-thread freelist recycler for the small fixed-size autograd objects
+ * (GradNode subclasses, AutogradMeta) that eager mode creates and destroys
+ * on every forward/backward pair. Blocks are rounded up to a size class and
+ * cached on free instead of returning to the global allocator, so steady
+ * state training stops issuing malloc/free for graph bookkeeping.
+ *
+ * Freeing on a different thread than the allocating one is fine: blocks
+ * simply migrate to the freeing thread's cache. Cached blocks are released
+ * to the allocator when a class's cache is full, when the thread exits, or
+ * explicitly via ReleaseCached(). There is deliberately no bulk "reset":
+ * accumulation nodes of leaf tensors and retained graphs outlive step
+ * boundaries, so object lifetime must stay individually tracked.
+ *
+ * Only the plain (not over-aligned) allocation path is pooled; types with
+ * extended alignment fall through to the aligned global operator new.
+ */
+class AutogradObjectPool {
+ public:
+  static constexpr size_t kGranularity = 64;        // size-class step, bytes
+  static constexpr size_t kNumClasses = 16;         // pools blocks <= 1 KiB
+  static constexpr size_t kMaxCachedPerClass = 8192;
+
+  static AutogradObjectPool& ThreadLocal() {
+    static thread_local AutogradObjectPool pool;
+    return pool;
+  }
+
+  void* Allocate(size_t bytes) {
+    size_t size_class = ClassOf(bytes);
+    if (size_class >= kNumClasses) {
+      return ::operator new(bytes);
+    }
+    auto& free_list = free_lists_[size_class];
+    if (!free_list.empty()) {
+      void* ptr = free_list.back();
+      free_list.pop_back();
+      return ptr;
+    }
+    return ::operator new((size_class + 1) * kGranularity);
+  }
+
+  void Deallocate(void* ptr, size_t bytes) {
+    size_t size_class = ClassOf(bytes);
+    if (size_class >= kNumClasses) {
+      ::operator delete(ptr);
+      return;
+    }
+    auto& free_list = free_lists_[size_class];
+    if (free_list.size() >= kMaxCachedPerClass) {
+      ::operator delete(ptr);
+      return;
+    }
+    free_list.push_back(ptr);
+  }
+
+  // Hand all cached blocks back to the global allocator.
+  void ReleaseCached() {
+    for (auto& free_list : free_lists_) {
+      for (void* ptr : free_list) {
+        ::operator delete(ptr);
+      }
+      free_list.clear();
+    }
+  }
+
+  ~AutogradObjectPool() { ReleaseCached(); }
+
+ private:
+  AutogradObjectPool() = default;
+
+  static size_t ClassOf(size_t bytes) {
+    return bytes == 0 ? 0 : (bytes - 1) / kGranularity;
+  }
+
+  std::array<std::vector<void*>, kNumClasses> free_lists_;
+};
+
+}  // namespace egr
@@ -14,12 +14,112 @@
 
 #include "paddle/fluid/eager/backward.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "paddle/common/flags.h"
 #include "paddle/fluid/eager/general_grad.h"
 #include "paddle/fluid/memory/stats.h"
+#include "paddle/fluid/platform/flags.h"
 #include "paddle/phi/kernels/autotune/switch_autotune.h"
 
+PADDLE_DEFINE_EXPORTED_bool(
+    enable_parallel_backward,
+    false,
+    "Run ready grad nodes on a small worker pool instead of one at a time. "
+    "Nodes whose inputs live on the same place stay on the same worker, so "
+    "per-stream ordering is preserved; independent branches on different "
+    "places run concurrently.");
+
+PADDLE_DEFINE_EXPORTED_int32(parallel_backward_workers,
+                             4,
+                             "Number of worker threads used when "
+                             "enable_parallel_backward is set.");
+
+PADDLE_DEFINE_EXPORTED_bool(
+    enable_backward_plan_cache,
+    true,
+    "Cache the backward graph discovery (topological in-degree counts) keyed "
+    "by the startup grad nodes, so replaying an identical graph skips the "
+    "full-graph traversal on every backward call.");
+
 namespace egr {
 
+namespace {
+
+// Training loops replay the same backward graph every step, yet RunBackward
+// re-traverses the whole graph to rebuild the in-degree map each time. The
+// plan cache keeps that map per set of startup nodes. A cached plan refers
+// to nodes by raw pointer, so it is only trusted while no GradNodeBase has
+// been destroyed since the plan was recorded (tracked through
+// GradNodeGraphGeneration); new nodes attached to the graph are harmless
+// because traversal from the cached startup nodes never reaches them.
+struct BackwardPlan {
+  uint64_t generation;
+  std::vector<std::pair<GradNodeBase*, int>> in_degrees;
+};
+
+std::mutex backward_plan_mutex;
+std::unordered_map<size_t, BackwardPlan>& BackwardPlanCache() {
+  static std::unordered_map<size_t, BackwardPlan> cache;
+  return cache;
+}
+
+size_t HashStartupNodes(const std::deque<GradNodeBase*>& queue) {
+  size_t seed = queue.size();
+  for (GradNodeBase* node : queue) {
+    // boost-style hash combine over the node addresses
+    seed ^= std::hash<GradNodeBase*>()(node) + 0x9e3779b9 + (seed << 6) +
+            (seed >> 2);
+  }
+  return seed;
+}
+
+std::unordered_map<GradNodeBase*, int> GetInDegreeMapWithCache(
+    const std::deque<GradNodeBase*>& queue) {
+  size_t key = HashStartupNodes(queue);
+  uint64_t generation = GradNodeGraphGeneration();
+  {
+    std::lock_guard<std::mutex> lock(backward_plan_mutex);
+    auto iter = BackwardPlanCache().find(key);
+    if (iter != BackwardPlanCache().end()) {
+      if (iter->second.generation == generation) {
+        VLOG(4) << "Backward plan cache hit, skip in-degree discovery for "
+                << iter->second.in_degrees.size() << " nodes.";
+        std::unordered_map<GradNodeBase*, int> node_in_degree_map;
+        node_in_degree_map.reserve(iter->second.in_degrees.size());
+        node_in_degree_map.insert(iter->second.in_degrees.begin(),
+                                  iter->second.in_degrees.end());
+        return node_in_degree_map;
+      }
+      // some grad node has been destroyed, the cached pointers may dangle
+      BackwardPlanCache().erase(iter);
+    }
+  }
+  std::unordered_map<GradNodeBase*, int> node_in_degree_map =
+      getInDegreeMap(queue);
+  BackwardPlan plan;
+  plan.generation = generation;
+  plan.in_degrees.assign(node_in_degree_map.begin(), node_in_degree_map.end());
+  {
+    std::lock_guard<std::mutex> lock(backward_plan_mutex);
+    // keep the cache from growing without bound when root sets vary
+    if (BackwardPlanCache().size() >= 64) {
+      BackwardPlanCache().clear();
+    }
+    BackwardPlanCache()[key] = std::move(plan);
+  }
+  return node_in_degree_map;
+}
+
+}  // namespace
+
 std::unordered_map<GradNodeBase*, int> getInDegreeMap(
     const std::deque<GradNodeBase*>& init_queue) {
   // Calculate in_degree for each node
@@ -102,6 +202,269 @@ void DuplicateCheck(const std::vector<paddle::Tensor>& inputs, bool is_input) {
 
 GeneralGrad* GeneralGrad::general_grad_ = new GeneralGrad();
 
+namespace {
+
+// Worker pool for the parallel backward pass. Each lane is one thread with
+// a FIFO task queue, and every grad node is pinned to the lane of the place
+// its inputs live on: phi device contexts do not tolerate concurrent kernel
+// launches, so same-place nodes must keep their program order anyway.
+// Parallelism therefore materializes between places - CPU-side branches,
+// multi-device graphs - while per-stream ordering holds by construction.
+class BackwardWorkerPool {
+ public:
+  explicit BackwardWorkerPool(size_t num_lanes) {
+    lanes_.reserve(num_lanes);
+    for (size_t i = 0; i < num_lanes; ++i) {
+      lanes_.emplace_back(new Lane());
+      threads_.emplace_back(
+          &BackwardWorkerPool::WorkerLoop, this, lanes_[i].get());
+    }
+  }
+
+  ~BackwardWorkerPool() {
+    stop_ = true;
+    for (auto& lane : lanes_) {
+      std::lock_guard<std::mutex> guard(lane->mutex);
+      lane->cv.notify_all();
+    }
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Dispatch(size_t lane_id, std::function<void()> task) {
+    inflight_.fetch_add(1);
+    Lane* lane = lanes_[lane_id % lanes_.size()].get();
+    {
+      std::lock_guard<std::mutex> guard(lane->mutex);
+      lane->tasks.push_back(std::move(task));
+    }
+    lane->cv.notify_one();
+  }
+
+  // Blocks until every dispatched task finished, including tasks dispatched
+  // by running tasks; rethrows the first error a task raised.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(done_mutex_);
+    done_cv_.wait(lock, [this] { return inflight_.load() == 0; });
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+  }
+
+  bool HasError() {
+    std::lock_guard<std::mutex> guard(done_mutex_);
+    return error_ != nullptr;
+  }
+
+ private:
+  struct Lane {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void WorkerLoop(Lane* lane) {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(lane->mutex);
+        lane->cv.wait(lock,
+                      [&] { return stop_.load() || !lane->tasks.empty(); });
+        if (lane->tasks.empty()) {
+          if (stop_.load()) {
+            return;
+          }
+          continue;
+        }
+        task = std::move(lane->tasks.front());
+        lane->tasks.pop_front();
+      }
+      try {
+        task();
+      } catch (...) {
+        std::lock_guard<std::mutex> guard(done_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      if (inflight_.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> guard(done_mutex_);
+        done_cv_.notify_all();
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<Lane>> lanes_;
+  std::vector<std::thread> threads_;
+  std::atomic<bool> stop_{false};
+  std::atomic<size_t> inflight_{0};
+  std::mutex done_mutex_;
+  std::condition_variable done_cv_;
+  std::exception_ptr error_;
+};
+
+// Drains the whole ready-node graph on a worker pool, reusing the in-degree
+// counts computed by RunBackward. Node execution runs without a lock; the
+// shared graph state (holders, in-degrees, lane assignment) is updated under
+// one mutex, which also serializes the gradient accumulations it triggers.
+// Only plain backward goes through here: general grad, create_graph and
+// force-sequential nodes keep the serial loop.
+void RunBackwardParallel(
+    const std::deque<GradNodeBase*>& init_queue,
+    std::unordered_map<GradNodeBase*, std::unique_ptr<GradTensorHolder>>*
+        node_input_buffers_dict,
+    std::unordered_map<GradNodeBase*, int>* node_in_degree_map,
+    bool retain_graph,
+    const paddle::platform::Place& place) {
+  size_t num_lanes = std::max(1, FLAGS_parallel_backward_workers);
+  BackwardWorkerPool pool(num_lanes);
+  std::mutex graph_mutex;
+  std::map<phi::Place, size_t> lane_of_place;
+
+  // Requires graph_mutex to be held.
+  auto lane_of_node = [&](GradNodeBase* node) -> size_t {
+    phi::Place node_place = place;
+    for (const auto& slot : node->InputMeta()) {
+      if (!slot.empty()) {
+        node_place = slot[0].GetPlace();
+        break;
+      }
+    }
+    auto iter = lane_of_place.find(node_place);
+    if (iter == lane_of_place.end()) {
+      iter = lane_of_place.emplace(node_place, lane_of_place.size()).first;
+    }
+    return iter->second;
+  };
+
+  std::function<void(GradNodeBase*)> run_node = [&](GradNodeBase* node) {
+    if (pool.HasError()) {
+      return;
+    }
+    VLOG(3) << "Preparing GradNode:" << node->name() << " addr:" << node;
+
+    std::unique_ptr<GradTensorHolder> node_input_buffer;
+    {
+      std::lock_guard<std::mutex> guard(graph_mutex);
+      auto node_input_buffer_iter = node_input_buffers_dict->find(node);
+      PADDLE_ENFORCE_NE(
+          node_input_buffer_iter,
+          node_input_buffers_dict->end(),
+          paddle::platform::errors::Fatal(
+              "Unable to find next node in the GradTensorHolder \n"
+              "Trying to run Node without configuring its GradTensorHolder."));
+      node_input_buffer = std::move(node_input_buffer_iter->second);
+      node_input_buffers_dict->erase(node_input_buffer_iter);
+    }
+
+    EnforceGradNodeHasInput(node);
+
+    paddle::platform::RecordEvent grad_node_record_event(
+        "Global_" + std::string((*node).name()),
+        paddle::platform::TracerEventType::Operator,
+        1);
+
+    paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize>
+        grad_output_tensors = (*node)(node_input_buffer->Buffers(),
+                                      /*create_graph=*/false,
+                                      /*is_general_grad=*/false);
+
+    if (!retain_graph) {
+      node->ClearTensorWrappers();
+    }
+
+    const paddle::small_vector<std::vector<GradSlotMeta>,
+                               kSlotSmallVectorSize>& metas =
+        node->OutputMeta();
+    PADDLE_ENFORCE(metas.size() == grad_output_tensors.size() || metas.empty(),
+                   paddle::platform::errors::Fatal(
+                       "Number of edges should be either empty ( for leaf node "
+                       ") or the same as number of output grad tensors, but we "
+                       "got edges size is: %d, grad_output size is: %d",
+                       metas.size(),
+                       grad_output_tensors.size()));
+
+    std::vector<std::pair<GradNodeBase*, size_t>> ready_nodes;
+    {
+      std::lock_guard<std::mutex> guard(graph_mutex);
+      for (size_t i = 0; i < metas.size(); i++) {
+        for (size_t j = 0; j < metas[i].size(); j++) {
+          const Edge& edge = metas[i][j].GetEdge();
+          if (!edge.IsInitialized()) {
+            continue;
+          }
+          auto edge_rank = edge.GetEdgeRankInfo();
+          auto next_node_shared = edge.GetMutableGradNode();
+          if (!next_node_shared || !next_node_shared.get() ||
+              grad_output_tensors[i].empty()) {
+            continue;
+          }
+
+          PADDLE_ENFORCE_LT(
+              j,
+              grad_output_tensors[i].size(),
+              paddle::platform::errors::Fatal(
+                  "Rank of grad_output_tensors should be less than "
+                  "grad_output_tensors[i].size(), which is: %d. This error "
+                  "may indicate autoprune or autograd api error. ",
+                  grad_output_tensors.size()));
+          paddle::Tensor& grad_output_tensor = grad_output_tensors[i][j];
+
+          auto* next_node = next_node_shared.get();
+          if (!node_input_buffers_dict->count(next_node)) {
+            (*node_input_buffers_dict)[next_node] =
+                std::make_unique<GradTensorHolder>(next_node->InputMeta());
+          }
+
+          (*node_input_buffers_dict)[next_node]->add(edge_rank.first,
+                                                     edge_rank.second,
+                                                     grad_output_tensor,
+                                                     /*create_graph=*/false);
+
+          (*node_in_degree_map)[next_node]--;
+          PADDLE_ENFORCE(
+              (*node_in_degree_map)[next_node] >= 0,
+              paddle::platform::errors::Fatal(
+                  "Detected in-degree value smaller than zero. For Node: %s"
+                  "Node's in-degree cannot be negative.",
+                  next_node->name()));
+          if ((*node_in_degree_map)[next_node] == 0) {
+            ready_nodes.emplace_back(next_node, lane_of_node(next_node));
+          }
+        }
+      }
+    }
+    for (auto& ready : ready_nodes) {
+      pool.Dispatch(ready.second,
+                    [&run_node, next = ready.first] { run_node(next); });
+    }
+    paddle::memory::LogDeviceMemoryStats(place, std::string((*node).name()));
+  };
+
+  std::vector<std::pair<GradNodeBase*, size_t>> startup_nodes;
+  {
+    std::lock_guard<std::mutex> guard(graph_mutex);
+    std::unordered_set<GradNodeBase*> deduped;
+    for (auto* node : init_queue) {
+      // Duplicates appear when several output tensors share one grad node;
+      // startup nodes fed by other startup nodes become ready later.
+      if (!deduped.insert(node).second ||
+          (*node_in_degree_map)[node] != 0) {
+        continue;
+      }
+      startup_nodes.emplace_back(node, lane_of_node(node));
+    }
+  }
+  for (auto& startup : startup_nodes) {
+    pool.Dispatch(startup.second,
+                  [&run_node, node = startup.first] { run_node(node); });
+  }
+  pool.Wait();
+}
+
+}  // namespace
+
 std::vector<paddle::Tensor> RunBackward(
     const std::vector<paddle::Tensor>& tensors,  // output
     const std::vector<paddle::Tensor>& grad_tensors,
@@ -219,9 +582,14 @@ std::vector<paddle::Tensor> RunBackward(
   }
 
   VLOG(5) << "Update In degree Map for backward";
-  // 3. Compute in_degree for each node
+  // 3. Compute in_degree for each node. GeneralGrad works on copied nodes
+  // whose addresses change every call, so only plain backward goes through
+  // the plan cache.
   std::unordered_map<GradNodeBase*, int> node_in_degree_map =
-      getInDegreeMap(queue);
+      (FLAGS_enable_backward_plan_cache && !is_general_grad)
+          ? GetInDegreeMapWithCache(queue)
+          : getInDegreeMap(queue);
+  node_input_buffers_dict.reserve(node_in_degree_map.size());
 
   std::queue<GradNodeBase*> force_sequential_nodes_forward_queue =
       egr::Controller::Instance().GetForceSequentialNodes();
@@ -243,6 +611,22 @@ std::vector<paddle::Tensor> RunBackward(
 
   VLOG(5) << "Startup_ops's size is " << queue.size();
 
+  // Wide graphs with independent branches can drain the ready set on a
+  // worker pool instead of one node at a time. General grad and create_graph
+  // stay on the serial loop (they thread extra per-node state), as do graphs
+  // with force-sequential nodes.
+  bool run_parallel = FLAGS_enable_parallel_backward && !is_general_grad &&
+                      !create_graph && force_sequential_nodes_set.empty();
+  if (run_parallel) {
+    RunBackwardParallel(queue,
+                        &node_input_buffers_dict,
+                        &node_in_degree_map,
+                        retain_graph,
+                        place);
+    // The pool ran the whole graph; skip the serial loop below.
+    queue.clear();
+  }
+
   /* --- Topological Visit --- */
   // 1. Pop queue
   // 2. Run node
@@ -14,6 +14,8 @@
 
 #include "paddle/fluid/eager/grad_node_info.h"
 
+#include <atomic>
+
 #include "glog/logging.h"
 #include "paddle/fluid/eager/accumulation/accumulation_node.h"
 #include "paddle/fluid/eager/autograd_meta.h"
@@ -36,6 +38,16 @@
  **/
 namespace egr {
 
+static std::atomic<uint64_t> grad_node_graph_generation{0};
+
+uint64_t GradNodeGraphGeneration() {
+  return grad_node_graph_generation.load(std::memory_order_acquire);
+}
+
+void BumpGradNodeGraphGeneration() {
+  grad_node_graph_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
 static void CheckTensor(const paddle::Tensor& pre, const paddle::Tensor& post) {
   if (!pre.initialized() && post.initialized()) {
     PADDLE_THROW(paddle::platform::errors::PermissionDenied(
@@ -731,8 +743,11 @@ void GradNodeBase::SetDefaultGradInOutMeta() {
 
 int64_t GradNodeBase::RegisterGradientHook(
     size_t slot_id, size_t rank, std::shared_ptr<egr::TensorHook>&& hook) {
-  gradient_hooks_.emplace(next_hook_id_,
-                          std::make_tuple(slot_id, rank, std::move(hook)));
+  if (!gradient_hooks_) {
+    gradient_hooks_ = std::make_unique<GradientHookList>();
+  }
+  gradient_hooks_->push_back(
+      GradientHookEntry{next_hook_id_, slot_id, rank, std::move(hook)});
   return next_hook_id_++;
 }
 
@@ -740,13 +755,17 @@ paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize>
 GradNodeBase::ApplyGradientHooks(
     const paddle::small_vector<std::vector<paddle::Tensor>,
                                kSlotSmallVectorSize>& tensors) {
+  // Most nodes carry no hooks; skip the per-slot copy loops entirely.
+  if (!gradient_hooks_) {
+    return tensors;
+  }
   paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize> outs(
       tensors.size());
-  for (auto& hook_pair : gradient_hooks_) {
-    size_t slot_id = std::get<0>(hook_pair.second);
-    size_t rank = std::get<1>(hook_pair.second);
+  for (auto& entry : *gradient_hooks_) {
+    size_t slot_id = entry.slot_id;
+    size_t rank = entry.rank;
 
-    auto hook = std::get<2>(hook_pair.second);
+    auto& hook = entry.hook;
 
     PADDLE_ENFORCE(slot_id < tensors.size(),
                    paddle::platform::errors::Fatal(
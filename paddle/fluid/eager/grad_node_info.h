@@ -17,11 +17,13 @@
 #include <memory>
 
 #include "paddle/fluid/eager/api/utils/global_utils.h"
+#include "paddle/fluid/eager/autograd_object_pool.h"
 #include "paddle/fluid/eager/eager_tensor.h"
 #include "paddle/fluid/eager/hooks.h"
 #include "paddle/phi/api/all.h"
 #include "paddle/phi/core/distributed/auto_parallel/dist_attr.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/reshard_utils.h"
+#include "paddle/utils/small_vector.h"
 #include "paddle/utils/test_macros.h"
 
 namespace egr {
@@ -50,6 +52,13 @@ namespace egr {
 class AutogradMeta;
 class GradNodeBase;
 
+// Monotonically increases whenever any GradNodeBase is destroyed. The
+// backward plan cache (backward.cc) compares this against the value recorded
+// with a plan to detect that cached node pointers may dangle or have been
+// reused for different nodes.
+TEST_API uint64_t GradNodeGraphGeneration();
+TEST_API void BumpGradNodeGraphGeneration();
+
 class Edge {
  public:
   // Default constructor for Edges in order to construct it for AutogradMeta
@@ -194,12 +203,48 @@ class GradSlotMeta {
   bool is_dist_meta_{false};
 };
 
+// One registered gradient hook; entries live in registration order (hook ids
+// are monotonic per node), which is also the order hooks are applied in.
+struct GradientHookEntry {
+  int64_t hook_id;
+  size_t slot_id;
+  size_t rank;
+  std::shared_ptr<TensorHook> hook;
+};
+
+// Hooked nodes are rare, so GradNodeBase keeps the list behind a pointer:
+// the no-hook case costs one null check and no per-node map storage. The
+// inline capacity covers the typical one or two hooks without a reallocation.
+using GradientHookList = paddle::small_vector<GradientHookEntry, 4>;
+
 class GradNodeBase {
  public:
   GradNodeBase() { VLOG(7) << "Construct GradNodeBase"; }
   TEST_API GradNodeBase(size_t bwd_in_slot_num, size_t bwd_out_slot_num);
   // TODO(jiabin): Should we have other constructor here?
-  virtual ~GradNodeBase() { VLOG(7) << "Destruct GradNodeBase"; }
+  virtual ~GradNodeBase() {
+    VLOG(7) << "Destruct GradNodeBase";
+    BumpGradNodeGraphGeneration();
+  }
+
+  // Grad nodes are churned once per forward op; recycle their storage from
+  // the per-thread freelist instead of the global allocator. The sized
+  // delete receives the most-derived size through the virtual destructor.
+  static void* operator new(std::size_t size) {
+    return AutogradObjectPool::ThreadLocal().Allocate(size);
+  }
+  static void operator delete(void* ptr, std::size_t size) {
+    AutogradObjectPool::ThreadLocal().Deallocate(ptr, size);
+  }
+  // Over-aligned subclasses bypass the pool and keep their alignment.
+  static void* operator new(std::size_t size, std::align_val_t align) {
+    return ::operator new(size, align);
+  }
+  static void operator delete(void* ptr,
+                              std::size_t size,
+                              std::align_val_t align) {
+    ::operator delete(ptr, size, align);
+  }
 
   /**
    * operator() designed to contain the real backward execution logic, it should
@@ -276,11 +321,20 @@ class GradNodeBase {
    * Remove GradientHook
    * **/
   bool RemoveGradientHook(const int64_t& hook_id) {
-    auto remove_cnt = gradient_hooks_.erase(hook_id);
-    if (remove_cnt == 0) {
+    if (!gradient_hooks_) {
       return false;
     }
-    return true;
+    for (auto iter = gradient_hooks_->begin(); iter != gradient_hooks_->end();
+         ++iter) {
+      if (iter->hook_id == hook_id) {
+        gradient_hooks_->erase(iter);
+        if (gradient_hooks_->empty()) {
+          gradient_hooks_.reset();
+        }
+        return true;
+      }
+    }
+    return false;
   }
 
   std::vector<std::shared_ptr<egr::GradNodeBase>> NextFunctions();
@@ -290,19 +344,25 @@ class GradNodeBase {
   /**
    * Apply GradientHook
    * **/
-  inline bool GradientHooksRegistered() { return !gradient_hooks_.empty(); }
+  inline bool GradientHooksRegistered() { return gradient_hooks_ != nullptr; }
 
-  std::map<int64_t, std::tuple<size_t, size_t, std::shared_ptr<TensorHook>>>
-  GetGradientHookFunctions() {
+  const GradientHookList* GetGradientHookFunctions() const {
     VLOG(7) << "GetGradientHookFunctions ";
-    return gradient_hooks_;
+    return gradient_hooks_.get();
   }
 
-  void SetGradientHookFunctions(
-      std::map<int64_t, std::tuple<size_t, size_t, std::shared_ptr<TensorHook>>>
-          hooks) {
+  void SetGradientHookFunctions(const GradientHookList* hooks) {
     VLOG(7) << "SetGradientHookFunctions ";
-    gradient_hooks_ = hooks;
+    if (hooks == nullptr || hooks->empty()) {
+      gradient_hooks_.reset();
+      return;
+    }
+    gradient_hooks_ = std::make_unique<GradientHookList>(*hooks);
+    for (auto& entry : *gradient_hooks_) {
+      if (entry.hook_id >= next_hook_id_) {
+        next_hook_id_ = entry.hook_id + 1;
+      }
+    }
   }
 
   paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize>
@@ -351,14 +411,9 @@ class GradNodeBase {
   // Gradient Hooks
   // Customer may register a list of hooks which will be called in order during
   // backward
-  // Each entry consists of one pair of
-  // <hook_id, <out_rank, std::shared_ptr<TensorHook>>>
-  std::map<int64_t,
-           std::tuple<
-               /* slot id */ size_t,
-               /* rank */ size_t,
-               /* hook */ std::shared_ptr<TensorHook>>>
-      gradient_hooks_;
+  // Null for the (overwhelmingly common) no-hook case; allocated lazily on
+  // the first registration and reset when the last hook is removed.
+  std::unique_ptr<GradientHookList> gradient_hooks_;
   int64_t next_hook_id_{0};
 
   // We handle complex to real conversion only if any complex GradIn is involved
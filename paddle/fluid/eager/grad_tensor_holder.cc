@@ -27,10 +27,55 @@ namespace egr {
 
 void GradTensorHolder::SetBufferSlotRankZeros(size_t slot_id, size_t rank) {
   // Set not grad var to zero and set stop gradient as default value: true
+  // Zeroing overrides whatever was accumulated, so queued contributions for
+  // this entry are dropped as well.
+  pending_.erase({slot_id, rank});
   buffer_[slot_id][rank] =
       paddle::experimental::zeros_like(buffer_[slot_id][rank]);
 }
 
+void GradTensorHolder::MaterializeEntry(size_t slot_id, size_t rank) {
+  auto iter = pending_.find({slot_id, rank});
+  if (iter == pending_.end()) {
+    return;
+  }
+  std::vector<paddle::Tensor> pending = std::move(iter->second);
+  pending_.erase(iter);
+  paddle::Tensor& buffer_tensor = buffer_[slot_id][rank];
+  if (pending.size() >= 2) {
+    // 3+ contributions in total: one fused add_n launch reads every input
+    // once instead of pairwise adds re-reading the buffer per contribution.
+    VLOG(6) << "Fuse " << pending.size() + 1
+            << " grad contributions with add_n for buffer_ slot: " << slot_id
+            << ", rank: " << rank;
+    std::vector<paddle::Tensor> inputs;
+    inputs.reserve(pending.size() + 1);
+    inputs.push_back(buffer_tensor);
+    for (auto& tensor : pending) {
+      inputs.push_back(std::move(tensor));
+    }
+    buffer_tensor = paddle::experimental::add_n(inputs);
+  } else {
+    paddle::imperative::TensorAdd<paddle::Tensor>(pending[0], &buffer_tensor);
+  }
+}
+
+void GradTensorHolder::MaterializeSlot(size_t slot_id) {
+  if (pending_.empty() || slot_id >= buffer_.size()) {
+    return;
+  }
+  for (size_t rank = 0; rank < buffer_[slot_id].size(); ++rank) {
+    MaterializeEntry(slot_id, rank);
+  }
+}
+
+void GradTensorHolder::MaterializeAll() {
+  while (!pending_.empty()) {
+    auto key = pending_.begin()->first;
+    MaterializeEntry(key.first, key.second);
+  }
+}
+
 void GradTensorHolder::CopyValueFromTensor(size_t slot_id,
                                            size_t rank,
                                            const paddle::Tensor& t,
@@ -172,9 +217,12 @@ void GradTensorHolder::add(size_t slot_id,
     if (t.is_dense_tensor()) {
       if (buffer_tensor.is_dense_tensor()) {
         if (create_graph || t.is_custom_device()) {
+          MaterializeEntry(slot_id, rank);
           buffer_tensor = add_ad_func(t, buffer_tensor);
         } else {
-          paddle::imperative::TensorAdd<paddle::Tensor>(t, &buffer_tensor);
+          // Defer the sum: contributions queue up and are materialized on
+          // first read, so wide fan-outs collapse into one fused add_n.
+          pending_[{slot_id, rank}].push_back(t);
         }
       } else {
         // TODO(jiabin): Support Other TensorBase later
@@ -204,12 +252,15 @@ void GradTensorHolder::add(size_t slot_id,
         }
       }
     } else if (t.is_dist_tensor()) {
+      MaterializeEntry(slot_id, rank);
       buffer_tensor = add_ad_func(t, buffer_tensor);
     } else {
       // TODO(jiabin): Support Other TensorBase later
       // TODO(zhanlve): Replace SelectedRowsAddTensor with add_dygraph_function
       // once it's supported
       if (buffer_tensor.is_dense_tensor()) {
+        // dense contributions may still be queued for this entry
+        MaterializeEntry(slot_id, rank);
         paddle::imperative::SelectedRowsAddToTensor(t, &buffer_tensor);
       } else {
         buffer_tensor =
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "paddle/fluid/eager/grad_node_info.h"
 
 namespace egr {
@@ -56,19 +60,30 @@ class GradTensorHolder {
                            bool fill_one = false);
 
   const std::vector<paddle::Tensor>& operator[](const size_t& pos) {
+    MaterializeSlot(pos);
     return buffer_[pos];
   }
 
   paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize>&
   Buffers() {
+    MaterializeAll();
     return buffer_;
   }
 
   void SetBufferSlotRankZeros(size_t slot_id, size_t rank);
 
  private:
+  // Dense accumulations without autograd recording are not summed eagerly:
+  // add() queues them here and the sum is materialized on first read. With
+  // three or more contributions this collapses into a single fused add_n
+  // launch instead of pairwise adds re-reading the buffer each time.
+  void MaterializeEntry(size_t slot_id, size_t rank);
+  void MaterializeSlot(size_t slot_id);
+  void MaterializeAll();
+
   paddle::small_vector<std::vector<paddle::Tensor>, kSlotSmallVectorSize>
       buffer_;
+  std::map<std::pair<size_t, size_t>, std::vector<paddle::Tensor>> pending_;
 };
 
 }  // namespace egr
@@ -0,0 +1,333 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/eager/saved_tensor_offload.h"
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "paddle/fluid/platform/enforce.h"
+#include "paddle/fluid/platform/flags.h"
+#include "paddle/fluid/platform/place.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/core/dense_tensor.h"
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/fluid/platform/device_context.h"
+#include "paddle/phi/backends/gpu/gpu_decls.h"
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
+
+PADDLE_DEFINE_EXPORTED_bool(
+    eager_saved_tensor_offload,
+    false,
+    "Copy forward activations saved for backward to pinned host memory so "
+    "the device buffers can be freed with the forward tensors, and copy "
+    "them back asynchronously when backward consumes them.");
+
+PADDLE_DEFINE_EXPORTED_int64(
+    eager_saved_tensor_offload_min_bytes,
+    1 << 20,
+    "Saved activations smaller than this stay on device even when "
+    "eager_saved_tensor_offload is enabled; tiny copies cost more in "
+    "latency than they save in memory.");
+
+namespace egr {
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+namespace {
+
+// How many save-order predecessors to start copying back when a record is
+// restored. Backward consumes activations roughly in reverse save order, so
+// these are the likely next reads.
+constexpr size_t kPrefetchAhead = 4;
+
+gpuEvent_t CreateGpuEvent() {
+  gpuEvent_t event = nullptr;
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      hipEventCreateWithFlags(&event, hipEventDisableTiming));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+#endif
+  return event;
+}
+
+void RecordGpuEvent(gpuEvent_t event, gpuStream_t stream) {
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(hipEventRecord(event, stream));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventRecord(event, stream));
+#endif
+}
+
+bool GpuEventIsDone(gpuEvent_t event) {
+#ifdef PADDLE_WITH_HIP
+  hipError_t status = hipEventQuery(event);
+  if (status == hipErrorNotReady) {
+    return false;
+  }
+#else
+  cudaError_t status = cudaEventQuery(event);
+  if (status == cudaErrorNotReady) {
+    return false;
+  }
+#endif
+  PADDLE_ENFORCE_GPU_SUCCESS(status);
+  return true;
+}
+
+void SyncGpuEvent(gpuEvent_t event) {
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(hipEventSynchronize(event));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventSynchronize(event));
+#endif
+}
+
+void DestroyGpuEvent(gpuEvent_t event) {
+  if (event) {
+#ifdef PADDLE_WITH_HIP
+    hipEventDestroy(event);
+#else
+    cudaEventDestroy(event);
+#endif
+  }
+}
+
+void StreamWaitGpuEvent(gpuStream_t stream, gpuEvent_t event) {
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(hipStreamWaitEvent(stream, event, 0));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaStreamWaitEvent(stream, event, 0));
+#endif
+}
+
+struct OffloadRecord : public SavedTensorRecord {
+  // Pinned host copy of the activation; filled by the D2H issued in Save.
+  std::shared_ptr<phi::Allocation> host_buffer;
+  // Keeps the device source alive until the D2H copy finished.
+  std::shared_ptr<phi::Allocation> src_buffer;
+  // Device copy rebuilt by Restore/prefetch.
+  std::shared_ptr<phi::Allocation> device_buffer;
+  size_t size{0};
+  size_t save_index{0};
+  phi::Place place;
+  gpuEvent_t d2h_done{nullptr};
+  gpuEvent_t h2d_done{nullptr};
+
+  ~OffloadRecord() override {
+    DestroyGpuEvent(d2h_done);
+    DestroyGpuEvent(h2d_done);
+  }
+};
+
+class PinnedHostOffloadPolicy : public SavedTensorPolicy {
+ public:
+  ~PinnedHostOffloadPolicy() override {
+    for (auto& pair : streams_) {
+      phi::backends::gpu::GPUDeviceGuard guard(pair.first);
+      phi::backends::gpu::GpuDestroyStream(pair.second);
+    }
+  }
+
+  bool ShouldSave(const paddle::Tensor& tensor) const override {
+    if (!tensor.initialized() || !tensor.is_dense_tensor() ||
+        !paddle::platform::is_gpu_place(tensor.place())) {
+      return false;
+    }
+    auto* dense = static_cast<phi::DenseTensor*>(tensor.impl().get());
+    return dense->Holder() != nullptr &&
+           static_cast<int64_t>(dense->Holder()->size()) >=
+               FLAGS_eager_saved_tensor_offload_min_bytes;
+  }
+
+  std::shared_ptr<SavedTensorRecord> Save(
+      const paddle::Tensor& tensor) override {
+    auto* dense = static_cast<phi::DenseTensor*>(tensor.impl().get());
+    auto record = std::make_shared<OffloadRecord>();
+    record->place = tensor.place();
+    record->size = dense->Holder()->size();
+    record->src_buffer = dense->Holder();
+    record->host_buffer =
+        phi::memory_utils::AllocShared(phi::GPUPinnedPlace(), record->size);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    gpuStream_t stream = OffloadStream(record->place.device);
+    // The producer kernel runs on the compute stream of the device context;
+    // order the D2H copy behind whatever is queued there.
+    auto* dev_ctx = static_cast<phi::GPUContext*>(
+        paddle::platform::DeviceContextPool::Instance().Get(record->place));
+    gpuEvent_t produced = CreateGpuEvent();
+    RecordGpuEvent(produced, dev_ctx->stream());
+    StreamWaitGpuEvent(stream, produced);
+    DestroyGpuEvent(produced);
+
+    phi::memory_utils::Copy(phi::GPUPinnedPlace(),
+                            record->host_buffer->ptr(),
+                            record->place,
+                            record->src_buffer->ptr(),
+                            record->size,
+                            stream);
+    record->d2h_done = CreateGpuEvent();
+    RecordGpuEvent(record->d2h_done, stream);
+
+    record->save_index = save_order_.size();
+    save_order_.emplace_back(record);
+    pending_release_.push_back(record);
+    ReleaseFinishedSources();
+    VLOG(6) << "Offloaded saved tensor #" << record->save_index << " ("
+            << record->size << " bytes) to pinned host memory";
+    return record;
+  }
+
+  std::shared_ptr<phi::Allocation> Restore(
+      const std::shared_ptr<SavedTensorRecord>& base) override {
+    auto record = std::static_pointer_cast<OffloadRecord>(base);
+    std::lock_guard<std::mutex> guard(mutex_);
+    StartPrefetch(record);
+    // Pull forward the records saved just before this one; backward will
+    // most likely read them next.
+    for (size_t i = 0; i < kPrefetchAhead && i < record->save_index; ++i) {
+      if (auto prev = save_order_[record->save_index - 1 - i].lock()) {
+        StartPrefetch(std::static_pointer_cast<OffloadRecord>(prev));
+      }
+    }
+    SyncGpuEvent(record->h2d_done);
+    return record->device_buffer;
+  }
+
+ private:
+  gpuStream_t OffloadStream(int device_id) {
+    auto iter = streams_.find(device_id);
+    if (iter != streams_.end()) {
+      return iter->second;
+    }
+    phi::backends::gpu::GPUDeviceGuard guard(device_id);
+    gpuStream_t stream = nullptr;
+#ifdef PADDLE_WITH_HIP
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+#else
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+#endif
+    streams_.emplace(device_id, stream);
+    return stream;
+  }
+
+  void StartPrefetch(const std::shared_ptr<OffloadRecord>& record) {
+    if (record->device_buffer) {
+      return;
+    }
+    if (record->src_buffer) {
+      // The D2H copy has not been drained yet; wait for it so dropping the
+      // source reference below cannot free an allocation still being read.
+      SyncGpuEvent(record->d2h_done);
+      record->src_buffer.reset();
+    }
+    gpuStream_t stream = OffloadStream(record->place.device);
+    record->device_buffer =
+        phi::memory_utils::AllocShared(record->place, record->size);
+    // The D2H that filled host_buffer ran on the same stream, so the copy
+    // back is implicitly ordered behind it.
+    phi::memory_utils::Copy(record->place,
+                            record->device_buffer->ptr(),
+                            phi::GPUPinnedPlace(),
+                            record->host_buffer->ptr(),
+                            record->size,
+                            stream);
+    if (record->h2d_done == nullptr) {
+      record->h2d_done = CreateGpuEvent();
+    }
+    RecordGpuEvent(record->h2d_done, stream);
+  }
+
+  void ReleaseFinishedSources() {
+    while (!pending_release_.empty()) {
+      auto& front = pending_release_.front();
+      if (!front->src_buffer) {
+        pending_release_.pop_front();
+        continue;
+      }
+      if (!GpuEventIsDone(front->d2h_done)) {
+        break;
+      }
+      front->src_buffer.reset();
+      pending_release_.pop_front();
+    }
+  }
+
+  std::mutex mutex_;
+  std::map<int, gpuStream_t> streams_;
+  // Save-order view for prefetch-ahead; weak so records die with the last
+  // TensorWrapper referencing them.
+  std::vector<std::weak_ptr<OffloadRecord>> save_order_;
+  // Records whose device source is still pinned behind an in-flight D2H.
+  std::deque<std::shared_ptr<OffloadRecord>> pending_release_;
+};
+
+}  // namespace
+
+#endif  // PADDLE_WITH_CUDA || PADDLE_WITH_HIP
+
+SavedTensorOffloadManager& SavedTensorOffloadManager::Instance() {
+  static SavedTensorOffloadManager instance;
+  return instance;
+}
+
+SavedTensorOffloadManager::SavedTensorOffloadManager() {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (FLAGS_eager_saved_tensor_offload) {
+    policy_ = std::make_unique<PinnedHostOffloadPolicy>();
+  }
+#endif
+}
+
+void SavedTensorOffloadManager::SetPolicy(
+    std::unique_ptr<SavedTensorPolicy> policy) {
+  policy_ = std::move(policy);
+}
+
+bool SavedTensorOffloadManager::ShouldSave(
+    const paddle::Tensor& tensor) const {
+  return policy_ != nullptr && policy_->ShouldSave(tensor);
+}
+
+std::shared_ptr<SavedTensorRecord> SavedTensorOffloadManager::Save(
+    const paddle::Tensor& tensor) {
+  PADDLE_ENFORCE_NOT_NULL(
+      policy_,
+      paddle::platform::errors::PreconditionNotMet(
+          "SavedTensorOffloadManager::Save called without an active "
+          "saved-tensor policy."));
+  return policy_->Save(tensor);
+}
+
+std::shared_ptr<phi::Allocation> SavedTensorOffloadManager::Restore(
+    const std::shared_ptr<SavedTensorRecord>& record) {
+  PADDLE_ENFORCE_NOT_NULL(
+      policy_,
+      paddle::platform::errors::PreconditionNotMet(
+          "SavedTensorOffloadManager::Restore called without an active "
+          "saved-tensor policy."));
+  return policy_->Restore(record);
+}
+
+}  // namespace egr
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "paddle/fluid/platform/macros.h"
+#include "paddle/phi/api/include/tensor.h"
+#include "paddle/phi/core/allocator.h"
+
+namespace egr {
+
+/**
+ * Saved-tensor policies decide what happens to the data buffer of an
+ * activation the moment TensorWrapper captures it for backward. The default
+ * pinned-host policy copies the buffer to page-locked host memory so the
+ * device allocation can be released with the forward tensor, and copies it
+ * back asynchronously when backward asks for it; activation residency is
+ * usually what caps batch size. A recompute-style policy can be plugged in
+ * through SavedTensorOffloadManager::SetPolicy by storing whatever Save
+ * needs to rebuild the buffer in its own SavedTensorRecord subclass.
+ *
+ * Python-level hooks (paddle.autograd.saved_tensors_hooks) keep priority:
+ * TensorWrapper only consults the policy when no pack hook is installed.
+ **/
+
+// Opaque per-tensor state; each policy derives its own record type.
+class SavedTensorRecord {
+ public:
+  virtual ~SavedTensorRecord() = default;
+};
+
+class SavedTensorPolicy {
+ public:
+  virtual ~SavedTensorPolicy() = default;
+
+  // Whether this policy wants to take over the buffer of `tensor`.
+  virtual bool ShouldSave(const paddle::Tensor& tensor) const = 0;
+
+  // Capture the buffer. The returned record carries everything needed to
+  // rebuild it; the caller drops its reference to the device allocation.
+  virtual std::shared_ptr<SavedTensorRecord> Save(
+      const paddle::Tensor& tensor) = 0;
+
+  // Rebuild the device buffer for backward. Must be safe to call more than
+  // once for the same record (retain_graph reruns backward).
+  virtual std::shared_ptr<phi::Allocation> Restore(
+      const std::shared_ptr<SavedTensorRecord>& record) = 0;
+};
+
+class SavedTensorOffloadManager {
+ public:
+  static SavedTensorOffloadManager& Instance();
+
+  // Replaces the active policy; pass nullptr to disable interception.
+  void SetPolicy(std::unique_ptr<SavedTensorPolicy> policy);
+
+  bool ShouldSave(const paddle::Tensor& tensor) const;
+
+  std::shared_ptr<SavedTensorRecord> Save(const paddle::Tensor& tensor);
+
+  std::shared_ptr<phi::Allocation> Restore(
+      const std::shared_ptr<SavedTensorRecord>& record);
+
+ private:
+  SavedTensorOffloadManager();
+  DISABLE_COPY_AND_ASSIGN(SavedTensorOffloadManager);
+
+  std::unique_ptr<SavedTensorPolicy> policy_;
+};
+
+}  // namespace egr
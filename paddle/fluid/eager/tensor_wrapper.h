@@ -27,6 +27,7 @@
 #pragma once
 #include "paddle/fluid/eager/autograd_meta.h"
 #include "paddle/fluid/eager/grad_node_info.h"
+#include "paddle/fluid/eager/saved_tensor_offload.h"
 #include "paddle/fluid/eager/utils.h"
 #include "paddle/phi/api/lib/utils/allocator.h"
 #ifndef PADDLE_NO_PYTHON
@@ -122,7 +123,19 @@ class TensorWrapper {
         packed_value_ = (*pack_hook)(tensor);
       } else {
 #endif
-        intermidiate_tensor_.set_impl(tensor.impl());
+        if (SavedTensorOffloadManager::Instance().ShouldSave(tensor)) {
+          // The active saved-tensor policy takes over the data buffer (e.g.
+          // offloads it to pinned host memory); keep only the meta here so
+          // the device allocation is released with the forward tensor.
+          phi::DenseTensor* dense_tensor =
+              static_cast<phi::DenseTensor*>(tensor.impl().get());
+          intermidiate_tensor_.set_impl(std::make_shared<phi::DenseTensor>(
+              std::make_shared<phi::Allocation>(nullptr, 0, tensor.place()),
+              dense_tensor->meta()));
+          offload_record_ = SavedTensorOffloadManager::Instance().Save(tensor);
+        } else {
+          intermidiate_tensor_.set_impl(tensor.impl());
+        }
 #ifndef PADDLE_NO_PYTHON
       }
 #endif
@@ -134,8 +147,8 @@ class TensorWrapper {
     }
 
     if (tensor_autograd_meta) {
-      auto autograd_meta =
-          std::make_shared<AutogradMeta>(*tensor_autograd_meta);
+      auto autograd_meta = std::shared_ptr<AutogradMeta>(
+          new AutogradMeta(*tensor_autograd_meta));
       autograd_meta->ResetGradNode();
       intermidiate_tensor_.set_autograd_meta(autograd_meta);
       weak_grad_node_ = tensor_autograd_meta->GetMutableGradNode();
@@ -185,7 +198,18 @@ class TensorWrapper {
       }
     } else {
 #endif
-      check_inplace_version();
+      if (offload_record_) {
+        // Copy the activation back from wherever the policy parked it. The
+        // saved meta-only impl regains a freshly filled device buffer; the
+        // inplace check is skipped because the snapshot was taken from the
+        // buffer at save time, like the pack-hook path above.
+        auto holder =
+            SavedTensorOffloadManager::Instance().Restore(offload_record_);
+        static_cast<phi::DenseTensor*>(intermidiate_tensor_.impl().get())
+            ->ResetHolder(holder);
+      } else {
+        check_inplace_version();
+      }
 #ifndef PADDLE_NO_PYTHON
     }
 #endif
@@ -203,8 +227,8 @@ class TensorWrapper {
         EagerUtils::nullable_autograd_meta(intermidiate_tensor_);
 
     if (intermediate_autograd_meta) {
-      auto p_ab_autograd_meta =
-          std::make_shared<AutogradMeta>(*intermediate_autograd_meta);
+      auto p_ab_autograd_meta = std::shared_ptr<AutogradMeta>(
+          new AutogradMeta(*intermediate_autograd_meta));
       if (new_grad_node) {
         p_ab_autograd_meta->SetGradNode(new_grad_node);
       }
@@ -216,7 +240,10 @@ class TensorWrapper {
 
   paddle::Tensor get_intermidiate_tensor() { return intermidiate_tensor_; }
 
-  void clear() { intermidiate_tensor_.reset(); }
+  void clear() {
+    intermidiate_tensor_.reset();
+    offload_record_.reset();
+  }
 
  private:
   void check_inplace_version() {
@@ -270,6 +297,9 @@ class TensorWrapper {
   paddle::Tensor intermidiate_tensor_;
   std::weak_ptr<egr::GradNodeBase> weak_grad_node_;
   uint32_t inplace_version_snapshot_ = 0;
+  // Set when a saved-tensor policy captured the data buffer; shared so
+  // copies of the wrapper reuse the same offloaded copy.
+  std::shared_ptr<SavedTensorRecord> offload_record_;
 #ifndef PADDLE_NO_PYTHON
   std::shared_ptr<egr::PyObjectHolderBase> packed_value_;
   std::shared_ptr<egr::UnPackHookBase> unpack_hook_;
@@ -68,7 +68,8 @@ void SetGradOutputDistAttrIter::visit(
 AutogradMeta* EagerUtils::autograd_meta(paddle::Tensor* target) {
   auto* p_autograd_meta = target->get_autograd_meta();
   if (!p_autograd_meta) {
-    auto p_autograd_meta_ptr = std::make_shared<AutogradMeta>();
+    // plain new (not make_shared) so the pooled class allocator is used
+    auto p_autograd_meta_ptr = std::shared_ptr<AutogradMeta>(new AutogradMeta());
     p_autograd_meta = p_autograd_meta_ptr.get();
     target->set_autograd_meta(p_autograd_meta_ptr);
   }
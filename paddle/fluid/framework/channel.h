@@ -22,11 +22,13 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>  // NOLINT
 #include <deque>
 #include <limits>
 #include <memory>
 #include <mutex>  // NOLINT
+#include <thread>  // NOLINT
 #include <utility>
 #include <vector>
 
@@ -40,23 +42,25 @@ class ChannelObject {
  public:
   ChannelObject() {}
 
+  virtual ~ChannelObject() {}
+
   // capacity can be zero
   explicit ChannelObject(size_t capacity) {
     capacity_ = (std::min)(MaxCapacity(), capacity);
   }
 
-  const std::deque<T>& GetData() const { return data_; }
-  void Clear() {
+  virtual const std::deque<T>& GetData() const { return data_; }
+  virtual void Clear() {
     std::unique_lock<std::mutex> lock(mutex_);
     data_.clear();
     data_.shrink_to_fit();
   }
 
-  size_t Capacity() {
+  virtual size_t Capacity() {
     return capacity_;  // atomic
   }
 
-  void SetCapacity(size_t x) {  // capacity can be zero
+  virtual void SetCapacity(size_t x) {  // capacity can be zero
     std::lock_guard<std::mutex> lock(mutex_);
     capacity_ = std::min(MaxCapacity(), x);
     Notify();
@@ -79,30 +83,30 @@ class ChannelObject {
     block_size_ = other->BlockSize();
   }
 
-  bool Closed() {
+  virtual bool Closed() {
     return closed_;  // atomic
   }
 
   // open channel, then data can be write() to channel
-  void Open() {
+  virtual void Open() {
     std::lock_guard<std::mutex> lock(mutex_);
     closed_ = false;
     Notify();
   }
 
   // close channel, then no more data can be write() to channel
-  void Close() {
+  virtual void Close() {
     std::lock_guard<std::mutex> lock(mutex_);
     closed_ = true;
     Notify();
   }
 
-  size_t Size() {
+  virtual size_t Size() {
     std::lock_guard<std::mutex> lock(mutex_);
     return data_.size();
   }
 
-  bool Empty() {
+  virtual bool Empty() {
     std::lock_guard<std::mutex> lock(mutex_);
     return EmptyUnlocked();
   }
@@ -112,7 +116,7 @@ class ChannelObject {
 
   // blocking operation
   // returns 0 if the channel is closed and empty
-  size_t Read(size_t n, T* p) {
+  virtual size_t Read(size_t n, T* p) {
     if (n == 0) {
       return 0;
     }
@@ -131,7 +135,7 @@ class ChannelObject {
 
   // blocking operation
   // returns value less than n if the channel is closed
-  size_t Write(size_t n, const T* p) {
+  virtual size_t Write(size_t n, const T* p) {
     if (n == 0) {
       return 0;
     }
@@ -142,7 +146,7 @@ class ChannelObject {
   }
 
   // WriteMove() will clear original contents of input array
-  size_t WriteMove(size_t n, T* p) {
+  virtual size_t WriteMove(size_t n, T* p) {
     if (n == 0) {
       return 0;
     }
@@ -160,7 +164,7 @@ class ChannelObject {
     return finished;
   }
   // read once only
-  size_t ReadOnce(std::vector<T>& p, size_t size) {  // NOLINT
+  virtual size_t ReadOnce(std::vector<T>& p, size_t size) {  // NOLINT
     if (size == 0) {
       return 0;
     }
@@ -306,6 +310,192 @@ class ChannelObject {
   }
 };  // NOLINT
 
+// Bounded lock-free MPMC variant of ChannelObject backed by a ring of
+// per-slot sequence numbers. A batched Put/Get claims up to K contiguous
+// slots with a single CAS on the enqueue/dequeue counter, so producers and
+// consumers never take a mutex and a stalled peer costs a yield loop
+// instead of a condvar wake storm. The capacity is fixed at construction
+// (rounded up to a power of two) and GetData() is not supported, so this
+// variant can not be used by code that snapshots the channel's deque.
+template <class T>
+class LockFreeChannelObject : public ChannelObject<T> {
+ public:
+  explicit LockFreeChannelObject(size_t capacity) {
+    CHECK(capacity > 0) << "lock-free channel capacity must be > 0";
+    size_t n = 2;
+    while (n < capacity && n < MaxRingCapacity()) {
+      n <<= 1;
+    }
+    mask_ = n - 1;
+    slots_.reset(new Slot[n]);
+    for (size_t i = 0; i < n; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  using ChannelObject<T>::Read;
+  using ChannelObject<T>::Write;
+
+  const std::deque<T>& GetData() const override {
+    CHECK(false) << "GetData is not supported by the lock-free channel";
+    return ChannelObject<T>::GetData();
+  }
+
+  void Clear() override {
+    T trash;
+    while (ReadImpl(1, &trash, true, false) != 0) {
+    }
+  }
+
+  size_t Capacity() override { return mask_ + 1; }
+
+  void SetCapacity(size_t x) override {
+    // the ring is sized once at construction
+    VLOG(1) << "ignoring SetCapacity(" << x
+            << ") on a lock-free channel with fixed capacity " << mask_ + 1;
+  }
+
+  bool Closed() override {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+  void Open() override { closed_.store(false, std::memory_order_release); }
+
+  void Close() override { closed_.store(true, std::memory_order_release); }
+
+  size_t Size() override {
+    size_t e = enqueue_pos_.load(std::memory_order_acquire);
+    size_t d = dequeue_pos_.load(std::memory_order_acquire);
+    return e >= d ? e - d : 0;
+  }
+
+  bool Empty() override { return Size() == 0; }
+
+  size_t Read(size_t n, T* p) override { return ReadImpl(n, p, false, true); }
+
+  size_t Write(size_t n, const T* p) override {
+    size_t finished = 0;
+    while (finished < n) {
+      if (Closed()) {
+        break;
+      }
+      size_t pos = 0;
+      size_t k = TryClaim(&enqueue_pos_, n - finished, 0, &pos);
+      if (k == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (size_t i = 0; i < k; ++i) {
+        Slot& slot = slots_[(pos + i) & mask_];
+        slot.data = p[finished + i];
+        slot.sequence.store(pos + i + 1, std::memory_order_release);
+      }
+      finished += k;
+    }
+    return finished;
+  }
+
+  size_t WriteMove(size_t n, T* p) override {
+    size_t finished = 0;
+    while (finished < n) {
+      if (Closed()) {
+        break;
+      }
+      size_t pos = 0;
+      size_t k = TryClaim(&enqueue_pos_, n - finished, 0, &pos);
+      if (k == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (size_t i = 0; i < k; ++i) {
+        Slot& slot = slots_[(pos + i) & mask_];
+        slot.data = std::move(p[finished + i]);
+        slot.sequence.store(pos + i + 1, std::memory_order_release);
+      }
+      finished += k;
+    }
+    return finished;
+  }
+
+  size_t ReadOnce(std::vector<T>& p, size_t size) override {  // NOLINT
+    if (size == 0) {
+      return 0;
+    }
+    p.resize(size);
+    size_t finished = ReadImpl(size, &p[0], true, true);
+    p.resize(finished);
+    return finished;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  static constexpr size_t MaxRingCapacity() { return size_t{1} << 30; }
+
+  // Claims up to want contiguous slots whose sequence says they are ready
+  // for this side (ready_offset is 0 for producers, 1 for consumers) with
+  // one CAS on the shared counter. Returns 0 only when the first slot is
+  // not ready, i.e. the ring is full (producer) or drained (consumer).
+  size_t TryClaim(std::atomic<size_t>* counter,
+                  size_t want,
+                  size_t ready_offset,
+                  size_t* out_pos) {
+    for (;;) {
+      size_t pos = counter->load(std::memory_order_relaxed);
+      size_t k = 0;
+      while (k < want &&
+             slots_[(pos + k) & mask_].sequence.load(
+                 std::memory_order_acquire) == pos + k + ready_offset) {
+        ++k;
+      }
+      if (k == 0) {
+        return 0;
+      }
+      if (counter->compare_exchange_weak(
+              pos, pos + k, std::memory_order_relaxed)) {
+        *out_pos = pos;
+        return k;
+      }
+    }
+  }
+
+  size_t ReadImpl(size_t n, T* p, bool once, bool wait) {
+    size_t finished = 0;
+    while (finished < n) {
+      size_t pos = 0;
+      size_t k = TryClaim(&dequeue_pos_, n - finished, 1, &pos);
+      if (k == 0) {
+        // producers always fill every slot they have claimed, so a closed
+        // but non-empty ring becomes readable without further waiting
+        if (!wait || (Closed() && Empty())) {
+          break;
+        }
+        std::this_thread::yield();
+        continue;
+      }
+      for (size_t i = 0; i < k; ++i) {
+        Slot& slot = slots_[(pos + i) & mask_];
+        p[finished + i] = std::move(slot.data);
+        slot.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+      }
+      finished += k;
+      if (once) {
+        break;
+      }
+    }
+    return finished;
+  }
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_ = 0;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  std::atomic<bool> closed_{false};
+};  // NOLINT
+
 template <class T>
 using Channel = std::shared_ptr<ChannelObject<T>>;
 
@@ -314,6 +504,11 @@ Channel<T> MakeChannel(size_t capacity = (std::numeric_limits<size_t>::max)()) {
   return std::make_shared<ChannelObject<T>>(capacity);
 }
 
+template <class T>
+Channel<T> MakeLockFreeChannel(size_t capacity) {
+  return std::make_shared<LockFreeChannelObject<T>>(capacity);
+}
+
 template <class T, class U>
 Channel<T> MakeChannel(const Channel<U>& other) {
   CHECK(other != nullptr) << "channel can not be NULL";
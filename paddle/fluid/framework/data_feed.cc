@@ -21,6 +21,7 @@ limitations under the License. */
 
 #include "paddle/fluid/framework/fleet/ps_gpu_wrapper.h"
 #ifdef _LINUX
+#include <fcntl.h>
 #include <stdio_ext.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -31,6 +32,7 @@ limitations under the License. */
 
 USE_INT_STAT(STAT_total_feasign_num_in_mem);
 COMMON_DECLARE_bool(enable_ins_parser_file);
+COMMON_DECLARE_bool(enable_gpu_direct_batch_decompress);
 namespace paddle::framework {
 
 DLManager& global_dlmanager_pool() {
@@ -234,6 +236,45 @@ bool DataFeed::PickOneFile(std::string* filename) {
   return true;
 }
 
+bool DataFeed::PickOneFileBlock(FileDataBlock* block) {
+  PADDLE_ENFORCE_NOT_NULL(
+      mutex_for_pick_file_,
+      platform::errors::PreconditionNotMet(
+          "You should call SetFileListMutex before PickOneFileBlock"));
+  PADDLE_ENFORCE_NOT_NULL(
+      file_blocks_,
+      platform::errors::PreconditionNotMet(
+          "You should call SetFileBlockList before PickOneFileBlock"));
+  std::unique_lock<std::mutex> lock(*mutex_for_pick_file_);
+  if (*file_block_idx_ == file_blocks_->size()) {
+    VLOG(3) << "DataFeed::PickOneFileBlock no more block to pick";
+    return false;
+  }
+  VLOG(3) << "file_block_idx_=" << *file_block_idx_;
+  *block = (*file_blocks_)[(*file_block_idx_)++];
+  return true;
+}
+
+void DataFeed::SetSampleFilter(const std::string& slot_name,
+                               uint64_t lower,
+                               uint64_t upper) {
+  CheckInit();
+  filter_slot_idx_ = -1;
+  for (size_t i = 0; i < use_slots_.size(); ++i) {
+    if (use_slots_[i] == slot_name) {
+      filter_slot_idx_ = static_cast<int>(i);
+      break;
+    }
+  }
+  PADDLE_ENFORCE_GE(
+      filter_slot_idx_,
+      0,
+      platform::errors::InvalidArgument(
+          "Slot %s of the sample filter is not a used slot.", slot_name));
+  filter_lower_ = lower;
+  filter_upper_ = upper;
+}
+
 void DataFeed::CheckInit() {
   PADDLE_ENFORCE_EQ(
       finish_init_,
@@ -280,6 +321,72 @@ void DataFeed::CopyToFeedTensor(void* dst, const void* src, size_t size) {
   }
 }
 
+DataFeed::~DataFeed() {
+#if defined(PADDLE_WITH_CUDA)
+  for (auto& staging : staging_buffers_) {
+    if (staging.event != nullptr) {
+      cudaEventDestroy(staging.event);
+    }
+    if (staging.data != nullptr) {
+      cudaFreeHost(staging.data);
+    }
+  }
+  if (copy_stream_ != nullptr) {
+    cudaStreamDestroy(copy_stream_);
+  }
+#endif
+}
+
+void DataFeed::CopyToFeedTensorAsync(void* dst, const void* src, size_t size) {
+#if defined(PADDLE_WITH_CUDA)
+  if (platform::is_cpu_place(this->place_)) {
+    memcpy(dst, src, size);
+    return;
+  }
+  if (copy_stream_ == nullptr) {
+    CUDA_CHECK(cudaStreamCreateWithFlags(&copy_stream_, cudaStreamNonBlocking));
+    for (auto& staging : staging_buffers_) {
+      CUDA_CHECK(
+          cudaEventCreateWithFlags(&staging.event, cudaEventDisableTiming));
+    }
+  }
+  PinnedStagingBuffer& staging = staging_buffers_[staging_idx_];
+  staging_idx_ = 1 - staging_idx_;
+  if (staging.in_flight) {
+    // The buffer is reused only after its previous transfer has drained; the
+    // other buffer is usually still copying, which is exactly the overlap we
+    // are after.
+    CUDA_CHECK(cudaEventSynchronize(staging.event));
+    staging.in_flight = false;
+  }
+  if (staging.capacity < size) {
+    if (staging.data != nullptr) {
+      CUDA_CHECK(cudaFreeHost(staging.data));
+    }
+    CUDA_CHECK(cudaHostAlloc(
+        reinterpret_cast<void**>(&staging.data), size, cudaHostAllocDefault));
+    staging.capacity = size;
+  }
+  memcpy(staging.data, src, size);
+  CUDA_CHECK(cudaMemcpyAsync(
+      dst, staging.data, size, cudaMemcpyHostToDevice, copy_stream_));
+  CUDA_CHECK(cudaEventRecord(staging.event, copy_stream_));
+  staging.in_flight = true;
+#else
+  CopyToFeedTensor(dst, src, size);
+#endif
+}
+
+void DataFeed::FlushFeedTensorCopies() {
+#if defined(PADDLE_WITH_CUDA)
+  if (copy_stream_ != nullptr) {
+    CUDA_CHECK(cudaStreamSynchronize(copy_stream_));
+    staging_buffers_[0].in_flight = false;
+    staging_buffers_[1].in_flight = false;
+  }
+#endif
+}
+
 template <typename T>
 void PrivateQueueDataFeed<T>::SetQueueSize(int queue_size) {
   PADDLE_ENFORCE_GT(
@@ -542,6 +649,10 @@ void InMemoryDataFeed<T>::LoadIntoMemory() {
     LoadIntoMemoryFromSo();
     return;
   }
+  if (file_blocks_ != nullptr && !file_blocks_->empty()) {
+    LoadIntoMemoryByBlock();
+    return;
+  }
   VLOG(3) << "LoadIntoMemory() begin, thread_id=" << thread_id_;
   std::string filename;
   while (this->PickOneFile(&filename)) {
@@ -565,7 +676,9 @@ void InMemoryDataFeed<T>::LoadIntoMemory() {
     platform::Timer timeline;
     timeline.Start();
     while (ParseOneInstanceFromPipe(&instance)) {
-      writer << std::move(instance);
+      if (KeepInstance(instance)) {
+        writer << std::move(instance);
+      }
       instance = T();
     }
     STAT_ADD(STAT_total_feasign_num_in_mem, fea_num_);
@@ -584,6 +697,59 @@ void InMemoryDataFeed<T>::LoadIntoMemory() {
 #endif
 }
 
+template <typename T>
+void InMemoryDataFeed<T>::LoadIntoMemoryByBlock() {
+#ifdef _LINUX
+  VLOG(3) << "LoadIntoMemoryByBlock() begin, thread_id=" << thread_id_;
+  FileDataBlock block;
+  while (this->PickOneFileBlock(&block)) {
+    VLOG(3) << "PickOneFileBlock, filename=" << block.filename
+            << ", offset=" << block.offset << ", length=" << block.length
+            << ", thread_id=" << thread_id_;
+    int err_no = 0;
+    // Blocks are only built for plain seekable local files, so the raw file
+    // is opened without the pipe command.
+    this->fp_ = fs_open_read(block.filename, &err_no, "", true);
+    CHECK(this->fp_ != nullptr);
+    __fsetlocking(&*(this->fp_), FSETLOCKING_BYCALLER);
+    FILE* fp = &*(this->fp_);
+    uint64_t end = block.offset + block.length;
+    if (block.offset > 0) {
+      // Seek one byte back and throw away one line: the record crossing the
+      // block boundary belongs to the reader of the previous block, which
+      // reads past its end until the next newline.
+      CHECK_EQ(fseeko(fp, static_cast<off_t>(block.offset) - 1, SEEK_SET), 0);
+      thread_local string::LineFileReader skip_reader;
+      skip_reader.getline(fp);
+    }
+    paddle::framework::ChannelWriter<T> writer(input_channel_);
+    T instance;
+    platform::Timer timeline;
+    timeline.Start();
+    while (static_cast<uint64_t>(ftello(fp)) < end &&
+           ParseOneInstanceFromPipe(&instance)) {
+      if (KeepInstance(instance)) {
+        writer << std::move(instance);
+      }
+      instance = T();
+    }
+    STAT_ADD(STAT_total_feasign_num_in_mem, fea_num_);
+    {
+      std::lock_guard<std::mutex> flock(*mutex_for_fea_num_);
+      *total_fea_num_ += fea_num_;
+      fea_num_ = 0;
+    }
+    writer.Flush();
+    timeline.Pause();
+    VLOG(3) << "LoadIntoMemoryByBlock() read block, file=" << block.filename
+            << ", offset=" << block.offset
+            << ", cost time=" << timeline.ElapsedSec()
+            << " seconds, thread_id=" << thread_id_;
+  }
+  VLOG(3) << "LoadIntoMemoryByBlock() end, thread_id=" << thread_id_;
+#endif
+}
+
 template <typename T>
 void InMemoryDataFeed<T>::LoadIntoMemoryFromSo() {
 #if (defined _LINUX) && (defined PADDLE_WITH_HETERPS)
@@ -700,6 +866,20 @@ void MultiSlotDataFeed::ReadThread() {
   VLOG(4) << "entering MultiSlotDataFeed::ReadThread()";
   std::string filename;
   while (PickOneFile(&filename)) {
+    if (IsBinaryFile(filename)) {
+      // Binary record files are mapped and consumed in place, bypassing the
+      // pipe command and the per-field text conversion entirely.
+      CHECK(MapBinaryFile(filename));
+      std::vector<MultiSlotType> instance;
+      int ins_num = 0;
+      while (ParseOneInstanceFromBinary(&instance)) {
+        ins_num++;
+        queue_->Put(instance);
+      }
+      UnmapBinaryFile();
+      VLOG(3) << "binary filename: " << filename << " inst num: " << ins_num;
+      continue;
+    }
     int err_no = 0;
     fp_ = fs_open_read(filename, &err_no, pipe_command_, true);
     CHECK(fp_ != nullptr);
@@ -855,6 +1035,211 @@ bool MultiSlotDataFeed::CheckFile(const char* filename) {
   return true;
 }
 
+bool MultiSlotDataFeed::IsBinaryFile(const std::string& filename) {
+#ifdef _LINUX
+  std::ifstream fin(filename, std::ios::binary);
+  if (!fin.good()) {
+    return false;
+  }
+  uint32_t magic = 0;
+  fin.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  return fin.gcount() == sizeof(magic) && magic == kMultiSlotBinaryMagic;
+#else
+  return false;
+#endif
+}
+
+bool MultiSlotDataFeed::ConvertTextToBinary(
+    const std::string& text_filename, const std::string& binary_filename) {
+#ifdef _LINUX
+  CheckInit();  // get info of slots
+  std::ifstream fin(text_filename);
+  if (!fin.good()) {
+    VLOG(0) << "error: open file<" << text_filename << "> fail";
+    return false;
+  }
+  size_t slot_num = all_slots_.size();
+  std::vector<char> records;
+  std::vector<uint64_t> offsets;
+  auto append = [&records](const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    records.insert(records.end(), bytes, bytes + size);
+  };
+  std::string line;
+  while (std::getline(fin, line)) {
+    offsets.push_back(records.size());
+    const char* str = line.c_str();
+    char* endptr = const_cast<char*>(str);
+    size_t counts_pos = records.size();
+    records.resize(records.size() + sizeof(uint32_t) * slot_num);
+    for (size_t i = 0; i < slot_num; ++i) {
+      auto num = strtol(endptr, &endptr, 10);
+      if (num <= 0 || errno == ERANGE || num > INT_MAX) {
+        VLOG(0) << "error: the number of ids is invalid: " << num;
+        VLOG(0) << "please check line<" << offsets.size() << "> in file<"
+                << text_filename << ">";
+        VLOG(0) << "Error occurred when parsing " << i
+                << " th slot with total slots number: " << slot_num;
+        return false;
+      }
+      auto count = static_cast<uint32_t>(num);
+      memcpy(records.data() + counts_pos + sizeof(uint32_t) * i,
+             &count,
+             sizeof(uint32_t));
+      if (all_slots_type_[i][0] == 'f') {  // float
+        for (int j = 0; j < num; ++j) {
+          float feasign = strtof(endptr, &endptr);
+          append(&feasign, sizeof(feasign));
+        }
+      } else {  // uint64
+        for (int j = 0; j < num; ++j) {
+          uint64_t feasign = (uint64_t)strtoull(endptr, &endptr, 10);
+          append(&feasign, sizeof(feasign));
+        }
+      }
+    }
+  }
+  // The offset table stores absolute file positions, so readers can jump to
+  // any instance without scanning its predecessors.
+  uint64_t data_start =
+      sizeof(MultiSlotBinaryHeader) + sizeof(uint64_t) * offsets.size();
+  for (auto& offset : offsets) {
+    offset += data_start;
+  }
+  MultiSlotBinaryHeader header;
+  header.magic = kMultiSlotBinaryMagic;
+  header.version = kMultiSlotBinaryVersion;
+  header.slot_num = static_cast<uint32_t>(slot_num);
+  header.reserved = 0;
+  header.instance_num = offsets.size();
+  std::ofstream fout(binary_filename, std::ios::binary | std::ios::trunc);
+  if (!fout.good()) {
+    VLOG(0) << "error: open file<" << binary_filename << "> fail";
+    return false;
+  }
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  fout.write(reinterpret_cast<const char*>(offsets.data()),
+             sizeof(uint64_t) * offsets.size());
+  fout.write(records.data(), records.size());
+  VLOG(3) << "converted " << offsets.size() << " instances from <"
+          << text_filename << "> to <" << binary_filename << ">";
+  return fout.good();
+#else
+  return false;
+#endif
+}
+
+bool MultiSlotDataFeed::MapBinaryFile(const std::string& filename) {
+#ifdef _LINUX
+  UnmapBinaryFile();
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    VLOG(0) << "error: open file<" << filename << "> fail";
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(MultiSlotBinaryHeader)) {
+    VLOG(0) << "error: file<" << filename
+            << "> is smaller than the binary record header";
+    close(fd);
+    return false;
+  }
+  void* base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping keeps its own reference to the file
+  if (base == MAP_FAILED) {
+    VLOG(0) << "error: mmap file<" << filename << "> fail";
+    return false;
+  }
+  const auto* header = reinterpret_cast<const MultiSlotBinaryHeader*>(base);
+  if (header->magic != kMultiSlotBinaryMagic ||
+      header->version != kMultiSlotBinaryVersion ||
+      header->slot_num != all_slots_.size() ||
+      sizeof(MultiSlotBinaryHeader) +
+              sizeof(uint64_t) * header->instance_num >
+          static_cast<uint64_t>(st.st_size)) {
+    VLOG(0) << "error: file<" << filename
+            << "> has a mismatched binary record header, expect slot_num="
+            << all_slots_.size() << ", got slot_num=" << header->slot_num;
+    munmap(base, st.st_size);
+    return false;
+  }
+  binary_base_ = static_cast<const char*>(base);
+  binary_size_ = st.st_size;
+  binary_instance_num_ = header->instance_num;
+  binary_offsets_ = reinterpret_cast<const uint64_t*>(
+      binary_base_ + sizeof(MultiSlotBinaryHeader));
+  binary_cursor_ = 0;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void MultiSlotDataFeed::UnmapBinaryFile() {
+#ifdef _LINUX
+  if (binary_base_ != nullptr) {
+    munmap(const_cast<char*>(binary_base_), binary_size_);
+  }
+#endif
+  binary_base_ = nullptr;
+  binary_size_ = 0;
+  binary_offsets_ = nullptr;
+  binary_instance_num_ = 0;
+  binary_cursor_ = 0;
+}
+
+bool MultiSlotDataFeed::ParseOneInstanceFromBinary(
+    std::vector<MultiSlotType>* instance) {
+#ifdef _LINUX
+  if (binary_cursor_ >= binary_instance_num_) {
+    return false;
+  }
+  uint64_t offset = binary_offsets_[binary_cursor_++];
+  PADDLE_ENFORCE_LE(
+      offset + sizeof(uint32_t) * all_slots_.size(),
+      binary_size_,
+      platform::errors::InvalidArgument(
+          "The offset of instance %llu points past the end of the binary "
+          "record file, the file is truncated or corrupted.",
+          binary_cursor_ - 1));
+  const uint32_t* counts =
+      reinterpret_cast<const uint32_t*>(binary_base_ + offset);
+  const char* payload =
+      binary_base_ + offset + sizeof(uint32_t) * all_slots_.size();
+  instance->resize(use_slots_.size());
+  for (size_t i = 0; i < all_slots_.size(); ++i) {
+    int idx = use_slots_index_[i];
+    size_t num = counts[i];
+    size_t bytes =
+        num * (all_slots_type_[i][0] == 'f' ? sizeof(float) : sizeof(uint64_t));
+    PADDLE_ENFORCE_LE(
+        static_cast<size_t>(payload - binary_base_) + bytes,
+        binary_size_,
+        platform::errors::InvalidArgument(
+            "The payload of the %zu th slot of instance %llu runs past the "
+            "end of the binary record file, the file is truncated or "
+            "corrupted.",
+            i,
+            binary_cursor_ - 1));
+    if (idx != -1) {
+      (*instance)[idx].Init(all_slots_type_[i]);
+      if (all_slots_type_[i][0] == 'f') {  // float
+        (*instance)[idx].CopyValues(reinterpret_cast<const float*>(payload),
+                                    num);
+      } else {  // uint64
+        (*instance)[idx].CopyValues(reinterpret_cast<const uint64_t*>(payload),
+                                    num);
+      }
+    }
+    payload += bytes;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
 bool MultiSlotDataFeed::ParseOneInstanceFromPipe(
     std::vector<MultiSlotType>* instance) {
 #ifdef _LINUX
@@ -1019,13 +1404,14 @@ void MultiSlotDataFeed::PutToFeedVec(
       const auto& feasign = ins_vec[i].GetFloatData();
       float* tensor_ptr =
           feed_vec_[i]->mutable_data<float>({total_instance, 1}, this->place_);
-      CopyToFeedTensor(tensor_ptr, &feasign[0], total_instance * sizeof(float));
+      CopyToFeedTensorAsync(
+          tensor_ptr, &feasign[0], total_instance * sizeof(float));
     } else if (type[0] == 'u') {  // uint64
       // no uint64_t type in paddlepaddle
       const auto& feasign = ins_vec[i].GetUint64Data();
       int64_t* tensor_ptr = feed_vec_[i]->mutable_data<int64_t>(
           {total_instance, 1}, this->place_);
-      CopyToFeedTensor(
+      CopyToFeedTensorAsync(
           tensor_ptr, &feasign[0], total_instance * sizeof(int64_t));
     }
 
@@ -1041,6 +1427,7 @@ void MultiSlotDataFeed::PutToFeedVec(
       feed_vec_[i]->Resize(common::make_ddim(use_slots_shape_[i]));
     }
   }
+  FlushFeedTensorCopies();
 #endif
 }
 
@@ -1145,6 +1532,20 @@ int MultiSlotInMemoryDataFeed::ParseInstanceFromSo(
   return parser->ParseInstance(len, str, instances);
 }
 
+bool MultiSlotInMemoryDataFeed::KeepInstance(const Record& instance) {
+  if (filter_slot_idx_ < 0) {
+    return true;
+  }
+  for (auto& item : instance.uint64_feasigns_) {
+    if (item.slot() == static_cast<uint16_t>(filter_slot_idx_) &&
+        item.sign().uint64_feasign_ >= filter_lower_ &&
+        item.sign().uint64_feasign_ <= filter_upper_) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool MultiSlotInMemoryDataFeed::ParseOneInstanceFromPipe(Record* instance) {
 #ifdef _LINUX
   thread_local string::LineFileReader reader;
@@ -1404,13 +1805,15 @@ void MultiSlotInMemoryDataFeed::PutToFeedVec(const Record* ins_vec, int num) {
       float* feasign = batch_float_feasigns_[i].data();
       float* tensor_ptr =
           feed_vec_[i]->mutable_data<float>({total_instance, 1}, this->place_);
-      CopyToFeedTensor(tensor_ptr, feasign, total_instance * sizeof(float));
+      CopyToFeedTensorAsync(
+          tensor_ptr, feasign, total_instance * sizeof(float));
     } else if (type[0] == 'u') {  // uint64
       // no uint64_t type in paddlepaddle
       uint64_t* feasign = batch_uint64_feasigns_[i].data();
       int64_t* tensor_ptr = feed_vec_[i]->mutable_data<int64_t>(
           {total_instance, 1}, this->place_);
-      CopyToFeedTensor(tensor_ptr, feasign, total_instance * sizeof(int64_t));
+      CopyToFeedTensorAsync(
+          tensor_ptr, feasign, total_instance * sizeof(int64_t));
     }
     auto& slot_offset = offset_[i];
     if (this->input_type_ == 0) {
@@ -1443,6 +1846,7 @@ void MultiSlotInMemoryDataFeed::PutToFeedVec(const Record* ins_vec, int num) {
       feed_vec_[i]->Resize(common::make_ddim(use_slots_shape_[i]));
     }
   }
+  FlushFeedTensorCopies();
 #endif
 }
 
@@ -1502,13 +1906,15 @@ void MultiSlotInMemoryDataFeed::PutToFeedVec(
       float* feasign = batch_float_feasigns_[i].data();
       float* tensor_ptr =
           feed_vec_[i]->mutable_data<float>({total_instance, 1}, this->place_);
-      CopyToFeedTensor(tensor_ptr, feasign, total_instance * sizeof(float));
+      CopyToFeedTensorAsync(
+          tensor_ptr, feasign, total_instance * sizeof(float));
     } else if (type[0] == 'u') {  // uint64
       // no uint64_t type in paddlepaddle
       uint64_t* feasign = batch_uint64_feasigns_[i].data();
       int64_t* tensor_ptr = feed_vec_[i]->mutable_data<int64_t>(
           {total_instance, 1}, this->place_);
-      CopyToFeedTensor(tensor_ptr, feasign, total_instance * sizeof(int64_t));
+      CopyToFeedTensorAsync(
+          tensor_ptr, feasign, total_instance * sizeof(int64_t));
     }
     auto& slot_offset = offset_[i];
     if (this->input_type_ == 0) {
@@ -1543,6 +1949,7 @@ void MultiSlotInMemoryDataFeed::PutToFeedVec(
       feed_vec_[i]->Resize(common::make_ddim(use_slots_shape_[i]));
     }
   }
+  FlushFeedTensorCopies();
 #endif
 }
 
@@ -3266,12 +3673,19 @@ void MiniBatchGpuPack::pack_instance(const SlotRecord* ins_vec, int num) {
 
 void MiniBatchGpuPack::transfer_to_gpu() {
   copy_host2device(&value_.d_uint64_lens, buf_.h_uint64_lens);
-  copy_host2device(&value_.d_uint64_keys, buf_.h_uint64_keys);
   copy_host2device(&value_.d_uint64_offset, buf_.h_uint64_offset);
 
   copy_host2device(&value_.d_float_lens, buf_.h_float_lens);
-  copy_host2device(&value_.d_float_keys, buf_.h_float_keys);
   copy_host2device(&value_.d_float_offset, buf_.h_float_offset);
+  if (FLAGS_enable_gpu_direct_batch_decompress) {
+    // The key arrays dominate the PCIe traffic of a batch; ship them
+    // compressed and expand them on the device instead.
+    copy_host2device_compressed(&value_.d_uint64_keys, buf_.h_uint64_keys);
+    copy_host2device_compressed(&value_.d_float_keys, buf_.h_float_keys);
+  } else {
+    copy_host2device(&value_.d_uint64_keys, buf_.h_uint64_keys);
+    copy_host2device(&value_.d_float_keys, buf_.h_float_keys);
+  }
   CUDA_CHECK(cudaStreamSynchronize(stream_));
 }
 #endif
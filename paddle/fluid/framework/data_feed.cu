@@ -472,6 +472,156 @@ void SlotRecordInMemoryDataFeed::CopyForTensor(
   cudaStreamSynchronize(stream);
 }
 
+// Compress one chunk with greedy byte-oriented LZ coding: a token byte holds
+// the literal length and match length nibbles (15 marks a 255-run length
+// extension), followed by the literals, a 2-byte match offset and the match
+// length extension. Chunks decode independently, so the device kernel can
+// expand them in parallel.
+static void CompressBatchChunk(const uint8_t *src,
+                               size_t len,
+                               std::vector<uint8_t> *out) {
+  constexpr size_t kMinMatch = 4;
+  constexpr size_t kHashBits = 13;
+  thread_local std::vector<int32_t> table;
+  table.assign(1u << kHashBits, -1);
+  auto hash4 = [src](size_t p) {
+    uint32_t v;
+    memcpy(&v, src + p, sizeof(v));
+    return (v * 2654435761u) >> (32 - kHashBits);
+  };
+  auto emit_len = [out](size_t extra) {
+    while (extra >= 255) {
+      out->push_back(255);
+      extra -= 255;
+    }
+    out->push_back(static_cast<uint8_t>(extra));
+  };
+  size_t anchor = 0;
+  size_t pos = 0;
+  while (pos + kMinMatch <= len) {
+    uint32_t h = hash4(pos);
+    int32_t cand = table[h];
+    table[h] = static_cast<int32_t>(pos);
+    if (cand >= 0 && pos - cand <= 65535 &&
+        memcmp(src + cand, src + pos, kMinMatch) == 0) {
+      size_t match_len = kMinMatch;
+      while (pos + match_len < len &&
+             src[cand + match_len] == src[pos + match_len]) {
+        ++match_len;
+      }
+      size_t lit_len = pos - anchor;
+      size_t ml_code = match_len - kMinMatch;
+      uint8_t token = static_cast<uint8_t>(
+          ((lit_len < 15 ? lit_len : 15) << 4) | (ml_code < 15 ? ml_code : 15));
+      out->push_back(token);
+      if (lit_len >= 15) {
+        emit_len(lit_len - 15);
+      }
+      out->insert(out->end(), src + anchor, src + anchor + lit_len);
+      size_t offset = pos - cand;
+      out->push_back(static_cast<uint8_t>(offset & 0xFF));
+      out->push_back(static_cast<uint8_t>(offset >> 8));
+      if (ml_code >= 15) {
+        emit_len(ml_code - 15);
+      }
+      pos += match_len;
+      anchor = pos;
+    } else {
+      ++pos;
+    }
+  }
+  size_t lit_len = len - anchor;
+  if (lit_len > 0) {
+    uint8_t token = static_cast<uint8_t>((lit_len < 15 ? lit_len : 15) << 4);
+    out->push_back(token);
+    if (lit_len >= 15) {
+      emit_len(lit_len - 15);
+    }
+    out->insert(out->end(), src + anchor, src + anchor + lit_len);
+  }
+}
+
+size_t CompressBatchChunks(const uint8_t *src,
+                           size_t len,
+                           std::vector<uint8_t> *compressed,
+                           std::vector<uint32_t> *chunk_offsets) {
+  compressed->clear();
+  chunk_offsets->clear();
+  chunk_offsets->push_back(0);
+  for (size_t begin = 0; begin < len; begin += kBatchCompressChunkSize) {
+    size_t chunk_len = std::min(kBatchCompressChunkSize, len - begin);
+    CompressBatchChunk(src + begin, chunk_len, compressed);
+    chunk_offsets->push_back(static_cast<uint32_t>(compressed->size()));
+  }
+  return compressed->size();
+}
+
+// One thread expands one chunk; chunks are sequential inside but independent
+// of each other, which is where the parallelism comes from. Matches may
+// overlap their output (run-length style), so they are copied byte by byte.
+__global__ void DecompressBatchChunksKernel(const uint8_t *compressed,
+                                            const uint32_t *chunk_offsets,
+                                            const int chunk_num,
+                                            const size_t chunk_size,
+                                            uint8_t *dst) {
+  CUDA_KERNEL_LOOP(i, chunk_num) {
+    const uint8_t *in = compressed + chunk_offsets[i];
+    const uint8_t *in_end = compressed + chunk_offsets[i + 1];
+    uint8_t *out = dst + static_cast<size_t>(i) * chunk_size;
+    while (in < in_end) {
+      uint8_t token = *in++;
+      size_t lit = token >> 4;
+      if (lit == 15) {
+        uint8_t b;
+        do {
+          b = *in++;
+          lit += b;
+        } while (b == 255);
+      }
+      for (size_t k = 0; k < lit; ++k) {
+        out[k] = in[k];
+      }
+      out += lit;
+      in += lit;
+      if (in >= in_end) {
+        break;
+      }
+      size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+      in += 2;
+      size_t ml = token & 0xF;
+      if (ml == 15) {
+        uint8_t b;
+        do {
+          b = *in++;
+          ml += b;
+        } while (b == 255);
+      }
+      ml += 4;
+      const uint8_t *match = out - offset;
+      for (size_t k = 0; k < ml; ++k) {
+        out[k] = match[k];
+      }
+      out += ml;
+    }
+  }
+}
+
+void DecompressBatchChunksOnGpu(const uint8_t *d_compressed,
+                                const uint32_t *d_chunk_offsets,
+                                int chunk_num,
+                                size_t raw_len,
+                                uint8_t *d_dst,
+                                cudaStream_t stream) {
+  DecompressBatchChunksKernel<<<GET_BLOCKS(chunk_num),
+                                CUDA_NUM_THREADS,
+                                0,
+                                stream>>>(d_compressed,
+                                          d_chunk_offsets,
+                                          chunk_num,
+                                          kBatchCompressChunkSize,
+                                          d_dst);
+}
+
 __global__ void GraphFillCVMKernel(int64_t *tensor, int len) {
   CUDA_KERNEL_LOOP(idx, len) { tensor[idx] = 1; }
 }
@@ -536,6 +536,23 @@ struct BatchGPUValue {
   CudaBuffer<int> d_ad_offset;
 };
 
+// GPU-direct batch ingestion: feasign blocks are compressed on the host into
+// independently decodable LZ chunks (byte-oriented literal/match coding with
+// a 64KB window), uploaded raw and expanded by a device kernel, so the PCIe
+// transfer shrinks and no decompressed copy is ever assembled on the host.
+// chunk_offsets holds chunk_num + 1 offsets into the compressed stream.
+constexpr size_t kBatchCompressChunkSize = 64 * 1024;
+size_t CompressBatchChunks(const uint8_t* src,
+                           size_t len,
+                           std::vector<uint8_t>* compressed,
+                           std::vector<uint32_t>* chunk_offsets);
+void DecompressBatchChunksOnGpu(const uint8_t* d_compressed,
+                                const uint32_t* d_chunk_offsets,
+                                int chunk_num,
+                                size_t raw_len,
+                                uint8_t* d_dst,
+                                cudaStream_t stream);
+
 class MiniBatchGpuPack {
  public:
   MiniBatchGpuPack(const paddle::platform::Place& place,
@@ -625,6 +642,50 @@ class MiniBatchGpuPack {
   void copy_host2device(CudaBuffer<T>* buf, const HostBuffer<T>& val) {
     copy_host2device(buf, val.data(), val.size());
   }
+  // Compressed variant of copy_host2device: the block is LZ-compressed into
+  // chunks, uploaded and expanded by the decompression kernel on stream_.
+  // Falls back to a plain upload when the batch does not compress.
+  template <typename T>
+  void copy_host2device_compressed(CudaBuffer<T>* buf,
+                                   const HostBuffer<T>& val) {
+    size_t size = val.size();
+    if (size == 0) {
+      return;
+    }
+    buf->resize(size);
+    size_t raw_len = size * sizeof(T);
+    size_t compressed_len =
+        CompressBatchChunks(reinterpret_cast<const uint8_t*>(val.data()),
+                            raw_len,
+                            &h_compressed_,
+                            &h_chunk_offsets_);
+    if (compressed_len >= raw_len) {
+      CUDA_CHECK(cudaMemcpyAsync(buf->data(),
+                                 val.data(),
+                                 raw_len,
+                                 cudaMemcpyHostToDevice,
+                                 stream_));
+      return;
+    }
+    d_compressed_.resize(h_compressed_.size());
+    d_chunk_offsets_.resize(h_chunk_offsets_.size());
+    CUDA_CHECK(cudaMemcpyAsync(d_compressed_.data(),
+                               h_compressed_.data(),
+                               h_compressed_.size(),
+                               cudaMemcpyHostToDevice,
+                               stream_));
+    CUDA_CHECK(cudaMemcpyAsync(d_chunk_offsets_.data(),
+                               h_chunk_offsets_.data(),
+                               h_chunk_offsets_.size() * sizeof(uint32_t),
+                               cudaMemcpyHostToDevice,
+                               stream_));
+    DecompressBatchChunksOnGpu(d_compressed_.data(),
+                               d_chunk_offsets_.data(),
+                               static_cast<int>(h_chunk_offsets_.size()) - 1,
+                               raw_len,
+                               reinterpret_cast<uint8_t*>(buf->data()),
+                               stream_);
+  }
 
  private:
   bool is_using_ = false;
@@ -658,6 +719,12 @@ class MiniBatchGpuPack {
 
   std::shared_ptr<phi::Allocation> gpu_slot_offsets_ = nullptr;
   std::shared_ptr<phi::Allocation> slot_buf_ptr_ = nullptr;
+
+  // staging for the compressed transfer path, reused across batches
+  std::vector<uint8_t> h_compressed_;
+  std::vector<uint32_t> h_chunk_offsets_;
+  CudaBuffer<uint8_t> d_compressed_;
+  CudaBuffer<uint32_t> d_chunk_offsets_;
 };
 class MiniBatchGpuPackMgr {
   static const int MAX_DEIVCE_NUM = 16;
@@ -1133,6 +1200,15 @@ class GraphDataGenerator {
   phi::DenseTensor multi_node_sync_stat_;
 };
 
+// A claimable byte range of one input file. Large seekable files are split
+// into several blocks so that reader threads can share one file at the epoch
+// tail instead of leaving it all to a single straggler thread.
+struct FileDataBlock {
+  std::string filename;
+  uint64_t offset = 0;
+  uint64_t length = 0;
+};
+
 class DataFeed {
  public:
   DataFeed() {
@@ -1141,7 +1217,7 @@ class DataFeed {
     mutex_for_fea_num_ = nullptr;
     total_fea_num_ = nullptr;
   }
-  virtual ~DataFeed() {}
+  virtual ~DataFeed();
   virtual void Init(const DataFeedDesc& data_feed_desc) = 0;
   virtual bool CheckFile(const char* filename UNUSED) {
     PADDLE_THROW(platform::errors::Unimplemented(
@@ -1215,6 +1291,18 @@ class DataFeed {
   }
   virtual void SetFeaNumMutex(std::mutex* mutex) { mutex_for_fea_num_ = mutex; }
   virtual void SetFileListIndex(size_t* file_index) { file_idx_ = file_index; }
+  virtual void SetFileBlockList(std::vector<FileDataBlock>* blocks,
+                                size_t* block_index) {
+    file_blocks_ = blocks;
+    file_block_idx_ = block_index;
+  }
+  // Keep only instances whose given uint64 slot holds a value in
+  // [lower, upper]. The predicate is pushed down into the reader threads, so
+  // filtered instances are dropped right after parsing instead of occupying
+  // channel memory. Must be called after Init().
+  virtual void SetSampleFilter(const std::string& slot_name,
+                               uint64_t lower,
+                               uint64_t upper);
   virtual void SetFeaNum(uint64_t* fea_num) { total_fea_num_ = fea_num; }
   virtual const std::vector<std::string>& GetInsIdVec() const {
     return ins_id_vec_;
@@ -1426,10 +1514,41 @@ class DataFeed {
   // This function is used to pick one file from the global filelist(thread
   // safe).
   virtual bool PickOneFile(std::string* filename);
+  // Picks one file block from the global block list(thread safe). Blocks are
+  // claimed one at a time, so an idle thread keeps stealing work from a large
+  // file that another thread is still reading.
+  virtual bool PickOneFileBlock(FileDataBlock* block);
   virtual void CopyToFeedTensor(void* dst, const void* src, size_t size);
+  // Stages the copy in pinned host memory and issues it asynchronously on a
+  // dedicated stream. The staging is double buffered, so while one transfer
+  // is in flight the caller can already assemble the next slot into the
+  // other buffer. Callers must invoke FlushFeedTensorCopies() before handing
+  // the batch to the trainer; on CPU places or non-CUDA builds this degrades
+  // to CopyToFeedTensor.
+  void CopyToFeedTensorAsync(void* dst, const void* src, size_t size);
+  void FlushFeedTensorCopies();
+
+#if defined(PADDLE_WITH_CUDA)
+  struct PinnedStagingBuffer {
+    char* data = nullptr;
+    size_t capacity = 0;
+    cudaEvent_t event = nullptr;
+    bool in_flight = false;
+  };
+  // Two pinned staging batches per feed thread, flipped on every async copy.
+  PinnedStagingBuffer staging_buffers_[2];
+  int staging_idx_ = 0;
+  cudaStream_t copy_stream_ = nullptr;
+#endif
 
   std::vector<std::string> filelist_;
   size_t* file_idx_;
+  std::vector<FileDataBlock>* file_blocks_ = nullptr;
+  size_t* file_block_idx_ = nullptr;
+  // sample filter, see SetSampleFilter; filter_slot_idx_ < 0 means disabled
+  int filter_slot_idx_ = -1;
+  uint64_t filter_lower_ = 0;
+  uint64_t filter_upper_ = 0;
   std::mutex* mutex_for_pick_file_;
   std::mutex* mutex_for_fea_num_ = nullptr;
   uint64_t* total_fea_num_ = nullptr;
@@ -1547,6 +1666,7 @@ class InMemoryDataFeed : public DataFeed {
   virtual void SetEnablePvMerge(bool enable_pv_merge);
   virtual void SetCurrentPhase(int current_phase);
   virtual void LoadIntoMemory();
+  virtual void LoadIntoMemoryByBlock();
   virtual void LoadIntoMemoryFromSo();
   virtual void SetRecord(T* records) { records_ = records; }
   int GetDefaultBatchSize() { return default_batch_size_; }
@@ -1557,6 +1677,8 @@ class InMemoryDataFeed : public DataFeed {
  protected:
   virtual bool ParseOneInstance(T* instance) = 0;
   virtual bool ParseOneInstanceFromPipe(T* instance) = 0;
+  // whether the parsed instance passes the sample filter, see SetSampleFilter
+  virtual bool KeepInstance(const T& instance UNUSED) { return true; }
   virtual void ParseOneInstanceFromSo(const char* str UNUSED,
                                       T* instance UNUSED,
                                       CustomParser* parser UNUSED) {}
@@ -1913,6 +2035,25 @@ paddle::framework::Archive<AR>& operator>>(paddle::framework::Archive<AR>& ar,
   return ar;
 }
 
+// Fixed-size header of the memory-mapped binary record format written by
+// MultiSlotDataFeed::ConvertTextToBinary. A binary file consists of this
+// header, an offset table holding the absolute byte position of every
+// instance, and the raw instance records. One record is a uint32 value-count
+// array over all slots (in MultiSlotDesc order) followed by the slot payloads
+// laid out back to back (4 bytes per float feasign, 8 bytes per uint64
+// feasign). Readers cast counts straight out of the mapped pages and memcpy
+// payload spans into the batch, without any per-field string conversion.
+struct MultiSlotBinaryHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t slot_num;
+  uint32_t reserved;
+  uint64_t instance_num;
+};
+
+constexpr uint32_t kMultiSlotBinaryMagic = 0x544C5350;  // "PSLT"
+constexpr uint32_t kMultiSlotBinaryVersion = 1;
+
 // This DataFeed is used to feed multi-slot type data.
 // The format of multi-slot type data:
 //   [n feasign_0 feasign_1 ... feasign_n]*
@@ -1920,9 +2061,16 @@ class MultiSlotDataFeed
     : public PrivateQueueDataFeed<std::vector<MultiSlotType>> {
  public:
   MultiSlotDataFeed() {}
-  virtual ~MultiSlotDataFeed() {}
+  virtual ~MultiSlotDataFeed() { UnmapBinaryFile(); }
   virtual void Init(const DataFeedDesc& data_feed_desc);
   virtual bool CheckFile(const char* filename);
+  // Converts one textual slot file into the binary record format described
+  // above; returns false if the text file cannot be parsed. The slot layout
+  // is taken from the DataFeedDesc passed to Init.
+  bool ConvertTextToBinary(const std::string& text_filename,
+                           const std::string& binary_filename);
+  // Returns true if the file starts with the binary record magic.
+  static bool IsBinaryFile(const std::string& filename);
 
  protected:
   virtual void ReadThread();
@@ -1932,6 +2080,18 @@ class MultiSlotDataFeed
   virtual bool ParseOneInstance(std::vector<MultiSlotType>* instance);
   virtual bool ParseOneInstanceFromPipe(std::vector<MultiSlotType>* instance);
   virtual void PutToFeedVec(const std::vector<MultiSlotType>& ins_vec);
+
+  // Maps a binary record file and validates its header against the slot
+  // layout; instances are then consumed by ParseOneInstanceFromBinary.
+  bool MapBinaryFile(const std::string& filename);
+  void UnmapBinaryFile();
+  bool ParseOneInstanceFromBinary(std::vector<MultiSlotType>* instance);
+
+  const char* binary_base_ = nullptr;  // mmap-ed, released by UnmapBinaryFile
+  size_t binary_size_ = 0;
+  const uint64_t* binary_offsets_ = nullptr;  // points into binary_base_
+  uint64_t binary_instance_num_ = 0;
+  uint64_t binary_cursor_ = 0;
 };
 
 class MultiSlotInMemoryDataFeed : public InMemoryDataFeed<Record> {
@@ -1944,6 +2104,7 @@ class MultiSlotInMemoryDataFeed : public InMemoryDataFeed<Record> {
  protected:
   virtual bool ParseOneInstance(Record* instance);
   virtual bool ParseOneInstanceFromPipe(Record* instance);
+  virtual bool KeepInstance(const Record& instance);
   virtual void ParseOneInstanceFromSo(const char* str UNUSED,
                                       Record* instance UNUSED,
                                       CustomParser* parser UNUSED) {}
@@ -14,6 +14,8 @@
 
 #include "paddle/fluid/framework/data_set.h"
 
+#include <sys/stat.h>
+
 #include "google/protobuf/text_format.h"
 #if (defined PADDLE_WITH_DISTRIBUTE) && (defined PADDLE_WITH_PSCORE)
 #include "paddle/fluid/distributed/index_dataset/index_sampler.h"
@@ -42,6 +44,9 @@ COMMON_DECLARE_bool(graph_get_neighbor_id);
 COMMON_DECLARE_int32(gpugraph_storage_mode);
 COMMON_DECLARE_string(graph_edges_split_mode);
 COMMON_DECLARE_bool(query_dest_rank_by_multi_node);
+COMMON_DECLARE_int32(reader_file_block_size_mb);
+COMMON_DECLARE_int32(reader_load_prefetch_depth);
+COMMON_DECLARE_int32(lockfree_feed_channel_capacity);
 
 namespace paddle {
 namespace framework {
@@ -98,6 +103,69 @@ void DatasetImpl<T>::SetFileList(const std::vector<std::string>& filelist) {
   VLOG(3) << "filelist size: " << filelist.size();
   filelist_ = filelist;
   file_idx_ = 0;
+  BuildFileBlocks();
+}
+
+// split large local files into byte-range blocks so that reader threads keep
+// stealing work from a big file instead of idling at the epoch tail. Block
+// mode is only used when every file is a plain seekable local file and the
+// pipe command does not transform the data; otherwise file_blocks_ stays
+// empty and the readers fall back to whole-file claims.
+template <typename T>
+void DatasetImpl<T>::BuildFileBlocks() {
+  file_blocks_.clear();
+  file_block_idx_ = 0;
+  if (FLAGS_reader_file_block_size_mb <= 0) {
+    return;
+  }
+  const std::string& pipe_command = data_feed_desc_.pipe_command();
+  if (!pipe_command.empty() && pipe_command != "cat") {
+    VLOG(3) << "BuildFileBlocks skipped, pipe_command=" << pipe_command;
+    return;
+  }
+  uint64_t block_size = static_cast<uint64_t>(FLAGS_reader_file_block_size_mb)
+                        << 20;
+  std::vector<FileDataBlock> blocks;
+  for (auto& file : filelist_) {
+    struct stat st;
+    if (file.size() >= 3 && file.compare(file.size() - 3, 3, ".gz") == 0) {
+      VLOG(3) << "BuildFileBlocks skipped, compressed file=" << file;
+      return;
+    }
+    if (stat(file.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+      VLOG(3) << "BuildFileBlocks skipped, not a local regular file=" << file;
+      return;
+    }
+    uint64_t file_size = static_cast<uint64_t>(st.st_size);
+    for (uint64_t offset = 0; offset < file_size; offset += block_size) {
+      FileDataBlock block;
+      block.filename = file;
+      block.offset = offset;
+      block.length = std::min(block_size, file_size - offset);
+      blocks.push_back(std::move(block));
+    }
+  }
+  file_blocks_ = std::move(blocks);
+  VLOG(3) << "BuildFileBlocks, file num=" << filelist_.size()
+          << ", block num=" << file_blocks_.size();
+}
+
+template <typename T>
+void DatasetImpl<T>::SetSampleFilter(const std::string& slot_name,
+                                     uint64_t lower,
+                                     uint64_t upper) {
+  VLOG(3) << "SetSampleFilter slot=" << slot_name << ", lower=" << lower
+          << ", upper=" << upper;
+  has_sample_filter_ = true;
+  sample_filter_slot_ = slot_name;
+  sample_filter_lower_ = lower;
+  sample_filter_upper_ = upper;
+  for (auto& reader : readers_) {
+    reader->SetSampleFilter(slot_name, lower, upper);
+  }
+  for (auto& reader : preload_readers_) {
+    reader->SetSampleFilter(slot_name, lower, upper);
+  }
 }
 
 // set expect thread num. actually it may change
@@ -249,7 +317,12 @@ std::vector<paddle::framework::DataFeed*> DatasetImpl<T>::GetReaders() {
 template <typename T>
 void DatasetImpl<T>::CreateChannel() {
   if (input_channel_ == nullptr) {
-    input_channel_ = paddle::framework::MakeChannel<T>();
+    if (FLAGS_lockfree_feed_channel_capacity > 0) {
+      input_channel_ = paddle::framework::MakeLockFreeChannel<T>(
+          FLAGS_lockfree_feed_channel_capacity);
+    } else {
+      input_channel_ = paddle::framework::MakeChannel<T>();
+    }
   }
   if (multi_output_channel_.empty()) {
     multi_output_channel_.reserve(channel_num_);
@@ -580,6 +653,11 @@ void DatasetImpl<T>::LoadIntoMemory() {
             << "]";
 #endif
   } else {
+    if (FLAGS_reader_load_prefetch_depth > 0) {
+      // controls how many records a reader buffers before publishing them to
+      // the input channel, i.e. the prefetch depth of each ChannelWriter
+      input_channel_->SetBlockSize(FLAGS_reader_load_prefetch_depth);
+    }
     std::vector<std::thread> load_threads;
     for (int64_t i = 0; i < thread_num_; ++i) {
       load_threads.emplace_back(&paddle::framework::DataFeed::LoadIntoMemory,
@@ -602,6 +680,9 @@ void DatasetImpl<T>::LoadIntoMemory() {
 template <typename T>
 void DatasetImpl<T>::PreLoadIntoMemory() {
   VLOG(3) << "DatasetImpl<T>::PreLoadIntoMemory() begin";
+  if (FLAGS_reader_load_prefetch_depth > 0) {
+    input_channel_->SetBlockSize(FLAGS_reader_load_prefetch_depth);
+  }
   if (preload_thread_num_ != 0) {
     CHECK(static_cast<size_t>(preload_thread_num_) == preload_readers_.size());
     preload_threads_.clear();
@@ -729,6 +810,15 @@ void DatasetImpl<T>::LocalShuffle() {
           << timeline.ElapsedSec() << " seconds";
 }
 
+template <typename T>
+void DatasetImpl<T>::WaitExternalShuffleDone() {
+  if (external_shuffle_thread_ != nullptr) {
+    external_shuffle_thread_->join();
+    delete external_shuffle_thread_;
+    external_shuffle_thread_ = nullptr;
+  }
+}
+
 template <typename T>
 void DatasetImpl<T>::DumpWalkPath(std::string dump_path, size_t dump_rate) {
   VLOG(3) << "DatasetImpl<T>::DumpWalkPath() begin";
@@ -953,6 +1043,344 @@ void MultiSlotDataset::GlobalShuffle(int thread_num) {
           << timeline.ElapsedSec() << " seconds";
 }
 
+// do external shuffle: spill random buckets to disk so that only one bucket
+// is ever resident, shuffle each bucket in memory and stream the buckets back
+// through input_channel_, whose capacity bounds the playback footprint.
+// Since every record picks its bucket at random, each bucket is an unbiased
+// sample of the whole dataset and shuffling buckets independently preserves
+// global shuffle quality.
+void MultiSlotDataset::ExternalShuffle(const std::string& spill_dir,
+                                       int bucket_num) {
+  VLOG(3) << "MultiSlotDataset::ExternalShuffle() begin";
+#ifdef _LINUX
+  platform::Timer timeline;
+  timeline.Start();
+  PADDLE_ENFORCE_GT(bucket_num,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "Bucket num %d is illegal in ExternalShuffle.",
+                        bucket_num));
+  if (!input_channel_ || input_channel_->Size() == 0) {
+    VLOG(3) << "MultiSlotDataset::ExternalShuffle() end, no data to shuffle";
+    return;
+  }
+  WaitExternalShuffleDone();
+  auto fleet_ptr = framework::FleetWrapper::GetInstance();
+  input_channel_->Close();
+  input_channel_->SetBlockSize(fleet_send_batch_size_);
+
+  // phase 1: spill every record into a random bucket file
+  std::vector<std::string> bucket_paths(bucket_num);
+  std::vector<std::ofstream> bucket_files(bucket_num);
+  for (int i = 0; i < bucket_num; ++i) {
+    bucket_paths[i] =
+        spill_dir + "/paddle_shuffle_bucket_" + std::to_string(i) + ".bin";
+    bucket_files[i].open(bucket_paths[i],
+                         std::ios::binary | std::ios::trunc);
+    PADDLE_ENFORCE_EQ(bucket_files[i].good(),
+                      true,
+                      platform::errors::Unavailable(
+                          "Failed to open spill file %s, please check the "
+                          "spill directory.",
+                          bucket_paths[i]));
+  }
+  std::vector<Record> data;
+  while (input_channel_->Read(data)) {
+    std::vector<paddle::framework::BinaryArchive> ars(bucket_num);
+    for (auto& t : data) {
+      ars[fleet_ptr->LocalRandomEngine()() % bucket_num] << t;
+    }
+    for (int i = 0; i < bucket_num; ++i) {
+      if (ars[i].Length() == 0) {
+        continue;
+      }
+      bucket_files[i].write(ars[i].Buffer(), ars[i].Length());
+    }
+    data.clear();
+    data.shrink_to_fit();
+  }
+  for (auto& bucket_file : bucket_files) {
+    bucket_file.close();
+  }
+  input_channel_->Clear();
+  input_channel_->Open();
+
+  // phase 2: play the buckets back in random order. This runs in the
+  // background because Write blocks once the channel reaches its capacity,
+  // so trainers consume early buckets while later ones are still on disk.
+  external_shuffle_thread_ = new std::thread([this, bucket_paths]() {
+    auto fleet_ptr = framework::FleetWrapper::GetInstance();
+    std::vector<std::string> playback_order = bucket_paths;
+    std::shuffle(playback_order.begin(),
+                 playback_order.end(),
+                 fleet_ptr->LocalRandomEngine());
+    for (const auto& path : playback_order) {
+      std::ifstream fin(path, std::ios::binary);
+      fin.seekg(0, std::ios::end);
+      std::string buf(static_cast<size_t>(fin.tellg()), '\0');
+      fin.seekg(0);
+      fin.read(&buf[0], buf.size());  // NOLINT
+      fin.close();
+      paddle::framework::BinaryArchive ar;
+      ar.SetReadBuffer(const_cast<char*>(buf.data()), buf.length(), nullptr);
+      std::vector<Record> bucket_data;
+      while (ar.Cursor() < ar.Finish()) {
+        bucket_data.push_back(ar.Get<Record>());
+      }
+      std::shuffle(bucket_data.begin(),
+                   bucket_data.end(),
+                   fleet_ptr->LocalRandomEngine());
+      this->input_channel_->Write(std::move(bucket_data));
+      std::remove(path.c_str());
+    }
+    this->input_channel_->Close();
+  });
+  timeline.Pause();
+  VLOG(3) << "MultiSlotDataset::ExternalShuffle() spill end, cost time="
+          << timeline.ElapsedSec()
+          << " seconds, bucket playback continues in background";
+#endif
+}
+
+namespace {
+inline void EncodeVarint(uint64_t value, std::vector<uint8_t>* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<uint8_t>(0x80 | (value & 0x7F)));
+    value >>= 7;
+  }
+  out->push_back(static_cast<uint8_t>(value));
+}
+
+inline uint64_t DecodeVarint(const uint8_t** cursor) {
+  uint64_t value = 0;
+  int shift = 0;
+  while (**cursor & 0x80) {
+    value |= static_cast<uint64_t>(**cursor & 0x7F) << shift;
+    shift += 7;
+    ++(*cursor);
+  }
+  value |= static_cast<uint64_t>(**cursor) << shift;
+  ++(*cursor);
+  return value;
+}
+
+inline uint64_t ZigzagEncode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t ZigzagDecode(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^
+         -static_cast<int64_t>(value & 1);
+}
+}  // namespace
+
+// do columnar repack: drain the input channel into slot-major blocks, so all
+// feasigns of one slot are contiguous and uint64 feature ids compress with
+// zigzag-delta varint coding. The row-major records are freed as each block
+// fills, so peak memory stays near one block above the columnar footprint.
+void MultiSlotDataset::ConvertToColumnarFormat(int block_size) {
+  VLOG(3) << "MultiSlotDataset::ConvertToColumnarFormat() begin";
+  platform::Timer timeline;
+  timeline.Start();
+  PADDLE_ENFORCE_GT(
+      block_size,
+      0,
+      platform::errors::InvalidArgument(
+          "Block size %d is illegal in ConvertToColumnarFormat.", block_size));
+  if (!input_channel_ || input_channel_->Size() == 0) {
+    VLOG(3) << "MultiSlotDataset::ConvertToColumnarFormat() end, no data";
+    return;
+  }
+  input_channel_->Close();
+  input_channel_->SetBlockSize(block_size);
+  columnar_blocks_.clear();
+  std::vector<Record> data;
+  while (input_channel_->Read(data)) {
+    columnar_blocks_.emplace_back();
+    ColumnarRecordBlock& block = columnar_blocks_.back();
+    block.ins_num = data.size();
+    block.ins_ids.reserve(data.size());
+    block.contents.reserve(data.size());
+    block.uids.reserve(data.size());
+    block.search_ids.reserve(data.size());
+    block.ranks.reserve(data.size());
+    block.cmatches.reserve(data.size());
+    // previous value per slot, reset per block so blocks decode standalone
+    std::unordered_map<uint16_t, uint64_t> prev_values;
+    for (auto& rec : data) {
+      for (auto& item : block.uint64_counts) {
+        item.second.resize(block.ins_ids.size(), 0);
+      }
+      for (auto& item : block.float_counts) {
+        item.second.resize(block.ins_ids.size(), 0);
+      }
+      for (auto& item : rec.uint64_feasigns_) {
+        uint16_t slot = item.slot();
+        auto& counts = block.uint64_counts[slot];
+        counts.resize(block.ins_ids.size() + 1, 0);
+        ++counts.back();
+        uint64_t value = item.sign().uint64_feasign_;
+        uint64_t& prev = prev_values[slot];
+        EncodeVarint(
+            ZigzagEncode(static_cast<int64_t>(value) -
+                         static_cast<int64_t>(prev)),
+            &block.uint64_columns[slot]);
+        prev = value;
+      }
+      for (auto& item : rec.float_feasigns_) {
+        uint16_t slot = item.slot();
+        auto& counts = block.float_counts[slot];
+        counts.resize(block.ins_ids.size() + 1, 0);
+        ++counts.back();
+        block.float_columns[slot].push_back(item.sign().float_feasign_);
+      }
+      block.ins_ids.push_back(std::move(rec.ins_id_));
+      block.contents.push_back(std::move(rec.content_));
+      block.uids.push_back(std::move(rec.uid_));
+      block.search_ids.push_back(rec.search_id);
+      block.ranks.push_back(rec.rank);
+      block.cmatches.push_back(rec.cmatch);
+    }
+    // pad trailing instances that never touched a slot
+    for (auto& item : block.uint64_counts) {
+      item.second.resize(block.ins_num, 0);
+    }
+    for (auto& item : block.float_counts) {
+      item.second.resize(block.ins_num, 0);
+    }
+    data.clear();
+    data.shrink_to_fit();
+  }
+  input_channel_->Clear();
+  timeline.Pause();
+  VLOG(3) << "MultiSlotDataset::ConvertToColumnarFormat() end, "
+          << columnar_blocks_.size() << " blocks, cost time="
+          << timeline.ElapsedSec() << " seconds";
+}
+
+void MultiSlotDataset::RestoreFromColumnarFormat() {
+  VLOG(3) << "MultiSlotDataset::RestoreFromColumnarFormat() begin";
+  platform::Timer timeline;
+  timeline.Start();
+  if (columnar_blocks_.empty()) {
+    VLOG(3) << "MultiSlotDataset::RestoreFromColumnarFormat() end, no data";
+    return;
+  }
+  CHECK(input_channel_ != nullptr);
+  // resolve the sample filter slot name to its used-slot index, which is the
+  // key space of the columnar blocks
+  int filter_slot = -1;
+  if (has_sample_filter_) {
+    int used = 0;
+    for (auto& slot : data_feed_desc_.multi_slot_desc().slots()) {
+      if (!slot.is_used()) {
+        continue;
+      }
+      if (slot.name() == sample_filter_slot_) {
+        filter_slot = used;
+        break;
+      }
+      ++used;
+    }
+    PADDLE_ENFORCE_GE(filter_slot,
+                      0,
+                      platform::errors::InvalidArgument(
+                          "Slot %s of the sample filter is not a used slot.",
+                          sample_filter_slot_));
+  }
+  input_channel_->Open();
+  for (auto& block : columnar_blocks_) {
+    // With a sample filter, decode only the filtered slot's column first and
+    // compute which instances survive, so dropped instances are never
+    // materialized as records.
+    std::vector<size_t> out_idx(block.ins_num);
+    size_t kept_num = block.ins_num;
+    if (filter_slot >= 0) {
+      std::vector<bool> keep(block.ins_num, false);
+      auto column =
+          block.uint64_columns.find(static_cast<uint16_t>(filter_slot));
+      if (column != block.uint64_columns.end()) {
+        const auto& counts = block.uint64_counts[column->first];
+        const uint8_t* cursor = column->second.data();
+        uint64_t prev = 0;
+        for (size_t i = 0; i < block.ins_num; ++i) {
+          for (uint16_t j = 0; j < counts[i]; ++j) {
+            prev = static_cast<uint64_t>(static_cast<int64_t>(prev) +
+                                         ZigzagDecode(DecodeVarint(&cursor)));
+            if (prev >= sample_filter_lower_ && prev <= sample_filter_upper_) {
+              keep[i] = true;
+            }
+          }
+        }
+      }
+      kept_num = 0;
+      for (size_t i = 0; i < block.ins_num; ++i) {
+        out_idx[i] = keep[i] ? kept_num++ : block.ins_num;
+      }
+    } else {
+      for (size_t i = 0; i < block.ins_num; ++i) {
+        out_idx[i] = i;
+      }
+    }
+    std::vector<Record> data(kept_num);
+    for (auto& column : block.uint64_columns) {
+      uint16_t slot = column.first;
+      const auto& counts = block.uint64_counts[slot];
+      const uint8_t* cursor = column.second.data();
+      uint64_t prev = 0;
+      for (size_t i = 0; i < block.ins_num; ++i) {
+        for (uint16_t j = 0; j < counts[i]; ++j) {
+          prev = static_cast<uint64_t>(static_cast<int64_t>(prev) +
+                                       ZigzagDecode(DecodeVarint(&cursor)));
+          if (out_idx[i] == block.ins_num) {
+            continue;
+          }
+          FeatureFeasign sign;
+          sign.uint64_feasign_ = prev;
+          data[out_idx[i]].uint64_feasigns_.emplace_back(sign, slot);
+        }
+      }
+    }
+    for (auto& column : block.float_columns) {
+      uint16_t slot = column.first;
+      const auto& counts = block.float_counts[slot];
+      size_t pos = 0;
+      for (size_t i = 0; i < block.ins_num; ++i) {
+        for (uint16_t j = 0; j < counts[i]; ++j) {
+          float value = column.second[pos++];
+          if (out_idx[i] == block.ins_num) {
+            continue;
+          }
+          FeatureFeasign sign;
+          sign.float_feasign_ = value;
+          data[out_idx[i]].float_feasigns_.emplace_back(sign, slot);
+        }
+      }
+    }
+    for (size_t i = 0; i < block.ins_num; ++i) {
+      if (out_idx[i] == block.ins_num) {
+        continue;
+      }
+      data[out_idx[i]].ins_id_ = std::move(block.ins_ids[i]);
+      data[out_idx[i]].content_ = std::move(block.contents[i]);
+      data[out_idx[i]].uid_ = std::move(block.uids[i]);
+      data[out_idx[i]].search_id = block.search_ids[i];
+      data[out_idx[i]].rank = block.ranks[i];
+      data[out_idx[i]].cmatch = block.cmatches[i];
+    }
+    if (!data.empty()) {
+      input_channel_->Write(std::move(data));
+    }
+  }
+  input_channel_->Close();
+  columnar_blocks_.clear();
+  columnar_blocks_.shrink_to_fit();
+  timeline.Pause();
+  VLOG(3) << "MultiSlotDataset::RestoreFromColumnarFormat() end, cost time="
+          << timeline.ElapsedSec() << " seconds";
+}
+
 template <typename T>
 void DatasetImpl<T>::DynamicAdjustChannelNum(int channel_num,
                                              bool discard_remaining_ins) {
@@ -1093,6 +1521,8 @@ void DatasetImpl<T>::SetFleetSendSleepSeconds(int seconds) {
 template <typename T>
 void DatasetImpl<T>::CreateReaders() {
   VLOG(3) << "Calling CreateReaders()";
+  // the pipe command is final here, so recompute the block list with it
+  BuildFileBlocks();
   VLOG(3) << "thread num in Dataset: " << thread_num_;
   VLOG(3) << "Filelist size in Dataset: " << filelist_.size();
   VLOG(3) << "channel num in Dataset: " << channel_num_;
@@ -1114,11 +1544,16 @@ void DatasetImpl<T>::CreateReaders() {
     readers_[i]->SetThreadNum(thread_num_);
     readers_[i]->SetFileListMutex(&mutex_for_pick_file_);
     readers_[i]->SetFileListIndex(&file_idx_);
+    readers_[i]->SetFileBlockList(&file_blocks_, &file_block_idx_);
     readers_[i]->SetFeaNumMutex(&mutex_for_fea_num_);
     readers_[i]->SetFeaNum(&total_fea_num_);
     readers_[i]->SetFileList(filelist_);
     readers_[i]->SetParseInsId(parse_ins_id_);
     readers_[i]->SetParseUid(parse_uid_);
+    if (has_sample_filter_) {
+      readers_[i]->SetSampleFilter(
+          sample_filter_slot_, sample_filter_lower_, sample_filter_upper_);
+    }
     readers_[i]->SetParseContent(parse_content_);
     readers_[i]->SetParseLogKey(parse_logkey_);
     readers_[i]->SetEnablePvMerge(enable_pv_merge_);
@@ -1171,6 +1606,7 @@ void DatasetImpl<T>::SetPreLoadThreadNum(int thread_num) {
 template <typename T>
 void DatasetImpl<T>::CreatePreLoadReaders() {
   VLOG(3) << "Begin CreatePreLoadReaders";
+  BuildFileBlocks();
   if (preload_thread_num_ == 0) {
     preload_thread_num_ = thread_num_;
   }
@@ -1185,11 +1621,16 @@ void DatasetImpl<T>::CreatePreLoadReaders() {
     preload_readers_[i]->SetThreadNum(preload_thread_num_);
     preload_readers_[i]->SetFileListMutex(&mutex_for_pick_file_);
     preload_readers_[i]->SetFileListIndex(&file_idx_);
+    preload_readers_[i]->SetFileBlockList(&file_blocks_, &file_block_idx_);
     preload_readers_[i]->SetFileList(filelist_);
     preload_readers_[i]->SetFeaNumMutex(&mutex_for_fea_num_);
     preload_readers_[i]->SetFeaNum(&total_fea_num_);
     preload_readers_[i]->SetParseInsId(parse_ins_id_);
     preload_readers_[i]->SetParseUid(parse_uid_);
+    if (has_sample_filter_) {
+      preload_readers_[i]->SetSampleFilter(
+          sample_filter_slot_, sample_filter_lower_, sample_filter_upper_);
+    }
     preload_readers_[i]->SetParseContent(parse_content_);
     preload_readers_[i]->SetParseLogKey(parse_logkey_);
     preload_readers_[i]->SetEnablePvMerge(enable_pv_merge_);
@@ -1880,7 +2321,12 @@ void MultiSlotDataset::SlotsShuffle(
 template class DatasetImpl<SlotRecord>;
 void SlotRecordDataset::CreateChannel() {
   if (input_channel_ == nullptr) {
-    input_channel_ = paddle::framework::MakeChannel<SlotRecord>();
+    if (FLAGS_lockfree_feed_channel_capacity > 0) {
+      input_channel_ = paddle::framework::MakeLockFreeChannel<SlotRecord>(
+          FLAGS_lockfree_feed_channel_capacity);
+    } else {
+      input_channel_ = paddle::framework::MakeChannel<SlotRecord>();
+    }
   }
 }
 void SlotRecordDataset::CreateReaders() {
@@ -1907,6 +2353,7 @@ void SlotRecordDataset::CreateReaders() {
     readers_[i]->SetThreadNum(thread_num_);
     readers_[i]->SetFileListMutex(&mutex_for_pick_file_);
     readers_[i]->SetFileListIndex(&file_idx_);
+    readers_[i]->SetFileBlockList(&file_blocks_, &file_block_idx_);
     readers_[i]->SetFeaNumMutex(&mutex_for_fea_num_);
     readers_[i]->SetFeaNum(&total_fea_num_);
     readers_[i]->SetFileList(filelist_);
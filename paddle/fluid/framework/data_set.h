@@ -127,6 +127,22 @@ class Dataset {
   virtual void LocalShuffle() = 0;
   // global shuffle data
   virtual void GlobalShuffle(int thread_num = -1) = 0;
+  // external shuffle data: spill random buckets to disk, shuffle each bucket
+  // in memory and stream the buckets back, for datasets beyond host memory
+  virtual void ExternalShuffle(const std::string& spill_dir,
+                               int bucket_num) = 0;
+  // wait external shuffle playback done
+  virtual void WaitExternalShuffleDone() = 0;
+  // repack in-memory data into columnar slot-major blocks
+  virtual void ConvertToColumnarFormat(int block_size) = 0;
+  // rebuild records from columnar blocks into the input channel
+  virtual void RestoreFromColumnarFormat() = 0;
+  // keep only samples whose uint64 slot holds a value in [lower, upper];
+  // the predicate is pushed down into the reader threads and the columnar
+  // restore path, so filtered samples are never materialized
+  virtual void SetSampleFilter(const std::string& slot_name,
+                               uint64_t lower,
+                               uint64_t upper) = 0;
   virtual void SlotsShuffle(const std::set<std::string>& slots_to_replace) = 0;
   // create readers
   virtual void CreateReaders() = 0;
@@ -199,6 +215,7 @@ class DatasetImpl : public Dataset {
     if (release_thread_ != nullptr) {
       release_thread_->join();
     }
+    WaitExternalShuffleDone();
   }
   virtual void SetFileList(const std::vector<std::string>& filelist);
   virtual void ReleaseMemoryFun();
@@ -248,6 +265,14 @@ class DatasetImpl : public Dataset {
   virtual void ReleaseMemory();
   virtual void LocalShuffle();
   virtual void GlobalShuffle(int thread_num UNUSED = -1) {}
+  virtual void ExternalShuffle(const std::string& spill_dir UNUSED,
+                               int bucket_num UNUSED) {}
+  virtual void WaitExternalShuffleDone();
+  virtual void ConvertToColumnarFormat(int block_size UNUSED) {}
+  virtual void RestoreFromColumnarFormat() {}
+  virtual void SetSampleFilter(const std::string& slot_name,
+                               uint64_t lower,
+                               uint64_t upper);
   virtual void SlotsShuffle(
       const std::set<std::string>& slots_to_replace UNUSED) {}
   virtual const std::vector<T>& GetSlotsOriginalData() {
@@ -316,6 +341,8 @@ class DatasetImpl : public Dataset {
     // TODO(yaoxuefeng) for SlotRecordDataset
     return -1;
   }
+  // rebuild file_blocks_ from filelist_, see FLAGS_reader_file_block_size_mb
+  void BuildFileBlocks();
   std::vector<std::shared_ptr<paddle::framework::DataFeed>> readers_;
   std::vector<std::shared_ptr<paddle::framework::DataFeed>> preload_readers_;
   paddle::framework::Channel<T> input_channel_;
@@ -339,6 +366,15 @@ class DatasetImpl : public Dataset {
   int trainer_num_;
   std::vector<std::string> filelist_;
   size_t file_idx_;
+  // byte-range blocks of large local files, claimed one at a time by the
+  // reader threads so that a big file does not become an epoch-tail straggler
+  std::vector<FileDataBlock> file_blocks_;
+  size_t file_block_idx_ = 0;
+  // sample filter pushed down into the readers, see SetSampleFilter
+  bool has_sample_filter_ = false;
+  std::string sample_filter_slot_;
+  uint64_t sample_filter_lower_ = 0;
+  uint64_t sample_filter_upper_ = 0;
   uint64_t total_fea_num_;
   std::mutex mutex_for_pick_file_;
   std::mutex mutex_for_fea_num_;
@@ -348,6 +384,9 @@ class DatasetImpl : public Dataset {
   int64_t fleet_send_sleep_seconds_;
   std::vector<std::thread> preload_threads_;
   std::thread* release_thread_ = nullptr;
+  // streams shuffled spill buckets back into input_channel_, see
+  // ExternalShuffle
+  std::thread* external_shuffle_thread_ = nullptr;
   bool merge_by_insid_;
   bool parse_ins_id_;
   bool parse_content_;
@@ -380,6 +419,26 @@ class DatasetImpl : public Dataset {
   uint32_t pass_id_ = 0;
 };
 
+// Slot-major storage for one block of Record instances. All feasigns of one
+// slot are contiguous, so batch assembly for a slot becomes one sequential
+// copy instead of a gather over scattered records. uint64 columns are
+// zigzag-delta varint encoded (feature ids within one slot are typically
+// clustered, so consecutive deltas are short), float columns are stored raw;
+// per-instance value counts allow exact record reconstruction.
+struct ColumnarRecordBlock {
+  size_t ins_num = 0;
+  std::unordered_map<uint16_t, std::vector<uint8_t>> uint64_columns;
+  std::unordered_map<uint16_t, std::vector<float>> float_columns;
+  std::unordered_map<uint16_t, std::vector<uint16_t>> uint64_counts;
+  std::unordered_map<uint16_t, std::vector<uint16_t>> float_counts;
+  std::vector<std::string> ins_ids;
+  std::vector<std::string> contents;
+  std::vector<std::string> uids;
+  std::vector<uint64_t> search_ids;
+  std::vector<uint32_t> ranks;
+  std::vector<uint32_t> cmatches;
+};
+
 // use std::vector<MultiSlotType> or Record as data type
 class MultiSlotDataset : public DatasetImpl<Record> {
  public:
@@ -416,6 +475,9 @@ class MultiSlotDataset : public DatasetImpl<Record> {
       std::vector<Record>* result);
   virtual ~MultiSlotDataset() {}
   virtual void GlobalShuffle(int thread_num = -1);
+  virtual void ExternalShuffle(const std::string& spill_dir, int bucket_num);
+  virtual void ConvertToColumnarFormat(int block_size);
+  virtual void RestoreFromColumnarFormat();
   virtual void DynamicAdjustReadersNum(int thread_num);
   virtual void PrepareTrain();
 
@@ -423,6 +485,7 @@ class MultiSlotDataset : public DatasetImpl<Record> {
   virtual int ReceiveFromClient(int msg_type,
                                 int client_id,
                                 const std::string& msg);
+  std::vector<ColumnarRecordBlock> columnar_blocks_;
 };
 class SlotRecordDataset : public DatasetImpl<SlotRecord> {
  public:
@@ -14,14 +14,20 @@
 
 #include "paddle/fluid/framework/executor_cache.h"
 
+#include <cstdio>
+#include <fstream>
+
 #include "paddle/common/flags.h"
 #include "paddle/common/macros.h"
 #include "paddle/fluid/framework/new_executor/interpretercore.h"
 #include "paddle/fluid/framework/op_info.h"
 #include "paddle/fluid/ir_adaptor/translator/translate.h"
+#include "paddle/fluid/pir/dialect/kernel/ir/kernel_dialect.h"
+#include "paddle/fluid/pir/serialize_deserialize/include/interface.h"
 #include "paddle/fluid/pir/transforms/general/inplace_pass.h"
 #include "paddle/fluid/pir/transforms/general/remove_shadow_feed_pass.h"
 #include "paddle/fluid/pir/transforms/pd_op_to_kernel_pass.h"
+#include "paddle/phi/common/port.h"
 #include "paddle/pir/include/core/program.h"
 #include "paddle/pir/include/core/value.h"
 #include "paddle/pir/include/pass/pass.h"
@@ -31,6 +37,7 @@ DECLARE_FILE_SYMBOLS(print_statistics);
 
 COMMON_DECLARE_bool(pir_apply_inplace_pass);
 COMMON_DECLARE_bool(print_ir);
+COMMON_DECLARE_string(executor_program_cache_dir);
 
 namespace paddle::framework {
 class ProgramDesc;
@@ -170,8 +177,80 @@ bool TensorSortHelper(const paddle::Tensor &t1, const paddle::Tensor &t2) {
   return t1.name() < t2.name();
 }
 
+namespace {
+
+constexpr uint64_t kCachedProgramPirVersion = 1;
+
+// The printed IR covers the whole op graph together with every shape,
+// dtype and attribute, so its hash doubles as the function signature and
+// input spec key the persistent cache is indexed by: any change to the
+// traced function or to its input specs produces a different file name,
+// which is all the re-validation a lookup needs.
+std::string CachedProgramPath(const ::pir::Program &program,
+                              const phi::Place &place) {
+  std::ostringstream ss;
+  ss << program;
+  ss << place << FLAGS_pir_apply_inplace_pass;
+  std::ostringstream path;
+  path << FLAGS_executor_program_cache_dir << "/pir_program_" << std::hex
+       << std::hash<std::string>()(ss.str()) << ".pirmodel";
+  return path.str();
+}
+
+std::unique_ptr<::pir::Program> LoadCachedProgram(const std::string &path) {
+  if (!std::ifstream(path).good()) {
+    return nullptr;
+  }
+  // the cached program is in the kernel dialect, which is normally only
+  // registered by the lowering pass we are about to skip
+  auto *ctx = ::pir::IrContext::Instance();
+  ctx->GetOrRegisterDialect<paddle::dialect::KernelDialect>();
+  auto program = std::make_unique<::pir::Program>(ctx);
+  try {
+    pir::ReadModule(path, program.get(), kCachedProgramPirVersion);
+  } catch (const std::exception &e) {
+    LOG(WARNING) << "Ignore unreadable cached program " << path << ": "
+                 << e.what();
+    return nullptr;
+  }
+  return program;
+}
+
+void SaveProgramToCache(const ::pir::Program &program,
+                        const std::string &path) {
+  try {
+    MkDirRecursively(FLAGS_executor_program_cache_dir.c_str());
+    pir::WriteModule(program,
+                     path,
+                     kCachedProgramPirVersion,
+                     /*overwrite=*/true,
+                     /*readable=*/false,
+                     /*trainable=*/true,
+                     /*binary=*/true);
+    VLOG(2) << "Persisted optimized program to " << path;
+  } catch (const std::exception &e) {
+    // best effort cache, an unserializable program only costs a rebuild
+    // on the next restart
+    LOG(WARNING) << "Cannot persist optimized program to " << path << ": "
+                 << e.what();
+    std::remove(path.c_str());
+  }
+}
+
+}  // namespace
+
 std::unique_ptr<::pir::Program> ApplyIrPass(::pir::Program *program,
                                             phi::Place place) {
+  std::string cache_path;
+  if (!FLAGS_executor_program_cache_dir.empty()) {
+    cache_path = CachedProgramPath(*program, place);
+    auto cached = LoadCachedProgram(cache_path);
+    if (cached) {
+      VLOG(2) << "Reuse persisted optimized program " << cache_path;
+      return cached;
+    }
+  }
+
   auto ir_res = paddle::dialect::PdOpLowerToKernelPass(program, place);
 
   if (FLAGS_pir_apply_inplace_pass) {
@@ -185,6 +264,10 @@ std::unique_ptr<::pir::Program> ApplyIrPass(::pir::Program *program,
     }
   }
 
+  if (!cache_path.empty()) {
+    SaveProgramToCache(*ir_res, cache_path);
+  }
+
   return ir_res;
 }
 
@@ -372,6 +455,16 @@ std::unique_ptr<::pir::Program> ConstructBackwardIrProgram(
 
   auto program = TranslateLegacyProgramToProgram(local_program);
 
+  std::string cache_path;
+  if (!FLAGS_executor_program_cache_dir.empty()) {
+    cache_path = CachedProgramPath(*program, place);
+    auto cached = LoadCachedProgram(cache_path);
+    if (cached) {
+      VLOG(2) << "Reuse persisted optimized program " << cache_path;
+      return cached;
+    }
+  }
+
   auto res = paddle::dialect::PdOpLowerToKernelPass(program.get(), place);
 
   if (FLAGS_pir_apply_inplace_pass) {
@@ -388,6 +481,10 @@ std::unique_ptr<::pir::Program> ConstructBackwardIrProgram(
     }
   }
 
+  if (!cache_path.empty()) {
+    SaveProgramToCache(*res, cache_path);
+  }
+
   return res;
 }
 
@@ -0,0 +1,227 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#if defined(PADDLE_WITH_CUDA) && !defined(WITH_NV_JETSON) && \
+    !defined(PADDLE_WITH_HIP)
+
+#include "paddle/fluid/framework/gpu_jpeg_decoder.h"
+
+#include <algorithm>
+
+#include "paddle/fluid/platform/cuda_device_guard.h"
+#include "paddle/fluid/platform/device_context.h"
+#include "paddle/fluid/platform/dynload/nvjpeg.h"
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle {
+namespace framework {
+
+namespace {
+
+// native resolution and planar RGB base of one decoded image, consumed by
+// the fused resize/normalize kernel
+struct DecodedImageMeta {
+  const uint8_t* data;
+  int width;
+  int height;
+};
+
+constexpr int kDecodeKernelThreads = 512;
+
+#define NVJPEG_CHECK(call)                                          \
+  do {                                                              \
+    nvjpegStatus_t _status = (call);                                \
+    PADDLE_ENFORCE_EQ(_status,                                      \
+                      NVJPEG_STATUS_SUCCESS,                        \
+                      platform::errors::Fatal(#call " failed: %d",  \
+                                              static_cast<int>(_status))); \
+  } while (0)
+
+__global__ void FusedResizeNormalizeNhwcKernel(
+    const DecodedImageMeta* metas,
+    const int batch,
+    const int out_h,
+    const int out_w,
+    const float mean_r,
+    const float mean_g,
+    const float mean_b,
+    const float std_r,
+    const float std_g,
+    const float std_b,
+    float* dst) {
+  const int64_t total = static_cast<int64_t>(batch) * out_h * out_w * 3;
+  for (int64_t idx = blockIdx.x * blockDim.x + threadIdx.x; idx < total;
+       idx += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    int c = idx % 3;
+    int64_t pixel = idx / 3;
+    int x = pixel % out_w;
+    pixel /= out_w;
+    int y = pixel % out_h;
+    int n = pixel / out_h;
+
+    const DecodedImageMeta meta = metas[n];
+    const uint8_t* plane =
+        meta.data + static_cast<size_t>(c) * meta.width * meta.height;
+
+    // bilinear sample at the pixel-center-aligned source position
+    float fx = (x + 0.5f) * meta.width / out_w - 0.5f;
+    float fy = (y + 0.5f) * meta.height / out_h - 0.5f;
+    int x0 = max(static_cast<int>(floorf(fx)), 0);
+    int y0 = max(static_cast<int>(floorf(fy)), 0);
+    int x1 = min(x0 + 1, meta.width - 1);
+    int y1 = min(y0 + 1, meta.height - 1);
+    float ax = fx - floorf(fx);
+    float ay = fy - floorf(fy);
+
+    float v00 = plane[static_cast<size_t>(y0) * meta.width + x0];
+    float v01 = plane[static_cast<size_t>(y0) * meta.width + x1];
+    float v10 = plane[static_cast<size_t>(y1) * meta.width + x0];
+    float v11 = plane[static_cast<size_t>(y1) * meta.width + x1];
+    float v = (v00 * (1.f - ax) + v01 * ax) * (1.f - ay) +
+              (v10 * (1.f - ax) + v11 * ax) * ay;
+
+    float mean = (c == 0) ? mean_r : ((c == 1) ? mean_g : mean_b);
+    float stddev = (c == 0) ? std_r : ((c == 1) ? std_g : std_b);
+    dst[idx] = (v / 255.f - mean) / stddev;
+  }
+}
+
+}  // namespace
+
+GpuJpegDecoder::GpuJpegDecoder(const phi::GPUPlace& place) : place_(place) {}
+
+GpuJpegDecoder::~GpuJpegDecoder() {
+  if (state_ != nullptr) {
+    platform::dynload::nvjpegJpegStateDestroy(state_);
+  }
+  if (handle_ != nullptr) {
+    platform::dynload::nvjpegDestroy(handle_);
+  }
+  if (stream_ != nullptr) {
+    cudaStreamDestroy(stream_);
+  }
+}
+
+void* GpuJpegDecoder::EnsureScratch(
+    memory::allocation::AllocationPtr* buffer, size_t* capacity, size_t bytes) {
+  if (bytes > *capacity) {
+    *buffer = memory::Alloc(place_, bytes);
+    *capacity = bytes;
+  }
+  return (*buffer)->ptr();
+}
+
+void GpuJpegDecoder::DecodeBatch(const std::vector<const uint8_t*>& bitstreams,
+                                 const std::vector<size_t>& lengths,
+                                 int height,
+                                 int width,
+                                 const float* mean,
+                                 const float* std,
+                                 phi::DenseTensor* out) {
+  PADDLE_ENFORCE_EQ(bitstreams.size(),
+                    lengths.size(),
+                    platform::errors::InvalidArgument(
+                        "Bitstream number %zu mismatches length number %zu.",
+                        bitstreams.size(),
+                        lengths.size()));
+  int batch = static_cast<int>(bitstreams.size());
+  PADDLE_ENFORCE_GT(batch,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "The decode batch can not be empty."));
+  platform::CUDADeviceGuard guard(place_.device);
+  if (handle_ == nullptr) {
+    NVJPEG_CHECK(platform::dynload::nvjpegCreateSimple(&handle_));
+    NVJPEG_CHECK(platform::dynload::nvjpegJpegStateCreate(handle_, &state_));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+  }
+  if (batched_batch_size_ != batch) {
+    NVJPEG_CHECK(platform::dynload::nvjpegDecodeBatchedInitialize(
+        handle_, state_, batch, 1 /* max_cpu_threads */, NVJPEG_OUTPUT_RGB));
+    batched_batch_size_ = batch;
+  }
+
+  // probe native resolutions and lay the decoded planes out back to back
+  std::vector<DecodedImageMeta> metas(batch);
+  size_t rgb_bytes = 0;
+  for (int i = 0; i < batch; ++i) {
+    int components;
+    nvjpegChromaSubsampling_t subsampling;
+    int widths[NVJPEG_MAX_COMPONENT];
+    int heights[NVJPEG_MAX_COMPONENT];
+    NVJPEG_CHECK(platform::dynload::nvjpegGetImageInfo(handle_,
+                                                       bitstreams[i],
+                                                       lengths[i],
+                                                       &components,
+                                                       &subsampling,
+                                                       widths,
+                                                       heights));
+    metas[i].width = widths[0];
+    metas[i].height = heights[0];
+    rgb_bytes += static_cast<size_t>(3) * widths[0] * heights[0];
+  }
+  uint8_t* rgb_base = static_cast<uint8_t*>(
+      EnsureScratch(&rgb_scratch_, &rgb_scratch_bytes_, rgb_bytes));
+
+  std::vector<nvjpegImage_t> images(batch);
+  size_t offset = 0;
+  for (int i = 0; i < batch; ++i) {
+    size_t plane_size =
+        static_cast<size_t>(metas[i].width) * metas[i].height;
+    metas[i].data = rgb_base + offset;
+    for (int c = 0; c < NVJPEG_MAX_COMPONENT; ++c) {
+      images[i].channel[c] = nullptr;
+      images[i].pitch[c] = 0;
+    }
+    for (int c = 0; c < 3; ++c) {
+      images[i].channel[c] = rgb_base + offset + c * plane_size;
+      images[i].pitch[c] = metas[i].width;
+    }
+    offset += 3 * plane_size;
+  }
+
+  NVJPEG_CHECK(platform::dynload::nvjpegDecodeBatched(
+      handle_, state_, bitstreams.data(), lengths.data(), images.data(),
+      stream_));
+
+  // ship the per-image metadata and fuse resize + normalize into NHWC
+  auto* metas_dev = static_cast<DecodedImageMeta*>(EnsureScratch(
+      &meta_scratch_, &meta_scratch_bytes_, batch * sizeof(DecodedImageMeta)));
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaMemcpyAsync(metas_dev,
+                                             metas.data(),
+                                             batch * sizeof(DecodedImageMeta),
+                                             cudaMemcpyHostToDevice,
+                                             stream_));
+
+  out->Resize(common::make_ddim({batch, height, width, 3}));
+  auto* dev_ctx = static_cast<phi::GPUContext*>(
+      platform::DeviceContextPool::Instance().Get(place_));
+  float* dst = dev_ctx->Alloc<float>(out);
+
+  int64_t total = static_cast<int64_t>(batch) * height * width * 3;
+  int blocks = static_cast<int>(
+      std::min<int64_t>((total + kDecodeKernelThreads - 1) /
+                            kDecodeKernelThreads,
+                        65535));
+  FusedResizeNormalizeNhwcKernel<<<blocks, kDecodeKernelThreads, 0, stream_>>>(
+      metas_dev, batch, height, width, mean[0], mean[1], mean[2], std[0],
+      std[1], std[2], dst);
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaStreamSynchronize(stream_));
+}
+
+}  // namespace framework
+}  // namespace paddle
+
+#endif
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) && !defined(WITH_NV_JETSON) && \
+    !defined(PADDLE_WITH_HIP)
+
+#include <cuda_runtime.h>
+#include <nvjpeg.h>
+
+#include <vector>
+
+#include "paddle/fluid/memory/malloc.h"
+#include "paddle/phi/core/dense_tensor.h"
+
+namespace paddle {
+namespace framework {
+
+// GPU decode stage for the data pipeline: decodes a batch of JPEG
+// bitstreams with nvJPEG's batched API and produces one device-resident
+// NHWC float tensor, applying resize and per-channel normalization in a
+// single fused kernel over the decoded planes. All device scratch goes
+// through memory::Alloc, so buffers come out of the allocator facade's
+// pool and are reused across batches. One decoder per device; not thread
+// safe, give each loader thread its own instance.
+class GpuJpegDecoder {
+ public:
+  explicit GpuJpegDecoder(const phi::GPUPlace& place);
+  ~GpuJpegDecoder();
+
+  GpuJpegDecoder(const GpuJpegDecoder&) = delete;
+  GpuJpegDecoder& operator=(const GpuJpegDecoder&) = delete;
+
+  // Decode `bitstreams` into `out` with shape [batch, height, width, 3].
+  // Each output value is (pixel / 255 - mean[c]) / std[c]; images are
+  // bilinearly resized from their native resolution to height x width.
+  // Blocks until the batch is fully decoded on the device.
+  void DecodeBatch(const std::vector<const uint8_t*>& bitstreams,
+                   const std::vector<size_t>& lengths,
+                   int height,
+                   int width,
+                   const float* mean,
+                   const float* std,
+                   phi::DenseTensor* out);
+
+ private:
+  // grow-only scratch block served by the allocator facade
+  void* EnsureScratch(memory::allocation::AllocationPtr* buffer,
+                      size_t* capacity,
+                      size_t bytes);
+
+  phi::GPUPlace place_;
+  nvjpegHandle_t handle_ = nullptr;
+  nvjpegJpegState_t state_ = nullptr;
+  cudaStream_t stream_ = nullptr;
+  int batched_batch_size_ = 0;
+  // decoded planar RGB planes of the whole batch
+  memory::allocation::AllocationPtr rgb_scratch_;
+  size_t rgb_scratch_bytes_ = 0;
+  // per-image metadata (plane pointer and native size) for the fused kernel
+  memory::allocation::AllocationPtr meta_scratch_;
+  size_t meta_scratch_bytes_ = 0;
+};
+
+}  // namespace framework
+}  // namespace paddle
+
+#endif
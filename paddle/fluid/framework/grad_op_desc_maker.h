@@ -157,11 +157,11 @@ class GradOpDescMakerBase {
     return fwd_op_.Output(name);
   }
 
-  const std::unordered_map<std::string, Attribute>& Attrs() const {
+  const AttributeMap& Attrs() const {
     return fwd_op_.GetAttrMap();
   }
 
-  const std::unordered_map<std::string, Attribute>& RuntimeAttrs() const {
+  const AttributeMap& RuntimeAttrs() const {
     return fwd_op_.GetRuntimeAttrMap();
   }
 
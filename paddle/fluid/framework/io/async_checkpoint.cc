@@ -0,0 +1,246 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "paddle/fluid/framework/io/async_checkpoint.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#include "glog/logging.h"
+#include "paddle/common/flags.h"
+#include "paddle/fluid/framework/io/direct_stream_writer.h"
+#include "paddle/fluid/framework/lod_tensor.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/common/port.h"
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
+
+COMMON_DECLARE_bool(checkpoint_direct_io);
+
+namespace paddle::framework {
+
+namespace {
+std::string RankMarkerPath(const std::string& checkpoint_dir, int rank) {
+  return checkpoint_dir + "/.rank_" + std::to_string(rank) + ".done";
+}
+}  // namespace
+
+AsyncCheckpointEngine::AsyncCheckpointEngine(size_t writer_threads,
+                                             size_t copy_chunk_bytes)
+    : copy_chunk_bytes_(std::max<size_t>(copy_chunk_bytes, 1UL << 20)) {
+  PADDLE_ENFORCE_GT(writer_threads,
+                    0UL,
+                    phi::errors::InvalidArgument(
+                        "AsyncCheckpointEngine needs at least one writer "
+                        "thread, but got %zu.",
+                        writer_threads));
+  writers_.reserve(writer_threads);
+  for (size_t i = 0; i < writer_threads; ++i) {
+    writers_.emplace_back([this] { WriterLoop(); });
+  }
+}
+
+AsyncCheckpointEngine::~AsyncCheckpointEngine() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    stop_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto& writer : writers_) {
+    writer.join();
+  }
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  for (auto& item : copy_streams_) {
+    phi::backends::gpu::GpuDestroyStream(item.second);
+  }
+#endif
+}
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+gpuStream_t AsyncCheckpointEngine::GetCopyStream(int device_id) {
+  std::lock_guard<std::mutex> lock(copy_stream_mutex_);
+  auto iter = copy_streams_.find(device_id);
+  if (iter != copy_streams_.end()) {
+    return iter->second;
+  }
+  phi::backends::gpu::GPUDeviceGuard guard(device_id);
+  gpuStream_t stream;
+#ifdef PADDLE_WITH_HIP
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+#endif
+  copy_streams_.emplace(device_id, stream);
+  return stream;
+}
+#endif
+
+phi::DenseTensor AsyncCheckpointEngine::Snapshot(const phi::DenseTensor& x) {
+  phi::DenseTensor staging;
+  staging.Resize(x.dims());
+  staging.set_lod(x.lod());
+  size_t total_bytes = static_cast<size_t>(x.numel()) * phi::SizeOf(x.dtype());
+  if (phi::is_gpu_place(x.place())) {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+    // Pinned destination keeps the D2H copy asynchronous; chunking lets the
+    // copy engine interleave these transfers with the step's own traffic
+    // instead of monopolizing it with one huge memcpy.
+    auto* dst = static_cast<char*>(
+        staging.mutable_data(phi::GPUPinnedPlace(), x.dtype()));
+    const char* src = static_cast<const char*>(x.data());
+    gpuStream_t stream = GetCopyStream(x.place().GetDeviceId());
+    for (size_t offset = 0; offset < total_bytes;
+         offset += copy_chunk_bytes_) {
+      size_t bytes = std::min(copy_chunk_bytes_, total_bytes - offset);
+      phi::memory_utils::Copy(phi::GPUPinnedPlace(),
+                              dst + offset,
+                              x.place(),
+                              src + offset,
+                              bytes,
+                              stream);
+    }
+    phi::backends::gpu::GpuStreamSync(stream);
+#else
+    PADDLE_THROW(phi::errors::PreconditionNotMet(
+        "Cannot snapshot a GPU tensor since Paddle is not compiled with "
+        "CUDA or HIP."));
+#endif
+  } else {
+    auto* dst =
+        static_cast<char*>(staging.mutable_data(phi::CPUPlace(), x.dtype()));
+    std::memcpy(dst, x.data(), total_bytes);
+  }
+  return staging;
+}
+
+void AsyncCheckpointEngine::SaveTensorAsync(const phi::DenseTensor& x,
+                                            const std::string& file_path) {
+  PADDLE_ENFORCE_EQ(x.initialized(),
+                    true,
+                    phi::errors::InvalidArgument(
+                        "The tensor to be saved to %s is not initialized.",
+                        file_path));
+  WriteTask task;
+  task.tensor = Snapshot(x);
+  task.file_path = file_path;
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    ++inflight_;
+    tasks_.push(std::move(task));
+  }
+  task_cv_.notify_one();
+}
+
+void AsyncCheckpointEngine::WriterLoop() {
+  while (true) {
+    WriteTask task;
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      task_cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;  // stop_ was set and the queue is drained
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    VLOG(6) << "async checkpoint writes " << task.file_path;
+    MkDirRecursively(DirName(task.file_path).c_str());
+#ifndef _WIN32
+    if (FLAGS_checkpoint_direct_io) {
+      DirectOFStream fout(task.file_path);
+      if (!fout.IsOpen()) {
+        // writer threads must not throw; surface the failure and keep going
+        // so Wait() cannot deadlock on inflight_
+        LOG(ERROR) << "async checkpoint cannot open " << task.file_path
+                   << " to save the tensor.";
+      } else {
+        framework::SerializeToStream(fout, task.tensor);
+        fout.Close();
+        if (fout.fail()) {
+          LOG(ERROR) << "async checkpoint failed to write " << task.file_path;
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(task_mutex_);
+        --inflight_;
+      }
+      drain_cv_.notify_all();
+      continue;
+    }
+#endif
+    std::ofstream fout(task.file_path, std::ios::binary);
+    if (!fout) {
+      // writer threads must not throw; surface the failure and keep going so
+      // Wait() cannot deadlock on inflight_
+      LOG(ERROR) << "async checkpoint cannot open " << task.file_path
+                 << " to save the tensor.";
+    } else {
+      framework::SerializeToStream(fout, task.tensor);
+      fout.close();
+    }
+    {
+      std::lock_guard<std::mutex> lock(task_mutex_);
+      --inflight_;
+    }
+    drain_cv_.notify_all();
+  }
+}
+
+void AsyncCheckpointEngine::Wait() {
+  std::unique_lock<std::mutex> lock(task_mutex_);
+  drain_cv_.wait(lock, [this] { return inflight_ == 0; });
+}
+
+void AsyncCheckpointEngine::NotifyRankDone(const std::string& checkpoint_dir,
+                                           int rank) {
+  Wait();
+  MkDirRecursively(checkpoint_dir.c_str());
+  std::string marker = RankMarkerPath(checkpoint_dir, rank);
+  std::ofstream fout(marker, std::ios::trunc);
+  PADDLE_ENFORCE_EQ(static_cast<bool>(fout),
+                    true,
+                    phi::errors::Unavailable(
+                        "Cannot write checkpoint marker %s.", marker));
+  fout << "done";
+}
+
+bool AsyncCheckpointEngine::WaitForAllRanks(const std::string& checkpoint_dir,
+                                            int nranks,
+                                            int timeout_ms) {
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  while (true) {
+    int seen = 0;
+    for (int rank = 0; rank < nranks; ++rank) {
+      std::ifstream fin(RankMarkerPath(checkpoint_dir, rank));
+      if (fin.good()) {
+        ++seen;
+      }
+    }
+    if (seen == nranks) {
+      return true;
+    }
+    if (timeout_ms >= 0 && std::chrono::steady_clock::now() >= deadline) {
+      LOG(WARNING) << "async checkpoint saw only " << seen << " of " << nranks
+                   << " rank markers under " << checkpoint_dir << ".";
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+}  // namespace paddle::framework
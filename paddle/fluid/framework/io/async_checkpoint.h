@@ -0,0 +1,97 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "paddle/phi/core/dense_tensor.h"
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_decls.h"
+#endif
+
+namespace paddle {
+namespace framework {
+
+// Overlaps checkpointing with training. SaveTensorAsync snapshots a tensor
+// into a host staging buffer (chunked D2H on a dedicated side stream with a
+// pinned destination for device tensors) and returns as soon as the copy has
+// finished, so the next step may overwrite the parameter; serialization and
+// the disk write happen on background writer threads in the same on-disk
+// format as SaveTensor. Wait blocks until all queued writes are durable.
+//
+// Ranks coordinate through marker files: each rank calls NotifyRankDone for
+// its shard directory once its writes landed, and whoever publishes the
+// checkpoint (usually rank 0) calls WaitForAllRanks before marking it
+// complete. This keeps the engine free of any communication dependency.
+class AsyncCheckpointEngine {
+ public:
+  explicit AsyncCheckpointEngine(size_t writer_threads = 2,
+                                 size_t copy_chunk_bytes = 64UL << 20);
+  ~AsyncCheckpointEngine();
+
+  AsyncCheckpointEngine(const AsyncCheckpointEngine&) = delete;
+  AsyncCheckpointEngine& operator=(const AsyncCheckpointEngine&) = delete;
+
+  // Snapshots x and queues the write of file_path. Returns once x may be
+  // modified again; the file content is only guaranteed after Wait().
+  void SaveTensorAsync(const phi::DenseTensor& x, const std::string& file_path);
+
+  // Blocks until every queued write has been flushed to disk.
+  void Wait();
+
+  // Waits for this engine's writes, then drops a per-rank marker file under
+  // checkpoint_dir. Markers of a previous checkpoint with the same dir are
+  // overwritten.
+  void NotifyRankDone(const std::string& checkpoint_dir, int rank);
+
+  // Polls until all nranks markers exist under checkpoint_dir or timeout_ms
+  // elapsed (timeout_ms < 0 waits forever). Returns whether all ranks were
+  // seen.
+  bool WaitForAllRanks(const std::string& checkpoint_dir,
+                       int nranks,
+                       int timeout_ms);
+
+ private:
+  struct WriteTask {
+    phi::DenseTensor tensor;
+    std::string file_path;
+  };
+
+  phi::DenseTensor Snapshot(const phi::DenseTensor& x);
+  void WriterLoop();
+
+  size_t copy_chunk_bytes_;
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  // lazily created non-blocking copy stream per device
+  gpuStream_t GetCopyStream(int device_id);
+  std::unordered_map<int, gpuStream_t> copy_streams_;
+  std::mutex copy_stream_mutex_;
+#endif
+
+  std::vector<std::thread> writers_;
+  std::queue<WriteTask> tasks_;
+  std::mutex task_mutex_;
+  std::condition_variable task_cv_;   // wakes writers
+  std::condition_variable drain_cv_;  // wakes Wait()
+  size_t inflight_{0};                // queued + currently writing
+  bool stop_{false};
+};
+
+}  // namespace framework
+}  // namespace paddle
@@ -0,0 +1,245 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "paddle/fluid/framework/io/direct_stream_writer.h"
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>  // NOLINT
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "glog/logging.h"
+#include "paddle/phi/core/enforce.h"
+
+namespace paddle {
+namespace framework {
+
+namespace {
+
+// recycles the large aligned staging buffers across checkpoints instead
+// of reallocating them every ten minutes
+class AlignedBufferPool {
+ public:
+  static AlignedBufferPool& Instance() {
+    static AlignedBufferPool pool;
+    return pool;
+  }
+
+  char* Acquire(size_t bytes) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& list = free_[bytes];
+      if (!list.empty()) {
+        char* ptr = list.back();
+        list.pop_back();
+        return ptr;
+      }
+    }
+    void* ptr = nullptr;
+    PADDLE_ENFORCE_EQ(
+        posix_memalign(&ptr, DirectWriteStreamBuf::kAlignment, bytes),
+        0,
+        phi::errors::ResourceExhausted(
+            "Cannot allocate a %zu byte aligned write buffer.", bytes));
+    return static_cast<char*>(ptr);
+  }
+
+  void Release(char* ptr, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& list = free_[bytes];
+    if (list.size() < kMaxCachedPerSize) {
+      list.push_back(ptr);
+    } else {
+      free(ptr);
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxCachedPerSize = 8;
+
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<char*>> free_;
+};
+
+bool WriteFully(int fd, const char* data, size_t bytes, uint64_t offset) {
+  while (bytes > 0) {
+    ssize_t written = pwrite(fd, data, bytes, static_cast<off_t>(offset));
+    if (written <= 0) {
+      return false;
+    }
+    data += written;
+    bytes -= written;
+    offset += written;
+  }
+  return true;
+}
+
+}  // namespace
+
+DirectWriteStreamBuf::DirectWriteStreamBuf(const std::string& file_path,
+                                           size_t buffer_bytes)
+    : buffer_bytes_((buffer_bytes + kAlignment - 1) / kAlignment *
+                    kAlignment) {
+  int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+  fd_ = open(file_path.c_str(), flags | O_DIRECT, 0644);
+  direct_ = fd_ >= 0;
+#endif
+  if (fd_ < 0) {
+    // some filesystems (e.g. tmpfs) reject O_DIRECT; keep the double
+    // buffered writer, just without the cache bypass
+    fd_ = open(file_path.c_str(), flags, 0644);
+    if (fd_ >= 0) {
+      VLOG(3) << "O_DIRECT unsupported for " << file_path
+              << ", falling back to buffered writes";
+    }
+  }
+  if (fd_ < 0) {
+    return;
+  }
+  fill_buf_ = AlignedBufferPool::Instance().Acquire(buffer_bytes_);
+  flush_buf_ = AlignedBufferPool::Instance().Acquire(buffer_bytes_);
+  flusher_ = std::thread([this]() { FlusherLoop(); });
+}
+
+DirectWriteStreamBuf::~DirectWriteStreamBuf() { Close(); }
+
+void DirectWriteStreamBuf::FlusherLoop() {
+  for (;;) {
+    size_t bytes = 0;
+    uint64_t offset = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return pending_bytes_ > 0 || stop_; });
+      if (pending_bytes_ == 0) {
+        return;
+      }
+      bytes = pending_bytes_;
+      offset = pending_offset_;
+    }
+    if (!WriteFully(fd_, flush_buf_, bytes, offset)) {
+      failed_ = true;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_bytes_ = 0;
+    }
+    cv_.notify_all();
+  }
+}
+
+void DirectWriteStreamBuf::WaitFlusher() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return pending_bytes_ == 0; });
+}
+
+void DirectWriteStreamBuf::Submit(size_t bytes) {
+  WaitFlusher();
+  std::swap(fill_buf_, flush_buf_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_bytes_ = bytes;
+    pending_offset_ = submit_offset_;
+  }
+  cv_.notify_all();
+  submit_offset_ += bytes;
+  filled_ = 0;
+}
+
+std::streamsize DirectWriteStreamBuf::xsputn(const char* s,
+                                             std::streamsize n) {
+  if (fd_ < 0) {
+    return 0;
+  }
+  std::streamsize left = n;
+  while (left > 0) {
+    size_t chunk = std::min<size_t>(left, buffer_bytes_ - filled_);
+    std::memcpy(fill_buf_ + filled_, s, chunk);
+    filled_ += chunk;
+    s += chunk;
+    left -= chunk;
+    if (filled_ == buffer_bytes_) {
+      Submit(buffer_bytes_);
+    }
+  }
+  logical_size_ += n;
+  return n;
+}
+
+DirectWriteStreamBuf::int_type DirectWriteStreamBuf::overflow(int_type c) {
+  if (traits_type::eq_int_type(c, traits_type::eof())) {
+    return traits_type::not_eof(c);
+  }
+  char ch = traits_type::to_char_type(c);
+  return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+}
+
+void DirectWriteStreamBuf::Close() {
+  if (fd_ < 0) {
+    return;
+  }
+  if (filled_ > 0) {
+    // pad the tail to the block size; the truncate below restores the
+    // logical length
+    size_t padded = (filled_ + kAlignment - 1) / kAlignment * kAlignment;
+    std::memset(fill_buf_ + filled_, 0, padded - filled_);
+    Submit(padded);
+  }
+  WaitFlusher();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  flusher_.join();
+  if (ftruncate(fd_, static_cast<off_t>(logical_size_)) != 0) {
+    failed_ = true;
+  }
+  if (close(fd_) != 0) {
+    failed_ = true;
+  }
+  fd_ = -1;
+  AlignedBufferPool::Instance().Release(fill_buf_, buffer_bytes_);
+  AlignedBufferPool::Instance().Release(flush_buf_, buffer_bytes_);
+  fill_buf_ = flush_buf_ = nullptr;
+}
+
+DirectOFStream::DirectOFStream(const std::string& file_path,
+                               size_t buffer_bytes)
+    : std::ostream(nullptr),
+      buf_(new DirectWriteStreamBuf(file_path, buffer_bytes)) {
+  rdbuf(buf_.get());
+  if (!buf_->IsOpen()) {
+    setstate(std::ios_base::failbit);
+  }
+}
+
+DirectOFStream::~DirectOFStream() { Close(); }
+
+void DirectOFStream::Close() {
+  buf_->Close();
+  if (buf_->Failed()) {
+    setstate(std::ios_base::badbit);
+  }
+}
+
+}  // namespace framework
+}  // namespace paddle
+
+#endif  // !_WIN32
@@ -0,0 +1,102 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>  // NOLINT
+
+namespace paddle {
+namespace framework {
+
+// Streambuf over an O_DIRECT file descriptor for checkpoint emission.
+// Bytes are staged in a pooled, block aligned buffer; a full buffer is
+// handed to a flusher thread and writing continues into a second buffer,
+// so serialization overlaps the disk write and the payload never touches
+// the page cache. The tail is zero padded to the block size and the file
+// truncated back to its logical length on Close. Falls back to a plain
+// descriptor when the filesystem rejects O_DIRECT.
+class DirectWriteStreamBuf : public std::streambuf {
+ public:
+  static constexpr size_t kAlignment = 4096;
+  static constexpr size_t kDefaultBufferBytes = 16UL << 20;
+
+  explicit DirectWriteStreamBuf(const std::string& file_path,
+                                size_t buffer_bytes = kDefaultBufferBytes);
+  ~DirectWriteStreamBuf() override;
+
+  DirectWriteStreamBuf(const DirectWriteStreamBuf&) = delete;
+  DirectWriteStreamBuf& operator=(const DirectWriteStreamBuf&) = delete;
+
+  bool IsOpen() const { return fd_ >= 0; }
+
+  // waits for the in-flight write, pads and writes the tail, truncates
+  // the file to its logical size and closes the descriptor
+  void Close();
+
+  bool Failed() const { return failed_; }
+
+ protected:
+  int_type overflow(int_type c) override;
+  std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+ private:
+  void Submit(size_t bytes);  // hands the fill buffer to the flusher
+  void WaitFlusher();         // blocks until no write is in flight
+  void FlusherLoop();
+
+  int fd_ = -1;
+  bool direct_ = false;
+  bool failed_ = false;
+  size_t buffer_bytes_;
+  char* fill_buf_ = nullptr;
+  char* flush_buf_ = nullptr;
+  size_t filled_ = 0;
+  uint64_t submit_offset_ = 0;  // aligned offset of the next submit
+  uint64_t logical_size_ = 0;   // bytes the caller actually wrote
+
+  std::thread flusher_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t pending_bytes_ = 0;  // 0 means no write in flight
+  uint64_t pending_offset_ = 0;
+  bool stop_ = false;
+};
+
+// std::ostream facade so SerializeToStream and operator<< callers work
+// unchanged on top of the direct writer.
+class DirectOFStream : public std::ostream {
+ public:
+  explicit DirectOFStream(
+      const std::string& file_path,
+      size_t buffer_bytes = DirectWriteStreamBuf::kDefaultBufferBytes);
+  ~DirectOFStream() override;
+
+  bool IsOpen() const { return buf_->IsOpen(); }
+
+  // flushes the tail; sets badbit if any write failed
+  void Close();
+
+ private:
+  std::unique_ptr<DirectWriteStreamBuf> buf_;
+};
+
+}  // namespace framework
+}  // namespace paddle
+
+#endif  // !_WIN32
@@ -0,0 +1,526 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "paddle/fluid/framework/io/flat_tensor_container.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "glog/logging.h"
+#include "nlohmann/json.hpp"
+#include "paddle/phi/common/port.h"
+#include "paddle/phi/core/device_context.h"
+#include "paddle/phi/core/enforce.h"
+#include "paddle/phi/core/tensor_utils.h"
+
+namespace paddle {
+namespace framework {
+
+namespace {
+
+using Json = nlohmann::json;
+
+constexpr uint64_t kDataRegionAlignment = 4096;  // direct IO friendly
+constexpr uint64_t kTensorAlignment = 64;
+
+constexpr std::pair<phi::DataType, const char*> kDataTypeNames[] = {
+    {phi::DataType::FLOAT32, "float32"},
+    {phi::DataType::FLOAT64, "float64"},
+    {phi::DataType::FLOAT16, "float16"},
+    {phi::DataType::BFLOAT16, "bfloat16"},
+    {phi::DataType::INT8, "int8"},
+    {phi::DataType::UINT8, "uint8"},
+    {phi::DataType::INT16, "int16"},
+    {phi::DataType::INT32, "int32"},
+    {phi::DataType::INT64, "int64"},
+    {phi::DataType::BOOL, "bool"},
+    {phi::DataType::COMPLEX64, "complex64"},
+    {phi::DataType::COMPLEX128, "complex128"},
+};
+
+const char* DataTypeName(phi::DataType dtype) {
+  for (auto& pair : kDataTypeNames) {
+    if (pair.first == dtype) {
+      return pair.second;
+    }
+  }
+  PADDLE_THROW(phi::errors::Unimplemented(
+      "Data type %s can not be stored in a flat tensor container.", dtype));
+}
+
+phi::DataType DataTypeFromName(const std::string& name) {
+  for (auto& pair : kDataTypeNames) {
+    if (name == pair.second) {
+      return pair.first;
+    }
+  }
+  PADDLE_THROW(phi::errors::InvalidArgument(
+      "Unknown data type %s in the flat tensor container header.", name));
+}
+
+uint64_t AlignUp(uint64_t x, uint64_t alignment) {
+  return (x + alignment - 1) / alignment * alignment;
+}
+
+// FNV-1a, cheap enough to run on every checkpoint and stable across
+// processes (std::hash is not)
+uint64_t HashBytes(const void* data, size_t n) {
+  const auto* p = static_cast<const unsigned char*>(data);
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < n; ++i) {
+    h = (h ^ p[i]) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+std::string HexHash(uint64_t h) {
+  char buf[17];
+  snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(h));
+  return buf;
+}
+
+std::string FileBaseName(const std::string& path) {
+  size_t pos = path.find_last_of("/\\");
+  return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+Json ReadContainerHeader(const std::string& file_path) {
+  std::ifstream fin(file_path, std::ios::binary);
+  PADDLE_ENFORCE_EQ(
+      static_cast<bool>(fin),
+      true,
+      phi::errors::Unavailable("Cannot open %s to load variables.",
+                               file_path));
+  uint64_t header_len = 0;
+  fin.read(reinterpret_cast<char*>(&header_len), sizeof(header_len));
+  std::string header_str(header_len, '\0');
+  fin.read(&header_str[0], static_cast<std::streamsize>(header_len));
+  PADDLE_ENFORCE_EQ(fin.fail(),
+                    false,
+                    phi::errors::InvalidArgument(
+                        "%s is not a flat tensor container.", file_path));
+  Json header = Json::parse(header_str, nullptr, false);
+  PADDLE_ENFORCE_EQ(!header.is_discarded() && header.is_object(),
+                    true,
+                    phi::errors::InvalidArgument(
+                        "Cannot parse the header of %s.", file_path));
+  return header;
+}
+
+// validates one tensor to be saved and stages it through the host
+void StageTensorForSave(const std::string& name,
+                        const phi::DenseTensor& tensor,
+                        phi::DenseTensor* cpu_tensor) {
+  PADDLE_ENFORCE_EQ(tensor.IsInitialized(),
+                    true,
+                    phi::errors::InvalidArgument(
+                        "The tensor %s to be saved is not initialized.",
+                        name));
+  PADDLE_ENFORCE_EQ(tensor.meta().is_contiguous(),
+                    true,
+                    phi::errors::InvalidArgument(
+                        "The tensor %s to be saved is not contiguous.",
+                        name));
+  if (tensor.place().GetType() == phi::AllocationType::CPU) {
+    *cpu_tensor = tensor;
+  } else {
+    auto* dev_ctx = phi::DeviceContextPool::Instance().Get(tensor.place());
+    phi::Copy(*dev_ctx, tensor, phi::CPUPlace(), true /*blocking*/,
+              cpu_tensor);
+  }
+}
+
+// keeps the mapped file (or its heap fallback) alive while a returned
+// tensor still aliases it
+class MappedRegionAllocation : public phi::Allocation {
+ public:
+  MappedRegionAllocation(void* ptr, size_t size, std::shared_ptr<void> holder)
+      : phi::Allocation(ptr, size, phi::CPUPlace()),
+        holder_(std::move(holder)) {}
+
+ private:
+  std::shared_ptr<void> holder_;
+};
+
+}  // namespace
+
+void SaveFlatTensorContainer(
+    const std::vector<std::string>& names,
+    const std::vector<const phi::DenseTensor*>& tensors,
+    const std::string& file_path) {
+  PADDLE_ENFORCE_EQ(names.size(),
+                    tensors.size(),
+                    phi::errors::InvalidArgument(
+                        "The number of names %zu mismatches the number of "
+                        "tensors %zu.",
+                        names.size(),
+                        tensors.size()));
+
+  // stage device tensors through the host and lay out the data region
+  std::vector<phi::DenseTensor> cpu_tensors(tensors.size());
+  Json header = Json::object();
+  uint64_t offset = 0;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    auto& tensor = *tensors[i];
+    PADDLE_ENFORCE_EQ(header.count(names[i]),
+                      0UL,
+                      phi::errors::InvalidArgument(
+                          "Duplicate tensor name %s.", names[i]));
+    StageTensorForSave(names[i], tensor, &cpu_tensors[i]);
+    uint64_t bytes = tensor.numel() * phi::SizeOf(tensor.dtype());
+    uint64_t begin = AlignUp(offset, kTensorAlignment);
+    Json entry = Json::object();
+    entry["dtype"] = DataTypeName(tensor.dtype());
+    entry["shape"] = common::vectorize(tensor.dims());
+    entry["data_offsets"] = {begin, begin + bytes};
+    header[names[i]] = std::move(entry);
+    offset = begin + bytes;
+  }
+
+  // pad the header with spaces so the data region starts aligned
+  std::string header_str = header.dump();
+  uint64_t header_len =
+      AlignUp(sizeof(uint64_t) + header_str.size(), kDataRegionAlignment) -
+      sizeof(uint64_t);
+  header_str.resize(header_len, ' ');
+
+  MkDirRecursively(DirName(file_path).c_str());
+  std::ofstream fout(file_path, std::ios::binary);
+  PADDLE_ENFORCE_EQ(
+      static_cast<bool>(fout),
+      true,
+      phi::errors::Unavailable("Cannot open %s to save variables.",
+                               file_path));
+  fout.write(reinterpret_cast<const char*>(&header_len), sizeof(header_len));
+  fout.write(header_str.data(),
+             static_cast<std::streamsize>(header_str.size()));
+
+  uint64_t written = 0;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    uint64_t begin = header[names[i]]["data_offsets"][0].get<uint64_t>();
+    for (; written < begin; ++written) {
+      fout.put('\0');
+    }
+    uint64_t bytes =
+        cpu_tensors[i].numel() * phi::SizeOf(cpu_tensors[i].dtype());
+    fout.write(static_cast<const char*>(cpu_tensors[i].data()),
+               static_cast<std::streamsize>(bytes));
+    written += bytes;
+  }
+  fout.close();
+  PADDLE_ENFORCE_EQ(
+      fout.fail(),
+      false,
+      phi::errors::Unavailable("Failed to write %s.", file_path));
+  VLOG(6) << "saved " << names.size() << " tensors (" << written
+          << " payload bytes) to flat container " << file_path;
+}
+
+void SaveFlatTensorContainerIncremental(
+    const std::vector<std::string>& names,
+    const std::vector<const phi::DenseTensor*>& tensors,
+    const std::string& file_path,
+    const std::string& base_path,
+    size_t max_chain_depth) {
+  PADDLE_ENFORCE_EQ(names.size(),
+                    tensors.size(),
+                    phi::errors::InvalidArgument(
+                        "The number of names %zu mismatches the number of "
+                        "tensors %zu.",
+                        names.size(),
+                        tensors.size()));
+  PADDLE_ENFORCE_GE(max_chain_depth,
+                    1UL,
+                    phi::errors::InvalidArgument(
+                        "max_chain_depth must be at least 1, got %zu.",
+                        max_chain_depth));
+  Json base_header = ReadContainerHeader(base_path);
+  const std::string base_name = FileBaseName(base_path);
+
+  std::vector<phi::DenseTensor> cpu_tensors(tensors.size());
+  Json header = Json::object();
+  uint64_t offset = 0;
+  size_t reused = 0;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    PADDLE_ENFORCE_EQ(header.count(names[i]),
+                      0UL,
+                      phi::errors::InvalidArgument(
+                          "Duplicate tensor name %s.", names[i]));
+    StageTensorForSave(names[i], *tensors[i], &cpu_tensors[i]);
+    uint64_t bytes =
+        cpu_tensors[i].numel() * phi::SizeOf(cpu_tensors[i].dtype());
+    std::string hash =
+        HexHash(HashBytes(bytes > 0 ? cpu_tensors[i].data() : nullptr,
+                          bytes));
+
+    Json entry = Json::object();
+    entry["dtype"] = DataTypeName(tensors[i]->dtype());
+    entry["shape"] = common::vectorize(tensors[i]->dims());
+    entry["hash"] = hash;
+
+    bool reuse = false;
+    auto base_iter = base_header.find(names[i]);
+    if (base_iter != base_header.end() &&
+        base_iter->value("hash", std::string()) == hash &&
+        base_iter->at("dtype") == entry["dtype"] &&
+        base_iter->at("shape") == entry["shape"]) {
+      // always reference the file that actually holds the bytes, so a
+      // chain of incremental checkpoints never needs more than one hop
+      uint64_t chain = base_iter->value("chain", uint64_t{0});
+      if (chain + 1 < max_chain_depth) {
+        entry["base"] = base_iter->value("base", base_name);
+        entry["data_offsets"] = base_iter->at("data_offsets");
+        entry["chain"] = chain + 1;
+        reuse = true;
+        ++reused;
+      }
+    }
+    if (!reuse) {
+      uint64_t begin = AlignUp(offset, kTensorAlignment);
+      entry["data_offsets"] = {begin, begin + bytes};
+      offset = begin + bytes;
+    }
+    header[names[i]] = std::move(entry);
+  }
+
+  std::string header_str = header.dump();
+  uint64_t header_len =
+      AlignUp(sizeof(uint64_t) + header_str.size(), kDataRegionAlignment) -
+      sizeof(uint64_t);
+  header_str.resize(header_len, ' ');
+
+  MkDirRecursively(DirName(file_path).c_str());
+  std::ofstream fout(file_path, std::ios::binary);
+  PADDLE_ENFORCE_EQ(
+      static_cast<bool>(fout),
+      true,
+      phi::errors::Unavailable("Cannot open %s to save variables.",
+                               file_path));
+  fout.write(reinterpret_cast<const char*>(&header_len), sizeof(header_len));
+  fout.write(header_str.data(),
+             static_cast<std::streamsize>(header_str.size()));
+
+  uint64_t written = 0;
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    if (header[names[i]].count("base")) {
+      continue;  // payload lives in the referenced checkpoint
+    }
+    uint64_t begin = header[names[i]]["data_offsets"][0].get<uint64_t>();
+    for (; written < begin; ++written) {
+      fout.put('\0');
+    }
+    uint64_t bytes =
+        cpu_tensors[i].numel() * phi::SizeOf(cpu_tensors[i].dtype());
+    fout.write(static_cast<const char*>(cpu_tensors[i].data()),
+               static_cast<std::streamsize>(bytes));
+    written += bytes;
+  }
+  fout.close();
+  PADDLE_ENFORCE_EQ(
+      fout.fail(),
+      false,
+      phi::errors::Unavailable("Failed to write %s.", file_path));
+  VLOG(6) << "saved " << names.size() << " tensors (" << reused
+          << " reused from earlier checkpoints, " << written
+          << " payload bytes) to flat container " << file_path;
+}
+
+struct FlatTensorContainerReader::MappedFile {
+  const char* data = nullptr;
+  size_t size = 0;
+#ifndef _WIN32
+  void* map_base = nullptr;
+#endif
+  std::vector<char> fallback;
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (map_base != nullptr) {
+      munmap(map_base, size);
+    }
+#endif
+  }
+};
+
+std::shared_ptr<FlatTensorContainerReader::MappedFile>
+FlatTensorContainerReader::MapFile(const std::string& file_path) {
+  auto file = std::make_shared<MappedFile>();
+#ifndef _WIN32
+  int fd = open(file_path.c_str(), O_RDONLY);
+  PADDLE_ENFORCE_GE(
+      fd,
+      0,
+      phi::errors::Unavailable("Cannot open %s to load variables.",
+                               file_path));
+  struct stat st;
+  PADDLE_ENFORCE_EQ(
+      fstat(fd, &st),
+      0,
+      phi::errors::Unavailable("Cannot stat %s.", file_path));
+  file->size = static_cast<size_t>(st.st_size);
+  file->map_base =
+      mmap(nullptr, file->size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  PADDLE_ENFORCE_NE(
+      file->map_base,
+      MAP_FAILED,
+      phi::errors::Unavailable("Cannot map %s.", file_path));
+  file->data = static_cast<const char*>(file->map_base);
+#else
+  std::ifstream fin(file_path, std::ios::binary | std::ios::ate);
+  PADDLE_ENFORCE_EQ(
+      static_cast<bool>(fin),
+      true,
+      phi::errors::Unavailable("Cannot open %s to load variables.",
+                               file_path));
+  file->fallback.resize(static_cast<size_t>(fin.tellg()));
+  fin.seekg(0, std::ios::beg);
+  fin.read(file->fallback.data(),
+           static_cast<std::streamsize>(file->fallback.size()));
+  file->data = file->fallback.data();
+  file->size = file->fallback.size();
+#endif
+  return file;
+}
+
+FlatTensorContainerReader::FlatTensorContainerReader(
+    const std::string& file_path) {
+  file_ = MapFile(file_path);
+
+  PADDLE_ENFORCE_GE(file_->size,
+                    sizeof(uint64_t),
+                    phi::errors::InvalidArgument(
+                        "%s is not a flat tensor container.", file_path));
+  uint64_t header_len = 0;
+  std::memcpy(&header_len, file_->data, sizeof(header_len));
+  PADDLE_ENFORCE_LE(sizeof(uint64_t) + header_len,
+                    file_->size,
+                    phi::errors::InvalidArgument(
+                        "%s is not a flat tensor container.", file_path));
+  data_region_ = file_->data + sizeof(uint64_t) + header_len;
+  data_region_size_ = file_->size - sizeof(uint64_t) - header_len;
+
+  Json header = Json::parse(
+      file_->data + sizeof(uint64_t), data_region_, nullptr, false);
+  PADDLE_ENFORCE_EQ(!header.is_discarded() && header.is_object(),
+                    true,
+                    phi::errors::InvalidArgument(
+                        "Cannot parse the header of %s.", file_path));
+
+  // base checkpoints referenced by incremental entries, mapped once each
+  struct BaseRegion {
+    std::shared_ptr<MappedFile> file;
+    const char* region;
+    size_t size;
+  };
+  std::unordered_map<std::string, BaseRegion> base_regions;
+
+  for (auto it = header.begin(); it != header.end(); ++it) {
+    if (it.key().rfind("__", 0) == 0) {
+      continue;  // metadata entry, not a tensor
+    }
+    auto& value = it.value();
+    Entry entry;
+    entry.dtype = DataTypeFromName(value.at("dtype").get<std::string>());
+    entry.dims = value.at("shape").get<std::vector<int64_t>>();
+    entry.begin = value.at("data_offsets").at(0).get<uint64_t>();
+    entry.end = value.at("data_offsets").at(1).get<uint64_t>();
+    entry.region = data_region_;
+    entry.holder = file_;
+    size_t region_size = data_region_size_;
+    if (value.count("base")) {
+      const std::string base = value.at("base").get<std::string>();
+      auto base_it = base_regions.find(base);
+      if (base_it == base_regions.end()) {
+        std::string dir = DirName(file_path);
+        std::string base_file_path = dir.empty() ? base : dir + "/" + base;
+        auto base_file = MapFile(base_file_path);
+        PADDLE_ENFORCE_GE(
+            base_file->size,
+            sizeof(uint64_t),
+            phi::errors::InvalidArgument(
+                "%s referenced by %s is not a flat tensor container.",
+                base_file_path,
+                file_path));
+        uint64_t base_header_len = 0;
+        std::memcpy(&base_header_len, base_file->data,
+                    sizeof(base_header_len));
+        PADDLE_ENFORCE_LE(
+            sizeof(uint64_t) + base_header_len,
+            base_file->size,
+            phi::errors::InvalidArgument(
+                "%s referenced by %s is not a flat tensor container.",
+                base_file_path,
+                file_path));
+        BaseRegion region;
+        region.file = base_file;
+        region.region = base_file->data + sizeof(uint64_t) + base_header_len;
+        region.size = base_file->size - sizeof(uint64_t) - base_header_len;
+        base_it = base_regions.emplace(base, std::move(region)).first;
+      }
+      entry.region = base_it->second.region;
+      entry.holder = base_it->second.file;
+      region_size = base_it->second.size;
+    }
+    int64_t numel = 1;
+    for (auto d : entry.dims) {
+      numel *= d;
+    }
+    PADDLE_ENFORCE_EQ(
+        entry.end - entry.begin,
+        static_cast<size_t>(numel) * phi::SizeOf(entry.dtype),
+        phi::errors::InvalidArgument(
+            "Tensor %s in %s has %zu payload bytes, its shape needs %zu.",
+            it.key(),
+            file_path,
+            entry.end - entry.begin,
+            static_cast<size_t>(numel) * phi::SizeOf(entry.dtype)));
+    PADDLE_ENFORCE_LE(entry.end,
+                      region_size,
+                      phi::errors::InvalidArgument(
+                          "Tensor %s in %s is out of the data region.",
+                          it.key(),
+                          file_path));
+    entries_.emplace(it.key(), std::move(entry));
+    order_.push_back(it.key());
+  }
+}
+
+phi::DenseTensor FlatTensorContainerReader::GetTensor(
+    const std::string& name) const {
+  auto it = entries_.find(name);
+  PADDLE_ENFORCE_NE(it,
+                    entries_.end(),
+                    phi::errors::NotFound(
+                        "Tensor %s is not in the flat tensor container.",
+                        name));
+  auto& entry = it->second;
+  phi::DenseTensor tensor;
+  tensor.set_meta(
+      phi::DenseTensorMeta(entry.dtype, common::make_ddim(entry.dims)));
+  auto* ptr = const_cast<char*>(entry.region + entry.begin);
+  tensor.ResetHolder(std::make_shared<MappedRegionAllocation>(
+      ptr, entry.end - entry.begin, entry.holder));
+  return tensor;
+}
+
+}  // namespace framework
+}  // namespace paddle
@@ -0,0 +1,104 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "paddle/phi/core/dense_tensor.h"
+
+namespace paddle {
+namespace framework {
+
+// Flat tensor container: a safetensors style file holding one JSON header
+// that maps tensor name -> (dtype, shape, data offsets) followed by a
+// single data region. Unlike SerializeToStream, metadata and payloads are
+// not interleaved, so the data region can be mapped for zero copy loads,
+// fetched per tensor for sharded serving, and every payload is aligned
+// for direct reads. Layout:
+//   uint64_t header length | JSON header (space padded so the data region
+//   starts on a 4096 byte boundary) | data region (payloads 64 byte
+//   aligned, offsets relative to the region start)
+// Incremental checkpoints add three optional per tensor header fields:
+// "hash" (FNV-1a of the payload), "base" (the checkpoint file holding the
+// payload, for tensors that did not change) and "chain" (how many
+// checkpoints the reference has been carried for).
+
+// Saves `tensors` under `names` into one container file. Tensors on a
+// device are staged through the host; all tensors must be contiguous.
+void SaveFlatTensorContainer(
+    const std::vector<std::string>& names,
+    const std::vector<const phi::DenseTensor*>& tensors,
+    const std::string& file_path);
+
+// Incremental variant for periodic checkpoints: every header entry also
+// carries a content hash, and a tensor whose hash matches the previous
+// checkpoint at `base_path` is written as a reference to the file that
+// actually holds its bytes instead of a fresh payload, so a mostly
+// frozen model only pays I/O for the tensors that changed. A reference
+// records how many checkpoints it has been carried for and is rewritten
+// as a payload once that reaches `max_chain_depth` (the compaction
+// step), so only the trailing `max_chain_depth` checkpoint files are
+// ever needed to restore the newest one. Referenced files are resolved
+// relative to the checkpoint's directory by the reader.
+void SaveFlatTensorContainerIncremental(
+    const std::vector<std::string>& names,
+    const std::vector<const phi::DenseTensor*>& tensors,
+    const std::string& file_path,
+    const std::string& base_path,
+    size_t max_chain_depth = 8);
+
+// Read-only view of a container file. The file is mapped once at
+// construction; GetTensor returns a CPU tensor whose holder shares the
+// mapping, so no payload bytes are copied and the mapping stays alive as
+// long as the reader or any returned tensor does.
+class FlatTensorContainerReader {
+ public:
+  explicit FlatTensorContainerReader(const std::string& file_path);
+
+  // tensor names in file order
+  const std::vector<std::string>& TensorNames() const { return order_; }
+
+  bool HasTensor(const std::string& name) const {
+    return entries_.count(name) > 0;
+  }
+
+  // zero copy: the returned tensor aliases the mapped file
+  phi::DenseTensor GetTensor(const std::string& name) const;
+
+ private:
+  struct MappedFile;  // owns the mapping (or the fallback heap buffer)
+
+  struct Entry {
+    phi::DataType dtype;
+    std::vector<int64_t> dims;
+    size_t begin;
+    size_t end;
+    // the data region holding the payload; points into a referenced base
+    // checkpoint for entries an incremental save did not rewrite
+    const char* region = nullptr;
+    std::shared_ptr<MappedFile> holder;
+  };
+
+  static std::shared_ptr<MappedFile> MapFile(const std::string& file_path);
+
+  std::shared_ptr<MappedFile> file_;
+  const char* data_region_ = nullptr;
+  size_t data_region_size_ = 0;
+  std::unordered_map<std::string, Entry> entries_;
+  std::vector<std::string> order_;
+};
+
+}  // namespace framework
+}  // namespace paddle
@@ -16,9 +16,13 @@ limitations under the License. */
 #include <numeric>
 
 #include "glog/logging.h"
+#include "paddle/common/flags.h"
+#include "paddle/fluid/framework/io/direct_stream_writer.h"
 #include "paddle/fluid/framework/lod_tensor.h"
 #include "paddle/phi/common/port.h"
 
+COMMON_DECLARE_bool(checkpoint_direct_io);
+
 namespace paddle::framework {
 
 void SaveTensor(const phi::DenseTensor& x,
@@ -29,6 +33,23 @@ void SaveTensor(const phi::DenseTensor& x,
   VLOG(6) << "tensor will be saved to " << new_path;
   MkDirRecursively(DirName(new_path).c_str());
 
+#ifndef _WIN32
+  if (FLAGS_checkpoint_direct_io) {
+    DirectOFStream fout(new_path);
+    PADDLE_ENFORCE_EQ(fout.IsOpen(),
+                      true,
+                      phi::errors::Unavailable(
+                          "Cannot open %s to save variables.", new_path));
+    framework::SerializeToStream(fout, x);
+    fout.Close();
+    PADDLE_ENFORCE_EQ(
+        fout.fail(),
+        false,
+        phi::errors::Unavailable("Failed to write %s.", new_path));
+    return;
+  }
+#endif
+
   std::ofstream fout(new_path, std::ios::binary);
   PADDLE_ENFORCE_EQ(
       static_cast<bool>(fout),
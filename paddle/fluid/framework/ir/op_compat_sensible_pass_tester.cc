@@ -52,7 +52,7 @@ TEST(OpCompatSensiblePass, compatOp) {
 
   OpDesc fc_op;
 
-  std::unordered_map<std::string, Attribute> attr_map;
+  AttributeMap attr_map;
   attr_map["in_num_col_dims"] = 1;
   attr_map["activation_type"] = std::string("tanh");
   attr_map["test_attr"] = true;
@@ -85,7 +85,7 @@ TEST(OpCompatSensiblePass, compatOpAttribute) {
   OpCompat compat("fc_test");
 
   OpDesc fc_op;
-  std::unordered_map<std::string, Attribute> attr_map;
+  AttributeMap attr_map;
   attr_map["in_num_col_dims"] = 1;
   fc_op.SetAttrMap(attr_map);
 
@@ -238,7 +238,7 @@ TEST(OpCompatSensiblePass, IsCompat) {
   OpCompatSensiblePassTest test;
   OpDesc fc_op;
   fc_op.SetType("fc_test");
-  std::unordered_map<std::string, Attribute> attr_map;
+  AttributeMap attr_map;
   attr_map["in_num_col_dims"] = 1;
   attr_map["activation_type"] = std::string("tanh");
 
@@ -273,7 +273,7 @@ TEST(OpCompatSensiblePass, IsCompatFail) {
   ProgramDesc prog;
   Graph g(prog);
   OpDesc fc_op;
-  std::unordered_map<std::string, Attribute> attr_map;
+  AttributeMap attr_map;
   attr_map["in_num_col_dims"] = 1;
   attr_map["activation_type"] = std::string("tanh");
   fc_op.SetAttrMap(attr_map);
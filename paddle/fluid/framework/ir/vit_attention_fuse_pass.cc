@@ -58,8 +58,8 @@ bool HasScale(OpDesc* const op_ptr,
               std::string* name,
               std::string regexp = "Input_scale_") {
   name->clear();
-  std::unordered_map<std::string, Attribute> attr_map = op_ptr->GetAttrMap();
-  std::unordered_map<std::string, Attribute>::iterator iter;
+  AttributeMap attr_map = op_ptr->GetAttrMap();
+  AttributeMap::iterator iter;
   int len = static_cast<int>(regexp.size());
   for (iter = attr_map.begin(); iter != attr_map.end(); iter++) {
     if (regexp == iter->first.substr(0, len)) {
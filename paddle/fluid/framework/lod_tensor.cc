@@ -14,11 +14,21 @@ limitations under the License. */
 
 #include "paddle/fluid/framework/lod_tensor.h"
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <istream>
+#include <mutex>  // NOLINT
+#include <streambuf>
+#include <thread>  // NOLINT
 
+#include "paddle/common/flags.h"
 #include "paddle/fluid/framework/convert_utils.h"
+#include "paddle/fluid/framework/data_type.h"
 #include "paddle/fluid/framework/version.h"
 
+COMMON_DECLARE_int32(load_combine_thread_num);
+
 namespace paddle::framework {
 
 std::string LoDToString(const LoD &lod) {
@@ -319,6 +329,153 @@ void DeserializeFromStream(std::istream &is,
       is, static_cast<phi::DenseTensor *>(tensor), dev_ctx);
 }
 
+namespace {
+
+// read-only streambuf over one record of a combined parameter buffer, so
+// the existing stream based deserialization can run without copying
+class RecordStreamBuf : public std::streambuf {
+ public:
+  RecordStreamBuf(const char *data, size_t size) {
+    char *begin = const_cast<char *>(data);
+    setg(begin, begin, begin + size);
+  }
+};
+
+}  // namespace
+
+std::vector<CombinedTensorRecord> ScanCombinedTensorRecords(const char *data,
+                                                            size_t size) {
+  std::vector<CombinedTensorRecord> records;
+  size_t pos = 0;
+  auto read_field = [&](void *dst, size_t n) {
+    PADDLE_ENFORCE_LE(
+        pos + n,
+        size,
+        platform::errors::InvalidArgument(
+            "The combined parameter buffer is truncated at byte %zu.", pos));
+    std::memcpy(dst, data + pos, n);
+    pos += n;
+  };
+  auto skip_bytes = [&](size_t n) {
+    PADDLE_ENFORCE_LE(
+        pos + n,
+        size,
+        platform::errors::InvalidArgument(
+            "The combined parameter buffer is truncated at byte %zu.", pos));
+    pos += n;
+  };
+  while (pos < size) {
+    size_t begin = pos;
+    uint32_t version = 0;
+    read_field(&version, sizeof(version));
+    PADDLE_ENFORCE_EQ(version,
+                      0U,
+                      platform::errors::InvalidArgument(
+                          "Tensor version %u at byte %zu is not supported, "
+                          "only version 0 is supported.",
+                          version,
+                          begin));
+    uint64_t lod_level = 0;
+    read_field(&lod_level, sizeof(lod_level));
+    for (uint64_t i = 0; i < lod_level; ++i) {
+      uint64_t level_bytes = 0;
+      read_field(&level_bytes, sizeof(level_bytes));
+      skip_bytes(level_bytes);
+    }
+    uint32_t tensor_version = 0;
+    read_field(&tensor_version, sizeof(tensor_version));
+    PADDLE_ENFORCE_EQ(tensor_version,
+                      0U,
+                      platform::errors::InvalidArgument(
+                          "Tensor version %u at byte %zu is not supported, "
+                          "only version 0 is supported.",
+                          tensor_version,
+                          begin));
+    int32_t desc_size = -1;
+    read_field(&desc_size, sizeof(desc_size));
+    PADDLE_ENFORCE_GE(desc_size,
+                      0,
+                      platform::errors::InvalidArgument(
+                          "phi::DenseTensor desc size should >= 0"));
+    PADDLE_ENFORCE_LE(
+        pos + static_cast<size_t>(desc_size),
+        size,
+        platform::errors::InvalidArgument(
+            "The combined parameter buffer is truncated at byte %zu.", pos));
+    proto::VarType::TensorDesc desc;
+    PADDLE_ENFORCE_EQ(
+        desc.ParseFromArray(data + pos, desc_size),
+        true,
+        platform::errors::InvalidArgument("Cannot parse tensor desc"));
+    pos += desc_size;
+    int64_t numel = 1;
+    for (auto d : desc.dims()) {
+      numel *= d;
+    }
+    skip_bytes(static_cast<size_t>(numel) *
+               framework::SizeOfType(desc.data_type()));
+    records.push_back({begin, pos - begin});
+  }
+  return records;
+}
+
+void DeserializeFromCombinedBuffer(
+    const char *data,
+    size_t size,
+    const std::vector<phi::DenseTensor *> &tensors,
+    const platform::DeviceContext &dev_ctx) {
+  auto records = ScanCombinedTensorRecords(data, size);
+  PADDLE_ENFORCE_EQ(records.size(),
+                    tensors.size(),
+                    platform::errors::InvalidArgument(
+                        "The combined parameter buffer holds %zu tensors, but "
+                        "%zu tensors are expected to be loaded from it.",
+                        records.size(),
+                        tensors.size()));
+  auto load_record = [&](size_t i) {
+    RecordStreamBuf buf(data + records[i].offset, records[i].size);
+    std::istream is(&buf);
+    DeserializeFromStream(is, tensors[i], dev_ctx);
+  };
+  size_t thread_num = FLAGS_load_combine_thread_num > 0
+                          ? FLAGS_load_combine_thread_num
+                          : std::min<size_t>(
+                                std::thread::hardware_concurrency(), 8UL);
+  thread_num = std::min(thread_num, records.size());
+  if (thread_num <= 1) {
+    for (size_t i = 0; i < records.size(); ++i) {
+      load_record(i);
+    }
+    return;
+  }
+  std::atomic<size_t> next(0);
+  std::mutex fail_mutex;
+  std::exception_ptr first_failure = nullptr;
+  std::vector<std::thread> workers;
+  workers.reserve(thread_num);
+  for (size_t t = 0; t < thread_num; ++t) {
+    workers.emplace_back([&]() {
+      for (size_t i = next++; i < records.size(); i = next++) {
+        try {
+          load_record(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(fail_mutex);
+          if (first_failure == nullptr) {
+            first_failure = std::current_exception();
+          }
+          return;
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  if (first_failure != nullptr) {
+    std::rethrow_exception(first_failure);
+  }
+}
+
 LoD ConvertToOffsetBasedLoD(const LoD &length_lod) {
   LoD offset_lod;
   offset_lod.reserve(length_lod.size());
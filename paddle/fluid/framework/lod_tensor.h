@@ -190,5 +190,28 @@ void SerializeToStream(std::ostream& os, const phi::DenseTensor& tensor);
 
 void DeserializeFromStream(std::istream& os, phi::DenseTensor* tensor);
 
+// One serialized phi::DenseTensor record inside a combined parameter
+// buffer; [offset, offset + size) covers its version, LoD and tensor fields.
+struct CombinedTensorRecord {
+  size_t offset;
+  size_t size;
+};
+
+// Scans the record boundaries of an in-memory combined parameter buffer
+// without materializing any tensor data. Only the small per-tensor desc
+// protos are parsed, so the scan runs at memory bandwidth.
+TEST_API std::vector<CombinedTensorRecord> ScanCombinedTensorRecords(
+    const char* data, size_t size);
+
+// Deserializes every record of an in-memory combined parameter buffer into
+// `tensors`, one record per tensor in order. The records are independent,
+// so they are parsed on multiple threads (FLAGS_load_combine_thread_num)
+// and device uploads overlap with the host-side parsing of later records.
+TEST_API void DeserializeFromCombinedBuffer(
+    const char* data,
+    size_t size,
+    const std::vector<phi::DenseTensor*>& tensors,
+    const platform::DeviceContext& dev_ctx);
+
 }  // namespace framework
 }  // namespace paddle
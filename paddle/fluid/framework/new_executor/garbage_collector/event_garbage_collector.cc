@@ -21,8 +21,35 @@
 #include <windows.h>
 #endif  // !_WIN32
 
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#endif
+
 namespace paddle::framework {
 
+namespace {
+
+inline void YieldGcThread() {
+#if defined(_WIN32)
+  SleepEx(50, FALSE);
+#else
+  sched_yield();
+#endif
+}
+
+// Returns the GPU context behind `ctx` if its garbage can be tracked with a
+// stream-callback watermark; other device types keep the polled event path.
+const phi::GPUContext* AsWatermarkContext(const platform::DeviceContext* ctx) {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  return dynamic_cast<const phi::GPUContext*>(ctx);
+#else
+  (void)ctx;
+  return nullptr;
+#endif
+}
+
+}  // namespace
+
 InterpreterCoreEventGarbageCollector::InterpreterCoreEventGarbageCollector(
     const std::vector<Instruction>& vec_instruction)
     : queue_(nullptr), gc_event_(), events_() {
@@ -66,6 +93,7 @@ void InterpreterCoreEventGarbageCollector::Add(Variable* var,
                         instr.Id(),
                         gc_event_.size()));
   Add(var, &gc_event_.at(instr.Id()), &instr.DeviceContext());
+  FlushIfBatchFull();
 }
 
 void InterpreterCoreEventGarbageCollector::Add(Variable* var,
@@ -78,6 +106,7 @@ void InterpreterCoreEventGarbageCollector::Add(Variable* var,
                         instr->Id(),
                         gc_event_.size()));
   Add(var, &gc_event_.at(instr->Id()), &instr->DeviceContext());
+  FlushIfBatchFull();
 }
 
 void InterpreterCoreEventGarbageCollector::Add(
@@ -156,7 +185,9 @@ void InterpreterCoreEventGarbageCollector::Add(
     return;
   }
 
-  if (max_memory_size_ <= 1) {
+  // Instruction-batched mode queues garbages even without a byte threshold;
+  // they are flushed in one pass by FlushIfBatchFull.
+  if (max_memory_size_ <= 1 && FLAGS_executor_gc_batch_instructions <= 0) {
     Free(garbage, event, ctx);
   } else {
     {  // lock guard
@@ -165,52 +196,106 @@ void InterpreterCoreEventGarbageCollector::Add(
       garbages_->push_back(std::move(garbage));
       events_[ctx] = event;
 
-      if (cur_memory_size_ >= max_memory_size_) {
+      if (max_memory_size_ > 1 && cur_memory_size_ >= max_memory_size_) {
         FreeGarbages();
       }
     }
   }
 }
 
+void InterpreterCoreEventGarbageCollector::FlushIfBatchFull() {
+  if (FLAGS_executor_gc_batch_instructions <= 0) {
+    return;
+  }
+  std::lock_guard<memory::SpinLock> guard(spinlock_);
+  if (++instrs_since_flush_ < FLAGS_executor_gc_batch_instructions) {
+    return;
+  }
+  instrs_since_flush_ = 0;
+  if (!garbages_->empty()) {
+    FreeGarbages();
+  }
+}
+
 void InterpreterCoreEventGarbageCollector::Free(
     const Garbage& garbage,
     platform::DeviceEvent* event,
     const platform::DeviceContext* ctx) {
+  if (const auto* gpu_ctx = AsWatermarkContext(ctx)) {
+    std::shared_ptr<StreamCompletionWatermark> watermark;
+    {
+      std::lock_guard<memory::SpinLock> guard(spinlock_);
+      watermark = GetWatermark(ctx);
+    }
+    const uint64_t ticket = watermark->TakeTicket();
+    gpu_ctx->AddStreamCallback([watermark, ticket]() {
+      watermark->SignalCompleted(ticket);
+    });
+    queue_->AddTask([container = garbage, watermark, ticket]() {
+      while (!watermark->Reached(ticket)) {
+        YieldGcThread();
+      }
+    });
+    return;
+  }
   event->Record(ctx);
   event->SetFinished();  // Only for CPU Event
   queue_->AddTask([container = garbage, event = event]() {
     while (!event->Query()) {
-#if defined(_WIN32)
-      SleepEx(50, FALSE);
-#else
-      sched_yield();
-#endif
-      continue;
+      YieldGcThread();
     }
   });
 }
 
 void InterpreterCoreEventGarbageCollector::FreeGarbages() {
+  // One stream callback per GPU stream covers the whole batch; only events on
+  // devices without callback support are still recorded and polled.
+  std::vector<std::pair<std::shared_ptr<StreamCompletionWatermark>, uint64_t>>
+      tickets;
+  std::vector<platform::DeviceEvent*> polled_events;
   for (auto& vals : events_) {
+    if (const auto* gpu_ctx = AsWatermarkContext(vals.first)) {
+      auto watermark = GetWatermark(vals.first);
+      const uint64_t ticket = watermark->TakeTicket();
+      gpu_ctx->AddStreamCallback([watermark, ticket]() {
+        watermark->SignalCompleted(ticket);
+      });
+      tickets.emplace_back(std::move(watermark), ticket);
+      continue;
+    }
     vals.second->Record(vals.first);
     vals.second->SetFinished();  // Only for CPU Event
+    polled_events.emplace_back(vals.second);
   }
-  queue_->AddTask(
-      [container = std::move(*garbages_), events = std::move(events_)]() {
-        for (auto& vals : events) {
-          while (!vals.second->Query()) {
-#if defined(_WIN32)
-            SleepEx(50, FALSE);
-#else
-            sched_yield();
-#endif
-            continue;
-          }
-        }
-      });
+  queue_->AddTask([container = std::move(*garbages_),
+                   tickets = std::move(tickets),
+                   events = std::move(polled_events)]() {
+    for (auto& item : tickets) {
+      while (!item.first->Reached(item.second)) {
+        YieldGcThread();
+      }
+    }
+    for (auto* event : events) {
+      while (!event->Query()) {
+        YieldGcThread();
+      }
+    }
+  });
   cur_memory_size_ = 0;
   garbages_->clear();
   events_.clear();
 }
 
+std::shared_ptr<StreamCompletionWatermark>
+InterpreterCoreEventGarbageCollector::GetWatermark(
+    const platform::DeviceContext* ctx) {
+  auto iter = watermarks_.find(ctx);
+  if (iter == watermarks_.end()) {
+    iter = watermarks_
+               .emplace(ctx, std::make_shared<StreamCompletionWatermark>())
+               .first;
+  }
+  return iter->second;
+}
+
 }  // namespace paddle::framework
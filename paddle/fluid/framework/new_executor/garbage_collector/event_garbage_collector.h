@@ -13,6 +13,8 @@
 // limitations under the License.
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <queue>
 
 #include "paddle/fluid/framework/new_executor/garbage_collector/garbage_collector.h"
@@ -21,6 +23,35 @@
 namespace paddle {
 namespace framework {
 
+// A monotonic completion watermark for one device stream. Producers take a
+// ticket and enqueue a stream callback that publishes it once all prior work
+// on the stream has finished; consumers wait for their ticket on the host
+// atomic instead of polling the event API.
+struct StreamCompletionWatermark {
+  uint64_t TakeTicket() {
+    return recorded.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // Stream callbacks may run out of ticket order when several threads enqueue
+  // concurrently, so publishing is a monotonic max.
+  void SignalCompleted(uint64_t ticket) {
+    uint64_t prev = completed.load(std::memory_order_relaxed);
+    while (prev < ticket &&
+           !completed.compare_exchange_weak(prev,
+                                            ticket,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+    }
+  }
+
+  bool Reached(uint64_t ticket) const {
+    return completed.load(std::memory_order_acquire) >= ticket;
+  }
+
+  std::atomic<uint64_t> recorded{0};
+  std::atomic<uint64_t> completed{0};
+};
+
 class InterpreterCoreEventGarbageCollector
     : public InterpreterCoreGarbageCollector {
  public:
@@ -50,12 +81,24 @@ class InterpreterCoreEventGarbageCollector
 
   void FreeGarbages();
 
+  // Flushes queued garbages once FLAGS_executor_gc_batch_instructions
+  // instructions have contributed dead variables since the last flush.
+  void FlushIfBatchFull();
+
+  // Returns the watermark of the stream behind `ctx`. Must be called with
+  // spinlock_ held.
+  std::shared_ptr<StreamCompletionWatermark> GetWatermark(
+      const platform::DeviceContext* ctx);
+
   std::unique_ptr<WorkQueue> queue_;
   paddle::memory::SpinLock spinlock_;
   std::vector<paddle::platform::DeviceEvent> gc_event_;
   std::unordered_map<const platform::DeviceContext*,
                      paddle::platform::DeviceEvent*>
       events_;
+  std::unordered_map<const platform::DeviceContext*,
+                     std::shared_ptr<StreamCompletionWatermark>>
+      watermarks_;
 };
 }  // namespace framework
 }  // namespace paddle
@@ -20,11 +20,13 @@ namespace framework {
 void InterpreterCoreFastGarbageCollector::Add(Variable* var,
                                               const Instruction&) {
   Add(var);
+  FlushIfBatchFull();
 }
 
 void InterpreterCoreFastGarbageCollector::Add(Variable* var,
                                               const InstructionBase*) {
   Add(var);
+  FlushIfBatchFull();
 }
 
 void InterpreterCoreFastGarbageCollector::Add(Variable* var) {
@@ -86,14 +88,17 @@ void InterpreterCoreFastGarbageCollector::Add(Garbage garbage) {
     return;
   }
 
-  if (max_memory_size_ > 1) {
+  // Without batching and without a byte threshold the garbage is released
+  // right here when the shared_ptr goes out of scope. Instruction-batched
+  // mode queues it so FlushIfBatchFull can release a whole batch at once.
+  if (max_memory_size_ > 1 || FLAGS_executor_gc_batch_instructions > 0) {
     std::unique_ptr<GarbageQueue> pending_delete_garbages;
     {  // lock guard
       std::lock_guard<memory::SpinLock> guard(spinlock_);
       cur_memory_size_ += static_cast<int64_t>(garbage->size());
       garbages_->push_back(std::move(garbage));
 
-      if (cur_memory_size_ >= max_memory_size_) {
+      if (max_memory_size_ > 1 && cur_memory_size_ >= max_memory_size_) {
         cur_memory_size_ = 0;
         pending_delete_garbages = std::move(garbages_);
         garbages_ = std::make_unique<GarbageQueue>();
@@ -102,5 +107,26 @@ void InterpreterCoreFastGarbageCollector::Add(Garbage garbage) {
   }
 }
 
+void InterpreterCoreFastGarbageCollector::FlushIfBatchFull() {
+  if (FLAGS_executor_gc_batch_instructions <= 0) {
+    return;
+  }
+  std::unique_ptr<GarbageQueue> pending_delete_garbages;
+  {  // lock guard
+    std::lock_guard<memory::SpinLock> guard(spinlock_);
+    if (++instrs_since_flush_ < FLAGS_executor_gc_batch_instructions) {
+      return;
+    }
+    instrs_since_flush_ = 0;
+    if (garbages_->empty()) {
+      return;
+    }
+    cur_memory_size_ = 0;
+    pending_delete_garbages = std::move(garbages_);
+    garbages_ = std::make_unique<GarbageQueue>();
+  }
+  // The batch is released here, outside the lock.
+}
+
 }  // namespace framework
 }  // namespace paddle
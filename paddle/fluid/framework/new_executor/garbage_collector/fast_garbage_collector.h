@@ -28,6 +28,11 @@ class InterpreterCoreFastGarbageCollector
  private:
   void Add(Variable* var);
   void Add(Garbage garbage);
+
+  // Releases the queued garbages in one pass once
+  // FLAGS_executor_gc_batch_instructions instructions have contributed dead
+  // variables since the last flush.
+  void FlushIfBatchFull();
 };
 }  // namespace framework
 }  // namespace paddle
@@ -17,6 +17,16 @@
 #include "paddle/fluid/framework/new_executor/garbage_collector/event_garbage_collector.h"
 #include "paddle/fluid/framework/new_executor/garbage_collector/fast_garbage_collector.h"
 #include "paddle/fluid/framework/new_executor/garbage_collector/no_event_garbage_collector.h"
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_int64(
+    executor_gc_batch_instructions,
+    0,
+    "When > 0, the interpreter garbage collectors accumulate dead variables "
+    "and release them in one pass every this many instructions instead of "
+    "freeing per variable, trading memory slack (still bounded by "
+    "FLAGS_eager_delete_tensor_gb when set) for fewer allocator round "
+    "trips. 0 (default) keeps the per-variable behavior.");
 
 namespace paddle {
 namespace framework {
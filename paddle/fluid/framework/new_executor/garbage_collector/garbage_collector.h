@@ -24,6 +24,7 @@
 
 COMMON_DECLARE_bool(fast_eager_deletion_mode);
 COMMON_DECLARE_bool(new_executor_use_cuda_graph);
+PD_DECLARE_int64(executor_gc_batch_instructions);
 
 namespace paddle {
 namespace framework {
@@ -46,6 +47,9 @@ class InterpreterCoreGarbageCollector {
   std::unique_ptr<GarbageQueue> garbages_;
   int64_t max_memory_size_;
   int64_t cur_memory_size_;
+  // Number of instructions whose dead vars were added since the last
+  // batched flush, only used when FLAGS_executor_gc_batch_instructions > 0.
+  int64_t instrs_since_flush_{0};
   memory::SpinLock spinlock_;
 };
 
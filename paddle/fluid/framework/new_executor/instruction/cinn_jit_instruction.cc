@@ -21,10 +21,13 @@
 #include "paddle/common/performance_statistician.h"
 #include "paddle/fluid/framework/new_executor/pir_adaptor/pir_adaptor_util.h"
 #if defined(PADDLE_WITH_CUDA)
+#include <cuda_runtime.h>
+
 #include "paddle/cinn/runtime/cinn_runtime.h"
 #endif
 PD_DECLARE_bool(cinn_bucket_compile);
 PD_DECLARE_bool(cinn_measure_kernel_time);
+PD_DECLARE_bool(cinn_use_cuda_graph);
 PD_DECLARE_string(tile_config_policy);
 PD_DECLARE_string(cinn_kernel_execution_label);
 
@@ -147,6 +150,10 @@ class CinnJitInstruction::FnPtrImpl {
     VLOG(6) << "End InferShape: " << cinn_kernel_info_.fn_name;
   }
 
+  bool HasSymbolicArgs() const {
+    return !cinn_kernel_info_.int_args_map.empty();
+  }
+
  private:
   CINNKernelInfo cinn_kernel_info_;
 
@@ -229,7 +236,14 @@ void CinnJitInstruction::Run() {
     dev_ctx_->Alloc(tensor_args_[i], tensor_args_[i]->dtype());
   }
 
-  // 2. exexute kernel
+  // 2. execute kernel, replaying a captured CUDA graph when possible
+  if (FLAGS_cinn_use_cuda_graph && is_gpu && !need_update_shape &&
+      !fn_ptr_impl_->HasSymbolicArgs() && !FLAGS_cinn_measure_kernel_time &&
+      FLAGS_tile_config_policy != "search") {
+    if (RunWithCudaGraph(running_stream)) {
+      return;
+    }
+  }
   fn_ptr_impl_->Run(tensor_args_, running_stream, is_gpu);
 #else
   VLOG(0) << "Not Supported: cinn jit instruction currently does not "
@@ -237,6 +251,68 @@ void CinnJitInstruction::Run() {
 #endif
 }
 
+bool CinnJitInstruction::RunWithCudaGraph(void* stream) {
+#if defined(PADDLE_WITH_CUDA)
+  auto cuda_stream = static_cast<cudaStream_t>(stream);
+  std::vector<void*> arg_ptrs;
+  arg_ptrs.reserve(tensor_args_.size());
+  for (auto* tensor : tensor_args_) {
+    arg_ptrs.push_back(tensor->data());
+  }
+
+  if (cuda_graph_exec_ != nullptr) {
+    if (arg_ptrs == captured_arg_ptrs_) {
+      PADDLE_ENFORCE_GPU_SUCCESS(cudaGraphLaunch(
+          static_cast<cudaGraphExec_t>(cuda_graph_exec_), cuda_stream));
+      return true;
+    }
+    // The allocator moved one of the buffers, the captured launches address
+    // stale memory. Drop the graph and capture again below.
+    VLOG(4) << "Recapture CUDA graph of " << Name()
+            << " because an argument pointer changed";
+    PADDLE_ENFORCE_GPU_SUCCESS(cudaGraphExecDestroy(
+        static_cast<cudaGraphExec_t>(cuda_graph_exec_)));
+    cuda_graph_exec_ = nullptr;
+    captured_arg_ptrs_.clear();
+  }
+
+  // Defer to an enclosing capture (e.g. the executor recording a whole-program
+  // CUDA graph): the plain launch path below gets recorded into it.
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      cudaStreamIsCapturing(cuda_stream, &capture_status));
+  if (capture_status != cudaStreamCaptureStatusNone) {
+    return false;
+  }
+
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      cudaStreamBeginCapture(cuda_stream, cudaStreamCaptureModeThreadLocal));
+  fn_ptr_impl_->Run(tensor_args_, stream, /*is_gpu=*/true);
+  cudaGraph_t graph = nullptr;
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaStreamEndCapture(cuda_stream, &graph));
+  cudaGraphExec_t graph_exec = nullptr;
+  PADDLE_ENFORCE_GPU_SUCCESS(
+      cudaGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaGraphDestroy(graph));
+  cuda_graph_exec_ = graph_exec;
+  captured_arg_ptrs_ = std::move(arg_ptrs);
+
+  // Capture only records the launches, so replay once for this run.
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaGraphLaunch(graph_exec, cuda_stream));
+  return true;
+#else
+  return false;
+#endif
+}
+
+CinnJitInstruction::~CinnJitInstruction() {
+#if defined(PADDLE_WITH_CUDA)
+  if (cuda_graph_exec_ != nullptr) {
+    cudaGraphExecDestroy(static_cast<cudaGraphExec_t>(cuda_graph_exec_));
+  }
+#endif
+}
+
 const std::string& CinnJitInstruction::Name() const {
   static const std::string name = "cinn_jit";
   return name;
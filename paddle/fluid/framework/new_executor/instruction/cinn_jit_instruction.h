@@ -32,6 +32,8 @@ class CinnJitInstruction : public InstructionBase {
                      ::pir::Operation* op,
                      const ValueExecutionInfo* value_exec_info);
 
+  ~CinnJitInstruction() override;
+
   // TODO(Aurelius84): Only implement core interface and need implement GC and
   // Event logic.
   void Run() override;
@@ -55,6 +57,17 @@ class CinnJitInstruction : public InstructionBase {
   bool need_update_shape{false};
   std::vector<phi::DenseTensor*> tensor_args_;
 
+  // Replay the kernel launches of this static-shape instruction through a
+  // CUDA graph captured at first run, as long as the argument pointers stay
+  // the same. Returns false when the launches went through (or must go
+  // through) the normal path. Only used under FLAGS_cinn_use_cuda_graph.
+  bool RunWithCudaGraph(void* stream);
+
+  // Instantiated cudaGraphExec_t (kept as void* to avoid leaking CUDA
+  // headers here) and the argument pointers it was captured with.
+  void* cuda_graph_exec_{nullptr};
+  std::vector<void*> captured_arg_ptrs_;
+
   ::pir::Operation* op_{nullptr};  // not owned
 };
 
@@ -14,6 +14,7 @@
 
 #include "paddle/fluid/framework/new_executor/interpreter/dependency_builder.h"
 
+#include <fstream>
 #include <queue>
 #include <sstream>
 #include <stack>
@@ -45,6 +46,22 @@ PADDLE_DEFINE_EXPORTED_bool(enable_dependency_builder_debug_info,
                             false,
                             "Enable dependency builder debug info");
 
+PADDLE_DEFINE_EXPORTED_bool(
+    new_executor_critical_path_priority,
+    false,
+    "Prioritize ready instructions by the length of their longest "
+    "dependency chain to the end of the program, so critical-path ops are "
+    "dispatched before cheap leaves that became ready at the same time.");
+
+PADDLE_DEFINE_EXPORTED_string(
+    new_executor_pir_dependency_cache_dir,
+    "",
+    "Directory used to persist the dependency analysis result of "
+    "PirDependencyBuilder across process restarts. When non-empty, Build() "
+    "first tries to load a cache file keyed by a fingerprint of the "
+    "instruction list and falls back to the full analysis (then saves it) "
+    "on a miss. Empty (default) disables the cache.");
+
 namespace paddle::framework::interpreter {
 
 size_t CountDownstreamMap(
@@ -71,6 +88,67 @@ const std::string StringizeDownstreamMap(
   return oss.str();
 }
 
+namespace {
+
+uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+// Fingerprint of everything the dependency analysis reads: the instruction
+// list (op name plus input/output variable ids) and the flags that change
+// which extra edges get added. Two instruction lists with the same
+// fingerprint build the same downstream map, so it is safe to reuse a built
+// graph (or a persisted cache file) across re-preparations keyed on it.
+uint64_t InstructionListFingerprint(
+    const std::vector<paddle::framework::InstructionBase*>& instructions) {
+  std::hash<std::string> str_hasher;
+  uint64_t fingerprint = instructions.size();
+  for (auto* instr : instructions) {
+    fingerprint = HashCombine(fingerprint, str_hasher(instr->Name()));
+    for (auto& item : instr->Inputs()) {
+      for (auto var : item.second) {
+        fingerprint = HashCombine(fingerprint, static_cast<uint64_t>(var));
+      }
+    }
+    for (auto& item : instr->Outputs()) {
+      for (auto var : item.second) {
+        fingerprint = HashCombine(fingerprint, static_cast<uint64_t>(var));
+      }
+    }
+  }
+  fingerprint = HashCombine(fingerprint, FLAGS_new_executor_sequential_run);
+  fingerprint =
+      HashCombine(fingerprint, FLAGS_add_dependency_for_communication_op);
+  return fingerprint;
+}
+
+uint64_t InstructionListFingerprint(
+    const std::vector<paddle::framework::Instruction>& instructions) {
+  std::hash<std::string> str_hasher;
+  uint64_t fingerprint = instructions.size();
+  for (auto& instr : instructions) {
+    if (instr.OpBaseValid()) {
+      fingerprint = HashCombine(fingerprint, str_hasher(instr.OpBase()->Type()));
+    }
+    for (auto& item : instr.Inputs()) {
+      for (auto var : item.second) {
+        fingerprint = HashCombine(fingerprint, static_cast<uint64_t>(var));
+      }
+    }
+    for (auto& item : instr.Outputs()) {
+      for (auto var : item.second) {
+        fingerprint = HashCombine(fingerprint, static_cast<uint64_t>(var));
+      }
+    }
+  }
+  fingerprint = HashCombine(fingerprint, FLAGS_new_executor_sequential_run);
+  fingerprint =
+      HashCombine(fingerprint, FLAGS_add_dependency_for_communication_op);
+  return fingerprint;
+}
+
+}  // namespace
+
 DependencyBuilder::DependencyBuilder()
     : is_build_(false),
       op_num_(0),
@@ -85,14 +163,30 @@ DependencyBuilder::DependencyBuilder()
 
 const std::map<size_t, std::set<size_t>>& DependencyBuilder::Build(
     const std::vector<Instruction>& instructions) {
+  const uint64_t fingerprint = InstructionListFingerprint(instructions);
   if (is_build_) {
-    return *op_downstream_map_;
+    // Incremental re-preparation: when only shapes changed (kernel choice
+    // and workspace sizes are redone by BuildOpFuncList), the topology
+    // fingerprint is unchanged and the built graph is reused as is. A
+    // changed topology falls through to a full rebuild instead of silently
+    // returning a stale graph.
+    if (fingerprint == topology_fingerprint_) {
+      instructions_ = &instructions;
+      VLOG(4) << "Reuse dependency graph, topology unchanged for "
+              << instructions.size() << " ops";
+      return *op_downstream_map_;
+    }
+    VLOG(4) << "Topology changed, rebuild dependency graph";
+    is_build_ = false;
+    op_downstream_map_->clear();
+    op_happens_before_->clear();
   }
 
   std::tie(op_downstream_map_, op_happens_before_) = GetDependency();
 
   instructions_ = &instructions;
   op_num_ = instructions_->size();
+  topology_fingerprint_ = fingerprint;
 
   ops_before_.assign(op_num_, {});
   ops_behind_.assign(op_num_, {});
@@ -137,11 +231,101 @@ DependencyBuilder::GetDependency() const {
   return std::make_tuple(op_downstream_map_, op_happens_before_);
 }
 
+std::vector<size_t> DependencyBuilder::CalculateCriticalPathDepths() const {
+  PADDLE_ENFORCE_EQ(
+      is_build_,
+      true,
+      phi::errors::Unavailable(
+          "DependencyBuilder is not yet built, call Build() firstly."));
+  // Instruction indices follow program order, which is a topological order
+  // of the dependency DAG, so a single reverse sweep computes the longest
+  // path from each op to any sink.
+  std::vector<size_t> depths(op_num_, 1);
+  for (size_t idx = op_num_; idx > 0; --idx) {
+    size_t op_idx = idx - 1;
+    auto iter = op_downstream_map_->find(op_idx);
+    if (iter == op_downstream_map_->end()) {
+      continue;
+    }
+    for (size_t downstream_idx : iter->second) {
+      if (downstream_idx > op_idx) {
+        depths[op_idx] =
+            std::max(depths[op_idx], depths[downstream_idx] + 1);
+      }
+    }
+  }
+  return depths;
+}
+
 void DependencyBuilder::ShareDependencyFrom(const DependencyBuilder& src) {
   std::tie(op_downstream_map_, op_happens_before_) = src.GetDependency();
+  topology_fingerprint_ = src.topology_fingerprint_;
   is_build_ = true;
 }
 
+void DependencyBuilder::SaveDependencyCache(const std::string& path) const {
+  std::ofstream fout(path, std::ios::trunc);
+  if (!fout.is_open()) {
+    LOG(WARNING) << "Cannot open dependency cache file " << path
+                 << " for writing, skip saving.";
+    return;
+  }
+  fout << "PIRDEPCACHE v1\n";
+  fout << op_num_ << " " << CountDownstreamMap(*op_downstream_map_) << "\n";
+  for (auto const& pair : *op_downstream_map_) {
+    for (size_t downstream_idx : pair.second) {
+      fout << pair.first << " " << downstream_idx << "\n";
+    }
+  }
+  VLOG(4) << "Saved dependency cache for " << op_num_ << " ops to " << path;
+}
+
+bool DependencyBuilder::TryLoadDependencyCache(const std::string& path,
+                                               size_t op_num) {
+  std::ifstream fin(path);
+  if (!fin.is_open()) {
+    return false;
+  }
+  std::string magic, version;
+  size_t cached_op_num = 0, edge_num = 0;
+  fin >> magic >> version >> cached_op_num >> edge_num;
+  if (fin.fail() || magic != "PIRDEPCACHE" || version != "v1" ||
+      cached_op_num != op_num) {
+    LOG(WARNING) << "Dependency cache file " << path
+                 << " is stale or corrupted, rebuild from scratch.";
+    return false;
+  }
+  // Replaying the shrunk edges through AddDownstreamOp rebuilds ops_before_,
+  // ops_behind_ and op_happens_before_ exactly as the original analysis did,
+  // while skipping the expensive per-variable read/write scan.
+  bool ok = true;
+  try {
+    for (size_t i = 0; i < edge_num; ++i) {
+      size_t prior_op_idx = 0, posterior_op_idx = 0;
+      fin >> prior_op_idx >> posterior_op_idx;
+      if (fin.fail() || prior_op_idx >= op_num || posterior_op_idx >= op_num) {
+        ok = false;
+        break;
+      }
+      AddDownstreamOp(prior_op_idx, posterior_op_idx);
+    }
+  } catch (...) {
+    // A cyclic edge list means the cache does not match this program.
+    ok = false;
+  }
+  if (!ok) {
+    LOG(WARNING) << "Dependency cache file " << path
+                 << " contains invalid edges, rebuild from scratch.";
+    op_downstream_map_->clear();
+    ops_before_.assign(op_num, {});
+    ops_behind_.assign(op_num, {});
+    op_happens_before_->assign(op_num, std::vector<bool>(op_num, false));
+    return false;
+  }
+  VLOG(4) << "Loaded dependency cache for " << op_num << " ops from " << path;
+  return true;
+}
+
 const std::string& DependencyBuilder::GetInstructionName(size_t op_idx) const {
   return (*instructions_)[op_idx].OpBase()->Type();
 }
@@ -647,19 +831,44 @@ void PirDependencyBuilder::AddDependencyForRandomOp() {
 
 const std::map<size_t, std::set<size_t>>& PirDependencyBuilder::Build(
     std::vector<paddle::framework::InstructionBase*> instructions) {
+  const uint64_t fingerprint = InstructionListFingerprint(instructions);
   if (is_build_) {
-    return *op_downstream_map_;
+    // See DependencyBuilder::Build: an unchanged topology reuses the built
+    // graph across re-preparations, a changed one triggers a full rebuild.
+    if (fingerprint == topology_fingerprint_) {
+      instructions_ = instructions;
+      VLOG(4) << "Reuse dependency graph, topology unchanged for "
+              << instructions.size() << " ops";
+      return *op_downstream_map_;
+    }
+    VLOG(4) << "Topology changed, rebuild dependency graph";
+    is_build_ = false;
+    op_downstream_map_->clear();
+    op_happens_before_->clear();
   }
 
   std::tie(op_downstream_map_, op_happens_before_) = GetDependency();
 
   instructions_ = instructions;
   op_num_ = instructions_.size();
+  topology_fingerprint_ = fingerprint;
 
   ops_before_.assign(op_num_, {});
   ops_behind_.assign(op_num_, {});
   op_happens_before_->assign(op_num_, std::vector<bool>(op_num_, false));
 
+  std::string cache_path;
+  if (!FLAGS_new_executor_pir_dependency_cache_dir.empty()) {
+    std::ostringstream name;
+    name << FLAGS_new_executor_pir_dependency_cache_dir << "/pir_dep_"
+         << std::hex << fingerprint << ".cache";
+    cache_path = name.str();
+    if (TryLoadDependencyCache(cache_path, op_num_)) {
+      is_build_ = true;
+      return *op_downstream_map_;
+    }
+  }
+
   BuildDownstreamMap();
   VLOG(6) << "Finish BuildDownstreamMap";
 
@@ -679,6 +888,10 @@ const std::map<size_t, std::set<size_t>>& PirDependencyBuilder::Build(
   // Note(lvyongkang): necessary for reproducibility
   AddDependencyForRandomOp();
 
+  if (!cache_path.empty()) {
+    SaveDependencyCache(cache_path);
+  }
+
   VLOG(6) << "Finish build dependency";
   VLOG(8) << "downstream count: " << CountDownstreamMap(*op_downstream_map_);
   VLOG(8) << "downstream_map: " << std::endl
@@ -766,6 +979,7 @@ void PirDependencyBuilder::BuildDownstreamMap() {
 void PirDependencyBuilder::ShareDependencyFrom(
     const PirDependencyBuilder& src) {
   std::tie(op_downstream_map_, op_happens_before_) = src.GetDependency();
+  topology_fingerprint_ = src.topology_fingerprint_;
   is_build_ = true;
 }
 
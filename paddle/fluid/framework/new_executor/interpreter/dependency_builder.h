@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <string>
 #include <vector>
 
 #include "paddle/fluid/framework/new_executor/instruction/instruction_base.h"
@@ -58,6 +60,21 @@ class DependencyBuilder {
 
   void ShareDependencyFrom(const DependencyBuilder& src);
 
+  // Best-effort persistent cache of the analysis result. Save writes the
+  // shrunk downstream map to a text file; TryLoad replays the edges through
+  // AddDownstreamOp so ops_before_, ops_behind_ and op_happens_before_ are
+  // rebuilt without the O(op_num^2) variable scan of BuildDownstreamMap.
+  // TryLoad returns false and leaves the builder in its initial state when
+  // the file is missing, corrupted, or was built for a different op count.
+  void SaveDependencyCache(const std::string& path) const;
+  bool TryLoadDependencyCache(const std::string& path, size_t op_num);
+
+  // Length (in ops) of the longest dependency chain from each op to any
+  // sink of the DAG. Ops on long chains are the critical-path candidates
+  // and should be dispatched before cheap leaves that became ready at the
+  // same time. Can only be called after Build().
+  std::vector<size_t> CalculateCriticalPathDepths() const;
+
   bool IsSameDeviceContext(size_t op1, size_t op2) const {
     return &((*instructions_)[op1].DeviceContext()) ==
            &((*instructions_)[op2].DeviceContext());
@@ -86,6 +103,11 @@ class DependencyBuilder {
 
   bool is_build_;
 
+  // Fingerprint of the instruction list the current graph was built for;
+  // lets Build() tell a shape-only re-preparation (reuse the graph) from a
+  // topology change (full rebuild).
+  uint64_t topology_fingerprint_{0};
+
   size_t op_num_;
 
   // ops_behind_ is the adjacency list about op to its posterior-ops, that is to
@@ -14,9 +14,11 @@
 
 #include "paddle/fluid/framework/new_executor/interpreter/execution_config.h"
 
+#include <algorithm>
 #include <set>
 #include <thread>
 
+#include "paddle/fluid/framework/new_executor/workqueue/workqueue_utils.h"
 #include "paddle/fluid/platform/device/ipu/ipu_info.h"
 #include "paddle/phi/backends/device_manager.h"
 #include "paddle/phi/backends/gpu/gpu_info.h"
@@ -118,6 +120,43 @@ void ExecutionConfig::AnalyzeThreadPoolConfig(const phi::Place& place,
   }
 }
 
+// See ExecutionConfig::HostWorkerCores for the policy.
+static std::vector<size_t> EffectiveWorkerCores(
+    const std::vector<size_t>& explicit_cores,
+    const std::vector<size_t>& reserved_cores) {
+  if (!explicit_cores.empty() || reserved_cores.empty()) {
+    return explicit_cores;
+  }
+  std::vector<size_t> cores;
+  const size_t num_cores = std::thread::hardware_concurrency();
+  for (size_t core = 0; core < num_cores; ++core) {
+    if (std::find(reserved_cores.begin(), reserved_cores.end(), core) ==
+        reserved_cores.end()) {
+      cores.push_back(core);
+    }
+  }
+  return cores;
+}
+
+std::vector<size_t> ExecutionConfig::HostWorkerCores() const {
+  return EffectiveWorkerCores(host_thread_cores, reserved_cores);
+}
+
+std::vector<size_t> ExecutionConfig::DeviceWorkerCores() const {
+  return EffectiveWorkerCores(device_thread_cores, reserved_cores);
+}
+
+void ExecutionConfig::ApplyDispatchThreadAffinity() {
+  if (dispatch_core < 0 || dispatch_affinity_applied_) {
+    return;
+  }
+  dispatch_affinity_applied_ = true;
+  if (!TryBindThreadToCores({static_cast<size_t>(dispatch_core)})) {
+    LOG(WARNING) << "Failed to bind the dispatch thread to core "
+                 << dispatch_core;
+  }
+}
+
 void ExecutionConfig::Log(int log_level) {
   std::stringstream log_str;
   log_str << "ExecutionConfig:\n"
@@ -126,7 +165,26 @@ void ExecutionConfig::Log(int log_level) {
           << "used_for_control_flow_op = " << used_for_control_flow_op << "\n"
           << "used_for_jit = " << used_for_jit << "\n"
           << "device_num_threads = " << device_num_threads << "\n"
-          << "host_num_threads = " << host_num_threads << "\n";
+          << "host_num_threads = " << host_num_threads << "\n"
+          << "dispatch_core = " << dispatch_core << "\n";
+
+  log_str << "host_thread_cores = [";
+  for (size_t core : host_thread_cores) {
+    log_str << core << " ";
+  }
+  log_str << "]\n";
+
+  log_str << "device_thread_cores = [";
+  for (size_t core : device_thread_cores) {
+    log_str << core << " ";
+  }
+  log_str << "]\n";
+
+  log_str << "reserved_cores = [";
+  for (size_t core : reserved_cores) {
+    log_str << core << " ";
+  }
+  log_str << "]\n";
 
   log_str << "force_root_scope_vars = [";
   for (const std::string& var : force_root_scope_vars) {
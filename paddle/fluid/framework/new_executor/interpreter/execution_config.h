@@ -16,6 +16,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "paddle/fluid/platform/place.h"
 
@@ -34,12 +35,38 @@ struct ExecutionConfig {
   size_t device_num_threads{0};
   size_t host_num_threads{0};
 
+  // Optional thread-affinity policy, all programmatic. The executor never
+  // pins threads unless one of these fields is set.
+  // Core to pin the dispatch (TraceRun/MultiThreadRun) thread to; -1 means
+  // do not pin.
+  int dispatch_core{-1};
+  // Cores for the host / device kernel launch workers. Workers are assigned
+  // round robin over the set, so callers can partition workers per NUMA node
+  // by listing that node's cores.
+  std::vector<size_t> host_thread_cores;
+  std::vector<size_t> device_thread_cores;
+  // Cores reserved for other threads (e.g. feed threads). Only consulted
+  // when the explicit sets above are empty: workers then float over all
+  // hardware cores except the reserved ones.
+  std::vector<size_t> reserved_cores;
+
   std::set<std::string> force_root_scope_vars;
   std::set<std::string> jit_input_vars;
   std::set<std::string> skip_gc_vars;
 
   void AnalyzeThreadPoolConfig(const phi::Place& place, size_t op_num);
+  // Returns the effective core set for the host/device worker pools: the
+  // explicit set when non-empty, otherwise all cores minus reserved_cores
+  // when reserved_cores is set, otherwise empty (no pinning).
+  std::vector<size_t> HostWorkerCores() const;
+  std::vector<size_t> DeviceWorkerCores() const;
+  // Pins the calling thread to dispatch_core. Called from the interpreter's
+  // run loop; only the first call takes effect.
+  void ApplyDispatchThreadAffinity();
   void Log(int log_level);
+
+ private:
+  bool dispatch_affinity_applied_{false};
 };
 
 }  // namespace interpreter
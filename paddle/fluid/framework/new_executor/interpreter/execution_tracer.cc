@@ -0,0 +1,142 @@
+// Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/framework/new_executor/interpreter/execution_tracer.h"
+
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include "glog/logging.h"
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_string(
+    new_executor_trace_file,
+    "",
+    "When non-empty, the interpreter ring-buffer tracer is enabled at "
+    "interpreter construction and its records are dumped to this file in "
+    "chrome://tracing JSON format when the interpreter is destroyed.");
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+namespace {
+
+const char* TracePointName(TracePointKind kind) {
+  switch (kind) {
+    case TracePointKind::kDispatch:
+      return "dispatch";
+    case TracePointKind::kKernelLaunch:
+      return "kernel_launch";
+    case TracePointKind::kGC:
+      return "gc";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+ExecutionTracer& ExecutionTracer::Instance() {
+  static ExecutionTracer* tracer = new ExecutionTracer;
+  return *tracer;
+}
+
+void ExecutionTracer::Enable(size_t capacity) {
+  if (enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  size_t rounded = 1;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+  capacity_ = rounded;
+  records_.assign(capacity_, TraceRecord{});
+  next_slot_.store(0, std::memory_order_relaxed);
+  base_tsc_ = Now();
+  base_time_ = std::chrono::steady_clock::now();
+  enabled_.store(true, std::memory_order_release);
+}
+
+void ExecutionTracer::Disable() {
+  enabled_.store(false, std::memory_order_release);
+}
+
+void ExecutionTracer::Record(TracePointKind kind,
+                             uint32_t instr_id,
+                             uint64_t start_tsc,
+                             uint64_t end_tsc) {
+  if (!enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const uint64_t slot =
+      next_slot_.fetch_add(1, std::memory_order_relaxed) & (capacity_ - 1);
+  TraceRecord& record = records_[slot];
+  record.start_tsc = start_tsc;
+  record.end_tsc = end_tsc;
+  record.thread_id =
+      std::hash<std::thread::id>()(std::this_thread::get_id());
+  record.instr_id = instr_id;
+  record.kind = kind;
+}
+
+void ExecutionTracer::DumpChromeTrace(const std::string& path) const {
+  std::ofstream fout(path, std::ios::trunc);
+  if (!fout.is_open()) {
+    LOG(WARNING) << "Cannot open " << path << " for writing, skip dump.";
+    return;
+  }
+
+  // Re-calibrate: ticks elapsed since Enable() against the steady clock.
+  const uint64_t tsc_now = Now();
+  const auto time_now = std::chrono::steady_clock::now();
+  const double elapsed_ns =
+      static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              time_now - base_time_)
+                              .count());
+  const double tsc_delta = static_cast<double>(tsc_now - base_tsc_);
+  const double ns_per_tick = tsc_delta > 0 ? elapsed_ns / tsc_delta : 1.0;
+
+  const uint64_t total = next_slot_.load(std::memory_order_relaxed);
+  const uint64_t num_records = total < capacity_ ? total : capacity_;
+  const uint64_t first = total < capacity_ ? 0 : total & (capacity_ - 1);
+
+  fout << "{\"traceEvents\":[";
+  bool need_comma = false;
+  for (uint64_t i = 0; i < num_records; ++i) {
+    const TraceRecord& record = records_[(first + i) & (capacity_ - 1)];
+    if (record.end_tsc < record.start_tsc || record.start_tsc < base_tsc_) {
+      continue;  // slot being overwritten concurrently
+    }
+    const double ts_us =
+        static_cast<double>(record.start_tsc - base_tsc_) * ns_per_tick / 1e3;
+    const double dur_us =
+        static_cast<double>(record.end_tsc - record.start_tsc) * ns_per_tick /
+        1e3;
+    if (need_comma) {
+      fout << ",";
+    }
+    need_comma = true;
+    fout << "{\"ph\":\"X\",\"name\":\"" << TracePointName(record.kind)
+         << "\",\"pid\":0,\"tid\":" << record.thread_id
+         << ",\"ts\":" << ts_us << ",\"dur\":" << dur_us
+         << ",\"args\":{\"instr_id\":" << record.instr_id << "}}";
+  }
+  fout << "]}";
+  VLOG(4) << "Dumped " << num_records << " trace records to " << path;
+}
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+#include "paddle/common/macros.h"
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+enum class TracePointKind : uint8_t {
+  kDispatch = 0,      // scheduling work around an instruction
+  kKernelLaunch = 1,  // RunInstructionBase body
+  kGC = 2,            // CheckGC
+};
+
+// One fixed-size slot per tracepoint, written lock-free from the dispatch
+// threads.
+struct TraceRecord {
+  uint64_t start_tsc;
+  uint64_t end_tsc;
+  uint64_t thread_id;
+  uint32_t instr_id;
+  TracePointKind kind;
+};
+
+// Always-compiled tracer for the interpreter hot loop. Disabled (the
+// default) a tracepoint costs one relaxed atomic load; enabled, each scope
+// costs two TSC reads and one relaxed fetch_add into a fixed ring buffer —
+// cheap enough to leave on in production, unlike the profiler whose
+// overhead perturbs the timings it is meant to explain. The hot path never
+// locks or allocates; TSC ticks are calibrated against the steady clock
+// between Enable() and DumpChromeTrace() so the dump carries nanoseconds.
+// (The label-keyed PerformanceStatistician in paddle/common serves a
+// similar purpose for CINN compilation but takes a mutex per point, which
+// is too heavy for per-instruction use.)
+class ExecutionTracer {
+ public:
+  static ExecutionTracer& Instance();
+
+  // Rounds capacity up to a power of two; the ring keeps the newest
+  // `capacity` records.
+  void Enable(size_t capacity = 1 << 20);
+  void Disable();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  static uint64_t Now() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+  }
+
+  void Record(TracePointKind kind,
+              uint32_t instr_id,
+              uint64_t start_tsc,
+              uint64_t end_tsc);
+
+  // Writes the buffered records, oldest first, in chrome://tracing JSON
+  // format. Safe to call while tracing is active; concurrent records may be
+  // partially visible and are skipped.
+  void DumpChromeTrace(const std::string& path) const;
+
+ private:
+  ExecutionTracer() = default;
+  DISABLE_COPY_AND_ASSIGN(ExecutionTracer);
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<uint64_t> next_slot_{0};
+  std::vector<TraceRecord> records_;
+  size_t capacity_{0};
+
+  // Calibration anchors taken at Enable() time.
+  uint64_t base_tsc_{0};
+  std::chrono::steady_clock::time_point base_time_;
+};
+
+// RAII tracepoint: samples the enabled flag once on entry, timestamps on
+// entry and exit, and records on destruction.
+class TraceScope {
+ public:
+  TraceScope(TracePointKind kind, uint32_t instr_id)
+      : enabled_(ExecutionTracer::Instance().IsEnabled()),
+        kind_(kind),
+        instr_id_(instr_id),
+        start_(enabled_ ? ExecutionTracer::Now() : 0) {}
+
+  ~TraceScope() {
+    if (UNLIKELY(enabled_)) {
+      ExecutionTracer::Instance().Record(
+          kind_, instr_id_, start_, ExecutionTracer::Now());
+    }
+  }
+
+  DISABLE_COPY_AND_ASSIGN(TraceScope);
+
+ private:
+  const bool enabled_;
+  const TracePointKind kind_;
+  const uint32_t instr_id_;
+  const uint64_t start_;
+};
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
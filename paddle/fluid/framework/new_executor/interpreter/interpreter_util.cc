@@ -90,7 +90,11 @@ class SingleStreamGuard {
 };
 
 const std::vector<WorkQueueOptions> ConstructWorkQueueOptions(
-    size_t host_num_threads, size_t device_num_threads, EventsWaiter* waiter) {
+    size_t host_num_threads,
+    size_t device_num_threads,
+    EventsWaiter* waiter,
+    const std::vector<size_t>& host_thread_cores = {},
+    const std::vector<size_t>& device_thread_cores = {}) {
   std::vector<WorkQueueOptions> group_options;
   // for execute host Kernel
   group_options.emplace_back(/*name*/ "HostTasks",
@@ -100,6 +104,7 @@ const std::vector<WorkQueueOptions> ConstructWorkQueueOptions(
                              /*track_task*/ false,
                              /*detached*/ true,
                              /*events_waiter*/ waiter);
+  group_options.back().thread_bind_cores = host_thread_cores;
   // for launch device Kernel
   group_options.emplace_back(/*name*/ "DeviceKernelLaunch",
                              /*num_threads*/ device_num_threads,
@@ -108,15 +113,22 @@ const std::vector<WorkQueueOptions> ConstructWorkQueueOptions(
                              /*track_task*/ false,
                              /*detached*/ true,
                              /*events_waiter*/ waiter);
+  group_options.back().thread_bind_cores = device_thread_cores;
   return group_options;
 }
 
 AsyncWorkQueue::AsyncWorkQueue(size_t host_num_threads,
                                size_t device_num_threads,
-                               EventsWaiter* waiter)
+                               EventsWaiter* waiter,
+                               const std::vector<size_t>& host_thread_cores,
+                               const std::vector<size_t>& device_thread_cores)
     : host_num_thread_(host_num_threads),
-      queue_group_(CreateWorkQueueGroup(ConstructWorkQueueOptions(
-          host_num_threads, device_num_threads, waiter))) {}
+      queue_group_(CreateWorkQueueGroup(
+          ConstructWorkQueueOptions(host_num_threads,
+                                    device_num_threads,
+                                    waiter,
+                                    host_thread_cores,
+                                    device_thread_cores))) {}
 
 void AsyncWorkQueue::AddTask(const OpFuncType& op_func_type,
                              std::function<void()> fn) {
@@ -394,7 +406,9 @@ std::tuple<VariableValueMap, VariableIdMap> BuildVariableMap(
     vars.reserve(item.second.size());
 
     for (auto& var_name : item.second) {
-      auto* var = local_scope->FindVar(var_name);
+      // names repeat heavily across ops; resolve each one to a dense id
+      // once and hit the cached pointer table afterwards
+      auto* var = local_scope->FindVarById(local_scope->ResolveVarId(var_name));
 
       if (!var_scope->HasVar(var_name)) {
         if (find_var_recursively && var) {
@@ -47,9 +47,13 @@ class InstructionBase;
 namespace interpreter {
 class AsyncWorkQueue {
  public:
+  // The core vectors hold the cores to pin the corresponding workers to,
+  // assigned round robin; empty means no pinning.
   AsyncWorkQueue(size_t host_num_threads,
                  size_t device_num_threads,
-                 EventsWaiter* waiter);
+                 EventsWaiter* waiter,
+                 const std::vector<size_t>& host_thread_cores = {},
+                 const std::vector<size_t>& device_thread_cores = {});
 
   // void WaitEmpty() { queue_group_->WaitQueueGroupEmpty(); }
 
@@ -0,0 +1,174 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/framework/new_executor/interpreter/op_latency_sampler.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_int32(
+    instruction_latency_sample_rate,
+    0,
+    "When n > 0, every nth instruction execution per interpreter thread is "
+    "timed and recorded into the per-op-type latency histograms of "
+    "OpLatencySampler. 0 (the default) disables sampling.");
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+size_t LatencyHistogram::BucketIndex(uint64_t nanos) {
+  if (nanos < kSubBuckets) {
+    return static_cast<size_t>(nanos);
+  }
+  size_t exponent = 0;
+  for (uint64_t v = nanos; v >>= 1;) {
+    ++exponent;
+  }
+  const size_t sub =
+      static_cast<size_t>(nanos >> (exponent - kSubBucketBits)) - kSubBuckets;
+  return (exponent - kSubBucketBits + 1) * kSubBuckets + sub;
+}
+
+uint64_t LatencyHistogram::BucketMidpoint(size_t index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  const size_t shift = index / kSubBuckets - 1;
+  const uint64_t lower = (kSubBuckets + index % kSubBuckets) << shift;
+  return lower + (uint64_t{1} << shift) / 2;
+}
+
+uint64_t LatencyHistogram::Count() const {
+  uint64_t total = 0;
+  for (const auto& bucket : buckets_) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+uint64_t LatencyHistogram::Percentile(double q) const {
+  const uint64_t total = Count();
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total));
+  rank = std::min(rank + 1, total);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    cumulative += buckets_[i].load(std::memory_order_relaxed);
+    if (cumulative >= rank) {
+      return BucketMidpoint(i);
+    }
+  }
+  return BucketMidpoint(kNumBuckets - 1);
+}
+
+void LatencyHistogram::Reset() {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+struct OpLatencySampler::HistMap {
+  std::unordered_map<std::string, std::shared_ptr<LatencyHistogram>> hists;
+};
+
+OpLatencySampler& OpLatencySampler::Instance() {
+  static OpLatencySampler* sampler = new OpLatencySampler;
+  return *sampler;
+}
+
+bool OpLatencySampler::ShouldSample() {
+  const int32_t rate = FLAGS_instruction_latency_sample_rate;
+  if (rate <= 0) {
+    return false;
+  }
+  thread_local uint64_t counter = 0;
+  return ++counter % static_cast<uint64_t>(rate) == 0;
+}
+
+void OpLatencySampler::Record(const std::string& op_type, uint64_t nanos) {
+  auto snapshot = std::atomic_load_explicit(&map_, std::memory_order_acquire);
+  if (snapshot != nullptr) {
+    auto it = snapshot->hists.find(op_type);
+    if (it != snapshot->hists.end()) {
+      it->second->Record(nanos);
+      return;
+    }
+  }
+  // First sighting of this op type: publish an extended copy of the
+  // registry. The histograms themselves are shared, so in-flight readers
+  // of the old snapshot keep recording into the same counters.
+  std::lock_guard<std::mutex> guard(register_mutex_);
+  snapshot = std::atomic_load_explicit(&map_, std::memory_order_acquire);
+  auto next = std::make_shared<HistMap>();
+  if (snapshot != nullptr) {
+    next->hists = snapshot->hists;
+  }
+  auto& hist = next->hists[op_type];
+  if (hist == nullptr) {
+    hist = std::make_shared<LatencyHistogram>();
+  }
+  hist->Record(nanos);
+  std::atomic_store_explicit(&map_,
+                             std::shared_ptr<const HistMap>(std::move(next)),
+                             std::memory_order_release);
+}
+
+std::string OpLatencySampler::Summary() const {
+  auto snapshot = std::atomic_load_explicit(&map_, std::memory_order_acquire);
+  std::map<std::string, std::shared_ptr<LatencyHistogram>> sorted;
+  if (snapshot != nullptr) {
+    sorted.insert(snapshot->hists.begin(), snapshot->hists.end());
+  }
+  std::ostringstream os;
+  os << "{";
+  bool need_comma = false;
+  for (const auto& pair : sorted) {
+    const uint64_t count = pair.second->Count();
+    if (count == 0) {
+      continue;
+    }
+    if (need_comma) {
+      os << ",";
+    }
+    need_comma = true;
+    os << "\"" << pair.first << "\":{\"count\":" << count
+       << ",\"p50_ns\":" << pair.second->Percentile(0.50)
+       << ",\"p99_ns\":" << pair.second->Percentile(0.99)
+       << ",\"p999_ns\":" << pair.second->Percentile(0.999) << "}";
+  }
+  os << "}";
+  return os.str();
+}
+
+void OpLatencySampler::Reset() {
+  auto snapshot = std::atomic_load_explicit(&map_, std::memory_order_acquire);
+  if (snapshot == nullptr) {
+    return;
+  }
+  for (const auto& pair : snapshot->hists) {
+    pair.second->Reset();
+  }
+}
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
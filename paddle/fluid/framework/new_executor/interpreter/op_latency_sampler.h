@@ -0,0 +1,126 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <string>
+
+#include "paddle/common/macros.h"
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+// HDR-style latency histogram: power-of-two major buckets subdivided into
+// 32 linear sub-buckets, covering 1ns to ~2^63ns with at most ~3%
+// relative error. Recording is one relaxed fetch_add, so concurrent
+// dispatch threads never contend; percentiles are computed on demand by
+// walking the bucket counts.
+class LatencyHistogram {
+ public:
+  static constexpr size_t kSubBucketBits = 5;
+  static constexpr size_t kSubBuckets = 1 << kSubBucketBits;
+  static constexpr size_t kNumBuckets =
+      (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  void Record(uint64_t nanos) {
+    buckets_[BucketIndex(nanos)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t Count() const;
+
+  // Approximate quantile in nanoseconds (bucket midpoint), q in [0, 1].
+  // Returns 0 for an empty histogram.
+  uint64_t Percentile(double q) const;
+
+  void Reset();
+
+ private:
+  static size_t BucketIndex(uint64_t nanos);
+  static uint64_t BucketMidpoint(size_t index);
+
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+};
+
+// Always-on sampling profiler for the interpreter: every Nth instruction
+// execution (N = FLAGS_instruction_latency_sample_rate, per thread, 0
+// disables) is timed on the host and recorded into the histogram of its
+// op type. Unsampled executions cost one flag read and one thread-local
+// increment, so the sampler can stay enabled in live serving where full
+// trace collection is too heavy. Durations are host-side wall time of
+// the instruction body; for asynchronous device kernels that is launch
+// plus any host synchronization the op performs, not device time.
+class OpLatencySampler {
+ public:
+  static OpLatencySampler& Instance();
+
+  // Decides on the calling thread whether this execution is sampled.
+  static bool ShouldSample();
+
+  void Record(const std::string& op_type, uint64_t nanos);
+
+  // JSON object mapping op type to {"count", "p50_ns", "p99_ns",
+  // "p999_ns"}, for scraping by serving-side monitors.
+  std::string Summary() const;
+
+  void Reset();
+
+ private:
+  OpLatencySampler() = default;
+  DISABLE_COPY_AND_ASSIGN(OpLatencySampler);
+
+  struct HistMap;  // name -> histogram, published copy-on-write
+
+  // Snapshot of the registry; readers atomic-load it and never lock. A
+  // miss (first sighting of an op type) takes register_mutex_ and
+  // publishes an extended copy.
+  std::shared_ptr<const HistMap> map_;
+  std::mutex register_mutex_;
+};
+
+// RAII sampling point. The op type reference must outlive the scope (the
+// interpreter passes the instruction's own name).
+class LatencySampleScope {
+ public:
+  explicit LatencySampleScope(const std::string& op_type)
+      : op_type_(OpLatencySampler::ShouldSample() ? &op_type : nullptr),
+        start_(op_type_ != nullptr ? std::chrono::steady_clock::now()
+                                   : std::chrono::steady_clock::time_point()) {
+  }
+
+  ~LatencySampleScope() {
+    if (UNLIKELY(op_type_ != nullptr)) {
+      const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start_);
+      OpLatencySampler::Instance().Record(
+          *op_type_, static_cast<uint64_t>(nanos.count()));
+    }
+  }
+
+  DISABLE_COPY_AND_ASSIGN(LatencySampleScope);
+
+ private:
+  const std::string* op_type_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/framework/new_executor/interpreter/step_anomaly_detector.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "glog/logging.h"
+#include "paddle/fluid/framework/new_executor/interpreter/execution_tracer.h"
+#include "paddle/fluid/framework/new_executor/interpreter/op_latency_sampler.h"
+#include "paddle/fluid/memory/stats.h"
+#include "paddle/fluid/platform/flags.h"
+
+PADDLE_DEFINE_EXPORTED_double(
+    executor_step_watchdog_multiple,
+    0.0,
+    "When > 0, the executor watches its step wall time; a step exceeding "
+    "this multiple of the rolling median flushes the instruction-timing "
+    "and allocation ring buffers to FLAGS_executor_step_watchdog_dir.");
+
+PADDLE_DEFINE_EXPORTED_string(
+    executor_step_watchdog_dir,
+    ".",
+    "Directory the step watchdog writes its trace captures to.");
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+StepAnomalyDetector& StepAnomalyDetector::Instance() {
+  static StepAnomalyDetector instance;
+  return instance;
+}
+
+bool StepAnomalyDetector::IsEnabled() {
+  return FLAGS_executor_step_watchdog_multiple > 0.0;
+}
+
+void StepAnomalyDetector::ObserveStep(int64_t step_ns) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  // The rings must already be recording when an outlier ends, so they are
+  // turned on with the first observed step.
+  if (!tracers_enabled_) {
+    if (!ExecutionTracer::Instance().IsEnabled()) {
+      ExecutionTracer::Instance().Enable();
+    }
+    if (!memory::AllocationEventTracer::GetInstance().IsEnabled()) {
+      memory::AllocationEventTracer::GetInstance().Enable(1 << 16);
+    }
+    tracers_enabled_ = true;
+  }
+
+  ++step_count_;
+  window_.push_back(step_ns);
+  if (window_.size() > kWindowSize) {
+    window_.pop_front();
+  }
+  if (window_.size() < kMinSamples) {
+    return;
+  }
+
+  int64_t median_ns = MedianStepNs();
+  if (static_cast<double>(step_ns) <=
+      FLAGS_executor_step_watchdog_multiple * static_cast<double>(median_ns)) {
+    return;
+  }
+  if (step_count_ < last_capture_step_ + kCaptureCooldownSteps) {
+    VLOG(4) << "step watchdog: outlier step " << step_count_
+            << " within capture cooldown, skipped";
+    return;
+  }
+  last_capture_step_ = step_count_;
+  Capture(step_count_, step_ns, median_ns);
+}
+
+int64_t StepAnomalyDetector::MedianStepNs() const {
+  std::vector<int64_t> samples(window_.begin(), window_.end());
+  auto mid = samples.begin() + samples.size() / 2;
+  std::nth_element(samples.begin(), mid, samples.end());
+  return *mid;
+}
+
+void StepAnomalyDetector::Capture(uint64_t step_index,
+                                  int64_t step_ns,
+                                  int64_t median_ns) {
+  std::string prefix = FLAGS_executor_step_watchdog_dir + "/step_watchdog_" +
+                       std::to_string(step_index);
+
+  ExecutionTracer::Instance().DumpChromeTrace(prefix + "_trace.json");
+
+  {
+    std::ofstream ofs(prefix + "_alloc.txt", std::ios::trunc);
+    if (ofs) {
+      ofs << "# timestamp_ns thread_id size device_id is_host op_context\n";
+      for (const auto& event :
+           memory::AllocationEventTracer::GetInstance().Dump()) {
+        ofs << event.timestamp_ns << " " << event.thread_id << " "
+            << event.size << " " << event.device_id << " " << event.is_host
+            << " " << event.op_context << "\n";
+      }
+    } else {
+      LOG(WARNING) << "step watchdog cannot open " << prefix << "_alloc.txt";
+    }
+  }
+
+  {
+    std::ofstream ofs(prefix + "_op_latency.json", std::ios::trunc);
+    if (ofs) {
+      ofs << OpLatencySampler::Instance().Summary();
+    }
+  }
+
+  LOG(WARNING) << "step watchdog: step " << step_index << " took "
+               << step_ns / 1e6 << " ms (rolling median " << median_ns / 1e6
+               << " ms, threshold x" << FLAGS_executor_step_watchdog_multiple
+               << "); captured ring buffers to " << prefix << "_*";
+}
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
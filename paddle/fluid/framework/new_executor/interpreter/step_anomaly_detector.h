@@ -0,0 +1,99 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>  // NOLINT
+#include <string>
+
+#include "paddle/common/macros.h"
+
+namespace paddle {
+namespace framework {
+namespace interpreter {
+
+// Watchdog for step-time outliers. Keeps rolling statistics over the
+// recent step wall times and, when a step exceeds
+// FLAGS_executor_step_watchdog_multiple times the rolling median, flushes
+// the always-on ring buffers — the ExecutionTracer instruction timings
+// and the AllocationEventTracer events — plus the op latency summary to
+// FLAGS_executor_step_watchdog_dir. Because the rings are already
+// populated, the capture is retroactive: it contains the outlier step
+// itself, not the next one.
+//
+// Enabled by setting FLAGS_executor_step_watchdog_multiple > 0; the
+// first observed step turns the ring tracers on if they are not already.
+// Captures are rate limited by a cooldown so one pathological phase does
+// not flood the disk.
+class StepAnomalyDetector {
+ public:
+  static StepAnomalyDetector& Instance();
+
+  static bool IsEnabled();
+
+  // Called once per executor step with its wall time.
+  void ObserveStep(int64_t step_ns);
+
+ private:
+  StepAnomalyDetector() = default;
+  DISABLE_COPY_AND_ASSIGN(StepAnomalyDetector);
+
+  // Rolling median over the window; called under mutex_.
+  int64_t MedianStepNs() const;
+
+  void Capture(uint64_t step_index, int64_t step_ns, int64_t median_ns);
+
+  static constexpr size_t kWindowSize = 512;
+  static constexpr size_t kMinSamples = 64;
+  static constexpr uint64_t kCaptureCooldownSteps = 64;
+
+  std::mutex mutex_;
+  std::deque<int64_t> window_;
+  uint64_t step_count_{0};
+  uint64_t last_capture_step_{0};
+  bool tracers_enabled_{false};
+};
+
+// RAII step timer feeding the watchdog; a flag check per step when the
+// watchdog is off.
+class StepWatchdogScope {
+ public:
+  StepWatchdogScope()
+      : enabled_(StepAnomalyDetector::IsEnabled()),
+        start_(enabled_ ? std::chrono::steady_clock::now()
+                        : std::chrono::steady_clock::time_point()) {}
+
+  ~StepWatchdogScope() {
+    if (enabled_) {
+      int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start_)
+                       .count();
+      StepAnomalyDetector::Instance().ObserveStep(ns);
+    }
+  }
+
+  StepWatchdogScope(const StepWatchdogScope&) = delete;
+  StepWatchdogScope& operator=(const StepWatchdogScope&) = delete;
+
+ private:
+  const bool enabled_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace interpreter
+}  // namespace framework
+}  // namespace paddle
@@ -20,6 +20,7 @@
 #include "paddle/fluid/framework/new_executor/instruction/instruction_base.h"
 #include "paddle/fluid/framework/new_executor/interpreter/interpreter_util.h"
 #include "paddle/fluid/platform/device_context.h"
+#include "paddle/fluid/platform/flags.h"
 #if defined(PADDLE_WITH_NCCL) || defined(PADDLE_WITH_RCCL)
 #include "paddle/common/flags.h"
 #include "paddle/fluid/platform/collective_helper.h"
@@ -28,6 +29,14 @@
 COMMON_DECLARE_bool(dynamic_static_unified_comm);
 #endif
 
+PADDLE_DEFINE_EXPORTED_int64(
+    new_executor_auto_parallel_streams,
+    1,
+    "Number of compute streams the StreamAnalyzer may spread independent "
+    "branches of the op graph over. Values <= 1 keep all compute work on "
+    "the default stream. Cross-stream dependencies are synchronized with "
+    "the usual shrunk DeviceEvent set.");
+
 namespace paddle::framework::interpreter {
 
 using DeviceContext = platform::DeviceContext;
@@ -182,6 +191,98 @@ void StreamAnalyzer::ConstructEvents(std::vector<Instruction>* instructions) {
   }
 }
 
+void StreamAnalyzer::AssignStreamsForIndependentBranches(
+    std::vector<OpFuncNode>* op_func_nodes) const {
+  const int64_t num_streams = FLAGS_new_executor_auto_parallel_streams;
+  if (num_streams <= 1 || !platform::is_gpu_place(place_)) {
+    return;
+  }
+
+  auto eligible = [](const OpFuncNode& node) {
+    if (node.type_ != OpFuncType::kGpuAsync) {
+      return false;
+    }
+    // Respect streams pinned by the user or by auto parallel dist attrs.
+    if (node.execution_stream_ != kDefaultStream) {
+      return false;
+    }
+    // Memcpy ops already run on the dedicated H2D/D2H streams.
+    if (node.operator_base_ != nullptr &&
+        (node.operator_base_->Type() == kMemcpyD2H ||
+         node.operator_base_->Type() == kMemcpyH2D)) {
+      return false;
+    }
+    return true;
+  };
+
+  // RAW edges are enough for a placement heuristic: the real dependency and
+  // event analysis still runs on the final instruction list, so an edge
+  // missed here costs one extra synchronization, never correctness.
+  const size_t op_num = op_func_nodes->size();
+  std::unordered_map<int, size_t> var_last_writer;
+  std::vector<std::vector<size_t>> parents(op_num);
+  for (size_t op_idx = 0; op_idx < op_num; ++op_idx) {
+    auto& node = (*op_func_nodes)[op_idx];
+    for (auto& item : node.input_index) {
+      for (int var_id : item.second) {
+        auto iter = var_last_writer.find(var_id);
+        if (iter != var_last_writer.end() && iter->second != op_idx) {
+          parents[op_idx].push_back(iter->second);
+        }
+      }
+    }
+    for (auto& item : node.output_index) {
+      for (int var_id : item.second) {
+        var_last_writer[var_id] = op_idx;
+      }
+    }
+  }
+
+  // Greedy chain decomposition: an op continues the stream of the first
+  // parent whose chain is still open; the extra children of a fork (and
+  // source ops) open fresh streams round-robin. Stream 0 stands for the
+  // default compute stream and keeps its kDefaultStream name.
+  std::vector<int64_t> stream_of(op_num, 0);
+  std::vector<bool> chain_continued(op_num, false);
+  int64_t next_stream = 0;
+  size_t num_moved = 0;
+  for (size_t op_idx = 0; op_idx < op_num; ++op_idx) {
+    auto& node = (*op_func_nodes)[op_idx];
+    if (!eligible(node)) {
+      // Sync and pinned ops keep their placement but still propagate a
+      // stream so chains running through them are not split needlessly.
+      stream_of[op_idx] = parents[op_idx].empty()
+                              ? 0
+                              : stream_of[parents[op_idx].front()];
+      continue;
+    }
+    int64_t assigned = -1;
+    for (size_t parent : parents[op_idx]) {
+      if (!chain_continued[parent]) {
+        assigned = stream_of[parent];
+        chain_continued[parent] = true;
+        break;
+      }
+    }
+    if (assigned < 0) {
+      assigned = next_stream++ % num_streams;
+    }
+    stream_of[op_idx] = assigned;
+    if (assigned != 0) {
+      node.execution_stream_ =
+          "AutoParallelStream" + std::to_string(assigned);
+      ++num_moved;
+      VLOG(6) << "Assign op " << op_idx << " ("
+              << (node.operator_base_ ? node.operator_base_->Type()
+                                      : node.phi_op_name_)
+              << ") to " << node.execution_stream_;
+    }
+  }
+  VLOG(4) << "AssignStreamsForIndependentBranches moved " << num_moved
+          << " of " << op_num << " ops off the default stream, using up to "
+          << num_streams << " compute streams.";
+}
+
 DeviceContext* StreamAnalyzer::ParseDeviceContext(
     const OpFuncNode& op_func_node) const {
   auto& op = op_func_node.operator_base_;
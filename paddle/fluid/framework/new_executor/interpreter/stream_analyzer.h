@@ -79,6 +79,16 @@ class StreamAnalyzer {
 
   void ConstructEvents(std::vector<Instruction>* instructions);
 
+  // Partitions independent branches of the op graph onto multiple compute
+  // streams by rewriting execution_stream_ of eligible async GPU ops, so
+  // parallel towers overlap instead of serializing on the default stream.
+  // Controlled by FLAGS_new_executor_auto_parallel_streams; must be called
+  // before ParseDeviceContext so the custom stream contexts get created.
+  // Cross-stream synchronizations are inserted (and shrunk to the minimal
+  // set) by the regular ConstructEvents analysis afterwards.
+  void AssignStreamsForIndependentBranches(
+      std::vector<OpFuncNode>* op_func_nodes) const;
+
   platform::DeviceContext* ParseDeviceContext(
       const OpFuncNode& op_func_node) const;
 
@@ -0,0 +1,160 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/framework/new_executor/live_stats_exporter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "glog/logging.h"
+#include "paddle/common/hot_counter.h"
+#include "paddle/fluid/memory/stats.h"
+#include "paddle/fluid/platform/enforce.h"
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
+
+namespace paddle {
+namespace framework {
+
+LiveStatsExporter& LiveStatsExporter::Instance() {
+  static LiveStatsExporter instance;
+  return instance;
+}
+
+LiveStatsExporter::~LiveStatsExporter() { Stop(); }
+
+void LiveStatsExporter::Start(const std::string& path, int interval_ms) {
+  PADDLE_ENFORCE_EQ(running_.load(),
+                    false,
+                    platform::errors::PreconditionNotMet(
+                        "The live stats exporter is already running."));
+  PADDLE_ENFORCE_EQ(path.empty(),
+                    false,
+                    platform::errors::InvalidArgument(
+                        "The live stats export path must not be empty."));
+  PADDLE_ENFORCE_GT(interval_ms,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "The live stats export interval must be positive, "
+                        "but got %d ms.",
+                        interval_ms));
+  running_.store(true);
+  thread_ = std::thread(&LiveStatsExporter::ExportLoop, this, path, interval_ms);
+  VLOG(3) << "live stats exporter started, path=" << path
+          << ", interval=" << interval_ms << "ms";
+}
+
+void LiveStatsExporter::Stop() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  VLOG(3) << "live stats exporter stopped";
+}
+
+void LiveStatsExporter::SetGauge(const std::string& name, int64_t value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  gauges_[name] = value;
+}
+
+int64_t LiveStatsExporter::RegisterGaugeProvider(
+    const std::string& name, std::function<int64_t()> provider) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  int64_t id = next_provider_id_++;
+  providers_[id] = Provider{name, std::move(provider)};
+  return id;
+}
+
+void LiveStatsExporter::UnregisterGaugeProvider(int64_t id) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  providers_.erase(id);
+}
+
+void LiveStatsExporter::RecordStep(int64_t step_ns) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  gauges_["interpreter.last_step_ns"] = step_ns;
+  ++gauges_["interpreter.steps"];
+}
+
+void LiveStatsExporter::ExportLoop(std::string path, int interval_ms) {
+  constexpr int kPollMs = 10;
+  while (running_.load(std::memory_order_relaxed)) {
+    WriteSnapshot(path);
+    // Sleep in short slices so Stop() does not block for a full interval.
+    for (int slept = 0;
+         slept < interval_ms && running_.load(std::memory_order_relaxed);
+         slept += kPollMs) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kPollMs));
+    }
+  }
+  // One final snapshot so the file reflects the end of the run.
+  WriteSnapshot(path);
+}
+
+void LiveStatsExporter::WriteSnapshot(const std::string& path) {
+  std::map<std::string, int64_t> snapshot;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    snapshot = gauges_;
+    // Providers sharing a name (e.g. several host workqueues) are summed.
+    for (const auto& item : providers_) {
+      snapshot[item.second.name] += item.second.fn();
+    }
+  }
+
+  snapshot["memory.host.allocated"] =
+      memory::HostMemoryStatCurrentValue("Allocated", 0);
+  snapshot["memory.host.reserved"] =
+      memory::HostMemoryStatCurrentValue("Reserved", 0);
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  int device_count = phi::backends::gpu::GetGPUDeviceCount();
+  for (int i = 0; i < device_count; ++i) {
+    std::string prefix = "memory.device" + std::to_string(i);
+    snapshot[prefix + ".allocated"] =
+        memory::DeviceMemoryStatCurrentValue("Allocated", i);
+    snapshot[prefix + ".reserved"] =
+        memory::DeviceMemoryStatCurrentValue("Reserved", i);
+  }
+#endif
+
+  std::ostringstream os;
+  for (const auto& item : snapshot) {
+    os << item.first << " " << item.second << "\n";
+  }
+  // Hot counters are already "name value" lines.
+  os << common::CounterRegistry::Instance().ReportText();
+
+  // Write-then-rename, so a scraping sidecar never sees a torn snapshot.
+  std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream ofs(tmp_path, std::ios::trunc);
+    if (!ofs) {
+      LOG(WARNING) << "live stats exporter cannot open " << tmp_path;
+      return;
+    }
+    ofs << os.str();
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    LOG(WARNING) << "live stats exporter cannot rename " << tmp_path << " to "
+                 << path;
+  }
+}
+
+}  // namespace framework
+}  // namespace paddle
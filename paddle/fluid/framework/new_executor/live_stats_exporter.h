@@ -0,0 +1,121 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>  // NOLINT
+#include <string>
+#include <thread>  // NOLINT
+
+namespace paddle {
+namespace framework {
+
+// Live export of framework internals while a job runs, complementing the
+// post-mortem report of executor_statistics.cc. A background thread
+// periodically snapshots the registered gauges plus the memory stats of
+// paddle/fluid/memory/stats.cc and the common::CounterRegistry hot
+// counters, and publishes them as "name value" lines to a file a sidecar
+// can scrape. Each snapshot is written to "<path>.tmp" and renamed over
+// the target, so readers always see a complete, consistent snapshot.
+//
+// Gauges come from two sources:
+//  * SetGauge(name, value): push-style, for values produced on the hot
+//    path (e.g. the interpreter's per-step wall time).
+//  * RegisterGaugeProvider(name, fn): pull-style, sampled by the export
+//    thread each interval (e.g. workqueue pending-task depths). The
+//    provider must stay valid until UnregisterGaugeProvider returns.
+//
+// Started and stopped from Python (core.start_live_stats_exporter /
+// core.stop_live_stats_exporter); a no-op while not running.
+class LiveStatsExporter {
+ public:
+  static LiveStatsExporter& Instance();
+
+  // Begins exporting to `path` every `interval_ms` milliseconds.
+  void Start(const std::string& path, int interval_ms);
+
+  // Joins the export thread; the last written snapshot remains on disk.
+  void Stop();
+
+  bool IsRunning() const {
+    return running_.load(std::memory_order_relaxed);
+  }
+
+  void SetGauge(const std::string& name, int64_t value);
+
+  // Returns an id for UnregisterGaugeProvider. The function is invoked
+  // on the export thread and must be cheap and thread-safe.
+  int64_t RegisterGaugeProvider(const std::string& name,
+                                std::function<int64_t()> provider);
+
+  void UnregisterGaugeProvider(int64_t id);
+
+  // Called by the interpreters at the end of each step.
+  void RecordStep(int64_t step_ns);
+
+ private:
+  LiveStatsExporter() = default;
+  ~LiveStatsExporter();
+  LiveStatsExporter(const LiveStatsExporter&) = delete;
+  LiveStatsExporter& operator=(const LiveStatsExporter&) = delete;
+
+  void ExportLoop(std::string path, int interval_ms);
+  void WriteSnapshot(const std::string& path);
+
+  struct Provider {
+    std::string name;
+    std::function<int64_t()> fn;
+  };
+
+  std::atomic<bool> running_{false};
+  std::thread thread_;
+  mutable std::mutex mutex_;
+  std::map<std::string, int64_t> gauges_;
+  std::map<int64_t, Provider> providers_;
+  int64_t next_provider_id_{0};
+};
+
+// Feeds the interpreter's per-step wall time into the exporter. Costs
+// one relaxed atomic load per step while the exporter is idle.
+class LiveStatsStepTimer {
+ public:
+  LiveStatsStepTimer()
+      : enabled_(LiveStatsExporter::Instance().IsRunning()),
+        start_(enabled_ ? std::chrono::steady_clock::now()
+                        : std::chrono::steady_clock::time_point()) {}
+
+  ~LiveStatsStepTimer() {
+    if (enabled_) {
+      int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start_)
+                       .count();
+      LiveStatsExporter::Instance().RecordStep(ns);
+    }
+  }
+
+  LiveStatsStepTimer(const LiveStatsStepTimer&) = delete;
+  LiveStatsStepTimer& operator=(const LiveStatsStepTimer&) = delete;
+
+ private:
+  const bool enabled_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace framework
+}  // namespace paddle
@@ -245,6 +245,8 @@ void Instruction::ResetContext(const VariableValueMap& in_vars,
                                const VariableValueMap& out_vars,
                                const std::string& op_name) {
   runtime_ctx_.reset(new RuntimeContext(in_vars, out_vars));
+  // The cached phi kernel context points into the old runtime context.
+  phi_kernel_context_built_ = false;
   infershape_ctx_.reset(
       new RuntimeInferShapeContext(*OpBase(), *runtime_ctx_.get()));
   // NOTE: Because execution_ctx_ is constructed by `scope&`, so we fake an
@@ -269,6 +271,8 @@ void Instruction::ResetContextWithScope(const VariableValueMap& in_vars,
                                         const framework::Scope& scope,
                                         const std::string& op_name) {
   runtime_ctx_.reset(new RuntimeContext(in_vars, out_vars));
+  // The cached phi kernel context points into the old runtime context.
+  phi_kernel_context_built_ = false;
   infershape_ctx_.reset(
       new RuntimeInferShapeContext(*OpBase(), *runtime_ctx_.get()));
   execution_ctx_.reset(
@@ -305,10 +305,26 @@ class Instruction {
     return op_func_node_.scheduling_priority_;
   }
 
+  void SetSchedulingPriority(SchedulingPriority priority) {
+    op_func_node_.scheduling_priority_ = priority;
+  }
+
   bool PreDefineContext() const { return pre_define_context_; }
 
   const OpFuncNode* OpFunc() const { return &op_func_node_; }
 
+  // Cached kernel context for the phi function-kernel path. A static
+  // program's argument list never changes between steps, so the context
+  // built on the first step is replayed afterwards instead of being
+  // reconstructed per instruction execution.
+  phi::KernelContext* MutablePhiKernelContext() const {
+    return &phi_kernel_context_;
+  }
+
+  bool IsPhiKernelContextBuilt() const { return phi_kernel_context_built_; }
+
+  void MarkPhiKernelContextBuilt() const { phi_kernel_context_built_ = true; }
+
   // record stream for gc
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   bool need_record_stream_for_gc_ = false;
@@ -343,6 +359,12 @@ class Instruction {
   std::vector<std::pair<Variable*, Variable*>> vec_inplace_in_to_out_;
 
   bool pre_define_context_{false};
+
+  // Mutable because instructions are executed through const references; the
+  // cached context is an execution detail, not part of the instruction's
+  // logical state.
+  mutable phi::KernelContext phi_kernel_context_;
+  mutable bool phi_kernel_context_built_{false};
 };
 
 namespace interpreter {
@@ -21,11 +21,17 @@
 
 #include "paddle/fluid/framework/details/nan_inf_utils.h"
 #include "paddle/fluid/framework/details/share_tensor_buffer_functor.h"
+#include "paddle/fluid/framework/new_executor/interpreter/execution_tracer.h"
 #include "paddle/fluid/framework/new_executor/interpreter/interpreter_util.h"
+#include "paddle/fluid/framework/new_executor/interpreter/op_latency_sampler.h"
+#include "paddle/fluid/framework/new_executor/interpreter/step_anomaly_detector.h"
+#include "paddle/fluid/framework/new_executor/live_stats_exporter.h"
 #include "paddle/fluid/framework/new_executor/interpreter/static_build.h"
 #include "paddle/fluid/framework/operator.h"
+#include "paddle/fluid/memory/stats.h"
 #include "paddle/fluid/platform/device/gpu/gpu_info.h"
 #include "paddle/fluid/platform/os_info.h"
+#include "paddle/fluid/platform/profiler/cuda_tracer.h"
 #include "paddle/fluid/platform/profiler/event_tracing.h"
 #include "paddle/fluid/platform/profiler/supplement_tracing.h"
 #include "paddle/phi/common/place.h"
@@ -85,6 +91,7 @@ COMMON_DECLARE_bool(dynamic_static_unified_comm);
 
 COMMON_DECLARE_bool(enable_pir_in_executor);
 COMMON_DECLARE_bool(enable_pir_in_executor_trace_run);
+PD_DECLARE_string(new_executor_trace_file);
 COMMON_DECLARE_int32(low_precision_op_list);
 
 #define CREATE_INSTR(instr_name)                                   \
@@ -157,6 +164,10 @@ PirInterpreter::PirInterpreter(const platform::Place& place,
       enable_job_schedule_profiler_(false) {
   VLOG(2) << "PirInterpreter(): " << this << " on " << place_;
 
+  if (!FLAGS_new_executor_trace_file.empty()) {
+    interpreter::ExecutionTracer::Instance().Enable();
+  }
+
   exception_notifier_ = main_thread_blocker_.RegisterEvent(kExceptionCaught);
   completion_notifier_ = main_thread_blocker_.RegisterEvent(kTaskCompletion);
 
@@ -249,6 +260,10 @@ PirInterpreter::PirInterpreter(
       enable_job_schedule_profiler_(false) {
   VLOG(2) << "PirInterpreter(): " << this << " on " << place_;
 
+  if (!FLAGS_new_executor_trace_file.empty()) {
+    interpreter::ExecutionTracer::Instance().Enable();
+  }
+
   exception_notifier_ = main_thread_blocker_.RegisterEvent(kExceptionCaught);
   completion_notifier_ = main_thread_blocker_.RegisterEvent(kTaskCompletion);
 
@@ -294,6 +309,12 @@ PirInterpreter::~PirInterpreter() {
   async_work_queue_.reset();
   VLOG(4) << "~PirInterpreter(): " << this << " on " << place_;
 
+  if (!FLAGS_new_executor_trace_file.empty() &&
+      interpreter::ExecutionTracer::Instance().IsEnabled()) {
+    interpreter::ExecutionTracer::Instance().DumpChromeTrace(
+        FLAGS_new_executor_trace_file);
+  }
+
 #ifdef PADDLE_WITH_DNNL
   // Clear mkl-dnn cache,
   // this is needed to have mkl-dnn unit tests working
@@ -412,7 +433,9 @@ std::shared_ptr<interpreter::AsyncWorkQueue> PirInterpreter::GetWorkQueue() {
     async_work_queue_ = std::make_shared<interpreter::AsyncWorkQueue>(
         execution_config_.host_num_threads,
         execution_config_.device_num_threads,
-        nullptr);
+        nullptr,
+        execution_config_.HostWorkerCores(),
+        execution_config_.DeviceWorkerCores());
   }
   return async_work_queue_;
 }
@@ -1238,6 +1261,8 @@ void PirInterpreter::RecordStreamForGC(InstructionBase* instr) {
 void PirInterpreter::CheckGC(InstructionBase* instr) {
   platform::RecordEvent record(
       "CheckGC", platform::TracerEventType::UserDefined, 10);
+  interpreter::TraceScope gc_trace(interpreter::TracePointKind::kGC,
+                                   static_cast<uint32_t>(instr->Id()));
 
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   RecordStreamForGC(instr);
@@ -1414,6 +1439,8 @@ paddle::framework::FetchList PirInterpreter::Run(
     bool enable_job_schedule_profiler,
     bool switch_stream) {
   enable_job_schedule_profiler_ = enable_job_schedule_profiler;
+  LiveStatsStepTimer live_stats_step_timer;
+  interpreter::StepWatchdogScope step_watchdog_scope;
 
   auto FeedInput = [&] {
     VLOG(4) << "Feed inputs";
@@ -1510,6 +1537,8 @@ FetchList PirInterpreter::Run(const std::vector<std::string>& feed_names,
                               bool enable_op_profiling,
                               bool switch_stream) {
   enable_job_schedule_profiler_ = enable_job_schedule_profiler;
+  LiveStatsStepTimer live_stats_step_timer;
+  interpreter::StepWatchdogScope step_watchdog_scope;
 
   if (enable_op_profiling) {
     PADDLE_THROW(phi::errors::Unimplemented(
@@ -1591,6 +1620,8 @@ FetchList PirInterpreter::Run(const std::vector<std::string>& feed_names,
 }
 
 void PirInterpreter::TraceRunImpl() {
+  execution_config_.ApplyDispatchThreadAffinity();
+
   // lazy initialization of gc, do not create gc is the program only run once
   if (!gc_) {
     gc_ = CreateInterpreterCoreGarbageCollector(place_, vec_instruction_base_);
@@ -1609,6 +1640,8 @@ void PirInterpreter::TraceRunImpl() {
 }
 
 void PirInterpreter::MultiThreadRunImpl() {
+  execution_config_.ApplyDispatchThreadAffinity();
+
   // lazy initialization of gc, do not create gc is the program only run once
   if (!gc_) {
     gc_ = CreateInterpreterCoreGarbageCollector(place_, vec_instruction_base_);
@@ -1662,6 +1695,9 @@ void PirInterpreter::TraceRunInstructionList(
     auto instr_id = trace_execute_order_[idx];
     InstructionBase* instr_node = vec_instruction_base_.at(instr_id).get();
 
+    interpreter::TraceScope dispatch_trace(
+        interpreter::TracePointKind::kDispatch,
+        static_cast<uint32_t>(instr_id));
     VLOG(6) << "Run InstructionBase " << instr_node->Name() << "[" << instr_id
             << "]";
     RunInstructionBase(instr_node);
@@ -1791,6 +1827,9 @@ void PirInterpreter::RunInstructionBaseAsync(size_t instr_id) {
     ready_ops.pop();
     auto* instr_node = vec_instruction_base_.at(instr_id).get();
 
+    interpreter::TraceScope dispatch_trace(
+        interpreter::TracePointKind::kDispatch,
+        static_cast<uint32_t>(instr_id));
     RunInstructionBase(instr_node);
 
     if (UNLIKELY(exception_holder_.IsCaught())) {
@@ -1842,6 +1881,16 @@ void PirInterpreter::RunNextInstructions(InstructionBase* instr,
 void PirInterpreter::RunInstructionBase(InstructionBase* instr_node) {
   platform::RecordEvent instruction_event(
       instr_node->Name(), platform::TracerEventType::Operator, 1);
+  interpreter::TraceScope launch_trace(
+      interpreter::TracePointKind::kKernelLaunch,
+      static_cast<uint32_t>(instr_node->Id()));
+  interpreter::LatencySampleScope latency_sample(instr_node->Name());
+  // tag kernels launched by this instruction with its id, so CUPTI device
+  // records can be attributed back to it in the collected trace
+  platform::CudaExternalCorrelationGuard correlation_guard(instr_node->Id());
+  // tag allocations made while this instruction runs, for the allocation
+  // event trace and the peak-memory attribution report
+  memory::OpContextScope op_context_scope(instr_node->Name());
 
   auto cur_place = instr_node->DeviceContext().GetPlace();
   SetDeviceId(cur_place);
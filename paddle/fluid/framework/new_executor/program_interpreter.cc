@@ -19,7 +19,10 @@
 #include "paddle/fluid/framework/io/save_load_tensor.h"
 #include "paddle/fluid/framework/new_executor/interpreter/interpreter_util.h"
 #include "paddle/fluid/framework/new_executor/interpreter/static_build.h"
+#include "paddle/fluid/framework/new_executor/interpreter/step_anomaly_detector.h"
+#include "paddle/fluid/framework/new_executor/live_stats_exporter.h"
 #include "paddle/fluid/framework/operator.h"
+#include "paddle/fluid/memory/stats.h"
 #include "paddle/fluid/platform/device/gpu/gpu_info.h"
 #include "paddle/fluid/platform/os_info.h"
 #include "paddle/fluid/platform/profiler/event_tracing.h"
@@ -32,6 +35,7 @@
 #include "paddle/fluid/platform/onednn_helper.h"
 #endif
 #include "paddle/fluid/platform/cuda_graph_with_memory_pool.h"
+#include "paddle/fluid/platform/flags.h"
 #include "paddle/phi/backends/device_manager.h"
 #if defined(PADDLE_WITH_NCCL) || defined(PADDLE_WITH_RCCL)
 #include "paddle/common/flags.h"
@@ -45,6 +49,33 @@ PHI_DECLARE_bool(enable_host_event_recorder_hook);
 PD_DECLARE_bool(log_memory_stats);
 COMMON_DECLARE_string(static_runtime_data_save_path);
 COMMON_DECLARE_bool(save_static_runtime_data);
+PD_DECLARE_bool(new_executor_critical_path_priority);
+
+PADDLE_DEFINE_EXPORTED_bool(
+    new_executor_fuse_trivial_chains,
+    false,
+    "Fuse linear chains of trivially cheap ops (scale, cast, reshape and "
+    "alike) into one scheduling unit: chain members always continue in the "
+    "same dispatch task instead of going through a full instruction cycle "
+    "each.");
+
+PADDLE_DEFINE_EXPORTED_bool(
+    new_executor_host_op_offload,
+    false,
+    "Run host-only (CPU-sync) instructions on a side work queue while the "
+    "trace loop keeps dispatching GPU work. Instructions that depend on an "
+    "offloaded op wait for its completion, so the dependency graph still "
+    "guarantees correctness.");
+
+PADDLE_DEFINE_EXPORTED_int64(
+    new_executor_cuda_graph_auto_capture_steps,
+    -1,
+    "When >= 0 and FLAGS_new_executor_use_cuda_graph is enabled, "
+    "ProgramInterpreter runs this many warm-up steps, then captures one "
+    "whole step into a CUDA Graph and replays it on subsequent steps. The "
+    "graph is dropped and re-captured when any feed tensor changes shape. "
+    "-1 (default) keeps the manual begin/end capture behavior.");
+
 namespace paddle {
 namespace framework {
 
@@ -140,6 +171,8 @@ ProgramInterpreter::~ProgramInterpreter() {
 }
 
 void ProgramInterpreter::RunImpl() {
+  execution_config_.ApplyDispatchThreadAffinity();
+
   // lazy initialization of gc, do not create gc is the program only run once
   if (!gc_) {
     gc_ = CreateInterpreterCoreGarbageCollector(place_, vec_instruction_);
@@ -147,9 +180,16 @@ void ProgramInterpreter::RunImpl() {
 
   interpreter::ResetAtomicGuard guard(&deps_, &refs_);
 
-  if (is_in_op_profiling_mode_ || execution_config_.used_for_inference ||
+  bool force_trace =
+      is_in_op_profiling_mode_ || execution_config_.used_for_inference ||
       ((execution_config_.used_for_jit || execution_config_.used_for_cinn) &&
-       (sync_op_num_ == 0))) {
+       (sync_op_num_ == 0));
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  // Thread-local stream capture only records work launched from this thread,
+  // so the multi-threaded work queue would silently lose kernels.
+  force_trace = force_trace || platform::IsCUDAGraphCapturing();
+#endif
+  if (force_trace) {
     VLOG(4) << "Tracing Instruction List";
     TraceInstructionList(vec_instruction_);
   } else {
@@ -175,6 +215,8 @@ FetchList ProgramInterpreter::Run(const std::vector<std::string>& feed_names,
                                   bool switch_stream) {
   enable_job_schedule_profiler_ = enable_job_schedule_profiler;
   is_in_op_profiling_mode_ = enable_op_profiling;
+  LiveStatsStepTimer live_stats_step_timer;
+  interpreter::StepWatchdogScope step_watchdog_scope;
 
   std::vector<paddle::framework::OpFuncNode> op_func_nodes;
   Build(feed_names, &op_func_nodes, switch_stream);
@@ -191,7 +233,7 @@ FetchList ProgramInterpreter::Run(const std::vector<std::string>& feed_names,
     is_build_ = true;
     is_shared_results_build_ = true;
   } else {
-    RunImpl();
+    RunWithAutoCUDAGraph(feed_names);
   }
 
   if (HasLocalScope()) {
@@ -265,6 +307,8 @@ FetchList ProgramInterpreter::Run(
     bool enable_job_schedule_profiler,
     bool switch_stream) {
   enable_job_schedule_profiler_ = enable_job_schedule_profiler;
+  LiveStatsStepTimer live_stats_step_timer;
+  interpreter::StepWatchdogScope step_watchdog_scope;
 
   SetDeviceId(place_);
   CheckCUDAGraphBeforeRun(feed_names);
@@ -277,7 +321,7 @@ FetchList ProgramInterpreter::Run(
   Prepare(feed_names, feed_tensors, is_build, switch_stream);
 
   if (is_build && !switch_stream) {
-    RunImpl();
+    RunWithAutoCUDAGraph(feed_names);
   }
 
   if (HasLocalScope()) {
@@ -410,7 +454,9 @@ ProgramInterpreter::GetWorkQueue() {
     async_work_queue_ = std::make_shared<interpreter::AsyncWorkQueue>(
         execution_config_.host_num_threads,
         execution_config_.device_num_threads,
-        nullptr);
+        nullptr,
+        execution_config_.HostWorkerCores(),
+        execution_config_.DeviceWorkerCores());
   }
   return async_work_queue_;
 }
@@ -624,6 +670,155 @@ void ProgramInterpreter::CheckCUDAGraphBeforeRun(
 #endif
 }
 
+void ProgramInterpreter::RunWithAutoCUDAGraph(
+    const std::vector<std::string>& feed_names) {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (FLAGS_new_executor_cuda_graph_auto_capture_steps < 0 ||
+      !FLAGS_new_executor_use_cuda_graph || !platform::is_gpu_place(place_) ||
+      platform::IsCUDAGraphCapturing()) {
+    RunImpl();
+    return;
+  }
+
+  // A fetch copies device memory back to the host synchronously, which is
+  // illegal during stream capture, and replaying a captured step would let
+  // the host read the FetchList race the graph launch; keep programs that
+  // fetch on the regular path.
+  for (auto& instr : vec_instruction_) {
+    if (instr.OpBaseValid() && (instr.OpBase()->Type() == "fetch" ||
+                                instr.OpBase()->Type() == "fetch_v2")) {
+      LOG_FIRST_N(WARNING, 1)
+          << "Cannot fetch data when using CUDA Graph, skip auto capture "
+             "for this program.";
+      RunImpl();
+      return;
+    }
+  }
+
+  // The signature covers the rank and dims of every feed tensor; any change
+  // means the captured launch parameters are stale and the whole graph must
+  // be rebuilt from fresh warm-up steps.
+  std::vector<int64_t> shape_signature;
+  Scope* inner_scope =
+      HasLocalScope() ? local_scope_ : var_scope_.GetMutableScope();
+  for (auto& feed_name : feed_names) {
+    auto* var = inner_scope->FindVar(feed_name);
+    if (var == nullptr || !var->IsType<phi::DenseTensor>()) {
+      continue;
+    }
+    auto& dims = var->Get<phi::DenseTensor>().dims();
+    shape_signature.push_back(dims.size());
+    for (int i = 0; i < dims.size(); ++i) {
+      shape_signature.push_back(dims[i]);
+    }
+  }
+
+  if (whole_step_cuda_graph_ &&
+      shape_signature != whole_step_shape_signature_) {
+    VLOG(4) << "Feed shapes changed, drop the captured whole-step CUDA graph "
+               "and re-run warm-up steps.";
+    whole_step_cuda_graph_.reset();
+    whole_step_warmup_steps_ = 0;
+  }
+
+  if (whole_step_cuda_graph_) {
+    whole_step_cuda_graph_->Replay();
+    return;
+  }
+
+  if (whole_step_warmup_steps_ <
+      FLAGS_new_executor_cuda_graph_auto_capture_steps) {
+    ++whole_step_warmup_steps_;
+    RunImpl();
+    return;
+  }
+
+  // Warm-up is done and the allocator pools are stable: capture this step.
+  // RunImpl falls back to single-thread tracing while a capture is active,
+  // and BeginCUDAGraphCapture switches the allocator to the graph-private
+  // memory pool so replays reuse the same device buffers.
+#ifdef PADDLE_WITH_HIP
+  constexpr auto capture_mode = hipStreamCaptureModeThreadLocal;
+#else
+  constexpr auto capture_mode = cudaStreamCaptureModeThreadLocal;
+#endif
+  platform::BeginCUDAGraphCapture(phi::GPUPlace(place_.GetDeviceId()),
+                                  capture_mode);
+  try {
+    RunImpl();
+  } catch (...) {
+    platform::EndCUDAGraphCapture();
+    throw;
+  }
+  whole_step_cuda_graph_ = platform::EndCUDAGraphCapture();
+  whole_step_shape_signature_ = std::move(shape_signature);
+  VLOG(4) << "Captured whole-step CUDA graph after "
+          << whole_step_warmup_steps_ << " warm-up steps.";
+  // Capture only records the work, it does not execute it; replay once so
+  // this step still produces its outputs.
+  whole_step_cuda_graph_->Replay();
+#else
+  RunImpl();
+#endif
+}
+
+namespace {
+
+// Ops cheap enough that their per-instruction scheduling cycle dominates
+// the kernel itself; used by FLAGS_new_executor_fuse_trivial_chains.
+bool IsTriviallyFusableOp(const Instruction& instr) {
+  if (!instr.OpBaseValid()) {
+    return false;
+  }
+  static const std::unordered_set<std::string> trivial_ops = {
+      "scale",
+      "cast",
+      "reshape2",
+      "squeeze2",
+      "unsqueeze2",
+      "flatten_contiguous_range"};
+  return trivial_ops.count(instr.OpBase()->Type()) > 0;
+}
+
+}  // namespace
+
+std::set<std::pair<size_t, size_t>>
+ProgramInterpreter::CollectTrivialChainLinks(
+    const std::map<size_t, std::set<size_t>>& downstream_map) const {
+  // A link (a, b) is fusable when b is the only direct downstream of a, a
+  // is the only direct upstream of b, both ops are trivial, and they run on
+  // the same device context (so no event would sit between them). Maximal
+  // runs of such links form the chains the dispatcher executes as one unit.
+  std::set<std::pair<size_t, size_t>> links;
+  std::vector<size_t> upstream_count(vec_instruction_.size(), 0);
+  for (auto& pair : downstream_map) {
+    for (size_t next_instr_id : pair.second) {
+      ++upstream_count[next_instr_id];
+    }
+  }
+  for (auto& pair : downstream_map) {
+    if (pair.second.size() != 1) {
+      continue;
+    }
+    const size_t cur = pair.first;
+    const size_t next = *pair.second.begin();
+    if (upstream_count[next] != 1) {
+      continue;
+    }
+    if (!IsTriviallyFusableOp(vec_instruction_[cur]) ||
+        !IsTriviallyFusableOp(vec_instruction_[next])) {
+      continue;
+    }
+    if (&vec_instruction_[cur].DeviceContext() !=
+        &vec_instruction_[next].DeviceContext()) {
+      continue;
+    }
+    links.emplace(cur, next);
+  }
+  VLOG(4) << "Found " << links.size() << " trivial chain links";
+  return links;
+}
+
 void ProgramInterpreter::BuildOperatorDependences() {
   // analysis the dependences between ops, add next_instr_list to each instr,
   // and set the dependency_count_
@@ -635,6 +830,22 @@ void ProgramInterpreter::BuildOperatorDependences() {
 
   auto downstream_map = dependency_builder_.Build(vec_instruction_);
 
+  if (FLAGS_new_executor_critical_path_priority) {
+    // Deeper ops sit on longer chains to the end of the step; give them a
+    // smaller (= higher) scheduling priority so the ready queues drain the
+    // critical path first.
+    const auto& depths = dependency_builder_.CalculateCriticalPathDepths();
+    for (size_t instr_id = 0; instr_id < instr_num; ++instr_id) {
+      vec_instruction_[instr_id].SetSchedulingPriority(
+          -static_cast<SchedulingPriority>(depths[instr_id]));
+    }
+  }
+
+  std::set<std::pair<size_t, size_t>> fused_links;
+  if (FLAGS_new_executor_fuse_trivial_chains) {
+    fused_links = CollectTrivialChainLinks(downstream_map);
+  }
+
   for (size_t instr_id = 0; instr_id < instr_num; ++instr_id) {
     Instruction& cur_instr = vec_instruction_[instr_id];
     const std::set<size_t>& next_instr_ids = downstream_map[instr_id];
@@ -646,8 +857,9 @@ void ProgramInterpreter::BuildOperatorDependences() {
     } else {
       if (cur_instr.KernelType() == OpFuncType::kGpuAsync) {
         for (size_t next_instr_id : next_instr_ids) {
-          if (vec_instruction_[next_instr_id].KernelType() ==
-              OpFuncType::kGpuAsync) {
+          if (fused_links.count({instr_id, next_instr_id}) ||
+              vec_instruction_[next_instr_id].KernelType() ==
+                  OpFuncType::kGpuAsync) {
             cur_instr.AddNextInstrInSameThread(next_instr_id);
           } else {
             cur_instr.AddNextInstrInDifferentThread(next_instr_id);
@@ -656,9 +868,13 @@ void ProgramInterpreter::BuildOperatorDependences() {
       } else {
         bool has_instr_in_same_thread = false;
         for (size_t next_instr_id : next_instr_ids) {
-          if (!has_instr_in_same_thread &&
-              vec_instruction_[next_instr_id].KernelType() !=
-                  OpFuncType::kGpuAsync) {
+          if (fused_links.count({instr_id, next_instr_id})) {
+            // Fused chain member: always continue in the same dispatch task.
+            cur_instr.AddNextInstrInSameThread(next_instr_id);
+            has_instr_in_same_thread = true;
+          } else if (!has_instr_in_same_thread &&
+                     vec_instruction_[next_instr_id].KernelType() !=
+                         OpFuncType::kGpuAsync) {
             cur_instr.AddNextInstrInSameThread(next_instr_id);
             has_instr_in_same_thread = true;
           } else {
@@ -705,6 +921,7 @@ void ProgramInterpreter::Convert(
   auto op_nums = nodes.size();
   vec_instruction_.clear();
   vec_instruction_.reserve(op_nums);
+  stream_analyzer_.AssignStreamsForIndependentBranches(&nodes);
   for (size_t op_idx = 0; op_idx < op_nums; ++op_idx) {
     auto& op_func_node = nodes[op_idx];
     stream_analyzer_.SetForceEventsToWaitInfo(force_events_to_wait_);
@@ -1024,13 +1241,26 @@ void ProgramInterpreter::RunOperator(const Instruction& instr_node) {
           VLOG(4) << "Run function kernel: " << op->Type();
           VLOG(4) << instr_node.InnerRuntimeContext().get() << " "
                   << &instr_node.DeviceContext();
-          phi::KernelContext phi_kernel_context;
-          op_with_kernel->BuildPhiKernelContext(
-              *instr_node.InnerRuntimeContext().get(),
-              const_cast<platform::DeviceContext*>(&instr_node.DeviceContext()),
-              &phi_kernel_context);
+          phi::KernelContext* phi_kernel_context =
+              instr_node.MutablePhiKernelContext();
+          // The argument list of an instruction is fixed by the static
+          // program, so the context built on the first step is replayed on
+          // later steps. Ops whose attributes are read out of input tensors
+          // while building must be rebuilt every step to pick up fresh
+          // values.
+          if (!instr_node.IsPhiKernelContextBuilt() ||
+              op_with_kernel->NeedPreparePhiData()) {
+            phi_kernel_context->ClearInputOutput();
+            phi_kernel_context->ClearAttrs();
+            op_with_kernel->BuildPhiKernelContext(
+                *instr_node.InnerRuntimeContext().get(),
+                const_cast<platform::DeviceContext*>(
+                    &instr_node.DeviceContext()),
+                phi_kernel_context);
+            instr_node.MarkPhiKernelContextBuilt();
+          }
 
-          (*kernel)(&phi_kernel_context);
+          (*kernel)(phi_kernel_context);
         } else {
           VLOG(4) << "Run structure kernel: " << op->Type();
           (*kernel)(instr_node.InnerExecutionContext().get());
@@ -1174,6 +1404,9 @@ void ProgramInterpreter::RunInstruction(const Instruction& instr_node) {
   auto* op = instr_node.OpBase();
   platform::RecordEvent instruction_event(
       op->Type(), platform::TracerEventType::Operator, 1);
+  // tag allocations made while this instruction runs, for the allocation
+  // event trace and the peak-memory attribution report
+  memory::OpContextScope op_context_scope(op->Type());
 
   SetDeviceId(instr_node.DeviceContext().GetPlace());
 
@@ -1633,9 +1866,50 @@ void ProgramInterpreter::TraceInstructionList(
     }
   }
 
+  // Host-op offload: CPU-sync instructions run on a single-threaded side
+  // queue so the trace loop keeps dispatching GPU work behind them. Before
+  // any instruction runs, the offloaded ops it depends on are awaited, so
+  // the dependency graph keeps providing correctness. GC stays safe because
+  // variable reference counts are only decreased when the offloaded op
+  // actually finishes.
+  const bool offload_host_ops =
+      FLAGS_new_executor_host_op_offload && platform::is_gpu_place(place_);
+  std::vector<std::pair<size_t, std::future<void>>> inflight_host_ops;
+  auto wait_inflight_host_ops = [&](size_t instr_id, bool wait_all) {
+    for (auto& pending : inflight_host_ops) {
+      if (pending.second.valid() &&
+          (wait_all ||
+           dependency_builder_.OpHappensBefore(pending.first, instr_id))) {
+        pending.second.get();
+      }
+    }
+    if (wait_all) {
+      inflight_host_ops.clear();
+    }
+  };
+
   for (auto instr_id : trace_execute_order_) {
     auto& instr_node = vec_instruction_.at(instr_id);
 
+    wait_inflight_host_ops(instr_id, /*wait_all=*/false);
+
+    if (offload_host_ops &&
+        instr_node.KernelType() == OpFuncType::kCpuSync &&
+        !exception_holder_.IsCaught()) {
+      if (!host_op_queue_) {
+        WorkQueueOptions options(/*name*/ "HostOpOffload",
+                                 /*num_threads*/ 1,
+                                 /*allow_spinning*/ true,
+                                 /*track_task*/ false);
+        host_op_queue_ = CreateSingleThreadedWorkQueue(options);
+      }
+      inflight_host_ops.emplace_back(
+          instr_id,
+          host_op_queue_->AddAwaitableTask(
+              [this, &instr_node]() { RunInstruction(instr_node); }));
+      continue;
+    }
+
     RunInstruction(instr_node);
 
     if (UNLIKELY(exception_holder_.IsCaught())) {
@@ -1644,6 +1918,8 @@ void ProgramInterpreter::TraceInstructionList(
     }
   }
 
+  wait_inflight_host_ops(0, /*wait_all=*/true);
+
   if (UNLIKELY(exception_holder_.IsCaught())) {
     VLOG(1) << "Exception caught " << exception_holder_.Type();
     PADDLE_ENFORCE_EQ(
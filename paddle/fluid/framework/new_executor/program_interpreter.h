@@ -18,6 +18,14 @@
 
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
 #include "paddle/phi/kernels/autotune/gpu_timer.h"
+
+namespace phi {
+namespace backends {
+namespace gpu {
+class CUDAGraph;
+}  // namespace gpu
+}  // namespace backends
+}  // namespace phi
 #endif
 
 namespace paddle {
@@ -141,6 +149,10 @@ class ProgramInterpreter : public InterpreterBaseImpl {
   // cuda graph
   void CheckCUDAGraphBeforeRun(const std::vector<std::string>& feed_names);
   void PrepareForCUDAGraphCapture();
+  // Runs one step; when FLAGS_new_executor_cuda_graph_auto_capture_steps is
+  // enabled, captures the whole step into a CUDA graph after the warm-up
+  // steps and replays it afterwards, re-capturing on feed shape change.
+  void RunWithAutoCUDAGraph(const std::vector<std::string>& feed_names);
 
   // execution
   void RunImpl();
@@ -172,6 +184,12 @@ class ProgramInterpreter : public InterpreterBaseImpl {
   // scope
   bool HasLocalScope() const;
 
+  // Links (a, b) of single-in/single-out chains of trivially cheap ops on
+  // one device context, fused into a single dispatch unit when
+  // FLAGS_new_executor_fuse_trivial_chains is on.
+  std::set<std::pair<size_t, size_t>> CollectTrivialChainLinks(
+      const std::map<size_t, std::set<size_t>>& downstream_map) const;
+
   // For log and debug
   std::string GetDepsString() const;
 
@@ -215,6 +233,10 @@ class ProgramInterpreter : public InterpreterBaseImpl {
   EventsWaiter main_thread_blocker_;
   std::shared_ptr<interpreter::AsyncWorkQueue> async_work_queue_;
 
+  // Single-threaded side queue running host-only ops offloaded from the
+  // trace loop, see FLAGS_new_executor_host_op_offload. Created lazily.
+  std::unique_ptr<WorkQueue> host_op_queue_;
+
   details::ExceptionHolder exception_holder_;
   std::shared_ptr<EventsWaiter::EventNotifier> exception_notifier_{nullptr};
   std::shared_ptr<EventsWaiter::EventNotifier> completion_notifier_{nullptr};
@@ -243,6 +265,11 @@ class ProgramInterpreter : public InterpreterBaseImpl {
 
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   std::unique_ptr<phi::CalculateStreamTimer> calculate_stream_timer_;
+
+  // Whole-step CUDA Graph auto-capture state, see RunWithAutoCUDAGraph.
+  std::unique_ptr<phi::backends::gpu::CUDAGraph> whole_step_cuda_graph_;
+  std::vector<int64_t> whole_step_shape_signature_;
+  int64_t whole_step_warmup_steps_{0};
 #endif
   size_t last_calculate_instr_id_;
   bool enable_job_schedule_profiler_;
@@ -92,7 +92,9 @@ void EventsWaiter::UnregisterEvent(const EventId& id) {
     }
   }
   if (eof_.load(std::memory_order_relaxed)) {
-    cv_.Notify(true);
+    // At most one thread waits on cv_ (see WaitEvent), a single targeted
+    // wake is sufficient.
+    cv_.Notify(false);
   }
 }
 
@@ -190,7 +192,14 @@ void EventsWaiter::TriggerEvent(const EventId& id) {
     return;
   }
   VLOG(10) << "Triggered event id:" << id;
-  cv_.Notify(true);
+  // WaitEvent allows only one waiter at a time, so wake exactly one thread
+  // instead of broadcasting. Notify(true) additionally converts every
+  // pre-wait thread into a signal, which at high step rates turns each
+  // step-completion notification into a futex storm against threads that
+  // will find no event to consume. Concurrent TriggerEvent calls are
+  // already deduplicated by the trigger_event_ CAS above, so exactly one
+  // wake per consumed event reaches the waiter.
+  cv_.Notify(false);
 }
 
 void EventsWaiter::CancelEvent(const EventId& id) {
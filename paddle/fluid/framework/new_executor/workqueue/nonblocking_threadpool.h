@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <vector>
 
@@ -17,6 +19,7 @@
 #include "paddle/fluid/framework/new_executor/workqueue/event_count.h"
 #include "paddle/fluid/framework/new_executor/workqueue/run_queue.h"
 #include "paddle/fluid/framework/new_executor/workqueue/thread_environment.h"
+#include "paddle/fluid/framework/new_executor/workqueue/workqueue_utils.h"
 #include "paddle/fluid/platform/os_info.h"
 #include "paddle/fluid/platform/profiler/event_tracing.h"
 
@@ -33,10 +36,12 @@ class ThreadPoolTempl {
                   int num_threads,
                   bool allow_spinning,
                   bool always_spinning,
+                  std::vector<size_t> bind_cores = {},
                   Environment env = Environment())
       : env_(env),
         allow_spinning_(allow_spinning),
         always_spinning_(always_spinning),
+        bind_cores_(std::move(bind_cores)),
         global_steal_partition_(EncodePartition(0, num_threads)),
         blocked_(0),
         done_(false),
@@ -60,8 +65,13 @@ class ThreadPoolTempl {
     }
     for (int i = 0; i < num_threads_; i++) {
       SetStealPartition(i, EncodePartition(0, num_threads_));
-      thread_data_[i].thread.reset(
-          env_.CreateThread([this, i]() { WorkerLoop(i); }));
+      thread_data_[i].thread.reset(env_.CreateThread([this, i]() {
+        // Affinity is best effort, see TryBindThreadToCores.
+        if (!bind_cores_.empty()) {
+          TryBindThreadToCores({bind_cores_[i % bind_cores_.size()]});
+        }
+        WorkerLoop(i);
+      }));
     }
   }
 
@@ -112,6 +122,7 @@ class ThreadPoolTempl {
       // Worker thread of this pool, push onto the thread's queue.
       Queue& q = thread_data_[pt->thread_id].queue;
       t = q.PushFront(std::move(t));
+      UpdateQueueDepthHwm(pt->thread_id);
     } else {
       // A free-standing thread (or worker of another pool), push onto a random
       // queue.
@@ -122,6 +133,7 @@ class ThreadPoolTempl {
       assert(start + rnd < limit);
       Queue& q = thread_data_[start + rnd].queue;
       t = q.PushBack(std::move(t));
+      UpdateQueueDepthHwm(start + rnd);
     }
 
     // Note: below we touch this after making w available to worker threads.
@@ -156,6 +168,37 @@ class ThreadPoolTempl {
 
   size_t NumThreads() const { return num_threads_; }
 
+  // Aggregated worker telemetry. All counters are monotonic since pool
+  // creation except queue_depth_hwm, which is the largest local queue
+  // depth seen on any thread.
+  struct TelemetrySnapshot {
+    uint64_t tasks_executed{0};
+    uint64_t steal_attempts{0};
+    uint64_t steal_successes{0};
+    uint64_t spin_ns{0};
+    uint64_t park_ns{0};
+    uint64_t queue_depth_hwm{0};
+  };
+
+  TelemetrySnapshot Telemetry() const {
+    TelemetrySnapshot snapshot;
+    for (const auto& data : thread_data_) {
+      const WorkerCounters& counters = data.counters;
+      snapshot.tasks_executed +=
+          counters.tasks_executed.load(std::memory_order_relaxed);
+      snapshot.steal_attempts +=
+          counters.steal_attempts.load(std::memory_order_relaxed);
+      snapshot.steal_successes +=
+          counters.steal_successes.load(std::memory_order_relaxed);
+      snapshot.spin_ns += counters.spin_ns.load(std::memory_order_relaxed);
+      snapshot.park_ns += counters.park_ns.load(std::memory_order_relaxed);
+      snapshot.queue_depth_hwm =
+          std::max(snapshot.queue_depth_hwm,
+                   counters.queue_depth_hwm.load(std::memory_order_relaxed));
+    }
+    return snapshot;
+  }
+
   int CurrentThreadId() const {
     const PerThread* pt = const_cast<ThreadPoolTempl*>(this)->GetPerThread();
     if (pt->pool == this) {
@@ -225,16 +268,31 @@ class ThreadPoolTempl {
     int thread_id;          // Worker thread index in pool.
   };
 
+  // Written by the owning worker (plus AddTask callers for the depth
+  // high-water mark), read by Telemetry(); relaxed atomics are enough.
+  // Aligned so the hot per-thread counters do not share cache lines.
+  struct alignas(64) WorkerCounters {
+    std::atomic<uint64_t> tasks_executed{0};
+    std::atomic<uint64_t> steal_attempts{0};
+    std::atomic<uint64_t> steal_successes{0};
+    std::atomic<uint64_t> spin_ns{0};
+    std::atomic<uint64_t> park_ns{0};
+    std::atomic<uint64_t> queue_depth_hwm{0};
+  };
+
   struct ThreadData {
-    constexpr ThreadData() : thread(), steal_partition(0), queue() {}
+    constexpr ThreadData()
+        : thread(), steal_partition(0), queue(), counters() {}
     std::unique_ptr<Thread> thread;
     std::atomic<unsigned> steal_partition;
     Queue queue;
+    WorkerCounters counters;
   };
 
   Environment env_;
   const bool allow_spinning_;
   const bool always_spinning_;
+  const std::vector<size_t> bind_cores_;
   std::vector<std::vector<unsigned>> all_coprimes_;
   unsigned global_steal_partition_;
   std::atomic<unsigned> blocked_;
@@ -262,6 +320,7 @@ class ThreadPoolTempl {
     // constant was picked based on a fair dice roll, tune it.
     const int spin_count =
         allow_spinning_ && num_threads_ > 0 ? 5000 / num_threads_ : 0;
+    WorkerCounters& counters = thread_data_[thread_id].counters;
     if (num_threads_ == 1) {
       // For num_threads_ == 1 there is no point in going through the expensive
       // steal loop. Moreover, since NonEmptyQueueIndex() calls PopBack() on the
@@ -271,10 +330,15 @@ class ThreadPoolTempl {
       // pools tend to be used for.
       while (!cancelled_) {
         Task t = q.PopFront();
-        for (int i = 0; i < spin_count && !t.f; i++) {
-          if (!cancelled_.load(std::memory_order_relaxed)) {
-            t = q.PopFront();
+        if (!t.f && spin_count > 0) {
+          const uint64_t spin_start = NowNs();
+          for (int i = 0; i < spin_count && !t.f; i++) {
+            if (!cancelled_.load(std::memory_order_relaxed)) {
+              t = q.PopFront();
+            }
           }
+          counters.spin_ns.fetch_add(NowNs() - spin_start,
+                                     std::memory_order_relaxed);
         }
         if (!t.f) {
           if (!WaitForWork(waiter, &t)) {
@@ -282,6 +346,7 @@ class ThreadPoolTempl {
           }
         }
         if (t.f) {
+          counters.tasks_executed.fetch_add(1, std::memory_order_relaxed);
           env_.ExecuteTask(t);
         }
       }
@@ -294,6 +359,7 @@ class ThreadPoolTempl {
             t = GlobalSteal();
             if (!t.f) {
               if (allow_spinning_) {
+                const uint64_t spin_start = NowNs();
                 for (int i = 0; i < spin_count && !t.f; i++) {
                   if (!cancelled_.load(std::memory_order_relaxed)) {
                     t = GlobalSteal();
@@ -301,6 +367,8 @@ class ThreadPoolTempl {
                     return;
                   }
                 }
+                counters.spin_ns.fetch_add(NowNs() - spin_start,
+                                           std::memory_order_relaxed);
               }
               if (!t.f) {
                 if (!WaitForWork(waiter, &t)) {
@@ -311,6 +379,7 @@ class ThreadPoolTempl {
           }
         }
         if (t.f) {
+          counters.tasks_executed.fetch_add(1, std::memory_order_relaxed);
           env_.ExecuteTask(t);
         }
       }
@@ -321,6 +390,8 @@ class ThreadPoolTempl {
   // limit) in best-effort manner.
   Task Steal(unsigned start, unsigned limit) {
     PerThread* pt = GetPerThread();
+    WorkerCounters& counters = thread_data_[pt->thread_id].counters;
+    counters.steal_attempts.fetch_add(1, std::memory_order_relaxed);
     const size_t size = limit - start;
     unsigned r = Rand(&pt->rand);
     // Reduce r into [0, size) range, this utilizes trick from
@@ -335,6 +406,7 @@ class ThreadPoolTempl {
       assert(start + victim < limit);
       Task t = thread_data_[start + victim].queue.PopBack();
       if (t.f) {
+        counters.steal_successes.fetch_add(1, std::memory_order_relaxed);
         return t;
       }
       victim += inc;
@@ -423,7 +495,10 @@ class ThreadPoolTempl {
     // Wait for work
     platform::RecordEvent record(
         "WaitForWork", platform::TracerEventType::UserDefined, 10);
+    const uint64_t park_start = NowNs();
     ec_.CommitWait(waiter);
+    thread_data_[GetPerThread()->thread_id].counters.park_ns.fetch_add(
+        NowNs() - park_start, std::memory_order_relaxed);
     blocked_--;
     return true;
   }
@@ -449,6 +524,23 @@ class ThreadPoolTempl {
     return -1;
   }
 
+  static inline uint64_t NowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+
+  inline void UpdateQueueDepthHwm(int queue_index) {
+    const uint64_t depth = thread_data_[queue_index].queue.Size();
+    std::atomic<uint64_t>& hwm =
+        thread_data_[queue_index].counters.queue_depth_hwm;
+    uint64_t prev = hwm.load(std::memory_order_relaxed);
+    while (depth > prev &&
+           !hwm.compare_exchange_weak(prev, depth, std::memory_order_relaxed)) {
+    }
+  }
+
   static inline uint64_t GlobalThreadIdHash() {
     return std::hash<std::thread::id>()(std::this_thread::get_id());
   }
@@ -6,6 +6,7 @@
 
 #include "paddle/fluid/framework/new_executor/workqueue/workqueue.h"
 
+#include "paddle/fluid/framework/new_executor/live_stats_exporter.h"
 #include "paddle/fluid/framework/new_executor/workqueue/nonblocking_threadpool.h"
 #include "paddle/fluid/framework/new_executor/workqueue/workqueue_utils.h"
 #include "paddle/fluid/platform/enforce.h"
@@ -35,6 +36,47 @@ namespace {
 
 using TaskTracker = TaskTracker<EventsWaiter::EventNotifier>;
 
+// Registers the pool's worker telemetry as live stats gauges, so thread
+// counts in ExecutionConfig can be sized from steal/spin/park data. The
+// exporter sums same-named gauges, so pools sharing a name aggregate.
+std::vector<int64_t> RegisterPoolTelemetry(const std::string& name,
+                                           NonblockingThreadPool* pool) {
+  auto& exporter = LiveStatsExporter::Instance();
+  const std::string prefix = "workqueue." + name + ".";
+  std::vector<int64_t> ids;
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "tasks_executed", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().tasks_executed);
+      }));
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "steal_attempts", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().steal_attempts);
+      }));
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "steal_successes", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().steal_successes);
+      }));
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "spin_ns", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().spin_ns);
+      }));
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "park_ns", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().park_ns);
+      }));
+  ids.push_back(exporter.RegisterGaugeProvider(
+      prefix + "queue_depth_hwm", [pool]() -> int64_t {
+        return static_cast<int64_t>(pool->Telemetry().queue_depth_hwm);
+      }));
+  return ids;
+}
+
+void UnregisterPoolTelemetry(const std::vector<int64_t>& ids) {
+  for (int64_t id : ids) {
+    LiveStatsExporter::Instance().UnregisterGaugeProvider(id);
+  }
+}
+
 class WorkQueueImpl : public WorkQueue {
  public:
   explicit WorkQueueImpl(const WorkQueueOptions& options) : WorkQueue(options) {
@@ -42,6 +84,10 @@ class WorkQueueImpl : public WorkQueue {
       empty_notifier_ = options.events_waiter->RegisterEvent(kQueueEmptyEvent);
       void* storage = AlignedMalloc(sizeof(TaskTracker), alignof(TaskTracker));
       tracker_ = new (storage) TaskTracker(*empty_notifier_);
+      pending_gauge_id_ = LiveStatsExporter::Instance().RegisterGaugeProvider(
+          "workqueue." + options_.name + ".pending", [tracker = tracker_] {
+            return static_cast<int64_t>(tracker->PendingTaskNum());
+          });
     }
     if (options_.detached == false && options.events_waiter != nullptr) {
       destruct_notifier_ =
@@ -50,10 +96,16 @@ class WorkQueueImpl : public WorkQueue {
     queue_ = new NonblockingThreadPool(options_.name,
                                        static_cast<int>(options_.num_threads),
                                        options_.allow_spinning,
-                                       options_.always_spinning);
+                                       options_.always_spinning,
+                                       options_.thread_bind_cores);
+    telemetry_gauge_ids_ = RegisterPoolTelemetry(options_.name, queue_);
   }
 
   ~WorkQueueImpl() override {
+    if (pending_gauge_id_ >= 0) {
+      LiveStatsExporter::Instance().UnregisterGaugeProvider(pending_gauge_id_);
+    }
+    UnregisterPoolTelemetry(telemetry_gauge_ids_);
     delete queue_;
     if (tracker_ != nullptr) {
       tracker_->~TaskTracker();
@@ -85,6 +137,8 @@ class WorkQueueImpl : public WorkQueue {
  private:
   NonblockingThreadPool* queue_{nullptr};
   TaskTracker* tracker_{nullptr};
+  int64_t pending_gauge_id_{-1};
+  std::vector<int64_t> telemetry_gauge_ids_;
   std::shared_ptr<EventsWaiter::EventNotifier> empty_notifier_;
   std::shared_ptr<EventsWaiter::EventNotifier> destruct_notifier_;
 };
@@ -108,6 +162,8 @@ class WorkQueueGroupImpl : public WorkQueueGroup {
   std::vector<NonblockingThreadPool*> queues_;
   NonblockingThreadPool* queues_storage_;
   TaskTracker* tracker_;
+  int64_t pending_gauge_id_{-1};
+  std::vector<int64_t> telemetry_gauge_ids_;
   std::shared_ptr<EventsWaiter::EventNotifier> empty_notifier_;
   std::shared_ptr<EventsWaiter::EventNotifier> destruct_notifier_;
 };
@@ -133,6 +189,10 @@ WorkQueueGroupImpl::WorkQueueGroupImpl(
       empty_notifier_ = options.events_waiter->RegisterEvent(kQueueEmptyEvent);
       void* storage = AlignedMalloc(sizeof(TaskTracker), alignof(TaskTracker));
       tracker_ = new (storage) TaskTracker(*empty_notifier_);
+      pending_gauge_id_ = LiveStatsExporter::Instance().RegisterGaugeProvider(
+          "workqueue." + options.name + ".pending", [tracker = tracker_] {
+            return static_cast<int64_t>(tracker->PendingTaskNum());
+          });
     }
     if (options.detached == false && options.events_waiter != nullptr &&
         !destruct_notifier_) {
@@ -143,11 +203,19 @@ WorkQueueGroupImpl::WorkQueueGroupImpl(
         NonblockingThreadPool(options.name,
                               static_cast<int>(options.num_threads),
                               options.allow_spinning,
-                              options.always_spinning);
+                              options.always_spinning,
+                              options.thread_bind_cores);
+    auto ids = RegisterPoolTelemetry(options.name, queues_[idx]);
+    telemetry_gauge_ids_.insert(
+        telemetry_gauge_ids_.end(), ids.begin(), ids.end());
   }
 }
 
 WorkQueueGroupImpl::~WorkQueueGroupImpl() {
+  if (pending_gauge_id_ >= 0) {
+    LiveStatsExporter::Instance().UnregisterGaugeProvider(pending_gauge_id_);
+  }
+  UnregisterPoolTelemetry(telemetry_gauge_ids_);
   for (auto queue : queues_) {
     if (queue) {
       queue->~NonblockingThreadPool();
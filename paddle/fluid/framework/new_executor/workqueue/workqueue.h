@@ -102,6 +102,9 @@ struct WorkQueueOptions {
   // false and set events_waiter.
   bool detached{true};
   EventsWaiter* events_waiter{nullptr};  // not owned
+  // Cores to pin the worker threads to, assigned round robin: worker i gets
+  // thread_bind_cores[i % size]. Empty (the default) lets threads float.
+  std::vector<size_t> thread_bind_cores;
 };
 
 class WorkQueue {
@@ -16,6 +16,12 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace paddle::framework {
 
@@ -55,4 +61,24 @@ void AlignedFree(void* mem_ptr) {
 #endif
 }
 
+bool TryBindThreadToCores(const std::vector<size_t>& cores) {
+#if defined(__linux__)
+  if (cores.empty()) {
+    return false;
+  }
+  const size_t num_cores = std::thread::hardware_concurrency();
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (size_t core : cores) {
+    if (num_cores != 0 && core >= num_cores) {
+      return false;
+    }
+    CPU_SET(core, &cpuset);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == 0;
+#else
+  return false;
+#endif
+}
+
 }  // namespace paddle::framework
@@ -21,6 +21,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "paddle/fluid/framework/new_executor/workqueue/events_waiter.h"
 #include "paddle/fluid/platform/enforce.h"
@@ -69,6 +70,12 @@ void* AlignedMalloc(size_t size, size_t alignment);
 
 void AlignedFree(void* memory_ptr);
 
+// Pins the calling thread to the given cores. Returns false when the set is
+// empty, a core id is out of range, or the platform has no affinity support;
+// affinity is a performance hint, so callers should not treat failure as an
+// error.
+bool TryBindThreadToCores(const std::vector<size_t>& cores);
+
 template <typename Notifier>
 class TaskTracker {
  public:
@@ -804,14 +804,12 @@ void OpDesc::SetBlocksAttr(const std::string &name,
   need_update_ = true;
 }
 
-void OpDesc::SetAttrMap(
-    const std::unordered_map<std::string, Attribute> &attr_map) {
+void OpDesc::SetAttrMap(const AttributeMap &attr_map) {
   attrs_ = attr_map;
   need_update_ = true;
 }
 
-void OpDesc::SetRuntimeAttrMap(
-    const std::unordered_map<std::string, Attribute> &attr_map) {
+void OpDesc::SetRuntimeAttrMap(const AttributeMap &attr_map) {
   runtime_attrs_ = attr_map;
   need_update_ = true;
 }
@@ -888,9 +886,7 @@ int OpDesc::GetBlockAttrId(const std::string &name) const {
   return PADDLE_GET_CONST(BlockDesc *, it->second)->ID();
 }
 
-const std::unordered_map<std::string, Attribute> &OpDesc::GetAttrMap() const {
-  return attrs_;
-}
+const AttributeMap &OpDesc::GetAttrMap() const { return attrs_; }
 
 const AttributeMap &OpDesc::GetRuntimeAttrMap() const { return runtime_attrs_; }
 
@@ -863,6 +863,11 @@ class OperatorWithKernel : public OperatorBase {
 
   void SetDnnFallback(bool dnn_fallback) const { dnn_fallback_ = dnn_fallback; }
 
+  // Whether BuildPhiKernelContext read data out of input tensors (e.g. a
+  // Scalar or IntArray attribute coming from a ShapeTensor), in which case a
+  // cached KernelContext cannot be replayed and must be rebuilt per run.
+  bool NeedPreparePhiData() const { return need_prepare_phi_data_; }
+
  private:
   void RunImpl(const Scope& scope, const platform::Place& place) const final;
   void RunImpl(const Scope& scope,
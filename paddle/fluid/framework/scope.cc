@@ -16,6 +16,7 @@ limitations under the License. */
 
 #include "glog/logging.h"
 #include "paddle/common/flags.h"
+#include "paddle/fluid/framework/tensor_util.h"
 #include "paddle/fluid/framework/threadpool.h"
 PD_DECLARE_bool(benchmark);
 
@@ -86,6 +87,50 @@ Variable* Scope::FindLocalVar(const std::string& name) const {
   return FindVarLocally(name);
 }
 
+size_t Scope::ResolveVarId(const std::string& name) const {
+  {
+    SCOPE_VARS_READER_LOCK
+    auto it = id_map_.find(name);
+    if (it != id_map_.end()) {
+      return it->second;
+    }
+  }
+  SCOPE_VARS_WRITER_LOCK
+  auto it = id_map_.find(name);
+  if (it != id_map_.end()) {
+    return it->second;
+  }
+  size_t id = id_table_.size();
+  VarIdSlot slot;
+  slot.name = name;
+  slot.var = FindVarInternal(name);
+  id_table_.push_back(std::move(slot));
+  id_map_.emplace(name, id);
+  return id;
+}
+
+Variable* Scope::FindVarById(size_t id) const {
+  if (id_table_gen_.load(std::memory_order_acquire) !=
+      mutation_gen_.load(std::memory_order_acquire)) {
+    RefreshVarIdTable();
+  }
+  return id < id_table_.size() ? id_table_[id].var : nullptr;
+}
+
+void Scope::RefreshVarIdTable() const {
+  SCOPE_VARS_WRITER_LOCK
+  uint64_t gen = mutation_gen_.load(std::memory_order_acquire);
+  if (id_table_gen_.load(std::memory_order_relaxed) == gen) {
+    return;  // another caller refreshed the table already
+  }
+  for (auto& slot : id_table_) {
+    slot.var = FindVarInternal(slot.name);
+  }
+  // a mutation racing the loop above bumps mutation_gen_ past gen and
+  // simply triggers another refresh on the next lookup
+  id_table_gen_.store(gen, std::memory_order_release);
+}
+
 const Scope* Scope::FindScope(const Variable* var) const {
   SCOPE_VARS_READER_LOCK
   return FindScopeInternal(var);
@@ -174,6 +219,7 @@ void Scope::EraseVars(const std::vector<std::string>& var_names) {
         ++it;
       }
     }
+    mutation_gen_.fetch_add(1, std::memory_order_release);
   }
 }
 
@@ -199,6 +245,7 @@ Variable* Scope::VarInternal(const std::string& name) {
   if (v != nullptr) return v;
   v = new Variable();
   vars_.emplace(name, std::unique_ptr<Variable>(v));
+  mutation_gen_.fetch_add(1, std::memory_order_release);
   VLOG(3) << "Create variable " << name;
   return v;
 }
@@ -234,8 +281,12 @@ void Scope::RenameInternal(const std::string& origin_name,
       vars_.end(),
       platform::errors::AlreadyExists(
           "The variable with name %s already exists in the scope.", new_name));
-  vars_[new_name].reset(origin_it->second.release());
+  // erase before inserting: the insertion may rehash the open addressing
+  // table and would invalidate origin_it
+  std::unique_ptr<Variable> holder = std::move(origin_it->second);
   vars_.erase(origin_it);
+  vars_[new_name] = std::move(holder);
+  mutation_gen_.fetch_add(1, std::memory_order_release);
 }
 
 Variable* Scope::FindVarInternal(const std::string& name) const {
@@ -243,6 +294,12 @@ Variable* Scope::FindVarInternal(const std::string& name) const {
   if (var != nullptr) {
     return var;
   }
+  if (read_only_scope_ != nullptr) {
+    var = read_only_scope_->FindVar(name);
+    if (var != nullptr) {
+      return var;
+    }
+  }
   return (parent_ == nullptr) ? nullptr : parent_->FindVar(name);
 }
 
@@ -254,15 +311,51 @@ Variable* Scope::FindVarLocally(const std::string& name) const {
   return nullptr;
 }
 
+void Scope::LinkReadOnlyScope(const Scope* read_only) {
+  PADDLE_ENFORCE_NE(read_only,
+                    this,
+                    platform::errors::InvalidArgument(
+                        "A scope cannot link itself as its read-only scope."));
+  read_only_scope_ = read_only;
+}
+
+Variable* Scope::VarCopyOnWrite(const std::string& name) {
+  const Variable* shared = nullptr;
+  if (read_only_scope_ != nullptr) {
+    shared = read_only_scope_->FindVar(name);
+  }
+  Variable* local = nullptr;
+  bool created = false;
+  {
+    SCOPE_VARS_WRITER_LOCK
+    local = FindVarLocally(name);
+    if (local == nullptr) {
+      local = VarInternal(name);
+      created = true;
+    }
+  }
+  if (created && shared != nullptr && shared->IsType<phi::DenseTensor>()) {
+    auto& src = shared->Get<phi::DenseTensor>();
+    auto* dst = local->GetMutable<phi::DenseTensor>();
+    if (src.IsInitialized()) {
+      // same-place deep copy so the mutation cannot touch the shared copy
+      TensorCopySync(src, src.place(), dst);
+      VLOG(3) << "Copy on write variable " << name;
+    }
+  }
+  return local;
+}
+
 void Scope::EraseVarsExcept(const std::unordered_set<Variable*>& vars) {
   SCOPE_VARS_WRITER_LOCK
   for (auto iter = vars_.begin(); iter != vars_.end();) {
     if (vars.count(iter->second.get()) != 0) {
       ++iter;
     } else {
-      vars_.erase(iter++);
+      iter = vars_.erase(iter);
     }
   }
+  mutation_gen_.fetch_add(1, std::memory_order_release);
 }
 
 std::string GenScopeTreeDebugInfo(Scope* root) {
@@ -18,6 +18,7 @@ extern "C" {
 #include <xxhash.h>
 }
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@ extern "C" {
 #include "paddle/fluid/framework/variable.h"
 #include "paddle/fluid/platform/macros.h"
 #include "paddle/phi/core/utils/rw_lock.h"
+#include "paddle/utils/flat_hash_map.h"
 #include "paddle/utils/test_macros.h"
 
 namespace paddle {
@@ -88,10 +90,40 @@ class TEST_API Scope {
   /// Caller doesn't own the returned Variable.
   Variable* FindLocalVar(const std::string& name) const;
 
+  /// Resolve a name to a dense scope-local id once (e.g. while building a
+  /// program's interpreter). The id stays valid for the lifetime of the
+  /// scope and indexes a table of cached FindVar results, so the per
+  /// access hot path is an array load without hashing the name or taking
+  /// the read lock.
+  size_t ResolveVarId(const std::string& name) const;
+
+  /// Hot-path lookup for ids from ResolveVarId. The cached pointers are
+  /// refreshed lazily whenever variables were created, erased or renamed
+  /// since resolution; like FindVar, calls must not race with structural
+  /// mutation of the scope.
+  Variable* FindVarById(size_t id) const;
+
   const Scope* parent() const { return parent_; }
 
   const Scope* root() const;
 
+  /// Link a canonical scope of shared read-only variables (typically the
+  /// parameters preloaded once for several executors). Lookups that miss
+  /// locally consult it before the parent, so multiple scope trees can
+  /// reference one copy of the parameters instead of duplicating them per
+  /// program. The linked scope must outlive this one, like a parent.
+  void LinkReadOnlyScope(const Scope* read_only);
+
+  const Scope* read_only_scope() const { return read_only_scope_; }
+
+  /// Copy-on-write escape hatch for the rare program that mutates a
+  /// shared parameter: materializes a local deep copy of the variable
+  /// found in the linked read-only scope (shadowing it for this scope
+  /// tree) and returns the copy. A plain Var() would shadow the shared
+  /// variable with an empty one instead. Only DenseTensor payloads are
+  /// copied; other variable types start out empty like Var().
+  Variable* VarCopyOnWrite(const std::string& name);
+
   /// Find the scope or an ancestor scope that contains the given variable.
   const Scope* FindScope(const Variable* var) const;
 
@@ -136,7 +168,11 @@ class TEST_API Scope {
     }
   };
 
-  mutable std::unordered_map<std::string, std::unique_ptr<Variable>, KeyHasher>
+  // open addressing keeps lookups allocation free and cache friendly;
+  // inner-loop accesses during interpreter builds hash millions of names
+  mutable paddle::flat_hash_map<std::string,
+                                std::unique_ptr<Variable>,
+                                KeyHasher>
       vars_;
 
  private:
@@ -162,9 +198,27 @@ class TEST_API Scope {
   // Called by FindVarInternal and Var.
   Variable* FindVarLocally(const std::string& name) const;
 
+  // Re-resolves every cached id slot after a structural mutation.
+  void RefreshVarIdTable() const;
+
+  // dense id fast path: ids index cached FindVar results, names are kept
+  // so stale slots can be re-resolved
+  struct VarIdSlot {
+    std::string name;
+    Variable* var{nullptr};
+  };
+  mutable std::vector<VarIdSlot> id_table_;
+  mutable paddle::flat_hash_map<std::string, size_t, KeyHasher> id_map_;
+  // bumped by Var/EraseVars/Rename; a mismatch with id_table_gen_ marks
+  // the cached pointers stale
+  mutable std::atomic<uint64_t> mutation_gen_{0};
+  mutable std::atomic<uint64_t> id_table_gen_{0};
+
   // Scope in `kids_` are owned by this class.
   mutable std::list<Scope*> kids_;
   const Scope* parent_{nullptr};
+  // not owned; consulted by FindVar between the local map and the parent
+  const Scope* read_only_scope_{nullptr};
 
   // only for dygraph_to_static
   bool can_reused_{false};
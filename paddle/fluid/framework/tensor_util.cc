@@ -21,6 +21,7 @@ limitations under the License. */
 #include <utility>
 #include <vector>
 
+#include "paddle/common/flags.h"
 #include "paddle/fluid/framework/convert_utils.h"
 #include "paddle/fluid/framework/data_type.h"
 #include "paddle/fluid/platform/complex.h"
@@ -32,9 +33,22 @@ limitations under the License. */
 #include "dnnl_debug.h"  // NOLINT
 #endif
 
+COMMON_DECLARE_bool(tensor_copy_on_write);
+
 namespace paddle {
 namespace framework {
 
+// Whether a copy of `src` onto `dst_place` can share the source allocation
+// copy-on-write instead of cloning it eagerly: the whole allocation must be
+// adoptable as-is, and the clone is deferred to the first write on either
+// side.
+static bool CanShareBufferCopyOnWrite(const phi::DenseTensor& src,
+                                      const platform::Place& dst_place) {
+  return FLAGS_tensor_copy_on_write && src.IsInitialized() &&
+         src.place() == dst_place && src.offset() == 0 &&
+         src.meta().is_contiguous() && src.layout() != phi::DataLayout::ONEDNN;
+}
+
 template <typename TENSOR>
 void TensorCopyImpl(const TENSOR& src,
                     const platform::Place& dst_place,
@@ -48,6 +62,14 @@ void TensorCopyImpl(const TENSOR& src,
   VLOG(3) << "TensorCopy " << src.dims() << " from " << src.place() << " to "
           << dst_place;
   src.check_memory_size();
+  if (CanShareBufferCopyOnWrite(src, dst_place)) {
+    VLOG(3) << "Share the data copy-on-write from " << src.place() << " to "
+            << dst_place;
+    dst->Resize(src.dims());
+    dst->set_layout(src.layout());
+    dst->ShareCowBufferWith(src);
+    return;
+  }
   dst->Resize(src.dims());
   dst->set_layout(src.layout());
   auto src_place = src.place();
@@ -309,6 +331,14 @@ void TensorCopySync(const phi::DenseTensor& src,
   }
 
   src.check_memory_size();
+  if (CanShareBufferCopyOnWrite(src, dst_place)) {
+    VLOG(3) << "Share the data copy-on-write from " << src.place() << " to "
+            << dst_place;
+    dst->Resize(src.dims());
+    dst->set_layout(src.layout());
+    dst->ShareCowBufferWith(src);
+    return;
+  }
   dst->Resize(src.dims());
   dst->set_layout(src.layout());
 #ifdef PADDLE_WITH_DNNL
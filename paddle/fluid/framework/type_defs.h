@@ -30,6 +30,7 @@ limitations under the License. */
 #include "paddle/pir/include/core/program.h"
 #include "paddle/pir/include/core/value.h"
 #include "paddle/utils/blank.h"
+#include "paddle/utils/flat_hash_map.h"
 #include "paddle/utils/small_vector.h"
 #include "paddle/utils/variant.h"
 
@@ -70,7 +71,12 @@ using Attribute = paddle::variant<paddle::blank,
                                   ::pir::Block*,
                                   std::vector<::pir::Value>,
                                   std::shared_ptr<::pir::Program>>;
-using AttributeMap = std::unordered_map<std::string, Attribute>;
+// Attribute maps are built once per op and then read on every run, so they
+// are stored in a flat hash map: one contiguous allocation instead of a
+// bucket node per attribute, which makes construction, copy and lookup
+// cheaper. Note that unlike std::unordered_map, references into the map are
+// invalidated by rehashing inserts.
+using AttributeMap = paddle::flat_hash_map<std::string, Attribute>;
 
 using OpCreator =
     std::function<OperatorBase*(const std::string& /*type*/,
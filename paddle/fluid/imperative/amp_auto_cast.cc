@@ -14,14 +14,25 @@
 
 #include "paddle/fluid/imperative/amp_auto_cast.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
+#include "paddle/common/flags.h"
 #include "paddle/fluid/eager/api/utils/global_utils.h"
 #include "paddle/fluid/eager/eager_tensor.h"
+#include "paddle/fluid/eager/grad_node_info.h"
 #include "paddle/fluid/imperative/tracer.h"
 #include "paddle/fluid/imperative/type_defs.h"
 #include "paddle/fluid/imperative/var_helper.h"
+#include "paddle/fluid/platform/flags.h"
+#include "paddle/phi/core/dense_tensor.h"
+
+PADDLE_DEFINE_EXPORTED_bool(
+    enable_amp_cast_cache,
+    true,
+    "Reuse the low-precision copy an AMP cast already produced for a tensor "
+    "in the current step, instead of re-casting it for every consumer op.");
 
 namespace paddle::imperative {
 
@@ -226,6 +237,80 @@ std::ostream& operator<<(std::ostream& os, AmpOperators& ops) {
   return os;
 }
 
+AmpCastCache& AmpCastCache::Instance() {
+  static AmpCastCache cache;
+  return cache;
+}
+
+static uint32_t GetTensorInplaceVersion(const paddle::Tensor& tensor) {
+  return static_cast<phi::DenseTensor*>(tensor.impl().get())
+      ->InplaceVersionCounter()
+      .CurrentVersion();
+}
+
+bool AmpCastCache::Get(const paddle::Tensor& input,
+                       const phi::DataType& dst_dtype,
+                       paddle::Tensor* casted) {
+  // Grad-disabled casts carry no grad node; reusing one in a grad-enabled
+  // forward (or the other way round) would corrupt the backward graph, so
+  // the cache only serves grad-enabled casts.
+  if (!FLAGS_enable_amp_cast_cache || !input.is_dense_tensor() ||
+      !egr::Controller::Instance().HasGrad()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto iter = cache_.find({input.impl().get(), dst_dtype});
+  if (iter == cache_.end()) {
+    return false;
+  }
+  Entry& entry = iter->second;
+  if (entry.source.lock() != input.impl() ||
+      entry.inplace_version != GetTensorInplaceVersion(input) ||
+      entry.graph_generation != egr::GradNodeGraphGeneration()) {
+    cache_.erase(iter);
+    return false;
+  }
+  VLOG(6) << "AMP cast cache hit: " << input.name() << " -> "
+          << phi::DataTypeToString(dst_dtype);
+  *casted = entry.casted;
+  return true;
+}
+
+void AmpCastCache::Put(const paddle::Tensor& input,
+                       const phi::DataType& dst_dtype,
+                       const paddle::Tensor& casted) {
+  if (!FLAGS_enable_amp_cast_cache || !input.is_dense_tensor() ||
+      !casted.is_dense_tensor() || !egr::Controller::Instance().HasGrad()) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (cache_.size() >= next_sweep_size_) {
+    // Stale entries keep their low-precision copy alive; sweep the ones
+    // whose source died or whose graph generation passed.
+    uint64_t generation = egr::GradNodeGraphGeneration();
+    for (auto iter = cache_.begin(); iter != cache_.end();) {
+      if (iter->second.source.expired() ||
+          iter->second.graph_generation != generation) {
+        iter = cache_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    next_sweep_size_ = std::max<size_t>(64, cache_.size() * 2);
+  }
+  cache_[{input.impl().get(), dst_dtype}] =
+      Entry{input.impl(),
+            GetTensorInplaceVersion(input),
+            egr::GradNodeGraphGeneration(),
+            casted};
+}
+
+void AmpCastCache::Clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  cache_.clear();
+  next_sweep_size_ = 64;
+}
+
 thread_local bool AmpAttrs::use_promote_ = false;
 
 thread_local AmpLevel AmpAttrs::amp_level_ = AmpLevel::O0;
@@ -13,14 +13,18 @@
 // limitations under the License.
 
 #pragma once
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 
 #include "paddle/fluid/framework/op_registry.h"
 #include "paddle/fluid/imperative/type_defs.h"
+#include "paddle/phi/api/include/tensor.h"
 
 namespace paddle {
 namespace imperative {
@@ -84,6 +88,51 @@ class AmpOperators {
 
 std::ostream& operator<<(std::ostream& os, AmpOperators& ops);
 
+// Deduplicates AMP casts within one forward pass. Ops cast their inputs
+// independently, so a parameter shared by many ops (a tied embedding, a
+// shared projection) is re-cast once per consumer; the cache hands back the
+// tensor produced by the first cast instead. An entry is trusted only while
+// the source tensor is alive and its inplace version counter is unchanged,
+// and only for the grad-node graph generation it was recorded under - after
+// backward tears the graph down, every entry goes stale on its own.
+// Controlled by FLAGS_enable_amp_cast_cache.
+class AmpCastCache {
+ public:
+  static AmpCastCache& Instance();
+
+  AmpCastCache(const AmpCastCache& o) = delete;
+  const AmpCastCache& operator=(const AmpCastCache& o) = delete;
+
+  // Returns true and fills `casted` when a still-valid cast of `input` to
+  // `dst_dtype` exists; drops the entry and returns false otherwise.
+  bool Get(const paddle::Tensor& input,
+           const phi::DataType& dst_dtype,
+           paddle::Tensor* casted);
+
+  // Records `casted` as the cast of `input` to `dst_dtype`.
+  void Put(const paddle::Tensor& input,
+           const phi::DataType& dst_dtype,
+           const paddle::Tensor& casted);
+
+  void Clear();
+
+ private:
+  AmpCastCache() = default;
+
+  struct Entry {
+    // Weak reference for identity validation; a dead source whose address
+    // got reused by a new tensor must not hit.
+    std::weak_ptr<phi::TensorBase> source;
+    uint32_t inplace_version;
+    uint64_t graph_generation;
+    paddle::Tensor casted;
+  };
+
+  std::mutex mutex_;
+  std::map<std::pair<const void*, phi::DataType>, Entry> cache_;
+  size_t next_sweep_size_{64};
+};
+
 class AmpAttrs {
  public:
   AmpAttrs();
@@ -236,7 +236,16 @@ static inline paddle::Tensor Cast(const paddle::Tensor& input,
     }
   } else {
     if (trace_backward) {
-      return cast_ad_func(input, dst_dtype);
+      // Every consumer op casts its inputs on its own, so a parameter shared
+      // by several ops would be re-cast for each of them; hand back the copy
+      // the first cast of this step produced instead.
+      paddle::Tensor casted;
+      if (AmpCastCache::Instance().Get(input, dst_dtype, &casted)) {
+        return casted;
+      }
+      casted = cast_ad_func(input, dst_dtype);
+      AmpCastCache::Instance().Put(input, dst_dtype, casted);
+      return casted;
     } else {
       return paddle::experimental::cast(input, dst_dtype);
     }
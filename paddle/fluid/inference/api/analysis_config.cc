@@ -438,6 +438,8 @@ AnalysisConfig::AnalysisConfig(const AnalysisConfig &other) {
   CP_MEMBER(model_dir_);
   CP_MEMBER(model_from_memory_);  // the memory model reuses prog_file_ and
                                   // params_file_ fields.
+  CP_MEMBER(use_mmap_params_);
+  CP_MEMBER(use_pipelined_io_);
   CP_MEMBER(save_optimized_model_);
   CP_MEMBER(opt_cache_dir_);
   CP_MEMBER(prog_file_);
@@ -1218,6 +1220,10 @@ bool AnalysisConfig::trt_engine_memory_sharing() const {
   return trt_engine_memory_sharing_;
 }
 
+void AnalysisConfig::EnableMmapParams(bool x) { use_mmap_params_ = x; }
+
+void AnalysisConfig::EnablePipelinedIO(bool x) { use_pipelined_io_ = x; }
+
 void AnalysisConfig::SetModelBuffer(const char *prog_buffer,
                                     size_t prog_buffer_size,
                                     const char *param_buffer,
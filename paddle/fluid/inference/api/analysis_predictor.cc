@@ -16,9 +16,17 @@
 
 #include <glog/logging.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -32,6 +40,7 @@
 #include "paddle/fluid/framework/feed_hook.h"
 #include "paddle/fluid/framework/ir/fuse_pass_base.h"
 #include "paddle/fluid/framework/ir/pass.h"
+#include "paddle/fluid/framework/lod_tensor.h"
 #include "paddle/fluid/framework/naive_executor.h"
 #include "paddle/fluid/framework/new_executor/pir_adaptor/pir_adaptor_util.h"
 #include "paddle/fluid/framework/op_proto_maker.h"
@@ -50,6 +59,7 @@
 #include "paddle/fluid/inference/api/paddle_inference_api.h"
 #include "paddle/fluid/inference/api/paddle_inference_pass.h"
 #include "paddle/fluid/inference/api/resource_manager.h"
+#include "paddle/fluid/inference/api/token_stream.h"
 #include "paddle/fluid/inference/utils/io_utils.h"
 #include "paddle/fluid/inference/utils/model_utils.h"
 #include "paddle/fluid/inference/utils/singleton.h"
@@ -458,7 +468,18 @@ bool AnalysisPredictor::Init(
     }
     std::string optimized_params =
         optimized_model_path + "/" + "_optimized.pdiparams";
-    if (FileExists(optimized_model) && FileExists(optimized_params)) {
+    std::string optimized_fingerprint =
+        optimized_model_path + "/" + "_optimized.fingerprint";
+    bool fingerprint_matched = false;
+    if (FileExists(optimized_fingerprint)) {
+      std::ifstream fin(optimized_fingerprint);
+      std::string cached_fingerprint;
+      fin >> cached_fingerprint;
+      fingerprint_matched =
+          cached_fingerprint == GetOptimizedModelFingerprint();
+    }
+    if (FileExists(optimized_model) && FileExists(optimized_params) &&
+        fingerprint_matched) {
       config_.SetModel(optimized_model, optimized_params);
       if (config_.new_ir_enabled()) {
         load_pir_model_ = true;
@@ -466,6 +487,13 @@ bool AnalysisPredictor::Init(
       LOG(INFO) << "Load Optimized model from " << optimized_model
                 << " and Load Optimized optimized_params from "
                 << optimized_params;
+    } else if (FileExists(optimized_model) && FileExists(optimized_params)) {
+      LOG(WARNING)
+          << "The optimized model does not match the current model and "
+             "config, fallback to original model. EnableSaveOptimModel will "
+             "be turned on and the optimized model will be refreshed.";
+      config_.EnableSaveOptimModel(true);
+      config_.UseOptimizedModel(false);
     } else {
       LOG(WARNING)
           << "The optimized model is not found, fallback to original model. "
@@ -525,6 +553,25 @@ bool AnalysisPredictor::Init(
       InitDeviceContexts();
     }
   }
+  if (config_.pipelined_io_enabled() && config_.use_gpu_) {
+    // The io stream carries the caller's uploads and downloads; the events
+    // splice them into the execution stream without host synchronization.
+#ifdef PADDLE_WITH_HIP
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipStreamCreateWithFlags(&io_stream_, hipStreamNonBlocking));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipEventCreateWithFlags(&io_ready_event_, hipEventDisableTiming));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipEventCreateWithFlags(&compute_done_event_, hipEventDisableTiming));
+#else
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaStreamCreateWithFlags(&io_stream_, cudaStreamNonBlocking));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaEventCreateWithFlags(&io_ready_event_, cudaEventDisableTiming));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaEventCreateWithFlags(&compute_done_event_, cudaEventDisableTiming));
+#endif
+  }
 #endif
 #if defined(PADDLE_WITH_XPU)
   if (config_.use_xpu_) {
@@ -614,6 +661,48 @@ std::string AnalysisPredictor::GetOptimizedModelPath() {
   return model_opt_cache_dir;
 }
 
+std::string AnalysisPredictor::GetOptimizedModelFingerprint() {
+  // The fingerprint hashes the original program together with the
+  // analysis-relevant config fields, so a cached optimized model is only
+  // reused when neither has changed since the cache was written.
+  std::string model_content;
+  std::string model_path = config_.prog_file();
+  if (!config_.model_from_memory() && FileExists(model_path)) {
+    std::ifstream fin(model_path, std::ios::in | std::ios::binary);
+    fin.seekg(0, std::ios::end);
+    model_content.resize(fin.tellg());
+    fin.seekg(0, std::ios::beg);
+    fin.read(&(model_content.at(0)), model_content.size());  // NOLINT
+  } else {
+    // With model_from_memory the "path" already is the program buffer.
+    model_content = model_path;
+  }
+  // The cache-control knobs themselves flip between the run that writes the
+  // cache and the run that reads it, and the external stream is a
+  // process-local pointer; none of them affect the analysis result, so mask
+  // them out before serializing.
+  AnalysisConfig fingerprint_config(config_);
+  fingerprint_config.save_optimized_model_ = false;
+  fingerprint_config.use_optimized_model_ = false;
+  fingerprint_config.exec_stream_ = nullptr;
+  return std::to_string(std::hash<std::string>()(model_content)) + "_" +
+         std::to_string(std::hash<std::string>()(
+             fingerprint_config.SerializeInfoCache()));
+}
+
+void AnalysisPredictor::SaveOptimizedModelFingerprint() {
+  std::string fingerprint_path =
+      GetOptimizedModelPath() + "/" + "_optimized.fingerprint";
+  std::ofstream fout(fingerprint_path, std::ios::out | std::ios::trunc);
+  if (!fout.is_open()) {
+    LOG(WARNING) << "Cannot write optimized model fingerprint to "
+                 << fingerprint_path
+                 << ", the optimized model will be rebuilt on the next start.";
+    return;
+  }
+  fout << GetOptimizedModelFingerprint();
+}
+
 void AnalysisPredictor::ClearExtraParams() {
   auto var_names = scope_->LocalVarNames();
   std::vector<std::string> trt_repetitive_params;
@@ -764,6 +853,14 @@ void *AnalysisPredictor::GetExecStream() const {
   return nullptr;
 }
 
+void *AnalysisPredictor::GetIoStream() const {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  return io_stream_;
+#else
+  return nullptr;
+#endif
+}
+
 const void *AnalysisPredictor::GetDeviceContexts() const {
   if (private_context_) {
     return &device_contexts_;
@@ -934,6 +1031,7 @@ void AnalysisPredictor::OptimizeInferencePirProgram() {
       pir::WriteModule(*pir_program_, optimized_model, 1, true, false, true);
       LOG(INFO) << "Optimized model saved to " << optimized_model;
       SaveOrLoadPirParameters(true);
+      SaveOptimizedModelFingerprint();
     }
   }
 
@@ -1157,6 +1255,9 @@ bool AnalysisPredictor::PrepareProgram(
 #endif
     } else {
       OptimizeInferenceProgram();
+      if (config_.save_optimized_model_) {
+        SaveOptimizedModelFingerprint();
+      }
     }
   } else {
     // If the program is passed from external, no need to optimize it, this
@@ -1245,7 +1346,14 @@ bool AnalysisPredictor::PrepareExecutor() {
   if (config_.new_ir_enabled()) {
     executor_->Prepare(sub_scope_);
   } else {
-    DisablePrepareDataOpt(inference_program_, 0, false);
+    // Clones execute the program desc they share with their root predictor,
+    // and the root already disabled the prepare-data optimization on it
+    // before any clone could be created. Walking the whole desc again from
+    // every clone is redundant, and mutating the shared op attrs here would
+    // race with sibling clones that are already running.
+    if (!status_is_cloned_) {
+      DisablePrepareDataOpt(inference_program_, 0, false);
+    }
     executor_->Prepare(sub_scope_, *inference_program_, 0);
   }
 
@@ -1699,6 +1807,10 @@ bool AnalysisPredictor::Run(const std::vector<PaddleTensor> &inputs,
   // recover the cpu_math_library_num_threads to 1, in order to avoid thread
   // conflict when integrating it into deployment service.
   paddle::platform::SetNumThreads(1);
+  // End of generation for any streaming consumer of this run.
+  if (token_stream_) {
+    token_stream_->Close();
+  }
 #ifdef PADDLE_WITH_DNNL
   if (config_.use_mkldnn_) MkldnnPostReset();
 #endif
@@ -1803,6 +1915,10 @@ bool AnalysisPredictor::Run(const std::vector<paddle::Tensor> &inputs,
   if (private_context_) {
     paddle::platform::DeviceContextPool::SetDeviceContexts(nullptr);
   }
+  // End of generation for any streaming consumer of this run.
+  if (token_stream_) {
+    token_stream_->Close();
+  }
 #ifdef PADDLE_WITH_DNNL
   if (config_.use_mkldnn_) MkldnnPostReset();
 #endif
@@ -1815,6 +1931,66 @@ bool AnalysisPredictor::Run(const std::vector<paddle::Tensor> &inputs,
   return true;
 }
 
+bool AnalysisPredictor::RunAsync(const std::vector<PaddleTensor> &inputs,
+                                 std::vector<PaddleTensor> *output_data,
+                                 RunCallback callback,
+                                 int batch_size) {
+  // A predictor owns a single scope and stream, so per-predictor requests
+  // must execute one after another anyway. A single dispatch thread draining
+  // a FIFO queue therefore gives the full achievable concurrency while the
+  // caller's thread returns immediately.
+  std::unique_lock<std::mutex> lock(async_mutex_);
+  if (async_stop_) {
+    LOG(ERROR) << "RunAsync called on a predictor that is shutting down.";
+    return false;
+  }
+  if (!async_worker_.joinable()) {
+    async_worker_ = std::thread(&AnalysisPredictor::AsyncRunLoop, this);
+  }
+  async_jobs_.emplace_back(
+      [this, inputs, output_data, callback = std::move(callback), batch_size] {
+        bool ok = false;
+        try {
+          // Run copies the fetched tensors to output_data before returning,
+          // which synchronizes with the predictor's stream, so once it
+          // returns the outputs are complete and the callback may fire.
+          ok = Run(inputs, output_data, batch_size);
+        } catch (const std::exception &e) {
+          LOG(ERROR) << "RunAsync request failed: " << e.what();
+        }
+        if (callback) callback(ok);
+      });
+  lock.unlock();
+  async_cv_.notify_one();
+  return true;
+}
+
+void AnalysisPredictor::AsyncRunLoop() {
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(async_mutex_);
+      async_cv_.wait(lock,
+                     [this] { return async_stop_ || !async_jobs_.empty(); });
+      if (async_jobs_.empty()) break;  // Stopped and drained.
+      job = std::move(async_jobs_.front());
+      async_jobs_.pop_front();
+    }
+    job();
+  }
+}
+
+void AnalysisPredictor::StopAsyncWorker() {
+  {
+    std::lock_guard<std::mutex> lock(async_mutex_);
+    async_stop_ = true;
+  }
+  async_cv_.notify_all();
+  if (async_worker_.joinable()) {
+    async_worker_.join();
+  }
+}
+
 bool AnalysisPredictor::SetFeed(const std::vector<PaddleTensor> &inputs,
                                 framework::Scope *scope) {
   VLOG(3) << "Predictor::set_feed";
@@ -2739,6 +2915,23 @@ bool AnalysisPredictor::ZeroCopyRun(bool switch_stream) {
   }
 #endif
 
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (io_stream_ != nullptr) {
+    // Order the graph after every upload the caller issued on the io
+    // stream, on the device instead of on the host.
+    auto exec_stream = static_cast<gpuStream_t>(GetExecStream());
+#ifdef PADDLE_WITH_HIP
+    PADDLE_ENFORCE_GPU_SUCCESS(hipEventRecord(io_ready_event_, io_stream_));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipStreamWaitEvent(exec_stream, io_ready_event_, 0));
+#else
+    PADDLE_ENFORCE_GPU_SUCCESS(cudaEventRecord(io_ready_event_, io_stream_));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaStreamWaitEvent(exec_stream, io_ready_event_, 0));
+#endif
+  }
+#endif
+
   if (config_.new_executor_enabled()) {  // NOLINT
     executor_->RunInterpreterCore({}, false, switch_stream);
   } else {
@@ -2746,6 +2939,26 @@ bool AnalysisPredictor::ZeroCopyRun(bool switch_stream) {
   }
   inference::DisplayMemoryInfo(place_, "after run");
 
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (io_stream_ != nullptr) {
+    // Downloads the caller issues on the io stream next must follow the
+    // graph; so must the next request's uploads, since the feed variables
+    // stay live until the graph has finished reading them.
+    auto exec_stream = static_cast<gpuStream_t>(GetExecStream());
+#ifdef PADDLE_WITH_HIP
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipEventRecord(compute_done_event_, exec_stream));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipStreamWaitEvent(io_stream_, compute_done_event_, 0));
+#else
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaEventRecord(compute_done_event_, exec_stream));
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaStreamWaitEvent(io_stream_, compute_done_event_, 0));
+#endif
+  }
+#endif
+
 #ifdef PADDLE_WITH_XPU
   if (config_.use_xpu_ && infer_xpu_ctx != nullptr) {
     infer_xpu_ctx->L3CacheAutotune();
@@ -2762,6 +2975,10 @@ bool AnalysisPredictor::ZeroCopyRun(bool switch_stream) {
   if (private_context_) {
     paddle::platform::DeviceContextPool::SetDeviceContexts(nullptr);
   }
+  // End of generation for any streaming consumer of this run.
+  if (token_stream_) {
+    token_stream_->Close();
+  }
 #ifdef PADDLE_WITH_DNNL
   if (config_.use_mkldnn_) MkldnnPostReset();
 #endif
@@ -3054,6 +3271,15 @@ bool AnalysisPredictor::LoadParameters() {
                           platform::errors::PreconditionNotMet(
                               "The inference program should be loaded first."));
 
+  if (config_.mmap_params_enabled() && !config_.params_file().empty() &&
+      !config_.model_from_memory()) {
+    if (LoadParametersFromMmap()) {
+      return true;
+    }
+    LOG(WARNING) << "Cannot load parameters through mmap, falling back to "
+                    "buffered loading.";
+  }
+
   const auto &global_block = inference_program_->MutableBlock(0);
 
   // create a temporary program to load parameters.
@@ -3107,6 +3333,128 @@ bool AnalysisPredictor::LoadParameters() {
   return true;
 }
 
+#if !defined(_WIN32)
+namespace {
+
+// Read-only istream over a memory mapping. Nothing is read ahead: pages
+// fault in as DeserializeFromStream copies them toward the device, and the
+// OS shares them between predictors that map the same parameter file.
+class MmapStreamBuf : public std::streambuf {
+ public:
+  MmapStreamBuf(char *data, size_t size) { setg(data, data, data + size); }
+
+ protected:
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode) override {
+    char *base = eback();
+    char *target = dir == std::ios_base::beg   ? base + off
+                   : dir == std::ios_base::cur ? gptr() + off
+                                               : egptr() + off;
+    if (target < base || target > egptr()) {
+      return pos_type(off_type(-1));
+    }
+    setg(base, target, egptr());
+    return pos_type(target - base);
+  }
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+
+class MappedParamsFile {
+ public:
+  explicit MappedParamsFile(const std::string &path) {
+    fd_ = open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+      return;
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || st.st_size <= 0) {
+      return;
+    }
+    void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (addr == MAP_FAILED) {
+      return;
+    }
+    data_ = static_cast<char *>(addr);
+    size_ = static_cast<size_t>(st.st_size);
+    // parameters are deserialized in file order
+    madvise(addr, size_, MADV_SEQUENTIAL);
+  }
+  ~MappedParamsFile() {
+    if (data_ != nullptr) {
+      munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+  MappedParamsFile(const MappedParamsFile &) = delete;
+  MappedParamsFile &operator=(const MappedParamsFile &) = delete;
+
+  bool valid() const { return data_ != nullptr; }
+  char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  int fd_{-1};
+  char *data_{nullptr};
+  size_t size_{0};
+};
+
+}  // namespace
+
+bool AnalysisPredictor::LoadParametersFromMmap() {
+  const auto &global_block = inference_program_->MutableBlock(0);
+
+  std::vector<std::string> params;
+  for (auto *var : global_block->AllVars()) {
+    if (!IsPersistable(var)) {
+      continue;
+    }
+    if (var->GetType() != framework::proto::VarType::LOD_TENSOR) {
+      // e.g. a vocab; only load_combine knows how to deserialize it
+      VLOG(3) << "variable " << var->Name()
+              << " is not a dense tensor, mmap loading does not apply";
+      return false;
+    }
+    params.push_back(var->Name());
+  }
+  // the combined file stores parameters in name order
+  std::sort(params.begin(), params.end());
+
+  MappedParamsFile mapping(config_.params_file());
+  if (!mapping.valid()) {
+    return false;
+  }
+
+  MmapStreamBuf stream_buf(mapping.data(), mapping.size());
+  std::istream fin(&stream_buf);
+  auto &dev_ctx = *phi::DeviceContextPool::Instance().Get(place_);
+
+  for (const auto &name : params) {
+    auto *tensor = scope_->Var(name)->GetMutable<phi::DenseTensor>();
+    framework::DeserializeFromStream(fin, tensor, dev_ctx);
+    PADDLE_ENFORCE_EQ(
+        static_cast<bool>(fin),
+        true,
+        platform::errors::Unavailable(
+            "An error occurred while loading parameter %s from the mapped "
+            "file %s. Please check whether the model file is complete or "
+            "damaged.",
+            name,
+            config_.params_file()));
+  }
+  // every tensor has been copied off the mapping (to the device or into its
+  // own host buffer), so it can be dropped before the executor starts
+  VLOG(3) << "loaded " << params.size() << " parameters through mmap";
+  return true;
+}
+#else
+bool AnalysisPredictor::LoadParametersFromMmap() { return false; }
+#endif
+
 uint64_t AnalysisPredictor::TryShrinkMemory() {
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   if (config_.use_gpu()) {
@@ -3192,6 +3540,9 @@ bool AnalysisPredictor::SaveTrtCalibToDisk() {
 #endif
 
 AnalysisPredictor::~AnalysisPredictor() {  // NOLINT
+  // Queued RunAsync requests hold raw pointers into this predictor, so the
+  // dispatch thread must finish before anything else is torn down.
+  StopAsyncWorker();
 #ifdef PADDLE_WITH_TENSORRT
   if (config_.tensorrt_engine_enabled() &&
       config_.tensorrt_precision_mode_ == AnalysisConfig::Precision::kInt8 &&
@@ -3231,6 +3582,19 @@ AnalysisPredictor::~AnalysisPredictor() {  // NOLINT
   if (predictor_stream_ != nullptr) {
     ResourceManager::Instance().DestroyGPUResource(predictor_stream_);
   }
+  if (io_stream_ != nullptr) {
+#ifdef PADDLE_WITH_HIP
+    hipStreamSynchronize(io_stream_);
+    hipEventDestroy(compute_done_event_);
+    hipEventDestroy(io_ready_event_);
+    hipStreamDestroy(io_stream_);
+#else
+    cudaStreamSynchronize(io_stream_);
+    cudaEventDestroy(compute_done_event_);
+    cudaEventDestroy(io_ready_event_);
+    cudaStreamDestroy(io_stream_);
+#endif
+  }
 #endif
 
   if (place_.GetType() != phi::AllocationType::UNDEFINED) {
@@ -3361,6 +3725,33 @@ void AnalysisPredictor::RegisterOutputHook(
   }
 }
 
+std::shared_ptr<TokenStream> AnalysisPredictor::EnableStreamingOutput(
+    const std::string &output_name, size_t capacity) {
+  token_stream_var_ = output_name;
+  token_stream_ = std::make_shared<TokenStream>(capacity);
+  std::call_once(token_stream_hook_flag_, [this] {
+    RegisterOutputHook([this](const std::string &op_type,
+                              const std::string &var_name,
+                              const paddle::Tensor &tensor) {
+      auto stream = token_stream_;
+      if (!stream || stream->closed() || var_name != token_stream_var_) {
+        return;
+      }
+      auto dense =
+          std::dynamic_pointer_cast<phi::DenseTensor>(tensor.impl());
+      if (!dense || !dense->initialized()) {
+        return;
+      }
+      // The graph overwrites the watched variable on the next step, so the
+      // stream carries a host snapshot rather than an alias.
+      auto host = std::make_shared<phi::DenseTensor>();
+      framework::TensorCopySync(*dense, phi::CPUPlace(), host.get());
+      stream->Push(paddle::Tensor(host, var_name));
+    });
+  });
+  return token_stream_;
+}
+
 void AnalysisPredictor::RegisterInputHook(const InputTensorHookFunc &hookfunc) {
   if (config_.new_ir_enabled()) {
     std::call_once(register_input_hook_flag_, [this] {
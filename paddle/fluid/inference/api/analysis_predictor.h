@@ -15,9 +15,13 @@
 #pragma once
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "paddle/fluid/framework/naive_executor.h"
@@ -72,6 +76,8 @@ using framework::proto::ProgramDesc;
 using inference::analysis::Analyzer;
 using inference::analysis::Argument;
 
+class TokenStream;
+
 ///
 /// \class AnalysisPredictor
 ///
@@ -152,6 +158,24 @@ class AnalysisPredictor : public PaddlePredictor {
   bool Run(const std::vector<paddle::Tensor> &inputs,
            std::vector<paddle::Tensor> *outputs) override;
 
+  ///
+  /// \brief Enqueue a prediction and return immediately.
+  ///
+  /// Requests are executed in FIFO order on a per-predictor dispatch thread,
+  /// which invokes the callback once output_data has been filled. See
+  /// PaddlePredictor::RunAsync for the lifetime rules of the arguments.
+  ///
+  /// \param[in] inputs input tensors
+  /// \param[out] output_data output tensors
+  /// \param[in] callback invoked with the run's success flag on completion
+  /// \param[in] batch_size data's batch size
+  /// \return Whether the request was accepted
+  ///
+  bool RunAsync(const std::vector<PaddleTensor> &inputs,
+                std::vector<PaddleTensor> *output_data,
+                RunCallback callback,
+                int batch_size = -1) override;
+
   ///
   /// \brief Get the input names
   ///
@@ -233,6 +257,20 @@ class AnalysisPredictor : public PaddlePredictor {
   ///
   void *GetExecStream() const override;
 
+  ///
+  /// \brief Get the predictor's dedicated copy stream, created when
+  /// AnalysisConfig::EnablePipelinedIO was set on a GPU predictor.
+  ///
+  /// Uploads and downloads issued on this stream (through
+  /// experimental::InternalUtils::CopyFromCpuWithIoStream and
+  /// CopyToCpuWithIoStream) are ordered against the graph by ZeroCopyRun
+  /// with events, so transfers overlap computation instead of serializing
+  /// on the execution stream.
+  ///
+  /// \return The io stream, or nullptr when pipelined io is off.
+  ///
+  void *GetIoStream() const;
+
   ///
   /// \brief Create feed fetch variables
   ///
@@ -329,6 +367,23 @@ class AnalysisPredictor : public PaddlePredictor {
   /// \brief Same as RegisterOutputHook
   void RegisterInputHook(const InputTensorHookFunc &hookfunc) override;
 
+  ///
+  /// \brief Stream per-step snapshots of a variable while a run executes.
+  ///
+  /// Every time the executed block produces output_name, a host copy of it
+  /// is pushed onto the returned stream; a generation graph that writes its
+  /// decoded ids there per step can thus be consumed token by token from
+  /// another thread (pair with RunAsync to keep the caller free). The stream
+  /// closes when the run finishes. Call again before the next request to get
+  /// a fresh stream; the previous one stops receiving.
+  ///
+  /// \param[in] output_name name of the variable to watch
+  /// \param[in] capacity ring capacity of the stream, in steps
+  /// \return the stream the caller pops from
+  ///
+  std::shared_ptr<TokenStream> EnableStreamingOutput(
+      const std::string &output_name, size_t capacity = 8192);
+
   ///
   /// \brief Initialize onednn quantizer and execute onednn quantization pass
   ///
@@ -392,6 +447,17 @@ class AnalysisPredictor : public PaddlePredictor {
   ///
   bool LoadParameters();
 
+  ///
+  /// \brief Load model parameters from a memory-mapped combined file.
+  /// Pages fault in while each tensor is deserialized toward the device,
+  /// so no host-side copy of the whole file is made. Returns false when
+  /// the file cannot be mapped or contains non-dense variables, in which
+  /// case the caller falls back to the load_combine path.
+  ///
+  /// \return Whether the parameters were loaded through the mapping.
+  ///
+  bool LoadParametersFromMmap();
+
   ///
   /// \brief Save or Load pir model parameters.
   ///
@@ -518,6 +584,8 @@ class AnalysisPredictor : public PaddlePredictor {
   void InitDeviceContexts();
   void InitResourceManager(void *stream);
   std::string GetOptimizedModelPath();
+  std::string GetOptimizedModelFingerprint();
+  void SaveOptimizedModelFingerprint();
   void ClearExtraParams();
 
 #if defined(PADDLE_WITH_DISTRIBUTE) && defined(PADDLE_WITH_PSCORE)
@@ -617,17 +685,49 @@ class AnalysisPredictor : public PaddlePredictor {
   std::once_flag register_output_hook_flag_;
   std::vector<OutputTensorHookFunc> output_hookfuncs_;
   std::vector<InputTensorHookFunc> input_hookfuncs_;
+  std::once_flag token_stream_hook_flag_;
+  std::shared_ptr<TokenStream> token_stream_;
+  std::string token_stream_var_;
   // Some status here that help to determine the status inside the predictor.
   bool status_is_cloned_{false};
 
   std::map<std::string, std::vector<std::vector<int32_t>>> shape_info_;
   std::map<std::string, std::vector<std::vector<int32_t>>> shape_tensor_value_;
 
+  ///
+  /// \brief Body of the RunAsync dispatch thread.
+  ///
+  /// Pops queued requests and executes them until StopAsyncWorker() is called.
+  ///
+  void AsyncRunLoop();
+
+  ///
+  /// \brief Stop and join the RunAsync dispatch thread, if it was started.
+  ///
+  void StopAsyncWorker();
+
   bool private_context_{false};
   void *predictor_stream_{nullptr};
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  // Pipelined io state: the dedicated copy stream plus the events that
+  // order uploads before the graph and downloads after it. Only created
+  // when config_.pipelined_io_enabled() holds and the predictor runs on
+  // GPU.
+  gpuStream_t io_stream_{nullptr};
+  gpuEvent_t io_ready_event_{nullptr};
+  gpuEvent_t compute_done_event_{nullptr};
+#endif
   std::map<phi::Place, std::shared_future<std::unique_ptr<phi::DeviceContext>>>
       device_contexts_;
 
+  // RunAsync state. The worker thread is started lazily on the first
+  // RunAsync call and joined in the destructor.
+  std::thread async_worker_;
+  std::mutex async_mutex_;
+  std::condition_variable async_cv_;
+  std::deque<std::function<void()>> async_jobs_;
+  bool async_stop_{false};
+
 #if defined(PADDLE_WITH_DISTRIBUTE) && defined(PADDLE_WITH_PSCORE)
   // fleet executor related
   distributed::FleetExecutorDesc executor_desc_;
@@ -368,6 +368,22 @@ void Tensor::ShareExternalData(const T *data,
   }
 }
 
+void Tensor::ShareExternalData(const Tensor &src) {
+  EAGER_GET_TENSOR(phi::DenseTensor)
+  auto *src_tensor =
+      static_cast<phi::DenseTensor *>(src.FindTensor<phi::DenseTensor>());
+  PADDLE_ENFORCE_EQ(src_tensor->initialized(),
+                    true,
+                    paddle::platform::errors::PreconditionNotMet(
+                        "Source tensor [%s] holds no data; run the predictor "
+                        "that produces it before sharing it.",
+                        src.name_));
+  // Alias the source holder and meta instead of copying: the consuming
+  // predictor reads the producer's buffer in place, on whatever device it
+  // already lives.
+  tensor->ShareDataWith(*src_tensor);
+}
+
 void Tensor::CopyStringsFromCpu(const paddle_infer::Strings *data) {
   EAGER_GET_TENSOR(paddle::framework::Strings);
   PADDLE_ENFORCE_GE(tensor->size(),
@@ -0,0 +1,388 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/inference/api/dynamic_batcher.h"
+
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <utility>
+
+#include "glog/logging.h"
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle {
+
+namespace {
+
+// Bytes per element for the dtypes the batcher knows how to concatenate.
+// Returns -1 for everything else, which makes validation reject the request.
+int DtypeBytes(PaddleDType dtype) {
+  switch (dtype) {
+    case PaddleDType::FLOAT32:
+      return sizeof(float);
+    case PaddleDType::INT64:
+      return sizeof(int64_t);
+    case PaddleDType::INT32:
+      return sizeof(int32_t);
+    case PaddleDType::UINT8:
+      return sizeof(uint8_t);
+    case PaddleDType::INT8:
+      return sizeof(int8_t);
+    default:
+      return -1;
+  }
+}
+
+// The zero-copy tensor interface is templated on the element type, so the
+// byte-oriented batching code dispatches through these switches.
+void CopyFromCpuBytes(ZeroCopyTensor *tensor,
+                      PaddleDType dtype,
+                      const void *src) {
+  switch (dtype) {
+    case PaddleDType::FLOAT32:
+      tensor->copy_from_cpu(static_cast<const float *>(src));
+      break;
+    case PaddleDType::INT64:
+      tensor->copy_from_cpu(static_cast<const int64_t *>(src));
+      break;
+    case PaddleDType::INT32:
+      tensor->copy_from_cpu(static_cast<const int32_t *>(src));
+      break;
+    case PaddleDType::UINT8:
+      tensor->copy_from_cpu(static_cast<const uint8_t *>(src));
+      break;
+    case PaddleDType::INT8:
+      tensor->copy_from_cpu(static_cast<const int8_t *>(src));
+      break;
+    default:
+      PADDLE_THROW(platform::errors::Unimplemented(
+          "DynamicBatcher met an input data type it cannot batch."));
+  }
+}
+
+void CopyToCpuBytes(ZeroCopyTensor *tensor, PaddleDType dtype, void *dst) {
+  switch (dtype) {
+    case PaddleDType::FLOAT32:
+      tensor->copy_to_cpu(static_cast<float *>(dst));
+      break;
+    case PaddleDType::INT64:
+      tensor->copy_to_cpu(static_cast<int64_t *>(dst));
+      break;
+    case PaddleDType::INT32:
+      tensor->copy_to_cpu(static_cast<int32_t *>(dst));
+      break;
+    case PaddleDType::UINT8:
+      tensor->copy_to_cpu(static_cast<uint8_t *>(dst));
+      break;
+    case PaddleDType::INT8:
+      tensor->copy_to_cpu(static_cast<int8_t *>(dst));
+      break;
+    default:
+      PADDLE_THROW(platform::errors::Unimplemented(
+          "DynamicBatcher met an output data type it cannot scatter."));
+  }
+}
+
+// Returns the output tensor's buffer when it already lives on the host, so
+// the scatter can slice it in place; returns nullptr for device-resident
+// outputs, which then take the copy_to_cpu staging path.
+const char *TryHostData(ZeroCopyTensor *tensor, PaddleDType dtype) {
+  PaddlePlace place = PaddlePlace::kUNK;
+  int size = 0;
+  const char *data = nullptr;
+  switch (dtype) {
+    case PaddleDType::FLOAT32:
+      data = reinterpret_cast<const char *>(tensor->data<float>(&place, &size));
+      break;
+    case PaddleDType::INT64:
+      data =
+          reinterpret_cast<const char *>(tensor->data<int64_t>(&place, &size));
+      break;
+    case PaddleDType::INT32:
+      data =
+          reinterpret_cast<const char *>(tensor->data<int32_t>(&place, &size));
+      break;
+    case PaddleDType::UINT8:
+      data =
+          reinterpret_cast<const char *>(tensor->data<uint8_t>(&place, &size));
+      break;
+    case PaddleDType::INT8:
+      data =
+          reinterpret_cast<const char *>(tensor->data<int8_t>(&place, &size));
+      break;
+    default:
+      return nullptr;
+  }
+  return place == PaddlePlace::kCPU ? data : nullptr;
+}
+
+int64_t RowBytes(const std::vector<int> &shape, PaddleDType dtype) {
+  int64_t bytes = DtypeBytes(dtype);
+  for (size_t d = 1; d < shape.size(); ++d) {
+    bytes *= shape[d];
+  }
+  return bytes;
+}
+
+}  // namespace
+
+DynamicBatcher::DynamicBatcher(std::shared_ptr<PaddlePredictor> predictor,
+                               Options options)
+    : predictor_(std::move(predictor)), options_(options) {
+  PADDLE_ENFORCE_NOT_NULL(
+      predictor_,
+      platform::errors::InvalidArgument(
+          "The predictor wrapped by DynamicBatcher should not be null."));
+  auto names = predictor_->GetInputNames();
+  input_names_.insert(names.begin(), names.end());
+  output_names_ = predictor_->GetOutputNames();
+  engine_ = std::thread(&DynamicBatcher::EngineLoop, this);
+}
+
+DynamicBatcher::~DynamicBatcher() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  if (engine_.joinable()) {
+    engine_.join();
+  }
+}
+
+bool DynamicBatcher::Enqueue(std::vector<PaddleTensor> inputs,
+                             std::vector<PaddleTensor> *output_data,
+                             DoneCallback done) {
+  if (output_data == nullptr || inputs.empty()) {
+    LOG(ERROR) << "DynamicBatcher requires non-empty inputs and a non-null "
+                  "output pointer.";
+    return false;
+  }
+  int rows = -1;
+  for (const auto &t : inputs) {
+    const int bytes = DtypeBytes(t.dtype);
+    if (bytes < 0) {
+      LOG(ERROR) << "Input " << t.name
+                 << " has a data type the batcher cannot concatenate.";
+      return false;
+    }
+    if (!t.lod.empty()) {
+      LOG(ERROR) << "Input " << t.name
+                 << " carries LoD information, which cannot be batched.";
+      return false;
+    }
+    if (!input_names_.empty() && input_names_.count(t.name) == 0) {
+      LOG(ERROR) << "Input " << t.name << " is not an input of the model.";
+      return false;
+    }
+    if (t.shape.empty() || t.shape[0] <= 0) {
+      LOG(ERROR) << "Input " << t.name
+                 << " needs a positive leading batch dimension.";
+      return false;
+    }
+    int64_t numel = 1;
+    for (int d : t.shape) {
+      if (d <= 0) {
+        LOG(ERROR) << "Input " << t.name << " has a non-positive dimension.";
+        return false;
+      }
+      numel *= d;
+    }
+    if (static_cast<int64_t>(t.data.length()) != numel * bytes) {
+      LOG(ERROR) << "Input " << t.name << " holds " << t.data.length()
+                 << " bytes but its shape implies " << numel * bytes << ".";
+      return false;
+    }
+    if (rows == -1) {
+      rows = t.shape[0];
+    } else if (rows != t.shape[0]) {
+      LOG(ERROR) << "All inputs of one request must share the same batch "
+                    "dimension; got "
+                 << rows << " and " << t.shape[0] << ".";
+      return false;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) {
+      LOG(ERROR) << "Enqueue called on a DynamicBatcher that is shutting "
+                    "down.";
+      return false;
+    }
+    queue_.push_back(
+        Request{std::move(inputs), output_data, std::move(done), rows});
+  }
+  cv_.notify_one();
+  return true;
+}
+
+bool DynamicBatcher::Run(std::vector<PaddleTensor> inputs,
+                         std::vector<PaddleTensor> *output_data) {
+  std::promise<bool> done;
+  auto result = done.get_future();
+  if (!Enqueue(std::move(inputs), output_data, [&done](bool ok) {
+        done.set_value(ok);
+      })) {
+    return false;
+  }
+  return result.get();
+}
+
+bool DynamicBatcher::Compatible(const Request &a, const Request &b) {
+  if (a.inputs.size() != b.inputs.size()) return false;
+  for (size_t i = 0; i < a.inputs.size(); ++i) {
+    const auto &x = a.inputs[i];
+    const auto &y = b.inputs[i];
+    if (x.name != y.name || x.dtype != y.dtype ||
+        x.shape.size() != y.shape.size()) {
+      return false;
+    }
+    // Everything but the batch dimension has to line up for the
+    // concatenation along dim 0 to be well formed.
+    for (size_t d = 1; d < x.shape.size(); ++d) {
+      if (x.shape[d] != y.shape[d]) return false;
+    }
+  }
+  return true;
+}
+
+void DynamicBatcher::EngineLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (queue_.empty()) break;  // Stopped and drained.
+    std::vector<Request> batch;
+    batch.push_back(std::move(queue_.front()));
+    queue_.pop_front();
+    int rows = batch.front().rows;
+    const auto deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::microseconds(options_.batch_deadline_us);
+    for (;;) {
+      // Pull every queued request that can join this batch; incompatible
+      // ones stay put, in order, and seed later batches.
+      for (auto it = queue_.begin();
+           it != queue_.end() && rows < options_.max_batch_rows;) {
+        if (Compatible(batch.front(), *it)) {
+          rows += it->rows;
+          batch.push_back(std::move(*it));
+          it = queue_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      if (stop_ || rows >= options_.max_batch_rows) break;
+      if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) break;
+    }
+    lock.unlock();
+    ExecuteBatch(&batch);
+    lock.lock();
+  }
+}
+
+void DynamicBatcher::ExecuteBatch(std::vector<Request> *batch) {
+  bool ok = false;
+  try {
+    ok = [&]() -> bool {
+      int total_rows = 0;
+      for (const auto &r : *batch) total_rows += r.rows;
+      const Request &proto = batch->front();
+
+      // Gather: one staging buffer per input, written straight into the
+      // predictor's workspace through the zero-copy tensor.
+      std::vector<char> staging;
+      for (size_t i = 0; i < proto.inputs.size(); ++i) {
+        const auto &pt = proto.inputs[i];
+        std::vector<int> shape = pt.shape;
+        shape[0] = total_rows;
+        const int64_t row_bytes = RowBytes(pt.shape, pt.dtype);
+        staging.resize(row_bytes * total_rows);
+        int64_t offset = 0;
+        for (const auto &r : *batch) {
+          std::memcpy(staging.data() + offset,
+                      r.inputs[i].data.data(),
+                      r.rows * row_bytes);
+          offset += r.rows * row_bytes;
+        }
+        auto tensor = predictor_->GetInputTensor(pt.name);
+        if (tensor == nullptr) {
+          LOG(ERROR) << "Predictor does not expose input tensor " << pt.name
+                     << "; was SwitchUseFeedFetchOp(false) set?";
+          return false;
+        }
+        tensor->Reshape(shape);
+        CopyFromCpuBytes(tensor.get(), pt.dtype, staging.data());
+      }
+
+      if (!predictor_->ZeroCopyRun()) {
+        LOG(ERROR) << "Batched ZeroCopyRun failed.";
+        return false;
+      }
+
+      // Scatter: hand each request its own rows of every output.
+      for (auto &r : *batch) {
+        r.outputs->clear();
+        r.outputs->reserve(output_names_.size());
+      }
+      for (const auto &name : output_names_) {
+        auto tensor = predictor_->GetOutputTensor(name);
+        if (tensor == nullptr) {
+          LOG(ERROR) << "Predictor does not expose output tensor " << name
+                     << ".";
+          return false;
+        }
+        const auto shape = tensor->shape();
+        const PaddleDType dtype = tensor->type();
+        if (shape.empty() || shape[0] != total_rows || DtypeBytes(dtype) < 0) {
+          LOG(ERROR) << "Output " << name
+                     << " cannot be scattered: its leading dimension must "
+                        "match the batched row count.";
+          return false;
+        }
+        const int64_t row_bytes = RowBytes(shape, dtype);
+        // Host-resident outputs are sliced in place; device-resident ones
+        // are staged through one copy_to_cpu for the whole batch.
+        std::vector<char> out_staging;
+        const char *src = TryHostData(tensor.get(), dtype);
+        if (src == nullptr) {
+          out_staging.resize(row_bytes * total_rows);
+          CopyToCpuBytes(tensor.get(), dtype, out_staging.data());
+          src = out_staging.data();
+        }
+        int64_t offset = 0;
+        for (auto &r : *batch) {
+          PaddleTensor out;
+          out.name = name;
+          out.dtype = dtype;
+          out.shape = shape;
+          out.shape[0] = r.rows;
+          out.data.Resize(r.rows * row_bytes);
+          std::memcpy(out.data.data(), src + offset, r.rows * row_bytes);
+          offset += r.rows * row_bytes;
+          r.outputs->push_back(std::move(out));
+        }
+      }
+      return true;
+    }();
+  } catch (const std::exception &e) {
+    LOG(ERROR) << "DynamicBatcher batch execution failed: " << e.what();
+    ok = false;
+  }
+  for (auto &r : *batch) {
+    if (r.done) r.done(ok);
+  }
+}
+
+}  // namespace paddle
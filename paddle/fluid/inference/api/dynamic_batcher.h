@@ -0,0 +1,139 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "paddle_api.h"  // NOLINT
+
+namespace paddle {
+
+///
+/// \brief Coalesces concurrent inference requests into batched executions.
+///
+/// Several logical requests enqueue into one shared DynamicBatcher. A
+/// background engine groups requests whose inputs agree on dtype and on every
+/// dimension except the batch dimension (dim 0), waits up to a configurable
+/// deadline for more work to arrive, concatenates the group along dim 0,
+/// executes the predictor once through the zero-copy tensor path, and
+/// scatters each request's output rows back to its caller.
+///
+/// The wrapped predictor must have been created with
+/// AnalysisConfig::SwitchUseFeedFetchOp(false) so that
+/// GetInputTensor/GetOutputTensor/ZeroCopyRun are available. The batcher owns
+/// all access to the predictor; do not call Run or ZeroCopyRun on it directly
+/// while a batcher wraps it.
+///
+/// Inputs must be dense host tensors whose leading dimension is the batch
+/// dimension; tensors carrying LoD information are rejected at Enqueue.
+///
+class PD_INFER_DECL DynamicBatcher {
+ public:
+  /// \brief Invoked once a request's outputs have been filled (or the
+  /// batched execution failed). Runs on the engine thread, so keep it cheap
+  /// and do not re-enter the batcher's blocking Run from it.
+  using DoneCallback = std::function<void(bool)>;
+
+  /// \brief Tuning knobs for the batching engine.
+  struct Options {
+    /// Stop growing a batch once it holds this many rows along dim 0.
+    int max_batch_rows{64};
+    /// How long the engine waits for additional compatible requests after
+    /// the first one of a batch arrives, in microseconds.
+    int batch_deadline_us{200};
+  };
+
+  ///
+  /// \brief Construct the batcher and start its engine thread.
+  ///
+  /// \param[in] predictor the shared predictor all requests execute on
+  /// \param[in] options batching deadline and size limits
+  ///
+  explicit DynamicBatcher(std::shared_ptr<PaddlePredictor> predictor,
+                          Options options = Options());
+
+  /// \brief Drains all pending requests, then stops the engine thread.
+  ~DynamicBatcher();
+
+  DynamicBatcher(const DynamicBatcher &) = delete;
+  DynamicBatcher &operator=(const DynamicBatcher &) = delete;
+
+  ///
+  /// \brief Submit one logical request and return immediately.
+  ///
+  /// All inputs of a request must share the same dim 0 extent (its row
+  /// count). inputs are moved into the engine; output_data must stay valid
+  /// until done fires.
+  ///
+  /// \param[in] inputs one tensor per model input, identified by name
+  /// \param[out] output_data filled with this request's rows of each output
+  /// \param[in] done invoked with the execution's success flag
+  /// \return Whether the request passed validation and was queued
+  ///
+  bool Enqueue(std::vector<PaddleTensor> inputs,
+               std::vector<PaddleTensor> *output_data,
+               DoneCallback done);
+
+  ///
+  /// \brief Blocking convenience wrapper around Enqueue.
+  ///
+  /// The calling thread sleeps until the request's batch has executed; other
+  /// threads' requests may share that execution.
+  ///
+  /// \return Whether the request was queued and its execution succeeded
+  ///
+  bool Run(std::vector<PaddleTensor> inputs,
+           std::vector<PaddleTensor> *output_data);
+
+ private:
+  struct Request {
+    std::vector<PaddleTensor> inputs;
+    std::vector<PaddleTensor> *outputs;
+    DoneCallback done;
+    int rows;
+  };
+
+  /// \brief Body of the engine thread: form batches and execute them until
+  /// stopped and drained.
+  void EngineLoop();
+
+  /// \brief Whether two requests may share one batched execution.
+  static bool Compatible(const Request &a, const Request &b);
+
+  /// \brief Gather a batch into the predictor, run it once, and scatter the
+  /// outputs. Invokes every request's callback exactly once.
+  void ExecuteBatch(std::vector<Request> *batch);
+
+  std::shared_ptr<PaddlePredictor> predictor_;
+  Options options_;
+  std::unordered_set<std::string> input_names_;
+  std::vector<std::string> output_names_;
+
+  std::thread engine_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Request> queue_;
+  bool stop_{false};
+};
+
+}  // namespace paddle
@@ -0,0 +1,204 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/inference/api/kv_cache_manager.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle {
+
+namespace {
+
+int BlocksFor(int64_t tokens, int block_size) {
+  return static_cast<int>((tokens + block_size - 1) / block_size);
+}
+
+}  // namespace
+
+KVCacheManager::KVCacheManager(Options options) : options_(options) {
+  PADDLE_ENFORCE_GT(options_.block_size,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "KVCacheManager requires a positive block_size, got "
+                        "%d.",
+                        options_.block_size));
+  PADDLE_ENFORCE_GT(options_.max_block_num,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "KVCacheManager requires a positive max_block_num, "
+                        "got %d.",
+                        options_.max_block_num));
+  PADDLE_ENFORCE_GT(options_.max_blocks_per_seq,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "KVCacheManager requires a positive "
+                        "max_blocks_per_seq, got %d.",
+                        options_.max_blocks_per_seq));
+  free_blocks_.reserve(options_.max_block_num);
+  // Hand out low block ids first so short-lived workloads stay in the front
+  // of the pool tensor.
+  for (int i = options_.max_block_num - 1; i >= 0; --i) {
+    free_blocks_.push_back(i);
+  }
+}
+
+void KVCacheManager::SetEvictionHook(EvictionCallback hook) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  eviction_hook_ = std::move(hook);
+}
+
+bool KVCacheManager::ReserveBlocks(int count) {
+  while (static_cast<int>(free_blocks_.size()) < count) {
+    if (!eviction_hook_ || lru_.empty()) {
+      return false;
+    }
+    int64_t victim = lru_.front();
+    auto it = sequences_.find(victim);
+    eviction_hook_(victim);
+    lru_.pop_front();
+    for (int32_t block : it->second.blocks) {
+      free_blocks_.push_back(block);
+    }
+    sequences_.erase(it);
+  }
+  return true;
+}
+
+void KVCacheManager::Touch(Sequence *seq, int64_t seq_id) {
+  lru_.erase(seq->lru_pos);
+  seq->lru_pos = lru_.insert(lru_.end(), seq_id);
+}
+
+int64_t KVCacheManager::AddSequence(int prompt_len) {
+  PADDLE_ENFORCE_GE(prompt_len,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "prompt_len must be non-negative, got %d.",
+                        prompt_len));
+  int blocks = BlocksFor(prompt_len, options_.block_size);
+  if (blocks > options_.max_blocks_per_seq) {
+    return -1;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!ReserveBlocks(blocks)) {
+    return -1;
+  }
+  int64_t seq_id = next_seq_id_++;
+  Sequence seq;
+  seq.length = prompt_len;
+  seq.blocks.reserve(blocks);
+  for (int i = 0; i < blocks; ++i) {
+    seq.blocks.push_back(free_blocks_.back());
+    free_blocks_.pop_back();
+  }
+  seq.lru_pos = lru_.insert(lru_.end(), seq_id);
+  sequences_.emplace(seq_id, std::move(seq));
+  return seq_id;
+}
+
+bool KVCacheManager::Append(int64_t seq_id, int num_tokens) {
+  PADDLE_ENFORCE_GT(num_tokens,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "num_tokens must be positive, got %d.", num_tokens));
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sequences_.find(seq_id);
+  if (it == sequences_.end()) {
+    return false;
+  }
+  Sequence &seq = it->second;
+  int64_t new_length = seq.length + num_tokens;
+  int needed = BlocksFor(new_length, options_.block_size) -
+               static_cast<int>(seq.blocks.size());
+  if (static_cast<int>(seq.blocks.size()) + needed >
+      options_.max_blocks_per_seq) {
+    return false;
+  }
+  if (needed > 0) {
+    // The sequence being grown must never be its own eviction victim; pin it
+    // by pulling it out of the LRU list while reserving.
+    lru_.erase(seq.lru_pos);
+    bool reserved = ReserveBlocks(needed);
+    seq.lru_pos = lru_.insert(lru_.end(), seq_id);
+    if (!reserved) {
+      return false;
+    }
+    for (int i = 0; i < needed; ++i) {
+      seq.blocks.push_back(free_blocks_.back());
+      free_blocks_.pop_back();
+    }
+  } else {
+    Touch(&seq, seq_id);
+  }
+  seq.length = new_length;
+  return true;
+}
+
+void KVCacheManager::RemoveSequence(int64_t seq_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sequences_.find(seq_id);
+  if (it == sequences_.end()) {
+    return;
+  }
+  lru_.erase(it->second.lru_pos);
+  for (int32_t block : it->second.blocks) {
+    free_blocks_.push_back(block);
+  }
+  sequences_.erase(it);
+}
+
+void KVCacheManager::WriteBlockTables(const std::vector<int64_t> &seq_ids,
+                                      ZeroCopyTensor *block_tables) {
+  PADDLE_ENFORCE_NOT_NULL(
+      block_tables,
+      platform::errors::InvalidArgument(
+          "block_tables tensor passed to KVCacheManager is null."));
+  std::vector<int32_t> table(seq_ids.size() * options_.max_blocks_per_seq, -1);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t row = 0; row < seq_ids.size(); ++row) {
+      auto it = sequences_.find(seq_ids[row]);
+      PADDLE_ENFORCE_NE(
+          it,
+          sequences_.end(),
+          platform::errors::NotFound(
+              "Sequence %ld is not live in the KVCacheManager; it was "
+              "never admitted, or it has been removed or evicted.",
+              seq_ids[row]));
+      const auto &blocks = it->second.blocks;
+      std::copy(blocks.begin(),
+                blocks.end(),
+                table.begin() + row * options_.max_blocks_per_seq);
+    }
+  }
+  block_tables->Reshape({static_cast<int>(seq_ids.size()),
+                         options_.max_blocks_per_seq});
+  block_tables->copy_from_cpu(table.data());
+}
+
+int64_t KVCacheManager::SequenceLength(int64_t seq_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sequences_.find(seq_id);
+  return it == sequences_.end() ? -1 : it->second.length;
+}
+
+int KVCacheManager::num_free_blocks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(free_blocks_.size());
+}
+
+}  // namespace paddle
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "paddle_api.h"  // NOLINT
+
+namespace paddle {
+
+///
+/// \brief Block-table bookkeeping for paged KV caches.
+///
+/// The fused block_multihead_attention kernel addresses its key/value caches
+/// as a pool of fixed-size blocks: the cache tensors are shaped
+/// [max_block_num, kv_num_head, block_size, dim_head] and each sequence reads
+/// and writes through a row of the int32 block_tables input. The pool tensor
+/// itself is allocated once by the model; what every serving loop has to
+/// reinvent is the bookkeeping on top of it. KVCacheManager owns that
+/// bookkeeping: a free list over the block-id space, a block table per live
+/// sequence, copy-free append (growing a sequence claims a free block id, no
+/// cache data ever moves), and LRU eviction with a caller hook when the pool
+/// runs dry.
+///
+/// The manager is host-side only and holds no device memory. All methods are
+/// thread-safe; the eviction hook runs under the manager's lock, so it must
+/// not call back into the manager.
+///
+class PD_INFER_DECL KVCacheManager {
+ public:
+  /// \brief Invoked just before a sequence's blocks are reclaimed by
+  /// eviction, so the caller can offload its cache or mark it for recompute.
+  using EvictionCallback = std::function<void(int64_t seq_id)>;
+
+  /// \brief Pool geometry; must match the cache tensors fed to the model.
+  struct Options {
+    /// Tokens per cache block (the block_size attribute of
+    /// block_multihead_attention).
+    int block_size{64};
+    /// Total blocks in the pool (dim 0 of the key/value cache tensors).
+    int max_block_num{0};
+    /// Width of one block-table row, i.e. the longest sequence in blocks.
+    int max_blocks_per_seq{0};
+  };
+
+  explicit KVCacheManager(Options options);
+
+  KVCacheManager(const KVCacheManager &) = delete;
+  KVCacheManager &operator=(const KVCacheManager &) = delete;
+
+  /// \brief Register the hook consulted before an LRU sequence is evicted.
+  /// Without a hook no eviction happens and allocation simply fails.
+  void SetEvictionHook(EvictionCallback hook);
+
+  ///
+  /// \brief Admit a new sequence and reserve blocks for its prompt.
+  ///
+  /// \param[in] prompt_len number of tokens already decided for the sequence
+  /// \return a fresh sequence id, or -1 if the pool cannot hold the prompt
+  ///         even after eviction
+  ///
+  int64_t AddSequence(int prompt_len);
+
+  ///
+  /// \brief Extend a sequence by num_tokens freshly generated tokens.
+  ///
+  /// Appending is copy-free: cache data written by the attention kernel
+  /// stays where it is, and only when the sequence crosses a block boundary
+  /// is a new block id claimed from the free list (evicting if necessary).
+  ///
+  /// \return Whether the required blocks could be reserved
+  ///
+  bool Append(int64_t seq_id, int num_tokens = 1);
+
+  /// \brief Release a finished sequence and return its blocks to the pool.
+  void RemoveSequence(int64_t seq_id);
+
+  ///
+  /// \brief Fill the model's block_tables input for one step.
+  ///
+  /// Writes a [seq_ids.size(), max_blocks_per_seq] int32 buffer, one row per
+  /// requested sequence in the given order with unused slots set to -1, and
+  /// copies it into the tensor. Every id must name a live sequence.
+  ///
+  void WriteBlockTables(const std::vector<int64_t> &seq_ids,
+                        ZeroCopyTensor *block_tables);
+
+  /// \brief Current length of a live sequence in tokens, or -1 if unknown
+  /// (never admitted, removed, or evicted).
+  int64_t SequenceLength(int64_t seq_id) const;
+
+  /// \brief Blocks currently available in the pool.
+  int num_free_blocks() const;
+
+ private:
+  struct Sequence {
+    std::vector<int32_t> blocks;
+    int64_t length{0};
+    /// Position in lru_, most recently touched sequences at the back.
+    std::list<int64_t>::iterator lru_pos;
+  };
+
+  /// \brief Ensure at least count blocks are free, evicting LRU sequences
+  /// through the hook if one is installed. Caller holds mutex_.
+  bool ReserveBlocks(int count);
+
+  /// \brief Move seq_id to the most-recently-used end. Caller holds mutex_.
+  void Touch(Sequence *seq, int64_t seq_id);
+
+  Options options_;
+  EvictionCallback eviction_hook_;
+
+  mutable std::mutex mutex_;
+  std::vector<int32_t> free_blocks_;
+  std::unordered_map<int64_t, Sequence> sequences_;
+  /// Eviction order; front is the least recently appended sequence.
+  std::list<int64_t> lru_;
+  int64_t next_seq_id_{0};
+};
+
+}  // namespace paddle
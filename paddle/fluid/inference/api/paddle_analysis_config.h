@@ -1054,6 +1054,46 @@ struct PD_INFER_DECL AnalysisConfig {
   ///
   bool model_from_memory() const { return model_from_memory_; }
 
+  ///
+  /// \brief Map the combined parameters file into memory instead of reading
+  /// it into a host buffer before loading. Pages are faulted in on demand
+  /// while each parameter is uploaded to the device, and the OS shares them
+  /// between predictors that map the same file, so cold start is dominated
+  /// by the actual transfers instead of a full sequential file read.
+  /// Only takes effect when a combined parameters file is used; ignored on
+  /// platforms without mmap support.
+  ///
+  /// \param x Whether to load parameters through mmap.
+  ///
+  void EnableMmapParams(bool x = true);
+  ///
+  /// \brief A boolean state telling whether the parameter file is
+  /// memory-mapped at load time.
+  ///
+  /// \return bool Whether parameters are loaded through mmap.
+  ///
+  bool mmap_params_enabled() const { return use_mmap_params_; }
+
+  ///
+  /// \brief Overlap host/device transfers with computation through a
+  /// dedicated io stream. The predictor creates its own copy stream plus
+  /// events; uploads issued on that stream (see
+  /// experimental::InternalUtils::CopyFromCpuWithIoStream) are ordered
+  /// before the graph with a stream wait instead of a host sync, and
+  /// downloads issued on it are ordered after the graph the same way, so
+  /// one request's transfers can proceed while another's kernels execute.
+  /// Only takes effect for GPU predictors driven through ZeroCopyRun.
+  ///
+  /// \param x Whether to create the io stream and event ordering.
+  ///
+  void EnablePipelinedIO(bool x = true);
+  ///
+  /// \brief A boolean state telling whether pipelined io is enabled.
+  ///
+  /// \return bool Whether pipelined io is enabled.
+  ///
+  bool pipelined_io_enabled() const { return use_pipelined_io_; }
+
   ///
   /// \brief Turn on memory optimize
   /// NOTE still in development.
@@ -1302,6 +1342,8 @@ struct PD_INFER_DECL AnalysisConfig {
   std::unordered_set<std::string> mkldnn_enabled_op_types_;
 
   bool model_from_memory_{false};
+  bool use_mmap_params_{false};
+  bool use_pipelined_io_{false};
 
   bool enable_ir_optim_{true};
   bool ir_debug_{false};
@@ -23,6 +23,7 @@
  */
 
 #include <cassert>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -233,6 +234,34 @@ class PD_INFER_DECL PaddlePredictor {
     return false;
   }
 
+  /// \brief Signature of the completion callback passed to RunAsync.
+  /// The bool argument reports whether the run succeeded.
+  using RunCallback = std::function<void(bool)>;
+
+  /// \brief Asynchronous counterpart of Run.
+  /// The call returns as soon as the request is enqueued; the callback is
+  /// invoked once the network has finished executing and output_data is ready.
+  /// Both inputs (copied internally) and output_data must stay valid until the
+  /// callback fires. The callback runs on an internal thread, so it must not
+  /// call back into the same predictor and should be cheap; hand heavy work
+  /// off to the caller's own threads. Requests enqueued on one predictor are
+  /// executed in FIFO order. The default implementation simply runs
+  /// synchronously and then invokes the callback.
+  /// \param[in] inputs An list of PaddleTensor as the input to the network.
+  /// \param[out] output_data Pointer to the tensor list, which holds the output
+  /// paddletensor
+  /// \param[in] callback Invoked with the run's success flag on completion.
+  /// \param[in] batch_size This setting has been discarded and can be ignored.
+  /// \return Whether the request was accepted for execution.
+  virtual bool RunAsync(const std::vector<PaddleTensor>& inputs,
+                        std::vector<PaddleTensor>* output_data,
+                        RunCallback callback,
+                        int batch_size = -1) {
+    bool ok = Run(inputs, output_data, batch_size);
+    if (callback) callback(ok);
+    return true;
+  }
+
   /// \brief  Used to get the name of the network input.
   /// Be inherited by AnalysisPredictor, Only used in ZeroCopy scenarios.
   /// \return Input tensor names.
@@ -129,6 +129,15 @@ class PD_INFER_DECL Tensor {
                          PlaceType place,
                          DataLayout layout = DataLayout::kNCHW);
 
+  /// \brief Share another tensor's data with this tensor, wherever it lives.
+  /// It's usually used to chain predictors on one device: pass a producing
+  /// predictor's output handle as a consuming predictor's input and the data
+  /// stays device-resident, with no device-to-host copy in between. The
+  /// source buffer must remain valid until the consuming predictor has run,
+  /// so do not rerun the producing predictor before that.
+  /// \param src The tensor whose data this tensor will share.
+  void ShareExternalData(const Tensor& src);
+
   /// \brief Experimental interface.
   /// It's usually used to set the input tensor data with Strings data type.
   /// \param data The pointer of the data, from which the tensor will copy.
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/inference/api/token_stream.h"
+
+#include <thread>
+#include <utility>
+
+#include "paddle/phi/api/include/tensor.h"
+
+namespace paddle {
+
+TokenStream::TokenStream(size_t capacity)
+    : ring_(new paddle::Tensor[capacity == 0 ? 1 : capacity]),
+      capacity_(capacity == 0 ? 1 : capacity) {}
+
+TokenStream::~TokenStream() = default;
+
+bool TokenStream::Push(paddle::Tensor step) {
+  size_t tail = tail_.load(std::memory_order_relaxed);
+  while (tail - head_.load(std::memory_order_acquire) == capacity_) {
+    if (closed_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+  ring_[tail % capacity_] = std::move(step);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool TokenStream::WaitAndPop(paddle::Tensor *step) {
+  size_t head = head_.load(std::memory_order_relaxed);
+  while (head == tail_.load(std::memory_order_acquire)) {
+    if (closed_.load(std::memory_order_acquire) &&
+        head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+  *step = std::move(ring_[head % capacity_]);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool TokenStream::TryPop(paddle::Tensor *step) {
+  size_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  *step = std::move(ring_[head % capacity_]);
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+void TokenStream::Close() { closed_.store(true, std::memory_order_release); }
+
+bool TokenStream::closed() const {
+  return closed_.load(std::memory_order_acquire);
+}
+
+}  // namespace paddle
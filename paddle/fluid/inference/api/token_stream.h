@@ -0,0 +1,83 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "paddle_tensor.h"  // NOLINT
+
+namespace paddle {
+
+///
+/// \brief Single-producer single-consumer stream of per-step outputs.
+///
+/// Carries partial results out of a running generation graph: the predictor
+/// pushes a host snapshot of the watched variable every time the graph
+/// produces it, and the caller pops from another thread as soon as each step
+/// lands, instead of waiting for the whole output tensor. Time-to-first-token
+/// then no longer equals time-to-last-token.
+///
+/// The queue is a lock-free ring buffer: the producing (Run) thread and one
+/// consuming thread synchronize through atomics only. A full ring makes the
+/// producer yield until the consumer catches up, so no step is ever dropped.
+/// Close marks the end of generation; WaitAndPop returns false once the
+/// stream is closed and drained.
+///
+class PD_INFER_DECL TokenStream {
+ public:
+  /// \param[in] capacity ring size in steps; sized generously by default so
+  /// the producer never stalls on a briefly slow consumer
+  explicit TokenStream(size_t capacity = 8192);
+  ~TokenStream();
+
+  TokenStream(const TokenStream &) = delete;
+  TokenStream &operator=(const TokenStream &) = delete;
+
+  ///
+  /// \brief Producer side: append one step's snapshot.
+  ///
+  /// Yields while the ring is full. \return false if the stream was closed
+  /// before the step could be queued.
+  ///
+  bool Push(paddle::Tensor step);
+
+  ///
+  /// \brief Consumer side: pop the next step, waiting for one to arrive.
+  ///
+  /// \return false once the stream is closed and no steps remain
+  ///
+  bool WaitAndPop(paddle::Tensor *step);
+
+  /// \brief Consumer side: pop the next step if one is ready.
+  /// \return Whether a step was popped
+  bool TryPop(paddle::Tensor *step);
+
+  /// \brief Mark the end of the stream; pending steps stay poppable.
+  void Close();
+
+  /// \brief Whether Close has been called.
+  bool closed() const;
+
+ private:
+  std::unique_ptr<paddle::Tensor[]> ring_;
+  size_t capacity_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<bool> closed_{false};
+};
+
+}  // namespace paddle
@@ -22,6 +22,13 @@ namespace paddle::jit {
 
 std::shared_ptr<BaseEngine> CompilationUnit::GetEngine(
     const std::string &name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto creator_iter = engine_creators_.find(name);
+  if (creator_iter != engine_creators_.end()) {
+    VLOG(3) << "Create deferred engine for function: " << name;
+    engine_map_[name] = creator_iter->second();
+    engine_creators_.erase(creator_iter);
+  }
   PADDLE_ENFORCE_EQ(
       engine_map_.count(name),
       1,
@@ -32,12 +39,34 @@ std::shared_ptr<BaseEngine> CompilationUnit::GetEngine(
 
 void CompilationUnit::SetEngine(const std::string &name,
                                 const std::shared_ptr<BaseEngine> &engine) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  engine_creators_.erase(name);
   engine_map_[name] = engine;
 }
 
-const jit::EngineMap &CompilationUnit::EngineMap() const { return engine_map_; }
+void CompilationUnit::SetEngineCreator(const std::string &name,
+                                       const EngineCreator &creator) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  engine_map_.erase(name);
+  engine_creators_[name] = creator;
+}
+
+void CompilationUnit::MaterializeAllEngines() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &it : engine_creators_) {
+    VLOG(3) << "Create deferred engine for function: " << it.first;
+    engine_map_[it.first] = it.second();
+  }
+  engine_creators_.clear();
+}
+
+const jit::EngineMap &CompilationUnit::EngineMap() const {
+  MaterializeAllEngines();
+  return engine_map_;
+}
 
 std::shared_ptr<CompilationUnit> CompilationUnit::Clone(void *stream) {
+  MaterializeAllEngines();
   auto x = std::make_shared<CompilationUnit>();
   for (auto &it : engine_map_) {
     x->SetEngine(it.first, it.second->Clone(stream));
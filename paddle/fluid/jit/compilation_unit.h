@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>  // NOLINT
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -23,6 +25,7 @@ namespace paddle {
 namespace jit {
 class BaseEngine;
 using EngineMap = std::unordered_map<std::string, std::shared_ptr<BaseEngine>>;
+using EngineCreator = std::function<std::shared_ptr<BaseEngine>()>;
 
 class CompilationUnit {
  public:
@@ -34,12 +37,21 @@ class CompilationUnit {
   void SetEngine(const std::string &name,
                  const std::shared_ptr<BaseEngine> &engine);
 
+  // Registers a creator which is invoked the first time the engine is
+  // requested, so deserialization does not have to build every engine
+  // up front.
+  void SetEngineCreator(const std::string &name, const EngineCreator &creator);
+
   const jit::EngineMap &EngineMap() const;
 
   std::shared_ptr<CompilationUnit> Clone(void *stream = nullptr);
 
  private:
-  jit::EngineMap engine_map_;
+  void MaterializeAllEngines() const;
+
+  mutable jit::EngineMap engine_map_;
+  mutable std::unordered_map<std::string, EngineCreator> engine_creators_;
+  mutable std::mutex mutex_;
 };
 
 }  // namespace jit
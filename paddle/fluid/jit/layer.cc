@@ -58,6 +58,11 @@ void Layer::SetEngine(const std::string& name,
   unit_->SetEngine(name, engine);
 }
 
+void Layer::SetEngineCreator(const std::string& name,
+                             const EngineCreator& creator) {
+  unit_->SetEngineCreator(name, creator);
+}
+
 const std::shared_ptr<jit::FunctionInfo>& Layer::FunctionInfo(
     const std::string& name) const {
   PADDLE_ENFORCE_EQ(
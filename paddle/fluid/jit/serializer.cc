@@ -14,8 +14,13 @@
 
 #include "paddle/fluid/jit/serializer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>  // NOLINT
 #include <set>
+#include <thread>  // NOLINT
 
+#include "paddle/fluid/framework/lod_tensor.h"
 #include "paddle/fluid/framework/var_desc.h"
 #include "paddle/fluid/framework/variable.h"
 #include "paddle/fluid/platform/device_context.h"
@@ -38,25 +43,64 @@ using FunctionInfoMap =
 Layer Deserializer::operator()(const std::string& path,
                                const phi::Place& place) {
   const auto& pdmodel_paths = utils::PdmodelFilePaths(path);
-  // set is ordered
-  std::set<std::string> param_names_set;
-  FunctionInfoMap info_map;
-  for (auto& it : pdmodel_paths) {
-    auto& func_name = it.first;
-    auto program_desc = LoadProgram(it.second);
-
-    std::vector<std::string> persist_var_names;
-    auto all_var_desc = program_desc.Block(0).AllVars();
-    for (auto* desc_ptr : all_var_desc) {
-      if (utils::IsPersistable(desc_ptr)) {
-        persist_var_names.emplace_back(desc_ptr->Name());
+  std::vector<std::pair<std::string, std::string>> func_paths(
+      pdmodel_paths.begin(), pdmodel_paths.end());
+  // load the per function programs concurrently, a serving bundle may
+  // carry a dozen entry points
+  std::vector<std::shared_ptr<FunctionInfo>> infos(func_paths.size());
+  size_t thread_num = std::min<size_t>(
+      func_paths.size(), std::thread::hardware_concurrency());
+  std::atomic<size_t> next(0);
+  std::exception_ptr first_exception = nullptr;
+  std::mutex exception_mutex;
+  auto load_worker = [&]() {
+    for (size_t i = next++; i < func_paths.size(); i = next++) {
+      try {
+        auto& func_name = func_paths[i].first;
+        auto program_desc = LoadProgram(func_paths[i].second);
+
+        std::vector<std::string> persist_var_names;
+        auto all_var_desc = program_desc.Block(0).AllVars();
+        for (auto* desc_ptr : all_var_desc) {
+          if (utils::IsPersistable(desc_ptr)) {
+            persist_var_names.emplace_back(desc_ptr->Name());
+          }
+        }
+
+        infos[i] = std::make_shared<FunctionInfo>(
+            func_name, persist_var_names, program_desc);
+        infos[i]->SetProgramFilePath(func_paths[i].second);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!first_exception) {
+          first_exception = std::current_exception();
+        }
       }
     }
+  };
+  if (thread_num > 1) {
+    std::vector<std::thread> workers;
+    workers.reserve(thread_num);
+    for (size_t i = 0; i < thread_num; ++i) {
+      workers.emplace_back(load_worker);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  } else {
+    load_worker();
+  }
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
 
-    param_names_set.insert(persist_var_names.begin(), persist_var_names.end());
-    info_map[func_name] = std::make_shared<FunctionInfo>(
-        func_name, persist_var_names, program_desc);
-    info_map[func_name]->SetProgramFilePath(it.second);
+  // set is ordered
+  std::set<std::string> param_names_set;
+  FunctionInfoMap info_map;
+  for (auto& info : infos) {
+    param_names_set.insert(info->ParamNames().begin(),
+                           info->ParamNames().end());
+    info_map[info->FunctionName()] = info;
   }
 
   auto params_dict = std::make_shared<VariableMap>();
@@ -70,19 +114,22 @@ Layer Deserializer::operator()(const std::string& path,
 
   Layer layer = Layer(params_dict, attrs_dict, info_map, place);
 
+  // defer engine creation until the first call of each function
   for (auto& map_item : info_map) {
     const std::string& func_name = map_item.first;
-    auto& info = map_item.second;
+    auto info = map_item.second;
     VLOG(3) << "Add function type: " << FLAGS_jit_engine_type
             << " Function name: " << func_name;
     if (FLAGS_jit_engine_type == "New") {
-      layer.SetEngine(
-          func_name,
-          utils::MakeEngine<InterpreterEngine>(info, params_dict, place));
+      layer.SetEngineCreator(func_name, [info, params_dict, place]() {
+        return utils::MakeEngine<InterpreterEngine>(info, params_dict, place);
+      });
     } else if (FLAGS_jit_engine_type == "Predictor") {
-      layer.SetEngine(
-          info->FunctionName(),
-          utils::MakeEngine<PredictorEngine>(info, params_dict, place));
+      layer.SetEngineCreator(
+          info->FunctionName(), [info, params_dict, place]() {
+            return utils::MakeEngine<PredictorEngine>(
+                info, params_dict, place);
+          });
     } else {
       PD_THROW("Invalid JitLayer engine type.");
     }
@@ -98,16 +145,26 @@ void Deserializer::ReadTensorData(
     std::shared_ptr<VariableMap> params_dict) const {
   VLOG(3) << "ReadTensorData from: " << file_name;
   std::ifstream fin(file_name, std::ios::binary);
+  fin.seekg(0, std::ios::end);
+  std::vector<char> buffer(fin.tellg());
+  fin.seekg(0, std::ios::beg);
+  fin.read(buffer.data(), buffer.size());  // NOLINT
+  fin.close();
   platform::DeviceContextPool& pool = platform::DeviceContextPool::Instance();
   auto& dev_ctx = *pool.Get(place);
+  // records in the params file are sorted by name, same as the set, so
+  // they can be scanned once and deserialized concurrently
+  std::vector<DenseTensor*> dense_tensors;
+  dense_tensors.reserve(var_name.size());
   for (const auto& item : var_name) {
     VLOG(3) << "load Tensor: " << item;
-    Variable v;
+    auto v = std::make_shared<Variable>();
     // TODO(dev): Support framework::Vocab
-    DenseTensor* dense_tensor = v.GetMutable<DenseTensor>();
-    framework::DeserializeFromStream(fin, dense_tensor, dev_ctx);
-    (*params_dict)[item] = std::make_shared<Variable>(v);
+    dense_tensors.push_back(v->GetMutable<DenseTensor>());
+    (*params_dict)[item] = v;
   }
+  framework::DeserializeFromCombinedBuffer(
+      buffer.data(), buffer.size(), dense_tensors, dev_ctx);
 }
 
 void Deserializer::ReadAttributeData(
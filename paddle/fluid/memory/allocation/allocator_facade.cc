@@ -23,8 +23,10 @@
 #include "paddle/fluid/memory/allocation/auto_growth_best_fit_allocator_v2.h"
 #include "paddle/fluid/memory/allocation/cpu_allocator.h"
 #include "paddle/fluid/memory/allocation/naive_best_fit_allocator.h"
+#include "paddle/fluid/memory/allocation/numa_allocator.h"
 #include "paddle/fluid/memory/allocation/retry_allocator.h"
 #include "paddle/fluid/memory/allocation/stat_allocator.h"
+#include "paddle/fluid/memory/allocation/thread_cached_cpu_allocator.h"
 #include "paddle/fluid/platform/device_context.h"
 #include "paddle/fluid/platform/enforce.h"
 #include "paddle/fluid/platform/place.h"
@@ -88,6 +90,20 @@ PADDLE_DEFINE_EXPORTED_bool(
     "Whether to use system allocator to allocate CPU and GPU memory. "
     "Only used for unittests.");
 
+PADDLE_DEFINE_EXPORTED_bool(
+    use_thread_cached_cpu_allocator,
+    false,
+    "Whether to serve small (sub-4KB) host allocations from per-thread "
+    "size-class caches in front of the CPU allocator, avoiding any lock or "
+    "atomic on the hot path.");
+
+PADDLE_DEFINE_EXPORTED_bool(
+    use_numa_aware_cpu_allocator,
+    false,
+    "Whether to bind host allocations to the NUMA node of the allocating "
+    "thread (Linux only). Takes effect only on machines with more than one "
+    "NUMA node.");
+
 PADDLE_DEFINE_EXPORTED_bool(use_virtual_memory_auto_growth,
                             false,
                             "Use VirtualMemoryAutoGrowthBestFitAllocator.");
@@ -808,9 +824,19 @@ class AllocatorFacadePrivate {
     // NaiveBestFitAllocator instead.
     allocators_[phi::CPUPlace()] =
         std::make_shared<NaiveBestFitAllocator>(phi::CPUPlace());
+#elif defined(__linux__)
+    if (FLAGS_use_numa_aware_cpu_allocator && NUMAAllocator::NumNodes() > 1) {
+      allocators_[phi::CPUPlace()] = std::make_shared<NUMAAllocator>();
+    } else {
+      allocators_[phi::CPUPlace()] = std::make_shared<CPUAllocator>();
+    }
 #else
     allocators_[phi::CPUPlace()] = std::make_shared<CPUAllocator>();
 #endif
+    if (FLAGS_use_thread_cached_cpu_allocator) {
+      allocators_[phi::CPUPlace()] = std::make_shared<ThreadCachedCPUAllocator>(
+          allocators_[phi::CPUPlace()]);
+    }
   }
 
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
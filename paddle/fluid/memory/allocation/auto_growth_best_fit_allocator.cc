@@ -15,9 +15,11 @@
 #include "paddle/fluid/memory/allocation/auto_growth_best_fit_allocator.h"
 
 #include <algorithm>
+#include <fstream>
 #include <mutex>  // NOLINT
 #include <utility>
 
+#include "paddle/common/hot_counter.h"
 #include "paddle/fluid/memory/allocation/aligned_allocator.h"
 #include "paddle/fluid/platform/flags.h"
 #include "paddle/fluid/platform/profiler/event_tracing.h"
@@ -42,6 +44,22 @@ PADDLE_DEFINE_EXPORTED_READONLY_bool(
 PADDLE_DEFINE_EXPORTED_READONLY_bool(print_allocator_trace_info,
                                      false,
                                      "print trace memory info");
+
+PADDLE_DEFINE_EXPORTED_READONLY_bool(
+    auto_growth_thread_local_arena,
+    false,
+    "Whether to cache freed blocks in per-thread arenas so that repeated "
+    "same-size allocations on one thread (e.g. one thread per stream in "
+    "multi-stream serving) are satisfied without taking the shared pool "
+    "lock. Arena overflow falls back to the shared best-fit pool. This "
+    "flag only works when FLAGS_allocator_strategy=auto_growth.");
+
+PADDLE_DEFINE_EXPORTED_int64(
+    auto_growth_arena_max_cached_mb,
+    64,
+    "Maximum bytes (in MB) each per-thread arena may cache before its "
+    "blocks are flushed back to the shared best-fit pool. Only used when "
+    "FLAGS_auto_growth_thread_local_arena=true.");
 namespace paddle::memory::allocation {
 
 AutoGrowthBestFitAllocator::AutoGrowthBestFitAllocator(
@@ -73,10 +91,26 @@ phi::Allocation *AutoGrowthBestFitAllocator::AllocateImpl(
   VLOG(10) << "Allocate " << unaligned_size << " bytes, aligned to " << size
            << ", extra size " << extra_padding_size_;
 
+  if (FLAGS_auto_growth_thread_local_arena) {
+    auto *arena = GetArena();
+    std::lock_guard<SpinLock> arena_guard(arena->lock_);
+    auto it = arena->blocks_.find(size);
+    if (it != arena->blocks_.end()) {
+      BlockIt block_it = it->second;
+      arena->cached_bytes_ -= size;
+      arena->blocks_.erase(it);
+      VLOG(10) << "Alloc " << block_it->size_
+               << " bytes from thread arena, ptr = " << block_it->ptr_;
+      COMMON_HOT_COUNTER_INC("allocator.auto_growth.arena_hit");
+      return new BlockAllocation(block_it);
+    }
+  }
+
   std::lock_guard<SpinLock> guard(spinlock_);
   auto iter = free_blocks_.lower_bound(std::make_pair(size, nullptr));
   BlockIt block_it;
   if (iter != free_blocks_.end()) {
+    COMMON_HOT_COUNTER_INC("allocator.auto_growth.free_list_hit");
     block_it = iter->second;
     free_blocks_.erase(iter);
     auto *chunk = block_it->chunk_;
@@ -96,6 +130,7 @@ phi::Allocation *AutoGrowthBestFitAllocator::AllocateImpl(
       block_it->is_free_ = false;
     }
   } else {
+    COMMON_HOT_COUNTER_INC("allocator.auto_growth.realloc_chunk");
     if (FLAGS_free_when_no_cache_hit) {
       FreeIdleChunks();
     }
@@ -138,13 +173,41 @@ void AutoGrowthBestFitAllocator::FreeImpl(phi::Allocation *allocation) {
                                9 /*level*/);
   VLOG(10) << "Free " << allocation->size()
            << " bytes, ptr = " << allocation->ptr();
-  std::lock_guard<SpinLock> guard(spinlock_);
   auto block_it = static_cast<BlockAllocation *>(allocation)->block_it_;
-  auto &blocks = block_it->chunk_->blocks_;
+
+  if (FLAGS_auto_growth_thread_local_arena) {
+    auto *arena = GetArena();
+    std::lock_guard<SpinLock> arena_guard(arena->lock_);
+    arena->blocks_.emplace(block_it->size_, block_it);
+    arena->cached_bytes_ += block_it->size_;
+    if (arena->cached_bytes_ >
+        static_cast<size_t>(FLAGS_auto_growth_arena_max_cached_mb) << 20) {
+      std::lock_guard<SpinLock> guard(spinlock_);
+      FlushArenaUnlocked(arena);
+    }
+    delete allocation;
+    return;
+  }
+
+  std::lock_guard<SpinLock> guard(spinlock_);
 
   total_free_times_ += 1;
   total_free_size_ += block_it->size_;
 
+  FreeBlockUnlocked(block_it);
+
+  delete allocation;
+
+  if (FLAGS_free_idle_chunk) {
+    FreeIdleChunks();
+  }
+}
+
+// Coalesce the freed block with its free neighbours and return it to the
+// shared free-block pool. spinlock_ must be held by the caller.
+void AutoGrowthBestFitAllocator::FreeBlockUnlocked(BlockIt block_it) {
+  auto &blocks = block_it->chunk_->blocks_;
+
   block_it->is_free_ = true;
 
   if (block_it != blocks.begin()) {
@@ -170,12 +233,42 @@ void AutoGrowthBestFitAllocator::FreeImpl(phi::Allocation *allocation) {
 
   free_blocks_.emplace(std::make_pair(block_it->size_, block_it->ptr_),
                        block_it);
+}
 
-  delete allocation;
+AutoGrowthBestFitAllocator::Arena *AutoGrowthBestFitAllocator::GetArena() {
+  auto tid = std::this_thread::get_id();
+  std::lock_guard<SpinLock> guard(arenas_lock_);
+  auto &arena = arenas_[tid];
+  if (arena == nullptr) {
+    arena = std::make_unique<Arena>();
+  }
+  return arena.get();
+}
 
-  if (FLAGS_free_idle_chunk) {
-    FreeIdleChunks();
+// Return all blocks cached by an arena to the shared pool so that they can
+// coalesce with their neighbours. Both the arena lock and spinlock_ must be
+// held by the caller.
+void AutoGrowthBestFitAllocator::FlushArenaUnlocked(Arena *arena) {
+  for (auto &size_and_block : arena->blocks_) {
+    total_free_times_ += 1;
+    total_free_size_ += size_and_block.first;
+    FreeBlockUnlocked(size_and_block.second);
   }
+  arena->blocks_.clear();
+  arena->cached_bytes_ = 0;
+}
+
+uint64_t AutoGrowthBestFitAllocator::ReleaseImpl(const phi::Place &place) {
+  if (FLAGS_auto_growth_thread_local_arena) {
+    std::lock_guard<SpinLock> arenas_guard(arenas_lock_);
+    for (auto &tid_and_arena : arenas_) {
+      auto *arena = tid_and_arena.second.get();
+      std::lock_guard<SpinLock> arena_guard(arena->lock_);
+      std::lock_guard<SpinLock> guard(spinlock_);
+      FlushArenaUnlocked(arena);
+    }
+  }
+  return FreeIdleChunks();
 }
 
 uint64_t AutoGrowthBestFitAllocator::FreeIdleChunks() {
@@ -202,6 +295,52 @@ uint64_t AutoGrowthBestFitAllocator::FreeIdleChunks() {
   return bytes;
 }
 
+void AutoGrowthBestFitAllocator::SaveChunkLayout(const std::string &path) {
+  std::lock_guard<SpinLock> guard(spinlock_);
+  std::ofstream out(path, std::ios::trunc);
+  PADDLE_ENFORCE_EQ(out.is_open(),
+                    true,
+                    platform::errors::Unavailable(
+                        "Cannot open %s to save the chunk layout.", path));
+  for (auto &chunk : chunks_) {
+    out << chunk.allocation_->size() << "\n";
+  }
+  VLOG(2) << "Saved " << chunks_.size() << " chunk size(s) to " << path;
+}
+
+void AutoGrowthBestFitAllocator::RestoreChunkLayout(const std::string &path) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    VLOG(2) << "No chunk layout snapshot at " << path << ", skip pre-carving";
+    return;
+  }
+
+  std::lock_guard<SpinLock> guard(spinlock_);
+  size_t chunk_size = 0;
+  size_t num_chunks = 0;
+  while (in >> chunk_size) {
+    if (chunk_size == 0) {
+      continue;
+    }
+    try {
+      chunks_.emplace_back(static_unique_ptr_cast<Allocation>(
+          underlying_allocator_->Allocate(chunk_size)));
+    } catch (BadAlloc &) {
+      VLOG(1) << "Stop pre-carving after " << num_chunks
+              << " chunk(s): cannot allocate " << chunk_size << " more bytes";
+      break;
+    }
+    auto *chunk = &(*chunks_.rbegin());
+    size_t realized_size = chunk->allocation_->size();
+    uint8_t *p = reinterpret_cast<uint8_t *>(chunk->allocation_->ptr());
+    chunk->blocks_.emplace_back(p, realized_size, true, chunk);
+    free_blocks_.emplace(std::make_pair(realized_size, p),
+                         --(chunk->blocks_.end()));
+    ++num_chunks;
+  }
+  VLOG(2) << "Pre-carved " << num_chunks << " chunk(s) from " << path;
+}
+
 void AutoGrowthBestFitAllocator::Trace() const {
   size_t cur_idle_bytes = 0;
   auto it = free_blocks_.begin();
@@ -18,6 +18,9 @@
 #include <map>
 #include <memory>
 #include <mutex>  // NOLINT
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "paddle/fluid/memory/allocation/allocator.h"
@@ -37,20 +40,33 @@ class AutoGrowthBestFitAllocator : public Allocator {
 
   bool IsAllocThreadSafe() const override { return true; }
 
+  // Write the realized chunk layout (one chunk size per line) to `path`,
+  // and pre-carve the pool from such a snapshot at startup. A restarted
+  // job with the same model and shapes then begins with a steady-state
+  // pool instead of growing it chunk by chunk over the first few hundred
+  // steps. Restore stops quietly at the first chunk the device cannot
+  // accommodate.
+  void SaveChunkLayout(const std::string &path);
+  void RestoreChunkLayout(const std::string &path);
+
  protected:
   phi::Allocation *AllocateImpl(size_t size) override;
 
   void FreeImpl(phi::Allocation *allocation) override;
 
   // Release the memory block which is not used in pool.
-  uint64_t ReleaseImpl(const phi::Place &place) override {
-    return FreeIdleChunks();
-  }
+  uint64_t ReleaseImpl(const phi::Place &place) override;
 
  protected:
   uint64_t FreeIdleChunks();
   void Trace() const;
 
+  struct Arena;
+
+  Arena *GetArena();
+  void FlushArenaUnlocked(Arena *arena);
+  void FreeBlockUnlocked(BlockIt block_it);
+
   template <typename T>
   using List = std::list<T>;
 
@@ -87,6 +103,18 @@ class AutoGrowthBestFitAllocator : public Allocator {
 
   using BlockIt = List<Block>::iterator;
 
+  // A small per-thread cache of freed blocks indexed by exact aligned size.
+  // Each stream in a multi-stream serving job is driven by its own thread, so
+  // caching blocks on the freeing thread keeps stream-ordered reuse without
+  // touching the shared best-fit pool (and its lock) on the hot path. Blocks
+  // kept here stay marked busy in their chunk and are coalesced only when the
+  // arena is flushed back to the shared pool.
+  struct Arena {
+    SpinLock lock_;
+    std::multimap<size_t, BlockIt> blocks_;
+    size_t cached_bytes_{0};
+  };
+
   std::shared_ptr<Allocator> underlying_allocator_;
   std::map<std::pair<size_t, void *>, BlockIt> free_blocks_;
   std::list<Chunk> chunks_;
@@ -101,6 +129,11 @@ class AutoGrowthBestFitAllocator : public Allocator {
   size_t total_free_times_;
   size_t total_free_size_;
 
+  // Per-thread arenas, created lazily on first use. Only enabled when
+  // FLAGS_auto_growth_thread_local_arena is set.
+  std::unordered_map<std::thread::id, std::unique_ptr<Arena>> arenas_;
+  SpinLock arenas_lock_;
+
   SpinLock spinlock_;
 };
 
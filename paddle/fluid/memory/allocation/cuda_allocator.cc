@@ -25,6 +25,7 @@
 
 #include <string>
 
+#include "paddle/fluid/memory/stats.h"
 #include "paddle/fluid/platform/cuda_device_guard.h"
 #include "paddle/fluid/platform/device/gpu/gpu_info.h"
 #include "paddle/fluid/platform/enforce.h"
@@ -68,6 +69,13 @@ phi::Allocation* CUDAAllocator::AllocateImpl(size_t size) {
         limit_size);
   }
 
+  auto& attribution = MemoryAttributionTracker::GetInstance();
+  if (UNLIKELY(attribution.IsEnabled())) {
+    LOG(WARNING) << "Out of memory on GPU " << place_.device
+                 << ", peak memory attribution by op (bytes op):\n"
+                 << attribution.PeakReport();
+  }
+
   PADDLE_THROW_BAD_ALLOC(platform::errors::ResourceExhausted(
       "\n\nOut of memory error on GPU %d. "
       "Cannot allocate %s memory on GPU %d, %s memory has been allocated and "
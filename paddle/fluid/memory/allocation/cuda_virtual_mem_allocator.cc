@@ -134,15 +134,70 @@ void CUDAVirtualMemAllocator::FreeImpl(phi::Allocation* allocation) {
     cudaSetDevice(prev_id);
   }
 
+  // Keep the virtual range for reuse: the next allocation that fits will
+  // map fresh physical memory into this hole instead of advancing the bump
+  // offset, which is what keeps the reserved address space from fragmenting
+  // over long-running jobs with dynamic shapes.
+  InsertFreeVirtualRange(iter->first, iter->second.second);
+
   virtual_2_physical_map_.erase(iter);
 
   delete allocation;
 }
 
+CUdeviceptr CUDAVirtualMemAllocator::TryReuseFreeVirtualRange(size_t size) {
+  auto best_iter = free_va_ranges_.end();
+  for (auto iter = free_va_ranges_.begin(); iter != free_va_ranges_.end();
+       ++iter) {
+    if (iter->second >= size &&
+        (best_iter == free_va_ranges_.end() ||
+         iter->second < best_iter->second)) {
+      best_iter = iter;
+    }
+  }
+  if (best_iter == free_va_ranges_.end()) {
+    return 0;
+  }
+
+  CUdeviceptr ptr = best_iter->first;
+  size_t remaining = best_iter->second - size;
+  free_va_ranges_.erase(best_iter);
+  if (remaining > 0) {
+    free_va_ranges_.emplace(ptr + size, remaining);
+  }
+  VLOG(4) << "Reuse freed virtual range at " << reinterpret_cast<void*>(ptr)
+          << " of size " << size << ", remaining " << remaining;
+  return ptr;
+}
+
+void CUDAVirtualMemAllocator::InsertFreeVirtualRange(CUdeviceptr ptr,
+                                                     size_t size) {
+  auto next_iter = free_va_ranges_.lower_bound(ptr);
+  if (next_iter != free_va_ranges_.begin()) {
+    auto prev_iter = std::prev(next_iter);
+    if (prev_iter->first + prev_iter->second == ptr) {
+      ptr = prev_iter->first;
+      size += prev_iter->second;
+      free_va_ranges_.erase(prev_iter);
+    }
+  }
+  if (next_iter != free_va_ranges_.end() && ptr + size == next_iter->first) {
+    size += next_iter->second;
+    free_va_ranges_.erase(next_iter);
+  }
+  free_va_ranges_.emplace(ptr, size);
+}
+
 phi::Allocation* CUDAVirtualMemAllocator::AllocateImpl(size_t size) {
   size = AlignedSize(size, granularity_);
 
-  CUdeviceptr ptr = virtual_mem_base_ + virtual_mem_alloced_offset_;
+  bool reused_va_range = false;
+  CUdeviceptr ptr = TryReuseFreeVirtualRange(size);
+  if (ptr != 0) {
+    reused_va_range = true;
+  } else {
+    ptr = virtual_mem_base_ + virtual_mem_alloced_offset_;
+  }
 
   if (ptr + size > virtual_mem_base_ + virtual_mem_size_) {
     PADDLE_THROW_BAD_ALLOC(platform::errors::ResourceExhausted(
@@ -170,6 +225,9 @@ phi::Allocation* CUDAVirtualMemAllocator::AllocateImpl(size_t size) {
       platform::RecordedGpuMemCreate(&handle, size, &prop_, 0, place_.device);
 
   if (result != CUDA_SUCCESS) {
+    if (reused_va_range) {
+      InsertFreeVirtualRange(ptr, size);
+    }
     if (result == CUDA_ERROR_OUT_OF_MEMORY) {
       size_t actual_avail, actual_total;
       PADDLE_ENFORCE_GPU_SUCCESS(cudaMemGetInfo(&actual_avail, &actual_total));
@@ -201,6 +259,9 @@ phi::Allocation* CUDAVirtualMemAllocator::AllocateImpl(size_t size) {
   result = paddle::platform::dynload::cuMemMap(ptr, size, 0, handle, 0);
 
   if (result != CUDA_SUCCESS) {
+    if (reused_va_range) {
+      InsertFreeVirtualRange(ptr, size);
+    }
     platform::RecordedGpuMemRelease(handle, size, place_.device);
     PADDLE_ENFORCE_GPU_SUCCESS(result);
     return nullptr;
@@ -212,6 +273,9 @@ phi::Allocation* CUDAVirtualMemAllocator::AllocateImpl(size_t size) {
 
   if (result != CUDA_SUCCESS) {
     paddle::platform::dynload::cuMemUnmap(ptr, size);
+    if (reused_va_range) {
+      InsertFreeVirtualRange(ptr, size);
+    }
     platform::RecordedGpuMemRelease(handle, size, place_.device);
     PADDLE_ENFORCE_GPU_SUCCESS(result);
     return nullptr;
@@ -219,7 +283,9 @@ phi::Allocation* CUDAVirtualMemAllocator::AllocateImpl(size_t size) {
 
   virtual_2_physical_map_.emplace(ptr, std::make_pair(handle, size));
 
-  virtual_mem_alloced_offset_ += size;
+  if (!reused_va_range) {
+    virtual_mem_alloced_offset_ += size;
+  }
 
   return new Allocation(
       reinterpret_cast<void*>(ptr), size, platform::Place(place_));  // NOLINT
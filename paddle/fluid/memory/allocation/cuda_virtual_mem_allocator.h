@@ -43,6 +43,14 @@ class CUDAVirtualMemAllocator : public Allocator {
   phi::Allocation* AllocateImpl(size_t size) override;
 
  private:
+  // Try to place an allocation of `size` bytes into a previously freed
+  // virtual range; returns 0 if no hole fits. Defragmentation happens by
+  // remapping fresh physical chunks into these recycled holes instead of
+  // growing the bump offset, so long-running jobs with dynamic shapes do
+  // not exhaust the reserved address space.
+  CUdeviceptr TryReuseFreeVirtualRange(size_t size);
+  void InsertFreeVirtualRange(CUdeviceptr ptr, size_t size);
+
   phi::GPUPlace place_;
 
   CUdeviceptr virtual_mem_base_;
@@ -55,6 +63,11 @@ class CUDAVirtualMemAllocator : public Allocator {
 
   std::map<CUdeviceptr, std::pair<CUmemGenericAllocationHandle, size_t>>
       virtual_2_physical_map_;
+
+  // Freed virtual ranges keyed by base address, coalesced with their
+  // neighbours on insertion. There is at most one entry per hole of chunk
+  // granularity, so best-fit selection scans the map directly.
+  std::map<CUdeviceptr, size_t> free_va_ranges_;
 };
 
 }  // namespace allocation
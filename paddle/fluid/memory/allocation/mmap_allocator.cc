@@ -18,11 +18,16 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <cstdlib>
 
 #include <atomic>
+#include <chrono>
 #include <random>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 #include "glog/logging.h"
 #include "paddle/common/flags.h"
@@ -421,6 +426,375 @@ void MemoryMapAllocationPool::Clear() {
 
 MemoryMapAllocationPool::~MemoryMapAllocationPool() { Clear(); }  // NOLINT
 
+namespace {
+
+// Each segment starts with one page holding this header; the weight bytes
+// follow. `ready` is flipped by the publisher once the data is complete, so
+// a consumer never maps a half-written segment.
+struct SharedWeightSegmentHeader {
+  uint64_t magic;
+  uint64_t data_size;
+  std::atomic<uint32_t> ready;
+};
+
+constexpr uint64_t kSharedWeightSegmentMagic = 0x50445748544D4D31ULL;
+constexpr size_t kSharedWeightSegmentHeaderSize = 4096;
+
+std::string SharedWeightSegmentName(const std::string &name) {
+  std::string segment_name = "/paddle_shared_weights_" + name;
+  for (size_t i = 1; i < segment_name.size(); ++i) {
+    if (segment_name[i] == '/') {
+      segment_name[i] = '_';
+    }
+  }
+  return segment_name;
+}
+
+}  // namespace
+
+SharedWeightSegmentAllocation::~SharedWeightSegmentAllocation() {
+  if (map_ptr_ != nullptr) {
+    PADDLE_ENFORCE_NE(
+        munmap(map_ptr_, map_size_),
+        -1,
+        platform::errors::Unavailable(
+            "could not unmap the shared weight segment: %s (%d)",
+            strerror(errno),
+            errno));
+  }
+}
+
+std::shared_ptr<SharedWeightSegmentAllocation> PublishSharedWeightSegment(
+    const std::string &name, size_t size) {
+  std::string segment_name = SharedWeightSegmentName(name);
+  int fd = shm_open(
+      segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, (mode_t)0600);
+  if (fd == -1) {
+    if (errno == EEXIST) {
+      // Somebody else published (or is publishing) this model's weights.
+      return nullptr;
+    }
+    PADDLE_THROW(platform::errors::Unavailable(
+        "could not create the shared weight segment %s: %s (%d)",
+        segment_name,
+        strerror(errno),
+        errno));
+  }
+
+  size_t map_size = kSharedWeightSegmentHeaderSize + size;
+  PADDLE_ENFORCE_NE(ftruncate(fd, map_size),
+                    -1,
+                    platform::errors::Unavailable(
+                        "could not resize the shared weight segment %s to "
+                        "%ld bytes: %s (%d)",
+                        segment_name,
+                        map_size,
+                        strerror(errno),
+                        errno));
+
+  void *map_ptr =
+      mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  PADDLE_ENFORCE_NE(map_ptr,
+                    MAP_FAILED,
+                    platform::errors::Unavailable(
+                        "could not map the shared weight segment %s: %s (%d)",
+                        segment_name,
+                        strerror(errno),
+                        errno));
+
+  auto *header = reinterpret_cast<SharedWeightSegmentHeader *>(map_ptr);
+  header->magic = kSharedWeightSegmentMagic;
+  header->data_size = size;
+  header->ready.store(0, std::memory_order_relaxed);
+
+  void *data_ptr = reinterpret_cast<uint8_t *>(map_ptr) +
+                   kSharedWeightSegmentHeaderSize;
+  return std::make_shared<SharedWeightSegmentAllocation>(
+      data_ptr, size, map_ptr, map_size, segment_name, /*is_publisher=*/true);
+}
+
+void SealSharedWeightSegment(
+    const std::shared_ptr<SharedWeightSegmentAllocation> &allocation) {
+  PADDLE_ENFORCE_EQ(allocation->is_publisher(),
+                    true,
+                    platform::errors::PermissionDenied(
+                        "Only the publisher of a shared weight segment may "
+                        "seal it."));
+  void *map_ptr = reinterpret_cast<uint8_t *>(allocation->ptr()) -
+                  kSharedWeightSegmentHeaderSize;
+  auto *header = reinterpret_cast<SharedWeightSegmentHeader *>(map_ptr);
+  header->ready.store(1, std::memory_order_release);
+  // Drop write access to the weight bytes; the header page stays writable
+  // only in the publisher's mapping.
+  mprotect(allocation->ptr(), allocation->size(), PROT_READ);
+}
+
+std::shared_ptr<SharedWeightSegmentAllocation> TryMapSharedWeightSegment(
+    const std::string &name) {
+  std::string segment_name = SharedWeightSegmentName(name);
+  int fd = shm_open(segment_name.c_str(), O_RDONLY, (mode_t)0600);
+  if (fd == -1) {
+    return nullptr;
+  }
+
+  struct stat st {};
+  if (fstat(fd, &st) == -1 ||
+      static_cast<size_t>(st.st_size) <= kSharedWeightSegmentHeaderSize) {
+    ::close(fd);
+    return nullptr;
+  }
+  size_t map_size = static_cast<size_t>(st.st_size);
+
+  // MAP_PRIVATE gives copy-on-write semantics: reads share the publisher's
+  // physical pages, and an (unexpected) in-place write only copies the
+  // touched page into this process.
+  void *map_ptr = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map_ptr == MAP_FAILED) {
+    return nullptr;
+  }
+
+  auto *header = reinterpret_cast<SharedWeightSegmentHeader *>(map_ptr);
+  if (header->magic != kSharedWeightSegmentMagic ||
+      header->ready.load(std::memory_order_acquire) != 1 ||
+      header->data_size + kSharedWeightSegmentHeaderSize > map_size) {
+    munmap(map_ptr, map_size);
+    return nullptr;
+  }
+
+  void *data_ptr = reinterpret_cast<uint8_t *>(map_ptr) +
+                   kSharedWeightSegmentHeaderSize;
+  return std::make_shared<SharedWeightSegmentAllocation>(data_ptr,
+                                                         header->data_size,
+                                                         map_ptr,
+                                                         map_size,
+                                                         segment_name,
+                                                         /*is_publisher=*/false);
+}
+
+void RemoveSharedWeightSegment(const std::string &name) {
+  shm_unlink(SharedWeightSegmentName(name).c_str());
+}
+
+constexpr uint64_t kSharedMemoryRingMagic = 0x676E6972;  // "ring"
+
+// ring bookkeeping at the start of the segment, padded to kRingAlignment.
+// head and tail are monotonically increasing byte counters; the physical
+// offset of a position is pos % capacity. Only the writer process mutates
+// them, consumers merely drop record references.
+struct SharedMemoryRing::RingHeader {
+  uint64_t magic;
+  uint64_t capacity;
+  std::atomic<uint64_t> head;
+  std::atomic<uint64_t> tail;
+  char padding[kRingAlignment - 2 * sizeof(uint64_t) -
+               2 * sizeof(std::atomic<uint64_t>)];
+};
+
+// placed in front of every reserved payload, padded to kRingAlignment so
+// payloads keep the usual mmap_alignment
+struct SharedMemoryRing::RecordHeader {
+  uint64_t size;    // bytes including this header
+  uint32_t is_wrap;  // padding record at the segment end, carries no payload
+  std::atomic<int32_t> refcount;
+  char padding[kRingAlignment - sizeof(uint64_t) - sizeof(uint32_t) -
+               sizeof(std::atomic<int32_t>)];
+};
+
+namespace {
+std::mutex &RingRegistryMutex() {
+  static std::mutex mtx;
+  return mtx;
+}
+
+std::unordered_map<std::string, std::shared_ptr<SharedMemoryRing>>
+    &RingRegistry() {
+  static std::unordered_map<std::string, std::shared_ptr<SharedMemoryRing>>
+      registry;
+  return registry;
+}
+}  // namespace
+
+SharedMemoryRing::SharedMemoryRing(std::string name,
+                                   void *map_ptr,
+                                   size_t map_size)
+    : name_(std::move(name)), map_ptr_(map_ptr), map_size_(map_size) {}
+
+SharedMemoryRing::~SharedMemoryRing() {
+  if (map_ptr_ != nullptr) {
+    munmap(map_ptr_, map_size_);
+  }
+}
+
+SharedMemoryRing::RingHeader *SharedMemoryRing::header() const {
+  return reinterpret_cast<RingHeader *>(map_ptr_);
+}
+
+SharedMemoryRing::RecordHeader *SharedMemoryRing::record(uint64_t pos) const {
+  return reinterpret_cast<RecordHeader *>(static_cast<char *>(map_ptr_) +
+                                          sizeof(RingHeader) +
+                                          pos % header()->capacity);
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Create(
+    const std::string &name, size_t capacity) {
+  std::lock_guard<std::mutex> guard(RingRegistryMutex());
+  auto iter = RingRegistry().find(name);
+  if (iter != RingRegistry().end()) {
+    return iter->second;
+  }
+  PADDLE_ENFORCE_EQ(capacity % kRingAlignment,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "Ring capacity %zu is not a multiple of %zu.",
+                        capacity,
+                        kRingAlignment));
+  int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+  PADDLE_ENFORCE_NE(fd,
+                    -1,
+                    platform::errors::Unavailable(
+                        "File descriptor %s open failed.", name.c_str()));
+  size_t map_size = sizeof(RingHeader) + capacity;
+  PADDLE_ENFORCE_EQ(ftruncate(fd, map_size),
+                    0,
+                    platform::errors::Unavailable(
+                        "Truncate a file to a specified length failed!"));
+  void *ptr =
+      mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  PADDLE_ENFORCE_NE(ptr,
+                    MAP_FAILED,
+                    platform::errors::Unavailable(
+                        "Memory map failed when create shared memory ring."));
+  close(fd);
+
+  auto ring = std::shared_ptr<SharedMemoryRing>(
+      new SharedMemoryRing(name, ptr, map_size));
+  RingHeader *header = ring->header();
+  header->capacity = capacity;
+  header->head.store(0, std::memory_order_relaxed);
+  header->tail.store(0, std::memory_order_relaxed);
+  header->magic = kSharedMemoryRingMagic;
+  // make sure the segment is unlinked if the worker dies on a signal
+  MemoryMapFdSet::Instance().Insert(name);
+  RingRegistry().emplace(name, ring);
+  return ring;
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::Open(
+    const std::string &name) {
+  std::lock_guard<std::mutex> guard(RingRegistryMutex());
+  auto iter = RingRegistry().find(name);
+  if (iter != RingRegistry().end()) {
+    return iter->second;
+  }
+  int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  PADDLE_ENFORCE_NE(fd,
+                    -1,
+                    platform::errors::Unavailable(
+                        "File descriptor %s open failed.", name.c_str()));
+  struct stat st;
+  PADDLE_ENFORCE_EQ(
+      fstat(fd, &st),
+      0,
+      platform::errors::Unavailable("Stat on %s failed.", name.c_str()));
+  size_t map_size = static_cast<size_t>(st.st_size);
+  void *ptr =
+      mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  PADDLE_ENFORCE_NE(ptr,
+                    MAP_FAILED,
+                    platform::errors::Unavailable(
+                        "Memory map failed when open shared memory ring."));
+  close(fd);
+
+  auto ring = std::shared_ptr<SharedMemoryRing>(
+      new SharedMemoryRing(name, ptr, map_size));
+  PADDLE_ENFORCE_EQ(ring->header()->magic,
+                    kSharedMemoryRingMagic,
+                    platform::errors::PreconditionNotMet(
+                        "%s is not a shared memory ring.", name.c_str()));
+  RingRegistry().emplace(name, ring);
+  return ring;
+}
+
+void SharedMemoryRing::Remove(const std::string &name) {
+  std::lock_guard<std::mutex> guard(RingRegistryMutex());
+  RingRegistry().erase(name);
+  shm_unlink(name.c_str());
+  MemoryMapFdSet::Instance().Remove(name);
+}
+
+void SharedMemoryRing::Reclaim() {
+  RingHeader *hdr = header();
+  uint64_t head = hdr->head.load(std::memory_order_relaxed);
+  uint64_t tail = hdr->tail.load(std::memory_order_relaxed);
+  while (tail < head) {
+    RecordHeader *rec = record(tail);
+    if (rec->is_wrap == 0 &&
+        rec->refcount.load(std::memory_order_acquire) != 0) {
+      break;
+    }
+    tail += rec->size;
+  }
+  hdr->tail.store(tail, std::memory_order_release);
+}
+
+uint64_t SharedMemoryRing::Reserve(size_t bytes, int32_t initial_refcount) {
+  RingHeader *hdr = header();
+  uint64_t need = (sizeof(RecordHeader) + bytes + kRingAlignment - 1) &
+                  ~(kRingAlignment - 1);
+  PADDLE_ENFORCE_LE(
+      need,
+      hdr->capacity,
+      platform::errors::InvalidArgument(
+          "A batch of %zu bytes does not fit into the shared memory ring "
+          "of %llu bytes, enlarge the ring capacity.",
+          bytes,
+          hdr->capacity));
+  for (;;) {
+    Reclaim();
+    uint64_t head = hdr->head.load(std::memory_order_relaxed);
+    uint64_t tail = hdr->tail.load(std::memory_order_relaxed);
+    uint64_t free = hdr->capacity - (head - tail);
+    uint64_t to_end = hdr->capacity - head % hdr->capacity;
+    if (need > to_end) {
+      // pad to the segment end with a wrap record, payloads stay contiguous
+      if (free < to_end) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        continue;
+      }
+      RecordHeader *wrap = record(head);
+      wrap->size = to_end;
+      wrap->is_wrap = 1;
+      wrap->refcount.store(0, std::memory_order_relaxed);
+      hdr->head.store(head + to_end, std::memory_order_release);
+      continue;
+    }
+    if (free < need) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      continue;
+    }
+    RecordHeader *rec = record(head);
+    rec->size = need;
+    rec->is_wrap = 0;
+    rec->refcount.store(initial_refcount, std::memory_order_release);
+    hdr->head.store(head + need, std::memory_order_release);
+    return head;
+  }
+}
+
+void *SharedMemoryRing::Payload(uint64_t record_pos) {
+  return reinterpret_cast<char *>(record(record_pos)) + sizeof(RecordHeader);
+}
+
+void SharedMemoryRing::Release(uint64_t record_pos) {
+  record(record_pos)->refcount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+SharedMemoryRingSlotAllocation::~SharedMemoryRingSlotAllocation() {
+  ring_->Release(record_pos_);
+}
+
 }  // namespace allocation
 }  // namespace memory
 }  // namespace paddle
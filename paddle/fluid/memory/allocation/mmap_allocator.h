@@ -154,6 +154,130 @@ std::shared_ptr<MemoryMapWriterAllocation> AllocateMemoryMapWriterAllocation(
 std::shared_ptr<MemoryMapReaderAllocation> RebuildMemoryMapReaderAllocation(
     const std::string &ipc_name, size_t size);
 
+// Allocation backed by a named shared-memory segment holding read-only
+// weights. The first process to load a model publishes the segment, fills
+// it and seals it; every other process maps the sealed segment MAP_PRIVATE
+// (copy-on-write), so all predictors on one host share a single physical
+// copy of the parameters.
+class SharedWeightSegmentAllocation : public Allocation {
+ public:
+  SharedWeightSegmentAllocation(void *data_ptr,
+                                size_t data_size,
+                                void *map_ptr,
+                                size_t map_size,
+                                std::string segment_name,
+                                bool is_publisher)
+      : Allocation(data_ptr, data_size, phi::CPUPlace()),
+        map_ptr_(map_ptr),
+        map_size_(map_size),
+        segment_name_(std::move(segment_name)),
+        is_publisher_(is_publisher) {}
+
+  inline const std::string &segment_name() const { return segment_name_; }
+  inline bool is_publisher() const { return is_publisher_; }
+
+  ~SharedWeightSegmentAllocation() override;
+
+ private:
+  void *map_ptr_ = nullptr;
+  size_t map_size_ = 0;
+  std::string segment_name_;
+  bool is_publisher_ = false;
+};
+
+// Create and map a new segment of `size` weight bytes read-write. Returns
+// nullptr if the segment already exists (another process published first);
+// the caller should map it instead. The publisher must fill the returned
+// block and then call SealSharedWeightSegment before consumers can map it.
+std::shared_ptr<SharedWeightSegmentAllocation> PublishSharedWeightSegment(
+    const std::string &name, size_t size);
+
+// Mark a published segment as complete and drop write access to it.
+void SealSharedWeightSegment(
+    const std::shared_ptr<SharedWeightSegmentAllocation> &allocation);
+
+// Map an existing sealed segment copy-on-write. Returns nullptr if the
+// segment does not exist or has not been sealed yet.
+std::shared_ptr<SharedWeightSegmentAllocation> TryMapSharedWeightSegment(
+    const std::string &name);
+
+// Unlink the named segment so its memory is released once the last mapping
+// goes away. Existing mappings stay valid.
+void RemoveSharedWeightSegment(const std::string &name);
+
+// Preallocated shared-memory ring buffer used as the transport between
+// DataLoader worker processes and the main process. One segment is created
+// per worker and reused for its whole lifetime; every batch becomes a single
+// ring record whose tensors are constructed in place over the record payload,
+// so the steady state moves batches without any per-sample
+// shm_open/mmap/unlink traffic.
+class SharedMemoryRing {
+ public:
+  // payloads and headers are padded to this boundary
+  static constexpr size_t kRingAlignment = 64;
+
+  // Create the segment named `name` with `capacity` payload bytes (writer
+  // side), or map an already created segment (reader side). Both cache the
+  // mapping in a process-wide registry, so a name is mapped at most once per
+  // process.
+  static std::shared_ptr<SharedMemoryRing> Create(const std::string &name,
+                                                  size_t capacity);
+  static std::shared_ptr<SharedMemoryRing> Open(const std::string &name);
+  // drop the registry entry and unlink the segment; live mappings stay valid
+  static void Remove(const std::string &name);
+
+  ~SharedMemoryRing();
+
+  // Reserve a record of `bytes` payload with the given initial reference
+  // count, blocking until the consumer has released enough older records.
+  // Returns the logical record position used by Payload() and Release().
+  uint64_t Reserve(size_t bytes, int32_t initial_refcount);
+  void *Payload(uint64_t record_pos);
+  // decrement the record's reference count; the writer reclaims records
+  // whose count dropped to zero the next time it needs space
+  void Release(uint64_t record_pos);
+
+  const std::string &name() const { return name_; }
+
+ private:
+  struct RingHeader;
+  struct RecordHeader;
+
+  SharedMemoryRing(std::string name, void *map_ptr, size_t map_size);
+
+  RingHeader *header() const;
+  RecordHeader *record(uint64_t pos) const;
+  // advance the tail over released and wrap records
+  void Reclaim();
+
+  std::string name_;
+  void *map_ptr_ = nullptr;
+  size_t map_size_ = 0;
+};
+
+// Allocation over one tensor's slice of a ring record payload. Destroying it
+// releases one reference of the record; the record's memory is reused once
+// both the worker-side and the main-process-side tensors are gone.
+class SharedMemoryRingSlotAllocation : public Allocation {
+ public:
+  SharedMemoryRingSlotAllocation(void *ptr,
+                                 size_t size,
+                                 std::shared_ptr<SharedMemoryRing> ring,
+                                 uint64_t record_pos)
+      : Allocation(ptr, size, phi::CPUPlace()),
+        ring_(std::move(ring)),
+        record_pos_(record_pos) {}
+
+  ~SharedMemoryRingSlotAllocation() override;
+
+  const std::shared_ptr<SharedMemoryRing> &ring() const { return ring_; }
+  uint64_t record_pos() const { return record_pos_; }
+
+ private:
+  std::shared_ptr<SharedMemoryRing> ring_;
+  uint64_t record_pos_;
+};
+
 class MemoryMapFdSet {
  public:
   static MemoryMapFdSet &Instance();  // NOLINT
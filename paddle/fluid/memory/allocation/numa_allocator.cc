@@ -0,0 +1,125 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __linux__
+
+#include "paddle/fluid/memory/allocation/numa_allocator.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "paddle/fluid/memory/stats.h"
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle::memory::allocation {
+
+namespace {
+
+// Node requested through NUMANodeGuard, -1 when no request is active.
+thread_local int t_requested_numa_node = -1;
+
+// MPOL_BIND from <linux/mempolicy.h>; spelled out to avoid requiring the
+// kernel headers (and to keep libnuma out of the dependency set).
+constexpr int kMpolBind = 2;
+
+size_t RoundUpToPage(size_t size) {
+  constexpr size_t kPageMask = NUMAAllocator::kAlignment - 1;
+  return (size + kPageMask) & ~kPageMask;
+}
+
+}  // namespace
+
+int NUMAAllocator::NumNodes() {
+  static int num_nodes = [] {
+    int n = 0;
+    while (access(("/sys/devices/system/node/node" + std::to_string(n)).c_str(),
+                  F_OK) == 0) {
+      ++n;
+    }
+    return n > 0 ? n : 1;
+  }();
+  return num_nodes;
+}
+
+int NUMAAllocator::CurrentNode() {
+  unsigned int cpu = 0, node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return -1;
+  }
+  return static_cast<int>(node);
+}
+
+phi::Allocation *NUMAAllocator::AllocateImpl(size_t size) {
+  size_t rounded_size = RoundUpToPage(size);
+  void *p = mmap(nullptr,
+                 rounded_size,
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS,
+                 -1,
+                 0);
+  PADDLE_ENFORCE_NE(
+      p,
+      MAP_FAILED,
+      platform::errors::ResourceExhausted(
+          "Fail to mmap %ld bytes of NUMA-bound host memory, errno is %d.",
+          rounded_size,
+          errno));
+
+  int node = t_requested_numa_node >= 0 ? t_requested_numa_node
+                                        : CurrentNode();
+  if (node >= 0 && node < NumNodes() && NumNodes() > 1) {
+    unsigned long node_mask = 1UL << node;  // NOLINT
+    // Best effort: on failure the pages keep the default first-touch policy.
+    if (syscall(SYS_mbind,
+                p,
+                rounded_size,
+                kMpolBind,
+                &node_mask,
+                sizeof(node_mask) * 8,
+                0) != 0) {
+      VLOG(4) << "mbind of " << rounded_size << " bytes to NUMA node " << node
+              << " failed, errno is " << errno;
+    }
+  }
+
+  HOST_MEMORY_STAT_UPDATE(Reserved, 0, rounded_size);
+  return new Allocation(p, rounded_size, phi::CPUPlace());
+}
+
+void NUMAAllocator::FreeImpl(phi::Allocation *allocation) {
+  auto size = allocation->size();
+  munmap(allocation->ptr(), size);
+  HOST_MEMORY_STAT_UPDATE(Reserved, 0, -size);
+  delete allocation;
+}
+
+NUMANodeGuard::NUMANodeGuard(int node) : previous_node_(t_requested_numa_node) {
+  PADDLE_ENFORCE_LT(node,
+                    NUMAAllocator::NumNodes(),
+                    platform::errors::InvalidArgument(
+                        "The requested NUMA node %d is out of range, this "
+                        "machine only has %d node(s).",
+                        node,
+                        NUMAAllocator::NumNodes()));
+  t_requested_numa_node = node;
+}
+
+NUMANodeGuard::~NUMANodeGuard() { t_requested_numa_node = previous_node_; }
+
+}  // namespace paddle::memory::allocation
+
+#endif  // __linux__
@@ -0,0 +1,66 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifdef __linux__
+
+#include "paddle/fluid/memory/allocation/allocator.h"
+
+namespace paddle {
+namespace memory {
+namespace allocation {
+
+// NUMA-aware CPU allocator. Pages of each allocation are bound to the
+// NUMA node the calling thread currently runs on (or to the node requested
+// through NUMANodeGuard), so tensors produced by a loader thread pinned to
+// one socket are not consumed across the interconnect by workers pinned to
+// the other. Binding is best effort: if the kernel rejects the policy the
+// allocation falls back to first-touch placement.
+class NUMAAllocator : public Allocator {
+ public:
+  constexpr static size_t kAlignment = 4096UL;
+
+  bool IsAllocThreadSafe() const override { return true; }
+
+  // Number of NUMA nodes, 1 when the machine (or kernel) is NUMA-blind.
+  static int NumNodes();
+
+  // NUMA node of the CPU the calling thread currently runs on, -1 if unknown.
+  static int CurrentNode();
+
+ protected:
+  phi::Allocation* AllocateImpl(size_t size) override;
+  void FreeImpl(phi::Allocation* allocation) override;
+};
+
+// Scoped request to place the calling thread's subsequent allocations on a
+// specific NUMA node, overriding the thread-affinity default.
+class NUMANodeGuard {
+ public:
+  explicit NUMANodeGuard(int node);
+  ~NUMANodeGuard();
+
+  NUMANodeGuard(const NUMANodeGuard&) = delete;
+  NUMANodeGuard& operator=(const NUMANodeGuard&) = delete;
+
+ private:
+  int previous_node_;
+};
+
+}  // namespace allocation
+}  // namespace memory
+}  // namespace paddle
+
+#endif  // __linux__
@@ -39,15 +39,36 @@ class WaitedAllocateSizeGuard {
   size_t requested_size_;
 };
 
+class WaiterCountGuard {
+ public:
+  explicit WaiterCountGuard(std::atomic<size_t>* waiter_count)
+      : waiter_count_(waiter_count) {
+    waiter_count_->fetch_add(1, std::memory_order_seq_cst);
+  }
+
+  ~WaiterCountGuard() {
+    waiter_count_->fetch_sub(1, std::memory_order_release);
+  }
+
+ private:
+  std::atomic<size_t>* waiter_count_;
+};
+
 void RetryAllocator::FreeImpl(phi::Allocation* allocation) {
   // Delete underlying allocation first.
   size_t size = allocation->size();
   underlying_allocator_->Free(allocation);
-  if (UNLIKELY(waited_allocate_size_)) {
+  // Common case: nobody is blocked in an OOM retry, so freeing costs one
+  // relaxed load and never touches the mutex or condition variable.
+  if (UNLIKELY(waiter_count_.load(std::memory_order_relaxed) > 0)) {
     VLOG(10) << "Free " << size
              << " bytes and notify all waited threads, "
                 "where waited_allocate_size_ = "
              << waited_allocate_size_;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
     cv_.notify_all();
   }
 }
@@ -63,19 +84,24 @@ phi::Allocation* RetryAllocator::AllocateImpl(size_t size) {
   } catch (BadAlloc&) {
     {
       WaitedAllocateSizeGuard guard(&waited_allocate_size_, size);
+      WaiterCountGuard waiter_guard(&waiter_count_);
       VLOG(10) << "Allocation failed when allocating " << size
                << " bytes, waited_allocate_size_ = " << waited_allocate_size_;
-      // We can just write allocation retry inside the predicate function of
-      // wait_until. But it needs to acquire the lock when executing predicate
-      // function. For better performance, we use loop here
       auto end_time = std::chrono::high_resolution_clock::now() + retry_time_;
-      auto wait_until = [&, this] {
-        std::unique_lock<std::mutex> lock(mutex_);
-        return cv_.wait_until(lock, end_time);
-      };
 
       size_t retry_time = 0;
-      while (wait_until() != std::cv_status::timeout) {
+      for (;;) {
+        // Sleep only if no free happened since the last failed attempt;
+        // the epoch check under the mutex closes the window between that
+        // attempt and the wait.
+        uint64_t epoch = free_epoch_.load(std::memory_order_acquire);
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          if (free_epoch_.load(std::memory_order_relaxed) == epoch &&
+              cv_.wait_until(lock, end_time) == std::cv_status::timeout) {
+            break;
+          }
+        }
         try {
           return alloc_func();
         } catch (BadAlloc&) {
@@ -58,6 +58,15 @@ class RetryAllocator : public Allocator {
   std::mutex mutex_;
   std::condition_variable cv_;
 
+  // Event-count style wakeup (same idea as new_executor/workqueue's
+  // EventCount): the free path checks waiter_count_ with one relaxed load
+  // and only touches the mutex and condvar when an allocation is actually
+  // blocked waiting for memory. free_epoch_ is bumped under the mutex
+  // before notifying, so a free that lands between a failed allocation
+  // attempt and the wait cannot be missed by the waiter.
+  std::atomic<size_t> waiter_count_{0};
+  std::atomic<uint64_t> free_epoch_{0};
+
   std::atomic<size_t> waited_allocate_size_{0};
 };
 
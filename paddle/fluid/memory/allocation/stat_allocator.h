@@ -31,14 +31,25 @@ class StatAllocator : public Allocator {
 
  protected:
   void FreeImpl(phi::Allocation* allocation) override {
-    if (platform::is_cpu_place(allocation->place()) ||
-        platform::is_cuda_pinned_place(allocation->place())) {
+    bool is_host = platform::is_cpu_place(allocation->place()) ||
+                   platform::is_cuda_pinned_place(allocation->place());
+    if (is_host) {
       HOST_MEMORY_STAT_UPDATE(
           Allocated, allocation->place().GetDeviceId(), -allocation->size());
     } else {
       DEVICE_MEMORY_STAT_UPDATE(
           Allocated, allocation->place().GetDeviceId(), -allocation->size());
     }
+    auto& tracer = AllocationEventTracer::GetInstance();
+    if (UNLIKELY(tracer.IsEnabled())) {
+      tracer.Record(-static_cast<int64_t>(allocation->size()),
+                    allocation->place().GetDeviceId(),
+                    is_host);
+    }
+    auto& attribution = MemoryAttributionTracker::GetInstance();
+    if (UNLIKELY(attribution.IsEnabled())) {
+      attribution.RecordFree(allocation->ptr());
+    }
     platform::RecordMemEvent(allocation->ptr(),
                              allocation->place(),
                              allocation->size(),
@@ -51,14 +62,26 @@ class StatAllocator : public Allocator {
         underlying_allocator_->Allocate(size);
 
     const platform::Place& place = allocation->place();
-    if (platform::is_cpu_place(place) ||
-        platform::is_cuda_pinned_place(place)) {
+    bool is_host =
+        platform::is_cpu_place(place) || platform::is_cuda_pinned_place(place);
+    if (is_host) {
       HOST_MEMORY_STAT_UPDATE(
           Allocated, place.GetDeviceId(), allocation->size());
     } else {
       DEVICE_MEMORY_STAT_UPDATE(
           Allocated, place.GetDeviceId(), allocation->size());
     }
+    auto& tracer = AllocationEventTracer::GetInstance();
+    if (UNLIKELY(tracer.IsEnabled())) {
+      tracer.Record(static_cast<int64_t>(allocation->size()),
+                    place.GetDeviceId(),
+                    is_host);
+    }
+    auto& attribution = MemoryAttributionTracker::GetInstance();
+    if (UNLIKELY(attribution.IsEnabled())) {
+      attribution.RecordAlloc(allocation->ptr(),
+                              static_cast<int64_t>(allocation->size()));
+    }
     platform::RecordMemEvent(allocation->ptr(),
                              allocation->place(),
                              allocation->size(),
@@ -28,6 +28,83 @@ namespace paddle {
 namespace memory {
 namespace allocation {
 
+uint64_t StreamEpochWatermark::TakeTicket() {
+  std::lock_guard<SpinLock> lock_guard(lock_);
+  return ++issued_;
+}
+
+bool StreamEpochWatermark::Reached(gpuStream_t stream,
+                                   int device_id,
+                                   uint64_t ticket) {
+  std::lock_guard<SpinLock> lock_guard(lock_);
+  if (completed_ >= ticket) {
+    return true;
+  }
+
+  if (probe_in_flight_) {
+#ifdef PADDLE_WITH_CUDA
+    gpuError_t err = cudaEventQuery(probe_event_);
+    if (err == cudaErrorNotReady) {
+      VLOG(9) << "Probe event " << probe_event_ << " for stream " << stream
+              << " is not completed";
+      return false;
+    }
+#else
+    gpuError_t err = hipEventQuery(probe_event_);
+    if (err == hipErrorNotReady) {
+      VLOG(9) << "Probe event " << probe_event_ << " for stream " << stream
+              << " is not completed";
+      return false;
+    }
+#endif
+    PADDLE_ENFORCE_GPU_SUCCESS(err);
+    completed_ = probe_covers_;
+    probe_in_flight_ = false;
+    if (completed_ >= ticket) {
+      return true;
+    }
+  }
+
+  // Open the next epoch: one probe recorded now covers every ticket issued
+  // so far, including the queried one.
+  phi::backends::gpu::GPUDeviceGuard device_guard(device_id);
+  if (probe_event_ == nullptr) {
+#ifdef PADDLE_WITH_CUDA
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        cudaEventCreateWithFlags(&probe_event_, cudaEventDisableTiming));
+#else
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        hipEventCreateWithFlags(&probe_event_, hipEventDisableTiming));
+#endif
+    VLOG(9) << "Create probe event " << probe_event_ << " for stream "
+            << stream;
+  }
+#ifdef PADDLE_WITH_CUDA
+  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventRecord(probe_event_, stream));
+#else
+  PADDLE_ENFORCE_GPU_SUCCESS(hipEventRecord(probe_event_, stream));
+#endif
+  probe_covers_ = issued_;
+  probe_in_flight_ = true;
+  return false;
+}
+
+StreamEpochWatermarkRegistry& StreamEpochWatermarkRegistry::Instance() {
+  static StreamEpochWatermarkRegistry instance;
+  return instance;
+}
+
+StreamEpochWatermark* StreamEpochWatermarkRegistry::GetWatermark(
+    gpuStream_t stream) {
+  std::lock_guard<SpinLock> lock_guard(lock_);
+  auto it = watermarks_.find(stream);
+  if (it == watermarks_.end()) {
+    it = watermarks_.emplace(stream, std::make_unique<StreamEpochWatermark>())
+             .first;
+  }
+  return it->second.get();
+}
+
 StreamSafeCUDAAllocation::StreamSafeCUDAAllocation(
     DecoratedAllocationPtr underlying_allocation,
     gpuStream_t owning_stream,
@@ -49,7 +126,7 @@ void StreamSafeCUDAAllocation::RecordStream(gpuStream_t stream) {
   std::call_once(once_flag_,
                  [this] { phi::backends::gpu::SetDeviceId(place_.device); });
 
-  std::lock_guard<SpinLock> lock_guard(outstanding_event_map_lock_);
+  std::lock_guard<SpinLock> lock_guard(outstanding_epoch_map_lock_);
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   if (UNLIKELY(phi::backends::gpu::CUDAGraph::IsThisThreadCapturing())) {
     graph_capturing_stream_set_.insert(stream);
@@ -63,25 +140,15 @@ void StreamSafeCUDAAllocation::RecordStream(gpuStream_t stream) {
 
 void StreamSafeCUDAAllocation::EraseStream(gpuStream_t stream) {
   VLOG(8) << "Try remove stream " << stream << " for address " << ptr();
-  std::lock_guard<SpinLock> lock_guard(outstanding_event_map_lock_);
-  auto it = outstanding_event_map_.find(stream);
-  if (it == outstanding_event_map_.end()) {
-    return;
-  }
-
-#ifdef PADDLE_WITH_CUDA
-  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventDestroy(it->second));
-#else
-  PADDLE_ENFORCE_GPU_SUCCESS(hipEventDestroy(it->second));
-#endif
-  outstanding_event_map_.erase(it);
+  std::lock_guard<SpinLock> lock_guard(outstanding_epoch_map_lock_);
+  outstanding_epoch_map_.erase(stream);
 }
 
 bool StreamSafeCUDAAllocation::CanBeFreed() {
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
   if (UNLIKELY(phi::backends::gpu::CUDAGraph::IsThisThreadCapturing())) {
     return graph_capturing_stream_set_.empty() &&
-           outstanding_event_map_.empty();
+           outstanding_epoch_map_.empty();
   }
 #endif
 
@@ -90,32 +157,16 @@ bool StreamSafeCUDAAllocation::CanBeFreed() {
 
   RecordGraphCapturingStreams();
 
-  for (auto it = outstanding_event_map_.begin();
-       it != outstanding_event_map_.end();
-       ++it) {
-    gpuEvent_t& event = it->second;
-#ifdef PADDLE_WITH_CUDA
-    gpuError_t err = cudaEventQuery(event);
-    if (err == cudaErrorNotReady) {
-      VLOG(9) << "Event " << event << " for " << ptr() << " is not completed";
-      // Erase the completed event before "it"
-      outstanding_event_map_.erase(outstanding_event_map_.begin(), it);
-      return false;
-    }
-    PADDLE_ENFORCE_GPU_SUCCESS(err);
-    PADDLE_ENFORCE_GPU_SUCCESS(cudaEventDestroy(event));
-#else
-    gpuError_t err = hipEventQuery(event);
-    if (err == hipErrorNotReady) {
-      VLOG(9) << "Event " << event << " for " << ptr() << " is not completed";
-      // Erase the completed event before "it"
-      outstanding_event_map_.erase(outstanding_event_map_.begin(), it);
+  auto& registry = StreamEpochWatermarkRegistry::Instance();
+  for (auto it = outstanding_epoch_map_.begin();
+       it != outstanding_epoch_map_.end();) {
+    StreamEpochWatermark* watermark = registry.GetWatermark(it->first);
+    if (!watermark->Reached(it->first, place_.device, it->second)) {
+      VLOG(9) << "Epoch " << it->second << " of stream " << it->first
+              << " for " << ptr() << " is not completed";
       return false;
     }
-    PADDLE_ENFORCE_GPU_SUCCESS(err);
-    PADDLE_ENFORCE_GPU_SUCCESS(hipEventDestroy(event));
-#endif
-    VLOG(8) << "Destroy event " << event;
+    it = outstanding_epoch_map_.erase(it);
   }
   return true;
 }
@@ -133,31 +184,13 @@ void StreamSafeCUDAAllocation::RecordGraphCapturingStreams() {
 
 void StreamSafeCUDAAllocation::RecordStreamWithNoGraphCapturing(
     gpuStream_t stream) {
-  gpuEvent_t record_event;
-  auto it = outstanding_event_map_.find(stream);
-  if (it == outstanding_event_map_.end()) {
-    gpuEvent_t new_event;
-#ifdef PADDLE_WITH_CUDA
-    PADDLE_ENFORCE_GPU_SUCCESS(
-        cudaEventCreateWithFlags(&new_event, cudaEventDisableTiming));
-#else
-    PADDLE_ENFORCE_GPU_SUCCESS(
-        hipEventCreateWithFlags(&new_event, hipEventDisableTiming));
-#endif
-    outstanding_event_map_[stream] = new_event;
-    record_event = new_event;
-    VLOG(9) << "Create a new event " << new_event;
-  } else {
-    record_event = it->second;
-    VLOG(9) << "Reuse event " << record_event;
-  }
-
-#ifdef PADDLE_WITH_CUDA
-  PADDLE_ENFORCE_GPU_SUCCESS(cudaEventRecord(record_event, stream));
-#else
-  PADDLE_ENFORCE_GPU_SUCCESS(hipEventRecord(record_event, stream));
-#endif
-  VLOG(8) << "Record event " << record_event << " to stream " << stream;
+  // A later ticket covers an earlier one on the same stream, so the entry can
+  // simply be overwritten.
+  uint64_t ticket =
+      StreamEpochWatermarkRegistry::Instance().GetWatermark(stream)
+          ->TakeTicket();
+  outstanding_epoch_map_[stream] = ticket;
+  VLOG(8) << "Take epoch ticket " << ticket << " of stream " << stream;
 }
 
 StreamSafeCUDAAllocator::StreamSafeCUDAAllocator(
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 
 #include "paddle/fluid/memory/allocation/allocator.h"
@@ -34,6 +36,43 @@ namespace allocation {
 
 class StreamSafeCUDAAllocator;
 
+// Per-stream epoch watermark shared by every allocation that touched the
+// stream. RecordStream hands out the stream's current epoch ticket; a free
+// becomes safe once a probe event recorded at-or-after the ticket was taken
+// has completed. Tickets issued between two probes collapse into one event
+// record, so the allocator pays one event per stream per reclamation epoch
+// instead of one event per freed allocation.
+class StreamEpochWatermark {
+ public:
+  // Hands out a ticket covering all work submitted to the stream so far.
+  uint64_t TakeTicket();
+
+  // Returns true once every piece of stream work issued before the ticket
+  // was taken has completed. Records or queries the per-stream probe event
+  // as needed, so it must not be called while capturing a CUDA Graph.
+  bool Reached(gpuStream_t stream, int device_id, uint64_t ticket);
+
+ private:
+  SpinLock lock_;
+  uint64_t issued_{0};
+  uint64_t probe_covers_{0};
+  uint64_t completed_{0};
+  bool probe_in_flight_{false};
+  // One reusable probe event per stream; it lives as long as the process.
+  gpuEvent_t probe_event_{nullptr};
+};
+
+class StreamEpochWatermarkRegistry {
+ public:
+  static StreamEpochWatermarkRegistry &Instance();
+
+  StreamEpochWatermark *GetWatermark(gpuStream_t stream);
+
+ private:
+  SpinLock lock_;
+  std::map<gpuStream_t, std::unique_ptr<StreamEpochWatermark>> watermarks_;
+};
+
 class StreamSafeCUDAAllocation : public Allocation {
  public:
   StreamSafeCUDAAllocation(DecoratedAllocationPtr underlying_allocation,
@@ -51,9 +90,9 @@ class StreamSafeCUDAAllocation : public Allocation {
   void RecordStreamWithNoGraphCapturing(gpuStream_t stream);
   DecoratedAllocationPtr underlying_allocation_;
   std::set<gpuStream_t> graph_capturing_stream_set_;
-  std::map<gpuStream_t, gpuEvent_t> outstanding_event_map_;
+  std::map<gpuStream_t, uint64_t> outstanding_epoch_map_;
   gpuStream_t owning_stream_;
-  SpinLock outstanding_event_map_lock_;
+  SpinLock outstanding_epoch_map_lock_;
   // To compatible with CUDA Graph, hold the allocator shared_ptr so that
   // Allocator will not deconstruct before Allocation
   std::shared_ptr<Allocator> allocator_;
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/memory/allocation/thread_cached_cpu_allocator.h"
+
+#include <array>
+#include <vector>
+
+namespace paddle::memory::allocation {
+
+namespace {
+
+// Size class index for a sub-kMaxCachedSize request: the smallest power of
+// two >= size, clamped below at kMinClassSize.
+size_t SizeClassIndex(size_t size) {
+  size_t class_size = ThreadCachedCPUAllocator::kMinClassSize;
+  size_t index = 0;
+  while (class_size < size) {
+    class_size <<= 1;
+    ++index;
+  }
+  return index;
+}
+
+size_t SizeClassBytes(size_t index) {
+  return ThreadCachedCPUAllocator::kMinClassSize << index;
+}
+
+// One free list per size class. The cache holds the underlying allocations
+// themselves, each of which frees through its own allocator chain when
+// dropped, so spilling (and thread exit) needs no knowledge of which
+// allocator instance filled the cache.
+struct ThreadCache {
+  std::array<std::vector<DecoratedAllocationPtr>,
+             ThreadCachedCPUAllocator::kNumClasses>
+      free_lists;
+  size_t cached_bytes{0};
+
+  void Spill() {
+    for (auto &free_list : free_lists) {
+      free_list.clear();
+    }
+    cached_bytes = 0;
+  }
+};
+
+ThreadCache &GetThreadCache() {
+  static thread_local ThreadCache cache;
+  return cache;
+}
+
+// Wrapper keeping the cached underlying allocation alive and remembering
+// its size class; kPassThrough marks requests too large to cache.
+class CachedAllocation : public Allocation {
+ public:
+  constexpr static size_t kPassThrough = static_cast<size_t>(-1);
+
+  CachedAllocation(DecoratedAllocationPtr underlying_allocation,
+                   size_t size_class_index)
+      : Allocation(underlying_allocation->ptr(),
+                   underlying_allocation->base_ptr(),
+                   underlying_allocation->size(),
+                   underlying_allocation->place()),
+        underlying_allocation_(std::move(underlying_allocation)),
+        size_class_index_(size_class_index) {}
+
+  DecoratedAllocationPtr underlying_allocation_;
+  size_t size_class_index_;
+};
+
+}  // namespace
+
+phi::Allocation *ThreadCachedCPUAllocator::AllocateImpl(size_t size) {
+  if (size > kMaxCachedSize) {
+    return new CachedAllocation(
+        static_unique_ptr_cast<Allocation>(underlying_allocator_->Allocate(size)),
+        CachedAllocation::kPassThrough);
+  }
+
+  size_t index = SizeClassIndex(size);
+  auto &cache = GetThreadCache();
+  auto &free_list = cache.free_lists[index];
+  if (!free_list.empty()) {
+    DecoratedAllocationPtr underlying = std::move(free_list.back());
+    free_list.pop_back();
+    cache.cached_bytes -= SizeClassBytes(index);
+    return new CachedAllocation(std::move(underlying), index);
+  }
+
+  return new CachedAllocation(
+      static_unique_ptr_cast<Allocation>(
+          underlying_allocator_->Allocate(SizeClassBytes(index))),
+      index);
+}
+
+void ThreadCachedCPUAllocator::FreeImpl(phi::Allocation *allocation) {
+  auto *cached = static_cast<CachedAllocation *>(allocation);
+  if (cached->size_class_index_ != CachedAllocation::kPassThrough) {
+    auto &cache = GetThreadCache();
+    cache.free_lists[cached->size_class_index_].push_back(
+        std::move(cached->underlying_allocation_));
+    cache.cached_bytes += SizeClassBytes(cached->size_class_index_);
+    if (cache.cached_bytes > kMaxThreadCacheBytes) {
+      cache.Spill();
+    }
+  }
+  delete allocation;
+}
+
+uint64_t ThreadCachedCPUAllocator::ReleaseImpl(const phi::Place &place) {
+  // Only the calling thread's cache can be dropped safely; other threads'
+  // caches spill on their own when they exceed the byte budget.
+  auto &cache = GetThreadCache();
+  uint64_t bytes = cache.cached_bytes;
+  cache.Spill();
+  return bytes + underlying_allocator_->Release(place);
+}
+
+}  // namespace paddle::memory::allocation
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "paddle/fluid/memory/allocation/allocator.h"
+
+namespace paddle {
+namespace memory {
+namespace allocation {
+
+// A tcmalloc-style per-thread size-class cache layered in front of the CPU
+// allocator. Sub-4KB allocations are rounded up to a power-of-two class and
+// served from (and returned to) a thread-local free list without taking any
+// lock or touching the shared pool; larger requests pass straight through.
+// A thread cache that grows past its byte budget spills everything back to
+// the underlying allocator, which is thread safe.
+class ThreadCachedCPUAllocator : public Allocator {
+ public:
+  constexpr static size_t kMinClassSize = 32;
+  constexpr static size_t kMaxCachedSize = 4096;
+  constexpr static size_t kNumClasses = 8;  // 32B .. 4KB, powers of two
+  constexpr static size_t kMaxThreadCacheBytes = 1 << 20;
+
+  explicit ThreadCachedCPUAllocator(
+      std::shared_ptr<Allocator> underlying_allocator)
+      : underlying_allocator_(std::move(underlying_allocator)) {}
+
+  bool IsAllocThreadSafe() const override { return true; }
+
+ protected:
+  phi::Allocation* AllocateImpl(size_t size) override;
+  void FreeImpl(phi::Allocation* allocation) override;
+  uint64_t ReleaseImpl(const phi::Place& place) override;
+
+ private:
+  std::shared_ptr<Allocator> underlying_allocator_;
+};
+
+}  // namespace allocation
+}  // namespace memory
+}  // namespace paddle
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include "paddle/fluid/memory/pinned_staging_batcher.h"
+
+#include <cstring>
+
+#include "paddle/fluid/memory/memcpy.h"
+#include "paddle/fluid/platform/device/gpu/gpu_types.h"
+#include "paddle/fluid/platform/enforce.h"
+
+namespace paddle {
+namespace memory {
+
+PinnedStagingBatcher::PinnedStagingBatcher(const phi::GPUPlace& place,
+                                           size_t capacity)
+    : place_(place), capacity_(capacity) {
+  for (auto& buffer : buffers_) {
+    buffer.allocation = Alloc(phi::GPUPinnedPlace(), capacity_);
+    PADDLE_ENFORCE_GPU_SUCCESS(
+        gpuEventCreateWithFlags(&buffer.event, gpuEventDisableTiming));
+  }
+}
+
+PinnedStagingBatcher::~PinnedStagingBatcher() {
+  for (auto& buffer : buffers_) {
+    if (buffer.in_flight) {
+      gpuEventSynchronize(buffer.event);
+    }
+    gpuEventDestroy(buffer.event);
+  }
+}
+
+void PinnedStagingBatcher::WaitBuffer(StagingBuffer* buffer) {
+  if (buffer->in_flight) {
+    PADDLE_ENFORCE_GPU_SUCCESS(gpuEventSynchronize(buffer->event));
+    buffer->in_flight = false;
+  }
+}
+
+bool PinnedStagingBatcher::AddCopy(void* dst_gpu,
+                                   const void* src_host,
+                                   size_t num) {
+  if (offset_ + num > capacity_) {
+    return false;
+  }
+  auto& buffer = buffers_[current_];
+  // The first slot of a fresh batch may still race with copies issued from
+  // this buffer two flushes ago; wait for them before overwriting it.
+  if (offset_ == 0) {
+    WaitBuffer(&buffer);
+  }
+  uint8_t* staging = reinterpret_cast<uint8_t*>(buffer.allocation->ptr());
+  std::memcpy(staging + offset_, src_host, num);
+  pending_.push_back(
+      {reinterpret_cast<uint8_t*>(dst_gpu), offset_, num});
+  offset_ += num;
+  return true;
+}
+
+void PinnedStagingBatcher::Flush(gpuStream_t stream) {
+  if (pending_.empty()) {
+    return;
+  }
+  auto& buffer = buffers_[current_];
+  uint8_t* staging = reinterpret_cast<uint8_t*>(buffer.allocation->ptr());
+
+  // Merge runs that are contiguous in both the staging buffer and on the
+  // device, so packed slots go out as one transfer.
+  size_t i = 0;
+  while (i < pending_.size()) {
+    uint8_t* dst = pending_[i].dst;
+    size_t offset = pending_[i].offset;
+    size_t num = pending_[i].num;
+    size_t j = i + 1;
+    while (j < pending_.size() && pending_[j].dst == dst + num &&
+           pending_[j].offset == offset + num) {
+      num += pending_[j].num;
+      ++j;
+    }
+    Copy(place_,
+         dst,
+         phi::GPUPinnedPlace(),
+         staging + offset,
+         num,
+         reinterpret_cast<void*>(stream));
+    i = j;
+  }
+
+  PADDLE_ENFORCE_GPU_SUCCESS(gpuEventRecord(buffer.event, stream));
+  buffer.in_flight = true;
+
+  pending_.clear();
+  offset_ = 0;
+  current_ = 1 - current_;
+}
+
+}  // namespace memory
+}  // namespace paddle
+
+#endif
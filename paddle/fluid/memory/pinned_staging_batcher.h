@@ -0,0 +1,89 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include <vector>
+
+#include "paddle/fluid/memory/malloc.h"
+#include "paddle/phi/backends/gpu/gpu_decls.h"
+
+namespace paddle {
+namespace memory {
+
+// Batches many small host-to-device uploads through a pinned staging
+// buffer. Each AddCopy memcpys one pageable slot into the staging buffer;
+// Flush issues the staged ranges as asynchronous copies on one stream,
+// merging ranges that are contiguous on both sides into a single transfer.
+// Copying from pinned memory lets the driver skip its internal staging,
+// and merging removes the per-copy launch overhead of feeding hundreds of
+// small slots one memcpy at a time.
+//
+// The batcher is double buffered: while one staging buffer is in flight on
+// the stream, the other one is filled, so steady-state steps never block
+// on upload completion. Not thread safe; use one batcher per feeding
+// thread.
+class PinnedStagingBatcher {
+ public:
+  static constexpr size_t kDefaultCapacity = 8 << 20;  // 8MB per buffer
+
+  explicit PinnedStagingBatcher(const phi::GPUPlace& place,
+                                size_t capacity = kDefaultCapacity);
+  ~PinnedStagingBatcher();
+
+  PinnedStagingBatcher(const PinnedStagingBatcher&) = delete;
+  PinnedStagingBatcher& operator=(const PinnedStagingBatcher&) = delete;
+
+  // Stage `num` bytes of `src_host` for upload to `dst_gpu`. Returns false
+  // when the slot does not fit in the remaining staging space, in which
+  // case the caller should Flush() and retry (or fall back to a plain
+  // memory::Copy for slots larger than the whole buffer).
+  bool AddCopy(void* dst_gpu, const void* src_host, size_t num);
+
+  // Issue all staged slots on `stream` and switch to the other staging
+  // buffer. The issued copies are asynchronous; the staging buffer they
+  // read from is guarded by an event and only reused once they finished.
+  void Flush(gpuStream_t stream);
+
+  size_t pending_bytes() const { return offset_; }
+
+ private:
+  struct PendingCopy {
+    uint8_t* dst;
+    size_t offset;
+    size_t num;
+  };
+
+  struct StagingBuffer {
+    AllocationPtr allocation;
+    gpuEvent_t event{nullptr};
+    bool in_flight{false};
+  };
+
+  void WaitBuffer(StagingBuffer* buffer);
+
+  phi::GPUPlace place_;
+  size_t capacity_;
+  size_t offset_{0};
+  int current_{0};
+  StagingBuffer buffers_[2];
+  std::vector<PendingCopy> pending_;
+};
+
+}  // namespace memory
+}  // namespace paddle
+
+#endif
@@ -14,6 +14,12 @@ limitations under the License. */
 
 #include "paddle/fluid/memory/stats.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
 #include "paddle/common/macros.h"
 #include "paddle/fluid/memory/allocation/spin_lock.h"
 #include "paddle/fluid/platform/flags.h"
@@ -22,6 +28,14 @@ PADDLE_DEFINE_EXPORTED_bool(
     log_memory_stats,
     false,
     "Log memory stats after each op runs, just used for debug.");
+
+PADDLE_DEFINE_EXPORTED_bool(
+    memory_attribution,
+    false,
+    "Attribute every allocation to the executing instruction and keep a "
+    "per-op breakdown of the memory live at the global peak, reported by "
+    "core.memory_attribution_peak_report() and logged when a device "
+    "allocation fails. Adds a lock per (de)allocation; debug only.");
 namespace paddle::memory {
 
 class StatRegistry {
@@ -172,4 +186,135 @@ int RegisterAllStats() {
 
 UNUSED static int register_all_stats = RegisterAllStats();
 
+namespace {
+
+thread_local char t_op_context[sizeof(AllocationEvent::op_context)] = {0};
+
+uint64_t NowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace
+
+AllocationEventTracer& AllocationEventTracer::GetInstance() {
+  static AllocationEventTracer instance;
+  return instance;
+}
+
+void AllocationEventTracer::Enable(size_t capacity) {
+  PADDLE_ENFORCE_GT(capacity,
+                    0,
+                    platform::errors::InvalidArgument(
+                        "The capacity of the allocation event trace ring "
+                        "should be larger than 0."));
+  uint64_t rounded = 1;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+  ring_.assign(rounded, AllocationEvent{});
+  capacity_mask_ = rounded - 1;
+  next_.store(0, std::memory_order_relaxed);
+  enabled_.store(true, std::memory_order_release);
+}
+
+void AllocationEventTracer::Disable() {
+  enabled_.store(false, std::memory_order_release);
+}
+
+void AllocationEventTracer::SetOpContext(const std::string& op_context) {
+  std::strncpy(t_op_context, op_context.c_str(), sizeof(t_op_context) - 1);
+  t_op_context[sizeof(t_op_context) - 1] = '\0';
+}
+
+void AllocationEventTracer::Record(int64_t size, int device_id, bool is_host) {
+  uint64_t slot = next_.fetch_add(1, std::memory_order_relaxed);
+  AllocationEvent& event = ring_[slot & capacity_mask_];
+  event.timestamp_ns = NowNs();
+  event.thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+  event.size = size;
+  event.device_id = device_id;
+  event.is_host = is_host;
+  std::memcpy(event.op_context, t_op_context, sizeof(event.op_context));
+}
+
+std::vector<AllocationEvent> AllocationEventTracer::Dump() const {
+  std::vector<AllocationEvent> events;
+  uint64_t total = next_.load(std::memory_order_acquire);
+  uint64_t capacity = capacity_mask_ + 1;
+  uint64_t begin = total > capacity ? total - capacity : 0;
+  events.reserve(total - begin);
+  for (uint64_t i = begin; i < total; ++i) {
+    events.push_back(ring_[i & capacity_mask_]);
+  }
+  return events;
+}
+
+MemoryAttributionTracker& MemoryAttributionTracker::GetInstance() {
+  static MemoryAttributionTracker* tracker = [] {
+    auto* instance = new MemoryAttributionTracker;
+    if (FLAGS_memory_attribution) {
+      instance->Enable();
+    }
+    return instance;
+  }();
+  return *tracker;
+}
+
+void MemoryAttributionTracker::Enable() {
+  enabled_.store(true, std::memory_order_release);
+}
+
+void MemoryAttributionTracker::Disable() {
+  enabled_.store(false, std::memory_order_release);
+}
+
+void MemoryAttributionTracker::RecordAlloc(const void* ptr, int64_t size) {
+  std::string op = t_op_context[0] != '\0' ? t_op_context : "(untagged)";
+  std::lock_guard<std::mutex> guard(mutex_);
+  live_[ptr] = LiveAllocation{op, size};
+  current_[op] += size;
+  current_total_ += size;
+  if (current_total_ > peak_total_) {
+    peak_total_ = current_total_;
+    peak_breakdown_ = current_;
+  }
+}
+
+void MemoryAttributionTracker::RecordFree(const void* ptr) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto iter = live_.find(ptr);
+  if (iter == live_.end()) {
+    // Allocated before the tracker was enabled.
+    return;
+  }
+  current_[iter->second.op] -= iter->second.size;
+  current_total_ -= iter->second.size;
+  live_.erase(iter);
+}
+
+std::string MemoryAttributionTracker::PeakReport() const {
+  std::vector<std::pair<int64_t, std::string>> breakdown;
+  int64_t peak_total = 0;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    peak_total = peak_total_;
+    breakdown.reserve(peak_breakdown_.size());
+    for (const auto& item : peak_breakdown_) {
+      if (item.second > 0) {
+        breakdown.emplace_back(item.second, item.first);
+      }
+    }
+  }
+  std::sort(breakdown.rbegin(), breakdown.rend());
+  std::ostringstream os;
+  os << "peak_total " << peak_total << "\n";
+  for (const auto& item : breakdown) {
+    os << item.first << " " << item.second << "\n";
+  }
+  return os.str();
+}
+
 }  // namespace paddle::memory
@@ -16,7 +16,10 @@ limitations under the License. */
 
 #include <atomic>
 #include <map>
+#include <mutex>  // NOLINT
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "paddle/fluid/platform/enforce.h"
 #include "paddle/fluid/platform/errors.h"
@@ -116,6 +119,122 @@ class Stat : public StatBase {
   std::atomic<int64_t> peak_value_{0};
 };
 
+// One allocation or free, as recorded by StatAllocator. The op context is
+// the annotation of the thread that performed the (de)allocation, set by
+// the executor through AllocationEventTracer::SetOpContext, so a watermark
+// in the trace can be attributed to the instruction that caused it.
+struct AllocationEvent {
+  uint64_t timestamp_ns;
+  uint64_t thread_id;
+  int64_t size;  // positive for alloc, negative for free
+  int device_id;
+  bool is_host;
+  char op_context[64];
+};
+
+// Lock-free ring-buffer trace of allocation events. Recording is a single
+// relaxed fetch_add plus a slot write, so it is cheap enough to leave on
+// during a full training step; once the ring wraps, the oldest events are
+// overwritten. Dump() is meant to be called at a safe point (e.g. between
+// steps or after Disable()) since it does not synchronize with writers.
+class AllocationEventTracer {
+ public:
+  static AllocationEventTracer& GetInstance();
+
+  // Start tracing with a ring of `capacity` events, rounded up to a power
+  // of two.
+  void Enable(size_t capacity);
+  void Disable();
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Annotation applied to subsequent events of the calling thread.
+  static void SetOpContext(const std::string& op_context);
+
+  void Record(int64_t size, int device_id, bool is_host);
+
+  // Snapshot of the ring, oldest event first.
+  std::vector<AllocationEvent> Dump() const;
+
+ private:
+  AllocationEventTracer() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<uint64_t> next_{0};
+  std::vector<AllocationEvent> ring_;
+  uint64_t capacity_mask_{0};
+
+  DISABLE_COPY_AND_ASSIGN(AllocationEventTracer);
+};
+
+// Debug-mode attribution of live memory to the op context that allocated
+/// it, for OOM debugging without bisecting the model: every allocation is
+// mapped to the executing instruction (tagged by the interpreters through
+// the same op context as AllocationEventTracer), and whenever the total
+// reaches a new peak the per-op breakdown is snapshotted. PeakReport()
+// therefore answers "what was live, by op, at the high-water mark".
+/// Bookkeeping takes a mutex per (de)allocation, so this is opt-in:
+// enabled at startup with FLAGS_memory_attribution or at runtime from
+// Python; the report is also logged when a device allocation fails.
+class MemoryAttributionTracker {
+ public:
+  static MemoryAttributionTracker& GetInstance();
+
+  void Enable();
+  void Disable();
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Attributes to the calling thread's op context.
+  void RecordAlloc(const void* ptr, int64_t size);
+  void RecordFree(const void* ptr);
+
+  // "bytes op" lines of the memory live at the global peak, largest
+  // first, headed by the peak total.
+  std::string PeakReport() const;
+
+ private:
+  MemoryAttributionTracker() = default;
+
+  struct LiveAllocation {
+    std::string op;
+    int64_t size;
+  };
+
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex mutex_;
+  std::unordered_map<const void*, LiveAllocation> live_;
+  std::unordered_map<std::string, int64_t> current_;
+  int64_t current_total_{0};
+  int64_t peak_total_{0};
+  std::unordered_map<std::string, int64_t> peak_breakdown_;
+
+  DISABLE_COPY_AND_ASSIGN(MemoryAttributionTracker);
+};
+
+// Tags allocations performed inside the scope with the given op name,
+// feeding both the allocation event trace and the peak-memory
+// attribution. A no-op (two relaxed loads) while neither is enabled.
+class OpContextScope {
+ public:
+  explicit OpContextScope(const std::string& op)
+      : tagged_(AllocationEventTracer::GetInstance().IsEnabled() ||
+                MemoryAttributionTracker::GetInstance().IsEnabled()) {
+    if (tagged_) {
+      AllocationEventTracer::SetOpContext(op);
+    }
+  }
+
+  ~OpContextScope() {
+    if (tagged_) {
+      AllocationEventTracer::SetOpContext("");
+    }
+  }
+
+  DISABLE_COPY_AND_ASSIGN(OpContextScope);
+
+ private:
+  const bool tagged_;
+};
+
 // xxxMemoryStatCurrentValue, xxxMemoryStatPeakValue and xxxMemoryStatUpdate
 // support to operate STAT values by a string, however, they has worse
 // performance than the macro function xxx_MEMORY_STAT_CURRENT_VALUE,
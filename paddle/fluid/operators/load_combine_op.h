@@ -21,6 +21,7 @@ limitations under the License. */
 #include "paddle/fluid/framework/convert_utils.h"
 #include "paddle/fluid/framework/data_type.h"
 #include "paddle/fluid/framework/data_type_transform.h"
+#include "paddle/fluid/framework/lod_tensor.h"
 #include "paddle/fluid/framework/op_registry.h"
 #include "paddle/fluid/framework/string_array.h"
 #include "paddle/fluid/framework/tensor_util.h"
@@ -53,7 +54,18 @@ class LoadCombineOpKernel : public framework::OpKernel<T> {
               "LoadCombine operator fails to open file %s, please check "
               "whether the model file is complete or damaged.",
               filename));
-      LoadParamsFromBuffer(ctx, place, &fin, load_as_fp16, out_var_names);
+      if (AllOutputsAreDenseTensors(ctx, out_var_names)) {
+        // one sequential read of the whole file, then the independent
+        // tensor records are deserialized on multiple threads
+        fin.seekg(0, std::ios::end);
+        std::vector<char> bytes(static_cast<size_t>(fin.tellg()));
+        fin.seekg(0, std::ios::beg);
+        fin.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        LoadDenseParamsFromMemory(
+            ctx, place, bytes.data(), bytes.size(), load_as_fp16);
+      } else {
+        LoadParamsFromBuffer(ctx, place, &fin, load_as_fp16, out_var_names);
+      }
     } else {
       PADDLE_ENFORCE_NE(
           filename.empty(),
@@ -62,8 +74,73 @@ class LoadCombineOpKernel : public framework::OpKernel<T> {
               "LoadCombine operator fails to open file %s, please check "
               "whether the model file is complete or damaged.",
               filename));
-      std::stringstream fin(filename, std::ios::in | std::ios::binary);
-      LoadParamsFromBuffer(ctx, place, &fin, load_as_fp16, out_var_names);
+      if (AllOutputsAreDenseTensors(ctx, out_var_names)) {
+        LoadDenseParamsFromMemory(
+            ctx, place, filename.data(), filename.size(), load_as_fp16);
+      } else {
+        std::stringstream fin(filename, std::ios::in | std::ios::binary);
+        LoadParamsFromBuffer(ctx, place, &fin, load_as_fp16, out_var_names);
+      }
+    }
+  }
+
+  bool AllOutputsAreDenseTensors(
+      const framework::ExecutionContext &ctx,
+      const std::vector<std::string> &out_var_names) const {
+    auto out_vars = ctx.MultiOutputVar("Out");
+    for (size_t i = 0; i < out_var_names.size(); i++) {
+      PADDLE_ENFORCE_NOT_NULL(
+          out_vars[i],
+          phi::errors::InvalidArgument(
+              "The variable %s to be loaded cannot be found.",
+              out_var_names[i]));
+      if (out_vars[i]->IsType<framework::Vocab>()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void LoadDenseParamsFromMemory(const framework::ExecutionContext &context,
+                                 const phi::Place &place,
+                                 const char *data,
+                                 size_t size,
+                                 bool load_as_fp16) const {
+    phi::DeviceContextPool &pool = phi::DeviceContextPool::Instance();
+    auto &dev_ctx = *pool.Get(place);
+    auto out_vars = context.MultiOutputVar("Out");
+
+    std::vector<phi::DenseTensor *> tensors;
+    tensors.reserve(out_vars.size());
+    for (auto *var : out_vars) {
+      tensors.push_back(var->GetMutable<phi::DenseTensor>());
+    }
+    framework::DeserializeFromCombinedBuffer(data, size, tensors, dev_ctx);
+
+    if (load_as_fp16) {
+      for (size_t i = 0; i < out_vars.size(); i++) {
+        auto *tensor = tensors[i];
+        auto in_dtype = tensor->dtype();
+        auto out_dtype = phi::DataType::FLOAT16;
+        if (in_dtype != out_dtype) {
+          // convert to float16 tensor
+          auto in_kernel_type =
+              phi::KernelKey(place, phi::DataLayout::ALL_LAYOUT, in_dtype);
+          auto out_kernel_type =
+              phi::KernelKey(place, phi::DataLayout::ALL_LAYOUT, out_dtype);
+          phi::DenseTensor fp16_tensor;
+          // copy LoD info to the new tensor
+          fp16_tensor.set_lod(tensor->lod());
+          framework::TransDataType(
+              in_kernel_type, out_kernel_type, *tensor, &fp16_tensor);
+
+          // reset output tensor
+          out_vars[i]->Clear();
+          tensor = out_vars[i]->GetMutable<phi::DenseTensor>();
+          tensor->set_lod(fp16_tensor.lod());
+          tensor->ShareDataWith(fp16_tensor);
+        }
+      }
     }
   }
 
@@ -22,9 +22,11 @@ limitations under the License. */
 #include <string>
 #include <unordered_map>
 
+#include "paddle/common/flags.h"
 #include "paddle/fluid/framework/convert_utils.h"
 #include "paddle/fluid/framework/data_type.h"
 #include "paddle/fluid/framework/data_type_transform.h"
+#include "paddle/fluid/framework/io/direct_stream_writer.h"
 #include "paddle/fluid/framework/lod_tensor.h"
 #include "paddle/fluid/framework/op_registry.h"
 #include "paddle/fluid/framework/raw_tensor.h"
@@ -33,6 +35,8 @@ limitations under the License. */
 #include "paddle/phi/common/port.h"
 #include "paddle/phi/core/dense_tensor.h"
 
+COMMON_DECLARE_bool(checkpoint_direct_io);
+
 namespace paddle {
 namespace operators {
 
@@ -48,6 +52,22 @@ inline void SaveToMemory(const std::string& file_path,
     *output = ss.str();
   } else {
     MkDirRecursively(DirName(file_path).c_str());
+#ifndef _WIN32
+    if (FLAGS_checkpoint_direct_io) {
+      paddle::framework::DirectOFStream fout(file_path);
+      PADDLE_ENFORCE_EQ(fout.IsOpen(),
+                        true,
+                        phi::errors::Unavailable(
+                            "Cannot open %s to save variables.", file_path));
+      fout << ss.str();
+      fout.Close();
+      PADDLE_ENFORCE_EQ(
+          fout.fail(),
+          false,
+          phi::errors::Unavailable("Failed to write %s.", file_path));
+      return;
+    }
+#endif
     std::ofstream fout(file_path, std::ios::binary);
     PADDLE_ENFORCE_EQ(static_cast<bool>(fout),
                       true,
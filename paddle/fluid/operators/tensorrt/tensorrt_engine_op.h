@@ -15,7 +15,9 @@
 #pragma once
 
 #ifdef PADDLE_WITH_CUDA
+#include <atomic>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -176,6 +178,11 @@ class TensorRTEngineOp : public framework::OperatorBase {
   std::string model_opt_cache_dir_;
   bool use_static_engine_;
   phi::DataType precision_mode_;
+  // Background rebuild state for allow_build_at_runtime. While a rebuild is
+  // in flight the op serves every request through the native subgraph, so
+  // the serving thread never blocks on engine construction.
+  mutable std::future<void> engine_rebuild_future_;
+  mutable std::atomic<bool> engine_rebuild_in_flight_{false};
 
  public:
   TensorRTEngineOp(const std::string &type,
@@ -237,6 +244,14 @@ class TensorRTEngineOp : public framework::OperatorBase {
     }
   }
 
+  ~TensorRTEngineOp() override {
+    // The background rebuild captures this op and the engine; it has to
+    // finish before either is destroyed.
+    if (engine_rebuild_future_.valid()) {
+      engine_rebuild_future_.wait();
+    }
+  }
+
   void PrepareTRTEngine(const framework::Scope &scope,
                         TensorRTEngine *engine) const {
     LOG(INFO) << "Prepare TRT engine (Optimize model structure, Select OP "
@@ -272,6 +287,12 @@ class TensorRTEngineOp : public framework::OperatorBase {
       return;
     }
     auto *trt_engine = GetEngine(scope, dev_place);
+    if (engine_rebuild_in_flight_.load(std::memory_order_acquire)) {
+      // A background rebuild owns the engine right now; keep serving through
+      // the native subgraph until the new engine is ready.
+      RunNativeImpl(scope, dev_place);
+      return;
+    }
     if (trt_engine->with_dynamic_shape()) {
       // get runtime input shapes and shape tensors.
       std::map<std::string, std::vector<int32_t>> runtime_input_shape;
@@ -388,7 +409,9 @@ class TensorRTEngineOp : public framework::OperatorBase {
                                                 &shape_changed_name,
                                                 &tensor_changed_name);
         if (is_adjusted) {
-          LOG(INFO) << "Adjust dynamic shape range, rebuild trt engine!";
+          LOG(INFO) << "Adjust dynamic shape range, rebuild trt engine in the "
+                       "background; serving continues on the native subgraph "
+                       "until the new engine is ready.";
           if (trt_engine->engine()) {
             trt_engine->ResetContext();
             trt_engine->ClearTensorMap();
@@ -400,7 +423,6 @@ class TensorRTEngineOp : public framework::OperatorBase {
           if (anc == nullptr) {
             anc = &scope;
           }
-          PrepareTRTEngine(*anc, trt_engine);
           // update shape_range_info_pbtxt
           if (!shape_range_info_path_.empty()) {
             inference::UpdateShapeRangeInfo(shape_range_info_path_,
@@ -414,20 +436,42 @@ class TensorRTEngineOp : public framework::OperatorBase {
                                             tensor_changed_name);
           }
 
-          if (use_static_engine_) {
-            nvinfer1::IHostMemory *serialized_engine_data =
-                trt_engine->Serialize();
-            std::string trt_engine_serialized_data =
-                std::string((const char *)serialized_engine_data->data(),
-                            serialized_engine_data->size());
-            inference::analysis::SaveTrtEngineSerializedDataToFile(
-                inference::analysis::GetTrtEngineSerializedPath(
-                    model_opt_cache_dir_, engine_key_),
-                trt_engine_serialized_data);
-            LOG(INFO) << "Save TRT Optimized Info to "
-                      << inference::analysis::GetTrtEngineSerializedPath(
-                             model_opt_cache_dir_, engine_key_);
-          }
+          // Rebuild off the serving thread. The in-flight flag routes every
+          // request (this one included) through the native subgraph until
+          // the flag clears, so nothing touches the engine while it is
+          // being reconstructed.
+          engine_rebuild_in_flight_.store(true, std::memory_order_release);
+          engine_rebuild_future_ =
+              std::async(std::launch::async, [this, anc, trt_engine] {
+                TensorRTEngine::predictor_id_per_thread = predictor_id_;
+                try {
+                  PrepareTRTEngine(*anc, trt_engine);
+                  if (use_static_engine_) {
+                    nvinfer1::IHostMemory *serialized_engine_data =
+                        trt_engine->Serialize();
+                    std::string trt_engine_serialized_data =
+                        std::string((const char *)serialized_engine_data->data(),
+                                    serialized_engine_data->size());
+                    inference::analysis::SaveTrtEngineSerializedDataToFile(
+                        inference::analysis::GetTrtEngineSerializedPath(
+                            model_opt_cache_dir_, engine_key_),
+                        trt_engine_serialized_data);
+                    LOG(INFO) << "Save TRT Optimized Info to "
+                              << inference::analysis::GetTrtEngineSerializedPath(
+                                     model_opt_cache_dir_, engine_key_);
+                  }
+                  engine_rebuild_in_flight_.store(false,
+                                                  std::memory_order_release);
+                } catch (const std::exception &e) {
+                  // Leave the in-flight flag set: the engine state is
+                  // undefined after a failed build, so this op keeps serving
+                  // through the native subgraph.
+                  LOG(ERROR) << "Background TRT engine rebuild failed: "
+                             << e.what();
+                }
+              });
+          RunNativeImpl(scope, dev_place);
+          return;
         }
       }
     }
@@ -55,7 +55,8 @@ static PyObject *{name}(PyObject *self, PyObject *args, PyObject *kwargs) {{
     return static_api_{name}(self, args, kwargs);
   }} else {{
     VLOG(6) << "Call eager_api_{name}";
-    return eager_api_{name}(self, args, kwargs);
+    // The eager binding uses METH_FASTCALL; forward the tuple's item array.
+    return eager_api_{name}(self, PySequence_Fast_ITEMS(args), PyTuple_GET_SIZE(args), nullptr);
   }}
 }}"""
 
@@ -73,7 +74,8 @@ static PyObject *sparse_{name}(PyObject *self, PyObject *args, PyObject *kwargs)
     return static_api_{name}{name_suffix}(self, args, kwargs);
   }} else {{
     VLOG(6) << "Call eager_api_{name}";
-    return sparse::eager_api_{name}(self, args, kwargs);
+    // The eager binding uses METH_FASTCALL; forward the tuple's item array.
+    return sparse::eager_api_{name}(self, PySequence_Fast_ITEMS(args), PyTuple_GET_SIZE(args), nullptr);
   }}
 }}"""
 
@@ -181,6 +183,7 @@ NO_NEED_GEN_STATIC_ONLY_APIS = [
     'embedding_grad_sparse',
     'ftrl',
     'fused_adam_',
+    'fused_lamb_',
     'fused_batch_norm_act_',
     'fused_bn_add_activation_',
     'fused_elemwise_activation',
@@ -32,6 +32,11 @@ namespace pir {
  * @param[in] trainable    (Optional parameter, default to true) If true,
  * operation has opresult_attrs for training like stop_gradient,persistable;
  * Otherwise, it may only has opinfo attrs.
+ * @param[in] binary       (Optional parameter, default to false) If true, the
+ * program is written in the binary (MessagePack) encoding of the same
+ * versioned schema instead of json text, which is much faster to load.
+ * Cannot be combined with readable. ReadModule detects the encoding
+ * automatically.
  *
  * @return void。
  *
@@ -43,7 +48,8 @@ void IR_API WriteModule(const pir::Program& program,
                         const uint64_t& pir_version,
                         bool overwrite,
                         bool readable = false,
-                        bool trainable = true);
+                        bool trainable = true,
+                        bool binary = false);
 
 /**
  * @brief Gets a PIR program from the specified file path.
@@ -30,7 +30,8 @@ void WriteModule(const pir::Program& program,
                  const uint64_t& pir_version,
                  bool overwrite,
                  bool readable,
-                 bool trainable) {
+                 bool trainable,
+                 bool binary) {
   PADDLE_ENFORCE_EQ(
       FileExists(file_path) && !overwrite,
       false,
@@ -38,6 +39,11 @@ void WriteModule(const pir::Program& program,
           "%s exists!, cannot save to it when overwrite is set to false.",
           file_path,
           overwrite));
+  PADDLE_ENFORCE_EQ(readable && binary,
+                    false,
+                    common::errors::InvalidArgument(
+                        "readable and binary cannot both be set; the binary "
+                        "encoding has no readable form."));
 
   // write base code
   Json total;
@@ -49,7 +55,14 @@ void WriteModule(const pir::Program& program,
   // write program
   total[PROGRAM] = writer.GetProgramJson(&program);
   std::string total_str;
-  if (readable) {
+  if (binary) {
+    // MessagePack encoding of the same schema: records keep the one-byte
+    // structure keys from schema.h, the payload shrinks by roughly a third
+    // and floating point attributes round-trip exactly.
+    std::vector<std::uint8_t> msgpack = Json::to_msgpack(total);
+    total_str.assign(reinterpret_cast<const char*>(msgpack.data()),
+                     msgpack.size());
+  } else if (readable) {
     total_str = total.dump(4);
   } else {
     total_str = total.dump();
@@ -68,8 +81,17 @@ void WriteModule(const pir::Program& program,
 bool ReadModule(const std::string& file_path,
                 pir::Program* program,
                 const uint64_t& pir_version) {
-  std::ifstream f(file_path);
-  Json data = Json::parse(f);
+  std::ifstream f(file_path, std::ios::binary);
+  // A binary (MessagePack) module starts with a fix-map byte (0x80-0x8f or
+  // 0xde/0xdf), while json text starts with ASCII; sniff the first byte so
+  // both encodings load through the same entry point.
+  int first_byte = f.peek();
+  Json data;
+  if (first_byte != EOF && (first_byte & 0x80)) {
+    data = Json::from_msgpack(f);
+  } else {
+    data = Json::parse(f);
+  }
 
   if (data.contains(BASE_CODE) && data[BASE_CODE].contains(MAGIC) &&
       data[BASE_CODE][MAGIC] == PIR) {
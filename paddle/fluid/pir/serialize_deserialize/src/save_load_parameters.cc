@@ -205,11 +205,27 @@ void LoadCombineFunction(const std::string& file_path,
                         "The number of variables to be saved is %d, expect "
                         "it to be greater than 0.",
                         out->size()));
+  PADDLE_ENFORCE_EQ(out->size(),
+                    names.size(),
+                    phi::errors::InvalidArgument(
+                        "The number of tensors %d mismatches the number of "
+                        "parameter names %d.",
+                        out->size(),
+                        names.size()));
   const phi::DeviceContext* dev_ctx = GetDeviceContext(*(out->at(0)), place);
+
+  // slurp the whole file with one sequential read and deserialize the
+  // independent records on multiple threads; a record count mismatch is
+  // rejected by DeserializeFromCombinedBuffer
+  fin.seekg(0, std::ios::end);
+  std::vector<char> buffer(static_cast<size_t>(fin.tellg()));
+  fin.seekg(0, std::ios::beg);
+  fin.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  paddle::framework::DeserializeFromCombinedBuffer(
+      buffer.data(), buffer.size(), *out, *dev_ctx);
+
   for (size_t i = 0; i < names.size(); i++) {
     auto tensor = out->at(i);
-    paddle::framework::DeserializeFromStream(fin, tensor, *dev_ctx);
-
     auto in_dtype = tensor->dtype();
     auto out_dtype = load_as_fp16 ? phi::DataType::FLOAT16 : in_dtype;
     if (in_dtype != out_dtype) {
@@ -217,12 +233,6 @@ void LoadCombineFunction(const std::string& file_path,
       *tensor = CastTensorType(dev_ctx, cast_in, out_dtype);
     }
   }
-  fin.peek();
-  PADDLE_ENFORCE_EQ(
-      fin.eof(),
-      true,
-      phi::errors::Unavailable("Not allowed to load partial data via "
-                               "load_combine_op, please use load_op instead."));
 }
 
 }  // namespace pir
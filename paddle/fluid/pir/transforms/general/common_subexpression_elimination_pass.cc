@@ -149,8 +149,9 @@ struct Expression {
  public:
   Expression(
       pir::Operation* op,
-      std::unordered_map<void*, std::pair<size_t, bool>>* op_info_registry)
-      : op_(op), op_info_registry_(op_info_registry) {}
+      std::unordered_map<void*, std::pair<size_t, bool>>* op_info_registry,
+      const std::unordered_map<void*, pir::Value>* value_reps)
+      : op_(op), op_info_registry_(op_info_registry), value_reps_(value_reps) {}
 
   pir::Operation* op() const { return op_; }
 
@@ -393,39 +394,36 @@ struct Expression {
     return true;
   }
 
+  // Resolve a value to its equivalence class representative: the matching
+  // result of the first operation found equal to its defining op. Values
+  // whose defining op has no match yet represent themselves.
+  pir::Value Representative(const pir::Value& value) const {
+    auto rep_iter = value_reps_->find(reinterpret_cast<void*>(value.impl()));
+    return rep_iter == value_reps_->end() ? value : rep_iter->second;
+  }
+
   bool CheckValueEqual(const pir::Value& lhs, const pir::Value& rhs) const {
-    if (IsTerminateValue(lhs) != IsTerminateValue(rhs)) {
-      VLOG(7) << "[CheckValueEqual] lhs and rhs has different terminate type";
-      return false;
-    }
-    // Compare two terminate values
-    if (IsTerminateValue(lhs) && IsTerminateValue(rhs)) {
-      if (lhs != rhs) {
-        VLOG(7) << "[CheckValueEqual] lhs and rhs has different terminate "
-                   "value";
-        return false;
-      }
-      return true;
-    }
-    // Compare two non-terminate values
-    if (!CheckOperationEqual(lhs.defining_op(), rhs.defining_op())) {
-      VLOG(7) << "[CheckValueEqual] lhs and rhs has different defining op";
+    // Operations are visited in program order and every matched op has its
+    // results mapped to the canonical ones, so two equivalent operands
+    // always share a representative here. Comparing representatives keeps
+    // each equality check linear in the operand count instead of walking
+    // the whole defining subgraph again.
+    if (Representative(lhs) != Representative(rhs)) {
+      VLOG(7) << "[CheckValueEqual] lhs and rhs has different representative";
       return false;
     }
     if (lhs.type() != rhs.type()) {
       VLOG(7) << "[CheckValueEqual] lhs and rhs has different type";
       return false;
     }
-    if (GetOpResultId(lhs) != GetOpResultId(rhs)) {
-      VLOG(7) << "[CheckValueEqual] lhs and rhs has different result id";
-      return false;
-    }
     return true;
   }
 
   pir::Operation* op_;
   std::unordered_map<void*, std::pair<size_t, bool>>*
       op_info_registry_;  // owned by ExpressionTable
+  const std::unordered_map<void*, pir::Value>*
+      value_reps_;  // owned by ExpressionTable
 };
 
 struct ExpressionHash {
@@ -452,7 +450,14 @@ struct ExpressionTable {
   }
 
   Expression CreateExpression(pir::Operation* op) {
-    return Expression(op, &op_info_registry_);
+    return Expression(op, &op_info_registry_, &value_reps_);
+  }
+
+  void MapEquivalent(pir::Operation* op, pir::Operation* existing_op) {
+    for (uint32_t i = 0; i < op->num_results(); ++i) {
+      value_reps_[reinterpret_cast<void*>(op->result(i).impl())] =
+          existing_op->result(i);
+    }
   }
 
   void Insert(Expression expr) { common_exprs_.insert(expr); }
@@ -474,6 +479,7 @@ struct ExpressionTable {
  private:
   std::unordered_set<Expression, ExpressionHash, ExpressionEqual> common_exprs_;
   std::unordered_map<void*, std::pair<size_t, bool>> op_info_registry_;
+  std::unordered_map<void*, pir::Value> value_reps_;
 };
 
 struct CSEAnalyzer {
@@ -504,6 +510,10 @@ struct CSEAnalyzer {
         VLOG(7) << "Found common subexpression: " << op->name();
         to_erase_ops_.push_back(
             std::make_pair(expr.op(), maybe_same_expression.value().op()));
+        // Later equality checks on users of this op compare representatives,
+        // so record which canonical results stand in for its results.
+        expression_table->MapEquivalent(expr.op(),
+                                        maybe_same_expression.value().op());
       }
     }
   }
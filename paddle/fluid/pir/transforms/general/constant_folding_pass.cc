@@ -15,6 +15,7 @@
 #include "paddle/fluid/pir/transforms/general/constant_folding_pass.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -44,6 +45,7 @@
 #include "paddle/pir/include/core/parameter.h"
 #include "paddle/pir/include/core/program.h"
 #include "paddle/pir/include/core/region.h"
+#include "paddle/pir/include/core/utils.h"
 #include "paddle/pir/include/core/value.h"
 #include "paddle/pir/include/pass/pass.h"
 #include "paddle/pir/include/pattern_rewrite/frozen_rewrite_pattern_set.h"
@@ -52,6 +54,24 @@
 
 namespace {
 
+// Memo of folds already evaluated against a scope, keyed by the structural
+// hash of (op kind, attributes, constant input var names, result types) and
+// mapping to the output var names the evaluation produced. The memo lives
+// for the process, so every constant_folding_pass run against the same
+// scope - including later compilations of the same model in iterative
+// workflows - reuses earlier evaluations instead of re-running the kernels.
+// Entries whose vars were meanwhile erased from the scope are dropped on
+// lookup.
+using FoldingMemo = std::unordered_map<size_t, std::vector<std::string>>;
+
+FoldingMemo& GetFoldingMemo(const paddle::framework::Scope* scope) {
+  static std::mutex memo_mutex;
+  static std::unordered_map<const paddle::framework::Scope*, FoldingMemo>
+      memos;
+  std::lock_guard<std::mutex> guard(memo_mutex);
+  return memos[scope];
+}
+
 class ConstantFoldingPattern : public pir::RewritePattern {
  public:
   ConstantFoldingPattern(
@@ -279,6 +299,22 @@ class ConstantFoldingPattern : public pir::RewritePattern {
   std::vector<std::string> RunOp(
       pir::Operation* op,
       pir::PatternRewriter& rewriter) const {  // NOLINT
+    auto& memo = GetFoldingMemo(scope_);
+    const size_t folding_key = FoldingKey(op);
+    auto memo_iter = memo.find(folding_key);
+    if (memo_iter != memo.end()) {
+      bool vars_alive = !memo_iter->second.empty();
+      for (const auto& var_name : memo_iter->second) {
+        vars_alive = vars_alive && scope_->FindVar(var_name) != nullptr;
+      }
+      if (vars_alive) {
+        VLOG(4) << "constant_folding_pass reuses memoized fold of ["
+                << op->name() << "] op";
+        return memo_iter->second;
+      }
+      memo.erase(memo_iter);
+    }
+
     pir::Program new_program(rewriter.ir_context());
     auto output_var_names =
         BuildProgramFromOperation(op, &new_program, rewriter);
@@ -293,9 +329,50 @@ class ConstantFoldingPattern : public pir::RewritePattern {
         place_, {}, kernel_program->block(), scope_, *exe_config_);
 
     core.Run({});
+    memo[folding_key] = output_var_names;
     return output_var_names;
   }
 
+  size_t FoldingKey(pir::Operation* op) const {
+    size_t key = std::hash<std::string>{}(op->name());
+    // Attribute iteration order is unspecified, so fold the entries in with
+    // a commutative combine.
+    size_t attrs_hash = 0;
+    for (auto& [attr_name, attr] : op->attributes()) {
+      attrs_hash ^= pir::detail::hash_combine(
+          std::hash<std::string>{}(attr_name), attr.hash());
+    }
+    key = pir::detail::hash_combine(key, attrs_hash);
+    // The inputs are parameter or constant-tensor vars (possibly behind a
+    // combine op); their scope var names identify their contents.
+    for (uint32_t i = 0; i < op->num_operands(); i++) {
+      if (!op->operand_source(i)) {
+        key = pir::detail::hash_combine(key, 0);
+        continue;
+      }
+      auto* prev_op = pir::GetDefiningOpForInput(op, i);
+      if (prev_op->isa<pir::CombineOp>()) {
+        for (uint32_t j = 0; j < prev_op->num_operands(); j++) {
+          key = pir::detail::hash_combine(
+              key,
+              std::hash<std::string>{}(pir::GetParameterNameFromValue(
+                  prev_op->operand_source(j))));
+        }
+      } else {
+        key = pir::detail::hash_combine(
+            key,
+            std::hash<std::string>{}(
+                pir::GetParameterNameFromValue(op->operand_source(i))));
+      }
+    }
+    for (uint32_t i = 0; i < op->num_results(); i++) {
+      if (op->result(i) && op->result(i).type()) {
+        key = pir::detail::hash_combine(key, op->result(i).type().hash());
+      }
+    }
+    return key;
+  }
+
   template <typename Op>
   Op BuildParameterOrConstantTensorOP(
       uint32_t index,
@@ -320,6 +320,21 @@ std::unordered_map<pir::Operation*, std::string> GetInplaceOps(
 
   std::unordered_set<pir::Value> visited_values;
 
+  // Both the external-value set and the blacklist are invariant over the
+  // block; computing them per op made this pass quadratic on large graphs.
+  const auto used_external_value_vec = GetUsedExternalValue(block);
+  const std::unordered_set<pir::Value> used_external_values(
+      used_external_value_vec.begin(), used_external_value_vec.end());
+
+  std::regex reg(",");
+  std::unordered_set<std::string> elems{
+      std::sregex_token_iterator(FLAGS_ir_inplace_kernel_blacklist.begin(),
+                                 FLAGS_ir_inplace_kernel_blacklist.end(),
+                                 reg,
+                                 -1),
+      std::sregex_token_iterator()};
+  elems.erase("");
+
   for (auto& op : block) {
     for (size_t i = 0; i < op.num_operands(); ++i) {
       visited_values.insert(op.operand_source(i));
@@ -378,15 +393,6 @@ std::unordered_map<pir::Operation*, std::string> GetInplaceOps(
     pir::OpInfo upper_inplace_op_info =
         pir::IrContext::Instance()->GetRegisteredOpInfo(upper_op_name + "_");
 
-    std::regex reg(",");
-    std::unordered_set<std::string> elems{
-        std::sregex_token_iterator(FLAGS_ir_inplace_kernel_blacklist.begin(),
-                                   FLAGS_ir_inplace_kernel_blacklist.end(),
-                                   reg,
-                                   -1),
-        std::sregex_token_iterator()};
-    elems.erase("");
-
     if (elems.count(upper_op_name)) {
       VLOG(6) << upper_op_name
               << "'s value can't delete or doesn't have inplace op, so that "
@@ -422,8 +428,6 @@ std::unordered_map<pir::Operation*, std::string> GetInplaceOps(
     std::unordered_map<uint32_t, uint32_t> inplace_out_2_in =
         upper_inplace_op_info_parser.GetInplaceIdMap();
 
-    const auto used_external_values = GetUsedExternalValue(block);
-
     bool can_do_inplace = true;
     for (auto& kv : inplace_out_2_in) {
       uint32_t out_slot = kv.first;
@@ -436,13 +440,8 @@ std::unordered_map<pir::Operation*, std::string> GetInplaceOps(
           (visited_values.count(op.result(out_slot)) > 0) ||
           (!CanBeDeleted(op.result(out_slot))) ||
           IsLastUser(op.operand_source(in_slot), use_count_map, inplace_map) ||
-          (std::find(used_external_values.begin(),
-                     used_external_values.end(),
-                     op.operand_source(in_slot)) !=
-           used_external_values.end()) ||
-          (std::find(used_external_values.begin(),
-                     used_external_values.end(),
-                     op.result(out_slot)) != used_external_values.end())) {
+          (used_external_values.count(op.operand_source(in_slot)) > 0) ||
+          (used_external_values.count(op.result(out_slot)) > 0)) {
         can_do_inplace = false;
         VLOG(6) << upper_op_name
                 << "'s value has been visited or reused by other inplace op, "
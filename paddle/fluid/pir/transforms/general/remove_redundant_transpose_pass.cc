@@ -81,6 +81,93 @@ class RemoveInvalidTransposePattern : public paddle::drr::DrrPatternBase {
   }
 };
 
+// Sink a transpose below a layout-agnostic elementwise op:
+//   unary(transpose(x, perm)) -> transpose(unary(x), perm)
+// Transpose pairs inserted by layout decisions (layout_autotune,
+// transfer_layout_pass) are usually separated by such ops and never become
+// adjacent; sinking moves them together so the two patterns above can merge
+// the perms and drop the identity. The op count is unchanged when nothing
+// cancels, and transposes only ever move towards the graph outputs, so the
+// rewrite terminates.
+class SinkTransposeThroughUnaryPattern : public paddle::drr::DrrPatternBase {
+ private:
+  std::string unary_name_;
+  std::vector<std::string> attr_names_;
+
+ public:
+  SinkTransposeThroughUnaryPattern(const std::string &unary_name,
+                                   const std::vector<std::string> &attr_names)
+      : unary_name_(unary_name), attr_names_(attr_names) {}
+
+  std::string name() const override {
+    return "SinkTransposeThroughUnaryPattern";
+  }
+  uint32_t benefit() const override { return 2; }
+
+  void operator()(paddle::drr::DrrPatternContext *ctx) const override {
+    paddle::drr::SourcePattern pat = ctx->SourcePattern();
+    const auto &transpose =
+        pat.Op("pd_op.transpose", {{"perm", pat.Attr("perm")}});
+    std::unordered_map<std::string, paddle::drr::Attribute> unary_attrs;
+    for (const auto &attr_name : attr_names_) {
+      unary_attrs.emplace(attr_name, pat.Attr(attr_name));
+    }
+    const auto &unary = pat.Op(unary_name_, unary_attrs);
+    pat.Tensor("ret") = unary(transpose(pat.Tensor("arg_transpose")));
+
+    paddle::drr::ResultPattern res = pat.ResultPattern();
+    const auto &res_unary = res.Op(unary_name_, unary_attrs);
+    const auto &res_transpose =
+        res.Op("pd_op.transpose", {{"perm", pat.Attr("perm")}});
+    res.Tensor("ret") =
+        res_transpose(res_unary(res.Tensor("arg_transpose")));
+  }
+};
+
+// Binary counterpart: when both operands arrive through transposes with the
+// same perm, apply the op on the untransposed operands and transpose once:
+//   binary(transpose(x, perm), transpose(y, perm))
+//     -> transpose(binary(x, y), perm)
+// This also halves the conversions on residual branches where both inputs
+// were transposed. Perms of different lengths (rank-changing broadcasts)
+// fail the equality constraint and are left alone.
+class SinkTransposeThroughBinaryPattern : public paddle::drr::DrrPatternBase {
+ private:
+  std::string binary_name_;
+
+ public:
+  explicit SinkTransposeThroughBinaryPattern(const std::string &binary_name)
+      : binary_name_(binary_name) {}
+
+  std::string name() const override {
+    return "SinkTransposeThroughBinaryPattern";
+  }
+  uint32_t benefit() const override { return 2; }
+
+  void operator()(paddle::drr::DrrPatternContext *ctx) const override {
+    paddle::drr::SourcePattern pat = ctx->SourcePattern();
+    const auto &transpose_x =
+        pat.Op("pd_op.transpose", {{"perm", pat.Attr("perm_x")}});
+    const auto &transpose_y =
+        pat.Op("pd_op.transpose", {{"perm", pat.Attr("perm_y")}});
+    const auto &binary = pat.Op(binary_name_);
+    pat.Tensor("ret") = binary(transpose_x(pat.Tensor("x")),
+                               transpose_y(pat.Tensor("y")));
+    pat.AddConstraint([](const paddle::drr::MatchContext &match_ctx) {
+      const auto &perm_x = match_ctx.Attr<std::vector<int>>("perm_x");
+      const auto &perm_y = match_ctx.Attr<std::vector<int>>("perm_y");
+      return perm_x == perm_y;
+    });
+
+    paddle::drr::ResultPattern res = pat.ResultPattern();
+    const auto &res_binary = res.Op(binary_name_);
+    const auto &res_transpose =
+        res.Op("pd_op.transpose", {{"perm", pat.Attr("perm_x")}});
+    res.Tensor("ret") =
+        res_transpose(res_binary(res.Tensor("x"), res.Tensor("y")));
+  }
+};
+
 class RemoveRedundantTransposePass : public pir::PatternRewritePass {
  public:
   RemoveRedundantTransposePass()
@@ -90,6 +177,35 @@ class RemoveRedundantTransposePass : public pir::PatternRewritePass {
     pir::RewritePatternSet ps(context);
     ps.Add(paddle::drr::Create<RemoveRedundantTransposePattern>(context));
     ps.Add(paddle::drr::Create<RemoveInvalidTransposePattern>(context));
+    // Elementwise ops a transpose commutes with; attr-carrying ones list the
+    // attributes to forward onto the rebuilt op.
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+        unary_ops = {
+            {"pd_op.relu", {}},
+            {"pd_op.sigmoid", {}},
+            {"pd_op.silu", {}},
+            {"pd_op.tanh", {}},
+            {"pd_op.exp", {}},
+            {"pd_op.abs", {}},
+            {"pd_op.sqrt", {}},
+            {"pd_op.rsqrt", {}},
+            {"pd_op.hardswish", {}},
+            {"pd_op.gelu", {"approximate"}},
+            {"pd_op.leaky_relu", {"negative_slope"}},
+            {"pd_op.cast", {"dtype"}},
+        };
+    for (const auto &[op_name, attr_names] : unary_ops) {
+      ps.Add(paddle::drr::Create<SinkTransposeThroughUnaryPattern>(
+          context, op_name, attr_names));
+    }
+    for (const auto &op_name : {"pd_op.add",
+                                "pd_op.subtract",
+                                "pd_op.multiply",
+                                "pd_op.maximum",
+                                "pd_op.minimum"}) {
+      ps.Add(paddle::drr::Create<SinkTransposeThroughBinaryPattern>(context,
+                                                                    op_name));
+    }
     return ps;
   }
 };
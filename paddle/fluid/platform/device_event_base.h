@@ -89,6 +89,7 @@ class DeviceEvent {
     if (!recorded_) {
       recorded_ = true;
     }
+    completed_ = false;
     event_recorder_[type_id_](this, dev_ctx);
   }
 
@@ -101,7 +102,17 @@ class DeviceEvent {
       VLOG(4) << "Event " << this << " is not recorded yet, and skip query!";
       return true;
     }
-    return event_querier_[type_id_](this);
+    // An event that has completed stays completed until the next Record, so
+    // repeated queries (e.g. several waiters sharing one producer event) can
+    // be answered without another device API call.
+    if (completed_) {
+      return true;
+    }
+    bool ret = event_querier_[type_id_](this);
+    if (ret) {
+      completed_ = true;
+    }
+    return ret;
   }
 
   void Finish() const {
@@ -110,6 +121,7 @@ class DeviceEvent {
         phi::errors::Unavailable("event_finisher_[%d] shall not be nullptr.",
                                  type_id_));
     event_finisher_[type_id_](this);
+    completed_ = true;
   }
 
   void SetFinished() {
@@ -118,6 +130,7 @@ class DeviceEvent {
         phi::errors::Unavailable(
             "event_finished_setter_[%d] shall not be nullptr.", type_id_));
     event_finished_setter_[type_id_](this);
+    completed_ = true;
   }
 
   void Reset() {
@@ -126,6 +139,7 @@ class DeviceEvent {
         phi::errors::Unavailable("event_resetter_[%d] shall not be nullptr.",
                                  type_id_));
     event_resetter_[type_id_](this);
+    completed_ = false;
   }
 
   void Wait(const DeviceType& waiter_type, const DeviceContext* context) const {
@@ -160,6 +174,11 @@ class DeviceEvent {
   // So, we add flag recorded_ to handle this case uniformly.
   bool recorded_{false};
 
+  // Sticky completion state, reset by the next Record/Reset. Like recorded_,
+  // this caching is not thread-safe; callers already serialize Record against
+  // Query on the same event.
+  mutable bool completed_{false};
+
   static EventCreateFunction event_creator_[MaxDeviceTypes];
   static EventRecordFunction event_recorder_[MaxDeviceTypes];
   static EventQueryFunction event_querier_[MaxDeviceTypes];
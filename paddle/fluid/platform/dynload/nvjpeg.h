@@ -25,12 +25,15 @@ namespace dynload {
   using DynLoad__##__name = phi::dynload::DynLoad__##__name; \
   extern DynLoad__##__name __name
 
-#define NVJPEG_RAND_ROUTINE_EACH(__macro) \
-  __macro(nvjpegCreateSimple);            \
-  __macro(nvjpegJpegStateCreate);         \
-  __macro(nvjpegGetImageInfo);            \
-  __macro(nvjpegJpegStateDestroy);        \
-  __macro(nvjpegDecode);
+#define NVJPEG_RAND_ROUTINE_EACH(__macro)  \
+  __macro(nvjpegCreateSimple);             \
+  __macro(nvjpegJpegStateCreate);          \
+  __macro(nvjpegGetImageInfo);             \
+  __macro(nvjpegJpegStateDestroy);         \
+  __macro(nvjpegDecode);                   \
+  __macro(nvjpegDecodeBatchedInitialize);  \
+  __macro(nvjpegDecodeBatched);            \
+  __macro(nvjpegDestroy);
 
 NVJPEG_RAND_ROUTINE_EACH(PLATFORM_DECLARE_DYNAMIC_LOAD_NVJPEG_WRAP);
 
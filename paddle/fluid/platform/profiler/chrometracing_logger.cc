@@ -416,7 +416,8 @@ void ChromeTracingLogger::HandleTypeKernel(
       "warps per SM": %f,
       "grid": [%d, %d, %d],
       "block": [%d, %d, %d],
-      "theoretical achieved occupancy %%": %.3f
+      "theoretical achieved occupancy %%": %.3f,
+      "instruction id": %llu
     }
   },
   )JSON"),
@@ -443,7 +444,8 @@ void ChromeTracingLogger::HandleTypeKernel(
       kernel_info.block_x,
       kernel_info.block_y,
       kernel_info.block_z,
-      kernel_info.occupancy * 100);
+      kernel_info.occupancy * 100,
+      kernel_info.external_id);
 }
 
 void ChromeTracingLogger::HandleTypeMemcpy(
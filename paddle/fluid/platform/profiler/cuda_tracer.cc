@@ -64,12 +64,14 @@ void CudaTracer::StartTracing() {
   ConsumeBuffers();
   tracing_start_ns_ = PosixInNsec();
   state_ = TracerState::STARTED;
+  ExternalCorrelationEnabled().store(true, std::memory_order_relaxed);
 }
 
 void CudaTracer::StopTracing() {
   PADDLE_ENFORCE_EQ(state_,
                     TracerState::STARTED,
                     phi::errors::PreconditionNotMet("Tracer must be STARTED"));
+  ExternalCorrelationEnabled().store(false, std::memory_order_relaxed);
   DisableCuptiActivity();
   state_ = TracerState::STOPED;
 }
@@ -79,6 +81,7 @@ void CudaTracer::CollectTraceData(TraceEventCollector* collector) {
                     TracerState::STOPED,
                     phi::errors::PreconditionNotMet("Tracer must be STOPED"));
   ProcessCuptiActivity(collector);
+  collector->ApplyExternalCorrelations();
 }
 
 int CudaTracer::ProcessCuptiActivity(TraceEventCollector* collector) {
@@ -124,6 +127,11 @@ void CudaTracer::EnableCuptiActivity() {
   CUPTI_CALL(dynload::cuptiActivityEnable(CUPTI_ACTIVITY_KIND_DRIVER));
   CUPTI_CALL(dynload::cuptiActivityEnable(CUPTI_ACTIVITY_KIND_RUNTIME));
   CUPTI_CALL(dynload::cuptiActivityEnable(CUPTI_ACTIVITY_KIND_MEMSET));
+  CUPTI_CALL(dynload::cuptiActivityEnable(
+      CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION));
+  // populate the queued/submitted timestamps of kernel records, which
+  // separate launch/queue latency from execution time
+  CUPTI_CALL(dynload::cuptiActivityEnableLatencyTimestamps(1));
   VLOG(3) << "enable cupti activity";
 #endif
 }
@@ -136,6 +144,8 @@ void CudaTracer::DisableCuptiActivity() {
   CUPTI_CALL(dynload::cuptiActivityDisable(CUPTI_ACTIVITY_KIND_DRIVER));
   CUPTI_CALL(dynload::cuptiActivityDisable(CUPTI_ACTIVITY_KIND_RUNTIME));
   CUPTI_CALL(dynload::cuptiActivityDisable(CUPTI_ACTIVITY_KIND_MEMSET));
+  CUPTI_CALL(dynload::cuptiActivityDisable(
+      CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION));
   VLOG(3) << "disable cupti activity";
 #endif
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <vector>
@@ -42,6 +43,39 @@ class CudaTracer : public TracerBase {
 
   void CollectTraceData(TraceEventCollector* collector) override;
 
+  // Tags subsequent runtime API calls on the calling thread (and the
+  // kernels they launch) with an external id, so collected kernel events
+  // can be attributed to the interpreter instruction that issued them.
+  // Returns false (and records nothing) when tracing is not running;
+  // pop only if the push returned true. Implemented inline against the
+  // phi dynload wrappers so callers (the interpreter) need not link this
+  // library, which itself depends on the executor.
+  static bool PushExternalCorrelationId(uint64_t external_id) {
+#ifdef PADDLE_WITH_CUPTI
+    if (ExternalCorrelationEnabled().load(std::memory_order_relaxed)) {
+      return phi::dynload::cuptiActivityPushExternalCorrelationId(
+                 CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, external_id) ==
+             CUPTI_SUCCESS;
+    }
+#endif
+    return false;
+  }
+
+  static void PopExternalCorrelationId() {
+#ifdef PADDLE_WITH_CUPTI
+    uint64_t discarded = 0;
+    phi::dynload::cuptiActivityPopExternalCorrelationId(
+        CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, &discarded);
+#endif
+  }
+
+  // Set while tracing runs; function-local so the flag is shared by every
+  // translation unit using the inline push/pop above.
+  static std::atomic<bool>& ExternalCorrelationEnabled() {
+    static std::atomic<bool> enabled{false};
+    return enabled;
+  }
+
  private:
   struct ActivityBuffer {
     ActivityBuffer(uint8_t* addr, size_t size) : addr(addr), valid_size(size) {}
@@ -86,5 +120,25 @@ class CudaTracer : public TracerBase {
   std::vector<ActivityBuffer> activity_buffers_;
 };
 
+// RAII scope for PushExternalCorrelationId/PopExternalCorrelationId.
+// A no-op when CUPTI is absent or the tracer is not running.
+class CudaExternalCorrelationGuard {
+ public:
+  explicit CudaExternalCorrelationGuard(uint64_t external_id)
+      : pushed_(
+            CudaTracer::GetInstance().PushExternalCorrelationId(external_id)) {}
+
+  ~CudaExternalCorrelationGuard() {
+    if (pushed_) {
+      CudaTracer::GetInstance().PopExternalCorrelationId();
+    }
+  }
+
+  DISABLE_COPY_AND_ASSIGN(CudaExternalCorrelationGuard);
+
+ private:
+  const bool pushed_;
+};
+
 }  // namespace platform
 }  // namespace paddle
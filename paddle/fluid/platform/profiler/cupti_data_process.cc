@@ -98,10 +98,20 @@ void AddKernelRecord(const CUpti_ActivityKernel4* kernel,
   event.kernel_info.blocks_per_sm = blocks_per_sm;
   event.kernel_info.warps_per_sm = warps_per_sm;
   event.kernel_info.occupancy = occupancy;
+  // filled in from the external correlation records once all activity
+  // buffers have been consumed
+  event.kernel_info.external_id = 0;
 
   collector->AddDeviceEvent(std::move(event));
 }
 
+void AddExternalCorrelationRecord(
+    const CUpti_ActivityExternalCorrelation* correlation,
+    TraceEventCollector* collector) {
+  collector->AddExternalCorrelation(correlation->correlationId,
+                                    correlation->externalId);
+}
+
 const char* MemcpyKind(uint8_t kind) {
   switch (kind) {
     case CUPTI_ACTIVITY_MEMCPY_KIND_HTOD:
@@ -363,6 +373,11 @@ void ProcessCuptiActivityRecord(
                       start_ns,
                       collector);
       break;
+    case CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION:
+      AddExternalCorrelationRecord(
+          reinterpret_cast<const CUpti_ActivityExternalCorrelation*>(record),
+          collector);
+      break;
     case CUPTI_ACTIVITY_KIND_DRIVER:
     case CUPTI_ACTIVITY_KIND_RUNTIME:
       AddApiRecord(reinterpret_cast<const CUpti_ActivityAPI*>(record),
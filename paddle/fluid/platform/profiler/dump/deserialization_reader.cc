@@ -331,6 +331,9 @@ KernelEventInfo DeserializationReader::HandleKernelEventInfoProto(
   kernel_info.blocks_per_sm = kernel_info_proto.blocks_per_sm();
   kernel_info.warps_per_sm = kernel_info_proto.warps_per_sm();
   kernel_info.occupancy = kernel_info_proto.occupancy();
+  kernel_info.external_id = kernel_info_proto.has_external_id()
+                                ? kernel_info_proto.external_id()
+                                : 0;
   return kernel_info;
 }
 
@@ -283,6 +283,7 @@ void SerializationLogger::HandleTypeKernel(
   kernel_info->set_blocks_per_sm(info.blocks_per_sm);
   kernel_info->set_warps_per_sm(info.warps_per_sm);
   kernel_info->set_occupancy(info.occupancy);
+  kernel_info->set_external_id(info.external_id);
   // binding
   device_trace_event->set_allocated_kernel_info(kernel_info);
   current_device_trace_event_node_proto_->set_allocated_device_event(
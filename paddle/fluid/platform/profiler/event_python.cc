@@ -87,6 +87,7 @@ HostPythonNode* ProfilerResult::CopyTree(HostTraceEventNode* root) {
         device_python_node->blocks_per_sm = kernel_info.blocks_per_sm;
         device_python_node->warps_per_sm = kernel_info.warps_per_sm;
         device_python_node->occupancy = kernel_info.occupancy;
+        device_python_node->external_id = kernel_info.external_id;
       } else if (device_python_node->type == TracerEventType::Memcpy) {
         MemcpyEventInfo memcpy_info = devicenode->MemcpyInfo();
         device_python_node->num_bytes = memcpy_info.num_bytes;
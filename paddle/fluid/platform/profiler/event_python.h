@@ -64,6 +64,8 @@ struct DevicePythonNode {
   float warps_per_sm;
   // theoretical achieved occupancy
   float occupancy;
+  // Id of the interpreter instruction that launched the kernel, 0 if unknown.
+  uint64_t external_id;
   // The number of bytes transferred by the memory copy.
   uint64_t num_bytes;
   // the value being assigned to memory by the memory set.
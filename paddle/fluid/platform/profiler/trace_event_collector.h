@@ -34,6 +34,27 @@ class TraceEventCollector : public phi::TraceEventCollector {
     return op_supplement_events_;
   }
 
+  // Remembers which external id (interpreter instruction id) a CUPTI
+  // correlation id was tagged with at launch time.
+  void AddExternalCorrelation(uint32_t correlation_id, uint64_t external_id) {
+    external_correlations_[correlation_id] = external_id;
+  }
+
+  // Stamps the collected kernel events with the external id recorded for
+  // their correlation id. Called once every activity buffer has been
+  // consumed, since the correlation records and the kernel records of one
+  // launch may land in different buffers.
+  void ApplyExternalCorrelations() {
+    for (auto& event : device_events_) {
+      if (event.type == TracerEventType::Kernel) {
+        auto it = external_correlations_.find(event.correlation_id);
+        if (it != external_correlations_.end()) {
+          event.kernel_info.external_id = it->second;
+        }
+      }
+    }
+  }
+
   void ClearAll() {
     thread_names_.clear();
     host_events_.clear();
@@ -41,10 +62,12 @@ class TraceEventCollector : public phi::TraceEventCollector {
     device_events_.clear();
     mem_events_.clear();
     op_supplement_events_.clear();
+    external_correlations_.clear();
   }
 
  private:
   std::list<OperatorSupplementEvent> op_supplement_events_;
+  std::unordered_map<uint32_t, uint64_t> external_correlations_;
 };
 
 }  // namespace platform
@@ -288,6 +288,21 @@ void BindDataset(py::module *m) {
       .def("global_shuffle",
            &framework::Dataset::GlobalShuffle,
            py::call_guard<py::gil_scoped_release>())
+      .def("external_shuffle",
+           &framework::Dataset::ExternalShuffle,
+           py::call_guard<py::gil_scoped_release>())
+      .def("wait_external_shuffle_done",
+           &framework::Dataset::WaitExternalShuffleDone,
+           py::call_guard<py::gil_scoped_release>())
+      .def("convert_to_columnar_format",
+           &framework::Dataset::ConvertToColumnarFormat,
+           py::call_guard<py::gil_scoped_release>())
+      .def("restore_from_columnar_format",
+           &framework::Dataset::RestoreFromColumnarFormat,
+           py::call_guard<py::gil_scoped_release>())
+      .def("set_sample_filter",
+           &framework::Dataset::SetSampleFilter,
+           py::call_guard<py::gil_scoped_release>())
       .def("get_memory_data_size",
            &framework::Dataset::GetMemoryDataSize,
            py::call_guard<py::gil_scoped_release>())
@@ -21,6 +21,7 @@ limitations under the License. */
 #undef _XOPEN_SOURCE
 #endif
 
+#include "paddle/fluid/distributed/collective/parameter_broadcast_loader.h"
 #include "paddle/fluid/distributed/collective/process_group.h"
 #include "paddle/fluid/distributed/collective/reducer.h"
 #include "paddle/fluid/framework/lod_tensor.h"
@@ -34,6 +35,7 @@ limitations under the License. */
 
 #if defined(PADDLE_WITH_NCCL) || defined(PADDLE_WITH_RCCL)
 #include "paddle/fluid/distributed/collective/async_load.h"
+#include "paddle/fluid/distributed/collective/comm_profiler.h"
 #include "paddle/fluid/distributed/collective/process_group_nccl.h"
 #endif
 
@@ -1254,6 +1256,12 @@ void BindDistributed(py::module *m) {
       .def_static("group_start", distributed::ProcessGroupNCCL::GroupStart)
       .def_static("group_end", distributed::ProcessGroupNCCL::GroupEnd);
 
+  m->def("nccl_comm_profile_summary", [] {
+    return distributed::NCCLCommProfiler::Instance().Summary();
+  });
+  m->def("reset_nccl_comm_profiler",
+         [] { distributed::NCCLCommProfiler::Instance().Reset(); });
+
   py::class_<distributed::AsyncLoad::Task,
              std::shared_ptr<distributed::AsyncLoad::Task>>(*m, "AsyncLoadTask")
       .def("is_completed", &distributed::AsyncLoad::Task::IsCompleted)
@@ -1306,7 +1314,59 @@ void BindDistributed(py::module *m) {
               },
               py::arg("dst"),
               py::arg("src"),
-              py::call_guard<py::gil_scoped_release>());
+              py::call_guard<py::gil_scoped_release>())
+          .def(
+              "offload_batch",
+              [](distributed::AsyncLoad &self,
+                 const py::list &py_dst_tensors,
+                 const py::list &py_src_tensors) {
+                std::vector<phi::DenseTensor *> dst_denses;
+                std::vector<phi::DenseTensor> src_denses;
+                for (auto &py_dst_tensor : py_dst_tensors) {
+                  auto dst_tensor = CastPyArg2Tensor(py_dst_tensor.ptr(), 0);
+                  dst_denses.push_back(
+                      std::dynamic_pointer_cast<phi::DenseTensor>(
+                          dst_tensor.impl())
+                          .get());
+                }
+                for (auto &py_src_tensor : py_src_tensors) {
+                  auto src_tensor = CastPyArg2Tensor(py_src_tensor.ptr(), 0);
+                  src_denses.push_back(
+                      *std::dynamic_pointer_cast<phi::DenseTensor>(
+                          src_tensor.impl()));
+                }
+                // The conversion above needs the GIL; the transfers do not.
+                py::gil_scoped_release release;
+                return self.OffloadBatch(dst_denses, src_denses);
+              },
+              py::arg("dsts"),
+              py::arg("srcs"))
+          .def(
+              "reload_batch",
+              [](distributed::AsyncLoad &self,
+                 const py::list &py_dst_tensors,
+                 const py::list &py_src_tensors) {
+                std::vector<phi::DenseTensor *> dst_denses;
+                std::vector<phi::DenseTensor> src_denses;
+                for (auto &py_dst_tensor : py_dst_tensors) {
+                  auto dst_tensor = CastPyArg2Tensor(py_dst_tensor.ptr(), 0);
+                  dst_denses.push_back(
+                      std::dynamic_pointer_cast<phi::DenseTensor>(
+                          dst_tensor.impl())
+                          .get());
+                }
+                for (auto &py_src_tensor : py_src_tensors) {
+                  auto src_tensor = CastPyArg2Tensor(py_src_tensor.ptr(), 0);
+                  src_denses.push_back(
+                      *std::dynamic_pointer_cast<phi::DenseTensor>(
+                          src_tensor.impl()));
+                }
+                // The conversion above needs the GIL; the transfers do not.
+                py::gil_scoped_release release;
+                return self.ReloadBatch(dst_denses, src_denses);
+              },
+              py::arg("dsts"),
+              py::arg("srcs"));
 
 #endif
 
@@ -1391,6 +1451,37 @@ void BindDistributed(py::module *m) {
                   &ProcessGroupGloo::createDefaultDevice);
 #endif
 
+  py::class_<distributed::ParameterBroadcastLoader,
+             std::shared_ptr<distributed::ParameterBroadcastLoader>>(
+      *m, "ParameterBroadcastLoader")
+      .def(py::init<std::shared_ptr<distributed::ProcessGroup>, int, size_t>(),
+           py::arg("group"),
+           py::arg("src_rank") = 0,
+           py::arg("chunk_bytes") =
+               distributed::ParameterBroadcastLoader::kDefaultChunkBytes)
+      .def(
+          "load",
+          [](distributed::ParameterBroadcastLoader &self,
+             const std::string &file_path,
+             const std::vector<std::string> &names,
+             py::handle py_tensors,
+             const phi::Place &place) {
+            auto tensors = CastPyArg2VectorOfTensor(py_tensors.ptr(), 0);
+            std::vector<phi::DenseTensor *> outs;
+            outs.reserve(tensors.size());
+            for (auto &tensor : tensors) {
+              outs.push_back(
+                  std::dynamic_pointer_cast<phi::DenseTensor>(tensor.impl())
+                      .get());
+            }
+            self.Load(file_path, names, outs, place);
+          },
+          py::arg("file_path"),
+          py::arg("names"),
+          py::arg("tensors"),
+          py::arg("place"),
+          py::call_guard<py::gil_scoped_release>());
+
   m->def(
       "eager_assign_group_by_size",
       [](py::handle py_tensors,
@@ -1418,7 +1509,39 @@ void BindDistributed(py::module *m) {
             self.PrepareForBackward(params);
           },
           py::arg("tensors"),
-          py::call_guard<py::gil_scoped_release>());
+          py::call_guard<py::gil_scoped_release>())
+      .def("enable_auto_tune",
+           &distributed::EagerReducer::EnableAutoTune,
+           py::arg("warmup_steps") = 3,
+           py::call_guard<py::gil_scoped_release>())
+      .def("enable_fp16_compression",
+           &distributed::EagerReducer::EnableFP16Compression,
+           py::call_guard<py::gil_scoped_release>())
+      .def("enable_sharded_grads",
+           &distributed::EagerReducer::EnableShardedGrads,
+           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "set_bucket_completion_callback",
+          [](distributed::EagerReducer &self, py::object callback) {
+            if (callback.is_none()) {
+              self.SetBucketCompletionCallback(nullptr);
+              return;
+            }
+            // FinalizeBackward runs on the autograd engine thread, so the
+            // callback has to reacquire the GIL before entering Python.
+            self.SetBucketCompletionCallback(
+                [callback](size_t group_index,
+                           const std::vector<size_t> &tensor_indices,
+                           const paddle::Tensor &grad_shard,
+                           int64_t shard_offset) {
+                  py::gil_scoped_acquire guard;
+                  callback(group_index,
+                           tensor_indices,
+                           grad_shard,
+                           shard_offset);
+                });
+          },
+          py::arg("callback"));
 
   py::class_<distributed::ProcessGroupIdMap,
              std::shared_ptr<distributed::ProcessGroupIdMap>>(
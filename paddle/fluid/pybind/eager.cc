@@ -20,6 +20,7 @@ limitations under the License. */
 #include <string>
 #include <vector>
 
+#include "paddle/common/flags.h"
 #include "paddle/fluid/eager/accumulation/accumulation_node.h"
 #include "paddle/fluid/eager/api/all.h"
 #include "paddle/fluid/eager/autograd_meta.h"
@@ -54,6 +55,8 @@ using phi::distributed::ProcessMesh;
 using phi::distributed::TensorDistAttr;
 using phi::distributed::auto_parallel::str_join;
 
+COMMON_DECLARE_bool(eager_numpy_zero_copy);
+
 namespace paddle {
 namespace pybind {
 
@@ -174,6 +177,18 @@ void InitTensorWithNumpyValue(TensorObject* self,
   phi::DenseTensor* impl_ptr =
       static_cast<phi::DenseTensor*>(self->tensor.impl().get());
   if (platform::is_cpu_place(place)) {
+    if (!zero_copy && FLAGS_eager_numpy_zero_copy &&
+        py::isinstance<py::array>(array)) {
+      // Adopt the ndarray's buffer instead of copying it in, provided numpy
+      // hands us a plain C-contiguous writable buffer; SetTensorFromPyArray
+      // then wraps it in a NumpyAllocation that keeps the array alive. Other
+      // layouts and read-only arrays keep the copying path.
+      int array_flags = pybind11::detail::array_proxy(array.ptr())->flags;
+      zero_copy =
+          (array_flags &
+           pybind11::detail::npy_api::NPY_ARRAY_C_CONTIGUOUS_) != 0 &&
+          (array_flags & pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_) != 0;
+    }
     SetTensorFromPyArray<phi::CPUPlace>(impl_ptr, array, place, zero_copy);
   } else if (platform::is_xpu_place(place)) {
 #if defined(PADDLE_WITH_XPU)
@@ -27,6 +27,7 @@ typedef SSIZE_T ssize_t;
 
 #include "paddle/fluid/eager/accumulation/accumulation_node.h"
 #include "paddle/fluid/eager/api/all.h"
+#include "paddle/fluid/eager/api/manual/eager_manual/dygraph_forward_api.h"
 #include "paddle/fluid/eager/autograd_meta.h"
 #include "paddle/fluid/eager/backward.h"
 #include "paddle/fluid/eager/custom_operator/custom_operator_node.h"
@@ -1350,6 +1351,84 @@ static PyObject* eager_api_set_master_grads(PyObject* self,
   EAGER_CATCH_AND_THROW_RETURN_NULL
 }
 
+// Foreach-style bindings: one Python -> C++ transition for a whole tensor
+// list; the per-tensor work runs with the GIL released.
+static PyObject* eager_api__foreach_scale(PyObject* self,
+                                          PyObject* args,
+                                          PyObject* kwargs) {
+  EAGER_TRY
+  auto xs = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 0), 0);
+  float scale = CastPyArg2AttrFloat(PyTuple_GET_ITEM(args, 1), 1);
+  float bias = CastPyArg2AttrFloat(PyTuple_GET_ITEM(args, 2), 2);
+  bool bias_after_scale = CastPyArg2AttrBoolean(PyTuple_GET_ITEM(args, 3), 3);
+  std::vector<paddle::Tensor> out;
+  {
+    eager_gil_scoped_release guard;
+    out = foreach_scale_ad_func(xs, scale, bias, bias_after_scale);
+  }
+  return ToPyObject(out);
+  EAGER_CATCH_AND_THROW_RETURN_NULL
+}
+
+static PyObject* eager_api__foreach_scale_(PyObject* self,
+                                           PyObject* args,
+                                           PyObject* kwargs) {
+  EAGER_TRY
+  auto xs = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 0), 0);
+  float scale = CastPyArg2AttrFloat(PyTuple_GET_ITEM(args, 1), 1);
+  float bias = CastPyArg2AttrFloat(PyTuple_GET_ITEM(args, 2), 2);
+  bool bias_after_scale = CastPyArg2AttrBoolean(PyTuple_GET_ITEM(args, 3), 3);
+  {
+    eager_gil_scoped_release guard;
+    foreach_scale__ad_func(xs, scale, bias, bias_after_scale);
+  }
+  RETURN_PY_NONE
+  EAGER_CATCH_AND_THROW_RETURN_NULL
+}
+
+static PyObject* eager_api__foreach_add(PyObject* self,
+                                        PyObject* args,
+                                        PyObject* kwargs) {
+  EAGER_TRY
+  auto xs = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 0), 0);
+  auto ys = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 1), 1);
+  std::vector<paddle::Tensor> out;
+  {
+    eager_gil_scoped_release guard;
+    out = foreach_add_ad_func(xs, ys);
+  }
+  return ToPyObject(out);
+  EAGER_CATCH_AND_THROW_RETURN_NULL
+}
+
+static PyObject* eager_api__foreach_add_(PyObject* self,
+                                         PyObject* args,
+                                         PyObject* kwargs) {
+  EAGER_TRY
+  auto xs = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 0), 0);
+  auto ys = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 1), 1);
+  {
+    eager_gil_scoped_release guard;
+    foreach_add__ad_func(xs, ys);
+  }
+  RETURN_PY_NONE
+  EAGER_CATCH_AND_THROW_RETURN_NULL
+}
+
+static PyObject* eager_api__foreach_multiply_(PyObject* self,
+                                              PyObject* args,
+                                              PyObject* kwargs) {
+  EAGER_TRY
+  auto xs = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 0), 0);
+  auto ys = CastPyArg2VectorOfTensor(PyTuple_GET_ITEM(args, 1), 1);
+  {
+    eager_gil_scoped_release guard;
+    foreach_multiply__ad_func(xs, ys);
+  }
+  RETURN_PY_NONE
+  EAGER_CATCH_AND_THROW_RETURN_NULL
+}
+
 PyObject* eager__is_run_in_backward(PyObject* self,
                                     PyObject* args,
                                     PyObject* kwargs) {
@@ -1437,6 +1516,27 @@ PyMethodDef variable_functions[] = {  // NOLINT
      (PyCFunction)(void (*)())eager__is_run_in_backward,
      METH_VARARGS | METH_KEYWORDS,
      nullptr},
+    /**foreach functions**/
+    {"_foreach_scale",
+     (PyCFunction)(void (*)())eager_api__foreach_scale,
+     METH_VARARGS | METH_KEYWORDS,
+     nullptr},
+    {"_foreach_scale_",
+     (PyCFunction)(void (*)())eager_api__foreach_scale_,
+     METH_VARARGS | METH_KEYWORDS,
+     nullptr},
+    {"_foreach_add",
+     (PyCFunction)(void (*)())eager_api__foreach_add,
+     METH_VARARGS | METH_KEYWORDS,
+     nullptr},
+    {"_foreach_add_",
+     (PyCFunction)(void (*)())eager_api__foreach_add_,
+     METH_VARARGS | METH_KEYWORDS,
+     nullptr},
+    {"_foreach_multiply_",
+     (PyCFunction)(void (*)())eager_api__foreach_multiply_,
+     METH_VARARGS | METH_KEYWORDS,
+     nullptr},
 /**sparse functions**/
 #if defined(PADDLE_WITH_CUDA)
     {"async_read",
@@ -69,6 +69,7 @@ typedef SSIZE_T ssize_t;
 #include "paddle/phi/kernels/funcs/math_function.h"
 #include "paddle/utils/pybind.h"
 
+COMMON_DECLARE_bool(eager_numpy_zero_copy);
 COMMON_DECLARE_bool(set_to_1d);
 COMMON_DECLARE_bool(use_stride_kernel);
 
@@ -224,6 +225,36 @@ static PyObject* tensor_method_numpy(TensorObject* self,
     return array;
   }
 
+  if (FLAGS_eager_numpy_zero_copy &&
+      (self->tensor.is_cpu() || self->tensor.is_gpu_pinned()) &&
+      self->tensor.is_dense_tensor()) {
+    auto dense_tensor =
+        std::dynamic_pointer_cast<phi::DenseTensor>(self->tensor.impl());
+    if (dense_tensor->meta().is_contiguous()) {
+      // Hand numpy a view of the tensor's own buffer instead of a snapshot.
+      // The base object pins the tensor for the array's lifetime, and writes
+      // on either side are visible to the other - that is the point of the
+      // zero-copy mode.
+      VLOG(6) << "Sharing DenseTensor's buffer with numpy";
+      void* data_ptr = reinterpret_cast<void*>(
+          reinterpret_cast<uintptr_t>(dense_tensor->Holder()->ptr()) +
+          dense_tensor->offset());
+      PyObject* base = ToPyObject(self->tensor);
+      PyObject* array = api.PyArray_NewFromDescr_(
+          api.PyArray_Type_,
+          api.PyArray_DescrFromType_(numpy_dtype),
+          static_cast<int>(py_rank),
+          py_dims,
+          py_strides,
+          data_ptr,
+          pybind11::detail::npy_api::NPY_ARRAY_ALIGNED_ |
+              pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_,
+          nullptr);
+      api.PyArray_SetBaseObject_(array, base);
+      return array;
+    }
+  }
+
   phi::DenseTensor cpu_tensor;
   phi::CPUPlace cpu_place;
 
@@ -920,6 +920,24 @@ PyObject* ToPyObject(PyObject* args, ssize_t arg_idx) {
   return obj;
 }
 
+PyObject* ToPyObject(const paddle::Tensor& value,
+                     PyObject* const* args,
+                     const std::map<ssize_t, ssize_t>& inplace_var_idx_map) {
+  if (!inplace_var_idx_map.empty() && inplace_var_idx_map.count(0)) {
+    return ToPyObject(args, inplace_var_idx_map.at(0));
+  } else {
+    return ToPyObject(value);
+  }
+}
+
+PyObject* ToPyObject(PyObject* const* args, ssize_t arg_idx) {
+  // METH_FASTCALL flavor of the overload above; the positional arguments of
+  // an inplace op arrive as a C array instead of a tuple.
+  PyObject* obj = args[arg_idx];
+  Py_INCREF(obj);
+  return obj;
+}
+
 PyObject* ToPyObject(const std::vector<bool>& value) {
   PyObject* result = PyList_New((Py_ssize_t)value.size());
 
@@ -1250,15 +1268,13 @@ PyObject* ToPyObject(const paddle::framework::Vocab& value) {
 
 // For Final State Dygraph,
 // We directly use paddle::optional(Tensor) as dispensable Tensor
-paddle::optional<paddle::Tensor> GetOptionalTensorFromArgs(
+static paddle::optional<paddle::Tensor> GetOptionalTensorFromPyObject(
     const std::string& op_type,
     const std::string& arg_name,
-    PyObject* args,
+    PyObject* obj,
     ssize_t arg_idx,
     bool dispensable,
     const phi::distributed::ProcessMesh* mesh) {
-  PyObject* obj = PyTuple_GET_ITEM(args, arg_idx);
-
   if (PyTuple_Check(obj)) {
     obj = PyTuple_GET_ITEM(obj, 0);
   }
@@ -1291,6 +1307,34 @@ paddle::optional<paddle::Tensor> GetOptionalTensorFromArgs(
   }
 }
 
+paddle::optional<paddle::Tensor> GetOptionalTensorFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* args,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
+  return GetOptionalTensorFromPyObject(op_type,
+                                       arg_name,
+                                       PyTuple_GET_ITEM(args, arg_idx),
+                                       arg_idx,
+                                       dispensable,
+                                       mesh);
+}
+
+paddle::optional<paddle::Tensor> GetOptionalTensorFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
+  PyObject* obj = (arg_idx < nargs) ? args[arg_idx] : Py_None;
+  return GetOptionalTensorFromPyObject(
+      op_type, arg_name, obj, arg_idx, dispensable, mesh);
+}
+
 PyObject* ToPyObject(std::shared_ptr<egr::GradNodeBase> grad_node) {
   py::object py_obj = py::cast(grad_node, py::return_value_policy::reference);
   PyObject* py_grad_node = py_obj.release().ptr();
@@ -1343,15 +1387,23 @@ paddle::Tensor& GetTensorFromArgs(const std::string& op_type,
   return GetTensorFromPyObject(op_type, arg_name, obj, arg_idx, dispensable);
 }
 
-std::vector<paddle::Tensor> GetTensorListFromArgs(
+paddle::Tensor& GetTensorFromArgs(const std::string& op_type,
+                                  const std::string& arg_name,
+                                  PyObject* const* args,
+                                  Py_ssize_t nargs,
+                                  ssize_t arg_idx,
+                                  bool dispensable) {
+  PyObject* obj = (arg_idx < nargs) ? args[arg_idx] : Py_None;
+  return GetTensorFromPyObject(op_type, arg_name, obj, arg_idx, dispensable);
+}
+
+static std::vector<paddle::Tensor> GetTensorListFromPyObjectArg(
     const std::string& op_type,
     const std::string& arg_name,
-    PyObject* args,
+    PyObject* list,
     ssize_t arg_idx,
     bool dispensable,
     const phi::distributed::ProcessMesh* mesh) {
-  PyObject* list = PyTuple_GET_ITEM(args, arg_idx);
-
   if (list == nullptr) {
     if (!dispensable) {
       PADDLE_THROW(platform::errors::InvalidArgument(
@@ -1467,15 +1519,42 @@ std::vector<paddle::Tensor> GetTensorListFromArgs(
   return result;
 }
 
-paddle::optional<std::vector<paddle::Tensor>> GetOptionalTensorListFromArgs(
+std::vector<paddle::Tensor> GetTensorListFromArgs(
     const std::string& op_type,
     const std::string& arg_name,
     PyObject* args,
     ssize_t arg_idx,
     bool dispensable,
     const phi::distributed::ProcessMesh* mesh) {
-  PyObject* list = PyTuple_GET_ITEM(args, arg_idx);
+  return GetTensorListFromPyObjectArg(op_type,
+                                      arg_name,
+                                      PyTuple_GET_ITEM(args, arg_idx),
+                                      arg_idx,
+                                      dispensable,
+                                      mesh);
+}
 
+std::vector<paddle::Tensor> GetTensorListFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
+  PyObject* list = (arg_idx < nargs) ? args[arg_idx] : Py_None;
+  return GetTensorListFromPyObjectArg(
+      op_type, arg_name, list, arg_idx, dispensable, mesh);
+}
+
+static paddle::optional<std::vector<paddle::Tensor>>
+GetOptionalTensorListFromPyObjectArg(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* list,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
   if (list == nullptr || list == Py_None) {
     if (!dispensable) {
       PADDLE_THROW(platform::errors::InvalidArgument(
@@ -1589,6 +1668,34 @@ paddle::optional<std::vector<paddle::Tensor>> GetOptionalTensorListFromArgs(
   return result;
 }
 
+paddle::optional<std::vector<paddle::Tensor>> GetOptionalTensorListFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* args,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
+  return GetOptionalTensorListFromPyObjectArg(op_type,
+                                              arg_name,
+                                              PyTuple_GET_ITEM(args, arg_idx),
+                                              arg_idx,
+                                              dispensable,
+                                              mesh);
+}
+
+paddle::optional<std::vector<paddle::Tensor>> GetOptionalTensorListFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable,
+    const phi::distributed::ProcessMesh* mesh) {
+  PyObject* list = (arg_idx < nargs) ? args[arg_idx] : Py_None;
+  return GetOptionalTensorListFromPyObjectArg(
+      op_type, arg_name, list, arg_idx, dispensable, mesh);
+}
+
 paddle::Tensor* GetTensorPtrFromArgs(const std::string& op_type,
                                      const std::string& arg_name,
                                      PyObject* args,
@@ -132,6 +132,12 @@ PyObject* ToPyObject(const paddle::Tensor& value,
                      PyObject* args,
                      const std::map<ssize_t, ssize_t>& inplace_var_idx_map);
 PyObject* ToPyObject(PyObject* args, ssize_t arg_idx);
+// METH_FASTCALL flavors of the two overloads above: positional arguments
+// arrive as a C array instead of a tuple.
+PyObject* ToPyObject(const paddle::Tensor& value,
+                     PyObject* const* args,
+                     const std::map<ssize_t, ssize_t>& inplace_var_idx_map);
+PyObject* ToPyObject(PyObject* const* args, ssize_t arg_idx);
 PyObject* ToPyObject(const std::vector<bool>& value);
 PyObject* ToPyObject(const std::vector<int>& value);
 PyObject* ToPyObject(const std::vector<int64_t>& value);
@@ -259,6 +265,20 @@ struct TupleTensorResult {
       PyTuple_SET_ITEM(result, N - 1, ToPyObject(std::get<N - 1>(out)));
     }
   }
+
+  static void Run(const Tuple& out,
+                  PyObject* result,
+                  PyObject* const* args,
+                  const std::map<ssize_t, ssize_t>& inplace_var_idx_map) {
+    TupleTensorResult<Tuple, N - 1>::Run(
+        out, result, args, inplace_var_idx_map);
+    if (!inplace_var_idx_map.empty() && inplace_var_idx_map.count(N - 1)) {
+      PyTuple_SET_ITEM(
+          result, N - 1, ToPyObject(args, inplace_var_idx_map.at(N - 1)));
+    } else {
+      PyTuple_SET_ITEM(result, N - 1, ToPyObject(std::get<N - 1>(out)));
+    }
+  }
 };
 
 template <typename Tuple>
@@ -277,6 +297,17 @@ struct TupleTensorResult<Tuple, 1> {
       PyTuple_SET_ITEM(result, 0, ToPyObject(std::get<0>(out)));
     }
   }
+
+  static void Run(const Tuple& out,
+                  PyObject* result,
+                  PyObject* const* args,
+                  const std::map<ssize_t, ssize_t>& inplace_var_idx_map) {
+    if (!inplace_var_idx_map.empty() && inplace_var_idx_map.count(0)) {
+      PyTuple_SET_ITEM(result, 0, ToPyObject(args, inplace_var_idx_map.at(0)));
+    } else {
+      PyTuple_SET_ITEM(result, 0, ToPyObject(std::get<0>(out)));
+    }
+  }
 };
 
 template <typename... Args>
@@ -312,6 +343,21 @@ PyObject* ToPyObject(const std::tuple<Args...>& out,
   return result;
 }
 
+template <typename... Args>
+PyObject* ToPyObject(const std::tuple<Args...>& out,
+                     PyObject* const* args,
+                     const std::map<ssize_t, ssize_t>& inplace_var_idx_map) {
+  // METH_FASTCALL flavor of the inplace overload above; args is the C array
+  // of positional arguments instead of the argument tuple.
+  auto len = sizeof...(Args);
+  PyObject* result = PyTuple_New(len);
+
+  TupleTensorResult<decltype(out), sizeof...(Args)>::Run(
+      out, result, args, inplace_var_idx_map);
+
+  return result;
+}
+
 paddle::experimental::Scalar CastPyArg2Scalar(PyObject* obj,
                                               const std::string& op_type,
                                               ssize_t arg_pos);
@@ -379,6 +425,44 @@ std::vector<paddle::Tensor> GetTensorListFromArgs(
     bool dispensable = false,
     const phi::distributed::ProcessMesh* mesh = nullptr);
 
+// METH_FASTCALL variants of the argument getters, used by the generated
+// eager_api_* bindings: positional arguments come in as a C array plus a
+// count, so no argument tuple has to be materialized for each call. An
+// arg_idx at or beyond nargs is treated the same as passing None.
+paddle::optional<paddle::Tensor> GetOptionalTensorFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable = false,
+    const phi::distributed::ProcessMesh* mesh = nullptr);
+
+paddle::Tensor& GetTensorFromArgs(const std::string& op_type,
+                                  const std::string& arg_name,
+                                  PyObject* const* args,
+                                  Py_ssize_t nargs,
+                                  ssize_t arg_idx,
+                                  bool dispensable = false);
+
+paddle::optional<std::vector<paddle::Tensor>> GetOptionalTensorListFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable = false,
+    const phi::distributed::ProcessMesh* mesh = nullptr);
+
+std::vector<paddle::Tensor> GetTensorListFromArgs(
+    const std::string& op_type,
+    const std::string& arg_name,
+    PyObject* const* args,
+    Py_ssize_t nargs,
+    ssize_t arg_idx,
+    bool dispensable = false,
+    const phi::distributed::ProcessMesh* mesh = nullptr);
+
 paddle::Tensor* GetTensorPtrFromArgs(const std::string& op_type,
                                      const std::string& arg_name,
                                      PyObject* args,
@@ -26,6 +26,7 @@ limitations under the License. */
 #include <pybind11/stl.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -36,6 +37,7 @@ limitations under the License. */
 
 #include "paddle/fluid/eager/api/all.h"
 #include "paddle/fluid/framework/convert_utils.h"
+#include "paddle/fluid/framework/gpu_jpeg_decoder.h"
 #include "paddle/fluid/framework/scope_guard.h"
 #include "paddle/fluid/imperative/all_reduce.h"
 #include "paddle/fluid/imperative/amp_auto_cast.h"
@@ -416,6 +418,49 @@ paddle::imperative::NameTensorMap ConvertToNameTensorMap(
   return result;
 }
 
+// A short sequence of eager ops recorded once and executed as a single C++
+// call with the GIL released end-to-end. Appending converts the Python
+// arguments while the GIL is held, so Run touches no Python state and
+// several Python threads can execute their batches concurrently. A stepping
+// stone between per-op dygraph and full to_static for latency-critical
+// paths.
+class EagerOpBatch {
+ public:
+  void Append(const std::string &type,
+              imperative::NameTensorMap ins,
+              imperative::NameTensorMap outs,
+              framework::AttributeMap attrs) {
+    ops_.push_back(OpRecord{
+        type, std::move(ins), std::move(outs), std::move(attrs)});
+  }
+
+  // Runs the recorded ops back to back. With sync = true, waits once on the
+  // expected place's device context afterwards, so all outputs of the batch
+  // are synchronized by a single wait instead of one per op.
+  void Run(const std::shared_ptr<imperative::Tracer> &tracer, bool sync) {
+    for (auto &op : ops_) {
+      tracer->TraceOp(op.type, op.ins, op.outs, op.attrs);
+    }
+    if (sync && !ops_.empty()) {
+      phi::DeviceContextPool::Instance().Get(tracer->ExpectedPlace())->Wait();
+    }
+  }
+
+  size_t Size() const { return ops_.size(); }
+
+  void Clear() { ops_.clear(); }
+
+ private:
+  struct OpRecord {
+    std::string type;
+    imperative::NameTensorMap ins;
+    imperative::NameTensorMap outs;
+    framework::AttributeMap attrs;
+  };
+
+  std::vector<OpRecord> ops_;
+};
+
 template <typename P>
 static void VarBaseCopy(std::shared_ptr<imperative::VarBase> &src,  // NOLINT
                         imperative::VarBase &dst,                   // NOLINT
@@ -551,6 +596,131 @@ void BindImperative(py::module *m_ptr) {
       },
       py::return_value_policy::take_ownership);
 
+#if defined(PADDLE_WITH_CUDA) && !defined(WITH_NV_JETSON) && \
+    !defined(PADDLE_WITH_HIP)
+  // GPU decode stage for vision data pipelines: decodes a whole batch of
+  // JPEG bitstreams with nvJPEG and returns one device-resident NHWC float
+  // tensor, resized and normalized in a single fused kernel.
+  m.def(
+      "_gpu_decode_jpeg_batch",
+      [](py::list bytes_list,
+         int height,
+         int width,
+         std::vector<float> mean,
+         std::vector<float> std,
+         int device_id) -> phi::DenseTensor {
+        PADDLE_ENFORCE_EQ(mean.size() == 3 && std.size() == 3,
+                          true,
+                          platform::errors::InvalidArgument(
+                              "mean and std must both hold 3 channel values."));
+        std::vector<const uint8_t *> bitstreams;
+        std::vector<size_t> lengths;
+        bitstreams.reserve(bytes_list.size());
+        lengths.reserve(bytes_list.size());
+        for (auto &&item : bytes_list) {
+          char *buffer = nullptr;
+          Py_ssize_t length = 0;
+          PADDLE_ENFORCE_EQ(
+              PyBytes_AsStringAndSize(item.ptr(), &buffer, &length),
+              0,
+              platform::errors::InvalidArgument(
+                  "Each element of the decode batch must be a bytes object."));
+          bitstreams.push_back(reinterpret_cast<const uint8_t *>(buffer));
+          lengths.push_back(static_cast<size_t>(length));
+        }
+        // one decoder per device, reused across batches so nvJPEG state and
+        // device scratch stay warm; calls are serialized by the GIL
+        static std::map<int, std::unique_ptr<framework::GpuJpegDecoder>>
+            decoders;
+        auto &decoder = decoders[device_id];
+        if (decoder == nullptr) {
+          decoder = std::make_unique<framework::GpuJpegDecoder>(
+              phi::GPUPlace(device_id));
+        }
+        phi::DenseTensor out;
+        decoder->DecodeBatch(
+            bitstreams, lengths, height, width, mean.data(), std.data(), &out);
+        return out;
+      },
+      py::return_value_policy::take_ownership);
+#endif
+
+  // Shared-memory ring transport for the multi-process DataLoader: the
+  // worker creates one preallocated ring per process, every batch becomes a
+  // single ring record and its tensors are built in place over the record
+  // payload, so moving a batch needs no per-sample shm_open/mmap/unlink.
+  m.def("_create_shm_ring",
+        [](const std::string &name, size_t capacity) {
+          memory::allocation::SharedMemoryRing::Create(name, capacity);
+        });
+  m.def("_remove_shm_ring", [](const std::string &name) {
+    memory::allocation::SharedMemoryRing::Remove(name);
+  });
+  m.def(
+      "_convert_to_tensor_list_by_ring",
+      [](const std::string &name, py::object &obj) -> py::list {
+        PADDLE_ENFORCE(
+            py::isinstance<py::tuple>(obj) || py::isinstance<py::list>(obj),
+            platform::errors::InvalidArgument(
+                "The batch data read into DataLoader is illegal."
+                "Expected data type is tuple or list, but received %s",
+                obj.get_type()));
+        auto ring = memory::allocation::SharedMemoryRing::Open(name);
+        py::list batch = py::cast<py::list>(obj);
+        // 1. cast to arrays and compute the record layout, one 64-byte
+        // aligned slice per tensor
+        std::vector<phi::DenseTensor> temps;
+        std::vector<size_t> offsets;
+        size_t total_size = 0;
+        for (auto &&item : batch) {
+          auto array = item.cast<py::array>();
+          PADDLE_ENFORCE_NE(
+              string::Sprintf("%s", array.dtype()).compare("object"),
+              0,
+              platform::errors::InvalidArgument(
+                  "Failed to convert input data to a regular ndarray.\n  * "
+                  "Usually this means the input data contains nested "
+                  "lists with different lengths.\n  * Check the reader "
+                  "function passed to 'set_(sample/sample_list/batch)"
+                  "_generator' to locate the data causes this issue."));
+          phi::DenseTensor t;
+          SetTensorFromPyArray<phi::CPUPlace>(&t, array, phi::CPUPlace(), true);
+          size_t data_size = t.numel() * phi::SizeOf(t.dtype());
+          offsets.push_back(total_size);
+          total_size +=
+              (data_size + memory::allocation::SharedMemoryRing::
+                               kRingAlignment - 1) &
+              ~(memory::allocation::SharedMemoryRing::kRingAlignment - 1);
+          temps.emplace_back(std::move(t));
+        }
+        // 2. reserve one record for the whole batch. Each tensor is
+        // referenced once here and once after the main process rebuilds it
+        // from the pickled metadata, so the record is reclaimed only when
+        // both sides dropped their tensors.
+        uint64_t record_pos = ring->Reserve(
+            total_size, static_cast<int32_t>(2 * temps.size()));
+        char *payload = static_cast<char *>(ring->Payload(record_pos));
+        // 3. copy the batch in and construct the tensors in place
+        py::list tensors;
+        for (size_t i = 0; i < temps.size(); ++i) {
+          size_t data_size = temps[i].numel() * phi::SizeOf(temps[i].dtype());
+          void *slice = payload + offsets[i];
+          memory::Copy(phi::CPUPlace(),
+                       slice,
+                       phi::CPUPlace(),
+                       temps[i].data(),
+                       data_size);
+          auto holder =
+              std::make_shared<memory::allocation::
+                                   SharedMemoryRingSlotAllocation>(
+                  slice, data_size, ring, record_pos);
+          temps[i].ResetHolder(holder);
+          tensors.append(temps[i]);
+        }
+        return tensors;
+      },
+      py::return_value_policy::take_ownership);
+
   m.def(
       "_array_to_share_memory_tensor",
       [](py::object &obj) {
@@ -793,6 +963,44 @@ void BindImperative(py::module *m_ptr) {
              }
            });
 
+  py::class_<EagerOpBatch, std::shared_ptr<EagerOpBatch>>(
+      m, "EagerOpBatch", R"DOC(
+    A recorded sequence of eager ops executed as one C++ call with the GIL
+    released for the whole batch. Output tensors must be created before
+    appending and are filled when the batch runs.)DOC")
+      .def(py::init([]() { return std::make_unique<EagerOpBatch>(); }))
+      .def("append",
+           [](EagerOpBatch &self,
+              const std::string &type,
+              const PyNameVarBaseMap &ins,
+              const PyNameVarBaseMap &outs,
+              framework::AttributeMap attrs) {
+             self.Append(type,
+                         ConvertToNameTensorMap(ins),
+                         ConvertToNameTensorMap(outs),
+                         std::move(attrs));
+           })
+      .def(
+          "run",
+          [](EagerOpBatch &self, bool sync) {
+            auto tracer = imperative::GetCurrentTracer();
+            // The current tracer is thread local, so a worker thread that
+            // never entered dygraph mode has none.
+            PADDLE_ENFORCE_NOT_NULL(
+                tracer,
+                platform::errors::PreconditionNotMet(
+                    "EagerOpBatch.run() requires a dygraph tracer on the "
+                    "calling thread, but none is set. Threads created "
+                    "outside paddle must enter dygraph mode (e.g. call "
+                    "paddle.disable_static() or run under a dygraph "
+                    "guard) before running a batch."));
+            self.Run(tracer, sync);
+          },
+          py::arg("sync") = false,
+          py::call_guard<py::gil_scoped_release>())
+      .def("size", &EagerOpBatch::Size)
+      .def("clear", &EagerOpBatch::Clear);
+
   // define parallel context
   py::class_<imperative::ParallelStrategy> parallel_strategy(
       m, "ParallelStrategy", "");
@@ -957,8 +957,9 @@ static PyObject *static_api_array_pop(PyObject *self,
 }
 
 extern PyObject *eager_api_fused_gemm_epilogue(PyObject *self,
-                                               PyObject *args,
-                                               PyObject *kwargs);
+                                               PyObject *const *args,
+                                               Py_ssize_t nargs,
+                                               PyObject *kwnames);
 
 static PyObject *fused_gemm_epilogue(PyObject *self,
                                      PyObject *args,
@@ -968,7 +969,10 @@ static PyObject *fused_gemm_epilogue(PyObject *self,
     return static_api_fused_gemm_epilogue(self, args, kwargs);
   } else {
     VLOG(6) << "Call eager_api_fused_gemm_epilogue";
-    return eager_api_fused_gemm_epilogue(self, args, kwargs);
+    // The generated eager bindings use METH_FASTCALL; forward the argument
+    // tuple's item array.
+    return eager_api_fused_gemm_epilogue(
+        self, PySequence_Fast_ITEMS(args), PyTuple_GET_SIZE(args), nullptr);
   }
 }
 
@@ -57,6 +57,8 @@ limitations under the License. */
 #include "paddle/fluid/framework/lod_tensor_array.h"
 #include "paddle/fluid/framework/new_executor/executor_statistics.h"
 #include "paddle/fluid/framework/new_executor/interpreter/job.h"
+#include "paddle/fluid/framework/new_executor/interpreter/op_latency_sampler.h"
+#include "paddle/fluid/framework/new_executor/live_stats_exporter.h"
 #include "paddle/fluid/framework/new_executor/interpreter/plan.h"
 #include "paddle/fluid/framework/new_executor/standalone_executor.h"
 #include "paddle/fluid/framework/op_info.h"
@@ -82,8 +84,10 @@ limitations under the License. */
 #include "paddle/fluid/memory/allocation/auto_growth_best_fit_allocator_v2.h"
 #include "paddle/fluid/memory/allocation/cuda_ipc_allocator.h"
 #endif
+#include "paddle/common/hot_counter.h"
 #include "paddle/common/macros.h"
 #include "paddle/fluid/memory/allocation/mmap_allocator.h"
+#include "paddle/fluid/memory/stats.h"
 #include "paddle/fluid/operators/activation_op.h"
 #include "paddle/fluid/operators/ops_extra_info.h"
 #include "paddle/fluid/operators/py_func_op.h"
@@ -131,6 +135,7 @@ limitations under the License. */
 #include "paddle/fluid/pybind/xpu_streams_py.h"
 #include "paddle/phi/backends/cpu/cpu_info.h"
 #include "paddle/phi/backends/device_manager.h"
+#include "paddle/phi/backends/gpu/launch_param_logger.h"
 #include "paddle/phi/core/compat/convert_utils.h"
 #include "paddle/phi/core/lod_utils.h"
 #include "paddle/phi/kernels/funcs/common_infer_shape_functions.h"
@@ -1434,6 +1439,12 @@ PYBIND11_MODULE(libpaddle, m) {
   // stored in this static instance to avoid illegal memory access.
   m.def("clear_kernel_factory",
         []() { phi::KernelFactory::Instance().kernels().clear(); });
+  // Pre-warms a named set of kernels when PADDLE_LAZY_KERNEL_REGISTRATION
+  // is on, so latency critical paths do not pay the first-lookup
+  // construction cost. A no-op when nothing is deferred.
+  m.def("_materialize_kernels", [](const std::vector<std::string> &names) {
+    phi::KernelFactory::Instance().MaterializeKernels(names);
+  });
   m.def("clear_device_manager", []() {
 #ifdef PADDLE_WITH_CUSTOM_DEVICE
     platform::XCCLCommContext::Release();
@@ -1662,6 +1673,28 @@ All parameter, weight, gradient are variables in Paddle.
            Delete all sub-scopes of the current scope.
            )DOC")
       .def("_kids", &Scope::kids)
+      .def(
+          "_link_read_only_scope",
+          [](Scope &self, Scope &read_only) {
+            self.LinkReadOnlyScope(&read_only);
+          },
+          py::arg("scope"),
+          R"DOC(
+           Link a canonical scope of shared read-only variables (typically
+           preloaded parameters). Lookups that miss in this scope consult
+           the linked scope before the parent, so several executor scopes
+           can reference one copy of the parameters. The linked scope must
+           outlive this one.
+           )DOC")
+      .def(
+          "_var_copy_on_write",
+          &Scope::VarCopyOnWrite,
+          py::arg("name"),
+          R"DOC(
+           Materialize a local deep copy of a variable found in the linked
+           read-only scope, shadowing the shared one, and return it.
+           )DOC",
+          py::return_value_policy::reference)
       .def_property("_can_reused", &Scope::CanReused, &Scope::SetCanReused);
 
   m.def(
@@ -2831,6 +2864,8 @@ All parameter, weight, gradient are variables in Paddle.
                      &paddle::platform::DevicePythonNode::warps_per_sm)
       .def_readwrite("occupancy",
                      &paddle::platform::DevicePythonNode::occupancy)
+      .def_readwrite("external_id",
+                     &paddle::platform::DevicePythonNode::external_id)
       .def_readwrite("num_bytes",
                      &paddle::platform::DevicePythonNode::num_bytes)
       .def_readwrite("value", &paddle::platform::DevicePythonNode::value);
@@ -2929,8 +2964,48 @@ All parameter, weight, gradient are variables in Paddle.
   m.def("disable_memory_recorder", &paddle::platform::DisableMemoryRecorder);
   m.def("enable_op_info_recorder", &phi::EnableOpInfoRecorder);
   m.def("disable_op_info_recorder", &phi::DisableOpInfoRecorder);
+  m.def("op_latency_summary", []() {
+    return framework::interpreter::OpLatencySampler::Instance().Summary();
+  });
+  m.def("reset_op_latency_sampler", []() {
+    framework::interpreter::OpLatencySampler::Instance().Reset();
+  });
+  m.def("hot_counter_report",
+        []() { return common::CounterRegistry::Instance().ReportText(); });
+  m.def("hot_counter_report_json",
+        []() { return common::CounterRegistry::Instance().ReportJson(); });
+  m.def("reset_hot_counters",
+        []() { common::CounterRegistry::Instance().ResetAll(); });
+  m.def(
+      "start_live_stats_exporter",
+      [](const std::string &path, int interval_ms) {
+        framework::LiveStatsExporter::Instance().Start(path, interval_ms);
+      },
+      py::arg("path"),
+      py::arg("interval_ms") = 100);
+  m.def("stop_live_stats_exporter",
+        []() { framework::LiveStatsExporter::Instance().Stop(); });
+  m.def("enable_memory_attribution",
+        []() { memory::MemoryAttributionTracker::GetInstance().Enable(); });
+  m.def("disable_memory_attribution",
+        []() { memory::MemoryAttributionTracker::GetInstance().Disable(); });
+  m.def("memory_attribution_peak_report", []() {
+    return memory::MemoryAttributionTracker::GetInstance().PeakReport();
+  });
 
 #if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  m.def("kernel_launch_report", []() {
+    return phi::backends::gpu::LaunchParamLogger::GetInstance().Summary();
+  });
+  m.def("enable_kernel_launch_logger", []() {
+    phi::backends::gpu::LaunchParamLogger::GetInstance().Enable();
+  });
+  m.def("disable_kernel_launch_logger", []() {
+    phi::backends::gpu::LaunchParamLogger::GetInstance().Disable();
+  });
+  m.def("reset_kernel_launch_logger", []() {
+    phi::backends::gpu::LaunchParamLogger::GetInstance().Reset();
+  });
   m.def("set_cublas_switch", phi::SetAllowTF32Cublas);
   m.def("get_cublas_switch", phi::AllowTF32Cublas);
   m.def("set_cudnn_switch", phi::SetAllowTF32Cudnn);
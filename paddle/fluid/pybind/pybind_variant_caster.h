@@ -22,6 +22,7 @@ limitations under the License. */
 #include <vector>
 
 #include "glog/logging.h"
+#include "paddle/utils/flat_hash_map.h"
 #include "paddle/utils/variant.h"
 #include "pybind11/numpy.h"
 #include "pybind11/pybind11.h"
@@ -133,5 +134,11 @@ template <class... Args>
 struct type_caster<paddle::variant<Args...>>
     : paddle_variant_caster<paddle::variant<Args...>> {};
 
+// framework::AttributeMap is a paddle::flat_hash_map; convert it to and from
+// Python dicts the same way pybind11 handles std::unordered_map.
+template <typename K, typename V, typename H, typename E, typename A>
+struct type_caster<paddle::flat_hash_map<K, V, H, E, A>>
+    : map_caster<paddle::flat_hash_map<K, V, H, E, A>, K, V> {};
+
 }  // namespace detail
 }  // namespace pybind11
@@ -1026,6 +1026,23 @@ void BindTensor(pybind11::module &m) {  // NOLINT
                               platform::errors::PreconditionNotMet(
                                   "Tensor is not on CPU."
                                   "Now only Tensor on CPU can be serialized."));
+            // ring-backed tensors travel as (name, record, offset) triples
+            // and are rebuilt in place over the already mapped ring payload
+            auto *ring_allocation = dynamic_cast<
+                memory::allocation::SharedMemoryRingSlotAllocation *>(
+                holder.get());
+            if (ring_allocation != nullptr) {
+              auto &ring = ring_allocation->ring();
+              uint64_t data_offset =
+                  static_cast<char *>(ring_allocation->ptr()) -
+                  static_cast<char *>(
+                      ring->Payload(ring_allocation->record_pos()));
+              return py::make_tuple(ring->name(),
+                                    ring_allocation->record_pos(), data_offset,
+                                    ring_allocation->size(),
+                                    static_cast<int>(t.type()),
+                                    common::vectorize(t.dims()), t.lod());
+            }
             auto *mmap_writer_allocation =
                 dynamic_cast<memory::allocation::MemoryMapWriterAllocation *>(
                     holder.get());
@@ -1041,6 +1058,24 @@ void BindTensor(pybind11::module &m) {  // NOLINT
                                   common::vectorize(t.dims()), t.lod());
           },
           [](py::tuple t) {  // __setstate__
+            if (t.size() == 7) {
+              // ring-backed tensor, see __getstate__; opening the ring maps
+              // the worker's segment once and reuses it for every batch
+              phi::DenseTensor tensor;
+              auto ring = memory::allocation::SharedMemoryRing::Open(
+                  t[0].cast<std::string>());
+              uint64_t record_pos = t[1].cast<uint64_t>();
+              void *ptr = static_cast<char *>(ring->Payload(record_pos)) +
+                          t[2].cast<uint64_t>();
+              auto holder = std::make_shared<
+                  memory::allocation::SharedMemoryRingSlotAllocation>(
+                  ptr, t[3].cast<size_t>(), ring, record_pos);
+              tensor.ResetHolderWithType(
+                  holder, static_cast<phi::DataType>(t[4].cast<int>()));
+              tensor.Resize(common::make_ddim(t[5].cast<std::vector<int>>()));
+              tensor.set_lod(t[6].cast<framework::LoD>());
+              return tensor;
+            }
             if (t.size() != 5)
               throw std::runtime_error("Invalid Tensor state!");
 
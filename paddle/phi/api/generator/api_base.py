@@ -582,7 +582,38 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
 
         return kernel_select_code
 
-    def gene_infer_meta(self, kernel_output_names, code_indent) -> str:
+    # attr types the InferMetaCacheKey builder can flatten into key words;
+    # an api with any other attr type falls back to uncached infer meta
+    infer_meta_cacheable_attr_types = frozenset(
+        [
+            'int',
+            'int32_t',
+            'int64_t',
+            'long',
+            'size_t',
+            'float',
+            'double',
+            'bool',
+            'const std::string&',
+            'DataType',
+            'DataLayout',
+            'const Place&',
+            'const Scalar&',
+            'const IntArray&',
+            'const std::vector<int>&',
+            'const std::vector<int64_t>&',
+            'const std::vector<float>&',
+            'const std::vector<bool>&',
+            'const std::vector<std::string>&',
+            'const std::vector<phi::Scalar>&',
+        ]
+    )
+
+    # Override by child class
+    def support_infer_meta_cache(self):
+        return False
+
+    def gene_infer_meta(self, kernel_output_names, code_indent, kernel_name=None) -> str:
         input_names = self.inputs['names']
         attr_names = self.attrs['names']
         infer_meta = self.infer_meta
@@ -592,6 +623,15 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
             if infer_meta['param'] is not None
             else input_names + attr_names
         )
+        # Cache the inferred output metas per call site when every infer meta
+        # argument can take part in the key and all outputs are single dense
+        # tensors; anything else keeps the uncached form.
+        use_meta_cache = (
+            self.support_infer_meta_cache()
+            and self.kernel['dispatch'].get(kernel_name) is None
+            and all(out_type == 'Tensor' for out_type in self.outputs['types'])
+        )
+        meta_key_code = ""
         # generate meta tensors
         meta_tensor_code = ""
         param_code = ""
@@ -605,6 +645,8 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
                         + param
                         + "), "
                     )
+                    meta_key_code += f"""{code_indent}  infer_meta_key.AddTensor(*{PREFIX_TENSOR_NAME}{param});
+"""
                 elif (
                     self.inputs['input_info'][param]
                     == "const std::vector<Tensor>&"
@@ -620,6 +662,7 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
 """
                     )
                     param_code = param_code + param + "_metas, "
+                    use_meta_cache = False
                 elif (
                     self.inputs['input_info'][param]
                     == "const paddle::optional<std::vector<Tensor>>&"
@@ -635,6 +678,7 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
 """
                     )
                     param_code = param_code + param + "_metas, "
+                    use_meta_cache = False
                 elif param in self.optional_vars:
                     param_code = (
                         param_code
@@ -643,12 +687,22 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
                         + param
                         + "), "
                     )
+                    meta_key_code += f"""{code_indent}  infer_meta_key.AddTensor({PREFIX_TENSOR_NAME}{param});
+"""
                 else:
                     raise ValueError(
                         f"{self.api} : Param of infer_meta error : {self.inputs['input_info'][param]} type is not supported."
                     )
             elif param in attr_names:
                 param_code = param_code + param + ", "
+                if (
+                    self.attrs['attr_info'][param][0]
+                    in self.infer_meta_cacheable_attr_types
+                ):
+                    meta_key_code += f"""{code_indent}  infer_meta_key.Add({param});
+"""
+                else:
+                    use_meta_cache = False
             elif isinstance(param, str):
                 param_code = param_code + "\"" + param + "\", "
             elif isinstance(param, bool):
@@ -692,6 +746,17 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
                     )
 
         param_code = param_code[:-2]
+        if use_meta_cache:
+            outs_list = ", ".join(kernel_output_names)
+            return f"""{meta_tensor_code}
+{code_indent}  static thread_local paddle::experimental::InferMetaResultCache infer_meta_cache;
+{code_indent}  paddle::experimental::InferMetaCacheKey infer_meta_key;
+{code_indent}  infer_meta_key.Add(kernel_result.is_stride_kernel);
+{meta_key_code}{code_indent}  if (!infer_meta_cache.Apply(infer_meta_key, {{{outs_list}}})) {{
+{code_indent}    phi::{infer_meta['func']}({param_code});
+{code_indent}    infer_meta_cache.Record(infer_meta_key, {{{outs_list}}});
+{code_indent}  }}
+"""
         return f"""{meta_tensor_code}
 {code_indent}  phi::{infer_meta['func']}({param_code});
 """
@@ -1297,8 +1362,9 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
 {code_indent}    }}"""
         return f"""
 {code_indent}  VLOG(6) << "{self.api} API kernel key: [" << kernel_backend << ", " << kernel_layout << ", "<< kernel_data_type << "]";
+{code_indent}  static thread_local phi::KernelResultCache kernel_result_cache;
 {code_indent}  auto kernel_result = phi::KernelFactory::Instance().SelectKernelOrThrowError(
-{code_indent}      "{kernel_name}", {{kernel_backend, kernel_layout, kernel_data_type}}, true);
+{code_indent}      "{kernel_name}", {{kernel_backend, kernel_layout, kernel_data_type}}, true, &kernel_result_cache);
 {code_indent}  const auto& kernel = kernel_result.kernel;
 {code_indent}  if (FLAGS_low_precision_op_list) {{
 {code_indent}    phi::KernelFactory::Instance().AddToLowPrecisionKernelList("{self.api}", kernel_data_type);
@@ -1314,7 +1380,7 @@ PADDLE_API {self.get_return_type(inplace_flag=True)} {api_func_name}({self.get_d
 {code_indent}  if(phi::RecordEvent::IsEnabled()){{
 {code_indent}    infer_shape_record_event = new phi::RecordEvent(\"{self.api} infer_meta\", phi::TracerEventType::OperatorInner, 1);
 {code_indent}  }}
-{self.gene_infer_meta(kernel_output_names, code_indent)}
+{self.gene_infer_meta(kernel_output_names, code_indent, kernel_name)}
 {code_indent}  if(infer_shape_record_event != nullptr){{
 {code_indent}    delete infer_shape_record_event;
 {code_indent}  }}
@@ -45,6 +45,11 @@ class ForwardAPI(BaseAPI):
         else:
             return self.api
 
+    def support_infer_meta_cache(self):
+        # the eager forward path re-runs InferMeta with identical arguments
+        # every iteration once shapes are stable
+        return True
+
     def gene_input(self, kernel_tensor_type=None, code_indent=''):
         kernel_param = self.kernel['param']
         input_name_tensor_map, input_tensor_code = super().gene_input(
@@ -403,6 +408,7 @@ def source_include(header_file_path):
 #include "paddle/phi/api/lib/api_gen_utils.h"
 #include "paddle/phi/api/lib/api_registry.h"
 #include "paddle/phi/api/lib/data_transform.h"
+#include "paddle/phi/api/lib/infer_meta_cache.h"
 #include "paddle/phi/api/include/tensor_utils.h"
 #include "paddle/phi/api/lib/kernel_dispatch.h"
 #include "paddle/phi/common/type_traits.h"
@@ -0,0 +1,133 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "paddle/phi/api/lib/infer_meta_cache.h"
+
+#include "paddle/phi/common/complex.h"
+
+namespace paddle {
+namespace experimental {
+
+void InferMetaCacheKey::AddTensor(const phi::DenseTensor& tensor) {
+  words_.push_back(static_cast<uint64_t>(tensor.dtype()));
+  words_.push_back(static_cast<uint64_t>(tensor.layout()));
+  // for inplace apis the recorded output meta is the input's own meta, so a
+  // view offset has to miss the cache instead of being replayed
+  words_.push_back(tensor.meta().offset);
+  const auto& dims = tensor.dims();
+  words_.push_back(static_cast<uint64_t>(dims.size()));
+  for (int i = 0; i < dims.size(); ++i) {
+    words_.push_back(static_cast<uint64_t>(dims[i]));
+  }
+  // strides matter when a stride kernel infers output strides from them
+  const auto& strides = tensor.meta().strides;
+  words_.push_back(static_cast<uint64_t>(strides.size()));
+  for (int i = 0; i < strides.size(); ++i) {
+    words_.push_back(static_cast<uint64_t>(strides[i]));
+  }
+  // lod is empty for nearly all eager tensors, but some InferMeta functions
+  // share it into their outputs, so it has to take part in the key
+  const auto& lod = tensor.meta().lod;
+  words_.push_back(lod.size());
+  for (const auto& level : lod) {
+    words_.push_back(level.size());
+    for (auto offset : level) {
+      words_.push_back(offset);
+    }
+  }
+}
+
+void InferMetaCacheKey::Add(const phi::Scalar& v) {
+  Add(v.dtype());
+  switch (v.dtype()) {
+    case phi::DataType::COMPLEX64:
+    case phi::DataType::COMPLEX128: {
+      auto c = v.to<phi::dtype::complex<double>>();
+      Add(c.real);
+      Add(c.imag);
+      break;
+    }
+    case phi::DataType::FLOAT16:
+    case phi::DataType::BFLOAT16:
+    case phi::DataType::FLOAT32:
+    case phi::DataType::FLOAT64:
+      Add(v.to<double>());
+      break;
+    default:
+      Add(v.to<int64_t>());
+      break;
+  }
+}
+
+namespace {
+
+uint64_t OutPresenceMask(std::initializer_list<phi::DenseTensor*> outs) {
+  uint64_t mask = 0;
+  size_t i = 0;
+  for (auto* out : outs) {
+    if (out != nullptr) {
+      mask |= uint64_t(1) << i;
+    }
+    ++i;
+  }
+  return mask;
+}
+
+}  // namespace
+
+bool InferMetaResultCache::Apply(const InferMetaCacheKey& key,
+                                 std::initializer_list<phi::DenseTensor*> outs) {
+  uint64_t out_presence = OutPresenceMask(outs);
+  for (auto& entry : entries_) {
+    if (!entry.used || entry.out_presence != out_presence ||
+        entry.key != key.words()) {
+      continue;
+    }
+    size_t i = 0;
+    for (auto* out : outs) {
+      if (out != nullptr) {
+        out->set_meta(entry.metas[i]);
+      }
+      ++i;
+    }
+    return true;
+  }
+  return false;
+}
+
+void InferMetaResultCache::Record(
+    const InferMetaCacheKey& key,
+    std::initializer_list<phi::DenseTensor*> outs) {
+  // set_meta() rejects invalid metas; an InferMeta function that leaves an
+  // output meta incomplete cannot be replayed, so never record it.
+  for (auto* out : outs) {
+    if (out != nullptr && !out->meta().valid()) {
+      return;
+    }
+  }
+  auto& entry = entries_[victim_];
+  victim_ = (victim_ + 1) % kCapacity;
+  entry.key = key.words();
+  entry.out_presence = OutPresenceMask(outs);
+  entry.metas.clear();
+  entry.metas.reserve(outs.size());
+  for (auto* out : outs) {
+    entry.metas.push_back(out != nullptr ? out->meta()
+                                         : phi::DenseTensorMeta());
+  }
+  entry.used = true;
+}
+
+}  // namespace experimental
+}  // namespace paddle
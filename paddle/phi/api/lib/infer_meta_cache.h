@@ -0,0 +1,161 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "paddle/phi/common/int_array.h"
+#include "paddle/phi/common/place.h"
+#include "paddle/phi/common/scalar.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/utils/optional.h"
+
+namespace paddle {
+namespace experimental {
+
+/**
+ * Key for memoized InferMeta results in the generated forward API.
+ *
+ * The builder flattens everything that can change the inferred output metas
+ * of a call site - the input metas (dims, dtype, layout, strides, lod) and
+ * the attribute values - into one word vector. Lookups compare the full
+ * vector, so a collision can only cost a miss, never a wrong shape.
+ */
+class InferMetaCacheKey {
+ public:
+  void AddTensor(const phi::DenseTensor& tensor);
+
+  void AddTensor(const paddle::optional<phi::DenseTensor>& tensor) {
+    words_.push_back(tensor ? 1u : 0u);
+    if (tensor) {
+      AddTensor(*tensor);
+    }
+  }
+
+  template <typename T,
+            typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+  void Add(T v) {
+    words_.push_back(static_cast<uint64_t>(v));
+  }
+
+  void Add(float v) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    words_.push_back(bits);
+  }
+
+  void Add(double v) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    words_.push_back(bits);
+  }
+
+  void Add(phi::DataType v) { words_.push_back(static_cast<uint64_t>(v)); }
+
+  void Add(phi::DataLayout v) { words_.push_back(static_cast<uint64_t>(v)); }
+
+  void Add(const phi::Place& v) {
+    words_.push_back(static_cast<uint64_t>(v.GetType()));
+    words_.push_back(static_cast<uint64_t>(v.GetDeviceId()));
+  }
+
+  void Add(const std::string& v) {
+    words_.push_back(v.size());
+    uint64_t word = 0;
+    for (size_t i = 0; i < v.size(); ++i) {
+      word = (word << 8) | static_cast<unsigned char>(v[i]);
+      if ((i & 7) == 7) {
+        words_.push_back(word);
+        word = 0;
+      }
+    }
+    if (v.size() & 7) {
+      words_.push_back(word);
+    }
+  }
+
+  void Add(const phi::Scalar& v);
+
+  void Add(const phi::IntArray& v) {
+    const auto& data = v.GetData();
+    words_.push_back(data.size());
+    for (auto d : data) {
+      words_.push_back(static_cast<uint64_t>(d));
+    }
+  }
+
+  // std::vector<bool> iterates over proxies, which the integral overload
+  // cannot bind to
+  void Add(const std::vector<bool>& v) {
+    words_.push_back(v.size());
+    for (bool e : v) {
+      Add(e);
+    }
+  }
+
+  template <typename T>
+  void Add(const std::vector<T>& v) {
+    words_.push_back(v.size());
+    for (const auto& e : v) {
+      Add(e);
+    }
+  }
+
+  const std::vector<uint64_t>& words() const { return words_; }
+
+ private:
+  std::vector<uint64_t> words_;
+};
+
+/**
+ * Small per-call-site memo of InferMeta output metas.
+ *
+ * A generated forward function owns one thread_local instance per dispatch
+ * branch, consults Apply() before running its InferMeta function and feeds
+ * the computed metas back through Record() on a miss. With stable shapes the
+ * steady state is one key compare plus a handful of set_meta calls; entries
+ * are replaced round-robin, so pathological shape churn degrades to the old
+ * behavior plus a vector compare.
+ */
+class InferMetaResultCache {
+ public:
+  // Applies the memoized output metas for `key`; returns false on a miss.
+  bool Apply(const InferMetaCacheKey& key,
+             std::initializer_list<phi::DenseTensor*> outs);
+
+  void Record(const InferMetaCacheKey& key,
+              std::initializer_list<phi::DenseTensor*> outs);
+
+ private:
+  static constexpr size_t kCapacity = 8;
+
+  struct Entry {
+    std::vector<uint64_t> key;
+    std::vector<phi::DenseTensorMeta> metas;
+    uint64_t out_presence{0};
+    bool used{false};
+  };
+
+  Entry entries_[kCapacity];
+  size_t victim_{0};
+};
+
+}  // namespace experimental
+}  // namespace paddle
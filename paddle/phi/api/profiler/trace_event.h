@@ -107,6 +107,10 @@ struct KernelEventInfo {
   float warps_per_sm;
   // theoretical achieved occupancy
   float occupancy;
+  // Id of the interpreter instruction whose launch produced this kernel,
+  // carried through the CUPTI external correlation API. 0 when the kernel
+  // was not launched from an instruction or correlation is unavailable.
+  uint64_t external_id;
 };
 
 static constexpr size_t kMemKindMaxLen = 50;
@@ -66,6 +66,9 @@ extern void *cupti_dso_handle;
   __macro(cuptiUnsubscribe);                  \
   __macro(cuptiEnableCallback);               \
   __macro(cuptiEnableDomain);                 \
+  __macro(cuptiActivityEnableLatencyTimestamps);     \
+  __macro(cuptiActivityPushExternalCorrelationId);   \
+  __macro(cuptiActivityPopExternalCorrelationId);    \
   __macro(cudaOccMaxActiveBlocksPerMultiprocessor);
 
 CUPTI_ROUTINE_EACH(DECLARE_DYNAMIC_LOAD_CUPTI_WRAP);
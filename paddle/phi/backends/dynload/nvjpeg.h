@@ -37,12 +37,15 @@ extern void *nvjpeg_dso_handle;
   };                                                               \
   extern DynLoad__##__name __name
 
-#define NVJPEG_RAND_ROUTINE_EACH(__macro) \
-  __macro(nvjpegCreateSimple);            \
-  __macro(nvjpegJpegStateCreate);         \
-  __macro(nvjpegGetImageInfo);            \
-  __macro(nvjpegJpegStateDestroy);        \
-  __macro(nvjpegDecode);
+#define NVJPEG_RAND_ROUTINE_EACH(__macro)  \
+  __macro(nvjpegCreateSimple);             \
+  __macro(nvjpegJpegStateCreate);          \
+  __macro(nvjpegGetImageInfo);             \
+  __macro(nvjpegJpegStateDestroy);         \
+  __macro(nvjpegDecode);                   \
+  __macro(nvjpegDecodeBatchedInitialize);  \
+  __macro(nvjpegDecodeBatched);            \
+  __macro(nvjpegDestroy);
 
 NVJPEG_RAND_ROUTINE_EACH(DECLARE_DYNAMIC_LOAD_NVJPEG_WRAP);
 
@@ -32,6 +32,7 @@
 
 #include "glog/logging.h"
 #include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/backends/gpu/launch_param_logger.h"
 #include "paddle/phi/core/enforce.h"
 
 // CUDA performs better when thread_per_block is between [64, 512]
@@ -232,6 +233,83 @@ inline GpuLaunchConfig GetGpuLaunchConfig3D(const phi::GPUContext& context,
   return config;
 }
 
+/* Feeds one launch into the LaunchParamLogger. Guard call sites with
+ * LaunchParamLogger::GetInstance().IsEnabled() so that building the kernel
+ * name costs nothing while the logger is off. The kernel symbol is needed
+ * here because the occupancy API takes the function pointer; the query runs
+ * once per (kernel, block size, shared mem) combination. */
+template <typename KernelT>
+inline void LogKernelLaunchParams(const phi::GPUContext& context,
+                                  const std::string& kernel_name,
+                                  KernelT kernel,
+                                  int64_t grid_size,
+                                  int block_size,
+                                  size_t shared_mem_bytes = 0) {
+  auto& logger = LaunchParamLogger::GetInstance();
+  if (!logger.IsEnabled()) return;
+  LaunchOccupancy occupancy;
+  const LaunchOccupancy* occupancy_ptr = nullptr;
+  if (logger.NeedsOccupancy(kernel_name, block_size, shared_mem_bytes)) {
+    int min_grid_size = 0;
+#ifdef PADDLE_WITH_HIP
+    hipOccupancyMaxActiveBlocksPerMultiprocessor(
+        &occupancy.max_active_blocks_per_sm,
+        kernel,
+        block_size,
+        shared_mem_bytes);
+    hipOccupancyMaxPotentialBlockSize(&min_grid_size,
+                                      &occupancy.optimal_block_size,
+                                      kernel,
+                                      shared_mem_bytes,
+                                      0);
+    hipOccupancyMaxActiveBlocksPerMultiprocessor(
+        &occupancy.optimal_active_blocks_per_sm,
+        kernel,
+        occupancy.optimal_block_size,
+        shared_mem_bytes);
+#else
+    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &occupancy.max_active_blocks_per_sm,
+        kernel,
+        block_size,
+        shared_mem_bytes);
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size,
+                                       &occupancy.optimal_block_size,
+                                       kernel,
+                                       shared_mem_bytes,
+                                       0);
+    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &occupancy.optimal_active_blocks_per_sm,
+        kernel,
+        occupancy.optimal_block_size,
+        shared_mem_bytes);
+#endif
+    occupancy_ptr = &occupancy;
+  }
+  int sm_count = context.GetSMCount();
+  logger.Record(kernel_name,
+                block_size,
+                grid_size,
+                shared_mem_bytes,
+                occupancy_ptr,
+                sm_count,
+                context.GetMaxPhysicalThreadCount() / sm_count);
+}
+
+template <typename KernelT>
+inline void LogKernelLaunchParams(const phi::GPUContext& context,
+                                  const std::string& kernel_name,
+                                  KernelT kernel,
+                                  const GpuLaunchConfig& config,
+                                  size_t shared_mem_bytes = 0) {
+  LogKernelLaunchParams(context,
+                        kernel_name,
+                        kernel,
+                        static_cast<int64_t>(config.GetGridSize()),
+                        static_cast<int>(config.GetBlockSize()),
+                        shared_mem_bytes);
+}
+
 template <typename Context>
 void LimitGridDim(const Context& ctx, dim3* grid_dim) {
   auto max_grid_dim =
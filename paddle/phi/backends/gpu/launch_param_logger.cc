@@ -0,0 +1,161 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/backends/gpu/launch_param_logger.h"
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "paddle/common/flags.h"
+
+PHI_DEFINE_EXPORTED_bool(
+    log_kernel_launch_params,
+    false,
+    "Record grid/block/shared-mem of logged GPU kernel launches and "
+    "compare achieved occupancy against the occupancy API's optimum, "
+    "reported by core.kernel_launch_report(). Debug only.");
+
+namespace phi {
+namespace backends {
+namespace gpu {
+
+LaunchParamLogger& LaunchParamLogger::GetInstance() {
+  static LaunchParamLogger* logger = [] {
+    auto* instance = new LaunchParamLogger;
+    if (FLAGS_log_kernel_launch_params) {
+      instance->Enable();
+    }
+    return instance;
+  }();
+  return *logger;
+}
+
+void LaunchParamLogger::Enable() {
+  enabled_.store(true, std::memory_order_release);
+}
+
+void LaunchParamLogger::Disable() {
+  enabled_.store(false, std::memory_order_release);
+}
+
+std::string LaunchParamLogger::MakeKey(const std::string& kernel_name,
+                                       int block_size,
+                                       size_t shared_mem_bytes) {
+  return kernel_name + "/block=" + std::to_string(block_size) +
+         "/shmem=" + std::to_string(shared_mem_bytes);
+}
+
+bool LaunchParamLogger::NeedsOccupancy(const std::string& kernel_name,
+                                       int block_size,
+                                       size_t shared_mem_bytes) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto result = stats_.emplace(MakeKey(kernel_name, block_size,
+                                       shared_mem_bytes),
+                               LaunchStats{});
+  if (result.second) {
+    result.first->second.block_size = block_size;
+    result.first->second.shared_mem_bytes = shared_mem_bytes;
+  }
+  return result.second;
+}
+
+void LaunchParamLogger::Record(const std::string& kernel_name,
+                               int block_size,
+                               int64_t grid_size,
+                               size_t shared_mem_bytes,
+                               const LaunchOccupancy* occupancy,
+                               int sm_count,
+                               int max_threads_per_sm) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  LaunchStats& stats =
+      stats_[MakeKey(kernel_name, block_size, shared_mem_bytes)];
+  stats.block_size = block_size;
+  stats.shared_mem_bytes = shared_mem_bytes;
+  stats.last_grid_size = grid_size;
+  if (occupancy != nullptr) {
+    stats.occupancy = *occupancy;
+    stats.occupancy_valid = true;
+    stats.optimal_occupancy =
+        std::min(1.0,
+                 static_cast<double>(occupancy->optimal_active_blocks_per_sm) *
+                     occupancy->optimal_block_size / max_threads_per_sm);
+  }
+  if (!stats.occupancy_valid) {
+    // Another thread has claimed the occupancy query for this key but
+    // has not recorded yet; skip this sample rather than mis-estimate.
+    return;
+  }
+  // Blocks resident per SM are capped by both the occupancy API limit
+  // and by how many blocks the grid supplies per SM.
+  double resident_blocks =
+      std::min(static_cast<double>(stats.occupancy.max_active_blocks_per_sm),
+               static_cast<double>(grid_size) / sm_count);
+  double achieved = std::min(
+      1.0, resident_blocks * block_size / max_threads_per_sm);
+  stats.calls++;
+  stats.achieved_occupancy_sum += achieved;
+  stats.min_achieved_occupancy = std::min(stats.min_achieved_occupancy,
+                                          achieved);
+}
+
+std::string LaunchParamLogger::Summary() const {
+  std::vector<std::pair<double, std::string>> lines;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    lines.reserve(stats_.size());
+    for (const auto& item : stats_) {
+      const LaunchStats& stats = item.second;
+      if (!stats.occupancy_valid || stats.calls == 0) {
+        continue;
+      }
+      double avg_achieved =
+          stats.achieved_occupancy_sum / static_cast<double>(stats.calls);
+      double unused = std::max(0.0, stats.optimal_occupancy - avg_achieved);
+      std::ostringstream line;
+      line.precision(2);
+      line << std::fixed << item.first << " calls=" << stats.calls
+           << " last_grid=" << stats.last_grid_size
+           << " achieved_occupancy=" << avg_achieved
+           << " min_achieved=" << stats.min_achieved_occupancy
+           << " optimal_occupancy=" << stats.optimal_occupancy
+           << " optimal_block=" << stats.occupancy.optimal_block_size
+           << " unused=" << unused;
+      lines.emplace_back(unused, line.str());
+    }
+  }
+  std::stable_sort(
+      lines.begin(), lines.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first > rhs.first;
+      });
+  std::ostringstream os;
+  for (const auto& line : lines) {
+    os << line.second << "\n";
+  }
+  return os.str();
+}
+
+void LaunchParamLogger::Reset() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  stats_.clear();
+}
+
+}  // namespace gpu
+}  // namespace backends
+}  // namespace phi
+
+#endif
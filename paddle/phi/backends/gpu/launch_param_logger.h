@@ -0,0 +1,110 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>  // NOLINT
+#include <string>
+
+namespace phi {
+namespace backends {
+namespace gpu {
+
+// Occupancy facts queried from the runtime occupancy API for one
+// (kernel, block size, shared memory) combination. Filled by the
+// LogKernelLaunchParams helper in gpu_launch_config.h, which holds the
+// kernel symbol the API needs.
+struct LaunchOccupancy {
+  int max_active_blocks_per_sm{0};
+  int optimal_block_size{0};
+  int optimal_active_blocks_per_sm{0};
+};
+
+// Opt-in logger for GPU kernel launch parameters. For every logged
+// launch it records grid/block/shared-mem and an achieved-occupancy
+// estimate (resident blocks per SM, capped by both the occupancy API
+// limit and the grid size), and compares it against the occupancy the
+// kernel would reach at the block size the occupancy API recommends.
+// Summary() ranks kernels by the occupancy they leave unused, which is
+// where stale block-size heuristics show up first on newer parts.
+//
+// Enabled at startup with FLAGS_log_kernel_launch_params or at runtime
+// from Python; one IsEnabled() load per launch while off. The occupancy
+// API is queried once per (kernel, block size, shared mem) key.
+class LaunchParamLogger {
+ public:
+  static LaunchParamLogger& GetInstance();
+
+  void Enable();
+  void Disable();
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Returns true the first time this combination is seen; the caller is
+  // then expected to query the occupancy API and pass the result to
+  // Record. Also creates the aggregation entry.
+  bool NeedsOccupancy(const std::string& kernel_name,
+                      int block_size,
+                      size_t shared_mem_bytes);
+
+  // occupancy may be nullptr when a previous call already supplied it.
+  void Record(const std::string& kernel_name,
+              int block_size,
+              int64_t grid_size,
+              size_t shared_mem_bytes,
+              const LaunchOccupancy* occupancy,
+              int sm_count,
+              int max_threads_per_sm);
+
+  // One line per (kernel, block size, shared mem) combination, ranked
+  // by unused occupancy (optimal minus average achieved), largest first.
+  std::string Summary() const;
+
+  void Reset();
+
+ private:
+  LaunchParamLogger() = default;
+  LaunchParamLogger(const LaunchParamLogger&) = delete;
+  LaunchParamLogger& operator=(const LaunchParamLogger&) = delete;
+
+  struct LaunchStats {
+    int block_size{0};
+    size_t shared_mem_bytes{0};
+    int64_t calls{0};
+    int64_t last_grid_size{0};
+    bool occupancy_valid{false};
+    LaunchOccupancy occupancy;
+    double achieved_occupancy_sum{0.0};
+    double min_achieved_occupancy{1.0};
+    double optimal_occupancy{0.0};
+  };
+
+  static std::string MakeKey(const std::string& kernel_name,
+                             int block_size,
+                             size_t shared_mem_bytes);
+
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex mutex_;
+  std::map<std::string, LaunchStats> stats_;
+};
+
+}  // namespace gpu
+}  // namespace backends
+}  // namespace phi
+
+#endif
@@ -21,6 +21,7 @@ limitations under the License. */
 #include "paddle/phi/common/float16.h"
 #include "paddle/phi/common/float8_e4m3fn.h"
 #include "paddle/phi/common/float8_e5m2.h"
+#include "paddle/phi/common/memory_utils.h"
 #include "paddle/phi/core/compat/convert_utils.h"
 
 /**
@@ -49,13 +50,17 @@ DenseTensor::DenseTensor(Allocator* a, const DenseTensorMeta& meta)
     : meta_(meta), holder_(a->Allocate(SizeOf(dtype()) * numel())) {}
 
 DenseTensor::DenseTensor(Allocator* a, DenseTensorMeta&& meta)
-    : meta_(meta), holder_(a->Allocate(SizeOf(dtype()) * numel())) {}
+    : meta_(std::move(meta)), holder_(a->Allocate(SizeOf(dtype()) * numel())) {}
 
 DenseTensor::DenseTensor(const std::shared_ptr<phi::Allocation>& holder,
                          const DenseTensorMeta& meta)
     : meta_(meta), holder_(holder) {}
 
 DenseTensor::DenseTensor(const DenseTensor& other) {  // NOLINT
+  // A shallow copy must alias the final buffer, so settle any pending
+  // copy-on-write share first; otherwise a later write to `other` would
+  // detach it from this alias.
+  other.UnshareCowBuffer();
   this->meta_ = other.meta();
   holder_ = other.holder_;
   storage_properties_ = CopyStorageProperties(other.storage_properties_);
@@ -66,8 +71,10 @@ DenseTensor& DenseTensor::operator=(const DenseTensor& other) {
   if (this == &other) {
     return *this;
   }
+  other.UnshareCowBuffer();
   meta_ = other.meta();
   holder_ = other.holder_;
+  cow_pending_ = false;
   storage_properties_ = CopyStorageProperties(other.storage_properties_);
   inplace_version_counter_ = other.inplace_version_counter_;
   return *this;
@@ -76,6 +83,7 @@ DenseTensor& DenseTensor::operator=(const DenseTensor& other) {
 DenseTensor& DenseTensor::operator=(DenseTensor&& other) noexcept {
   meta_ = std::move(other.meta_);
   std::swap(holder_, other.holder_);
+  std::swap(cow_pending_, other.cow_pending_);
   storage_properties_ = std::move(other.storage_properties_);
   std::swap(inplace_version_counter_, other.inplace_version_counter_);
   return *this;
@@ -92,6 +100,33 @@ bool DenseTensor::IsSharedWith(const DenseTensor& b) const {
   return holder_ && holder_ == b.Holder();
 }
 
+void DenseTensor::ShareCowBufferWith(const DenseTensor& src) {
+  holder_ = src.holder_;
+  meta_.offset = src.meta_.offset;
+  meta_.dtype = src.meta_.dtype;
+  cow_pending_ = true;
+  src.cow_pending_ = true;
+}
+
+void DenseTensor::UnshareCowBuffer() const {
+  if (!cow_pending_) {
+    return;
+  }
+  cow_pending_ = false;
+  if (holder_ == nullptr || holder_.use_count() == 1) {
+    // The other side of the share is already gone; the buffer is private.
+    return;
+  }
+  auto shared = holder_;
+  holder_ = memory_utils::AllocShared(shared->place(), shared->size());
+  // Clone the whole allocation so that meta_.offset stays valid.
+  memory_utils::Copy(holder_->place(),
+                     holder_->ptr(),
+                     shared->place(),
+                     shared->ptr(),
+                     shared->size());
+}
+
 void* DenseTensor::AllocateFrom(Allocator* allocator,
                                 DataType dtype,
                                 size_t requested_size,
@@ -143,7 +178,11 @@ void* DenseTensor::AllocateFrom(Allocator* allocator,
               "The size of Holder is not enough to store the Tensor."));
     }
     holder_ = std::move(holder);
+    // A reallocation drops the old bytes anyway, so a pending copy-on-write
+    // share needs no clone here.
+    cow_pending_ = false;
   }
+  UnshareCowBuffer();
   uintptr_t ptr = reinterpret_cast<uintptr_t>(holder_->ptr()) + meta_.offset;
   return reinterpret_cast<void*>(ptr);
 }
@@ -181,6 +220,8 @@ void* DenseTensor::data() {
       holder_,
       phi::errors::PreconditionNotMet(
           "The storage must be valid when call the data function."));
+  // The returned pointer may be written through.
+  UnshareCowBuffer();
   uintptr_t ptr = reinterpret_cast<uintptr_t>(holder_->ptr()) + meta_.offset;
   return reinterpret_cast<void*>(ptr);
 }
@@ -139,6 +139,19 @@ class TEST_API DenseTensor : public TensorBase,
   /// \return Whether the allocation is shared with other objects.
   bool IsSharedWith(const DenseTensor& b) const;
 
+  /// \brief Share the allocation of `src` copy-on-write. Both tensors keep
+  /// reading the same buffer, and whichever is written first through its
+  /// mutable data interfaces is cloned onto a private buffer beforehand.
+  /// Used by TensorCopy when FLAGS_tensor_copy_on_write is set.
+  /// \param src The tensor whose allocation is adopted.
+  void ShareCowBufferWith(const DenseTensor& src);
+
+  /// \brief Materialize a pending copy-on-write share: if the allocation is
+  /// still shared with another tensor, clone it onto a private buffer.
+  /// Logically non-mutating (the readable bytes do not change), so it can be
+  /// applied to const tensors before their buffer is aliased.
+  void UnshareCowBuffer() const;
+
   /// \brief Change the shape information in the metadata. If the new size is
   /// larger than the original value, the allocation area will be reallocated.
   /// \param dims The new dims of the dense tensor.
@@ -188,6 +201,7 @@ class TEST_API DenseTensor : public TensorBase,
 
   void clear() {
     holder_.reset();
+    cow_pending_ = false;
     meta_.offset = 0;
   }
 
@@ -197,7 +211,10 @@ class TEST_API DenseTensor : public TensorBase,
 
  protected:
   DenseTensorMeta meta_;
-  std::shared_ptr<phi::Allocation> holder_;
+  // Both are mutable so that UnshareCowBuffer() can settle a pending
+  // copy-on-write share on const tensors before their buffer is aliased.
+  mutable std::shared_ptr<phi::Allocation> holder_;
+  mutable bool cow_pending_{false};
 
   /** [ Why need StorageProperties? ]
    *
@@ -67,12 +67,20 @@ bool IsSharedBufferWith(const DenseTensor& src) const {
   return holder_ && holder_ == src.Holder();
 }
 
-const std::shared_ptr<phi::Allocation>& Holder() const { return holder_; }
+const std::shared_ptr<phi::Allocation>& Holder() const {
+  // The raw holder may be used to alias the buffer, which a pending
+  // copy-on-write share must not survive.
+  if (cow_pending_) {
+    UnshareCowBuffer();
+  }
+  return holder_;
+}
 
 void set_offset(size_t offset) { meta_.offset = offset; }
 size_t offset() const { return meta_.offset; }
 
 std::shared_ptr<phi::Allocation> MoveMemoryHolder() {
+  UnshareCowBuffer();
   return std::move(holder_);
 }
 
@@ -77,6 +77,9 @@ void DenseTensor::set_layout(const DataLayout layout) {
 
 // Note: When you reset holder, you need to ensure the offset is correct
 void DenseTensor::ResetHolder(const std::shared_ptr<phi::Allocation>& holder) {
+  // The old allocation is abandoned, together with any pending copy-on-write
+  // share over it.
+  cow_pending_ = false;
   if (holder_ && meta_.is_contiguous()) {
     PADDLE_ENFORCE_LE(
         numel() * static_cast<int64_t>(SizeOf(dtype())) +
@@ -118,8 +121,10 @@ void* DenseTensor::mutable_data(const Place& place,
       holder_->size() < size + meta_.offset) {
     holder_.reset();
     holder_ = memory_utils::AllocShared(place, size);
+    cow_pending_ = false;
     meta_.offset = 0;
   }
+  UnshareCowBuffer();
   uintptr_t ptr = reinterpret_cast<uintptr_t>(holder_->ptr()) + meta_.offset;
   return reinterpret_cast<void*>(ptr);
 }
@@ -149,8 +154,10 @@ void* DenseTensor::mutable_data(const Place& place,
         memory_utils::InSameStream(holder_, stream))) {
     holder_.reset();
     holder_ = memory_utils::AllocShared(place, size, stream);
+    cow_pending_ = false;
     meta_.offset = 0;
   }
+  UnshareCowBuffer();
   uintptr_t ptr = reinterpret_cast<uintptr_t>(holder_->ptr()) + meta_.offset;
   return reinterpret_cast<void*>(ptr);
 }
@@ -190,7 +197,11 @@ inline T* DenseTensor::mutable_data(const Place& place, size_t requested_size) {
 }
 
 void DenseTensor::ShareBufferWith(const DenseTensor& tensor, bool only_buffer) {
+  // An intentional alias must stick to the buffer `tensor` keeps, so settle
+  // any pending copy-on-write share of it first.
+  tensor.UnshareCowBuffer();
   holder_ = tensor.holder_;
+  cow_pending_ = false;
   if (!only_buffer) {
     meta_.offset = tensor.meta().offset;
     meta_.dtype = tensor.dtype();
@@ -316,6 +327,9 @@ DenseTensor DenseTensor::Slice(int64_t begin_idx, int64_t end_idx) const {
     return *this;
   } else {
     size_t base = numel() / meta_.dims[0];
+    // Slices alias holder_ directly, so settle any pending copy-on-write
+    // share first.
+    UnshareCowBuffer();
     DenseTensor dst;
     dst.holder_ = holder_;
     dst.set_layout(meta_.layout);
@@ -411,7 +425,9 @@ void DenseTensor::set_mem_desc(const dnnl::memory::desc& mem_desc) {
 // sharing other tensor members except lod
 DenseTensor& DenseTensor::ShareDataWith(const DenseTensor& src) {
   src.check_memory_size();
+  src.UnshareCowBuffer();
   holder_ = src.holder_;
+  cow_pending_ = false;
   meta_.is_scalar = src.meta_.is_scalar;
   meta_.dims = src.meta_.dims;
   meta_.dtype = src.meta_.dtype;
@@ -424,7 +440,9 @@ DenseTensor& DenseTensor::ShareDataWith(const DenseTensor& src) {
 }
 
 DenseTensor& DenseTensor::ShareDataNoCheckWith(const DenseTensor& src) {
+  src.UnshareCowBuffer();
   holder_ = src.holder_;
+  cow_pending_ = false;
   set_meta(src.meta());
   storage_properties_ = CopyStorageProperties(src.storage_properties_);
   return *this;
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/core/distributed/auto_parallel/reshard/reshard_cost_model.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "glog/logging.h"
+#include "paddle/common/flags.h"
+#include "paddle/phi/common/data_type.h"
+#include "paddle/phi/core/distributed/auto_parallel/dist_attr.h"
+#include "paddle/phi/core/distributed/auto_parallel/dist_tensor.h"
+#include "paddle/phi/core/distributed/auto_parallel/reshard/reshard_function.h"
+#include "paddle/phi/core/distributed/auto_parallel/reshard/reshard_utils.h"
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
+
+PHI_DEFINE_EXPORTED_bool(
+    use_reshard_cost_model,
+    false,
+    "Pick the reshard function with the lowest estimated communication cost "
+    "among all suitable candidates, instead of the first match in "
+    "registration order. Link bandwidths are configured via the "
+    "PADDLE_RESHARD_* environment variables.");
+
+namespace phi {
+namespace distributed {
+
+namespace {
+
+double EnvGbpsToBytesPerSec(const char* name, double default_gbps) {
+  const char* value = std::getenv(name);
+  if (value != nullptr) {
+    double gbps = std::atof(value);
+    if (gbps > 0) {
+      return gbps * 1e9;
+    }
+  }
+  return default_gbps * 1e9;
+}
+
+int64_t RanksPerNodeFromEnv() {
+  const char* value = std::getenv("PADDLE_RESHARD_RANKS_PER_NODE");
+  if (value != nullptr) {
+    int64_t ranks = std::atoll(value);
+    if (ranks > 0) {
+      return ranks;
+    }
+  }
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  int count = phi::backends::gpu::GetGPUDeviceCount();
+  if (count > 0) {
+    return count;
+  }
+#endif
+  return 8;
+}
+
+bool Contains(const std::string& name, const char* pattern) {
+  return name.find(pattern) != std::string::npos;
+}
+
+}  // namespace
+
+const ReshardTopologyConfig& ReshardTopologyConfig::Get() {
+  static ReshardTopologyConfig config = [] {
+    ReshardTopologyConfig c;
+    c.intra_node_bandwidth =
+        EnvGbpsToBytesPerSec("PADDLE_RESHARD_INTRA_NODE_BW_GBPS", 300.0);
+    c.inter_node_bandwidth =
+        EnvGbpsToBytesPerSec("PADDLE_RESHARD_INTER_NODE_BW_GBPS", 25.0);
+    c.latency_per_step = 20e-6;
+    c.ranks_per_node = RanksPerNodeFromEnv();
+    return c;
+  }();
+  return config;
+}
+
+double ReshardCostModel::Estimate(ReshardFunction* func,
+                                  const DistTensor& in,
+                                  const TensorDistAttr& out_dist_attr) {
+  const auto& config = ReshardTopologyConfig::Get();
+  const auto& in_mesh = in.dist_attr().process_mesh();
+  const auto& out_mesh = out_dist_attr.process_mesh();
+  std::vector<int64_t> procs =
+      GetUnionProcessIds(in_mesh.process_ids(), out_mesh.process_ids());
+  double n = static_cast<double>(std::max<size_t>(procs.size(), 1));
+
+  bool single_node = true;
+  for (int64_t pid : procs) {
+    if (pid / config.ranks_per_node != procs[0] / config.ranks_per_node) {
+      single_node = false;
+      break;
+    }
+  }
+  double bandwidth =
+      single_node ? config.intra_node_bandwidth : config.inter_node_bandwidth;
+
+  double bytes = static_cast<double>(in.numel()) *
+                 static_cast<double>(phi::SizeOf(in.dtype()));
+
+  // Bytes a rank moves over the bottleneck link for the candidate's dominant
+  // collective, following the usual ring-algorithm volumes.
+  const std::string name = func->Name();
+  double volume = 0;
+  if (Contains(name, "PToR")) {
+    volume = 2.0 * bytes * (n - 1) / n;  // all_reduce
+  } else if (Contains(name, "SToR")) {
+    volume = bytes * (n - 1) / n;  // all_gather
+  } else if (Contains(name, "SToS")) {
+    volume = bytes * (n - 1) / n;  // all_to_all
+  } else if (Contains(name, "PToS") || Contains(name, "SToP")) {
+    volume = bytes * (n - 1) / n;  // reduce_scatter
+  } else if (Contains(name, "RToS") || Contains(name, "RToP")) {
+    volume = 0;  // local slice / assign
+  } else if (Contains(name, "SameStatus")) {
+    volume = bytes / n;  // each rank forwards its local shard p2p
+  } else if (Contains(name, "NdMesh")) {
+    // multi-phase composite over mesh axes; price conservatively
+    volume = 1.5 * bytes;
+  } else {
+    // broadcast-like expand/shrink between global and sub meshes
+    volume = bytes;
+  }
+
+  double steps = 1;
+  if (Contains(name, "CrossMesh") || Contains(name, "CrossNdMesh")) {
+    // cross-mesh composites restore status first, then ship shards over
+    volume += bytes / n;
+    steps = 2;
+  }
+
+  double seconds = volume / bandwidth + steps * config.latency_per_step;
+  VLOG(5) << "Reshard cost of " << name << ": " << seconds << "s (volume "
+          << volume << " bytes over " << (single_node ? "intra" : "inter")
+          << "-node link, " << procs.size() << " ranks).";
+  return seconds;
+}
+
+}  // namespace distributed
+}  // namespace phi
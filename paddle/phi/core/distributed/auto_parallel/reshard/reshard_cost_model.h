@@ -0,0 +1,59 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace phi {
+namespace distributed {
+
+class DistTensor;
+class TensorDistAttr;
+class ReshardFunction;
+
+// Link parameters the reshard cost model plans against. Defaults assume
+// NVLink inside a node and InfiniBand across nodes; deployments with other
+// fabrics (e.g. PCIe-only boxes) override them through environment
+// variables, all read once at first use:
+//   PADDLE_RESHARD_INTRA_NODE_BW_GBPS   (default 300)
+//   PADDLE_RESHARD_INTER_NODE_BW_GBPS   (default 25)
+//   PADDLE_RESHARD_RANKS_PER_NODE       (default: visible gpu count, else 8)
+struct ReshardTopologyConfig {
+  double intra_node_bandwidth;  // bytes per second
+  double inter_node_bandwidth;  // bytes per second
+  double latency_per_step;      // seconds added per collective launch
+  int64_t ranks_per_node;
+
+  static const ReshardTopologyConfig& Get();
+};
+
+// Ranks suitable reshard candidates by estimated communication time so the
+// registry can pick the cheapest composite instead of the first match in
+// registration order. Estimates are only used to compare candidates for the
+// same transition, not to predict wall time: each candidate is mapped to its
+// dominant collective pattern and priced as bytes-on-the-bottleneck-link
+// plus a per-step launch latency. Ranks are assumed to fill nodes
+// contiguously (global rank / ranks_per_node), which matches our launchers.
+class ReshardCostModel {
+ public:
+  static double Estimate(ReshardFunction* func,
+                         const DistTensor& in,
+                         const TensorDistAttr& out_dist_attr);
+};
+
+}  // namespace distributed
+}  // namespace phi
@@ -16,9 +16,11 @@
 
 #include "glog/logging.h"
 
+#include "paddle/common/flags.h"
 #include "paddle/phi/core/distributed/auto_parallel/dist_tensor.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/global_and_sub_mesh_reshard_function.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/nd_mesh_reshard_function.h"
+#include "paddle/phi/core/distributed/auto_parallel/reshard/reshard_cost_model.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/p_to_r_reshard_function.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/p_to_s_reshard_function.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/r_to_p_reshard_function.h"
@@ -30,15 +32,39 @@
 #include "paddle/phi/core/distributed/auto_parallel/reshard/same_status_reshard_function.h"
 #include "paddle/phi/core/distributed/auto_parallel/reshard/x_to_r_reshard_function.h"
 
+COMMON_DECLARE_bool(use_reshard_cost_model);
+
 namespace phi {
 namespace distributed {
 
 ReshardFunction* ChooseProperReshardFunction(
     const DistTensor& in, const TensorDistAttr& out_dist_attr) {
-  for (const auto& func : GetReshardFunctionList()) {
-    if (func->IsSuitable(in, out_dist_attr)) {
-      VLOG(4) << "Choose ReshardFunction: " << func->Name();
-      return func.get();
+  if (FLAGS_use_reshard_cost_model) {
+    // rank every suitable candidate by estimated communication time and take
+    // the cheapest; registration order only breaks ties
+    ReshardFunction* best_func = nullptr;
+    double best_cost = 0;
+    for (const auto& func : GetReshardFunctionList()) {
+      if (!func->IsSuitable(in, out_dist_attr)) {
+        continue;
+      }
+      double cost = ReshardCostModel::Estimate(func.get(), in, out_dist_attr);
+      if (best_func == nullptr || cost < best_cost) {
+        best_func = func.get();
+        best_cost = cost;
+      }
+    }
+    if (best_func != nullptr) {
+      VLOG(4) << "Choose ReshardFunction: " << best_func->Name()
+              << " by cost model, estimated " << best_cost << "s.";
+      return best_func;
+    }
+  } else {
+    for (const auto& func : GetReshardFunctionList()) {
+      if (func->IsSuitable(in, out_dist_attr)) {
+        VLOG(4) << "Choose ReshardFunction: " << func->Name();
+        return func.get();
+      }
     }
   }
   PADDLE_THROW(phi::errors::Unimplemented(
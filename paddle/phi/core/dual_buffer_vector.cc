@@ -0,0 +1,104 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "paddle/phi/core/dual_buffer_vector.h"
+
+#include "glog/logging.h"
+#include "paddle/phi/backends/context_pool.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/core/enforce.h"
+
+namespace phi {
+
+template <typename T>
+void DualBufferVector<T>::SyncToHost() const {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  if (!device_dirty_.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(sync_mutex_);
+  if (!device_dirty_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto *dev_ctx = static_cast<phi::GPUContext *>(
+      phi::DeviceContextPool::Instance().Get(device_->place()));
+  memory_utils::Copy(phi::CPUPlace(),
+                     host_.data(),
+                     device_->place(),
+                     device_->ptr(),
+                     device_size_ * sizeof(T),
+                     dev_ctx->stream());
+  // The caller reads the host buffer right after this returns.
+  dev_ctx->Wait();
+  device_dirty_.store(false, std::memory_order_release);
+#endif
+}
+
+template <typename T>
+const T *DualBufferVector<T>::SyncToDevice(const Place &place) const {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  std::lock_guard<std::mutex> guard(sync_mutex_);
+  uint64_t host_epoch = host_epoch_.load(std::memory_order_relaxed);
+  if (device_ != nullptr &&
+      device_epoch_.load(std::memory_order_relaxed) == host_epoch &&
+      device_->place() == place) {
+    return reinterpret_cast<const T *>(device_->ptr());
+  }
+  if (device_dirty_.load(std::memory_order_relaxed)) {
+    // The freshest copy lives on another device; pull it back before
+    // re-uploading.
+    auto *src_ctx = static_cast<phi::GPUContext *>(
+        phi::DeviceContextPool::Instance().Get(device_->place()));
+    memory_utils::Copy(phi::CPUPlace(),
+                       host_.data(),
+                       device_->place(),
+                       device_->ptr(),
+                       device_size_ * sizeof(T),
+                       src_ctx->stream());
+    src_ctx->Wait();
+    device_dirty_.store(false, std::memory_order_relaxed);
+  }
+  size_t bytes = host_.size() * sizeof(T);
+  device_size_ = host_.size();
+  if (device_ == nullptr || device_capacity_ < bytes ||
+      !(device_->place() == place)) {
+    device_ = memory_utils::Alloc(place, bytes);
+    device_capacity_ = bytes;
+  }
+  if (bytes > 0) {
+    auto *dev_ctx = static_cast<phi::GPUContext *>(
+        phi::DeviceContextPool::Instance().Get(place));
+    // An async copy out of pageable host memory returns only after the
+    // source has been staged, and kernels on the same stream are ordered
+    // behind the copy, so no Wait() is needed here.
+    memory_utils::Copy(place,
+                       device_->ptr(),
+                       phi::CPUPlace(),
+                       host_.data(),
+                       bytes,
+                       dev_ctx->stream());
+  }
+  device_epoch_.store(host_epoch, std::memory_order_release);
+  return reinterpret_cast<const T *>(device_->ptr());
+#else
+  PADDLE_THROW(phi::errors::Unavailable(
+      "DualBufferVector can only provide a device view in GPU builds."));
+#endif
+}
+
+template class DualBufferVector<size_t>;
+template class DualBufferVector<int>;
+template class DualBufferVector<int64_t>;
+
+}  // namespace phi
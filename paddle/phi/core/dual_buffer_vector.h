@@ -0,0 +1,112 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <vector>
+
+#include "paddle/phi/common/place.h"
+#include "paddle/phi/core/allocator.h"
+
+namespace phi {
+
+// DualBufferVector<T> owns a host std::vector together with a lazily
+// allocated device mirror and keeps the two in sync through epoch counters
+// instead of MixVector's per-wrapper dirty flags.
+//
+// Every mutable host access bumps host_epoch_; the device view remembers the
+// epoch it was uploaded at, so once the two epochs match, DeviceData() is a
+// pair of atomic loads and hands out the device pointer without taking any
+// lock. Only the stale path (re-upload, or reading back a device-dirty
+// buffer) serializes on a mutex. Uploads are enqueued asynchronously on the
+// destination device's pooled stream; unlike MixVector there is no Wait()
+// after them, because a pageable-memory async copy only returns once the
+// source has been staged and kernels on the same stream are already ordered
+// behind the copy.
+//
+// Because the structure outlives a single kernel call, the device buffer is
+// reused across calls as long as the host side does not change; MixVector
+// re-allocated and re-uploaded on every transient wrapper.
+//
+// The device side can never resize the vector: MutableDeviceData() writes in
+// place, so size() is always the host size.
+template <typename T>
+class DualBufferVector {
+ public:
+  DualBufferVector() = default;
+
+  explicit DualBufferVector(const std::vector<T>& init) : host_(init) {}
+
+  DualBufferVector(const DualBufferVector&) = delete;
+  DualBufferVector& operator=(const DualBufferVector&) = delete;
+
+  // Read-only view of the host buffer; copies a dirty device buffer back
+  // first.
+  const std::vector<T>& HostVector() const {
+    SyncToHost();
+    return host_;
+  }
+
+  // Mutable view of the host buffer. The returned vector may be resized or
+  // rewritten freely, but must not be written again after a later
+  // DeviceData() call without reacquiring it, or the device view would
+  // wrongly stay validated.
+  std::vector<T>* MutableHostVector() {
+    SyncToHost();
+    host_epoch_.fetch_add(1, std::memory_order_release);
+    return &host_;
+  }
+
+  size_t size() const { return host_.size(); }
+
+  // Device-resident view of the data, uploaded on the place's stream when
+  // the host side changed since the last upload. Lock-free once validated.
+  const T* DeviceData(const Place& place) const {
+    if (device_ != nullptr &&
+        device_epoch_.load(std::memory_order_acquire) ==
+            host_epoch_.load(std::memory_order_relaxed) &&
+        device_->place() == place) {
+      return reinterpret_cast<const T*>(device_->ptr());
+    }
+    return SyncToDevice(place);
+  }
+
+  // Same as DeviceData(), but marks the device buffer dirty so the next host
+  // access copies it back.
+  T* MutableDeviceData(const Place& place) {
+    const T* data = DeviceData(place);
+    device_dirty_.store(true, std::memory_order_release);
+    return const_cast<T*>(data);
+  }
+
+ private:
+  void SyncToHost() const;
+  const T* SyncToDevice(const Place& place) const;
+
+  mutable std::vector<T> host_;
+  mutable Allocator::AllocationPtr device_{nullptr};
+  mutable size_t device_capacity_{0};  // bytes backing device_
+  mutable size_t device_size_{0};      // elements mirrored on device
+  // host_epoch_ starts ahead of device_epoch_ so the first device access
+  // always uploads.
+  mutable std::atomic<uint64_t> host_epoch_{1};
+  mutable std::atomic<uint64_t> device_epoch_{0};
+  mutable std::atomic<bool> device_dirty_{false};
+  mutable std::mutex sync_mutex_;
+};
+
+}  // namespace phi
@@ -16,6 +16,36 @@
 
 namespace phi {
 
+void* KernelScratchArena::Allocate(size_t size, size_t alignment) {
+  PADDLE_ENFORCE_EQ(
+      (alignment & (alignment - 1)),
+      0UL,
+      errors::InvalidArgument(
+          "Scratch alignment should be a power of 2, but got %d.", alignment));
+  for (;;) {
+    if (current_slab_ < slabs_.size()) {
+      uintptr_t base = reinterpret_cast<uintptr_t>(slabs_[current_slab_].get());
+      uintptr_t aligned = (base + offset_ + alignment - 1) & ~(alignment - 1);
+      if (aligned + size <= base + slab_sizes_[current_slab_]) {
+        offset_ = aligned + size - base;
+        return reinterpret_cast<void*>(aligned);
+      }
+      // The rest of this slab is too small; try the next one.
+      ++current_slab_;
+      offset_ = 0;
+      continue;
+    }
+    size_t slab_size = std::max(kSlabSize, size + alignment);
+    slabs_.emplace_back(new uint8_t[slab_size]);
+    slab_sizes_.push_back(slab_size);
+  }
+}
+
+void KernelScratchArena::Reset() {
+  current_slab_ = 0;
+  offset_ = 0;
+}
+
 void KernelContext::EmplaceBackInput(const TensorBase* input) {
   int index = static_cast<int>(inputs_.size());
   inputs_.emplace_back(input);
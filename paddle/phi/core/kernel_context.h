@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iterator>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "paddle/phi/core/attribute.h"
 #include "paddle/phi/core/device_context.h"
@@ -28,6 +31,37 @@
 
 namespace phi {
 
+/**
+ * A bump arena for host-side kernel temporaries whose lifetime is exactly
+ * one kernel invocation. Allocation is an aligned pointer bump into a slab;
+ * Reset() reclaims everything in O(1) while keeping the slabs, so repeated
+ * invocations reuse the same memory instead of going through the global
+ * allocator for every short-lived workspace buffer.
+ */
+class KernelScratchArena {
+ public:
+  KernelScratchArena() = default;
+  KernelScratchArena(const KernelScratchArena&) = delete;
+  KernelScratchArena& operator=(const KernelScratchArena&) = delete;
+  // Movable so that contexts owning an arena can live inside containers and
+  // instruction objects.
+  KernelScratchArena(KernelScratchArena&&) = default;
+  KernelScratchArena& operator=(KernelScratchArena&&) = default;
+
+  void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  // Reclaim all scratch allocations at once; the slabs stay cached.
+  void Reset();
+
+ private:
+  static constexpr size_t kSlabSize = 64 * 1024;
+
+  std::vector<std::unique_ptr<uint8_t[]>> slabs_;
+  std::vector<size_t> slab_sizes_;
+  size_t current_slab_{0};
+  size_t offset_{0};
+};
+
 /**
  * Note: KernelContext doesn't manage the life of DeviceContext and Tensor
  *
@@ -160,9 +194,24 @@ class KernelContext {
     output_range_.clear();
   }
 
+  void ClearAttrs() { attrs_.clear(); }
+
+  // Host scratch space living exactly as long as one kernel invocation.
+  // Kernels use this for small meta/workspace buffers instead of the global
+  // allocator; the caller that drives the kernel resets it wholesale after
+  // the launch completed.
+  void* ScratchAlloc(size_t size,
+                     size_t alignment = alignof(std::max_align_t)) {
+    return scratch_arena_.Allocate(size, alignment);
+  }
+
+  void ResetScratch() { scratch_arena_.Reset(); }
+
  private:
   DeviceContext* dev_ctx_;
 
+  KernelScratchArena scratch_arena_;
+
   paddle::small_vector<const TensorBase*> inputs_;
   paddle::small_vector<TensorBase*> outputs_;
   paddle::small_vector<Attribute, kAttrSmallVectorSize> attrs_;
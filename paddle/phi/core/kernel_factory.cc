@@ -14,8 +14,12 @@
 
 #include "paddle/phi/core/kernel_factory.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include "glog/logging.h"
 #include "paddle/common/flags.h"
+#include "paddle/common/hot_counter.h"
 #include "paddle/phi/core/enforce.h"
 #if defined(PADDLE_WITH_XPU)
 #include "paddle/phi/backends/xpu/xpu_op_list.h"
@@ -60,7 +64,75 @@ KernelFactory& KernelFactory::Instance() {
   return g_op_kernel_factory;
 }
 
+bool KernelFactory::DeferKernelRegistration() {
+  // the registrars run before flag parsing, so this is env driven
+  static bool defer = []() {
+    const char* env = std::getenv("PADDLE_LAZY_KERNEL_REGISTRATION");
+    return env != nullptr &&
+           (std::strcmp(env, "1") == 0 || std::strcmp(env, "true") == 0);
+  }();
+  return defer;
+}
+
+void KernelFactory::AddDeferredKernel(const DeferredKernelDesc& desc) {
+  std::lock_guard<std::mutex> lock(deferred_mutex_);
+  deferred_kernels_[desc.kernel_name].push_back(desc);
+  has_deferred_.store(true, std::memory_order_release);
+}
+
+void KernelFactory::MaterializeKernels(
+    const std::vector<std::string>& kernel_names) const {
+  for (auto& kernel_name : kernel_names) {
+    EnsureKernelMaterialized(kernel_name);
+  }
+}
+
+void KernelFactory::EnsureAllKernelsMaterialized() const {
+  if (!has_deferred_.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(deferred_mutex_);
+  for (auto& pair : deferred_kernels_) {
+    for (auto& desc : pair.second) {
+      ConstructDeferredKernel(desc);
+    }
+  }
+  deferred_kernels_.clear();
+  has_deferred_.store(false, std::memory_order_release);
+}
+
+void KernelFactory::MaterializeDeferredKernels(
+    const std::string& kernel_name) const {
+  std::lock_guard<std::mutex> lock(deferred_mutex_);
+  auto iter = deferred_kernels_.find(kernel_name);
+  if (iter == deferred_kernels_.end()) {
+    return;
+  }
+  for (auto& desc : iter->second) {
+    ConstructDeferredKernel(desc);
+  }
+  deferred_kernels_.erase(iter);
+  if (deferred_kernels_.empty()) {
+    has_deferred_.store(false, std::memory_order_release);
+  }
+}
+
+void KernelFactory::ConstructDeferredKernel(
+    const DeferredKernelDesc& desc) const {
+  KernelKey kernel_key(paddle::experimental::StringToBackend(desc.backend),
+                       desc.layout,
+                       desc.dtype);
+  Kernel kernel(desc.kernel_fn, desc.variadic_kernel_fn);
+  if (kernel.GetKernelRegisteredType() == KernelRegisteredType::FUNCTION) {
+    desc.args_parse_fn(kernel_key, kernel.mutable_args_def());
+  }
+  desc.args_def_fn(kernel_key, &kernel);
+  kernels_[desc.kernel_name][kernel_key] = kernel;
+  version_.fetch_add(1, std::memory_order_release);
+}
+
 bool KernelFactory::HasCompatiblePhiKernel(const std::string& op_type) const {
+  EnsureKernelMaterialized(op_type);
   if (deprecated_op_names.find(op_type) == deprecated_op_names.end()) {
     if (phi::OpUtilsMap::Instance().Contains(op_type) ||
         (kernels_.find(op_type) != kernels_.end())) {
@@ -72,6 +144,7 @@ bool KernelFactory::HasCompatiblePhiKernel(const std::string& op_type) const {
 
 bool KernelFactory::HasStructuredKernel(const std::string& op_type) const {
   auto phi_kernel_name = phi::OpUtilsMap::Instance().GetBaseKernelName(op_type);
+  EnsureKernelMaterialized(phi_kernel_name);
   auto kernel_iter = kernels_.find(phi_kernel_name);
   if (deprecated_op_names.find(op_type) == deprecated_op_names.end() &&
       kernel_iter != kernels_.end()) {
@@ -87,6 +160,7 @@ bool KernelFactory::HasStructuredKernel(const std::string& op_type) const {
 
 const Kernel& KernelFactory::SelectKernel(const std::string& kernel_name,
                                           const KernelKey& kernel_key) const {
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
   if (iter == kernels_.end()) {
     return empty_kernel;
@@ -117,6 +191,7 @@ const Kernel& KernelFactory::SelectKernel(const std::string& kernel_name,
 
 const Kernel& KernelFactory::SelectKernelWithGPUDNN(
     const std::string& kernel_name, const KernelKey& const_kernel_key) const {
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
   if (iter == kernels_.end()) {
     return empty_kernel;
@@ -160,6 +235,7 @@ const Kernel& KernelFactory::SelectKernelWithGPUDNN(
 
 KernelKeyMap KernelFactory::SelectKernelMap(
     const std::string& kernel_name) const {
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
   if (iter == kernels_.end()) {
     return KernelKeyMap();
@@ -169,6 +245,7 @@ KernelKeyMap KernelFactory::SelectKernelMap(
 
 bool KernelFactory::HasKernel(const std::string& kernel_name,
                               const KernelKey& kernel_key) const {
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
   PADDLE_ENFORCE_NE(
       iter,
@@ -231,6 +308,8 @@ KernelResult KernelFactory::SelectKernelOrThrowError(
     const std::string& kernel_name,
     const KernelKey& const_kernel_key,
     bool use_strided_kernel) const {
+  COMMON_HOT_COUNTER_INC("kernel_factory.select");
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
 
   PADDLE_ENFORCE_NE(
@@ -276,6 +355,9 @@ KernelResult KernelFactory::SelectKernelOrThrowError(
   }
 #endif
   auto kernel_iter = iter->second.find(kernel_key);
+  if (kernel_iter != iter->second.end()) {
+    COMMON_HOT_COUNTER_INC("kernel_factory.exact_key_hit");
+  }
 
   PADDLE_ENFORCE_NE(
       kernel_iter == iter->second.end() && kernel_key.backend() == Backend::CPU,
@@ -350,6 +432,7 @@ KernelResult KernelFactory::SelectKernelOrThrowError(
             << ", expected_kernel_key:" << kernel_key
             << ", fallbacking to CPU one!";
 
+    COMMON_HOT_COUNTER_INC("kernel_factory.cpu_fallback");
     return {kernel_iter->second, true, false};
   }
 
@@ -368,8 +451,45 @@ KernelResult KernelFactory::SelectKernelOrThrowError(
   return {kernel_iter->second, false, false};
 }
 
+KernelResult KernelFactory::SelectKernelOrThrowError(
+    const std::string& kernel_name,
+    const KernelKey& kernel_key,
+    bool use_strided_kernel,
+    KernelResultCache* cache) const {
+  // The dispatch flags take part in the resolution, so a flag flip (e.g. in
+  // tests) must invalidate cached results just like a map mutation does.
+  uint8_t flags =
+      static_cast<uint8_t>(FLAGS_use_stride_kernel ? 1 : 0) |
+      static_cast<uint8_t>(FLAGS_enable_api_kernel_fallback ? 2 : 0);
+#if defined(PADDLE_WITH_XPU_KP)
+  flags |= static_cast<uint8_t>(FLAGS_run_kp_kernel ? 4 : 0);
+#endif
+  uint64_t version = version_.load(std::memory_order_acquire);
+  auto& entry = cache->entries_[KernelResultCache::SlotOf(kernel_key)];
+  if (entry.version == version && entry.flags == flags &&
+      entry.use_strided_kernel == use_strided_kernel &&
+      entry.key == kernel_key) {
+    COMMON_HOT_COUNTER_INC("kernel_factory.select_cached");
+    return {*entry.kernel, entry.has_fallback_cpu, entry.is_stride_kernel};
+  }
+
+  auto result =
+      SelectKernelOrThrowError(kernel_name, kernel_key, use_strided_kernel);
+  // If the resolution materialized deferred kernels, `version` is stale by
+  // now; the entry then simply misses once more and is refilled.
+  entry.key = kernel_key;
+  entry.kernel = &result.kernel;
+  entry.version = version;
+  entry.flags = flags;
+  entry.use_strided_kernel = use_strided_kernel;
+  entry.has_fallback_cpu = result.has_fallback_cpu;
+  entry.is_stride_kernel = result.is_stride_kernel;
+  return result;
+}
+
 const KernelArgsDef& KernelFactory::GetFirstKernelArgsDef(
     const std::string& kernel_name) const {
+  EnsureKernelMaterialized(kernel_name);
   auto iter = kernels_.find(kernel_name);
   PADDLE_ENFORCE_NE(
       iter,
@@ -14,10 +14,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
+#include <mutex>  // NOLINT
 #include <ostream>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "paddle/common/layout.h"
 #include "paddle/phi/common/backend.h"
 #include "paddle/phi/common/data_type.h"
@@ -307,6 +310,59 @@ struct KernelResult {
   bool is_stride_kernel = false;
 };
 
+/**
+ * Per-call-site memo for SelectKernelOrThrowError().
+ *
+ * Steady-state dispatch redoes the same backend/layout/dtype fallback walk
+ * with the same answer on every invocation of an API. A call site that owns
+ * a thread_local KernelResultCache (one cache per kernel name) and passes it
+ * to SelectKernelOrThrowError() turns that walk into one key compare and one
+ * load. Entries are retired when the kernel map version changes (kernel
+ * registration, deferred materialization, a custom device plugin load) or
+ * when one of the dispatch flags flips, so a cached result can never outlive
+ * a rehash of the underlying flat_hash_map.
+ */
+class KernelResultCache {
+ private:
+  friend class KernelFactory;
+
+  static constexpr size_t kSlots = 4;
+
+  struct Entry {
+    KernelKey key;
+    const Kernel* kernel{nullptr};
+    uint64_t version{0};
+    uint8_t flags{0};
+    bool use_strided_kernel{false};
+    bool has_fallback_cpu{false};
+    bool is_stride_kernel{false};
+  };
+
+  // The low hash bits hold the backend, which is mostly constant per call
+  // site; fold in the dtype bits so mixed-precision sites spread over slots.
+  static size_t SlotOf(const KernelKey& key) {
+    uint32_t h = key.hash_value();
+    return (h ^ (h >> 12)) & (kSlots - 1);
+  }
+
+  Entry entries_[kSlots];
+};
+
+// Lightweight record of a deferred kernel registration. The registration
+// macros only expand to string literals and function pointers, so deferring
+// a kernel costs a few words; the full Kernel (argument defs parsed from
+// the kernel signature) is only built on first lookup of its name.
+struct DeferredKernelDesc {
+  const char* kernel_name;  // string literal from the registration macro
+  const char* backend;
+  DataLayout layout;
+  DataType dtype;
+  KernelArgsParseFn args_parse_fn;
+  KernelArgsDefFn args_def_fn;
+  KernelFn kernel_fn;
+  void* variadic_kernel_fn;
+};
+
 /**
  * Note: Each Computation need a basic kernel map that named by kernel_name.
  *       Such as for scale op, KernelMap contains a `scale` kernel map,
@@ -317,7 +373,26 @@ class KernelFactory {
  public:
   static KernelFactory& Instance();
 
-  KernelNameMap& kernels() { return kernels_; }
+  KernelNameMap& kernels() {
+    EnsureAllKernelsMaterialized();
+    // Mutable exposure: assume the caller changes the map and retire any
+    // memoized selection results.
+    version_.fetch_add(1, std::memory_order_release);
+    return kernels_;
+  }
+
+  // Whether registrars defer kernel construction to first lookup. The
+  // registrars run before flag parsing, so this is driven by the
+  // PADDLE_LAZY_KERNEL_REGISTRATION environment variable. While any
+  // kernel is still deferred, lookups that materialize it mutate the
+  // kernel map, so enabling this assumes first lookups happen before
+  // concurrent execution starts (e.g. during single threaded tracing).
+  static bool DeferKernelRegistration();
+
+  void AddDeferredKernel(const DeferredKernelDesc& desc);
+
+  // pre-warms a named set of kernels for latency critical paths
+  void MaterializeKernels(const std::vector<std::string>& kernel_names) const;
 
   bool HasCompatiblePhiKernel(const std::string& op_type) const;
 
@@ -327,6 +402,14 @@ class KernelFactory {
                                         const KernelKey& kernel_key,
                                         bool use_strided_kernel = false) const;
 
+  // Memoizing overload: consults the call-site owned `cache` first and only
+  // falls back to the full resolution on a miss. The cache must always be
+  // used with the same kernel name.
+  KernelResult SelectKernelOrThrowError(const std::string& kernel_name,
+                                        const KernelKey& kernel_key,
+                                        bool use_strided_kernel,
+                                        KernelResultCache* cache) const;
+
   bool HasKernel(const std::string& kernel_name,
                  const KernelKey& kernel_key) const;
 
@@ -351,7 +434,30 @@ class KernelFactory {
  private:
   KernelFactory() = default;
 
-  KernelNameMap kernels_;
+  // builds the deferred kernels registered under one name, if any
+  void EnsureKernelMaterialized(const std::string& kernel_name) const {
+    if (!has_deferred_.load(std::memory_order_acquire)) {
+      return;
+    }
+    MaterializeDeferredKernels(kernel_name);
+  }
+
+  void EnsureAllKernelsMaterialized() const;
+
+  void MaterializeDeferredKernels(const std::string& kernel_name) const;
+
+  void ConstructDeferredKernel(const DeferredKernelDesc& desc) const;
+
+  // mutable so const lookups can materialize deferred kernels
+  mutable KernelNameMap kernels_;
+
+  mutable std::mutex deferred_mutex_;
+  mutable std::atomic<bool> has_deferred_{false};
+  // bumped on every kernel map mutation; starts at 1 so that the
+  // zero-initialized entries of a fresh KernelResultCache never match
+  mutable std::atomic<uint64_t> version_{1};
+  mutable paddle::flat_hash_map<std::string, std::vector<DeferredKernelDesc>>
+      deferred_kernels_;
 
   // Get the low precision kernel list of current module.
   std::map<const std::string, OpCount> low_precision_kernels_;
@@ -136,6 +136,20 @@ struct KernelRegistrar {
                        KernelArgsDefFn args_def_fn,
                        KernelFn kernel_fn,
                        void* variadic_kernel_fn) {
+    if (reg_type == RegType::INNER &&
+        KernelFactory::DeferKernelRegistration()) {
+      // record a lightweight descriptor only; the kernel is constructed
+      // on first lookup of its name (see KernelFactory)
+      KernelFactory::Instance().AddDeferredKernel({kernel_name_cstr,
+                                                   backend_cstr,
+                                                   layout,
+                                                   dtype,
+                                                   args_parse_fn,
+                                                   args_def_fn,
+                                                   kernel_fn,
+                                                   variadic_kernel_fn});
+      return;
+    }
     std::string kernel_name(kernel_name_cstr);
     KernelKey kernel_key(
         paddle::experimental::StringToBackend(backend_cstr), layout, dtype);
@@ -184,6 +198,40 @@ struct KernelRegistrar {
   template decltype(meta_kernel_fn<cpp_dtype, context>)                   \
       meta_kernel_fn<cpp_dtype, context>;
 
+/** Build-time kernel allowlist
+ *
+ * Deployments that only run a known op set can compile out all other kernel
+ * instantiations registered through PD_REGISTER_KERNEL. Build with
+ * -DPADDLE_WITH_KERNEL_ALLOWLIST and place a generated header at
+ * paddle/phi/core/kernel_allowlist.h containing one line per kept kernel:
+ *
+ *   #define PD_ALLOW_KERNEL_matmul_GPU 1
+ *
+ * tools/prune_kernel_allowlist.py emits this header from a scan of the
+ * inference models to be served. Kernels missing from the list keep their
+ * Touch symbol (so PD_DECLARE_KERNEL still links) but register nothing and
+ * instantiate no per-dtype kernel functions.
+ *
+ * The detection below is the standard preprocessor trick: a defined entry
+ * expands to 1, whose placeholder inserts an extra argument that shifts a 1
+ * into the selected position; an undefined entry leaves a junk token and
+ * selects 0.
+ */
+#ifdef PADDLE_WITH_KERNEL_ALLOWLIST
+#include "paddle/phi/core/kernel_allowlist.h"
+#define _PD_ALLOW_PLACEHOLDER_1 0,
+#define _PD_KERNEL_ALLOWED_PICK(__ignored, val, ...) val
+#define _PD_KERNEL_ALLOWED_SHIFT(arg1_or_junk) \
+  _PD_KERNEL_ALLOWED_PICK(arg1_or_junk 1, 0)
+#define _PD_KERNEL_ALLOWED_TEST(value) \
+  _PD_KERNEL_ALLOWED_SHIFT(_PD_ALLOW_PLACEHOLDER_##value)
+#define _PD_KERNEL_ALLOWED_EXPAND(entry) _PD_KERNEL_ALLOWED_TEST(entry)
+#define PD_KERNEL_ALLOWED(kernel_name, backend) \
+  _PD_KERNEL_ALLOWED_EXPAND(PD_ALLOW_KERNEL_##kernel_name##_##backend)
+#else
+#define PD_KERNEL_ALLOWED(kernel_name, backend) 1
+#endif
+
 /** PD_REGISTER_KERNEL
  *
  * The most frequently used kernel registration macro, used for kernel
@@ -194,6 +242,20 @@ struct KernelRegistrar {
  * Note: `2TA` means `2 template argument`
  */
 #define PD_REGISTER_KERNEL(kernel_name, backend, layout, meta_kernel_fn, ...) \
+  _PD_REGISTER_KERNEL_DISPATCH(PD_KERNEL_ALLOWED(kernel_name, backend),       \
+                               kernel_name,                                   \
+                               backend,                                       \
+                               layout,                                        \
+                               meta_kernel_fn,                                \
+                               __VA_ARGS__)
+
+#define _PD_REGISTER_KERNEL_DISPATCH(allowed, ...) \
+  _PD_REGISTER_KERNEL_DISPATCH_(allowed, __VA_ARGS__)
+#define _PD_REGISTER_KERNEL_DISPATCH_(allowed, ...) \
+  PD_EXPAND(_PD_REGISTER_KERNEL_ALLOWED_##allowed(__VA_ARGS__))
+
+#define _PD_REGISTER_KERNEL_ALLOWED_1(                                        \
+    kernel_name, backend, layout, meta_kernel_fn, ...)                        \
   _PD_REGISTER_KERNEL(::phi::RegType::INNER,                                  \
                       kernel_name,                                            \
                       backend,                                                \
@@ -206,6 +268,22 @@ struct KernelRegistrar {
                       PHI_VARIADIC_KERNEL,                                    \
                       __VA_ARGS__)
 
+// Compiled-out registration: keeps the Touch symbol for PD_DECLARE_KERNEL
+// and swallows the trailing args-def body, but creates no registrar and
+// instantiates no kernel functions.
+#define _PD_REGISTER_KERNEL_ALLOWED_0(                                        \
+    kernel_name, backend, layout, meta_kernel_fn, ...)                        \
+  PD_STATIC_ASSERT_GLOBAL_NAMESPACE(                                          \
+      PD_REGISTER_tp_kernel_ns_check_##kernel_name##_##backend##_##layout,    \
+      "PD_REGISTER_KERNEL must be called in global namespace.");              \
+  TEST_API int TouchKernelSymbolFor_##kernel_name##_##backend##_##layout() {  \
+    return 0;                                                                 \
+  }                                                                           \
+  UNUSED static void                                                          \
+      __PD_KERNEL_args_def_FN_##kernel_name##_##backend##_##layout(           \
+          const ::phi::KernelKey& kernel_key UNUSED,                          \
+          ::phi::Kernel* kernel UNUSED)
+
 #define _PD_REGISTER_KERNEL(reg_type,                                      \
                             kernel_name,                                   \
                             backend,                                       \
@@ -60,6 +60,18 @@ class SelectedRows : public TensorBase,
   std::vector<int64_t>* mutable_rows() { return impl_->mutable_rows(); }
 
   void set_rows(const std::vector<int64_t>& rows) { impl_->set_rows(rows); }
+
+  /*
+   * @brief Device-resident view of rows, re-uploaded on the place's stream
+   * only when the host side changed since the last upload.
+   */
+  const int64_t* DeviceRows(const Place& place) const {
+    return impl_->DeviceRows(place);
+  }
+
+  int64_t* MutableDeviceRows(const Place& place) {
+    return impl_->MutableDeviceRows(place);
+  }
   /*
    * @brief Get the index of key in rows
    *
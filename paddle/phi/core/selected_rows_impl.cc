@@ -21,6 +21,65 @@ limitations under the License. */
 
 namespace phi {
 
+bool RowIdMap::InsertInto(Table* table, int64_t key, int64_t value) {
+  size_t mask = table->slots.size() - 1;
+  for (size_t i = HashKey(key) & mask;; i = (i + 1) & mask) {
+    int64_t slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+    if (slot_key == key) {
+      table->slots[i].value.store(value, std::memory_order_relaxed);
+      return false;
+    }
+    if (slot_key == kEmptySlot) {
+      // Publish the value before the key so that a lock-free reader which
+      // observes the key also observes the value.
+      table->slots[i].value.store(value, std::memory_order_relaxed);
+      table->slots[i].key.store(key, std::memory_order_release);
+      return true;
+    }
+  }
+}
+
+void RowIdMap::Insert(int64_t key, int64_t value) {
+  auto table = std::atomic_load(&table_);
+  // Grow at a 50% load factor. Slots never free up, so rehashing copies the
+  // live entries into a larger table and publishes the replacement; in-flight
+  // readers keep probing their snapshot until they drop it.
+  if (!table || (size_ + 1) * 2 > table->slots.size()) {
+    size_t capacity = table ? table->slots.size() * 2 : kInitialCapacity;
+    auto grown = std::make_shared<Table>(capacity);
+    if (table) {
+      for (auto& slot : table->slots) {
+        int64_t slot_key = slot.key.load(std::memory_order_relaxed);
+        if (slot_key != kEmptySlot) {
+          InsertInto(grown.get(),
+                     slot_key,
+                     slot.value.load(std::memory_order_relaxed));
+        }
+      }
+    }
+    std::atomic_store(&table_, grown);
+    table = grown;
+  }
+  if (InsertInto(table.get(), key, value)) {
+    ++size_;
+  }
+}
+
+void RowIdMap::Rebuild(const std::vector<int64_t>& rows) {
+  size_t capacity = kInitialCapacity;
+  while (rows.size() * 2 > capacity) {
+    capacity *= 2;
+  }
+  auto table = std::make_shared<Table>(capacity);
+  size_ = 0;
+  for (size_t i = 0; i < rows.size(); ++i) {
+    if (InsertInto(table.get(), rows[i], static_cast<int64_t>(i))) {
+      ++size_;
+    }
+  }
+  std::atomic_store(&table_, table);
+}
+
 struct ReAllocateVisitor {
   ReAllocateVisitor(const phi::DDim& dims, phi::DenseTensor* tensor)
       : dims_(dims), tensor_(tensor) {}
@@ -100,74 +159,57 @@ void* SelectedRowsImpl::AllocateFrom(Allocator* allocator,
 }
 
 bool SelectedRowsImpl::HasKey(int64_t key) const {
-  return std::find(rows_.begin(), rows_.end(), key) == rows_.end() ? false
-                                                                   : true;
+  const auto& rows = rows_.HostVector();
+  return std::find(rows.begin(), rows.end(), key) == rows.end() ? false : true;
 }
 
 int64_t SelectedRowsImpl::AutoGrownIndex(int64_t key,
                                          bool auto_grown,
                                          bool is_test) {
-  if (is_test) {
-    auto iter = id_to_index_.find(key);
-    if (iter == id_to_index_.end()) {
-      return -1;
-    } else {
-      return iter->second;
-    }
+  // The table tolerates probing concurrently with a writer, so the common
+  // hit path no longer takes the shared lock at all.
+  int64_t index = id_to_index_.Find(key);
+  if (index >= 0 || is_test) {
+    return index;
   }
 
-  rwlock_->RDLock();
-  auto iter = id_to_index_.find(key);
-  if (iter == id_to_index_.end()) {
+  PADDLE_ENFORCE_EQ(
+      auto_grown,
+      true,
+      phi::errors::NotFound("Input key(%lld) is not found.", key));
+  rwlock_->WRLock();
+  auto map_size = id_to_index_.size();
+  auto vector_size = rows_.size();
+  if (map_size != vector_size) {
     rwlock_->UNLock();
-    PADDLE_ENFORCE_EQ(
-        auto_grown,
-        true,
-        phi::errors::NotFound("Input key(%lld) is not found.", key));
-    rwlock_->WRLock();
-    auto map_size = id_to_index_.size();
-    auto vector_size = rows_.size();
-    if (map_size != vector_size) {
+    PADDLE_THROW(phi::errors::InvalidArgument(
+        "Row map size(%zu) should be equal to rows size(%zu).",
+        map_size,
+        vector_size));
+  }
+  // Re-check under the lock: another writer may have grown the key first.
+  index = id_to_index_.Find(key);
+  if (index < 0) {
+    int row_num = static_cast<int>(rows_.size());
+    if (row_num == value_->dims()[0]) {
       rwlock_->UNLock();
       PADDLE_THROW(phi::errors::InvalidArgument(
-          "Row map size(%zu) should be equal to rows size(%zu).",
-          map_size,
-          vector_size));
-    }
-    auto write_iter = id_to_index_.find(key);
-    if (write_iter == id_to_index_.end()) {
-      int row_num = static_cast<int>(rows_.size());
-      if (row_num == value_->dims()[0]) {
-        rwlock_->UNLock();
-        PADDLE_THROW(phi::errors::InvalidArgument(
-            "Selected rows is full, then length exceed the length of first "
-            "dimension (%d).",
-            row_num));
-      }
-      // key logic to put a key into id_to_index_
-      rows_.push_back(key);
-      auto index = static_cast<int64_t>(rows_.size() - 1);
-      id_to_index_[key] = index;
-      rwlock_->UNLock();
-      return index;
-    } else {
-      auto index = write_iter->second;
-      rwlock_->UNLock();
-      return index;
+          "Selected rows is full, then length exceed the length of first "
+          "dimension (%d).",
+          row_num));
     }
-  } else {
-    auto index = iter->second;
-    rwlock_->UNLock();
-    return index;
+    // key logic to put a key into id_to_index_
+    rows_.MutableHostVector()->push_back(key);
+    index = static_cast<int64_t>(rows_.size() - 1);
+    id_to_index_.Insert(key, index);
   }
+  rwlock_->UNLock();
+  return index;
 }
 
 void SelectedRowsImpl::SyncIndex() {
   rwlock_->WRLock();
-  id_to_index_.clear();
-  for (int i = 0; i < static_cast<int>(rows_.size()); ++i) {
-    id_to_index_[rows_[i]] = i;
-  }
+  id_to_index_.Rebuild(rows_.HostVector());
   rwlock_->UNLock();
 }
 
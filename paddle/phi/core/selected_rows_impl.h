@@ -15,19 +15,108 @@ limitations under the License. */
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>  // NOLINT
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "paddle/common/ddim.h"
 #include "paddle/phi/common/place.h"
 #include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/dual_buffer_vector.h"
 #include "paddle/phi/core/enforce.h"
 #include "paddle/phi/core/utils/rw_lock.h"
 
 namespace phi {
+
+/*
+ * @brief Open addressing id->index table backing AutoGrownIndex() and
+ * GetIndexFromId() of SelectedRowsImpl.
+ *
+ * Slots are insert-only: a slot's key transitions from kEmptySlot to a valid
+ * id exactly once and entries are never displaced afterwards, so readers can
+ * probe the table without holding any lock. Mutations (Insert and the
+ * copy-on-grow rehash) must still be serialized by the caller; on growth the
+ * table is swapped out atomically, so in-flight readers keep a valid snapshot.
+ */
+class RowIdMap {
+ public:
+  /*
+   * @brief Look up the index stored for the key.
+   *
+   * @return -1 if the key does not exist. Safe to call concurrently with a
+   * single writer.
+   */
+  int64_t Find(int64_t key) const {
+    auto table = std::atomic_load(&table_);
+    if (!table || key == kEmptySlot) {
+      return -1;
+    }
+    size_t mask = table->slots.size() - 1;
+    for (size_t i = HashKey(key) & mask;; i = (i + 1) & mask) {
+      int64_t slot_key = table->slots[i].key.load(std::memory_order_acquire);
+      if (slot_key == key) {
+        return table->slots[i].value.load(std::memory_order_relaxed);
+      }
+      if (slot_key == kEmptySlot) {
+        return -1;
+      }
+    }
+  }
+
+  /*
+   * @brief Insert or overwrite a key-value pair. Callers must hold the write
+   * lock of the owning structure.
+   */
+  void Insert(int64_t key, int64_t value);
+
+  /*
+   * @brief Rebuild the table so that every row id maps to its position (the
+   * last one for duplicates). Callers must hold the write lock of the owning
+   * structure.
+   */
+  void Rebuild(const std::vector<int64_t>& rows);
+
+  // The number of distinct keys in the table.
+  size_t size() const { return size_; }
+
+ private:
+  struct Slot {
+    std::atomic<int64_t> key{kEmptySlot};
+    std::atomic<int64_t> value{0};
+  };
+
+  struct Table {
+    explicit Table(size_t capacity) : slots(capacity) {}
+    std::vector<Slot> slots;
+  };
+
+  // Row ids are non-negative, so INT64_MIN never collides with a real key.
+  static constexpr int64_t kEmptySlot = std::numeric_limits<int64_t>::min();
+  static constexpr size_t kInitialCapacity = 16;
+
+  static size_t HashKey(int64_t key) {
+    // splitmix64 finalizer. Common id patterns such as strided embedding ids
+    // would cluster badly under an identity hash with a power-of-two mask.
+    uint64_t x = static_cast<uint64_t>(key);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x);
+  }
+
+  // Returns true if the key claimed a fresh slot of the table.
+  static bool InsertInto(Table* table, int64_t key, int64_t value);
+
+  std::shared_ptr<Table> table_{nullptr};
+  size_t size_{0};
+};
+
 class SelectedRowsImpl {
   /*
    * @brief We can use the SelectedRowsImpl structure to reproduce a sparse
@@ -66,11 +155,25 @@ class SelectedRowsImpl {
 
   void set_height(int64_t height) { height_ = height; }
 
-  const std::vector<int64_t>& rows() const { return rows_; }
+  const std::vector<int64_t>& rows() const { return rows_.HostVector(); }
+
+  std::vector<int64_t>* mutable_rows() { return rows_.MutableHostVector(); }
 
-  std::vector<int64_t>* mutable_rows() { return &rows_; }
+  void set_rows(const std::vector<int64_t>& rows) {
+    *rows_.MutableHostVector() = rows;
+  }
+
+  /*
+   * @brief Device-resident view of rows, re-uploaded on the place's stream
+   * only when the host side changed since the last upload.
+   */
+  const int64_t* DeviceRows(const Place& place) const {
+    return rows_.DeviceData(place);
+  }
 
-  void set_rows(const std::vector<int64_t>& rows) { rows_ = rows; }
+  int64_t* MutableDeviceRows(const Place& place) {
+    return rows_.MutableDeviceData(place);
+  }
 
   /*
    * @brief Get the index of key in rows
@@ -78,12 +181,13 @@ class SelectedRowsImpl {
    * @return -1 if the key does not exists.
    */
   int64_t Index(int64_t key) const {
-    auto it = std::find(rows_.begin(), rows_.end(), key);
-    if (it == rows_.end()) {
+    const auto& rows = rows_.HostVector();
+    auto it = std::find(rows.begin(), rows.end(), key);
+    if (it == rows.end()) {
       PADDLE_THROW(phi::errors::NotFound(
           "Input id (%lld) is not in current rows table.", key));
     }
-    return static_cast<int64_t>(std::distance(rows_.begin(), it));
+    return static_cast<int64_t>(std::distance(rows.begin(), it));
   }
 
   /*
@@ -129,12 +233,7 @@ class SelectedRowsImpl {
    * @brief Get the index of the key from id_to_index_ map.
    */
   inline int64_t GetIndexFromId(int64_t key) const {
-    auto iter = id_to_index_.find(key);
-    if (iter == id_to_index_.end()) {
-      return -1;
-    } else {
-      return iter->second;
-    }
+    return id_to_index_.Find(key);
   }
 
   void SyncIndex();
@@ -187,9 +286,8 @@ class SelectedRowsImpl {
   // Notice: rows can be duplicate. We can have {0, 4, 7, 0, 5, 7, 9} here.
   // SelectedRowsImpl are simply concated when adding together. Until a
   // SelectedRowsImpl add a Tensor, will the duplicate rows be handled.
-  std::vector<int64_t> rows_;
-  std::unordered_map<int64_t, int64_t>
-      id_to_index_;  // should not be used when rows_ has duplicate member
+  DualBufferVector<int64_t> rows_;
+  RowIdMap id_to_index_;  // should not be used when rows_ has duplicate member
   std::unique_ptr<DenseTensor> value_{nullptr};
   int64_t height_;  // height indicates the underline tensor's height
   std::unique_ptr<RWLock> rwlock_{nullptr};
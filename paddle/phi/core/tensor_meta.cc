@@ -170,6 +170,21 @@ DenseTensorMeta::DenseTensorMeta(const DenseTensorMeta& other) {
   }
 }
 
+DenseTensorMeta::DenseTensorMeta(DenseTensorMeta&& other) {
+  is_scalar = other.is_scalar;
+  use_gpudnn = other.use_gpudnn;
+  dims = other.dims;
+  dtype = other.dtype;
+  layout = other.layout;
+  lod = std::move(other.lod);
+  offset = other.offset;
+  if (other.strides.size() == -1) {
+    strides = calc_strides(dims);
+  } else {
+    strides = other.strides;
+  }
+}
+
 DenseTensorMeta& DenseTensorMeta::operator=(const DenseTensorMeta& other) {
   is_scalar = other.is_scalar;
   use_gpudnn = other.use_gpudnn;
@@ -212,7 +227,27 @@ bool DenseTensorMeta::valid() const noexcept {
 }
 
 bool DenseTensorMeta::is_contiguous() const {
-  bool is_contiguous = (strides == calc_strides(dims));
+  // Compare against the contiguous layout in place instead of materializing
+  // calc_strides(dims) on every query; this runs once per kernel dispatch
+  // when FLAGS_use_stride_kernel is on.
+  bool is_contiguous = true;
+  if (strides.size() != dims.size()) {
+    is_contiguous = false;
+  } else if (dims.size() > 0) {
+    if (product(dims) <= 0) {
+      // calc_strides() keeps dims as-is for empty or unknown shapes.
+      is_contiguous = (strides == dims);
+    } else {
+      int64_t expected = 1;
+      for (int i = dims.size() - 1; i >= 0; --i) {
+        if (strides[i] != expected) {
+          is_contiguous = false;
+          break;
+        }
+        expected *= dims[i];
+      }
+    }
+  }
   if (!is_contiguous && !FLAGS_use_stride_kernel) {
     PADDLE_THROW(
         phi::errors::Fatal("FLAGS_use_stride_kernel is closed. Not contiguous "
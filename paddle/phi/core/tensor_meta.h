@@ -61,6 +61,10 @@ struct TEST_API DenseTensorMeta {
                   size_t offset = 0);
 
   DenseTensorMeta(const DenseTensorMeta& other);
+  // Without a move constructor, moving a DenseTensor degrades to copying the
+  // meta (including its LoD heap storage), which shows up in the eager-mode
+  // hot loop that creates and moves millions of small temporaries.
+  DenseTensorMeta(DenseTensorMeta&& other);
 
   DenseTensorMeta& operator=(const DenseTensorMeta& other);
   DenseTensorMeta& operator=(DenseTensorMeta&& other);
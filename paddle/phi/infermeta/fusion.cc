@@ -1195,6 +1195,65 @@ void FusedAttentionGradInferMeta(const MetaTensor& out_grad,
   }
 }
 
+void FusedBiasDropoutResidualInferMeta(
+    const MetaTensor& x,
+    const MetaTensor& residual,
+    const MetaTensor& bias,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    MetaTensor* y,
+    MetaTensor* dropout_mask_out) {
+  PADDLE_ENFORCE_EQ(dropout_rate >= 0.0f && dropout_rate <= 1.0f,
+                    true,
+                    phi::errors::InvalidArgument(
+                        "'dropout_rate' must be between 0.0 and 1.0."));
+  PADDLE_ENFORCE_EQ(
+      dropout_implementation == "downgrade_in_infer" ||
+          dropout_implementation == "upscale_in_train",
+      true,
+      phi::errors::InvalidArgument(
+          "dropout_implementation can only be downgrade_in_infer or "
+          "upscale_in_train"));
+  if (is_test == false) {
+    dropout_mask_out->set_dims(x.dims());
+  }
+  y->set_dims(x.dims());
+  y->set_dtype(x.dtype());
+}
+
+void FusedBiasDropoutResidualGradInferMeta(
+    const MetaTensor& bias,
+    const MetaTensor& dropout_mask_out,
+    const MetaTensor& y_grad,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    MetaTensor* x_grad,
+    MetaTensor* residual_grad,
+    MetaTensor* bias_grad) {
+  PADDLE_ENFORCE_EQ(is_test,
+                    false,
+                    phi::errors::InvalidArgument(
+                        "GradOp is only callable when is_test is false"));
+  if (x_grad) {
+    x_grad->set_dims(y_grad.dims());
+    x_grad->set_dtype(y_grad.dtype());
+  }
+  if (residual_grad) {
+    residual_grad->set_dims(y_grad.dims());
+    residual_grad->set_dtype(y_grad.dtype());
+  }
+  if (bias_grad) {
+    bias_grad->set_dims(bias.dims());
+    bias_grad->set_dtype(y_grad.dtype());
+  }
+}
+
 void FusedBiasDropoutResidualLnInferMeta(
     const MetaTensor& x,
     const MetaTensor& residual,
@@ -1946,6 +2005,129 @@ void FusedGemmEpilogueGradInferMeta(const MetaTensor& x,
   }
 }
 
+void FusedMoeDispatchInferMeta(const MetaTensor& x,
+                               const MetaTensor& gate_logits,
+                               const int k,
+                               const int64_t capacity,
+                               MetaTensor* dispatched_x,
+                               MetaTensor* combine_weights,
+                               MetaTensor* scatter_index,
+                               MetaTensor* expert_id,
+                               MetaTensor* expert_count) {
+  auto x_dims = x.dims();
+  auto gate_dims = gate_logits.dims();
+  PADDLE_ENFORCE_EQ(
+      x_dims.size(),
+      2,
+      phi::errors::InvalidArgument(
+          "The input x of fused_moe_dispatch must be a 2-D tensor of "
+          "[num_tokens, hidden_size], but got a %d-D tensor.",
+          x_dims.size()));
+  PADDLE_ENFORCE_EQ(
+      gate_dims.size(),
+      2,
+      phi::errors::InvalidArgument(
+          "The gate_logits of fused_moe_dispatch must be a 2-D tensor of "
+          "[num_tokens, num_experts], but got a %d-D tensor.",
+          gate_dims.size()));
+  PADDLE_ENFORCE_EQ(x_dims[0],
+                    gate_dims[0],
+                    phi::errors::InvalidArgument(
+                        "x and gate_logits of fused_moe_dispatch must agree "
+                        "on num_tokens, but got %d and %d.",
+                        x_dims[0],
+                        gate_dims[0]));
+  const int64_t num_tokens = x_dims[0];
+  const int64_t hidden_size = x_dims[1];
+  const int64_t num_experts = gate_dims[1];
+  PADDLE_ENFORCE_EQ(k > 0 && k <= num_experts,
+                    true,
+                    phi::errors::InvalidArgument(
+                        "k of fused_moe_dispatch must be in (0, num_experts "
+                        "= %d], but got %d.",
+                        num_experts,
+                        k));
+  PADDLE_ENFORCE_GT(capacity,
+                    0,
+                    phi::errors::InvalidArgument(
+                        "capacity of fused_moe_dispatch must be positive, "
+                        "but got %d.",
+                        capacity));
+  dispatched_x->set_dims({num_experts * capacity, hidden_size});
+  dispatched_x->set_dtype(x.dtype());
+  combine_weights->set_dims({num_tokens, k});
+  combine_weights->set_dtype(DataType::FLOAT32);
+  scatter_index->set_dims({num_tokens, k});
+  scatter_index->set_dtype(DataType::INT32);
+  expert_id->set_dims({num_tokens, k});
+  expert_id->set_dtype(DataType::INT32);
+  expert_count->set_dims({num_experts});
+  expert_count->set_dtype(DataType::INT64);
+}
+
+void FusedMoeDispatchGradInferMeta(const MetaTensor& gate_logits,
+                                   const MetaTensor& combine_weights,
+                                   const MetaTensor& scatter_index,
+                                   const MetaTensor& expert_id,
+                                   const MetaTensor& dispatched_x_grad,
+                                   const MetaTensor& combine_weights_grad,
+                                   const int k,
+                                   const int64_t capacity,
+                                   MetaTensor* x_grad,
+                                   MetaTensor* gate_logits_grad) {
+  const int64_t num_tokens = gate_logits.dims()[0];
+  const int64_t hidden_size = dispatched_x_grad.dims()[1];
+  if (x_grad) {
+    x_grad->set_dims({num_tokens, hidden_size});
+    x_grad->set_dtype(dispatched_x_grad.dtype());
+  }
+  if (gate_logits_grad) {
+    gate_logits_grad->set_dims(gate_logits.dims());
+    gate_logits_grad->set_dtype(gate_logits.dtype());
+  }
+}
+
+void FusedMoeCombineInferMeta(const MetaTensor& expert_out,
+                              const MetaTensor& combine_weights,
+                              const MetaTensor& scatter_index,
+                              MetaTensor* y) {
+  auto expert_out_dims = expert_out.dims();
+  auto weights_dims = combine_weights.dims();
+  PADDLE_ENFORCE_EQ(
+      expert_out_dims.size(),
+      2,
+      phi::errors::InvalidArgument(
+          "The expert_out of fused_moe_combine must be a 2-D tensor of "
+          "[num_experts * capacity, hidden_size], but got a %d-D tensor.",
+          expert_out_dims.size()));
+  PADDLE_ENFORCE_EQ(
+      weights_dims,
+      scatter_index.dims(),
+      phi::errors::InvalidArgument(
+          "combine_weights and scatter_index of fused_moe_combine must "
+          "have the same shape, but got %s and %s.",
+          weights_dims,
+          scatter_index.dims()));
+  y->set_dims({weights_dims[0], expert_out_dims[1]});
+  y->set_dtype(expert_out.dtype());
+}
+
+void FusedMoeCombineGradInferMeta(const MetaTensor& expert_out,
+                                  const MetaTensor& combine_weights,
+                                  const MetaTensor& scatter_index,
+                                  const MetaTensor& y_grad,
+                                  MetaTensor* expert_out_grad,
+                                  MetaTensor* combine_weights_grad) {
+  if (expert_out_grad) {
+    expert_out_grad->set_dims(expert_out.dims());
+    expert_out_grad->set_dtype(expert_out.dtype());
+  }
+  if (combine_weights_grad) {
+    combine_weights_grad->set_dims(combine_weights.dims());
+    combine_weights_grad->set_dtype(combine_weights.dtype());
+  }
+}
+
 void FusedMultiTransformerXpuInferMeta(
     const MetaTensor& x,
     const std::vector<const MetaTensor*>& ln_scale,
@@ -529,6 +529,39 @@ void FusedGemmEpilogueGradInferMeta(const MetaTensor& x,
                                     MetaTensor* y_grad,
                                     MetaTensor* bias_grad);
 
+void FusedMoeDispatchInferMeta(const MetaTensor& x,
+                               const MetaTensor& gate_logits,
+                               const int k,
+                               const int64_t capacity,
+                               MetaTensor* dispatched_x,
+                               MetaTensor* combine_weights,
+                               MetaTensor* scatter_index,
+                               MetaTensor* expert_id,
+                               MetaTensor* expert_count);
+
+void FusedMoeDispatchGradInferMeta(const MetaTensor& gate_logits,
+                                   const MetaTensor& combine_weights,
+                                   const MetaTensor& scatter_index,
+                                   const MetaTensor& expert_id,
+                                   const MetaTensor& dispatched_x_grad,
+                                   const MetaTensor& combine_weights_grad,
+                                   const int k,
+                                   const int64_t capacity,
+                                   MetaTensor* x_grad,
+                                   MetaTensor* gate_logits_grad);
+
+void FusedMoeCombineInferMeta(const MetaTensor& expert_out,
+                              const MetaTensor& combine_weights,
+                              const MetaTensor& scatter_index,
+                              MetaTensor* y);
+
+void FusedMoeCombineGradInferMeta(const MetaTensor& expert_out,
+                                  const MetaTensor& combine_weights,
+                                  const MetaTensor& scatter_index,
+                                  const MetaTensor& y_grad,
+                                  MetaTensor* expert_out_grad,
+                                  MetaTensor* combine_weights_grad);
+
 void FusedMultiTransformerXpuInferMeta(
     const MetaTensor& x,
     const std::vector<const MetaTensor*>& ln_scale,
@@ -851,6 +884,31 @@ void FusionSeqExpandConcatFCInferMeta(const std::vector<const MetaTensor*>& x,
                                       MetaTensor* out,
                                       MetaTensor* fc_out);
 
+void FusedBiasDropoutResidualInferMeta(
+    const MetaTensor& x,
+    const MetaTensor& residual,
+    const MetaTensor& bias,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    MetaTensor* y,
+    MetaTensor* dropout_mask_out);
+
+void FusedBiasDropoutResidualGradInferMeta(
+    const MetaTensor& bias,
+    const MetaTensor& dropout_mask_out,
+    const MetaTensor& y_grad,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    MetaTensor* x_grad,
+    MetaTensor* residual_grad,
+    MetaTensor* bias_grad);
+
 void FusedBiasDropoutResidualLnInferMeta(
     const MetaTensor& x,
     const MetaTensor& residual,
@@ -14,12 +14,95 @@
 
 #include "paddle/phi/kernels/autotune/cache.h"
 
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
 
 #include "glog/logging.h"
+#include "paddle/phi/core/os_info.h"
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+#include "paddle/phi/backends/gpu/gpu_info.h"
+#endif
 
 namespace phi::autotune {
 
+namespace {
+
+constexpr uint32_t kSerializedMagic = 0x50444154;  // "PDAT"
+// Bump whenever the on-disk layout or the meaning of a cached algorithm id
+// changes; stale files fail the version check and are ignored.
+constexpr uint32_t kSerializedVersion = 1;
+constexpr uint64_t kMaxSerializedEntries = 1 << 22;
+
+template <typename T>
+void WritePod(std::ostream* os, const T& value) {
+  os->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::istream* is, T* value) {
+  is->read(reinterpret_cast<char*>(value), sizeof(T));
+  return is->good();
+}
+
+void WriteString(std::ostream* os, const std::string& value) {
+  WritePod(os, static_cast<uint64_t>(value.size()));
+  os->write(value.data(), value.size());
+}
+
+bool ReadString(std::istream* is, std::string* value) {
+  uint64_t size = 0;
+  if (!ReadPod(is, &size) || size > kMaxSerializedEntries) {
+    return false;
+  }
+  value->resize(size);
+  is->read(value->empty() ? nullptr : &(*value)[0], size);
+  return is->good();
+}
+
+template <typename T>
+void WriteVector(std::ostream* os, const std::vector<T>& value) {
+  WritePod(os, static_cast<uint64_t>(value.size()));
+  os->write(reinterpret_cast<const char*>(value.data()),
+            sizeof(T) * value.size());
+}
+
+template <typename T>
+bool ReadVector(std::istream* is, std::vector<T>* value) {
+  uint64_t size = 0;
+  if (!ReadPod(is, &size) || size > kMaxSerializedEntries) {
+    return false;
+  }
+  value->resize(size);
+  is->read(reinterpret_cast<char*>(value->data()), sizeof(T) * size);
+  return is->good();
+}
+
+// Identifies what the cached choices were tuned on; algorithm ids are only
+// meaningful for the same GPU model and the same cudnn release.
+std::string DeviceTag() {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+  int device_id = phi::backends::gpu::GetCurrentDeviceId();
+  const auto& prop = phi::backends::gpu::GetDeviceProperties(device_id);
+  std::string tag = std::string(prop.name) + "_cc" +
+                    std::to_string(prop.major) + std::to_string(prop.minor) +
+                    "_dnn" + std::to_string(phi::backends::gpu::DnnVersion());
+#else
+  std::string tag = "cpu";
+#endif
+  for (auto& c : tag) {
+    if (!std::isalnum(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  return tag;
+}
+
+}  // namespace
+
 size_t TransposeKey(const std::vector<int64_t>& x_dims,
                     const std::vector<int32_t>& perm,
                     phi::DataType dtype) {
@@ -115,4 +198,216 @@ void AutoTuneCache::UpdateStatus() {
   total_cache_misses_ = cache_misses;
 }
 
+bool AutoTuneCache::SaveToDisk(const std::string& path) {
+  // Write to a process-unique temporary and rename, so sibling processes
+  // reading the shared file never observe a half-written snapshot.
+  std::string tmp_path =
+      path + ".tmp." + std::to_string(phi::GetProcessId());
+  std::ofstream os(tmp_path, std::ios::binary | std::ios::trunc);
+  if (!os) {
+    VLOG(3) << "Cannot open autotune cache file for writing: " << tmp_path;
+    return false;
+  }
+  WritePod(&os, kSerializedMagic);
+  WritePod(&os, kSerializedVersion);
+  WriteString(&os, CachedDeviceTag());
+
+  WritePod(&os, static_cast<uint64_t>(auto_tune_map_.size()));
+  for (auto& v : auto_tune_map_) {
+    WritePod(&os, v.first);
+    auto entries = v.second.DumpEntries();
+    WritePod(&os, static_cast<uint64_t>(entries.size()));
+    for (const auto& kv : entries) {
+      WritePod(&os, kv.first);
+      WritePod(&os, kv.second);
+    }
+  }
+
+  WritePod(&os, static_cast<uint64_t>(conv_auto_tune_map_.size()));
+  for (auto& v : conv_auto_tune_map_) {
+    WritePod(&os, v.first);
+    auto entries = v.second.DumpEntries();
+    WritePod(&os, static_cast<uint64_t>(entries.size()));
+    for (const auto& kv : entries) {
+      const ConvCacheKey& key = kv.first;
+      WriteVector(&os, key.x_dims);
+      WriteVector(&os, key.w_dims);
+      WriteVector(&os, key.strides);
+      WriteVector(&os, key.paddings);
+      WriteVector(&os, key.dilations);
+      WritePod(&os, static_cast<int64_t>(key.dtype));
+      WritePod(&os, key.groups);
+      WritePod(&os, key.data_layout);
+      WritePod(&os, kv.second.algo);
+      WritePod(&os, static_cast<uint64_t>(kv.second.workspace_size));
+      WritePod(&os, static_cast<uint8_t>(kv.second.exhaustive_search));
+    }
+  }
+
+  {
+    auto entries = matmul_auto_tune_map_.DumpEntries();
+    WritePod(&os, static_cast<uint64_t>(entries.size()));
+    for (const auto& kv : entries) {
+      WritePod(&os, kv.first);
+      WritePod(&os, kv.second);
+    }
+  }
+
+  os.close();
+  if (!os.good() || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    VLOG(3) << "Cannot publish autotune cache file at " << path;
+    return false;
+  }
+  VLOG(3) << "Saved autotune cache (" << PersistedSize() << " entries) to "
+          << path;
+  return true;
+}
+
+bool AutoTuneCache::LoadFromDisk(const std::string& path) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is) {
+    VLOG(3) << "No autotune cache file to load at " << path;
+    return false;
+  }
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  std::string device_tag;
+  if (!ReadPod(&is, &magic) || magic != kSerializedMagic ||
+      !ReadPod(&is, &version) || version != kSerializedVersion ||
+      !ReadString(&is, &device_tag) || device_tag != CachedDeviceTag()) {
+    VLOG(3) << "Autotune cache file " << path
+            << " is stale or was tuned on another device, ignoring it.";
+    return false;
+  }
+
+  uint64_t num_caches = 0;
+  if (!ReadPod(&is, &num_caches) || num_caches > kMaxSerializedEntries) {
+    return false;
+  }
+  for (uint64_t i = 0; i < num_caches; ++i) {
+    int64_t algo_type = 0;
+    uint64_t num_entries = 0;
+    if (!ReadPod(&is, &algo_type) || !ReadPod(&is, &num_entries) ||
+        num_entries > kMaxSerializedEntries) {
+      return false;
+    }
+    std::vector<std::pair<size_t, int64_t>> entries(num_entries);
+    for (auto& kv : entries) {
+      if (!ReadPod(&is, &kv.first) || !ReadPod(&is, &kv.second)) {
+        return false;
+      }
+    }
+    auto it = auto_tune_map_.find(algo_type);
+    if (it != auto_tune_map_.end()) {
+      it->second.LoadEntries(entries);
+    }
+  }
+
+  if (!ReadPod(&is, &num_caches) || num_caches > kMaxSerializedEntries) {
+    return false;
+  }
+  for (uint64_t i = 0; i < num_caches; ++i) {
+    int64_t algo_type = 0;
+    uint64_t num_entries = 0;
+    if (!ReadPod(&is, &algo_type) || !ReadPod(&is, &num_entries) ||
+        num_entries > kMaxSerializedEntries) {
+      return false;
+    }
+    std::vector<std::pair<ConvCacheKey, ConvAutoTuneResult>> entries;
+    entries.reserve(num_entries);
+    for (uint64_t j = 0; j < num_entries; ++j) {
+      ConvCacheKey key;
+      int64_t dtype = 0;
+      int64_t algo = 0;
+      uint64_t workspace_size = 0;
+      uint8_t exhaustive_search = 0;
+      if (!ReadVector(&is, &key.x_dims) || !ReadVector(&is, &key.w_dims) ||
+          !ReadVector(&is, &key.strides) || !ReadVector(&is, &key.paddings) ||
+          !ReadVector(&is, &key.dilations) || !ReadPod(&is, &dtype) ||
+          !ReadPod(&is, &key.groups) || !ReadPod(&is, &key.data_layout) ||
+          !ReadPod(&is, &algo) || !ReadPod(&is, &workspace_size) ||
+          !ReadPod(&is, &exhaustive_search)) {
+        return false;
+      }
+      key.dtype = static_cast<phi::DataType>(dtype);
+      entries.emplace_back(
+          key,
+          ConvAutoTuneResult(
+              algo, workspace_size, exhaustive_search != 0));
+    }
+    auto it = conv_auto_tune_map_.find(algo_type);
+    if (it != conv_auto_tune_map_.end()) {
+      it->second.LoadEntries(entries);
+    }
+  }
+
+  uint64_t num_matmul_entries = 0;
+  if (!ReadPod(&is, &num_matmul_entries) ||
+      num_matmul_entries > kMaxSerializedEntries) {
+    return false;
+  }
+  std::vector<std::pair<size_t, int64_t>> matmul_entries(num_matmul_entries);
+  for (auto& kv : matmul_entries) {
+    if (!ReadPod(&is, &kv.first) || !ReadPod(&is, &kv.second)) {
+      return false;
+    }
+  }
+  matmul_auto_tune_map_.LoadEntries(matmul_entries);
+
+  UpdateStatus();
+  VLOG(3) << "Loaded autotune cache (" << Size() << " entries) from " << path;
+  return true;
+}
+
+std::string AutoTuneCache::DefaultSerializedPath() {
+  const char* dir = std::getenv("PADDLE_AUTOTUNE_CACHE_DIR");
+  if (dir == nullptr || dir[0] == '\0') {
+    return "";
+  }
+  return std::string(dir) + "/autotune_" + DeviceTag() + ".bin";
+}
+
+void AutoTuneCache::InitPersistence() {
+  // DefaultSerializedPath() checks the environment variable before it
+  // touches the GPU runtime, so a plain run without
+  // $PADDLE_AUTOTUNE_CACHE_DIR never pays for a device query here.
+  serialized_path_ = DefaultSerializedPath();
+  if (serialized_path_.empty()) {
+    return;
+  }
+  LoadFromDisk(serialized_path_);
+  loaded_size_ = PersistedSize();
+}
+
+AutoTuneCache::~AutoTuneCache() {
+  if (serialized_path_.empty() || PersistedSize() <= loaded_size_) {
+    return;
+  }
+  // Several processes may share the file; re-merge it right before
+  // writing so choices tuned by siblings since our startup survive.
+  // LoadEntries keeps locally tuned values on key collisions.
+  LoadFromDisk(serialized_path_);
+  SaveToDisk(serialized_path_);
+}
+
+const std::string& AutoTuneCache::CachedDeviceTag() {
+  if (device_tag_.empty()) {
+    device_tag_ = DeviceTag();
+  }
+  return device_tag_;
+}
+
+int64_t AutoTuneCache::PersistedSize() {
+  int64_t size = 0;
+  for (auto& v : auto_tune_map_) {
+    size += v.second.Size();
+  }
+  for (auto& v : conv_auto_tune_map_) {
+    size += v.second.Size();
+  }
+  size += matmul_auto_tune_map_.Size();
+  return size;
+}
+
 }  // namespace phi::autotune
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <string>
 
 #include "paddle/phi/common/data_type.h"
 #include "paddle/phi/kernels/autotune/cache_base.h"
@@ -151,6 +152,21 @@ class AutoTuneCache {
 
   void UpdateStatus();
 
+  // On-disk persistence of tuned algorithm choices, so short-lived
+  // processes skip the exhaustive search. Files carry a format version and
+  // a device tag (GPU model + compute capability + cudnn release); a
+  // mismatch on load silently invalidates the file. The cudnn-frontend
+  // plan caches hold handle-bound execution plans and are rebuilt from
+  // scratch instead of being persisted; only the algorithm-id style caches
+  // go to disk. Saves write to a process-unique temporary and rename, so
+  // sibling processes sharing the file never read a torn snapshot.
+  bool SaveToDisk(const std::string& path);
+  bool LoadFromDisk(const std::string& path);
+
+  // Per-GPU-model file below $PADDLE_AUTOTUNE_CACHE_DIR, or an empty
+  // string (persistence disabled) when the variable is unset.
+  static std::string DefaultSerializedPath();
+
   // The number of total config cached
   int64_t Size() const { return total_size_; }
 
@@ -173,8 +189,25 @@ class AutoTuneCache {
     for (int i = 1; i < static_cast<int>(AlgorithmType::kAlgorithmCount); ++i) {
       Register(static_cast<AlgorithmType>(i));
     }
+    InitPersistence();
   }
 
+  // At exit, merges the shared file once more before writing, so results
+  // tuned concurrently by sibling processes are unioned instead of
+  // overwritten.
+  ~AutoTuneCache();
+
+  // Seeds the cache from DefaultSerializedPath() when persistence is
+  // enabled, and remembers the path and device tag so the exit-time save
+  // never has to query the (possibly torn down) GPU runtime.
+  void InitPersistence();
+
+  const std::string& CachedDeviceTag();
+
+  // Entry count of the caches that go to disk, independent of the
+  // VLOG-driven UpdateStatus() bookkeeping.
+  int64_t PersistedSize();
+
   void Register(const AlgorithmType& algo_type) {
     std::lock_guard<std::mutex> lock(*autotune_cache_mutex_);
     if (algo_type == AlgorithmType::kConvForward ||
@@ -213,6 +246,9 @@ class AutoTuneCache {
   int64_t total_cache_hits_{0};
   int64_t total_cache_misses_{0};
   int64_t total_size_{0};
+  std::string serialized_path_;
+  std::string device_tag_;
+  int64_t loaded_size_{0};
 };
 
 }  // namespace autotune
@@ -153,6 +153,20 @@ class AlgorithmsCache {
 
   int64_t Size() const { return hash_.size(); }
 
+  // Snapshot and bulk-restore hooks for AutoTuneCache's disk persistence.
+  std::vector<std::pair<KeyT, AlgorithmT>> DumpEntries() {
+    std::lock_guard<std::mutex> lock(*cache_mutex_);
+    return {hash_.begin(), hash_.end()};
+  }
+
+  void LoadEntries(const std::vector<std::pair<KeyT, AlgorithmT>>& entries) {
+    std::lock_guard<std::mutex> lock(*cache_mutex_);
+    for (const auto& kv : entries) {
+      // emplace so results tuned in this process are never clobbered
+      hash_.emplace(kv.first, kv.second);
+    }
+  }
+
  protected:
   std::unordered_map<KeyT, AlgorithmT, HashT, KeyEqualT> hash_;
   std::shared_ptr<std::mutex> cache_mutex_;
@@ -16,6 +16,7 @@
 
 #include "paddle/phi/backends/cpu/cpu_context.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/funcs/cpu_radix_sort.h"
 #include "paddle/phi/kernels/funcs/eigen/common.h"
 #include "paddle/phi/kernels/funcs/eigen/eigen_function.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
@@ -32,6 +33,28 @@ static void FullSort(Type input_height,
                      Type* t_indices,
                      bool descending,
                      bool stable) {
+  // Wide unstable rows take the radix path: an LSD radix argsort costs
+  // O(sizeof(key) * n) per row instead of O(n log n) comparator calls, and
+  // rows stay distributed across threads. The stable path keeps
+  // std::stable_sort since the radix key orders -0.0 before +0.0 while the
+  // comparator treats them as equal.
+  if constexpr (funcs::RadixSortTraits<T>::kSupported) {
+    constexpr Type kMinRadixSortWidth = 256;
+    if (!stable && input_width >= kMinRadixSortWidth) {
+      const T* in_data = input->data<T>();
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for
+#endif
+      for (Type i = 0; i < input_height; ++i) {
+        funcs::RadixArgsort<T, Type>(in_data + i * input_width,
+                                     t_out + i * input_width,
+                                     t_indices + i * input_width,
+                                     input_width,
+                                     descending);
+      }
+      return;
+    }
+  }
 #ifdef PADDLE_WITH_MKLML
 #pragma omp parallel for
 #endif
@@ -117,7 +117,12 @@ void AttentionLSTMKernel(
   auto& act_gate_str = gate_activation;
   auto& act_cell_str = cell_activation;
   auto& act_cand_str = candidate_activation;
-  if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
+  if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx512f)) {
+    phi::funcs::VecActivations<T, phi::backends::cpu::avx512f> act_functor;
+    act_gate = act_functor(act_gate_str);
+    act_cell = act_functor(act_cell_str);
+    act_cand = act_functor(act_cand_str);
+  } else if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
     phi::funcs::VecActivations<T, phi::backends::cpu::avx> act_functor;
     act_gate = act_functor(act_gate_str);
     act_cell = act_functor(act_cell_str);
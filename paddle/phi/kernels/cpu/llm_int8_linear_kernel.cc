@@ -0,0 +1,178 @@
+// Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/kernels/llm_int8_linear_kernel.h"
+
+#include <cmath>
+#include <vector>
+
+#ifdef __AVX512VNNI__
+#include <immintrin.h>
+#endif
+
+#include "paddle/phi/backends/cpu/cpu_context.h"
+#include "paddle/phi/backends/cpu/cpu_info.h"
+#include "paddle/phi/core/kernel_registry.h"
+
+namespace phi {
+
+namespace {
+
+// Activations are stored shifted by +128 as u8 so the same buffer feeds
+// both the VNNI u8*s8 dot product and the scalar fallback; the caller
+// subtracts the precomputed 128 * sum(w_row) compensation either way.
+#ifdef __AVX512VNNI__
+inline int32_t DotShiftedU8S8Vnni(const uint8_t* a,
+                                  const int8_t* w,
+                                  const int64_t len) {
+  __m512i acc = _mm512_setzero_si512();
+  int64_t c = 0;
+  for (; c + 64 <= len; c += 64) {
+    const __m512i va = _mm512_loadu_si512(a + c);
+    const __m512i vw = _mm512_loadu_si512(w + c);
+    acc = _mm512_dpbusd_epi32(acc, va, vw);
+  }
+  int32_t sum = _mm512_reduce_add_epi32(acc);
+  for (; c < len; ++c) {
+    sum += static_cast<int32_t>(a[c]) * static_cast<int32_t>(w[c]);
+  }
+  return sum;
+}
+#endif
+
+inline int32_t DotShiftedU8S8(const uint8_t* a,
+                              const int8_t* w,
+                              const int64_t len) {
+  int32_t sum = 0;
+  for (int64_t c = 0; c < len; ++c) {
+    sum += static_cast<int32_t>(a[c]) * static_cast<int32_t>(w[c]);
+  }
+  return sum;
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void LLMInt8LinearKernel(const Context& dev_ctx,
+                         const DenseTensor& x,
+                         const DenseTensor& weight,
+                         const paddle::optional<DenseTensor>& bias,
+                         const DenseTensor& weight_scale,
+                         const float threshold,
+                         DenseTensor* out) {
+  const auto& w_dims = weight.dims();
+  const int64_t k = w_dims[1];
+  const int64_t n = w_dims[0];
+  const int64_t m = x.numel() / k;
+
+  T* out_data = dev_ctx.template Alloc<T>(out);
+  if (out->numel() == 0) {
+    return;
+  }
+
+  const T* x_data = x.data<T>();
+  const int8_t* w_data = weight.data<int8_t>();
+  const float* w_scale = weight_scale.data<float>();
+  const T* bias_data = bias ? bias->data<T>() : nullptr;
+
+  // Columns holding any activation above the threshold keep full precision
+  // (the LLM.int8 outlier decomposition); everything else is quantized
+  // per row against the row absmax, computed on the fly.
+  std::vector<bool> col_fp(k, false);
+  std::vector<int64_t> fp_cols;
+  for (int64_t i = 0; i < m; ++i) {
+    const T* x_row = x_data + i * k;
+    for (int64_t c = 0; c < k; ++c) {
+      if (!col_fp[c] &&
+          std::abs(static_cast<float>(x_row[c])) >= threshold) {
+        col_fp[c] = true;
+        fp_cols.push_back(c);
+      }
+    }
+  }
+
+  std::vector<float> row_range(m, 0.f);
+  std::vector<uint8_t> x_quant(m * k);
+  for (int64_t i = 0; i < m; ++i) {
+    const T* x_row = x_data + i * k;
+    float range = 0.f;
+    for (int64_t c = 0; c < k; ++c) {
+      const float v = std::abs(static_cast<float>(x_row[c]));
+      if (!col_fp[c] && v > range) {
+        range = v;
+      }
+    }
+    row_range[i] = range;
+    const float inv = range > 0.f ? 127.f / range : 0.f;
+    uint8_t* q_row = x_quant.data() + i * k;
+    for (int64_t c = 0; c < k; ++c) {
+      const float q =
+          col_fp[c] ? 0.f : std::round(static_cast<float>(x_row[c]) * inv);
+      q_row[c] = static_cast<uint8_t>(static_cast<int32_t>(q) + 128);
+    }
+  }
+
+  // compensation for the +128 activation shift: 128 * sum of each weight row
+  std::vector<int32_t> w_comp(n, 0);
+  for (int64_t j = 0; j < n; ++j) {
+    const int8_t* w_row = w_data + j * k;
+    int32_t sum = 0;
+    for (int64_t c = 0; c < k; ++c) {
+      sum += w_row[c];
+    }
+    w_comp[j] = sum * 128;
+  }
+
+#ifdef __AVX512VNNI__
+  const bool use_vnni =
+      phi::backends::cpu::MayIUse(phi::backends::cpu::avx512_core_vnni);
+#endif
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for
+#endif
+  for (int64_t i = 0; i < m; ++i) {
+    const uint8_t* q_row = x_quant.data() + i * k;
+    const float dequant_row = row_range[i] / 127.f;
+    T* out_row = out_data + i * n;
+    for (int64_t j = 0; j < n; ++j) {
+      int32_t dot = 0;
+#ifdef __AVX512VNNI__
+      if (use_vnni) {
+        dot = DotShiftedU8S8Vnni(q_row, w_data + j * k, k);
+      } else {
+        dot = DotShiftedU8S8(q_row, w_data + j * k, k);
+      }
+#else
+      dot = DotShiftedU8S8(q_row, w_data + j * k, k);
+#endif
+      float val =
+          static_cast<float>(dot - w_comp[j]) * dequant_row * w_scale[j];
+      // outlier columns were zeroed before quantization, add them back at
+      // full precision with the dequantized weight
+      for (int64_t c : fp_cols) {
+        val += static_cast<float>(x_data[i * k + c]) *
+               static_cast<float>(w_data[j * k + c]) * w_scale[j];
+      }
+      if (bias_data != nullptr) {
+        val += static_cast<float>(bias_data[j]);
+      }
+      out_row[j] = static_cast<T>(val);
+    }
+  }
+}
+
+}  // namespace phi
+
+PD_REGISTER_KERNEL(
+    llm_int8_linear, CPU, ALL_LAYOUT, phi::LLMInt8LinearKernel, float) {}
@@ -16,6 +16,7 @@
 
 #include "paddle/phi/backends/cpu/cpu_context.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/funcs/cpu_radix_sort.h"
 #include "paddle/phi/kernels/funcs/eigen/common.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
 
@@ -42,6 +43,36 @@ static void FullTopK(Type input_height,
   // when the k is small, will the partial sort
   bool partial_sort_flag = (k * 64) < input_width;
 
+  // For large k on wide rows the nth_element + sort combination degrades to
+  // O(n log n) comparator calls; a full LSD radix argsort of the row is
+  // cheaper and directly yields the sorted top-k (complemented keys handle
+  // the largest case, placing NaNs first to match the comparators). Small k
+  // stays on partial_sort, and unsorted output keeps nth_element which does
+  // strictly less work.
+  if constexpr (funcs::RadixSortTraits<T>::kSupported) {
+    constexpr Type kMinRadixTopKWidth = 256;
+    if (!partial_sort_flag && sorted && input_width >= kMinRadixTopKWidth) {
+      const T* in_data = input->data<T>();
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for
+#endif
+      for (Type i = 0; i < input_height; ++i) {
+        std::vector<T> sorted_values(input_width);
+        std::vector<Type> sorted_indices(input_width);
+        funcs::RadixArgsort<T, Type>(in_data + i * input_width,
+                                     sorted_values.data(),
+                                     sorted_indices.data(),
+                                     input_width,
+                                     largest);
+        for (Type j = 0; j < static_cast<Type>(k); ++j) {
+          t_out[i * k + j] = sorted_values[j];
+          t_indices[i * k + j] = sorted_indices[j];
+        }
+      }
+      return;
+    }
+  }
+
 #ifdef PADDLE_WITH_MKLML
 #pragma omp parallel for
 #endif
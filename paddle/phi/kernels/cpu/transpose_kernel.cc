@@ -19,6 +19,7 @@
 #include "paddle/phi/backends/cpu/cpu_context.h"
 #include "paddle/phi/common/bfloat16.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/funcs/cpu_transpose.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
 
 namespace phi {
@@ -40,6 +41,21 @@ void TransposeKernel(const Context& ctx,
   if (out->numel() == 0) {
     return;
   }
+  // Permutations that swap two contiguous groups of dims (NCHW -> NHWC and
+  // friends) run as batched, cache-blocked 2D transposes; the generic
+  // Eigen shuffle below pays per-element stride arithmetic instead.
+  int64_t batch = 0, rows = 0, cols = 0;
+  if (funcs::GetBlocked2DTransposeShape(
+          x.dims(), formatted_axis, &batch, &rows, &cols)) {
+    const T* src = x.data<T>();
+    T* dst = out->data<T>();
+    for (int64_t b = 0; b < batch; ++b) {
+      funcs::Transpose2DBlocked<T>(
+          src + b * rows * cols, dst + b * rows * cols, rows, cols);
+    }
+    return;
+  }
+
   int rank = static_cast<int>(formatted_axis.size());
   switch (rank) {
     case 0:
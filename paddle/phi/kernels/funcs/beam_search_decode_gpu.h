@@ -0,0 +1,287 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/kernels/funcs/beam_search_decode.h"
+
+namespace phi {
+namespace funcs {
+
+// Device-resident backtrace for beam search decoding.
+//
+// The generic BeamSearchDecodeFunctor copies every per-step id/score tensor
+// to the host (synchronizing the stream for each copy) and then walks the
+// lods on the CPU. Here the token ids, scores and the parent pointers
+// implied by the sentence level lods all stay in device memory: the lods of
+// every step - which already live on the host - are flattened and uploaded
+// once, a single kernel backtraces all hypotheses in parallel, and only the
+// packed result rows come back, with one stream synchronization for the
+// whole decode instead of two per step.
+
+// One thread per hypothesis. Starting from its candidate row in the last
+// step that still had candidates for its source sentence, the thread walks
+// backwards: the sentence level lod of step `s` maps a candidate row to its
+// prefix, and that prefix index is exactly the candidate row of step `s-1`.
+// Tokens are emitted in reverse order, matching the host Backtrace, and
+// redundant end tokens after the first emitted one are skipped.
+template <typename T>
+__global__ void BeamSearchBacktraceKernel(const int64_t* const* step_ids_ptrs,
+                                          const T* const* step_scores_ptrs,
+                                          const int64_t* src_lod_flat,
+                                          const int64_t* sent_lod_flat,
+                                          const int64_t* sent_lod_offsets,
+                                          const int64_t* hyp_source,
+                                          const int64_t* hyp_start_step,
+                                          const int64_t* hyp_start_candidate,
+                                          const int64_t total_hyps,
+                                          const int64_t src_num,
+                                          const int64_t max_len,
+                                          const int end_id,
+                                          int64_t* out_ids,
+                                          T* out_scores,
+                                          int64_t* out_lens) {
+  const int64_t hyp = blockIdx.x * blockDim.x + threadIdx.x;
+  if (hyp >= total_hyps) {
+    return;
+  }
+  const int64_t src = hyp_source[hyp];
+  int64_t candidate = hyp_start_candidate[hyp];
+  int64_t len = 0;
+  for (int64_t step = hyp_start_step[hyp]; step >= 0; --step) {
+    const int64_t id = step_ids_ptrs[step][candidate];
+    const T score = step_scores_ptrs[step][candidate];
+    if (len == 0 || id != end_id) {  // skip redundant end tokens
+      out_ids[hyp * max_len + len] = id;
+      out_scores[hyp * max_len + len] = score;
+      ++len;
+    }
+    if (step == 0) {
+      break;
+    }
+    const int64_t* sent_lod = sent_lod_flat + sent_lod_offsets[step];
+    int64_t prefix = src_lod_flat[step * (src_num + 1) + src];
+    while (sent_lod[prefix + 1] <= candidate) {
+      ++prefix;
+    }
+    candidate = prefix;
+  }
+  out_lens[hyp] = len;
+}
+
+template <typename T>
+void BeamSearchDecodeGPU(const phi::GPUContext& dev_ctx,
+                         const TensorArray& step_ids,
+                         const TensorArray& step_scores,
+                         size_t beam_size,
+                         int end_id,
+                         phi::DenseTensor* id_tensor,
+                         phi::DenseTensor* score_tensor) {
+  const int64_t step_num = static_cast<int64_t>(step_ids.size());
+  const int64_t src_num =
+      static_cast<int64_t>(step_ids.at(0).lod().at(kSourceLevel).size()) - 1;
+  auto gpu_place = dev_ctx.GetPlace();
+  auto stream = dev_ctx.stream();
+
+  // Flatten the two lod levels of every step. The lods are host metadata
+  // already, so no device read is needed to build them.
+  std::vector<int64_t> src_lod_flat;
+  std::vector<int64_t> sent_lod_flat;
+  std::vector<int64_t> sent_lod_offsets(step_num);
+  src_lod_flat.reserve(step_num * (src_num + 1));
+  for (int64_t step = 0; step < step_num; ++step) {
+    const auto& lod = step_ids.at(step).lod();
+    sent_lod_offsets[step] = static_cast<int64_t>(sent_lod_flat.size());
+    for (size_t v : lod.at(kSourceLevel)) {
+      src_lod_flat.push_back(static_cast<int64_t>(v));
+    }
+    for (size_t v : lod.at(kSentenceLevel)) {
+      sent_lod_flat.push_back(static_cast<int64_t>(v));
+    }
+  }
+
+  // A hypothesis starts at the last step where its source sentence still
+  // has candidates (sources that finish early are pruned from later steps).
+  std::vector<int64_t> hyp_source;
+  std::vector<int64_t> hyp_start_step;
+  std::vector<int64_t> hyp_start_candidate;
+  std::vector<int64_t> hyp_num_per_src(src_num, 0);
+  for (int64_t src = 0; src < src_num; ++src) {
+    for (int64_t step = step_num - 1; step >= 0; --step) {
+      const auto& lod = step_ids.at(step).lod();
+      const size_t prefix_start = lod.at(kSourceLevel)[src];
+      const size_t prefix_end = lod.at(kSourceLevel)[src + 1];
+      const size_t candidate_start = lod.at(kSentenceLevel)[prefix_start];
+      const size_t candidate_end = lod.at(kSentenceLevel)[prefix_end];
+      if (candidate_end > candidate_start) {
+        const int64_t count =
+            static_cast<int64_t>(candidate_end - candidate_start);
+        PADDLE_ENFORCE_LE(
+            count,
+            static_cast<int64_t>(beam_size),
+            phi::errors::InvalidArgument(
+                "The number of remaining candidates of source sentence %d "
+                "is %d, which should not be larger than beam_size %d.",
+                src,
+                count,
+                beam_size));
+        for (int64_t i = 0; i < count; ++i) {
+          hyp_source.push_back(src);
+          hyp_start_step.push_back(step);
+          hyp_start_candidate.push_back(
+              static_cast<int64_t>(candidate_start) + i);
+        }
+        hyp_num_per_src[src] = count;
+        break;
+      }
+    }
+  }
+  const int64_t total_hyps = static_cast<int64_t>(hyp_source.size());
+  const int64_t max_len = step_num;
+
+  BeamSearchDecoder<T> beam_search_decoder(beam_size, end_id);
+  std::vector<SentenceVector<T>> sentence_vector_list(
+      src_num, SentenceVector<T>(beam_size));
+  if (total_hyps == 0) {
+    beam_search_decoder.ConvertSentenceVectorToLodTensor(
+        sentence_vector_list, id_tensor, score_tensor, true, true);
+    return;
+  }
+
+  // Upload the flattened metadata and the per-step device data pointers in
+  // one shot; the id/score payload itself never leaves the device until the
+  // packed hypotheses come back.
+  std::vector<int64_t> host_meta;
+  host_meta.reserve(src_lod_flat.size() + sent_lod_flat.size() +
+                    sent_lod_offsets.size() + 3 * total_hyps);
+  host_meta.insert(host_meta.end(), src_lod_flat.begin(), src_lod_flat.end());
+  host_meta.insert(
+      host_meta.end(), sent_lod_flat.begin(), sent_lod_flat.end());
+  host_meta.insert(
+      host_meta.end(), sent_lod_offsets.begin(), sent_lod_offsets.end());
+  host_meta.insert(host_meta.end(), hyp_source.begin(), hyp_source.end());
+  host_meta.insert(
+      host_meta.end(), hyp_start_step.begin(), hyp_start_step.end());
+  host_meta.insert(host_meta.end(),
+                   hyp_start_candidate.begin(),
+                   hyp_start_candidate.end());
+  auto meta_buf = phi::memory_utils::Alloc(
+      gpu_place, host_meta.size() * sizeof(int64_t));
+  phi::memory_utils::Copy(gpu_place,
+                     meta_buf->ptr(),
+                     phi::CPUPlace(),
+                     host_meta.data(),
+                     host_meta.size() * sizeof(int64_t),
+                     stream);
+  const int64_t* meta_dev = reinterpret_cast<const int64_t*>(meta_buf->ptr());
+  const int64_t* src_lod_dev = meta_dev;
+  const int64_t* sent_lod_dev = src_lod_dev + src_lod_flat.size();
+  const int64_t* sent_lod_offsets_dev = sent_lod_dev + sent_lod_flat.size();
+  const int64_t* hyp_source_dev = sent_lod_offsets_dev + step_num;
+  const int64_t* hyp_start_step_dev = hyp_source_dev + total_hyps;
+  const int64_t* hyp_start_candidate_dev = hyp_start_step_dev + total_hyps;
+
+  std::vector<const void*> host_ptrs(2 * step_num, nullptr);
+  for (int64_t step = 0; step < step_num; ++step) {
+    if (step_ids.at(step).numel() > 0) {
+      host_ptrs[step] = step_ids.at(step).data<int64_t>();
+      host_ptrs[step_num + step] = step_scores.at(step).data<T>();
+    }
+  }
+  auto ptr_buf = phi::memory_utils::Alloc(
+      gpu_place, host_ptrs.size() * sizeof(const void*));
+  phi::memory_utils::Copy(gpu_place,
+                     ptr_buf->ptr(),
+                     phi::CPUPlace(),
+                     host_ptrs.data(),
+                     host_ptrs.size() * sizeof(const void*),
+                     stream);
+  auto* ids_ptrs_dev =
+      reinterpret_cast<const int64_t* const*>(ptr_buf->ptr());
+  auto* scores_ptrs_dev = reinterpret_cast<const T* const*>(
+      reinterpret_cast<const void* const*>(ptr_buf->ptr()) + step_num);
+
+  auto out_ids_buf = phi::memory_utils::Alloc(
+      gpu_place, total_hyps * max_len * sizeof(int64_t));
+  auto out_scores_buf =
+      phi::memory_utils::Alloc(gpu_place, total_hyps * max_len * sizeof(T));
+  auto out_lens_buf =
+      phi::memory_utils::Alloc(gpu_place, total_hyps * sizeof(int64_t));
+
+  constexpr int kBlockSize = 256;
+  const int64_t blocks = (total_hyps + kBlockSize - 1) / kBlockSize;
+  BeamSearchBacktraceKernel<T><<<blocks, kBlockSize, 0, stream>>>(
+      ids_ptrs_dev,
+      scores_ptrs_dev,
+      src_lod_dev,
+      sent_lod_dev,
+      sent_lod_offsets_dev,
+      hyp_source_dev,
+      hyp_start_step_dev,
+      hyp_start_candidate_dev,
+      total_hyps,
+      src_num,
+      max_len,
+      end_id,
+      reinterpret_cast<int64_t*>(out_ids_buf->ptr()),
+      reinterpret_cast<T*>(out_scores_buf->ptr()),
+      reinterpret_cast<int64_t*>(out_lens_buf->ptr()));
+
+  std::vector<int64_t> out_ids(total_hyps * max_len);
+  std::vector<T> out_scores(total_hyps * max_len);
+  std::vector<int64_t> out_lens(total_hyps);
+  phi::memory_utils::Copy(phi::CPUPlace(),
+                     out_ids.data(),
+                     gpu_place,
+                     out_ids_buf->ptr(),
+                     out_ids.size() * sizeof(int64_t),
+                     stream);
+  phi::memory_utils::Copy(phi::CPUPlace(),
+                     out_scores.data(),
+                     gpu_place,
+                     out_scores_buf->ptr(),
+                     out_scores.size() * sizeof(T),
+                     stream);
+  phi::memory_utils::Copy(phi::CPUPlace(),
+                     out_lens.data(),
+                     gpu_place,
+                     out_lens_buf->ptr(),
+                     out_lens.size() * sizeof(int64_t),
+                     stream);
+  // The only synchronization of the whole decode.
+  dev_ctx.Wait();
+
+  int64_t hyp = 0;
+  for (int64_t src = 0; src < src_num; ++src) {
+    auto& sentence_vector = sentence_vector_list.at(src);
+    for (int64_t i = 0; i < hyp_num_per_src[src]; ++i, ++hyp) {
+      auto& sentence = sentence_vector.at(i);
+      const int64_t len = out_lens[hyp];
+      sentence.word_ids.assign(out_ids.begin() + hyp * max_len,
+                               out_ids.begin() + hyp * max_len + len);
+      sentence.scores.assign(out_scores.begin() + hyp * max_len,
+                             out_scores.begin() + hyp * max_len + len);
+    }
+  }
+
+  beam_search_decoder.ConvertSentenceVectorToLodTensor(
+      sentence_vector_list, id_tensor, score_tensor, true, true);
+}
+
+}  // namespace funcs
+}  // namespace phi
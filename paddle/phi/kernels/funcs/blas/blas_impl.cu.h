@@ -22,6 +22,7 @@
 
 #include "paddle/phi/backends/dynload/cublas.h"
 #include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/memory_utils.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
 
 COMMON_DECLARE_bool(enable_cublas_tensor_op_math);
@@ -30,6 +31,80 @@ COMMON_DECLARE_bool(gemm_use_half_precision_compute_type);
 namespace phi {
 namespace funcs {
 
+// Stages the host pointer arrays of cublas<X>gemmBatched calls into a
+// reusable device buffer laid out as [A | B | C]. Broadcast batched matmuls
+// (MatMul's case 14) hit this path every step, usually with the very same
+// pointer triples, so the upload is keyed by a hash of the host arrays and
+// skipped entirely when nothing changed; previously each call built three
+// thrust::device_vectors from scratch.
+class GemmPointerArrayCache {
+ public:
+  static GemmPointerArrayCache &Instance() {
+    static thread_local GemmPointerArrayCache cache;
+    return cache;
+  }
+
+  // Returns a device array of 3 * batch_count pointers; entries
+  // [0, batch_count) hold A, then B, then C.
+  void **Prepare(const phi::GPUContext &ctx,
+                 const void **A,
+                 const void **B,
+                 void **C,
+                 int batch_count) {
+    const size_t num_ptrs = 3 * static_cast<size_t>(batch_count);
+    size_t signature = std::hash<int>()(batch_count);
+    auto combine = [&signature](const void *p) {
+      signature ^= std::hash<const void *>()(p) + 0x9e3779b9 +
+                   (signature << 6) + (signature >> 2);
+    };
+    for (int i = 0; i < batch_count; ++i) {
+      combine(A[i]);
+      combine(B[i]);
+      combine(C[i]);
+    }
+    combine(static_cast<const void *>(ctx.stream()));
+
+    if (buf_ != nullptr && capacity_ >= num_ptrs && signature == signature_) {
+      return reinterpret_cast<void **>(buf_->ptr());
+    }
+
+    if (buf_ == nullptr || capacity_ < num_ptrs) {
+      size_t capacity = std::max(num_ptrs, capacity_ * 2);
+      // stream-ordered allocation, so growing the buffer cannot free the
+      // old one under a still-running batched GEMM
+      buf_ = memory_utils::Alloc(
+          ctx.GetPlace(),
+          capacity * sizeof(void *),
+          phi::Stream(reinterpret_cast<phi::StreamId>(ctx.stream())));
+      capacity_ = capacity;
+    }
+
+    host_ptrs_.clear();
+    host_ptrs_.reserve(num_ptrs);
+    host_ptrs_.insert(host_ptrs_.end(), A, A + batch_count);
+    host_ptrs_.insert(host_ptrs_.end(), B, B + batch_count);
+    host_ptrs_.insert(
+        host_ptrs_.end(), const_cast<const void **>(C), C + batch_count);
+    // synchronous copy: host_ptrs_ is mutated again on the next cache miss,
+    // which an in-flight async copy could observe
+    memory_utils::Copy(ctx.GetPlace(),
+                       buf_->ptr(),
+                       phi::CPUPlace(),
+                       host_ptrs_.data(),
+                       num_ptrs * sizeof(void *));
+    signature_ = signature;
+    return reinterpret_cast<void **>(buf_->ptr());
+  }
+
+ private:
+  GemmPointerArrayCache() = default;
+
+  phi::Allocator::AllocationPtr buf_;
+  size_t capacity_ = 0;
+  size_t signature_ = 0;
+  std::vector<const void *> host_ptrs_;
+};
+
 template <typename T>
 struct CUBlas;
 
@@ -313,31 +388,34 @@ struct CUBlas<phi::dtype::float16> {
     VLOG(5) << "use_tensor_op_math: "
             << (use_tensor_op_math ? "True" : "False");
 #endif  // CUDA_VERSION >= 9000
-    thrust::device_vector<const void *> A_ptr(A, A + batchCount);
-    thrust::device_vector<const void *> B_ptr(B, B + batchCount);
-    thrust::device_vector<void *> C_ptr(C, C + batchCount);
+    void **dev_ptrs = GemmPointerArrayCache::Instance().Prepare(
+        *dev_ctx,
+        reinterpret_cast<const void **>(A),
+        reinterpret_cast<const void **>(B),
+        reinterpret_cast<void **>(C),
+        batchCount);
     dev_ctx->TensorCoreCublasCallIfAvailable([&](cublasHandle_t handle) {
-      PADDLE_ENFORCE_GPU_SUCCESS(
-          phi::dynload::cublasGemmBatchedEx(handle,
-                                            transa,
-                                            transb,
-                                            m,
-                                            n,
-                                            k,
-                                            alpha,
-                                            A_ptr.data().get(),
-                                            Atype,
-                                            lda,
-                                            B_ptr.data().get(),
-                                            Btype,
-                                            ldb,
-                                            beta,
-                                            C_ptr.data().get(),
-                                            Ctype,
-                                            ldc,
-                                            batchCount,
-                                            computeType,
-                                            algo));
+      PADDLE_ENFORCE_GPU_SUCCESS(phi::dynload::cublasGemmBatchedEx(
+          handle,
+          transa,
+          transb,
+          m,
+          n,
+          k,
+          alpha,
+          reinterpret_cast<const void **>(dev_ptrs),
+          Atype,
+          lda,
+          reinterpret_cast<const void **>(dev_ptrs + batchCount),
+          Btype,
+          ldb,
+          beta,
+          dev_ptrs + 2 * batchCount,
+          Ctype,
+          ldc,
+          batchCount,
+          computeType,
+          algo));
     });
 #else
     PADDLE_THROW(phi::errors::Unimplemented(
@@ -1894,26 +1972,30 @@ inline void Blas<phi::GPUContext>::BatchedGEMM(CBLAS_TRANSPOSE transA,
       (transA == CblasNoTrans) ? CUBLAS_OP_N : CUBLAS_OP_T;
   cublasOperation_t cuTransB =
       (transB == CblasNoTrans) ? CUBLAS_OP_N : CUBLAS_OP_T;
-  thrust::device_vector<const double *> A_ptr(A, A + batchCount);
-  thrust::device_vector<const double *> B_ptr(B, B + batchCount);
-  thrust::device_vector<double *> C_ptr(C, C + batchCount);
+  void **dev_ptrs = GemmPointerArrayCache::Instance().Prepare(
+      context_,
+      reinterpret_cast<const void **>(A),
+      reinterpret_cast<const void **>(B),
+      reinterpret_cast<void **>(C),
+      batchCount);
 
   context_.CublasCall([&](cublasHandle_t handle) {
-    CUBlas<double>::GEMM_BATCH(handle,
-                               cuTransB,
-                               cuTransA,
-                               N,
-                               M,
-                               K,
-                               &alpha,
-                               B_ptr.data().get(),
-                               ldb,
-                               A_ptr.data().get(),
-                               lda,
-                               &beta,
-                               C_ptr.data().get(),
-                               ldc,
-                               batchCount);
+    CUBlas<double>::GEMM_BATCH(
+        handle,
+        cuTransB,
+        cuTransA,
+        N,
+        M,
+        K,
+        &alpha,
+        reinterpret_cast<const double **>(dev_ptrs + batchCount),
+        ldb,
+        reinterpret_cast<const double **>(dev_ptrs),
+        lda,
+        &beta,
+        reinterpret_cast<double **>(dev_ptrs + 2 * batchCount),
+        ldc,
+        batchCount);
   });
 }
 
@@ -1939,26 +2021,30 @@ inline void Blas<phi::GPUContext>::BatchedGEMM(CBLAS_TRANSPOSE transA,
       (transA == CblasNoTrans) ? CUBLAS_OP_N : CUBLAS_OP_T;
   cublasOperation_t cuTransB =
       (transB == CblasNoTrans) ? CUBLAS_OP_N : CUBLAS_OP_T;
-  thrust::device_vector<const float *> A_ptr(A, A + batchCount);
-  thrust::device_vector<const float *> B_ptr(B, B + batchCount);
-  thrust::device_vector<float *> C_ptr(C, C + batchCount);
+  void **dev_ptrs = GemmPointerArrayCache::Instance().Prepare(
+      context_,
+      reinterpret_cast<const void **>(A),
+      reinterpret_cast<const void **>(B),
+      reinterpret_cast<void **>(C),
+      batchCount);
 
   context_.CublasCall([&](cublasHandle_t handle) {
-    CUBlas<float>::GEMM_BATCH(handle,
-                              cuTransB,
-                              cuTransA,
-                              N,
-                              M,
-                              K,
-                              &alpha,
-                              B_ptr.data().get(),
-                              ldb,
-                              A_ptr.data().get(),
-                              lda,
-                              &beta,
-                              C_ptr.data().get(),
-                              ldc,
-                              batchCount);
+    CUBlas<float>::GEMM_BATCH(
+        handle,
+        cuTransB,
+        cuTransA,
+        N,
+        M,
+        K,
+        &alpha,
+        reinterpret_cast<const float **>(dev_ptrs + batchCount),
+        ldb,
+        reinterpret_cast<const float **>(dev_ptrs),
+        lda,
+        &beta,
+        reinterpret_cast<float **>(dev_ptrs + 2 * batchCount),
+        ldc,
+        batchCount);
   });
 }
 
@@ -2058,31 +2144,34 @@ inline void Blas<phi::GPUContext>::BatchedGEMM(CBLAS_TRANSPOSE transA,
   }
   VLOG(5) << "use_tensor_op_math: " << (use_tensor_op_math ? "True" : "False");
 
-  thrust::device_vector<const void *> A_ptr(A, A + batchCount);
-  thrust::device_vector<const void *> B_ptr(B, B + batchCount);
-  thrust::device_vector<void *> C_ptr(C, C + batchCount);
+  void **dev_ptrs = GemmPointerArrayCache::Instance().Prepare(
+      context_,
+      reinterpret_cast<const void **>(A),
+      reinterpret_cast<const void **>(B),
+      reinterpret_cast<void **>(C),
+      batchCount);
   context_.TensorCoreCublasCallIfAvailable([&](cublasHandle_t handle) {
-    PADDLE_ENFORCE_GPU_SUCCESS(
-        phi::dynload::cublasGemmBatchedEx(handle,
-                                          cuTransB,
-                                          cuTransA,
-                                          N,
-                                          M,
-                                          K,
-                                          &f_alpha,
-                                          B_ptr.data().get(),
-                                          CUDA_R_16BF,
-                                          ldb,
-                                          A_ptr.data().get(),
-                                          CUDA_R_16BF,
-                                          lda,
-                                          &f_beta,
-                                          C_ptr.data().get(),
-                                          CUDA_R_16BF,
-                                          ldc,
-                                          batchCount,
-                                          CUDA_R_32F,
-                                          algo));
+    PADDLE_ENFORCE_GPU_SUCCESS(phi::dynload::cublasGemmBatchedEx(
+        handle,
+        cuTransB,
+        cuTransA,
+        N,
+        M,
+        K,
+        &f_alpha,
+        reinterpret_cast<const void **>(dev_ptrs + batchCount),
+        CUDA_R_16BF,
+        ldb,
+        reinterpret_cast<const void **>(dev_ptrs),
+        CUDA_R_16BF,
+        lda,
+        &f_beta,
+        dev_ptrs + 2 * batchCount,
+        CUDA_R_16BF,
+        ldc,
+        batchCount,
+        CUDA_R_32F,
+        algo));
   });
 #else
   // raise error
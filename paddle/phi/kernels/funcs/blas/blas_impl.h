@@ -1142,6 +1142,250 @@ void Blas<phi::CPUContext>::GEMM(CBLAS_TRANSPOSE transA,
                  ldc);
 }
 
+namespace detail {
+// Widens a row-major bf16 matrix (rows x cols, leading dimension ld) into a
+// dense fp32 buffer with leading dimension cols.
+inline void WidenBF16Matrix(const phi::dtype::bfloat16 *src,
+                            const int rows,
+                            const int cols,
+                            const int ld,
+                            float *dst) {
+  for (int r = 0; r < rows; ++r) {
+    const phi::dtype::bfloat16 *s = src + static_cast<int64_t>(r) * ld;
+    float *d = dst + static_cast<int64_t>(r) * cols;
+    for (int c = 0; c < cols; ++c) {
+      d[c] = static_cast<float>(s[c]);
+    }
+  }
+}
+
+inline void NarrowToBF16Matrix(const float *src,
+                               const int rows,
+                               const int cols,
+                               const int ld_dst,
+                               phi::dtype::bfloat16 *dst) {
+  for (int r = 0; r < rows; ++r) {
+    const float *s = src + static_cast<int64_t>(r) * cols;
+    phi::dtype::bfloat16 *d = dst + static_cast<int64_t>(r) * ld_dst;
+    for (int c = 0; c < cols; ++c) {
+      d[c] = static_cast<phi::dtype::bfloat16>(s[c]);
+    }
+  }
+}
+}  // namespace detail
+
+// bf16 GEMM on CPU: operands are widened to fp32 and the product runs
+// through the vendor sgemm, so accumulation happens in fp32 and only the
+// final result is rounded back to bf16 -- the same numerical contract as
+// native bf16 tile kernels. Ops opt in simply by instantiating the wrapper
+// with bfloat16; nothing routes here implicitly.
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM(CBLAS_TRANSPOSE transA,
+                                        CBLAS_TRANSPOSE transB,
+                                        int M,
+                                        int N,
+                                        int K,
+                                        phi::dtype::bfloat16 alpha,
+                                        const phi::dtype::bfloat16 *A,
+                                        int lda,
+                                        const phi::dtype::bfloat16 *B,
+                                        int ldb,
+                                        phi::dtype::bfloat16 beta,
+                                        phi::dtype::bfloat16 *C,
+                                        int ldc) const {
+  const int a_rows = (transA == CblasNoTrans) ? M : K;
+  const int a_cols = (transA == CblasNoTrans) ? K : M;
+  const int b_rows = (transB == CblasNoTrans) ? K : N;
+  const int b_cols = (transB == CblasNoTrans) ? N : K;
+  std::vector<float> a_f32(static_cast<size_t>(a_rows) * a_cols);
+  std::vector<float> b_f32(static_cast<size_t>(b_rows) * b_cols);
+  std::vector<float> c_f32(static_cast<size_t>(M) * N);
+  detail::WidenBF16Matrix(A, a_rows, a_cols, lda, a_f32.data());
+  detail::WidenBF16Matrix(B, b_rows, b_cols, ldb, b_f32.data());
+  const float beta_f32 = static_cast<float>(beta);
+  if (beta_f32 != 0.f) {
+    detail::WidenBF16Matrix(C, M, N, ldc, c_f32.data());
+  }
+  CBlas<float>::GEMM(CblasRowMajor,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     static_cast<float>(alpha),
+                     a_f32.data(),
+                     a_cols,
+                     b_f32.data(),
+                     b_cols,
+                     beta_f32,
+                     c_f32.data(),
+                     N);
+  detail::NarrowToBF16Matrix(c_f32.data(), M, N, ldc, C);
+}
+
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM(CBLAS_TRANSPOSE transA,
+                                        CBLAS_TRANSPOSE transB,
+                                        int M,
+                                        int N,
+                                        int K,
+                                        phi::dtype::bfloat16 alpha,
+                                        const phi::dtype::bfloat16 *A,
+                                        const phi::dtype::bfloat16 *B,
+                                        phi::dtype::bfloat16 beta,
+                                        phi::dtype::bfloat16 *C) const {
+  const int lda = (transA == CblasNoTrans) ? K : M;
+  const int ldb = (transB == CblasNoTrans) ? N : K;
+  this->GEMM(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, N);
+}
+
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM(bool transA,
+                                        bool transB,
+                                        int M,
+                                        int N,
+                                        int K,
+                                        phi::dtype::bfloat16 alpha,
+                                        const phi::dtype::bfloat16 *A,
+                                        int lda,
+                                        const phi::dtype::bfloat16 *B,
+                                        int ldb,
+                                        phi::dtype::bfloat16 beta,
+                                        phi::dtype::bfloat16 *C,
+                                        int ldc) const {
+  this->GEMM(transA ? CblasTrans : CblasNoTrans,
+             transB ? CblasTrans : CblasNoTrans,
+             M,
+             N,
+             K,
+             alpha,
+             A,
+             lda,
+             B,
+             ldb,
+             beta,
+             C,
+             ldc);
+}
+
+#ifdef PADDLE_WITH_MKLML
+// Packed bf16 GEMM: the opaque buffer returned by GEMM_ALLOC holds the
+// vendor's packed fp32 layout, so a static weight pays the bf16->fp32
+// conversion once in GEMM_PACK and every GEMM_COMPUTE reuses it; only the
+// activations are widened per call.
+template <>
+template <>
+inline phi::dtype::bfloat16 *
+Blas<phi::CPUContext>::GEMM_ALLOC<phi::dtype::bfloat16>(
+    const CBLAS_IDENTIFIER id, const int M, const int N, const int K) const {
+  return reinterpret_cast<phi::dtype::bfloat16 *>(
+      CBlas<float>::GEMM_ALLOC(id, M, N, K));
+}
+
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM_PACK(
+    const CBLAS_IDENTIFIER id,
+    const CBLAS_TRANSPOSE trans,
+    int M,
+    int N,
+    int K,
+    const phi::dtype::bfloat16 alpha,
+    const phi::dtype::bfloat16 *src,
+    const int ld,
+    phi::dtype::bfloat16 *dst) const {
+  int rows, cols;
+  if (id == CblasAMatrix) {
+    rows = (trans == CblasNoTrans) ? M : K;
+    cols = (trans == CblasNoTrans) ? K : M;
+  } else {
+    rows = (trans == CblasNoTrans) ? K : N;
+    cols = (trans == CblasNoTrans) ? N : K;
+  }
+  std::vector<float> src_f32(static_cast<size_t>(rows) * cols);
+  detail::WidenBF16Matrix(src, rows, cols, ld, src_f32.data());
+  CBlas<float>::GEMM_PACK(CblasRowMajor,
+                          id,
+                          trans,
+                          M,
+                          N,
+                          K,
+                          static_cast<float>(alpha),
+                          src_f32.data(),
+                          cols,
+                          reinterpret_cast<float *>(dst));
+}
+
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM_COMPUTE(
+    int transA,
+    int transB,
+    int M,
+    int N,
+    int K,
+    const phi::dtype::bfloat16 *A,
+    const int lda,
+    const phi::dtype::bfloat16 *B,
+    const int ldb,
+    phi::dtype::bfloat16 beta,
+    phi::dtype::bfloat16 *C,
+    const int ldc) const {
+  const float *a_ptr;
+  const float *b_ptr;
+  int lda_f32 = lda, ldb_f32 = ldb;
+  std::vector<float> a_f32, b_f32;
+  if (transA == static_cast<int>(CblasPacked)) {
+    a_ptr = reinterpret_cast<const float *>(A);
+  } else {
+    const int rows = (transA == static_cast<int>(CblasTrans)) ? K : M;
+    const int cols = (transA == static_cast<int>(CblasTrans)) ? M : K;
+    a_f32.resize(static_cast<size_t>(rows) * cols);
+    detail::WidenBF16Matrix(A, rows, cols, lda, a_f32.data());
+    a_ptr = a_f32.data();
+    lda_f32 = cols;
+  }
+  if (transB == static_cast<int>(CblasPacked)) {
+    b_ptr = reinterpret_cast<const float *>(B);
+  } else {
+    const int rows = (transB == static_cast<int>(CblasTrans)) ? N : K;
+    const int cols = (transB == static_cast<int>(CblasTrans)) ? K : N;
+    b_f32.resize(static_cast<size_t>(rows) * cols);
+    detail::WidenBF16Matrix(B, rows, cols, ldb, b_f32.data());
+    b_ptr = b_f32.data();
+    ldb_f32 = cols;
+  }
+  std::vector<float> c_f32(static_cast<size_t>(M) * N);
+  const float beta_f32 = static_cast<float>(beta);
+  if (beta_f32 != 0.f) {
+    detail::WidenBF16Matrix(C, M, N, ldc, c_f32.data());
+  }
+  CBlas<float>::GEMM_COMPUTE(CblasRowMajor,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             a_ptr,
+                             lda_f32,
+                             b_ptr,
+                             ldb_f32,
+                             beta_f32,
+                             c_f32.data(),
+                             N);
+  detail::NarrowToBF16Matrix(c_f32.data(), M, N, ldc, C);
+}
+
+template <>
+template <>
+inline void Blas<phi::CPUContext>::GEMM_FREE(phi::dtype::bfloat16 *data) const {
+  CBlas<float>::GEMM_FREE(reinterpret_cast<float *>(data));
+}
+#endif  // PADDLE_WITH_MKLML
+
 template <typename DeviceContext>
 template <typename T>
 void Blas<DeviceContext>::MatMul(const phi::DenseTensor &mat_a,
@@ -0,0 +1,140 @@
+/* Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace phi {
+namespace funcs {
+
+// Maps a sortable value to an unsigned key whose ascending unsigned order
+// matches the comparator order used by the CPU argsort/topk kernels:
+// ascending by value, with NaNs (of either sign) ordered after everything
+// else. The primary template marks a type unsupported so callers can gate
+// the radix path at compile time and keep the comparison sort for types
+// like float16.
+template <typename T>
+struct RadixSortTraits {
+  static constexpr bool kSupported = false;
+};
+
+template <>
+struct RadixSortTraits<float> {
+  static constexpr bool kSupported = true;
+  using KeyT = uint32_t;
+  static KeyT ToKey(float v) {
+    if (std::isnan(v)) {
+      return std::numeric_limits<KeyT>::max();
+    }
+    KeyT u;
+    std::memcpy(&u, &v, sizeof(u));
+    return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+  }
+};
+
+template <>
+struct RadixSortTraits<double> {
+  static constexpr bool kSupported = true;
+  using KeyT = uint64_t;
+  static KeyT ToKey(double v) {
+    if (std::isnan(v)) {
+      return std::numeric_limits<KeyT>::max();
+    }
+    KeyT u;
+    std::memcpy(&u, &v, sizeof(u));
+    return (u & 0x8000000000000000ull) ? ~u : (u | 0x8000000000000000ull);
+  }
+};
+
+template <>
+struct RadixSortTraits<int32_t> {
+  static constexpr bool kSupported = true;
+  using KeyT = uint32_t;
+  static KeyT ToKey(int32_t v) {
+    return static_cast<KeyT>(v) ^ 0x80000000u;
+  }
+};
+
+template <>
+struct RadixSortTraits<int64_t> {
+  static constexpr bool kSupported = true;
+  using KeyT = uint64_t;
+  static KeyT ToKey(int64_t v) {
+    return static_cast<KeyT>(v) ^ 0x8000000000000000ull;
+  }
+};
+
+// LSD radix argsort of one contiguous row: writes the sorted values and the
+// original positions of the sorted elements. Runs in O(sizeof(key) * n)
+// with byte-wide digits, skipping passes where all keys share a digit.
+// The sort is stable, but note that unlike the comparator it orders -0.0
+// before +0.0, so callers that promise comparator-stability should keep
+// using the comparison sort. Descending order is obtained by complementing
+// the keys, which also places NaNs first to match the comparators.
+template <typename T, typename IndexT>
+void RadixArgsort(const T* input,
+                  T* out_values,
+                  IndexT* out_indices,
+                  const int64_t n,
+                  const bool descending) {
+  using KeyT = typename RadixSortTraits<T>::KeyT;
+  struct Entry {
+    KeyT key;
+    IndexT idx;
+  };
+  std::vector<Entry> buf_a(n), buf_b(n);
+  for (int64_t j = 0; j < n; ++j) {
+    KeyT key = RadixSortTraits<T>::ToKey(input[j]);
+    buf_a[j].key = descending ? static_cast<KeyT>(~key) : key;
+    buf_a[j].idx = static_cast<IndexT>(j);
+  }
+
+  Entry* src = buf_a.data();
+  Entry* dst = buf_b.data();
+  constexpr int kNumPasses = static_cast<int>(sizeof(KeyT));
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    const int shift = pass * 8;
+    int64_t count[256] = {0};
+    for (int64_t j = 0; j < n; ++j) {
+      ++count[(src[j].key >> shift) & 0xFF];
+    }
+    // all keys share this digit, nothing to move
+    if (count[(src[0].key >> shift) & 0xFF] == n) {
+      continue;
+    }
+    int64_t offset = 0;
+    int64_t start[256];
+    for (int d = 0; d < 256; ++d) {
+      start[d] = offset;
+      offset += count[d];
+    }
+    for (int64_t j = 0; j < n; ++j) {
+      dst[start[(src[j].key >> shift) & 0xFF]++] = src[j];
+    }
+    std::swap(src, dst);
+  }
+
+  for (int64_t j = 0; j < n; ++j) {
+    out_indices[j] = src[j].idx;
+    out_values[j] = input[src[j].idx];
+  }
+}
+
+}  // namespace funcs
+}  // namespace phi
@@ -0,0 +1,187 @@
+/* Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+#include "paddle/common/ddim.h"
+
+namespace phi {
+namespace funcs {
+
+// Recognizes permutations that swap two contiguous groups of dimensions,
+// optionally under fixed leading batch dims, e.g. NCHW -> NHWC is batch N
+// plus the swap of C with HW. Such permutations run as batched 2D tile
+// transposes instead of the generic strided index walk. Size-1 dims are
+// squeezed out first so they never break the pattern. Returns false when
+// the permutation has no such shape.
+inline bool GetBlocked2DTransposeShape(const common::DDim& in_dims,
+                                       const std::vector<int>& axis,
+                                       int64_t* batch,
+                                       int64_t* m,
+                                       int64_t* n) {
+  const int rank = static_cast<int>(axis.size());
+  std::vector<int> dim_map(rank, -1);
+  std::vector<int64_t> dims;
+  for (int i = 0; i < rank; ++i) {
+    if (in_dims[i] != 1) {
+      dim_map[i] = static_cast<int>(dims.size());
+      dims.push_back(in_dims[i]);
+    }
+  }
+  std::vector<int> perm;
+  for (int i = 0; i < rank; ++i) {
+    if (dim_map[axis[i]] >= 0) {
+      perm.push_back(dim_map[axis[i]]);
+    }
+  }
+  const int r = static_cast<int>(perm.size());
+  int p = 0;
+  while (p < r && perm[p] == p) {
+    ++p;
+  }
+  if (r - p < 2) {
+    return false;
+  }
+  // the rest must be [first .. r-1] followed by [p .. first-1]
+  const int first = perm[p];
+  if (first <= p || first >= r) {
+    return false;
+  }
+  int i = p;
+  for (int expect = first; expect < r; ++expect, ++i) {
+    if (perm[i] != expect) {
+      return false;
+    }
+  }
+  for (int expect = p; expect < first; ++expect, ++i) {
+    if (perm[i] != expect) {
+      return false;
+    }
+  }
+  int64_t b = 1, mm = 1, nn = 1;
+  for (int d = 0; d < p; ++d) {
+    b *= dims[d];
+  }
+  for (int d = p; d < first; ++d) {
+    mm *= dims[d];
+  }
+  for (int d = first; d < r; ++d) {
+    nn *= dims[d];
+  }
+  *batch = b;
+  *m = mm;
+  *n = nn;
+  return true;
+}
+
+#ifdef __AVX__
+// 8x8 in-register transpose; pure bit movement, so any 4-byte element type
+// can be routed through it.
+inline void Transpose8x8Avx(const float* src,
+                            const int64_t lda,
+                            float* dst,
+                            const int64_t ldb) {
+  __m256 r0 = _mm256_loadu_ps(src + 0 * lda);
+  __m256 r1 = _mm256_loadu_ps(src + 1 * lda);
+  __m256 r2 = _mm256_loadu_ps(src + 2 * lda);
+  __m256 r3 = _mm256_loadu_ps(src + 3 * lda);
+  __m256 r4 = _mm256_loadu_ps(src + 4 * lda);
+  __m256 r5 = _mm256_loadu_ps(src + 5 * lda);
+  __m256 r6 = _mm256_loadu_ps(src + 6 * lda);
+  __m256 r7 = _mm256_loadu_ps(src + 7 * lda);
+  __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+  __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44);
+  __m256 s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+  __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44);
+  __m256 s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+  __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44);
+  __m256 s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+  __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44);
+  __m256 s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+  _mm256_storeu_ps(dst + 0 * ldb, _mm256_permute2f128_ps(s0, s4, 0x20));
+  _mm256_storeu_ps(dst + 1 * ldb, _mm256_permute2f128_ps(s1, s5, 0x20));
+  _mm256_storeu_ps(dst + 2 * ldb, _mm256_permute2f128_ps(s2, s6, 0x20));
+  _mm256_storeu_ps(dst + 3 * ldb, _mm256_permute2f128_ps(s3, s7, 0x20));
+  _mm256_storeu_ps(dst + 4 * ldb, _mm256_permute2f128_ps(s0, s4, 0x31));
+  _mm256_storeu_ps(dst + 5 * ldb, _mm256_permute2f128_ps(s1, s5, 0x31));
+  _mm256_storeu_ps(dst + 6 * ldb, _mm256_permute2f128_ps(s2, s6, 0x31));
+  _mm256_storeu_ps(dst + 7 * ldb, _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+#endif
+
+// Writes dst[j * m + i] = src[i * n + j]. Tiles to keep one source and one
+// destination tile resident in L1, hands full 8x8 sub-blocks of 4-byte
+// types to the AVX shuffle kernel, and spreads the row tiles over threads.
+template <typename T>
+void Transpose2DBlocked(const T* src, T* dst, const int64_t m, const int64_t n) {
+  constexpr int64_t kTile = 64;
+#ifdef PADDLE_WITH_MKLML
+  constexpr int64_t kMinParallelElems = 1 << 14;
+#pragma omp parallel for if (m * n >= kMinParallelElems)
+#endif
+  for (int64_t ii = 0; ii < m; ii += kTile) {
+    const int64_t i_end = std::min(ii + kTile, m);
+    for (int64_t jj = 0; jj < n; jj += kTile) {
+      const int64_t j_end = std::min(jj + kTile, n);
+#ifdef __AVX__
+      if constexpr (sizeof(T) == sizeof(float)) {
+        int64_t i = ii;
+        for (; i + 8 <= i_end; i += 8) {
+          int64_t j = jj;
+          for (; j + 8 <= j_end; j += 8) {
+            Transpose8x8Avx(reinterpret_cast<const float*>(src) + i * n + j,
+                            n,
+                            reinterpret_cast<float*>(dst) + j * m + i,
+                            m);
+          }
+          for (; j < j_end; ++j) {
+            for (int64_t k = i; k < i + 8; ++k) {
+              dst[j * m + k] = src[k * n + j];
+            }
+          }
+        }
+        for (; i < i_end; ++i) {
+          for (int64_t j = jj; j < j_end; ++j) {
+            dst[j * m + i] = src[i * n + j];
+          }
+        }
+        continue;
+      }
+#endif
+      for (int64_t i = ii; i < i_end; ++i) {
+        for (int64_t j = jj; j < j_end; ++j) {
+          dst[j * m + i] = src[i * n + j];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace funcs
+}  // namespace phi
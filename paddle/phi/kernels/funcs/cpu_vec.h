@@ -137,8 +137,28 @@ inline void vec_scal<float, backends::cpu::avx512f>(const int n,
                                                     const float a,
                                                     const float* x,
                                                     float* y) {
-  // TODO(TJ): enable me
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_scal<float, backends::cpu::avx2>(n, a, x, y);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 scalar = _mm512_set1_ps(a);
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(y + i, _mm512_mul_ps(_mm512_loadu_ps(x + i), scalar));
+  }
+  if (rest != 0) {
+    // masked ops are inplace-safe, no need to fall back to scalar code
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    _mm512_mask_storeu_ps(
+        y + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, x + i), scalar));
+  }
+#else
   vec_scal<float, backends::cpu::avx2>(n, a, x, y);
+#endif
 }
 
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
@@ -184,6 +204,39 @@ inline void vec_sum<float, backends::cpu::avx>(const size_t n,
 #endif
 }
 
+template <>
+inline void vec_sum<float, backends::cpu::avx2>(const size_t n,
+                                                const float* x,
+                                                float* s) {
+  vec_sum<float, backends::cpu::avx>(n, x, s);
+}
+
+template <>
+inline void vec_sum<float, backends::cpu::avx512f>(const size_t n,
+                                                   const float* x,
+                                                   float* s) {
+#ifdef __AVX512F__
+  constexpr size_t block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_sum<float, backends::cpu::avx2>(n, x, s);
+    return;
+  }
+  size_t i = 0;
+  const size_t end = n & ~(block - 1);
+  __m512 tmp = _mm512_setzero_ps();
+  for (i = 0; i < end; i += block) {
+    tmp = _mm512_add_ps(tmp, _mm512_loadu_ps(x + i));
+  }
+  if (i < n) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << (n - i)) - 1;
+    tmp = _mm512_add_ps(tmp, _mm512_maskz_loadu_ps(mask, x + i));
+  }
+  s[0] = _mm512_reduce_add_ps(tmp);
+#else
+  vec_sum<float, backends::cpu::avx2>(n, x, s);
+#endif
+}
+
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
 inline void vec_mul(const size_t n, const T* x, const T* y, T* z) {
   for (size_t i = 0; i < n; ++i) {
@@ -218,6 +271,43 @@ inline void vec_mul<float, backends::cpu::avx>(const size_t n,
 #endif
 }
 
+template <>
+inline void vec_mul<float, backends::cpu::avx2>(const size_t n,
+                                                const float* x,
+                                                const float* y,
+                                                float* z) {
+  vec_mul<float, backends::cpu::avx>(n, x, y, z);
+}
+
+template <>
+inline void vec_mul<float, backends::cpu::avx512f>(const size_t n,
+                                                   const float* x,
+                                                   const float* y,
+                                                   float* z) {
+#ifdef __AVX512F__
+  constexpr size_t block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_mul<float, backends::cpu::avx2>(n, x, y, z);
+    return;
+  }
+  size_t i = 0;
+  const size_t end = n & ~(block - 1);
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(
+        z + i, _mm512_mul_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+  }
+  if (i < n) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << (n - i)) - 1;
+    _mm512_mask_storeu_ps(z + i,
+                          mask,
+                          _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                                        _mm512_maskz_loadu_ps(mask, y + i)));
+  }
+#else
+  vec_mul<float, backends::cpu::avx2>(n, x, y, z);
+#endif
+}
+
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
 inline void vec_mul_reduce(const size_t n, const T* x, const T* y, T* z) {
   z[0] = x[0] * y[0];
@@ -262,6 +352,44 @@ inline void vec_mul_reduce<float, backends::cpu::avx>(const size_t n,
 #endif
 }
 
+template <>
+inline void vec_mul_reduce<float, backends::cpu::avx2>(const size_t n,
+                                                       const float* x,
+                                                       const float* y,
+                                                       float* z) {
+  vec_mul_reduce<float, backends::cpu::avx>(n, x, y, z);
+}
+
+template <>
+inline void vec_mul_reduce<float, backends::cpu::avx512f>(const size_t n,
+                                                          const float* x,
+                                                          const float* y,
+                                                          float* z) {
+#ifdef __AVX512F__
+  constexpr size_t block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_mul_reduce<float, backends::cpu::avx2>(n, x, y, z);
+    return;
+  }
+  size_t i = 0;
+  const size_t end = n & ~(block - 1);
+  __m512 tmp = _mm512_setzero_ps();
+  for (i = 0; i < end; i += block) {
+    tmp = _mm512_fmadd_ps(
+        _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), tmp);
+  }
+  if (i < n) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << (n - i)) - 1;
+    tmp = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                          _mm512_maskz_loadu_ps(mask, y + i),
+                          tmp);
+  }
+  z[0] = _mm512_reduce_add_ps(tmp);
+#else
+  vec_mul_reduce<float, backends::cpu::avx2>(n, x, y, z);
+#endif
+}
+
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
 inline void vec_bias_sub(const int n, const T a, const T* x, T* y) {
   for (int i = 0; i < n; ++i) {
@@ -318,8 +446,27 @@ inline void vec_bias_sub<float, backends::cpu::avx512f>(const int n,
                                                         const float a,
                                                         const float* x,
                                                         float* y) {
-  // TODO(TJ): enable me
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_bias_sub<float, backends::cpu::avx2>(n, a, x, y);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 bias = _mm512_set1_ps(a);
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(y + i, _mm512_sub_ps(bias, _mm512_loadu_ps(x + i)));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    _mm512_mask_storeu_ps(
+        y + i, mask, _mm512_sub_ps(bias, _mm512_maskz_loadu_ps(mask, x + i)));
+  }
+#else
   vec_bias_sub<float, backends::cpu::avx2>(n, a, x, y);
+#endif
 }
 
 // out = x*y + (1-x)*z
@@ -375,8 +522,34 @@ inline void vec_cross<float, backends::cpu::avx2>(
 template <>
 inline void vec_cross<float, backends::cpu::avx512f>(
     const int n, const float* x, const float* y, const float* z, float* out) {
-  // TODO(TJ): enable me
-  vec_cross<float, backends::cpu::avx>(n, x, y, z, out);
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_cross<float, backends::cpu::avx2>(n, x, y, z, out);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 ones = _mm512_set1_ps(1.f);
+  __m512 tmpx, tmpy, tmpz;
+  for (i = 0; i < end; i += block) {
+    tmpx = _mm512_loadu_ps(x + i);
+    tmpy = _mm512_mul_ps(tmpx, _mm512_loadu_ps(y + i));
+    tmpz = _mm512_mul_ps(_mm512_sub_ps(ones, tmpx), _mm512_loadu_ps(z + i));
+    _mm512_storeu_ps(out + i, _mm512_add_ps(tmpy, tmpz));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    tmpx = _mm512_maskz_loadu_ps(mask, x + i);
+    tmpy = _mm512_mul_ps(tmpx, _mm512_maskz_loadu_ps(mask, y + i));
+    tmpz = _mm512_mul_ps(_mm512_sub_ps(ones, tmpx),
+                         _mm512_maskz_loadu_ps(mask, z + i));
+    _mm512_mask_storeu_ps(out + i, mask, _mm512_add_ps(tmpy, tmpz));
+  }
+#else
+  vec_cross<float, backends::cpu::avx2>(n, x, y, z, out);
+#endif
 }
 
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
@@ -414,6 +587,43 @@ inline void vec_clip<float, backends::cpu::avx>(const size_t n,
 #endif
 }
 
+template <>
+inline void vec_clip<float, backends::cpu::avx2>(const size_t n,
+                                                 const float a,
+                                                 const float* x,
+                                                 float* y) {
+  vec_clip<float, backends::cpu::avx>(n, a, x, y);
+}
+
+template <>
+inline void vec_clip<float, backends::cpu::avx512f>(const size_t n,
+                                                    const float a,
+                                                    const float* x,
+                                                    float* y) {
+#ifdef __AVX512F__
+  constexpr size_t block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_clip<float, backends::cpu::avx2>(n, a, x, y);
+    return;
+  }
+  size_t i = 0;
+  const size_t end = n & ~(block - 1);
+  __m512 threshold = _mm512_set1_ps(a);
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(y + i, _mm512_max_ps(_mm512_loadu_ps(x + i), threshold));
+  }
+  if (i < n) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << (n - i)) - 1;
+    _mm512_mask_storeu_ps(
+        y + i,
+        mask,
+        _mm512_max_ps(_mm512_maskz_loadu_ps(mask, x + i), threshold));
+  }
+#else
+  vec_clip<float, backends::cpu::avx2>(n, a, x, y);
+#endif
+}
+
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
 inline void vec_add_bias(const int n, const T a, const T* x, T* y) {
   for (int i = 0; i < n; ++i) {
@@ -470,8 +680,27 @@ inline void vec_add_bias<float, backends::cpu::avx512f>(const int n,
                                                         const float a,
                                                         const float* x,
                                                         float* y) {
-  // TODO(TJ): enable me
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_add_bias<float, backends::cpu::avx2>(n, a, x, y);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 bias = _mm512_set1_ps(a);
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(y + i, _mm512_add_ps(_mm512_loadu_ps(x + i), bias));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    _mm512_mask_storeu_ps(
+        y + i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, x + i), bias));
+  }
+#else
   vec_add_bias<float, backends::cpu::avx2>(n, a, x, y);
+#endif
 }
 
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
@@ -565,8 +794,46 @@ template <>
 inline void vec_sigmoid<float, backends::cpu::avx512f>(const int n,
                                                        const float* x,
                                                        float* y) {
-  // TODO(TJ): enable me
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block) {
+    vec_sigmoid<float, backends::cpu::avx2>(n, x, y);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 max = _mm512_set1_ps(SIGMOID_THRESHOLD_MAX);
+  __m512 min = _mm512_set1_ps(SIGMOID_THRESHOLD_MIN);
+  __m512 zeros = _mm512_setzero_ps();
+  __m512 tmp;
+  for (i = 0; i < end; i += block) {
+    tmp = _mm512_loadu_ps(x + i);
+    tmp = _mm512_min_ps(_mm512_max_ps(tmp, min), max);
+    _mm512_storeu_ps(y + i, _mm512_sub_ps(zeros, tmp));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    tmp = _mm512_maskz_loadu_ps(mask, x + i);
+    tmp = _mm512_min_ps(_mm512_max_ps(tmp, min), max);
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_sub_ps(zeros, tmp));
+  }
+
+  vec_exp<float>(n, y, y);
+
+  __m512 ones = _mm512_set1_ps(1.0f);
+  for (i = 0; i < end; i += block) {
+    tmp = _mm512_add_ps(ones, _mm512_loadu_ps(y + i));
+    _mm512_storeu_ps(y + i, _mm512_div_ps(ones, tmp));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    tmp = _mm512_add_ps(ones, _mm512_maskz_loadu_ps(mask, y + i));
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_div_ps(ones, tmp));
+  }
+#else
   vec_sigmoid<float, backends::cpu::avx2>(n, x, y);
+#endif
 }
 
 template <typename T, backends::cpu::cpu_isa_t isa = backends::cpu::isa_any>
@@ -631,8 +898,27 @@ template <>
 inline void vec_relu<float, backends::cpu::avx512f>(const int n,
                                                     const float* x,
                                                     float* y) {
-  // TODO(TJ): enable me
+#ifdef __AVX512F__
+  constexpr int block = ZMM_FLOAT_BLOCK;
+  if (n < block * 4) {
+    vec_relu<float, backends::cpu::avx2>(n, x, y);
+    return;
+  }
+  const int rest = n % block;
+  const int end = n - rest;
+  int i = 0;
+  __m512 zeros = _mm512_setzero_ps();
+  for (i = 0; i < end; i += block) {
+    _mm512_storeu_ps(y + i, _mm512_max_ps(_mm512_loadu_ps(x + i), zeros));
+  }
+  if (rest != 0) {
+    const __mmask16 mask = (static_cast<__mmask16>(1) << rest) - 1;
+    _mm512_mask_storeu_ps(
+        y + i, mask, _mm512_max_ps(_mm512_maskz_loadu_ps(mask, x + i), zeros));
+  }
+#else
   vec_relu<float, backends::cpu::avx2>(n, x, y);
+#endif
 }
 
 // TODO(TJ): optimize double of sigmoid, tanh and relu if necessary
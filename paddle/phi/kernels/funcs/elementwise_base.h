@@ -281,7 +281,6 @@ void CommonForwardBroadcastCPU(const DenseTensor &x,
                                const CPUContext &ctx,
                                Functor func,
                                const bool is_xsize_larger = true) {
-  std::vector<int> index_array(max_dim, 0);
   const T *x_data = x.data<T>();
   const T *y_data = y.data<T>();
   PADDLE_ENFORCE_NOT_NULL(
@@ -290,19 +289,116 @@ void CommonForwardBroadcastCPU(const DenseTensor &x,
       y_data, errors::InvalidArgument("The input Y should not be empty."));
   OutType *out_data = ctx.Alloc<OutType>(z);
 
-  const int out_size = std::accumulate(
-      out_dims_array, out_dims_array + max_dim, 1, std::multiplies<int>());
-  int x_index, y_index;
-  for (int out_index = 0; out_index < out_size; ++out_index) {
-    x_index = GetElementwiseIndex(x_dims_array, max_dim, index_array.data());
-    y_index = GetElementwiseIndex(y_dims_array, max_dim, index_array.data());
-    if (is_xsize_larger) {
-      out_data[out_index] = func(x_data[x_index], y_data[y_index]);
+  const int64_t out_size = std::accumulate(out_dims_array,
+                                           out_dims_array + max_dim,
+                                           static_cast<int64_t>(1),
+                                           std::multiplies<int64_t>());
+  if (out_size == 0) {
+    return;
+  }
+
+  // Fold the shapes: merge adjacent output dims whose broadcast pattern
+  // (x broadcast / y broadcast / neither) is identical, dropping size-1
+  // dims. A [B,1,H] bias against [B,S,H] collapses to three merged dims
+  // with H left as a contiguous inner run, so the loops below degrade to
+  // plain pointer arithmetic instead of recomputing a multi-dimensional
+  // index for every element.
+  std::vector<int64_t> dims;
+  std::vector<bool> x_bcast, y_bcast;
+  for (int i = 0; i < max_dim; ++i) {
+    if (out_dims_array[i] == 1) {
+      continue;
+    }
+    const bool xb = (x_dims_array[i] == 1);
+    const bool yb = (y_dims_array[i] == 1);
+    if (!dims.empty() && xb == x_bcast.back() && yb == y_bcast.back()) {
+      dims.back() *= out_dims_array[i];
     } else {
-      out_data[out_index] = func(y_data[y_index], x_data[x_index]);
+      dims.push_back(out_dims_array[i]);
+      x_bcast.push_back(xb);
+      y_bcast.push_back(yb);
+    }
+  }
+  if (dims.empty()) {
+    dims.push_back(1);
+    x_bcast.push_back(false);
+    y_bcast.push_back(false);
+  }
+
+  // Row-major strides over the merged dims; broadcast dims advance by 0.
+  const int ndim = static_cast<int>(dims.size());
+  std::vector<int64_t> x_strides(ndim), y_strides(ndim);
+  int64_t x_stride = 1, y_stride = 1;
+  for (int i = ndim - 1; i >= 0; --i) {
+    x_strides[i] = x_bcast[i] ? 0 : x_stride;
+    y_strides[i] = y_bcast[i] ? 0 : y_stride;
+    if (!x_bcast[i]) {
+      x_stride *= dims[i];
     }
+    if (!y_bcast[i]) {
+      y_stride *= dims[i];
+    }
+  }
 
-    UpdateElementwiseIndexArray(out_dims_array, max_dim, index_array.data());
+  // A merged dim cannot be broadcast on both sides (it would have size 1
+  // and be dropped above), so the inner run falls into one of three cases:
+  // both contiguous, y splat, or x splat. All three are tight loops the
+  // compiler can vectorize, unlike the generic per-element index walk.
+  const int64_t inner = dims[ndim - 1];
+  const bool x_inner_bcast = x_bcast[ndim - 1];
+  const bool y_inner_bcast = y_bcast[ndim - 1];
+  const int64_t outer = out_size / inner;
+
+  std::vector<int64_t> index(ndim > 1 ? ndim - 1 : 0, 0);
+  int64_t x_offset = 0, y_offset = 0;
+  for (int64_t o = 0; o < outer; ++o) {
+    OutType *out_ptr = out_data + o * inner;
+    const T *x_ptr = x_data + x_offset;
+    const T *y_ptr = y_data + y_offset;
+    if (!x_inner_bcast && !y_inner_bcast) {
+      if (is_xsize_larger) {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(x_ptr[i], y_ptr[i]);
+        }
+      } else {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(y_ptr[i], x_ptr[i]);
+        }
+      }
+    } else if (y_inner_bcast) {
+      const T y_val = *y_ptr;
+      if (is_xsize_larger) {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(x_ptr[i], y_val);
+        }
+      } else {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(y_val, x_ptr[i]);
+        }
+      }
+    } else {
+      const T x_val = *x_ptr;
+      if (is_xsize_larger) {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(x_val, y_ptr[i]);
+        }
+      } else {
+        for (int64_t i = 0; i < inner; ++i) {
+          out_ptr[i] = func(y_ptr[i], x_val);
+        }
+      }
+    }
+    // Advance the outer odometer, updating both offsets incrementally.
+    for (int d = ndim - 2; d >= 0; --d) {
+      x_offset += x_strides[d];
+      y_offset += y_strides[d];
+      if (++index[d] < dims[d]) {
+        break;
+      }
+      index[d] = 0;
+      x_offset -= x_strides[d] * dims[d];
+      y_offset -= y_strides[d] * dims[d];
+    }
   }
 }
 
@@ -760,6 +856,14 @@ void LaunchElementwiseKernel(const KPDevice &ctx,
   VectorizedElementwiseKernel<OutT, Functor, Arity, NumOuts, VecSize>
       <<<gpu_config.block_per_grid, gpu_config.thread_per_block, 0, stream>>>(
           ins_data, outs_data, numel, main_offset, VecSize, func);
+  if (phi::backends::gpu::LaunchParamLogger::GetInstance().IsEnabled()) {
+    phi::backends::gpu::LogKernelLaunchParams(
+        ctx,
+        std::string("VectorizedElementwiseKernel<") + typeid(Functor).name() +
+            ", VecSize=" + std::to_string(VecSize) + ">",
+        VectorizedElementwiseKernel<OutT, Functor, Arity, NumOuts, VecSize>,
+        gpu_config);
+  }
 #endif
 }
 
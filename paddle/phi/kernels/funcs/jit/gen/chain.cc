@@ -0,0 +1,80 @@
+/* Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "paddle/phi/kernels/funcs/jit/gen/chain.h"
+
+#include "paddle/phi/backends/cpu/cpu_info.h"
+#include "paddle/phi/kernels/funcs/jit/macro.h"
+#include "paddle/phi/kernels/funcs/jit/registry.h"
+
+namespace phi::jit::gen {
+
+void VChainJitCode::genCode() {
+  mov(reg_ptr_x_, ptr[param1]);
+  int offset = 0;
+  for (int i = 0; i < num_ / YMM_FLOAT_BLOCK; ++i) {
+    vmovups(ymm_acc, ptr[reg_ptr_x_ + offset]);
+    chain_jmm<ymm_t>(ymm_acc, ymm_opr, ymm_tmp, offset, YMM_FLOAT_BLOCK);
+    vmovups(ptr[param2 + offset], ymm_acc);
+    offset += sizeof(float) * YMM_FLOAT_BLOCK;
+  }
+  int rest = num_ % YMM_FLOAT_BLOCK;
+  while (rest > 0) {
+    int block = XMM_FLOAT_BLOCK;
+    if (rest >= 4) {
+      block = 4;
+      vmovups(xmm_acc, ptr[reg_ptr_x_ + offset]);
+    } else if (rest >= 2) {
+      block = 2;
+      vmovq(xmm_acc, ptr[reg_ptr_x_ + offset]);
+    } else {
+      block = 1;
+      vmovss(xmm_acc, ptr[reg_ptr_x_ + offset]);
+    }
+    chain_jmm<xmm_t>(xmm_acc, xmm_opr, xmm_tmp, offset, block);
+    if (rest >= 4) {
+      vmovups(ptr[param2 + offset], xmm_acc);
+    } else if (rest >= 2) {
+      vmovq(ptr[param2 + offset], xmm_acc);
+    } else {
+      vmovss(ptr[param2 + offset], xmm_acc);
+    }
+    offset += sizeof(float) * block;  // NOLINT
+    rest -= block;
+  }
+  ret();
+}
+
+class VChainCreator : public JitCodeCreator<chain_attr_t> {
+ public:
+  bool CanBeUsed(const chain_attr_t& attr) const override {
+    return phi::backends::cpu::MayIUse(phi::backends::cpu::avx) &&
+           chain_stage_num(attr.sig) > 0 && attr.d <= 1024;
+  }
+  size_t CodeSize(const chain_attr_t& attr) const override {
+    // budget every stage with the most expensive emitter (tanh)
+    return 96 + (attr.d / YMM_FLOAT_BLOCK + 3) *
+                    (chain_stage_num(attr.sig) + 1) * 84 * 8;
+  }
+  std::unique_ptr<GenBase> CreateJitCode(
+      const chain_attr_t& attr) const override {
+    return make_unique<VChainJitCode>(attr, CodeSize(attr));
+  }
+};
+
+}  // namespace phi::jit::gen
+
+namespace gen = phi::jit::gen;
+
+REGISTER_JITKERNEL_GEN(kVChain, gen::VChainCreator);
@@ -0,0 +1,165 @@
+/* Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "glog/logging.h"
+#include "paddle/phi/core/enforce.h"
+#include "paddle/phi/kernels/funcs/jit/gen/act.h"
+
+namespace phi {
+namespace jit {
+namespace gen {
+
+// function: y = stage_k(...stage_1(x)...), one memory pass for the whole
+// chain; the running value stays in a register between stages
+class VChainJitCode : public VActFunc {
+ public:
+  explicit VChainJitCode(const chain_attr_t& attr,
+                         size_t code_size,
+                         void* code_ptr = nullptr)
+      : VActFunc(code_size, code_ptr), num_(attr.d) {
+    for (int i = 0; i < chain_stage_num(attr.sig); ++i) {
+      stages_.push_back(chain_stage_at(attr.sig, i));
+    }
+    if (stages_.empty()) {
+      PADDLE_THROW(phi::errors::Unimplemented(
+          "Do not support an empty chain signature."));
+    }
+    this->genCode();
+  }
+
+  std::string name() const override {
+    std::string base = "VChainJitCode";
+    for (auto stage : stages_) {
+      switch (stage) {
+        case kChainAdd:
+          base += "_Add";
+          break;
+        case kChainSub:
+          base += "_Sub";
+          break;
+        case kChainMul:
+          base += "_Mul";
+          break;
+        case kChainMax:
+          base += "_Max";
+          break;
+        case kChainRelu:
+          base += "_Relu";
+          break;
+        case kChainSquare:
+          base += "_Square";
+          break;
+        case kChainExp:
+          base += "_Exp";
+          break;
+        case kChainSigmoid:
+          base += "_Sigmoid";
+          break;
+        case kChainTanh:
+          base += "_Tanh";
+          break;
+        default:
+          break;
+      }
+    }
+    base += "_D" + std::to_string(num_);
+    return base;
+  }
+  void genCode() override;
+
+ protected:
+  // emit all stages for one block whose first operand is already in acc;
+  // binary stages fetch their pointer from the inputs array each block so
+  // the chain length is not limited by free registers
+  template <typename JMM>
+  void chain_jmm(JMM& acc, JMM& opr, JMM& tmp, int offset, int block) {
+    int next_input = 1;
+    for (auto stage : stages_) {
+      if (chain_stage_is_binary(stage)) {
+        mov(reg_ptr_in_, ptr[param1 + next_input * sizeof(void*)]);
+        ++next_input;
+        if (block >= 4) {
+          vmovups(opr, ptr[reg_ptr_in_ + offset]);
+        } else if (block == 2) {
+          vmovq(opr, ptr[reg_ptr_in_ + offset]);
+        } else {
+          vmovss(opr, ptr[reg_ptr_in_ + offset]);
+        }
+      }
+      switch (stage) {
+        case kChainAdd:
+          vaddps(acc, acc, opr);
+          break;
+        case kChainSub:
+          vsubps(acc, acc, opr);
+          break;
+        case kChainMul:
+          vmulps(acc, acc, opr);
+          break;
+        case kChainMax:
+          vmaxps(acc, acc, opr);
+          break;
+        case kChainRelu:
+          act<JMM>(tmp, acc, operand_type::RELU);
+          vmovaps(acc, tmp);
+          break;
+        case kChainSquare:
+          act<JMM>(tmp, acc, operand_type::SQUARE);
+          vmovaps(acc, tmp);
+          break;
+        case kChainExp:
+          act<JMM>(tmp, acc, operand_type::EXP);
+          vmovaps(acc, tmp);
+          break;
+        case kChainSigmoid:
+          act<JMM>(tmp, acc, operand_type::SIGMOID);
+          vmovaps(acc, tmp);
+          break;
+        case kChainTanh:
+          act<JMM>(tmp, acc, operand_type::TANH);
+          vmovaps(acc, tmp);
+          break;
+        default:
+          PADDLE_THROW(phi::errors::Unimplemented(
+              "Do not support chain stage code: %d.", stage));
+          break;
+      }
+    }
+  }
+
+  int num_;
+  std::vector<ChainStageType> stages_;
+  reg64_t param1{abi_param1};  // const T* const* inputs
+  reg64_t param2{abi_param2};  // T* y
+  reg64_t reg_ptr_x_{Xbyak::Operand::R11};
+  reg64_t reg_ptr_in_{Xbyak::Operand::R10};
+
+  xmm_t xmm_acc = xmm_t(0);
+  ymm_t ymm_acc = ymm_t(0);
+
+  xmm_t xmm_opr = xmm_t(1);
+  ymm_t ymm_opr = ymm_t(1);
+
+  xmm_t xmm_tmp = xmm_t(2);
+  ymm_t ymm_tmp = ymm_t(2);
+};
+
+}  // namespace gen
+}  // namespace jit
+}  // namespace phi
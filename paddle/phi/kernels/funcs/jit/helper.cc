@@ -41,6 +41,7 @@ const char* to_string(KernelType kt) {
     ONE_CASE(kVAddBias);
     ONE_CASE(kVRelu);
     ONE_CASE(kVBroadcast);
+    ONE_CASE(kVChain);
     ONE_CASE(kVCopy);
     ONE_CASE(kVIdentity);
     ONE_CASE(kVExp);
@@ -102,6 +103,42 @@ KernelType to_kerneltype(const std::string& act) {
   return kNone;
 }
 
+ChainStageType to_chainstage(KernelType kt) {
+  switch (kt) {
+    case kVAdd:
+      return kChainAdd;
+    case kVSub:
+      return kChainSub;
+    case kVMul:
+      return kChainMul;
+    case kVRelu:
+      return kChainRelu;
+    case kVSquare:
+      return kChainSquare;
+    case kVExp:
+      return kChainExp;
+    case kVSigmoid:
+      return kChainSigmoid;
+    case kVTanh:
+      return kChainTanh;
+    default:
+      return kChainEnd;
+  }
+}
+
+bool append_chain_stage(KernelType kt, int64_t* sig) {
+  const ChainStageType stage = to_chainstage(kt);
+  if (stage == kChainEnd) {
+    return false;
+  }
+  const int n = chain_stage_num(*sig);
+  if (n >= kChainMaxStages) {
+    return false;
+  }
+  *sig |= static_cast<int64_t>(stage) << (n * 4);
+  return true;
+}
+
 template <>
 void pack_weights<float>(const float* src, float* dst, int n, int k) {
   int block = 0, rest = 0;
@@ -250,6 +250,15 @@ const char* to_string(SeqPoolType kt);
 
 KernelType to_kerneltype(const std::string& act);
 
+// Maps one elementwise kernel type onto its fused chain stage, or kChainEnd
+// when the op cannot take part in a chain.
+ChainStageType to_chainstage(KernelType kt);
+
+// Appends one elementwise op to a packed chain signature. Returns false and
+// leaves sig untouched when the op is not fusable or the chain is full, so
+// prepare-time callers can simply stop growing the chain there.
+bool append_chain_stage(KernelType kt, int64_t* sig);
+
 inline std::ostream& operator<<(std::ostream& os, const lstm_attr_t& attr) {
   os << "dim_size[" << attr.d << "],act_gate[" << to_string(attr.act_gate)
      << "],act_cand[" << to_string(attr.act_cand) << "],act_cell["
@@ -40,6 +40,7 @@ typedef enum {
   kVAddBias,
   kVAddRelu,
   kVBroadcast,
+  kVChain,
   kVCopy,
   kVExp,
   kVIdentity,
@@ -191,6 +192,60 @@ struct VBroadcastTuple {
   typedef void (*func_type)(const T*, T*, int64_t, int64_t);
 };
 
+// One stage of a fused elementwise chain. Binary stages read the next
+// pointer of the inputs array, unary stages act on the running value, so a
+// whole chain makes a single pass over memory.
+typedef enum {
+  kChainEnd = 0,
+  // binary stages, each consumes one extra input
+  kChainAdd = 1,
+  kChainSub,
+  kChainMul,
+  kChainMax,
+  // unary stages
+  kChainRelu,
+  kChainSquare,
+  kChainExp,
+  kChainSigmoid,
+  kChainTanh,
+} ChainStageType;
+
+// stages are packed into an int64_t signature, 4 bits each, first stage in
+// the lowest nibble, terminated by kChainEnd
+constexpr int kChainMaxStages = 16;
+
+inline ChainStageType chain_stage_at(int64_t sig, int i) {
+  return static_cast<ChainStageType>((sig >> (i * 4)) & 0xF);
+}
+
+inline bool chain_stage_is_binary(ChainStageType stage) {
+  return stage >= kChainAdd && stage <= kChainMax;
+}
+
+inline int chain_stage_num(int64_t sig) {
+  int n = 0;
+  while (n < kChainMaxStages && chain_stage_at(sig, n) != kChainEnd) {
+    ++n;
+  }
+  return n;
+}
+
+typedef struct chain_attr_s {
+  int64_t sig{0};
+  int d{0};
+  chain_attr_s() = default;
+  explicit chain_attr_s(int64_t _sig, int _d) : sig(_sig), d(_d) {}
+} chain_attr_t;
+
+template <typename T>
+struct VChainTuple {
+  static constexpr KernelType kernel_type = kVChain;
+  typedef T data_type;
+  typedef chain_attr_t attr_type;
+  // inputs[0] is x; each binary stage consumes the next pointer of inputs
+  typedef void (*func_type)(const T* const*, T*, const chain_attr_t*);
+};
+
 typedef struct seq_pool_attr_s {
   int h, w;  // h should always be the first one
   SeqPoolType type;
@@ -44,6 +44,12 @@ int64_t JitCodeKey<lstm_attr_t>(const lstm_attr_t& attr) {
   return static_cast<int64_t>(XXH64(keys.data(), sizeof(int) * 5, 0));
 }
 
+template <>
+int64_t JitCodeKey<chain_attr_t>(const chain_attr_t& attr) {
+  std::array<int64_t, 2> keys = {attr.sig, static_cast<int64_t>(attr.d)};
+  return static_cast<int64_t>(XXH64(keys.data(), sizeof(int64_t) * 2, 0));
+}
+
 template <>
 int64_t JitCodeKey<seq_pool_attr_t>(const seq_pool_attr_t& attr) {
   std::array<int, 2> keys = {attr.w, static_cast<int>(attr.type)};
@@ -32,6 +32,7 @@ REGISTER_REFER_KERNEL(VAddBias);
 
 REGISTER_REFER_KERNEL(VRelu);
 REGISTER_REFER_KERNEL(VCopy);
+REGISTER_REFER_KERNEL(VChain);
 REGISTER_REFER_KERNEL(VIdentity);
 REGISTER_REFER_KERNEL(VSquare);
 REGISTER_REFER_KERNEL(VExp);
@@ -84,6 +84,65 @@ void VBroadcast(const T* x, T* y, int64_t y_h, int64_t x_len) {
   }
 }
 
+// Walks the packed stage signature once per element. The refer code keeps
+// the single-pass contract of the fused chain but not the SIMD.
+template <typename T>
+void VChain(const T* const* inputs, T* y, const chain_attr_t* attr) {
+  const T min = SIGMOID_THRESHOLD_MIN;
+  const T max = SIGMOID_THRESHOLD_MAX;
+  for (int i = 0; i < attr->d; ++i) {
+    T v = inputs[0][i];
+    int next_input = 1;
+    for (int s = 0; s < kChainMaxStages; ++s) {
+      const ChainStageType stage = chain_stage_at(attr->sig, s);
+      if (stage == kChainEnd) {
+        break;
+      }
+      switch (stage) {
+        case kChainAdd:
+          v += inputs[next_input++][i];
+          break;
+        case kChainSub:
+          v -= inputs[next_input++][i];
+          break;
+        case kChainMul:
+          v *= inputs[next_input++][i];
+          break;
+        case kChainMax: {
+          const T other = inputs[next_input++][i];
+          v = v > other ? v : other;
+          break;
+        }
+        case kChainRelu:
+          v = v > 0 ? v : 0;
+          break;
+        case kChainSquare:
+          v = v * v;
+          break;
+        case kChainExp:
+          v = std::exp(v);
+          break;
+        case kChainSigmoid: {
+          const T tmp = (v < min) ? min : ((v > max) ? max : v);
+          v = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-tmp));
+          break;
+        }
+        case kChainTanh: {
+          // y = 2 * sigmoid(2x) - 1
+          T tmp = static_cast<T>(2) * v;
+          tmp = (tmp < min) ? min : ((tmp > max) ? max : tmp);
+          tmp = static_cast<T>(1) / (static_cast<T>(1) + std::exp(-tmp));
+          v = static_cast<T>(2) * tmp - static_cast<T>(1);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    y[i] = v;
+  }
+}
+
 template <typename T>
 void VRelu(const T* x, T* y, int n) {
   for (int i = 0; i < n; ++i) {
@@ -588,6 +647,9 @@ DECLARE_REFER_KERNEL(VTanh);
 DECLARE_REFER_KERNEL(VSquare);
 DECLARE_REFER_KERNEL(VCopy);
 
+// const T* const* inputs, T* y, const chain_attr_t*
+DECLARE_REFER_KERNEL(VChain);
+
 // lstm_t*, const lstm_attr_t*
 DECLARE_REFER_KERNEL(LSTMCtHt);
 DECLARE_REFER_KERNEL(LSTMC1H1);
@@ -1053,13 +1053,61 @@ void TestKernelVBroadcast() {
   }
 }
 
+template <typename KernelTuple, typename PlaceType>
+void TestKernelVChain() {
+  using T = typename KernelTuple::data_type;
+  VLOG(10) << "Test JITKernel: " << jit::to_string(KernelTuple::kernel_type);
+  // add -> mul -> sigmoid, the motivating fused pattern
+  int64_t sig = 0;
+  EXPECT_TRUE(jit::append_chain_stage(jit::kVAdd, &sig));
+  EXPECT_TRUE(jit::append_chain_stage(jit::kVMul, &sig));
+  EXPECT_TRUE(jit::append_chain_stage(jit::kVSigmoid, &sig));
+  EXPECT_EQ(jit::chain_stage_num(sig), 3);
+  for (int d : TestSizes()) {
+    auto ref = jit::GetReferFunc<KernelTuple>();
+    EXPECT_TRUE(ref != nullptr);
+    jit::chain_attr_t attr(sig, d);
+    std::vector<T> x(d), y(d), z(d), outref(d);
+    RandomVec<T>(d, x.data());
+    RandomVec<T>(d, y.data());
+    RandomVec<T>(d, z.data());
+    const T* inputs[3] = {x.data(), y.data(), z.data()};
+    ref(inputs, outref.data(), &attr);
+
+    // the fused single pass should match the unfused op-by-op result
+    auto ref_vadd = jit::GetReferFunc<jit::VAddTuple<T>>();
+    auto ref_vmul = jit::GetReferFunc<jit::VMulTuple<T>>();
+    auto ref_vsigmoid = jit::GetReferFunc<jit::VSigmoidTuple<T>>();
+    std::vector<T> expect(d);
+    ref_vadd(x.data(), y.data(), expect.data(), d);
+    ref_vmul(expect.data(), z.data(), expect.data(), d);
+    ref_vsigmoid(expect.data(), expect.data(), d);
+    ExpectEQ<T>(outref.data(), expect.data(), d);
+
+    auto verifier = [](const typename KernelTuple::func_type tgt,
+                       const std::vector<T>& x,
+                       const std::vector<T>& y,
+                       const std::vector<T>& z,
+                       const std::vector<T>& outref,
+                       const typename KernelTuple::attr_type& attr) {
+      EXPECT_TRUE(tgt != nullptr);
+      const int d = attr.d;
+      std::vector<T> out(d);
+      const T* inputs[3] = {x.data(), y.data(), z.data()};
+      tgt(inputs, out.data(), &attr);
+      ExpectEQ<T>(out.data(), outref.data(), d);
+    };
+    TestAllImpls<KernelTuple, PlaceType>(attr, verifier, x, y, z, outref, attr);
+  }
+}
+
 // test pool
 TEST(JITKernel_pool, jitcreator) {
   const auto& jitcreators = jit::JitCodeCreatorPool::Instance().AllCreators();
 #if defined(_WIN32) || defined(__APPLE__) || defined(__OSX__)
   EXPECT_EQ(jitcreators.size(), 0UL);
 #else
-  EXPECT_EQ(jitcreators.size(), 24UL);
+  EXPECT_EQ(jitcreators.size(), 25UL);
 #endif
 }
 
@@ -1472,3 +1520,4 @@ TEST_CPU_KERNEL(Adam);
 TEST_CPU_KERNEL(AdamW);
 TEST_CPU_KERNEL(Sgd);
 TEST_CPU_KERNEL(VBroadcast);
+TEST_CPU_KERNEL(VChain);
@@ -0,0 +1,275 @@
+/* Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/common/place.h"
+#include "paddle/phi/core/enforce.h"
+
+namespace phi {
+namespace funcs {
+
+// Persistent-kernel execution of elementwise chains.
+//
+// At small batch sizes a chain of tiny ElementwiseKernel invocations is
+// dominated by launch gaps: every link costs a host->device round trip that
+// often exceeds the math. The facility below keeps one grid resident on the
+// stream and feeds it work descriptors through a host-pinned ring buffer, so
+// publishing the next link is a couple of host stores instead of a launch.
+//
+// Protocol: the host writes a descriptor into the ring, fences, then bumps
+// `doorbell`. Every block of the resident grid polls the doorbell, applies
+// the descriptor with a grid-stride loop, and the last block to finish
+// publishes completion - first to a device-memory counter the other blocks
+// spin on (links may read what the previous link wrote), then to the pinned
+// control block the host observes. Raising `stop` retires the grid.
+
+enum class PersistentEltwiseOp : int {
+  kRelu = 0,
+  kSigmoid,
+  kTanh,
+  kSquare,
+  kScale,  // out = alpha * x
+  kAdd,
+  kSub,
+  kMul,
+  kMax,
+};
+
+template <typename T>
+struct PersistentEltwiseWork {
+  const T* x{nullptr};
+  const T* y{nullptr};  // binary ops only, same numel as x (no broadcast)
+  T* out{nullptr};
+  int64_t n{0};
+  T alpha{static_cast<T>(0)};
+  int op{0};
+};
+
+// Lives in mapped pinned host memory; both sides poll it.
+struct PersistentQueueControl {
+  volatile int64_t doorbell;   // number of descriptors published by the host
+  volatile int64_t completed;  // number of descriptors fully drained
+  volatile int stop;
+};
+
+// Lives in device memory so inter-block ordering never crosses the bus.
+struct PersistentQueueDeviceState {
+  unsigned int arrive;
+  volatile int64_t done;
+};
+
+template <typename T>
+__device__ __forceinline__ T ApplyPersistentEltwiseOp(int op,
+                                                      T x,
+                                                      T y,
+                                                      T alpha) {
+  switch (static_cast<PersistentEltwiseOp>(op)) {
+    case PersistentEltwiseOp::kRelu:
+      return x > static_cast<T>(0) ? x : static_cast<T>(0);
+    case PersistentEltwiseOp::kSigmoid:
+      return static_cast<T>(
+          1.0f / (1.0f + expf(-static_cast<float>(x))));
+    case PersistentEltwiseOp::kTanh:
+      return static_cast<T>(tanhf(static_cast<float>(x)));
+    case PersistentEltwiseOp::kSquare:
+      return x * x;
+    case PersistentEltwiseOp::kScale:
+      return alpha * x;
+    case PersistentEltwiseOp::kAdd:
+      return x + y;
+    case PersistentEltwiseOp::kSub:
+      return x - y;
+    case PersistentEltwiseOp::kMul:
+      return x * y;
+    case PersistentEltwiseOp::kMax:
+      return x > y ? x : y;
+  }
+  return x;
+}
+
+template <typename T, int Capacity>
+__global__ void PersistentEltwiseLoop(PersistentQueueControl* ctl,
+                                      const PersistentEltwiseWork<T>* ring,
+                                      PersistentQueueDeviceState* dev_state) {
+  int64_t next = 0;
+  while (true) {
+    // every thread polls; a pinned-memory read per spin is the price of
+    // launch-free publication
+    while (ctl->doorbell <= next) {
+      if (ctl->stop) {
+        return;
+      }
+    }
+    __threadfence_system();  // descriptor stores precede the doorbell bump
+    const PersistentEltwiseWork<T> w = ring[next % Capacity];
+
+    const int64_t stride = static_cast<int64_t>(gridDim.x) * blockDim.x;
+    for (int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x +
+                     threadIdx.x;
+         i < w.n;
+         i += stride) {
+      const T xv = w.x[i];
+      const T yv = (w.y != nullptr) ? w.y[i] : static_cast<T>(0);
+      w.out[i] = ApplyPersistentEltwiseOp<T>(w.op, xv, yv, w.alpha);
+    }
+
+    __syncthreads();
+    __threadfence();
+    if (threadIdx.x == 0) {
+      const unsigned int prev = atomicAdd(&dev_state->arrive, 1u);
+      if (prev == gridDim.x - 1) {
+        dev_state->arrive = 0;
+        dev_state->done = next + 1;
+        __threadfence_system();
+        ctl->completed = next + 1;  // host-visible
+      }
+    }
+    // the next link may read this link's output, so no block starts it
+    // before the slowest one is done
+    while (dev_state->done <= next) {
+    }
+    __syncthreads();
+    ++next;
+  }
+}
+
+// Host handle for one resident grid. Typical use:
+//
+//   PersistentEltwiseExecutor<float> exec(dev_ctx);
+//   exec.Start();
+//   auto t1 = exec.Enqueue({x, nullptr, tmp, n, T(0),
+//                           static_cast<int>(PersistentEltwiseOp::kRelu)});
+//   auto t2 = exec.Enqueue({tmp, bias, out, n, T(0),
+//                           static_cast<int>(PersistentEltwiseOp::kAdd)});
+//   exec.Wait(t2);
+//   exec.Stop();
+//
+// Enqueue costs two host stores and a fence; descriptors on the same
+// executor execute in order, so chains need no intermediate host syncs.
+template <typename T>
+class PersistentEltwiseExecutor {
+ public:
+  static constexpr int kCapacity = 256;
+
+  explicit PersistentEltwiseExecutor(const phi::GPUContext& dev_ctx)
+      : dev_ctx_(dev_ctx) {
+    pinned_buf_ = memory_utils::Alloc(
+        phi::GPUPinnedPlace(),
+        sizeof(PersistentQueueControl) +
+            sizeof(PersistentEltwiseWork<T>) * kCapacity);
+    ctl_ = reinterpret_cast<PersistentQueueControl*>(pinned_buf_->ptr());
+    ring_ = reinterpret_cast<PersistentEltwiseWork<T>*>(ctl_ + 1);
+    ctl_->doorbell = 0;
+    ctl_->completed = 0;
+    ctl_->stop = 0;
+    dev_state_buf_ = memory_utils::Alloc(
+        dev_ctx.GetPlace(),
+        sizeof(PersistentQueueDeviceState),
+        phi::Stream(reinterpret_cast<phi::StreamId>(dev_ctx.stream())));
+    dev_state_ =
+        reinterpret_cast<PersistentQueueDeviceState*>(dev_state_buf_->ptr());
+    PersistentQueueDeviceState init{0, 0};
+    memory_utils::Copy(dev_ctx.GetPlace(),
+                       dev_state_,
+                       phi::CPUPlace(),
+                       &init,
+                       sizeof(init),
+                       dev_ctx.stream());
+  }
+
+  ~PersistentEltwiseExecutor() {
+    if (started_) {
+      Stop();
+    }
+  }
+
+  PersistentEltwiseExecutor(const PersistentEltwiseExecutor&) = delete;
+  PersistentEltwiseExecutor& operator=(const PersistentEltwiseExecutor&) =
+      delete;
+
+  // The grid must stay small enough to be co-resident, it shares the device
+  // with whatever else the stream runs; a handful of blocks saturates the
+  // small tensors this path is for.
+  void Start(int num_blocks = 8, int block_dim = 256) {
+    PADDLE_ENFORCE_EQ(started_,
+                      false,
+                      errors::PreconditionNotMet(
+                          "PersistentEltwiseExecutor already started."));
+    PersistentEltwiseLoop<T, kCapacity>
+        <<<num_blocks, block_dim, 0, dev_ctx_.stream()>>>(
+            ctl_, ring_, dev_state_);
+    started_ = true;
+  }
+
+  // Publishes one descriptor and returns its ticket. Blocks (on the host)
+  // only when the ring is full.
+  int64_t Enqueue(const PersistentEltwiseWork<T>& work) {
+    PADDLE_ENFORCE_EQ(
+        started_,
+        true,
+        errors::PreconditionNotMet(
+            "PersistentEltwiseExecutor must be started before Enqueue."));
+    const int64_t ticket = next_ticket_++;
+    while (ticket - ctl_->completed >= kCapacity) {
+      // ring full: the grid is still draining older links
+    }
+    ring_[ticket % kCapacity] = work;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    ctl_->doorbell = ticket + 1;
+    return ticket;
+  }
+
+  // Spins until the given ticket (and everything before it) has executed.
+  void Wait(int64_t ticket) const {
+    while (ctl_->completed <= ticket) {
+    }
+  }
+
+  // Retires the resident grid and synchronizes the stream.
+  void Stop() {
+    if (!started_) {
+      return;
+    }
+    Wait(next_ticket_ - 1);
+    ctl_->stop = 1;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    dev_ctx_.Wait();
+    ctl_->stop = 0;
+    started_ = false;
+  }
+
+ private:
+  const phi::GPUContext& dev_ctx_;
+  phi::Allocator::AllocationPtr pinned_buf_;
+  phi::Allocator::AllocationPtr dev_state_buf_;
+  PersistentQueueControl* ctl_{nullptr};
+  PersistentEltwiseWork<T>* ring_{nullptr};
+  PersistentQueueDeviceState* dev_state_{nullptr};
+  int64_t next_ticket_{0};
+  bool started_{false};
+};
+
+}  // namespace funcs
+}  // namespace phi
+
+#endif
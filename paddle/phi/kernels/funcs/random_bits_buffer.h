@@ -0,0 +1,155 @@
+// Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#ifdef PADDLE_WITH_HIP
+#include <hiprand_kernel.h>
+#else
+#include <curand_kernel.h>
+#endif
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/core/generator.h"
+
+namespace phi {
+namespace funcs {
+
+// Batched random-bit generation. Dropout-heavy graphs launch dozens of
+// kernels per step that each run curand_init per thread - roughly as much
+// work as the random draw itself for a Philox state. This buffer pays the
+// init cost once: a single generation kernel fills a device ring of raw
+// uniform bits at the top of the step, and consumer kernels (dropout,
+// random masks) slice ranges out of it instead of seeding their own
+// states.
+//
+// The fill kernel receives (seed, offset) by value, so a CUDA graph that
+// captures Refill replays deterministically from whatever the Generator
+// held at capture time; reproducing a step only needs that pair, which
+// the Generator already tracks.
+
+template <typename WordT>
+__global__ void FillRandomBitsKernel(WordT *out,
+                                     size_t num_words,
+                                     uint64_t seed,
+                                     uint64_t offset) {
+  size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  size_t stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+#ifdef PADDLE_WITH_HIP
+  hiprandStatePhilox4_32_10_t state;
+  hiprand_init(seed, idx, offset, &state);
+#else
+  curandStatePhilox4_32_10_t state;
+  curand_init(seed, idx, offset, &state);
+#endif
+  // one Philox round yields four words; store them as a single 16B vector
+  size_t num_vecs = num_words / 4;
+  uint4 *out4 = reinterpret_cast<uint4 *>(out);
+  for (size_t i = idx; i < num_vecs; i += stride) {
+#ifdef PADDLE_WITH_HIP
+    uint4 bits = hiprand4(&state);
+#else
+    uint4 bits = curand4(&state);
+#endif
+    out4[i] = bits;
+  }
+  if (idx < num_words % 4) {
+#ifdef PADDLE_WITH_HIP
+    out[num_vecs * 4 + idx] = hiprand(&state);
+#else
+    out[num_vecs * 4 + idx] = curand(&state);
+#endif
+  }
+}
+
+// Maps 32 random bits to a uniform float in [0, 1), for consumers that
+// want probabilities rather than raw bits.
+__device__ __forceinline__ float UniformFloatFromBits(uint32_t bits) {
+  return (bits >> 8) * 0x1.0p-24f;
+}
+
+class RandomBitsBuffer {
+ public:
+  // 64 MB of bits; enough for one step of masks over ~16M dropout
+  // elements before consumers fall back to their own states
+  static constexpr size_t kDefaultWords = size_t(1) << 24;
+
+  static RandomBitsBuffer &Instance() {
+    static thread_local RandomBitsBuffer buffer;
+    return buffer;
+  }
+
+  // Starts a new step: draws one (seed, offset) pair from the generator
+  // and launches the single fill kernel. All slices handed out before the
+  // next Refill come from this batch.
+  void Refill(const phi::GPUContext &dev_ctx,
+              size_t capacity_words = kDefaultWords) {
+    if (bits_ == nullptr || capacity_words_ < capacity_words) {
+      bits_ = memory_utils::Alloc(
+          dev_ctx.GetPlace(),
+          capacity_words * sizeof(uint32_t),
+          phi::Stream(reinterpret_cast<phi::StreamId>(dev_ctx.stream())));
+      capacity_words_ = capacity_words;
+    }
+
+    const int block = 256;
+    const int num_sm = dev_ctx.GetSMCount();
+    const int grid = num_sm * 4;
+    const size_t total_threads = static_cast<size_t>(grid) * block;
+    // rounds of four words per thread, same accounting dropout uses when
+    // it advances the generator
+    const uint64_t rounds =
+        (capacity_words_ / 4 + total_threads - 1) / total_threads + 1;
+    auto seed_offset =
+        dev_ctx.GetGenerator()->IncrementOffset(rounds * 4);
+
+    FillRandomBitsKernel<uint32_t><<<grid, block, 0, dev_ctx.stream()>>>(
+        static_cast<uint32_t *>(bits_->ptr()),
+        capacity_words_,
+        seed_offset.first,
+        seed_offset.second);
+    cursor_ = 0;
+  }
+
+  // Hands out num_words of this step's bits. Returns false once the batch
+  // is exhausted; the caller then seeds its own Philox state as before
+  // (or calls Refill when it owns the step boundary).
+  bool Slice(size_t num_words, const uint32_t **out) {
+    if (bits_ == nullptr || cursor_ + num_words > capacity_words_) {
+      return false;
+    }
+    *out = static_cast<const uint32_t *>(bits_->ptr()) + cursor_;
+    cursor_ += num_words;
+    return true;
+  }
+
+  size_t WordsLeft() const {
+    return bits_ == nullptr ? 0 : capacity_words_ - cursor_;
+  }
+
+ private:
+  RandomBitsBuffer() = default;
+
+  phi::Allocator::AllocationPtr bits_;
+  size_t capacity_words_ = 0;
+  size_t cursor_ = 0;
+};
+
+}  // namespace funcs
+}  // namespace phi
+
+#endif
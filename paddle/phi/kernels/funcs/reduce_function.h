@@ -57,6 +57,9 @@ using dim3 = phi::kps::dim3;
 
 #endif
 
+#include <algorithm>
+#include <limits>
+
 #include "paddle/common/array.h"
 #include "paddle/phi/core/dense_tensor.h"
 #include "paddle/phi/core/enforce.h"
@@ -64,6 +67,7 @@ using dim3 = phi::kps::dim3;
 #include "paddle/phi/kernels/funcs/eigen/common.h"
 #include "paddle/phi/kernels/funcs/eigen/eigen_function.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
+#include "paddle/phi/kernels/funcs/reduce_functor.h"
 namespace phi {
 namespace funcs {
 
@@ -1348,6 +1352,151 @@ void HandleLargeDim(const Context& dev_ctx,
   output->ResizeAndAllocate(output_dim);
 }
 
+//////////////// Native CPU reduction
+
+// Scalar accumulation rules for the reductions that run through the native
+// CPU path. Functors without a specialization (All/Any and anything custom)
+// keep the Eigen route.
+template <typename OutT, typename Functor>
+struct NativeReduceOp {
+  static constexpr bool kUseNative = false;
+};
+
+template <typename OutT>
+struct NativeReduceOp<OutT, SumFunctor> {
+  static constexpr bool kUseNative = true;
+  static OutT Init() { return static_cast<OutT>(0); }
+  static OutT Apply(OutT a, OutT b) { return a + b; }
+  static OutT Finalize(OutT acc, int64_t) { return acc; }
+};
+
+template <typename OutT>
+struct NativeReduceOp<OutT, MeanFunctor> {
+  static constexpr bool kUseNative = true;
+  static OutT Init() { return static_cast<OutT>(0); }
+  static OutT Apply(OutT a, OutT b) { return a + b; }
+  static OutT Finalize(OutT acc, int64_t n) {
+    return acc / static_cast<OutT>(n);
+  }
+};
+
+template <typename OutT>
+struct NativeReduceOp<OutT, ProdFunctor> {
+  static constexpr bool kUseNative = true;
+  static OutT Init() { return static_cast<OutT>(1); }
+  static OutT Apply(OutT a, OutT b) { return a * b; }
+  static OutT Finalize(OutT acc, int64_t) { return acc; }
+};
+
+template <typename OutT>
+struct NativeReduceOp<OutT, MaxFunctor> {
+  static constexpr bool kUseNative = true;
+  static OutT Init() { return std::numeric_limits<OutT>::lowest(); }
+  static OutT Apply(OutT a, OutT b) { return a > b ? a : b; }
+  static OutT Finalize(OutT acc, int64_t) { return acc; }
+};
+
+template <typename OutT>
+struct NativeReduceOp<OutT, MinFunctor> {
+  static constexpr bool kUseNative = true;
+  static OutT Init() { return std::numeric_limits<OutT>::max(); }
+  static OutT Apply(OutT a, OutT b) { return a < b ? a : b; }
+  static OutT Finalize(OutT acc, int64_t) { return acc; }
+};
+
+// Reductions over a contiguous run of trailing or leading dims collapse to a
+// 2D problem, the same layout split the GPU side makes between its any-dim
+// and higher-dim kernels. Trailing runs become per-row reductions spread
+// over threads with an unrolled (vectorizable) inner walk; leading runs
+// accumulate into output blocks so the inner loop stays contiguous. Eigen
+// evaluates these shapes on a single thread, which starves the
+// short-but-many case (e.g. [100k, 64] row sums). Scattered or middle-dim
+// reductions return false and fall through.
+template <typename OutT, typename Functor>
+bool TryNativeReduceCPU(const phi::DenseTensor& input,
+                        phi::DenseTensor* output,
+                        const std::vector<int64_t>& dims) {
+  using Op = NativeReduceOp<OutT, Functor>;
+  if constexpr (!Op::kUseNative || !std::is_arithmetic<OutT>::value ||
+                std::is_same<OutT, bool>::value) {
+    return false;
+  } else {
+    const int ndim = input.dims().size();
+    const int rdim = static_cast<int>(dims.size());
+    if (rdim < 1 || rdim > ndim) {
+      return false;
+    }
+    std::vector<int> rdims(dims.begin(), dims.end());
+    for (auto& d : rdims) {
+      if (d < 0) d += ndim;
+    }
+    std::sort(rdims.begin(), rdims.end());
+    for (int i = 1; i < rdim; ++i) {
+      if (rdims[i] != rdims[i - 1] + 1) {
+        return false;
+      }
+    }
+    int64_t reduce_n = 1;
+    for (int d : rdims) {
+      reduce_n *= input.dims()[d];
+    }
+    const int64_t kept = input.numel() / reduce_n;
+    const OutT* in = input.data<OutT>();
+    OutT* out = output->data<OutT>();
+
+    if (rdims.back() == ndim - 1) {
+      // row reductions: four accumulators break the serial dependence so
+      // the compiler can keep vector lanes busy
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for if (kept > 1)
+#endif
+      for (int64_t i = 0; i < kept; ++i) {
+        const OutT* row = in + i * reduce_n;
+        OutT a0 = Op::Init(), a1 = Op::Init(), a2 = Op::Init(),
+             a3 = Op::Init();
+        int64_t j = 0;
+        for (; j + 4 <= reduce_n; j += 4) {
+          a0 = Op::Apply(a0, row[j]);
+          a1 = Op::Apply(a1, row[j + 1]);
+          a2 = Op::Apply(a2, row[j + 2]);
+          a3 = Op::Apply(a3, row[j + 3]);
+        }
+        OutT acc = Op::Apply(Op::Apply(a0, a1), Op::Apply(a2, a3));
+        for (; j < reduce_n; ++j) {
+          acc = Op::Apply(acc, row[j]);
+        }
+        out[i] = Op::Finalize(acc, reduce_n);
+      }
+      return true;
+    }
+    if (rdims.front() == 0) {
+      // column reductions: each thread owns a block of output columns and
+      // streams the input rows through it, so every access is contiguous
+      constexpr int64_t kBlock = 1024;
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for if (kept > kBlock)
+#endif
+      for (int64_t jb = 0; jb < kept; jb += kBlock) {
+        const int64_t je = std::min(jb + kBlock, kept);
+        for (int64_t j = jb; j < je; ++j) {
+          out[j] = Op::Init();
+        }
+        for (int64_t i = 0; i < reduce_n; ++i) {
+          const OutT* src = in + i * kept;
+          for (int64_t j = jb; j < je; ++j) {
+            out[j] = Op::Apply(out[j], src[j]);
+          }
+        }
+        for (int64_t j = jb; j < je; ++j) {
+          out[j] = Op::Finalize(out[j], reduce_n);
+        }
+      }
+      return true;
+    }
+    return false;
+  }
+}
+
 ////////////// ReduceKernel
 
 template <typename Context, typename T, typename OutT, typename Functor>
@@ -1374,6 +1523,9 @@ void ReduceKernelImpl(const Context& dev_ctx,
     Functor functor;
     functor(dev, &x, &out, reduce_dim);
   } else {
+    if (TryNativeReduceCPU<OutT, Functor>(input, output, dims)) {
+      return;
+    }
     int ndim = input.dims().size();
     int rdim = dims.size();
     if (ndim > 6) {
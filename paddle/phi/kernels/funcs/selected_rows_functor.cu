@@ -12,14 +12,23 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License. */
 
+#include <algorithm>
 #include <set>
 #include <vector>
 
 #include "glog/logging.h"
 
+#ifdef PADDLE_WITH_HIP
+#include <hipcub/hipcub.hpp>
+namespace cub = hipcub;
+#else
+#include <cub/cub.cuh>
+#endif
+
 #include "paddle/phi/backends/gpu/gpu_primitives.h"
 #include "paddle/phi/common/bfloat16.h"
 #include "paddle/phi/common/float16.h"
+#include "paddle/phi/common/memory_utils.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
 #include "paddle/phi/kernels/funcs/selected_rows_functor.h"
 
@@ -191,11 +200,10 @@ struct SelectedRowsAddTensor<phi::GPUContext, T> {
     const int block_size = 256;
     dim3 threads(block_size, 1);
     dim3 grid(in1_rows.size(), 1);
-    phi::MixVector<int64_t> mixv_in1_rows(&in1_rows);
     SelectedRowsAddTensorKernel<T, block_size>
         <<<grid, threads, 0, context.stream()>>>(
             in1_data,
-            mixv_in1_rows.CUDAData(context.GetPlace()),
+            input1.DeviceRows(context.GetPlace()),
             out_data,
             in1_row_numel);
 
@@ -233,9 +241,8 @@ struct SelectedRowsAddTo<phi::GPUContext, T> {
     auto* in2_value = input2->mutable_value();
 
     // concat rows
-    phi::MixVector<int64_t> mixv_in2_rows(&in2_rows);
     if (in1_rows.size()) {
-      mixv_in2_rows.Extend(in1_rows.begin(), in1_rows.end());
+      in2_rows.insert(in2_rows.end(), in1_rows.begin(), in1_rows.end());
     }
 
     auto in1_place = input1.place();
@@ -320,11 +327,10 @@ struct SelectedRowsAddToTensor<phi::GPUContext, T> {
     const int block_size = 256;
     dim3 threads(block_size, 1);
     dim3 grid(in1_rows.size(), 1);
-    phi::MixVector<int64_t> mixv_in1_rows(&in1_rows);
     SelectedRowsAddToTensorKernel<T, block_size>
         <<<grid, threads, 0, context.stream()>>>(
             in1_data,
-            mixv_in1_rows.CUDAData(context.GetPlace()),
+            input1.DeviceRows(context.GetPlace()),
             in2_data,
             in1_row_numel);
   }
@@ -370,6 +376,68 @@ __global__ void MergeAddKernel(const T* input,
   }
 }
 
+__global__ void InitIndexKernel(const int64_t n, int64_t* index) {
+  for (int64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n;
+       i += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    index[i] = i;
+  }
+}
+
+// Marks the first occurrence of each id in the sorted id list.
+__global__ void MarkRowHeadsKernel(const int64_t* sorted_rows,
+                                   const int64_t n,
+                                   int64_t* head_flags) {
+  for (int64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n;
+       i += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    head_flags[i] = (i == 0 || sorted_rows[i] != sorted_rows[i - 1]) ? 1 : 0;
+  }
+}
+
+// ranks is the inclusive prefix sum of head_flags, i.e. the 1-based
+// output slot of each sorted entry. Emits the unique ids and the begin
+// offset of each duplicate run; unique_offsets gets n appended so that
+// [unique_offsets[u], unique_offsets[u + 1]) is the run of slot u.
+__global__ void BuildUniqueRowsKernel(const int64_t* sorted_rows,
+                                      const int64_t* head_flags,
+                                      const int64_t* ranks,
+                                      const int64_t n,
+                                      int64_t* unique_rows,
+                                      int64_t* unique_offsets) {
+  for (int64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n;
+       i += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    if (head_flags[i] != 0) {
+      unique_rows[ranks[i] - 1] = sorted_rows[i];
+      unique_offsets[ranks[i] - 1] = i;
+    }
+    if (i == n - 1) {
+      unique_offsets[ranks[i]] = n;
+    }
+  }
+}
+
+// One block per unique row: sums its duplicate input rows into the
+// output row. No atomics, so the result is deterministic, and the
+// column-per-thread mapping keeps reads and writes coalesced.
+template <typename T>
+__global__ void GatherAddRowsKernel(const T* input,
+                                    const int64_t* sorted_idx,
+                                    const int64_t* unique_offsets,
+                                    const int64_t num_unique,
+                                    const int64_t row_numel,
+                                    T* out) {
+  for (int64_t u = blockIdx.x; u < num_unique; u += gridDim.x) {
+    const int64_t begin = unique_offsets[u];
+    const int64_t end = unique_offsets[u + 1];
+    for (int64_t col = threadIdx.x; col < row_numel; col += blockDim.x) {
+      T sum = static_cast<T>(0);
+      for (int64_t j = begin; j < end; ++j) {
+        sum += input[sorted_idx[j] * row_numel + col];
+      }
+      out[u * row_numel + col] = sum;
+    }
+  }
+}
+
 template <typename DeviceContext, typename T>
 struct MergeAddImpl {
   phi::SelectedRows operator()(const DeviceContext& context,
@@ -384,45 +452,121 @@ struct MergeAddImpl {
                   const phi::SelectedRows& input,
                   phi::SelectedRows* output,
                   const bool sorted_result = false) {
-    phi::Vector<int64_t> input_rows(input.rows());
+    auto& input_rows = input.rows();
     if (input_rows.size() == 0) {
       return;
     }
 
+    // Dedup on device instead of through a host std::set: sort (id,
+    // index) pairs, mark first occurrences, and prefix-sum the marks
+    // into output slots. The merge itself then reduces each duplicate
+    // run directly, instead of the former one-thread linear search per
+    // input row, which does not scale to large id batches.
     phi::SelectedRows& out = *output;
-    std::set<int64_t> row_set(input_rows.begin(), input_rows.end());
-    std::vector<int64_t> merge_rows_cpu(row_set.begin(), row_set.end());
-    phi::Vector<int64_t> merge_rows(merge_rows_cpu);
+    const int64_t n = static_cast<int64_t>(input_rows.size());
+    const int64_t input_width = input.value().dims()[1];
+    const auto& place = context.GetPlace();
+    auto stream = context.stream();
+
+    const int64_t* rows_ptr = input.DeviceRows(place);
+
+    DenseTensor idx_in_t, sorted_rows_t, sorted_idx_t, head_t, ranks_t;
+    DenseTensor unique_rows_t, unique_offsets_t;
+    idx_in_t.Resize({n});
+    sorted_rows_t.Resize({n});
+    sorted_idx_t.Resize({n});
+    head_t.Resize({n});
+    ranks_t.Resize({n});
+    unique_rows_t.Resize({n});
+    unique_offsets_t.Resize({n + 1});
+    int64_t* idx_in = context.template Alloc<int64_t>(&idx_in_t);
+    int64_t* sorted_rows = context.template Alloc<int64_t>(&sorted_rows_t);
+    int64_t* sorted_idx = context.template Alloc<int64_t>(&sorted_idx_t);
+    int64_t* head_flags = context.template Alloc<int64_t>(&head_t);
+    int64_t* ranks = context.template Alloc<int64_t>(&ranks_t);
+    int64_t* unique_rows = context.template Alloc<int64_t>(&unique_rows_t);
+    int64_t* unique_offsets =
+        context.template Alloc<int64_t>(&unique_offsets_t);
 
-    auto input_width = input.value().dims()[1];
+    const int block_size = 256;
+    const int64_t max_blocks =
+        static_cast<int64_t>(context.GetCUDAMaxGridDimSize()[0]);
+    const int64_t num_blocks =
+        std::min((n + block_size - 1) / block_size, max_blocks);
+    InitIndexKernel<<<num_blocks, block_size, 0, stream>>>(n, idx_in);
+
+    size_t sort_bytes = 0;
+    cub::DeviceRadixSort::SortPairs<int64_t, int64_t>(nullptr,
+                                                      sort_bytes,
+                                                      rows_ptr,
+                                                      sorted_rows,
+                                                      idx_in,
+                                                      sorted_idx,
+                                                      n,
+                                                      0,
+                                                      sizeof(int64_t) * 8,
+                                                      stream);
+    auto sort_temp = phi::memory_utils::Alloc(place, sort_bytes);
+    cub::DeviceRadixSort::SortPairs<int64_t, int64_t>(sort_temp->ptr(),
+                                                      sort_bytes,
+                                                      rows_ptr,
+                                                      sorted_rows,
+                                                      idx_in,
+                                                      sorted_idx,
+                                                      n,
+                                                      0,
+                                                      sizeof(int64_t) * 8,
+                                                      stream);
+
+    MarkRowHeadsKernel<<<num_blocks, block_size, 0, stream>>>(
+        sorted_rows, n, head_flags);
+
+    size_t scan_bytes = 0;
+    cub::DeviceScan::InclusiveSum(
+        nullptr, scan_bytes, head_flags, ranks, n, stream);
+    auto scan_temp = phi::memory_utils::Alloc(place, scan_bytes);
+    cub::DeviceScan::InclusiveSum(
+        scan_temp->ptr(), scan_bytes, head_flags, ranks, n, stream);
+
+    BuildUniqueRowsKernel<<<num_blocks, block_size, 0, stream>>>(
+        sorted_rows, head_flags, ranks, n, unique_rows, unique_offsets);
+
+    int64_t num_unique = 0;
+    memory_utils::Copy(phi::CPUPlace(),
+                       &num_unique,
+                       place,
+                       ranks + n - 1,
+                       sizeof(int64_t),
+                       stream);
+    context.Wait();
+
+    std::vector<int64_t> merge_rows_cpu(num_unique);
+    memory_utils::Copy(phi::CPUPlace(),
+                       merge_rows_cpu.data(),
+                       place,
+                       unique_rows,
+                       num_unique * sizeof(int64_t),
+                       stream);
+    context.Wait();
+    phi::Vector<int64_t> merge_rows(merge_rows_cpu);
 
     out.set_rows(merge_rows);
     out.set_height(input.height());
     DenseTensor* out_tensor = out.mutable_value();
-    out_tensor->Resize(common::make_ddim(
-        {static_cast<int64_t>(merge_rows.size()), input_width}));
+    out_tensor->Resize(common::make_ddim({num_unique, input_width}));
     context.template Alloc<T>(out_tensor);
 
-    phi::funcs::SetConstant<DeviceContext, T> constant_functor;
-    constant_functor(context, out.mutable_value(), static_cast<T>(0));
-
     auto* out_data = out.mutable_value()->data<T>();
     auto* input_data = input.value().data<T>();
 
-    const int block_size = 256;
-    dim3 threads(block_size, 1);
-    dim3 grid1(input_rows.size(), 1);
-
-    phi::MixVector<int64_t> mix_vector_input(&input_rows);
-    phi::MixVector<int64_t> mix_vector_out(out.mutable_rows());
-    MergeAddKernel<T, 256><<<grid1, threads, 0, context.stream()>>>(
-        input_data,
-        mix_vector_input.CUDAData(context.GetPlace()),
-        out_data,
-        mix_vector_out.CUDAMutableData(context.GetPlace()),
-        out.rows().size(),
-        input_width);
-    mix_vector_out.CopyToCPU();
+    const int64_t merge_blocks = std::min(num_unique, max_blocks);
+    GatherAddRowsKernel<T>
+        <<<merge_blocks, block_size, 0, stream>>>(input_data,
+                                                  sorted_idx,
+                                                  unique_offsets,
+                                                  num_unique,
+                                                  input_width,
+                                                  out_data);
   }
 
   void operator()(const DeviceContext& context,
@@ -491,16 +635,13 @@ struct MergeAddImpl {
       auto& input_rows = input->rows();
       dim3 grid1(input_rows.size(), 1);
 
-      phi::MixVector<int64_t> mix_vector_input(&input_rows);
-      phi::MixVector<int64_t> mix_vector_out(out.mutable_rows());
       MergeAddKernel<T, 256><<<grid1, threads, 0, context.stream()>>>(
           input_data,
-          mix_vector_input.CUDAData(context.GetPlace()),
+          input->DeviceRows(context.GetPlace()),
           out_data,
-          mix_vector_out.CUDAMutableData(context.GetPlace()),
+          out.DeviceRows(context.GetPlace()),
           out.rows().size(),
           input_width);
-      mix_vector_out.CopyToCPU();
     }
   }
 };
@@ -247,30 +247,41 @@ class SoftmaxFunctor<DeviceContext, T, enable_if_CPU<DeviceContext>> {
 
     if (num_remain == 1 &&
         phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
-      const T* in_data = X->data<T>();
-      T* out_data = Y->data<T>();
-      for (int bs = 0; bs < batch_size; ++bs) {
-        T max_val = *std::max_element(in_data, in_data + num_classes);
-        max_val *= static_cast<T>(-1);
-        vec_add_bias<T, phi::backends::cpu::avx>(
-            num_classes, max_val, in_data, out_data);
-        vec_clip<T, phi::backends::cpu::avx>(
-            num_classes, static_cast<T>(-64), out_data, out_data);
-        vec_exp<T>(num_classes, out_data, out_data);
-
-        T sum = 0;
-        vec_sum<T, phi::backends::cpu::avx>(num_classes, out_data, &sum);
-        sum = static_cast<T>(1) / sum;
-        vec_scal<T, phi::backends::cpu::avx>(
-            num_classes, sum, out_data, out_data);
-
-        in_data += num_classes;
-        out_data += num_classes;
+      // pick the widest ISA tier the host supports once per tensor
+      if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx512f)) {
+        RunVec<phi::backends::cpu::avx512f>(
+            X->data<T>(), Y->data<T>(), batch_size, num_classes);
+      } else {
+        RunVec<phi::backends::cpu::avx>(
+            X->data<T>(), Y->data<T>(), batch_size, num_classes);
       }
     } else {
       SoftmaxEigen<DeviceContext, T>()(context, axis_dim, X, Y);
     }
   }
+
+ private:
+  template <phi::backends::cpu::cpu_isa_t isa>
+  void RunVec(const T* in_data,
+              T* out_data,
+              const int batch_size,
+              const int num_classes) {
+    for (int bs = 0; bs < batch_size; ++bs) {
+      T max_val = *std::max_element(in_data, in_data + num_classes);
+      max_val *= static_cast<T>(-1);
+      vec_add_bias<T, isa>(num_classes, max_val, in_data, out_data);
+      vec_clip<T, isa>(num_classes, static_cast<T>(-64), out_data, out_data);
+      vec_exp<T>(num_classes, out_data, out_data);
+
+      T sum = 0;
+      vec_sum<T, isa>(num_classes, out_data, &sum);
+      sum = static_cast<T>(1) / sum;
+      vec_scal<T, isa>(num_classes, sum, out_data, out_data);
+
+      in_data += num_classes;
+      out_data += num_classes;
+    }
+  }
 };
 
 template <typename DeviceContext, typename T>
@@ -403,27 +414,43 @@ class SoftmaxGradFunctor<DeviceContext, T, enable_if_CPU<DeviceContext>> {
 
     if (num_remain == 1 &&
         phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
-      const T* out_data = y->data<T>();
-      const T* out_grad = y_grad->data<T>();
-      T* in_grad = x_grad->data<T>();
-      for (int bs = 0; bs < batch_size; ++bs) {
-        T scalar;
-        vec_mul_reduce<T, phi::backends::cpu::avx>(
-            num_classes, out_grad, out_data, &scalar);
-        scalar *= static_cast<T>(-1);
-        vec_add_bias<T, phi::backends::cpu::avx>(
-            num_classes, scalar, out_grad, in_grad);
-        vec_mul<T, phi::backends::cpu::avx>(
-            num_classes, out_data, in_grad, in_grad);
-        out_data += num_classes;
-        out_grad += num_classes;
-        in_grad += num_classes;
+      if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx512f)) {
+        RunVec<phi::backends::cpu::avx512f>(y->data<T>(),
+                                            y_grad->data<T>(),
+                                            x_grad->data<T>(),
+                                            batch_size,
+                                            num_classes);
+      } else {
+        RunVec<phi::backends::cpu::avx>(y->data<T>(),
+                                        y_grad->data<T>(),
+                                        x_grad->data<T>(),
+                                        batch_size,
+                                        num_classes);
       }
     } else {
       SoftmaxGradEigen<DeviceContext, T>()(
           context, axis_dim, y, y_grad, x_grad);
     }
   }
+
+ private:
+  template <phi::backends::cpu::cpu_isa_t isa>
+  void RunVec(const T* out_data,
+              const T* out_grad,
+              T* in_grad,
+              const int batch_size,
+              const int num_classes) {
+    for (int bs = 0; bs < batch_size; ++bs) {
+      T scalar;
+      vec_mul_reduce<T, isa>(num_classes, out_grad, out_data, &scalar);
+      scalar *= static_cast<T>(-1);
+      vec_add_bias<T, isa>(num_classes, scalar, out_grad, in_grad);
+      vec_mul<T, isa>(num_classes, out_data, in_grad, in_grad);
+      out_data += num_classes;
+      out_grad += num_classes;
+      in_grad += num_classes;
+    }
+  }
 };
 
 }  // namespace funcs
@@ -921,66 +921,93 @@ __global__ void RadixTopK(const T* input,
                           int64_t* indices) {
   __shared__ int shared_mem[32];
 
-  // 1. Find the k-th value
-  T kth_value = static_cast<T>(0);
-  RadixSearch<T, typename RadixTypeConfig<T>::RadixType, Largest>(
-      input, k, slice_size, shared_mem, &kth_value);
-  const auto converted_kth_value = RadixTypeConfig<T>::Convert(kth_value);
-
-  // 2. Select the value strictly less/greater than kth_value and their indices
-  int block_dim = static_cast<int>(blockDim.x);
-  int loop = ((slice_size + block_dim - 1) / block_dim * block_dim);
-  int write_start = 0;
+  // one block per slice; grid-stride so row counts beyond the launch grid
+  // are still covered
+  for (int row = blockIdx.x; row < slice_num; row += gridDim.x) {
+    const T* slice_input = input + static_cast<int64_t>(row) * slice_size;
+    T* slice_output = output + static_cast<int64_t>(row) * k;
+    int64_t* slice_indices = indices + static_cast<int64_t>(row) * k;
+
+    // 1. Find the k-th value
+    T kth_value = static_cast<T>(0);
+    RadixSearch<T, typename RadixTypeConfig<T>::RadixType, Largest>(
+        slice_input, k, slice_size, shared_mem, &kth_value);
+    const auto converted_kth_value = RadixTypeConfig<T>::Convert(kth_value);
+
+    // 2. Select the value strictly less/greater than kth_value and their
+    // indices
+    int block_dim = static_cast<int>(blockDim.x);
+    int loop = ((slice_size + block_dim - 1) / block_dim * block_dim);
+    int write_start = 0;
+
+    for (int i = threadIdx.x; i < loop; i += blockDim.x) {
+      bool valid = i < slice_size;
+      T v = valid ? slice_input[i] : static_cast<T>(0);
+      const auto convertd_v = RadixTypeConfig<T>::Convert(v);
+      bool is_top_k;
+      if (Largest) {
+        is_top_k = valid && (convertd_v > converted_kth_value);
+      } else {
+        is_top_k = valid && (convertd_v < converted_kth_value);
+      }
 
-  for (int i = threadIdx.x; i < loop; i += blockDim.x) {
-    bool valid = i < slice_size;
-    T v = valid ? input[i] : static_cast<T>(0);
-    const auto convertd_v = RadixTypeConfig<T>::Convert(v);
-    bool is_top_k;
-    if (Largest) {
-      is_top_k = valid && (convertd_v > converted_kth_value);
-    } else {
-      is_top_k = valid && (convertd_v < converted_kth_value);
+      int index;
+      int carry;
+      ExclusiveBinaryPrefixScan<int, true, kps::AddFunctor<int>>(
+          shared_mem, is_top_k, &index, &carry, kps::AddFunctor<int>());
+      if (is_top_k) {
+        int write_index = write_start + index;
+        slice_output[write_index] = v;
+        slice_indices[write_index] = i;
+      }
+      write_start += carry;
     }
 
-    int index;
-    int carry;
-    ExclusiveBinaryPrefixScan<int, true, kps::AddFunctor<int>>(
-        shared_mem, is_top_k, &index, &carry, kps::AddFunctor<int>());
-    if (is_top_k) {
-      int write_index = write_start + index;
-      output[write_index] = v;
-      indices[write_index] = i;
-    }
-    write_start += carry;
-  }
+    // 3. Fill the rest with value == kth_value
+    assert(k >= write_start);
+    int remain = k - write_start;
+    for (int i = threadIdx.x; i < loop; i += blockDim.x) {
+      bool valid = i < slice_size;
+      T v = valid ? slice_input[i] : static_cast<T>(0);
+      const auto convertd_v = RadixTypeConfig<T>::Convert(v);
+      bool is_top_k = valid && (convertd_v == converted_kth_value);
+
+      int index;
+      int carry;
+      ExclusiveBinaryPrefixScan<int, true, kps::AddFunctor<int>>(
+          shared_mem, is_top_k, &index, &carry, kps::AddFunctor<int>());
+      if (is_top_k && index < remain) {
+        int write_index = write_start + index;
+        assert(write_index < k);
+        slice_output[write_index] = v;
+        slice_indices[write_index] = i;
+      }
 
-  // 3. Fill the rest with value == kth_value
-  assert(k >= write_start);
-  int remain = k - write_start;
-  for (int i = threadIdx.x; i < loop; i += blockDim.x) {
-    bool valid = i < slice_size;
-    T v = valid ? input[i] : static_cast<T>(0);
-    const auto convertd_v = RadixTypeConfig<T>::Convert(v);
-    bool is_top_k = valid && (convertd_v == converted_kth_value);
-
-    int index;
-    int carry;
-    ExclusiveBinaryPrefixScan<int, true, kps::AddFunctor<int>>(
-        shared_mem, is_top_k, &index, &carry, kps::AddFunctor<int>());
-    if (is_top_k && index < remain) {
-      int write_index = write_start + index;
-      assert(write_index < k);
-      output[write_index] = v;
-      indices[write_index] = i;
-    }
+      if (carry >= remain) {
+        break;
+      }
 
-    if (carry >= remain) {
-      break;
+      remain -= carry;
+      write_start += carry;
     }
+    // shared_mem is recycled by the next row's radix search
+    __syncthreads();
+  }
+}
 
-    remain -= carry;
-    write_start += carry;
+// Remaps the per-row positions produced by sorting a gathered top-k batch
+// back into the original column indices: dst[row][j] =
+// src[row][pos[row][j]].
+template <typename IndT>
+__global__ void GatherTopkRowWise(const IndT* src,
+                                  const IndT* pos,
+                                  IndT* dst,
+                                  int64_t num_rows,
+                                  int64_t k) {
+  int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i < num_rows * k) {
+    int64_t row = i / k;
+    dst[i] = src[row * k + pos[i]];
   }
 }
 #endif
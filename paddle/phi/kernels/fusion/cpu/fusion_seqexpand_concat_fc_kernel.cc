@@ -100,7 +100,10 @@ void FusionSeqExpandConcatFCKernel(const Context& dev_ctx,
   fc_out->Resize({N, D});
 
   std::function<void(const int, const T*, T*)> fc_act;
-  if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
+  if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx512f)) {
+    phi::funcs::VecActivations<T, phi::backends::cpu::avx512f> act_functor;
+    fc_act = act_functor(fc_activation);
+  } else if (phi::backends::cpu::MayIUse(phi::backends::cpu::avx)) {
     phi::funcs::VecActivations<T, phi::backends::cpu::avx> act_functor;
     fc_act = act_functor(fc_activation);
   } else {
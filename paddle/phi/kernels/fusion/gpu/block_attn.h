@@ -1391,8 +1391,22 @@ void dispatch_blha_impl_key_and_thread(const Block_AttN_params<T> &params,
                                        LoadFunc load_func,
                                        StoreFunc store_func,
                                        const int use_cachekv_int8) {
-  dispatch_blha_impl<T, Dh, Dh_MAX, BlockSize, 4, 256>(
-      params, stream, load_func, store_func, use_cachekv_int8);
+  // Size the block by context length, like fmha_launch_kernel does for the
+  // contiguous-cache path. Early decode steps have almost no keys to scan,
+  // and a 256-thread block per (head, batch) pair leaves most of each SM
+  // idle at small batch sizes; a 64-thread block lets several heads share
+  // one SM. Very long contexts flip the other way: give each thread a whole
+  // key so one block iteration covers 4x more timesteps.
+  if (params.timestep < 32) {
+    dispatch_blha_impl<T, Dh, Dh_MAX, BlockSize, 4, 64>(
+        params, stream, load_func, store_func, use_cachekv_int8);
+  } else if (params.timestep < 2048) {
+    dispatch_blha_impl<T, Dh, Dh_MAX, BlockSize, 4, 256>(
+        params, stream, load_func, store_func, use_cachekv_int8);
+  } else {
+    dispatch_blha_impl<T, Dh, Dh_MAX, BlockSize, 1, 256>(
+        params, stream, load_func, store_func, use_cachekv_int8);
+  }
 }
 
 template <typename T, int Dh, int Dh_MAX, typename LoadFunc, typename StoreFunc>
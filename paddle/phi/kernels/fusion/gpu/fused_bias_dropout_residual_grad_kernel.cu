@@ -0,0 +1,93 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/backends/gpu/gpu_device_function.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/fusion/gpu/fused_dropout_helper.h"
+
+namespace phi {
+namespace fusion {
+
+template <typename T, typename Context>
+void FusedBiasDropoutResidualGradKernel(
+    const Context& dev_ctx,
+    const paddle::optional<DenseTensor>& bias,
+    const DenseTensor& dropout_mask_out,
+    const DenseTensor& y_grad,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    DenseTensor* x_grad,
+    DenseTensor* residual_grad,
+    DenseTensor* bias_grad) {
+  auto* d_y_data = y_grad.data<T>();
+  auto* dropout_mask_out_data = dropout_mask_out.data<uint8_t>();
+  auto* d_x_data =
+      dev_ctx.template Alloc<T>(x_grad, x_grad->numel() * sizeof(T));
+  auto* d_residual_data =
+      (residual_grad == nullptr
+           ? nullptr
+           : dev_ctx.template Alloc<T>(residual_grad,
+                                       residual_grad->numel() * sizeof(T)));
+  auto* d_bias_data =
+      (bias_grad == nullptr ? nullptr
+                            : dev_ctx.template Alloc<T>(
+                                  bias_grad, bias_grad->numel() * sizeof(T)));
+
+  const auto input_dims = y_grad.dims();
+  int bsz_seq = 1;
+  for (int i = 0; i < input_dims.size() - 1; i++) {
+    bsz_seq *= input_dims[i];
+  }
+  int dim_embed = input_dims[input_dims.size() - 1];
+  phi::fusion::DropoutParam dropout_param(
+      dropout_fix_seed,
+      0,
+      is_test,
+      dropout_implementation == "upscale_in_train",
+      dropout_rate,
+      nullptr,
+      dropout_seed);
+  phi::fusion::FusedDropoutHelper<T, uint8_t> fused_dropout_helper(
+      dev_ctx, bsz_seq, dim_embed, dropout_param);
+  // d_x = mask * d_y (rescaled), d_residual = d_y, d_bias = sum_rows(d_x)
+  fused_dropout_helper.ResidualDropoutBiasGrad(dev_ctx,
+                                               d_y_data,
+                                               dropout_mask_out_data,
+                                               d_x_data,
+                                               d_residual_data,
+                                               d_bias_data);
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+#ifdef PADDLE_WITH_HIP
+PD_REGISTER_KERNEL(fused_bias_dropout_residual_grad,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedBiasDropoutResidualGradKernel,
+                   float,
+                   phi::dtype::float16) {}
+#else
+PD_REGISTER_KERNEL(fused_bias_dropout_residual_grad,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedBiasDropoutResidualGradKernel,
+                   float,
+                   double,
+                   phi::dtype::float16) {}
+#endif
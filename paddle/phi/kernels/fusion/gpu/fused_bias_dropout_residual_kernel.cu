@@ -0,0 +1,93 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/backends/gpu/gpu_device_function.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/fusion/gpu/fused_dropout_helper.h"
+
+namespace phi {
+namespace fusion {
+
+template <typename T, typename Context>
+void FusedBiasDropoutResidualKernel(
+    const Context& dev_ctx,
+    const DenseTensor& x,
+    const DenseTensor& residual,
+    const paddle::optional<DenseTensor>& bias,
+    const float dropout_rate,
+    const bool is_test,
+    const bool dropout_fix_seed,
+    const int dropout_seed,
+    const std::string& dropout_implementation,
+    DenseTensor* y,
+    DenseTensor* dropout_mask_out) {
+  auto* x_data = x.data<T>();
+  auto* bias_data = (bias.get_ptr() == nullptr) ? nullptr : bias->data<T>();
+  auto* residual_data = residual.data<T>();
+  auto* y_data = dev_ctx.template Alloc<T>(y, y->numel() * sizeof(T));
+  auto* dropout_mask_out_data =
+      (dropout_mask_out == nullptr)
+          ? nullptr
+          : dev_ctx.template Alloc<uint8_t>(
+                dropout_mask_out, dropout_mask_out->numel() * sizeof(uint8_t));
+
+  const auto input_x_dims = x.dims();
+  int bsz_seq = 1;
+  for (int i = 0; i < input_x_dims.size() - 1; i++) {
+    bsz_seq *= input_x_dims[i];
+  }
+  int dim_embed = input_x_dims[input_x_dims.size() - 1];
+  phi::fusion::DropoutParam dropout_param(
+      dropout_fix_seed,
+      0,
+      is_test,
+      dropout_implementation == "upscale_in_train",
+      dropout_rate,
+      nullptr,
+      dropout_seed);
+  phi::fusion::FusedDropoutHelper<T, uint8_t> fused_dropout_helper(
+      dev_ctx, bsz_seq, dim_embed, dropout_param);
+  // y = residual + dropout(x + bias); the mask is drawn inline from the
+  // Philox stream and kept as one uint8 per element for the backward.
+  fused_dropout_helper.ResidualDropoutBias(dev_ctx,
+                                           x_data,
+                                           residual_data,
+                                           bias_data,
+                                           y_data,
+                                           dropout_mask_out_data);
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+#ifdef PADDLE_WITH_HIP
+PD_REGISTER_KERNEL(fused_bias_dropout_residual,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedBiasDropoutResidualKernel,
+                   float,
+                   phi::dtype::float16) {
+  kernel->OutputAt(1).SetDataType(phi::DataType::UINT8);
+}
+#else
+PD_REGISTER_KERNEL(fused_bias_dropout_residual,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedBiasDropoutResidualKernel,
+                   float,
+                   double,
+                   phi::dtype::float16) {
+  kernel->OutputAt(1).SetDataType(phi::DataType::UINT8);
+}
+#endif
@@ -23,6 +23,8 @@
 #include "paddle/phi/kernels/expand_kernel.h"
 #include "paddle/phi/kernels/gpudnn/mha_cudnn_frontend.h"
 
+COMMON_DECLARE_bool(cudnn_deterministic);
+
 namespace phi {
 namespace fusion {
 
@@ -410,6 +412,10 @@ void FusedDotProductAttentionGradKernel(
         const_cast<int32_t *>(cu_seqlen_kv.get_ptr()->data<int32_t>()));
   }
 
+  // cuDNN only ships a deterministic dQ reduction since 9.0; requesting it
+  // on older versions would fail the support check when building the graph.
+  bool deterministic = FLAGS_cudnn_deterministic && cudnn_version >= 90000;
+
   size_t workspace_size = 0;
   // call the first time to get the workspace size
   fused_attn_arbitrary_seqlen_bwd_impl(batch_size,
@@ -425,6 +431,7 @@ void FusedDotProductAttentionGradKernel(
                                        mha_layout,
                                        bias_type,
                                        mask_type,
+                                       deterministic,
                                        q_dev_ptr,
                                        k_dev_ptr,
                                        v_dev_ptr,
@@ -464,6 +471,7 @@ void FusedDotProductAttentionGradKernel(
       mha_layout,
       bias_type,
       mask_type,
+      deterministic,
       q_dev_ptr,
       k_dev_ptr,
       v_dev_ptr,
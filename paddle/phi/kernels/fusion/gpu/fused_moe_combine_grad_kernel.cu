@@ -0,0 +1,137 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef PADDLE_WITH_HIP
+#include <hipcub/hipcub.hpp>
+namespace cub = hipcub;
+#else
+#include <cub/cub.cuh>
+#endif
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/amp_type_traits.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/funcs/math_function.h"
+
+namespace phi {
+namespace fusion {
+
+namespace {
+
+constexpr int kMoeBlockSize = 256;
+
+// One block per (token, k) assignment. Every kept slot belongs to exactly
+// one assignment, so the expert gradient is a plain scatter with no
+// atomics; the weight gradient is a block-wide dot product of the output
+// gradient with the expert row.
+template <typename T>
+__global__ void CombineGradKernel(const T* expert_out,
+                                  const float* combine_weights,
+                                  const int* scatter_index,
+                                  const T* y_grad,
+                                  const int64_t num_assignments,
+                                  const int k,
+                                  const int64_t hidden_size,
+                                  T* expert_out_grad,
+                                  float* combine_weights_grad) {
+  typedef cub::BlockReduce<float, kMoeBlockSize> BlockReduce;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  for (int64_t flat = blockIdx.x; flat < num_assignments;
+       flat += gridDim.x) {
+    const int slot = scatter_index[flat];
+    if (slot < 0) {
+      if (combine_weights_grad != nullptr && threadIdx.x == 0) {
+        combine_weights_grad[flat] = 0.0f;
+      }
+      __syncthreads();
+      continue;
+    }
+    const int64_t token = flat / k;
+    const float w = combine_weights[flat];
+    float dot = 0.0f;
+    for (int64_t t = threadIdx.x; t < hidden_size; t += blockDim.x) {
+      const float dy = static_cast<float>(y_grad[token * hidden_size + t]);
+      if (expert_out_grad != nullptr) {
+        expert_out_grad[slot * hidden_size + t] = static_cast<T>(w * dy);
+      }
+      dot += dy * static_cast<float>(expert_out[slot * hidden_size + t]);
+    }
+    const float block_dot = BlockReduce(temp_storage).Sum(dot);
+    if (combine_weights_grad != nullptr && threadIdx.x == 0) {
+      combine_weights_grad[flat] = block_dot;
+    }
+    __syncthreads();
+  }
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void FusedMoeCombineGradKernel(const Context& dev_ctx,
+                               const DenseTensor& expert_out,
+                               const DenseTensor& combine_weights,
+                               const DenseTensor& scatter_index,
+                               const DenseTensor& y_grad,
+                               DenseTensor* expert_out_grad,
+                               DenseTensor* combine_weights_grad) {
+  const int64_t num_tokens = combine_weights.dims()[0];
+  const int k = static_cast<int>(combine_weights.dims()[1]);
+  const int64_t hidden_size = expert_out.dims()[1];
+  const int64_t num_assignments = num_tokens * k;
+  auto stream = dev_ctx.stream();
+
+  T* expert_out_grad_data = nullptr;
+  if (expert_out_grad) {
+    expert_out_grad_data = dev_ctx.template Alloc<T>(expert_out_grad);
+    // Slots an expert never filled (or that were dropped) get no upstream
+    // gradient, so start from zero.
+    phi::funcs::SetConstant<Context, T> set_zero;
+    set_zero(dev_ctx, expert_out_grad, static_cast<T>(0));
+  }
+  float* combine_weights_grad_data = nullptr;
+  if (combine_weights_grad) {
+    combine_weights_grad_data =
+        dev_ctx.template Alloc<float>(combine_weights_grad);
+  }
+  if (num_assignments == 0 ||
+      (expert_out_grad_data == nullptr &&
+       combine_weights_grad_data == nullptr)) {
+    return;
+  }
+
+  const int64_t max_grid_x = dev_ctx.GetCUDAMaxGridDimSize()[0];
+  const int64_t blocks = std::min(num_assignments, max_grid_x);
+  CombineGradKernel<T><<<blocks, kMoeBlockSize, 0, stream>>>(
+      expert_out.data<T>(),
+      combine_weights.data<float>(),
+      scatter_index.data<int>(),
+      y_grad.data<T>(),
+      num_assignments,
+      k,
+      hidden_size,
+      expert_out_grad_data,
+      combine_weights_grad_data);
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+PD_REGISTER_KERNEL(fused_moe_combine_grad,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedMoeCombineGradKernel,
+                   float,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16) {}
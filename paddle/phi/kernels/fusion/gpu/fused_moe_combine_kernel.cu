@@ -0,0 +1,90 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/amp_type_traits.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_registry.h"
+
+namespace phi {
+namespace fusion {
+
+namespace {
+
+constexpr int kMoeBlockSize = 256;
+
+// One block per token, threads striding over the hidden dim:
+// y[i] = sum over kept assignments of w[i, kk] * expert_out[slot].
+// Dropped assignments carry a zero weight and a -1 slot, so they simply
+// contribute nothing.
+template <typename T>
+__global__ void CombineRowsKernel(const T* expert_out,
+                                  const float* combine_weights,
+                                  const int* scatter_index,
+                                  const int64_t num_tokens,
+                                  const int k,
+                                  const int64_t hidden_size,
+                                  T* y) {
+  for (int64_t token = blockIdx.x; token < num_tokens; token += gridDim.x) {
+    for (int64_t t = threadIdx.x; t < hidden_size; t += blockDim.x) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        const int slot = scatter_index[token * k + kk];
+        if (slot >= 0) {
+          acc += combine_weights[token * k + kk] *
+                 static_cast<float>(expert_out[slot * hidden_size + t]);
+        }
+      }
+      y[token * hidden_size + t] = static_cast<T>(acc);
+    }
+  }
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void FusedMoeCombineKernel(const Context& dev_ctx,
+                           const DenseTensor& expert_out,
+                           const DenseTensor& combine_weights,
+                           const DenseTensor& scatter_index,
+                           DenseTensor* y) {
+  const int64_t num_tokens = combine_weights.dims()[0];
+  const int k = static_cast<int>(combine_weights.dims()[1]);
+  const int64_t hidden_size = expert_out.dims()[1];
+  auto* y_data = dev_ctx.template Alloc<T>(y);
+  if (num_tokens == 0) {
+    return;
+  }
+  const int64_t max_grid_x = dev_ctx.GetCUDAMaxGridDimSize()[0];
+  const int64_t blocks = std::min(num_tokens, max_grid_x);
+  CombineRowsKernel<T><<<blocks, kMoeBlockSize, 0, dev_ctx.stream()>>>(
+      expert_out.data<T>(),
+      combine_weights.data<float>(),
+      scatter_index.data<int>(),
+      num_tokens,
+      k,
+      hidden_size,
+      y_data);
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+PD_REGISTER_KERNEL(fused_moe_combine,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedMoeCombineKernel,
+                   float,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16) {}
@@ -0,0 +1,161 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/amp_type_traits.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_registry.h"
+
+namespace phi {
+namespace fusion {
+
+namespace {
+
+constexpr int kMoeBlockSize = 256;
+
+// One block per token, threads striding over the hidden dim. Dispatch
+// copies a token's row into each of its kept slots, so the token gradient
+// is the sum over those slots.
+template <typename T>
+__global__ void GatherRowGradKernel(const T* dispatched_x_grad,
+                                    const int* scatter_index,
+                                    const int64_t num_tokens,
+                                    const int k,
+                                    const int64_t hidden_size,
+                                    T* x_grad) {
+  using MT = typename phi::dtype::MPTypeTrait<T>::Type;
+  for (int64_t token = blockIdx.x; token < num_tokens; token += gridDim.x) {
+    for (int64_t t = threadIdx.x; t < hidden_size; t += blockDim.x) {
+      MT acc = static_cast<MT>(0);
+      for (int kk = 0; kk < k; ++kk) {
+        const int slot = scatter_index[token * k + kk];
+        if (slot >= 0) {
+          acc += static_cast<MT>(dispatched_x_grad[slot * hidden_size + t]);
+        }
+      }
+      x_grad[token * hidden_size + t] = static_cast<T>(acc);
+    }
+  }
+}
+
+// One thread per token: softmax backward with the sparse upstream gradient
+// that lives only on the kept top-k entries. The probabilities are
+// recomputed from the saved logits in float, matching the forward.
+template <typename T>
+__global__ void GateLogitsGradKernel(const T* logits,
+                                     const float* combine_weights_grad,
+                                     const int* scatter_index,
+                                     const int* expert_id,
+                                     const int64_t num_tokens,
+                                     const int64_t num_experts,
+                                     const int k,
+                                     T* logits_grad) {
+  const int64_t token = blockIdx.x * blockDim.x + threadIdx.x;
+  if (token >= num_tokens) {
+    return;
+  }
+  const T* row = logits + token * num_experts;
+  float max_logit = static_cast<float>(row[0]);
+  for (int64_t j = 1; j < num_experts; ++j) {
+    max_logit = max(max_logit, static_cast<float>(row[j]));
+  }
+  float denom = 0.0f;
+  for (int64_t j = 0; j < num_experts; ++j) {
+    denom += expf(static_cast<float>(row[j]) - max_logit);
+  }
+  // dot = sum over kept entries of c_j * p_j
+  float dot = 0.0f;
+  for (int kk = 0; kk < k; ++kk) {
+    if (scatter_index[token * k + kk] < 0) {
+      continue;
+    }
+    const int j = expert_id[token * k + kk];
+    const float p = expf(static_cast<float>(row[j]) - max_logit) / denom;
+    dot += combine_weights_grad[token * k + kk] * p;
+  }
+  for (int64_t j = 0; j < num_experts; ++j) {
+    const float p = expf(static_cast<float>(row[j]) - max_logit) / denom;
+    float c = 0.0f;
+    for (int kk = 0; kk < k; ++kk) {
+      if (expert_id[token * k + kk] == j &&
+          scatter_index[token * k + kk] >= 0) {
+        c = combine_weights_grad[token * k + kk];
+      }
+    }
+    logits_grad[token * num_experts + j] = static_cast<T>(p * (c - dot));
+  }
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void FusedMoeDispatchGradKernel(const Context& dev_ctx,
+                                const DenseTensor& gate_logits,
+                                const DenseTensor& combine_weights,
+                                const DenseTensor& scatter_index,
+                                const DenseTensor& expert_id,
+                                const DenseTensor& dispatched_x_grad,
+                                const DenseTensor& combine_weights_grad,
+                                const int k,
+                                const int64_t capacity,
+                                DenseTensor* x_grad,
+                                DenseTensor* gate_logits_grad) {
+  const int64_t num_tokens = gate_logits.dims()[0];
+  const int64_t num_experts = gate_logits.dims()[1];
+  const int64_t hidden_size = dispatched_x_grad.dims()[1];
+  auto stream = dev_ctx.stream();
+  const int64_t max_grid_x = dev_ctx.GetCUDAMaxGridDimSize()[0];
+
+  if (x_grad) {
+    auto* x_grad_data = dev_ctx.template Alloc<T>(x_grad);
+    const int64_t row_blocks = std::min(num_tokens, max_grid_x);
+    if (num_tokens > 0) {
+      GatherRowGradKernel<T><<<row_blocks, kMoeBlockSize, 0, stream>>>(
+          dispatched_x_grad.data<T>(),
+          scatter_index.data<int>(),
+          num_tokens,
+          k,
+          hidden_size,
+          x_grad_data);
+    }
+  }
+
+  if (gate_logits_grad) {
+    auto* gate_logits_grad_data = dev_ctx.template Alloc<T>(gate_logits_grad);
+    const int64_t token_blocks =
+        (num_tokens + kMoeBlockSize - 1) / kMoeBlockSize;
+    if (num_tokens > 0) {
+      GateLogitsGradKernel<T><<<token_blocks, kMoeBlockSize, 0, stream>>>(
+          gate_logits.data<T>(),
+          combine_weights_grad.data<float>(),
+          scatter_index.data<int>(),
+          expert_id.data<int>(),
+          num_tokens,
+          num_experts,
+          k,
+          gate_logits_grad_data);
+    }
+  }
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+PD_REGISTER_KERNEL(fused_moe_dispatch_grad,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedMoeDispatchGradKernel,
+                   float,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16) {}
@@ -0,0 +1,306 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef PADDLE_WITH_HIP
+#include <hipcub/hipcub.hpp>
+namespace cub = hipcub;
+#else
+#include <cub/cub.cuh>
+#endif
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/backends/gpu/gpu_launch_config.h"
+#include "paddle/phi/common/amp_type_traits.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/core/memory_utils.h"
+#include "paddle/phi/kernels/funcs/math_function.h"
+
+namespace phi {
+namespace fusion {
+
+namespace {
+
+constexpr int kMoeBlockSize = 256;
+
+// One thread per token: softmax over the expert logits in float, then pick
+// the top-k experts by probability (ties break towards the lower expert id,
+// so the result does not depend on launch configuration).
+template <typename T>
+__global__ void TopKGatingKernel(const T* logits,
+                                 const int64_t num_tokens,
+                                 const int64_t num_experts,
+                                 const int k,
+                                 float* combine_weights,
+                                 int* expert_id) {
+  const int64_t token = blockIdx.x * blockDim.x + threadIdx.x;
+  if (token >= num_tokens) {
+    return;
+  }
+  const T* row = logits + token * num_experts;
+  float max_logit = static_cast<float>(row[0]);
+  for (int64_t j = 1; j < num_experts; ++j) {
+    max_logit = max(max_logit, static_cast<float>(row[j]));
+  }
+  float denom = 0.0f;
+  for (int64_t j = 0; j < num_experts; ++j) {
+    denom += expf(static_cast<float>(row[j]) - max_logit);
+  }
+  for (int kk = 0; kk < k; ++kk) {
+    int best = -1;
+    float best_logit = 0.0f;
+    for (int64_t j = 0; j < num_experts; ++j) {
+      bool taken = false;
+      for (int prev = 0; prev < kk; ++prev) {
+        taken |= (expert_id[token * k + prev] == j);
+      }
+      const float logit = static_cast<float>(row[j]);
+      if (!taken && (best < 0 || logit > best_logit)) {
+        best = static_cast<int>(j);
+        best_logit = logit;
+      }
+    }
+    expert_id[token * k + kk] = best;
+    combine_weights[token * k + kk] = expf(best_logit - max_logit) / denom;
+  }
+}
+
+__global__ void InitIndexKernel(int64_t* index, const int64_t n) {
+  const int64_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < n) {
+    index[i] = i;
+  }
+}
+
+__global__ void CountExpertsKernel(const int* expert_id,
+                                   const int64_t n,
+                                   int* expert_count_raw) {
+  const int64_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < n) {
+    atomicAdd(&expert_count_raw[expert_id[i]], 1);
+  }
+}
+
+// The assignments are sorted by expert with token order preserved inside
+// each expert, so a token's rank within its expert is its sorted position
+// minus the expert's start offset. Ranks beyond the capacity are dropped:
+// their slot becomes -1 and their combine weight is zeroed, which keeps
+// the dropped tokens out of both the dispatch and the combine.
+__global__ void AssignSlotsKernel(const int* sorted_expert_id,
+                                  const int64_t* sorted_index,
+                                  const int* expert_start,
+                                  const int64_t n,
+                                  const int64_t capacity,
+                                  float* combine_weights,
+                                  int* scatter_index) {
+  const int64_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= n) {
+    return;
+  }
+  const int expert = sorted_expert_id[i];
+  const int64_t rank = i - expert_start[expert];
+  const int64_t flat = sorted_index[i];
+  if (rank < capacity) {
+    scatter_index[flat] = static_cast<int>(expert * capacity + rank);
+  } else {
+    scatter_index[flat] = -1;
+    combine_weights[flat] = 0.0f;
+  }
+}
+
+__global__ void FinalizeExpertCountKernel(const int* expert_count_raw,
+                                          const int64_t num_experts,
+                                          const int64_t capacity,
+                                          int64_t* expert_count) {
+  const int64_t j = blockIdx.x * blockDim.x + threadIdx.x;
+  if (j < num_experts) {
+    const int64_t raw = static_cast<int64_t>(expert_count_raw[j]);
+    expert_count[j] = raw < capacity ? raw : capacity;
+  }
+}
+
+// One block per (token, k) assignment, threads striding over the hidden
+// dim. Kept slots are unique, so the copies never race.
+template <typename T>
+__global__ void ScatterRowsKernel(const T* x,
+                                  const int* scatter_index,
+                                  const int64_t num_assignments,
+                                  const int k,
+                                  const int64_t hidden_size,
+                                  T* dispatched_x) {
+  for (int64_t flat = blockIdx.x; flat < num_assignments;
+       flat += gridDim.x) {
+    const int slot = scatter_index[flat];
+    if (slot < 0) {
+      continue;
+    }
+    const int64_t token = flat / k;
+    for (int64_t t = threadIdx.x; t < hidden_size; t += blockDim.x) {
+      dispatched_x[slot * hidden_size + t] = x[token * hidden_size + t];
+    }
+  }
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void FusedMoeDispatchKernel(const Context& dev_ctx,
+                            const DenseTensor& x,
+                            const DenseTensor& gate_logits,
+                            const int k,
+                            const int64_t capacity,
+                            DenseTensor* dispatched_x,
+                            DenseTensor* combine_weights,
+                            DenseTensor* scatter_index,
+                            DenseTensor* expert_id,
+                            DenseTensor* expert_count) {
+  const int64_t num_tokens = x.dims()[0];
+  const int64_t hidden_size = x.dims()[1];
+  const int64_t num_experts = gate_logits.dims()[1];
+  const int64_t num_assignments = num_tokens * k;
+  auto stream = dev_ctx.stream();
+
+  auto* dispatched_x_data = dev_ctx.template Alloc<T>(dispatched_x);
+  auto* combine_weights_data = dev_ctx.template Alloc<float>(combine_weights);
+  auto* scatter_index_data = dev_ctx.template Alloc<int>(scatter_index);
+  auto* expert_id_data = dev_ctx.template Alloc<int>(expert_id);
+  auto* expert_count_data = dev_ctx.template Alloc<int64_t>(expert_count);
+
+  phi::funcs::SetConstant<Context, T> set_zero;
+  set_zero(dev_ctx, dispatched_x, static_cast<T>(0));
+  if (num_tokens == 0) {
+    phi::funcs::SetConstant<Context, int64_t> set_count;
+    set_count(dev_ctx, expert_count, static_cast<int64_t>(0));
+    return;
+  }
+
+  const int64_t max_grid_x = dev_ctx.GetCUDAMaxGridDimSize()[0];
+  const int64_t token_blocks =
+      (num_tokens + kMoeBlockSize - 1) / kMoeBlockSize;
+  TopKGatingKernel<T><<<token_blocks, kMoeBlockSize, 0, stream>>>(
+      gate_logits.data<T>(),
+      num_tokens,
+      num_experts,
+      k,
+      combine_weights_data,
+      expert_id_data);
+
+  // Deterministic capacity bucketing: stable-sort the (expert, assignment)
+  // pairs so each expert sees its tokens in token order, then rank them
+  // against the capacity.
+  DenseTensor index_in, index_out, expert_id_sorted;
+  index_in.Resize({num_assignments});
+  index_out.Resize({num_assignments});
+  expert_id_sorted.Resize({num_assignments});
+  auto* index_in_data = dev_ctx.template Alloc<int64_t>(&index_in);
+  auto* index_out_data = dev_ctx.template Alloc<int64_t>(&index_out);
+  auto* expert_id_sorted_data =
+      dev_ctx.template Alloc<int>(&expert_id_sorted);
+
+  const int64_t assign_blocks =
+      (num_assignments + kMoeBlockSize - 1) / kMoeBlockSize;
+  InitIndexKernel<<<assign_blocks, kMoeBlockSize, 0, stream>>>(
+      index_in_data, num_assignments);
+
+  size_t temp_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_bytes,
+                                  expert_id_data,
+                                  expert_id_sorted_data,
+                                  index_in_data,
+                                  index_out_data,
+                                  num_assignments,
+                                  0,
+                                  sizeof(int) * 8,
+                                  stream);
+  auto temp_storage =
+      phi::memory_utils::Alloc(dev_ctx.GetPlace(), temp_bytes);
+  cub::DeviceRadixSort::SortPairs(temp_storage->ptr(),
+                                  temp_bytes,
+                                  expert_id_data,
+                                  expert_id_sorted_data,
+                                  index_in_data,
+                                  index_out_data,
+                                  num_assignments,
+                                  0,
+                                  sizeof(int) * 8,
+                                  stream);
+
+  DenseTensor expert_count_raw, expert_start;
+  expert_count_raw.Resize({num_experts});
+  expert_start.Resize({num_experts});
+  auto* expert_count_raw_data =
+      dev_ctx.template Alloc<int>(&expert_count_raw);
+  auto* expert_start_data = dev_ctx.template Alloc<int>(&expert_start);
+  phi::funcs::SetConstant<Context, int> set_zero_int;
+  set_zero_int(dev_ctx, &expert_count_raw, 0);
+
+  CountExpertsKernel<<<assign_blocks, kMoeBlockSize, 0, stream>>>(
+      expert_id_data, num_assignments, expert_count_raw_data);
+
+  size_t scan_bytes = 0;
+  cub::DeviceScan::ExclusiveSum(nullptr,
+                                scan_bytes,
+                                expert_count_raw_data,
+                                expert_start_data,
+                                num_experts,
+                                stream);
+  auto scan_storage =
+      phi::memory_utils::Alloc(dev_ctx.GetPlace(), scan_bytes);
+  cub::DeviceScan::ExclusiveSum(scan_storage->ptr(),
+                                scan_bytes,
+                                expert_count_raw_data,
+                                expert_start_data,
+                                num_experts,
+                                stream);
+
+  AssignSlotsKernel<<<assign_blocks, kMoeBlockSize, 0, stream>>>(
+      expert_id_sorted_data,
+      index_out_data,
+      expert_start_data,
+      num_assignments,
+      capacity,
+      combine_weights_data,
+      scatter_index_data);
+
+  const int64_t expert_blocks =
+      (num_experts + kMoeBlockSize - 1) / kMoeBlockSize;
+  FinalizeExpertCountKernel<<<expert_blocks, kMoeBlockSize, 0, stream>>>(
+      expert_count_raw_data, num_experts, capacity, expert_count_data);
+
+  const int64_t scatter_blocks = std::min(num_assignments, max_grid_x);
+  ScatterRowsKernel<T><<<scatter_blocks, kMoeBlockSize, 0, stream>>>(
+      x.data<T>(),
+      scatter_index_data,
+      num_assignments,
+      k,
+      hidden_size,
+      dispatched_x_data);
+}
+
+}  // namespace fusion
+}  // namespace phi
+
+PD_REGISTER_KERNEL(fused_moe_dispatch,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::fusion::FusedMoeDispatchKernel,
+                   float,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16) {
+  kernel->OutputAt(1).SetDataType(phi::DataType::FLOAT32);
+  kernel->OutputAt(2).SetDataType(phi::DataType::INT32);
+  kernel->OutputAt(3).SetDataType(phi::DataType::INT32);
+  kernel->OutputAt(4).SetDataType(phi::DataType::INT64);
+}
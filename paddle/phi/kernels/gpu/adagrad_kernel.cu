@@ -163,7 +163,7 @@ struct SparseAdagradFunctor<phi::GPUContext, T> {
     phi::funcs::scatter::MergeAdd<phi::GPUContext, T> merge_func;
     auto grad_merge = merge_func(context, grad);
     auto* grad_merge_data = grad_merge.mutable_value()->template data<T>();
-    phi::Vector<int64_t> merge_rows(grad_merge.rows());
+    auto& merge_rows = grad_merge.rows();
     // 2. m += g_m * g_m
     auto grad_square =
         SquareSelectedRows<phi::GPUContext, T>(context, grad_merge);
@@ -179,20 +179,18 @@ struct SparseAdagradFunctor<phi::GPUContext, T> {
     const int block_size = 256;
     dim3 threads(block_size, 1);
     dim3 grid2(1, merge_rows.size());
-    phi::MixVector<int64_t> mixv_merge_rows(&merge_rows);
     SparseAdagradFunctorKernel<T, 256>
         <<<grid2,
            threads,
            0,
            reinterpret_cast<const phi::GPUContext&>(context).stream()>>>(
             grad_merge_data,
-            mixv_merge_rows.CUDAMutableData(context.GetPlace()),
+            grad_merge.DeviceRows(context.GetPlace()),
             lr,
             param_data,
             moment_data,
             grad_width,
             epsilon);
-    mixv_merge_rows.CopyToCPU();
   }
 };
 
@@ -14,12 +14,75 @@
 
 #include "paddle/phi/common/data_type.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/funcs/beam_search_decode_gpu.h"
 #include "paddle/phi/kernels/impl/beam_search_decode_kernel_impl.h"
 
+namespace phi {
+
+template <typename T, typename Context>
+void BeamSearchDecodeGPUOpKernel(const Context& dev_ctx,
+                                 const TensorArray& ids_in,
+                                 const TensorArray& scores_in,
+                                 int beam_size,
+                                 int end_id,
+                                 DenseTensor* sentence_ids,
+                                 DenseTensor* sentence_scores) {
+  const size_t step_num = ids_in.size();
+  PADDLE_ENFORCE_GT(
+      step_num,
+      0UL,
+      phi::errors::InvalidArgument(
+          "beam search steps, which is the"
+          "size of Input(Ids) TensorArray. beam search steps should "
+          "be larger than 0, but received %d. ",
+          step_num));
+  const size_t source_num = ids_in.at(0).lod().at(0).size() - 1;
+  PADDLE_ENFORCE_GT(
+      source_num,
+      0UL,
+      phi::errors::InvalidArgument(
+          "source_num is the sequence number of the"
+          "first decoding step, indicating by Input(Ids)[0].lod[0].size. "
+          "The number of source_num should be larger than"
+          "0, but received %d. ",
+          source_num));
+
+  for (size_t i = 0; i < step_num; ++i) {
+    size_t tmp = ids_in.at(i).lod().size();
+    PADDLE_ENFORCE_EQ(
+        tmp,
+        2UL,
+        phi::errors::InvalidArgument(
+            "For the i step in beam search steps,"
+            "the size of Input(Ids)[i].lod() should larger than 2,"
+            "but received %d. ",
+            tmp));
+  }
+
+  if (ids_in.at(0).place().GetType() == phi::AllocationType::GPU) {
+    // Backtrace directly on the device-resident step tensors; the host only
+    // sees the packed hypotheses, with a single synchronization instead of
+    // one per step tensor.
+    phi::funcs::BeamSearchDecodeGPU<T>(dev_ctx,
+                                       ids_in,
+                                       scores_in,
+                                       beam_size,
+                                       end_id,
+                                       sentence_ids,
+                                       sentence_scores);
+    return;
+  }
+
+  BeamSearchDecodeFunctor bs(
+      ids_in, scores_in, sentence_ids, sentence_scores, beam_size, end_id);
+  bs.apply_mix<T>();
+}
+}  // namespace phi
+
 PD_REGISTER_KERNEL(beam_search_decode,
                    GPU,
                    ALL_LAYOUT,
-                   phi::BeamSearchDecodeOpKernel,
+                   phi::BeamSearchDecodeGPUOpKernel,
                    float,
                    double,
                    phi::dtype::float16,
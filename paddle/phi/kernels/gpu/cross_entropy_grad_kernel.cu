@@ -36,8 +36,12 @@ namespace cub = hipcub;
 
 namespace phi {
 
+// All gradient kernels below read the forward softmax directly instead of a
+// copy of it staged in logit_grad; at large class counts that staging copy
+// was a full extra pass of memory traffic before any label adjustment ran.
 template <typename T>
 __global__ void SoftLabelCrossEntropyGradientKernel(T* logit_grad,
+                                                    const T* softmax,
                                                     const T* loss_grad,
                                                     const T* labels,
                                                     const int n,
@@ -48,36 +52,22 @@ __global__ void SoftLabelCrossEntropyGradientKernel(T* logit_grad,
     int idx_n = ids / d;
     int idx_remain = ids % remain;
     int idx_loss = idx_n * remain + idx_remain;
-    logit_grad[ids] = loss_grad[idx_loss] * (-labels[ids] / logit_grad[ids]);
+    logit_grad[ids] = loss_grad[idx_loss] * (-labels[ids] / softmax[ids]);
   }
 }
 
+// Single pass for the hard-label case without the softmax op: writes the
+// final gradient with ignore_index rows zeroed, replacing the former
+// patch-then-scale pair of full-tensor kernels.
 template <typename T, typename LabelT>
 __global__ void HardLabelCrossEntropyGradientKernel(T* logit_grad,
+                                                    const T* softmax,
+                                                    const T* loss_grad,
                                                     const LabelT* labels,
-                                                    const int n,
+                                                    const int num,
                                                     const int d,
                                                     const int remain,
                                                     const int ignore_index) {
-  CUDA_KERNEL_LOOP(index, n * remain) {
-    int idx_n = index / remain;
-    int idx_remain = index % remain;
-    int tmp = static_cast<int>(labels[index]);
-    int idx = idx_n * d + tmp * remain + idx_remain;
-    if (ignore_index != tmp) {
-      logit_grad[idx] = -static_cast<T>(1.) / logit_grad[idx];
-    }
-  }
-}
-
-template <typename T, typename LabelT>
-__global__ void ScaleCrossEntropyGradient(T* logit_grad,
-                                          const T* loss_grad,
-                                          const int num,
-                                          const int d,
-                                          const int remain,
-                                          const LabelT* labels,
-                                          const int ignore_index) {
   CUDA_KERNEL_LOOP(index, num) {
     int idx_n = index / d;
     int idx_remain = index % remain;
@@ -87,13 +77,14 @@ __global__ void ScaleCrossEntropyGradient(T* logit_grad,
     if (lbl == ignore_index || lbl != k) {
       logit_grad[index] = static_cast<T>(0.);
     } else {
-      logit_grad[index] *= loss_grad[idx_lbl];
+      logit_grad[index] = -loss_grad[idx_lbl] / softmax[index];
     }
   }
 }
 
 template <typename T>
 __global__ void SoftCrossEntropyGradientKernel(T* logit_grad,
+                                               const T* softmax,
                                                const T* loss_grad,
                                                const T* labels,
                                                const int64_t n,
@@ -104,7 +95,7 @@ __global__ void SoftCrossEntropyGradientKernel(T* logit_grad,
     int64_t idx_n = ids / d;
     int64_t idx_remain = ids % remain;
     int64_t idx_loss = idx_n * remain + idx_remain;
-    logit_grad[ids] = loss_grad[idx_loss] * (logit_grad[ids] - labels[ids]);
+    logit_grad[ids] = loss_grad[idx_loss] * (softmax[ids] - labels[ids]);
   }
 }
 
@@ -157,14 +148,11 @@ void CrossEntropyWithSoftmaxGradGPUKernel(const GPUContext& dev_ctx,
   const T* loss_grad_data = loss_grad.data<T>();
   DenseTensor* logit_grad = logits_grad;
 
-  T* logit_grad_data = nullptr;
-  bool copy_flag = (logit_grad != &softmax && (!use_softmax || soft_label));
-  if (copy_flag) {
-    phi::Copy(dev_ctx, softmax, dev_ctx.GetPlace(), false, logit_grad);
-    logit_grad_data = logit_grad->data<T>();
-  } else {
-    logit_grad_data = dev_ctx.template Alloc<T>(logit_grad);
-  }
+  // every path reads the forward softmax in place (aliasing with
+  // logit_grad is fine, each thread touches only its own element), so no
+  // staging copy of it is needed
+  const T* softmax_data = softmax.data<T>();
+  T* logit_grad_data = dev_ctx.template Alloc<T>(logit_grad);
 
   const int rank = logit_grad->dims().size();
   const int axis_v = phi::funcs::CanonicalAxis(axis, rank);
@@ -183,24 +171,25 @@ void CrossEntropyWithSoftmaxGradGPUKernel(const GPUContext& dev_ctx,
       int grid = (n * d + block - 1) / block;
       const T* label_data = label.data<T>();
       SoftLabelCrossEntropyGradientKernel<T><<<grid, block, 0, stream>>>(
-          logit_grad_data, loss_grad_data, label_data, n, d, remain);
+          logit_grad_data,
+          softmax_data,
+          loss_grad_data,
+          label_data,
+          n,
+          d,
+          remain);
     } else {
-      DenseTensor logits_grad_2d(*logit_grad);
-      logits_grad_2d.Resize({n, d});
-      int grid = (n * remain + block - 1) / block;
+      int num = n * d;
+      int grid = (num + block - 1) / block;
       const auto* label_data = label.data<LabelT>();
       HardLabelCrossEntropyGradientKernel<T, LabelT>
-          <<<grid, block, 0, stream>>>(
-              logit_grad_data, label_data, n, d, remain, ignore_index);
-      int num = n * d;
-      grid = (num + block - 1) / block;
-      ScaleCrossEntropyGradient<T, LabelT>
           <<<grid, block, 0, stream>>>(logit_grad_data,
+                                       softmax_data,
                                        loss_grad_data,
+                                       label_data,
                                        num,
                                        d,
                                        remain,
-                                       label_data,
                                        ignore_index);
     }
 
@@ -213,9 +202,14 @@ void CrossEntropyWithSoftmaxGradGPUKernel(const GPUContext& dev_ctx,
     int64_t grid = (n * d + block - 1) / block;
     const T* label_data = label.data<T>();
     SoftCrossEntropyGradientKernel<T><<<grid, block, 0, stream>>>(
-        logit_grad_data, loss_grad_data, label_data, n, d, remain);
+        logit_grad_data,
+        softmax_data,
+        loss_grad_data,
+        label_data,
+        n,
+        d,
+        remain);
   } else {
-    const T* softmax_data = softmax.data<T>();
     const auto* label_data = label.data<LabelT>();
     int grid = (n * d + block - 1) / block;
     SoftmaxWithCrossEntropyGradHardLabel<T>
@@ -18,6 +18,7 @@
 #include "paddle/phi/backends/gpu/gpu_context.h"
 #include "paddle/phi/common/amp_type_traits.h"
 #include "paddle/phi/common/float16.h"
+#include "paddle/phi/common/memory_utils.h"
 #include "paddle/phi/common/scalar.h"
 #include "paddle/phi/core/dense_tensor.h"
 #include "paddle/phi/core/kernel_registry.h"
@@ -227,10 +228,13 @@ struct FusedAdamFunctor {
   }
 };
 
-template <typename T, int N>
-__global__ void UpdateBetaPowGroup(
-    Array<T*, N> beta1_pow, Array<T*, N> beta2_pow, T beta1, T beta2, int n) {
-  auto idx = threadIdx.x;
+template <typename T>
+__global__ void UpdateBetaPowMultiTensor(T** beta1_pow,
+                                         T** beta2_pow,
+                                         T beta1,
+                                         T beta2,
+                                         int n) {
+  int idx = blockIdx.x * blockDim.x + threadIdx.x;
   if (idx < n) {
     beta1_pow[idx][0] *= beta1;
     beta2_pow[idx][0] *= beta2;
@@ -465,22 +469,36 @@ void FusedAdamKernel(
         (*beta2_ptr) *= beta2_tmp;
       }
     } else {
-      constexpr size_t kGroupSize = 32;
-      auto group_num = (n + kGroupSize - 1) / kGroupSize;
       VLOG(10) << "GPU Update BetaPow here...";
-      for (size_t i = 0; i < group_num; ++i) {
-        size_t start = i * kGroupSize;
-        size_t end = std::min((i + 1) * kGroupSize, n);
-        Array<MPDType*, kGroupSize> beta1_ptrs, beta2_ptrs;
-        for (size_t j = start; j < end; ++j) {
-          size_t idx = j - start;
-          beta1_ptrs[idx] = dev_ctx.template Alloc<MPDType>(beta1_pows_out[j]);
-          beta2_ptrs[idx] = dev_ctx.template Alloc<MPDType>(beta2_pows_out[j]);
-        }
-        UpdateBetaPowGroup<MPDType, kGroupSize>
-            <<<1, kGroupSize, 0, dev_ctx.stream()>>>(
-                beta1_ptrs, beta2_ptrs, beta1_tmp, beta2_tmp, end - start);
+      // stage all beta pow pointers through one device buffer so the whole
+      // update is a single launch; grouped 32-wide launches were the last
+      // per-parameter launch cost left on the fused path
+      std::vector<MPDType*> beta_pow_ptrs(2 * n);
+      for (size_t j = 0; j < n; ++j) {
+        beta_pow_ptrs[j] = dev_ctx.template Alloc<MPDType>(beta1_pows_out[j]);
+        beta_pow_ptrs[n + j] =
+            dev_ctx.template Alloc<MPDType>(beta2_pows_out[j]);
       }
+      auto ptr_buf = memory_utils::Alloc(
+          dev_ctx.GetPlace(),
+          sizeof(MPDType*) * beta_pow_ptrs.size(),
+          phi::Stream(reinterpret_cast<phi::StreamId>(dev_ctx.stream())));
+      auto** d_beta_pow_ptrs = reinterpret_cast<MPDType**>(ptr_buf->ptr());
+      memory_utils::Copy(dev_ctx.GetPlace(),
+                         d_beta_pow_ptrs,
+                         CPUPlace(),
+                         beta_pow_ptrs.data(),
+                         sizeof(MPDType*) * beta_pow_ptrs.size(),
+                         dev_ctx.stream());
+      constexpr int kBetaPowBlockDim = 256;
+      auto blocks = (n + kBetaPowBlockDim - 1) / kBetaPowBlockDim;
+      UpdateBetaPowMultiTensor<MPDType>
+          <<<blocks, kBetaPowBlockDim, 0, dev_ctx.stream()>>>(
+              d_beta_pow_ptrs,
+              d_beta_pow_ptrs + n,
+              beta1_tmp,
+              beta2_tmp,
+              static_cast<int>(n));
     }
   }
 }
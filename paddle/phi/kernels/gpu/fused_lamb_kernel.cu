@@ -0,0 +1,664 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/kernels/fused_lamb_kernel.h"
+#include <vector>
+
+#ifdef __NVCC__
+#include "cub/cub.cuh"
+#endif
+
+#ifdef __HIPCC__
+#include <hipcub/hipcub.hpp>
+namespace cub = hipcub;
+#endif
+
+#include "glog/logging.h"
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/common/amp_type_traits.h"
+#include "paddle/phi/common/float16.h"
+#include "paddle/phi/common/memory_utils.h"
+#include "paddle/phi/common/scalar.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/core/tensor_utils.h"
+#include "paddle/phi/kernels/funcs/aligned_vector.h"
+
+namespace phi {
+
+// LAMB cannot reuse funcs::LaunchMultiTensorApplyKernel directly: the trust
+// ratio couples every element of a parameter to that parameter's two l2
+// norms, and the wave-relative tensor ids the launcher hands to its functor
+// cannot address per-tensor norm slots. Instead the whole parameter list is
+// flattened once on the host into a chunk table (global tensor id + element
+// offset per chunk) that is uploaded together with all data pointers in a
+// single staging buffer, and three kernels walk that table:
+//   1. moment update + trust_ratio_div + per-chunk squared norms,
+//   2. per-tensor reduction of the chunk partials (deterministic, no
+//      atomics, same scheme as MultiTensorL2NormReduceAgainCUDAKernel in
+//      distributed_fused_lamb),
+//   3. parameter update with the trust ratio formed on device.
+// No intermediate result ever reaches the host, so the whole step runs
+// without a synchronization.
+
+template <typename T,
+          typename MT,
+          int VecSize,
+          int BlockDim,
+          bool IsMultiPrecision>
+__global__ void FusedLambTrustRatioDivCUDAKernel(
+    int chunk_size,
+    const int64_t* __restrict__ chunk_tensor_ids,
+    const int64_t* __restrict__ chunk_offsets,
+    const int64_t* __restrict__ tensor_numels,
+    const int64_t* __restrict__ trust_ratio_div_offsets,
+    const T* const* __restrict__ grad_ptrs,
+    const T* const* __restrict__ param_ptrs,
+    const MT* const* __restrict__ master_param_ptrs,
+    MT* const* __restrict__ moment1_ptrs,
+    MT* const* __restrict__ moment2_ptrs,
+    MT* __restrict__ trust_ratio_div,
+    MT* __restrict__ chunk_param_square_sum,
+    MT* __restrict__ chunk_trust_ratio_div_square_sum,
+    const MT* __restrict__ beta1_pow_ptr,
+    const MT* __restrict__ beta2_pow_ptr,
+    MT beta1_pow_value,
+    MT beta2_pow_value,
+    MT weight_decay,
+    MT beta1,
+    MT beta2,
+    MT epsilon,
+    const bool* skip_update) {
+  int chunk_id = blockIdx.x;
+  int tensor_id = static_cast<int>(chunk_tensor_ids[chunk_id]);
+  int64_t offset = chunk_offsets[chunk_id];
+  int64_t size = tensor_numels[tensor_id] - offset;
+  if (size > chunk_size) {
+    size = chunk_size;
+  }
+
+  const T* g_ptr = grad_ptrs[tensor_id] + offset;
+  const T* p_ptr = param_ptrs[tensor_id] + offset;
+  const MT* mp_ptr =
+      IsMultiPrecision ? master_param_ptrs[tensor_id] + offset : nullptr;
+  MT* mom1_ptr = moment1_ptrs[tensor_id] + offset;
+  MT* mom2_ptr = moment2_ptrs[tensor_id] + offset;
+  MT* tdiv_ptr = trust_ratio_div + trust_ratio_div_offsets[tensor_id] + offset;
+
+  MT p_square_sum = static_cast<MT>(0);
+  MT tdiv_square_sum = static_cast<MT>(0);
+
+  if (!(skip_update && *skip_update)) {
+    MT beta1_pow = beta1_pow_ptr ? *beta1_pow_ptr : beta1_pow_value;
+    MT beta2_pow = beta2_pow_ptr ? *beta2_pow_ptr : beta2_pow_value;
+
+    int64_t i = static_cast<int64_t>(threadIdx.x) * VecSize;
+    int64_t stride = static_cast<int64_t>(BlockDim) * VecSize;
+    for (; i + VecSize <= size; i += stride) {
+      phi::AlignedVector<T, VecSize> g_vec;
+      phi::AlignedVector<T, VecSize> p_vec;
+      phi::AlignedVector<MT, VecSize> mp_vec;
+      phi::AlignedVector<MT, VecSize> mom1_vec;
+      phi::AlignedVector<MT, VecSize> mom2_vec;
+      phi::AlignedVector<MT, VecSize> tdiv_vec;
+      phi::Load(g_ptr + i, &g_vec);
+      if (IsMultiPrecision) {
+        phi::Load(mp_ptr + i, &mp_vec);
+      } else {
+        phi::Load(p_ptr + i, &p_vec);
+      }
+      phi::Load(mom1_ptr + i, &mom1_vec);
+      phi::Load(mom2_ptr + i, &mom2_vec);
+
+#pragma unroll
+      for (int j = 0; j < VecSize; ++j) {
+        MT g = static_cast<MT>(g_vec[j]);
+        MT p = IsMultiPrecision ? mp_vec[j] : static_cast<MT>(p_vec[j]);
+        MT mom1 = beta1 * mom1_vec[j] + (static_cast<MT>(1) - beta1) * g;
+        MT mom2 = beta2 * mom2_vec[j] + (static_cast<MT>(1) - beta2) * g * g;
+        mom1_vec[j] = mom1;
+        mom2_vec[j] = mom2;
+        MT mom1_unbiased = mom1 / (static_cast<MT>(1) - beta1_pow);
+        MT mom2_unbiased = mom2 / (static_cast<MT>(1) - beta2_pow);
+        MT tdiv = mom1_unbiased / (sqrt(mom2_unbiased) + epsilon) +
+                  weight_decay * p;
+        tdiv_vec[j] = tdiv;
+        p_square_sum += p * p;
+        tdiv_square_sum += tdiv * tdiv;
+      }
+
+      phi::Store(mom1_vec, mom1_ptr + i);
+      phi::Store(mom2_vec, mom2_ptr + i);
+      phi::Store(tdiv_vec, tdiv_ptr + i);
+    }
+
+    for (; i < size; ++i) {
+      MT g = static_cast<MT>(g_ptr[i]);
+      MT p = IsMultiPrecision ? mp_ptr[i] : static_cast<MT>(p_ptr[i]);
+      MT mom1 = beta1 * mom1_ptr[i] + (static_cast<MT>(1) - beta1) * g;
+      MT mom2 = beta2 * mom2_ptr[i] + (static_cast<MT>(1) - beta2) * g * g;
+      mom1_ptr[i] = mom1;
+      mom2_ptr[i] = mom2;
+      MT mom1_unbiased = mom1 / (static_cast<MT>(1) - beta1_pow);
+      MT mom2_unbiased = mom2 / (static_cast<MT>(1) - beta2_pow);
+      MT tdiv =
+          mom1_unbiased / (sqrt(mom2_unbiased) + epsilon) + weight_decay * p;
+      tdiv_ptr[i] = tdiv;
+      p_square_sum += p * p;
+      tdiv_square_sum += tdiv * tdiv;
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<MT, BlockDim>;
+  __shared__ typename BlockReduce::TempStorage storage;
+  p_square_sum = BlockReduce(storage).Reduce(p_square_sum, cub::Sum());
+  __syncthreads();
+  tdiv_square_sum = BlockReduce(storage).Reduce(tdiv_square_sum, cub::Sum());
+  if (threadIdx.x == 0) {
+    chunk_param_square_sum[chunk_id] = p_square_sum;
+    chunk_trust_ratio_div_square_sum[chunk_id] = tdiv_square_sum;
+  }
+}
+
+template <typename MT, int BlockDim>
+__global__ void FusedLambNormReduceCUDAKernel(
+    const MT* __restrict__ chunk_param_square_sum,
+    const MT* __restrict__ chunk_trust_ratio_div_square_sum,
+    const int64_t* __restrict__ chunk_starts,
+    MT* __restrict__ param_square_norm,
+    MT* __restrict__ trust_ratio_div_square_norm) {
+  int tensor_id = blockIdx.x;
+  int64_t begin = chunk_starts[tensor_id];
+  int64_t end = chunk_starts[tensor_id + 1];
+  MT p_sum = static_cast<MT>(0);
+  MT tdiv_sum = static_cast<MT>(0);
+  for (int64_t i = begin + threadIdx.x; i < end; i += BlockDim) {
+    p_sum += chunk_param_square_sum[i];
+    tdiv_sum += chunk_trust_ratio_div_square_sum[i];
+  }
+  using BlockReduce = cub::BlockReduce<MT, BlockDim>;
+  __shared__ typename BlockReduce::TempStorage storage;
+  p_sum = BlockReduce(storage).Reduce(p_sum, cub::Sum());
+  __syncthreads();
+  tdiv_sum = BlockReduce(storage).Reduce(tdiv_sum, cub::Sum());
+  if (threadIdx.x == 0) {
+    param_square_norm[tensor_id] = p_sum;
+    trust_ratio_div_square_norm[tensor_id] = tdiv_sum;
+  }
+}
+
+template <typename T, typename MT, int VecSize, bool IsMultiPrecision>
+__global__ void FusedLambParamUpdateCUDAKernel(
+    int chunk_size,
+    const int64_t* __restrict__ chunk_tensor_ids,
+    const int64_t* __restrict__ chunk_offsets,
+    const int64_t* __restrict__ tensor_numels,
+    const int64_t* __restrict__ trust_ratio_div_offsets,
+    T* const* __restrict__ param_ptrs,
+    MT* const* __restrict__ master_param_ptrs,
+    const MT* __restrict__ trust_ratio_div,
+    const MT* __restrict__ param_square_norm,
+    const MT* __restrict__ trust_ratio_div_square_norm,
+    const MT* __restrict__ lr_ptr,
+    bool use_trust_ratio,
+    const bool* skip_update) {
+  if (skip_update && *skip_update) {
+    return;
+  }
+
+  int chunk_id = blockIdx.x;
+  int tensor_id = static_cast<int>(chunk_tensor_ids[chunk_id]);
+  int64_t offset = chunk_offsets[chunk_id];
+  int64_t size = tensor_numels[tensor_id] - offset;
+  if (size > chunk_size) {
+    size = chunk_size;
+  }
+
+  MT lr = *lr_ptr;
+  if (use_trust_ratio) {
+    MT pn = sqrt(param_square_norm[tensor_id]);
+    MT tn = sqrt(trust_ratio_div_square_norm[tensor_id]);
+    MT r = (pn > static_cast<MT>(0) && tn > static_cast<MT>(0))
+               ? pn / tn
+               : static_cast<MT>(1);
+    lr *= r;
+  }
+
+  T* p_ptr = param_ptrs[tensor_id] + offset;
+  MT* mp_ptr =
+      IsMultiPrecision ? master_param_ptrs[tensor_id] + offset : nullptr;
+  const MT* tdiv_ptr =
+      trust_ratio_div + trust_ratio_div_offsets[tensor_id] + offset;
+
+  int64_t i = static_cast<int64_t>(threadIdx.x) * VecSize;
+  int64_t stride = static_cast<int64_t>(blockDim.x) * VecSize;
+  for (; i + VecSize <= size; i += stride) {
+    phi::AlignedVector<T, VecSize> p_vec;
+    phi::AlignedVector<MT, VecSize> mp_vec;
+    phi::AlignedVector<MT, VecSize> tdiv_vec;
+    if (IsMultiPrecision) {
+      phi::Load(mp_ptr + i, &mp_vec);
+    } else {
+      phi::Load(p_ptr + i, &p_vec);
+    }
+    phi::Load(tdiv_ptr + i, &tdiv_vec);
+#pragma unroll
+    for (int j = 0; j < VecSize; ++j) {
+      MT p = IsMultiPrecision ? mp_vec[j] : static_cast<MT>(p_vec[j]);
+      MT p_new = p - lr * tdiv_vec[j];
+      p_vec[j] = static_cast<T>(p_new);
+      mp_vec[j] = p_new;
+    }
+    phi::Store(p_vec, p_ptr + i);
+    if (IsMultiPrecision) {
+      phi::Store(mp_vec, mp_ptr + i);
+    }
+  }
+
+  for (; i < size; ++i) {
+    MT p = IsMultiPrecision ? mp_ptr[i] : static_cast<MT>(p_ptr[i]);
+    MT p_new = p - lr * tdiv_ptr[i];
+    p_ptr[i] = static_cast<T>(p_new);
+    if (IsMultiPrecision) {
+      mp_ptr[i] = p_new;
+    }
+  }
+}
+
+template <typename MT>
+__global__ void FusedLambBetaPowUpdateCUDAKernel(
+    MT* const* __restrict__ beta1_pow_ptrs,
+    MT* const* __restrict__ beta2_pow_ptrs,
+    MT beta1,
+    MT beta2,
+    int n,
+    const bool* skip_update) {
+  if (skip_update && *skip_update) {
+    return;
+  }
+  int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx < n) {
+    beta1_pow_ptrs[idx][0] *= beta1;
+    beta2_pow_ptrs[idx][0] *= beta2;
+  }
+}
+
+template <typename Context>
+static void CopyTensorIfDifferent(const Context& dev_ctx,
+                                  const std::vector<const DenseTensor*>& src,
+                                  const std::vector<DenseTensor*>& dst,
+                                  bool use_src_place = false) {
+  for (size_t i = 0; i < src.size(); ++i) {
+    if (src[i] != dst[i]) {
+      VLOG(10) << "Copy Tensor " << i;
+      phi::Place place = (use_src_place ? src[i]->place() : dev_ctx.GetPlace());
+      phi::Copy<Context>(dev_ctx, *(src[i]), place, false, dst[i]);
+    }
+  }
+}
+
+template <typename T, typename TensorT>
+static int GetVecSizeFromTensors(const std::vector<TensorT*>& tensors,
+                                 int vec_size = 4) {
+  for (const auto* t : tensors) {
+    vec_size = min(vec_size, GetVectorizedSize(t->template data<T>()));
+  }
+  return vec_size;
+}
+
+template <typename T, typename Context>
+void FusedLambKernel(
+    const Context& dev_ctx,
+    const std::vector<const DenseTensor*>& params,
+    const std::vector<const DenseTensor*>& grads,
+    const DenseTensor& learning_rate,
+    const std::vector<const DenseTensor*>& moments1,
+    const std::vector<const DenseTensor*>& moments2,
+    const std::vector<const DenseTensor*>& beta1_pows,
+    const std::vector<const DenseTensor*>& beta2_pows,
+    const paddle::optional<std::vector<const DenseTensor*>>& master_params,
+    const paddle::optional<DenseTensor>& skip_update,
+    const Scalar& beta1,
+    const Scalar& beta2,
+    const Scalar& epsilon,
+    int chunk_size,
+    float weight_decay,
+    bool always_adapt,
+    bool multi_precision,
+    std::vector<DenseTensor*> params_out,
+    std::vector<DenseTensor*> moments1_out,
+    std::vector<DenseTensor*> moments2_out,
+    std::vector<DenseTensor*> beta1_pows_out,
+    std::vector<DenseTensor*> beta2_pows_out,
+    std::vector<DenseTensor*> master_params_out) {
+  using MT = typename phi::dtype::MPTypeTrait<T>::Type;
+  constexpr int kBlockDim = 512;
+
+  if (!multi_precision) {
+    constexpr auto kIsSameType = std::is_same<T, MT>::value;
+    PADDLE_ENFORCE_EQ(
+        kIsSameType,
+        true,
+        phi::errors::InvalidArgument(
+            "When multi_precision=False, T and MT must be the same type."));
+  }
+
+  auto n = params.size();
+  if (n == 0) {
+    return;
+  }
+
+  auto beta1_pow_first = beta1_pows[0];
+  auto beta2_pow_first = beta2_pows[0];
+  for (size_t i = 1; i < beta1_pows.size(); i++) {
+    PADDLE_ENFORCE_EQ(beta1_pow_first->place(),
+                      beta1_pows[i]->place(),
+                      phi::errors::InvalidArgument(
+                          "All Beta1Pow must be in the same place."));
+    PADDLE_ENFORCE_EQ(beta2_pow_first->place(),
+                      beta2_pows[i]->place(),
+                      phi::errors::InvalidArgument(
+                          "All Beta2Pow must be in the same place."));
+  }
+  PADDLE_ENFORCE_EQ(
+      beta1_pow_first->place(),
+      beta2_pow_first->place(),
+      phi::errors::InvalidArgument(
+          "Input(Beta1Pows) and Input(Beta2Pows) must be in the same place."));
+  bool is_cpu_betapow = (beta1_pow_first->place() == CPUPlace());
+
+  CopyTensorIfDifferent(dev_ctx, params, params_out);
+  CopyTensorIfDifferent(dev_ctx, moments1, moments1_out);
+  CopyTensorIfDifferent(dev_ctx, moments2, moments2_out);
+  CopyTensorIfDifferent(dev_ctx, beta1_pows, beta1_pows_out, true);
+  CopyTensorIfDifferent(dev_ctx, beta2_pows, beta2_pows_out, true);
+  if (master_params) {
+    CopyTensorIfDifferent(dev_ctx, master_params.get(), master_params_out);
+  }
+
+  // Unlike fused_adam, the skip_update flag stays on the device: every
+  // kernel checks it, so a GPU flag does not force a synchronization here.
+  const bool* skip_update_dev_flag = nullptr;
+  if (skip_update) {
+    PADDLE_ENFORCE_EQ(
+        skip_update->numel(),
+        1,
+        errors::InvalidArgument("Input(SkipUpdate) size must be 1, but get %d",
+                                skip_update->numel()));
+    if (skip_update->place().GetType() == phi::AllocationType::CPU) {
+      if (*skip_update->data<bool>()) {
+        VLOG(4) << "Lamb skip update";
+        return;
+      }
+    } else {
+      skip_update_dev_flag = skip_update->data<bool>();
+    }
+  }
+
+  auto weight_decay_mt = static_cast<MT>(weight_decay);
+  auto beta1_mt = beta1.to<MT>();
+  auto beta2_mt = beta2.to<MT>();
+  auto epsilon_mt = epsilon.to<MT>();
+  // Mirrors the single-tensor lamb kernel: the trust ratio only matters when
+  // there is weight decay, unless the caller asks for it unconditionally.
+  bool use_trust_ratio = weight_decay > 0 || always_adapt;
+
+  int vec_size = GetVecSizeFromTensors<T>(params_out);
+  vec_size = GetVecSizeFromTensors<T>(grads, vec_size);
+  vec_size = GetVecSizeFromTensors<MT>(moments1_out, vec_size);
+  vec_size = GetVecSizeFromTensors<MT>(moments2_out, vec_size);
+  if (master_params) {
+    vec_size = GetVecSizeFromTensors<MT>(master_params_out, vec_size);
+  }
+  chunk_size = ((chunk_size + vec_size - 1) / vec_size) * vec_size;
+
+  // Flatten the parameter list into a chunk table and gather all data
+  // pointers into one staging buffer (each slot is 8 bytes) so a single
+  // host-to-device copy publishes the whole launch description.
+  //   [0, 7n)        grad/param/master/mom1/mom2/beta1_pow/beta2_pow ptrs
+  //   [7n, 9n)       per-tensor numels and trust_ratio_div offsets
+  //   [9n, 10n + 1)  per-tensor chunk range starts (prefix sum, n + 1)
+  //   [10n + 1, ...) per-chunk tensor ids, then per-chunk element offsets
+  int64_t total_chunks = 0;
+  int64_t tdiv_numel = 0;
+  std::vector<int64_t> tensor_chunks(n);
+  for (size_t i = 0; i < n; ++i) {
+    auto numel = params_out[i]->numel();
+    tensor_chunks[i] = (numel + chunk_size - 1) / chunk_size;
+    total_chunks += tensor_chunks[i];
+    // Keep each tensor's slice vector-aligned within the shared buffer.
+    tdiv_numel += (numel + 3) / 4 * 4;
+  }
+
+  size_t meta_size = 10 * n + 1 + 2 * total_chunks;
+  std::vector<int64_t> host_meta(meta_size);
+  int64_t* grad_ptrs = host_meta.data();
+  int64_t* param_ptrs = grad_ptrs + n;
+  int64_t* master_ptrs = param_ptrs + n;
+  int64_t* mom1_ptrs = master_ptrs + n;
+  int64_t* mom2_ptrs = mom1_ptrs + n;
+  int64_t* beta1_pow_ptrs = mom2_ptrs + n;
+  int64_t* beta2_pow_ptrs = beta1_pow_ptrs + n;
+  int64_t* numels = beta2_pow_ptrs + n;
+  int64_t* tdiv_offsets = numels + n;
+  int64_t* chunk_starts = tdiv_offsets + n;
+  int64_t* chunk_tensor_ids = chunk_starts + n + 1;
+  int64_t* chunk_offsets = chunk_tensor_ids + total_chunks;
+
+  int64_t chunk_id = 0;
+  int64_t tdiv_offset = 0;
+  chunk_starts[0] = 0;
+  for (size_t i = 0; i < n; ++i) {
+    grad_ptrs[i] = reinterpret_cast<int64_t>(grads[i]->data<T>());
+    param_ptrs[i] =
+        reinterpret_cast<int64_t>(dev_ctx.template Alloc<T>(params_out[i]));
+    master_ptrs[i] =
+        multi_precision ? reinterpret_cast<int64_t>(
+                              dev_ctx.template Alloc<MT>(master_params_out[i]))
+                        : 0;
+    mom1_ptrs[i] =
+        reinterpret_cast<int64_t>(dev_ctx.template Alloc<MT>(moments1_out[i]));
+    mom2_ptrs[i] =
+        reinterpret_cast<int64_t>(dev_ctx.template Alloc<MT>(moments2_out[i]));
+    if (!is_cpu_betapow) {
+      beta1_pow_ptrs[i] = reinterpret_cast<int64_t>(
+          dev_ctx.template Alloc<MT>(beta1_pows_out[i]));
+      beta2_pow_ptrs[i] = reinterpret_cast<int64_t>(
+          dev_ctx.template Alloc<MT>(beta2_pows_out[i]));
+    } else {
+      beta1_pow_ptrs[i] = 0;
+      beta2_pow_ptrs[i] = 0;
+    }
+    auto numel = params_out[i]->numel();
+    numels[i] = numel;
+    tdiv_offsets[i] = tdiv_offset;
+    tdiv_offset += (numel + 3) / 4 * 4;
+    for (int64_t c = 0; c < tensor_chunks[i]; ++c) {
+      chunk_tensor_ids[chunk_id] = static_cast<int64_t>(i);
+      chunk_offsets[chunk_id] = c * chunk_size;
+      ++chunk_id;
+    }
+    chunk_starts[i + 1] = chunk_id;
+  }
+
+  auto stream = dev_ctx.stream();
+  auto meta_buf = memory_utils::Alloc(
+      dev_ctx.GetPlace(),
+      meta_size * sizeof(int64_t),
+      phi::Stream(reinterpret_cast<phi::StreamId>(stream)));
+  auto* dev_meta = reinterpret_cast<int64_t*>(meta_buf->ptr());
+  memory_utils::Copy(dev_ctx.GetPlace(),
+                     dev_meta,
+                     CPUPlace(),
+                     host_meta.data(),
+                     meta_size * sizeof(int64_t),
+                     stream);
+
+  auto* dev_grad_ptrs = reinterpret_cast<const T* const*>(dev_meta);
+  auto* dev_param_ptrs = reinterpret_cast<T* const*>(dev_meta + n);
+  auto* dev_master_ptrs = reinterpret_cast<MT* const*>(dev_meta + 2 * n);
+  auto* dev_mom1_ptrs = reinterpret_cast<MT* const*>(dev_meta + 3 * n);
+  auto* dev_mom2_ptrs = reinterpret_cast<MT* const*>(dev_meta + 4 * n);
+  auto* dev_beta1_pow_ptrs = reinterpret_cast<MT* const*>(dev_meta + 5 * n);
+  auto* dev_beta2_pow_ptrs = reinterpret_cast<MT* const*>(dev_meta + 6 * n);
+  const int64_t* dev_numels = dev_meta + 7 * n;
+  const int64_t* dev_tdiv_offsets = dev_meta + 8 * n;
+  const int64_t* dev_chunk_starts = dev_meta + 9 * n;
+  const int64_t* dev_chunk_tensor_ids = dev_meta + 10 * n + 1;
+  const int64_t* dev_chunk_offsets = dev_chunk_tensor_ids + total_chunks;
+
+  // Workspace: trust_ratio_div for every parameter, the per-chunk squared
+  // norm partials, and the per-tensor squared norms.
+  size_t workspace_numel = tdiv_numel + 2 * total_chunks + 2 * n;
+  auto workspace_buf = memory_utils::Alloc(
+      dev_ctx.GetPlace(),
+      workspace_numel * sizeof(MT),
+      phi::Stream(reinterpret_cast<phi::StreamId>(stream)));
+  auto* trust_ratio_div = reinterpret_cast<MT*>(workspace_buf->ptr());
+  MT* chunk_param_square_sum = trust_ratio_div + tdiv_numel;
+  MT* chunk_tdiv_square_sum = chunk_param_square_sum + total_chunks;
+  MT* param_square_norm = chunk_tdiv_square_sum + total_chunks;
+  MT* tdiv_square_norm = param_square_norm + n;
+
+  const MT* dev_beta1_pow = nullptr;
+  const MT* dev_beta2_pow = nullptr;
+  MT beta1_pow_value = static_cast<MT>(0);
+  MT beta2_pow_value = static_cast<MT>(0);
+  if (is_cpu_betapow) {
+    beta1_pow_value = *beta1_pow_first->data<MT>();
+    beta2_pow_value = *beta2_pow_first->data<MT>();
+  } else {
+    // The outputs are in-stream copies of the inputs, so reading them before
+    // the trailing beta pow update observes the pre-step values.
+    dev_beta1_pow = beta1_pows_out[0]->data<MT>();
+    dev_beta2_pow = beta2_pows_out[0]->data<MT>();
+  }
+
+#define PD_LAUNCH_FUSED_LAMB_KERNEL_BASE(__multi_precision, __vec_size)       \
+  do {                                                                        \
+    FusedLambTrustRatioDivCUDAKernel<T,                                       \
+                                     MT,                                      \
+                                     __vec_size,                              \
+                                     kBlockDim,                               \
+                                     __multi_precision>                       \
+        <<<total_chunks, kBlockDim, 0, stream>>>(chunk_size,                  \
+                                                 dev_chunk_tensor_ids,        \
+                                                 dev_chunk_offsets,           \
+                                                 dev_numels,                  \
+                                                 dev_tdiv_offsets,            \
+                                                 dev_grad_ptrs,               \
+                                                 dev_param_ptrs,              \
+                                                 dev_master_ptrs,             \
+                                                 dev_mom1_ptrs,               \
+                                                 dev_mom2_ptrs,               \
+                                                 trust_ratio_div,             \
+                                                 chunk_param_square_sum,      \
+                                                 chunk_tdiv_square_sum,       \
+                                                 dev_beta1_pow,               \
+                                                 dev_beta2_pow,               \
+                                                 beta1_pow_value,             \
+                                                 beta2_pow_value,             \
+                                                 weight_decay_mt,             \
+                                                 beta1_mt,                    \
+                                                 beta2_mt,                    \
+                                                 epsilon_mt,                  \
+                                                 skip_update_dev_flag);       \
+    if (use_trust_ratio) {                                                    \
+      FusedLambNormReduceCUDAKernel<MT, kBlockDim>                            \
+          <<<n, kBlockDim, 0, stream>>>(chunk_param_square_sum,               \
+                                        chunk_tdiv_square_sum,                \
+                                        dev_chunk_starts,                     \
+                                        param_square_norm,                    \
+                                        tdiv_square_norm);                    \
+    }                                                                         \
+    FusedLambParamUpdateCUDAKernel<T, MT, __vec_size, __multi_precision>      \
+        <<<total_chunks, kBlockDim, 0, stream>>>(chunk_size,                  \
+                                                 dev_chunk_tensor_ids,        \
+                                                 dev_chunk_offsets,           \
+                                                 dev_numels,                  \
+                                                 dev_tdiv_offsets,            \
+                                                 dev_param_ptrs,              \
+                                                 dev_master_ptrs,             \
+                                                 trust_ratio_div,             \
+                                                 param_square_norm,           \
+                                                 tdiv_square_norm,            \
+                                                 learning_rate.data<MT>(),    \
+                                                 use_trust_ratio,             \
+                                                 skip_update_dev_flag);       \
+  } while (0)
+
+#define PD_LAUNCH_FUSED_LAMB_KERNEL(__vec_size)               \
+  case __vec_size: {                                          \
+    if (multi_precision) {                                    \
+      PD_LAUNCH_FUSED_LAMB_KERNEL_BASE(true, __vec_size);     \
+    } else {                                                  \
+      PD_LAUNCH_FUSED_LAMB_KERNEL_BASE(false, __vec_size);    \
+    }                                                         \
+  } break
+
+  switch (vec_size) {
+    PD_LAUNCH_FUSED_LAMB_KERNEL(4);
+    PD_LAUNCH_FUSED_LAMB_KERNEL(2);
+    PD_LAUNCH_FUSED_LAMB_KERNEL(1);
+    default:
+      PADDLE_THROW(
+          errors::InvalidArgument("Unsupported vectorized size %d", vec_size));
+      break;
+  }
+
+#undef PD_LAUNCH_FUSED_LAMB_KERNEL
+#undef PD_LAUNCH_FUSED_LAMB_KERNEL_BASE
+
+  if (is_cpu_betapow) {
+    for (size_t i = 0; i < n; i++) {
+      VLOG(10) << "CPU Update BetaPow here...";
+      auto* beta1_ptr = dev_ctx.template HostAlloc<MT>(beta1_pows_out[i]);
+      (*beta1_ptr) *= beta1_mt;
+      auto* beta2_ptr = dev_ctx.template HostAlloc<MT>(beta2_pows_out[i]);
+      (*beta2_ptr) *= beta2_mt;
+    }
+  } else {
+    VLOG(10) << "GPU Update BetaPow here...";
+    constexpr int kBetaPowBlockDim = 256;
+    auto blocks = (n + kBetaPowBlockDim - 1) / kBetaPowBlockDim;
+    FusedLambBetaPowUpdateCUDAKernel<MT>
+        <<<blocks, kBetaPowBlockDim, 0, stream>>>(dev_beta1_pow_ptrs,
+                                                  dev_beta2_pow_ptrs,
+                                                  beta1_mt,
+                                                  beta2_mt,
+                                                  static_cast<int>(n),
+                                                  skip_update_dev_flag);
+  }
+}
+
+}  // namespace phi
+
+PD_REGISTER_KERNEL(fused_lamb,
+                   GPU,
+                   ALL_LAYOUT,
+                   phi::FusedLambKernel,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16,
+                   float,
+                   double) {
+  // Skip beta1_pow, beta2_pow, skip_update data transform
+  kernel->InputAt(5).SetBackend(phi::Backend::ALL_BACKEND);
+  kernel->InputAt(6).SetBackend(phi::Backend::ALL_BACKEND);
+  kernel->InputAt(8).SetBackend(phi::Backend::ALL_BACKEND);
+  kernel->OutputAt(1).SetDataType(phi::DataType::UNDEFINED);
+  kernel->OutputAt(2).SetDataType(phi::DataType::UNDEFINED);
+  kernel->OutputAt(3).SetDataType(phi::DataType::UNDEFINED);
+  kernel->OutputAt(4).SetDataType(phi::DataType::UNDEFINED);
+  kernel->OutputAt(5).SetDataType(phi::DataType::UNDEFINED);
+}
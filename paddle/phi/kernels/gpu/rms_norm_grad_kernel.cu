@@ -22,6 +22,7 @@ limitations under the License. */
 #include "paddle/phi/common/amp_type_traits.h"
 #include "paddle/phi/core/dense_tensor.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/core/tensor_utils.h"
 #ifdef PADDLE_WITH_HIP
 #include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
@@ -159,6 +160,7 @@ void RmsNormGradKernel(const Context& dev_ctx,
                        const DenseTensor& x,
                        const paddle::optional<DenseTensor>& bias,
                        const paddle::optional<DenseTensor>& residual,
+                       const paddle::optional<DenseTensor>& residual_out,
                        const DenseTensor& norm_weight,
                        const paddle::optional<DenseTensor>& norm_bias,
                        const DenseTensor& inv_var,
@@ -167,14 +169,38 @@ void RmsNormGradKernel(const Context& dev_ctx,
                        const int begin_norm_axis,
                        const float quant_scale,
                        DenseTensor* grad_x,
+                       DenseTensor* grad_residual,
                        DenseTensor* grad_norm_weight) {
-  if (bias || residual || norm_bias) {
-    PADDLE_THROW(phi::errors::Unimplemented(
-        "bias or residual or norm_bias is not supported yet"));
+  if (bias || norm_bias) {
+    PADDLE_THROW(
+        phi::errors::Unimplemented("bias or norm_bias is not supported yet"));
   }
   if (quant_scale > 0.0f) {
     PADDLE_THROW(phi::errors::Unimplemented("quant is not supported yet"));
   }
+  if (residual) {
+    // The norm saw residual_out = x + residual, so the gradient of the
+    // norm input applies to both addends unchanged.
+    PADDLE_ENFORCE_EQ(
+        residual_out.is_initialized(),
+        true,
+        phi::errors::InvalidArgument(
+            "residual_out must be passed to rms_norm_grad when the forward "
+            "fused a residual input."));
+    cuda_rms_norm_gradient<T, Context>(dev_ctx,
+                                       residual_out.get(),
+                                       norm_weight,
+                                       inv_var,
+                                       dy,
+                                       epsilon,
+                                       grad_x,
+                                       grad_norm_weight,
+                                       begin_norm_axis);
+    if (grad_residual != nullptr) {
+      phi::Copy(dev_ctx, *grad_x, dev_ctx.GetPlace(), false, grad_residual);
+    }
+    return;
+  }
   cuda_rms_norm_gradient<T, Context>(dev_ctx,
                                      x,
                                      norm_weight,
@@ -0,0 +1,277 @@
+// Copyright (c) 2024 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+
+#include <limits>
+
+#include "paddle/phi/backends/gpu/gpu_context.h"
+#include "paddle/phi/backends/gpu/gpu_device_function.h"
+#include "paddle/phi/backends/gpu/gpu_launch_config.h"
+
+namespace phi {
+
+// Segmented reductions over packed (ragged) layouts. Values of all
+// sequences are concatenated into one array and segment s spans
+// [offsets[s], offsets[s + 1]) - the CSR convention - so none of the
+// padding a dense [batch, max_len] layout carries is ever touched.
+//
+// Scheduling splits the work by segment length: every launch runs a warp
+// kernel where one warp owns one short segment, and a block kernel where
+// one block owns one long segment; each skips segments on the other side
+// of kSegmentedWarpLimit. Short segments therefore never leave a whole
+// block idle, and long ones still get a full block of threads.
+
+constexpr int kSegmentedWarpSize = 32;
+constexpr int kSegmentedWarpLimit = 256;
+constexpr int kSegmentedBlockDim = 256;
+
+namespace detail {
+
+template <typename T>
+struct SegmentedSumOp {
+  static __device__ __forceinline__ T Init() { return static_cast<T>(0); }
+  static __device__ __forceinline__ T Apply(T a, T b) { return a + b; }
+};
+
+template <typename T>
+struct SegmentedMaxOp {
+  static __device__ __forceinline__ T Init() {
+    return std::numeric_limits<T>::lowest();
+  }
+  static __device__ __forceinline__ T Apply(T a, T b) {
+    return a > b ? a : b;
+  }
+};
+
+template <typename T, typename Op>
+__device__ __forceinline__ T WarpAllReduce(T val) {
+  for (int offset = kSegmentedWarpSize / 2; offset > 0; offset >>= 1) {
+    val = Op::Apply(
+        val,
+        phi::backends::gpu::CudaShuffleDownSync(0xffffffffu, val, offset));
+  }
+  // lane 0 holds the result; broadcast it so every lane can use it
+  return phi::backends::gpu::CudaShuffleSync(0xffffffffu, val, 0);
+}
+
+template <typename T, typename Op>
+__device__ __forceinline__ T BlockAllReduce(T val, T* shared) {
+  const int lane = threadIdx.x % kSegmentedWarpSize;
+  const int warp = threadIdx.x / kSegmentedWarpSize;
+  val = WarpAllReduce<T, Op>(val);
+  if (lane == 0) {
+    shared[warp] = val;
+  }
+  __syncthreads();
+  const int num_warps = blockDim.x / kSegmentedWarpSize;
+  val = (threadIdx.x < num_warps) ? shared[threadIdx.x] : Op::Init();
+  if (warp == 0) {
+    val = WarpAllReduce<T, Op>(val);
+    if (lane == 0) {
+      shared[0] = val;
+    }
+  }
+  __syncthreads();
+  val = shared[0];
+  __syncthreads();
+  return val;
+}
+
+}  // namespace detail
+
+// mode selected at compile time so the three family members share the
+// traversal and scheduling code below
+enum class SegmentedMode { kSum, kMax, kLogsumexp, kSoftmax };
+
+template <typename T, typename IndexT, SegmentedMode Mode>
+__device__ __forceinline__ void SegmentedApply(const T* values,
+                                               IndexT begin,
+                                               IndexT end,
+                                               int lane,
+                                               int num_lanes,
+                                               T* shared,  // block path only
+                                               T* out,
+                                               int segment) {
+  using MaxOp = detail::SegmentedMaxOp<T>;
+  using SumOp = detail::SegmentedSumOp<T>;
+  auto reduce = [&](T val, auto op_tag) -> T {
+    using Op = decltype(op_tag);
+    return (shared != nullptr)
+               ? detail::BlockAllReduce<T, Op>(val, shared)
+               : detail::WarpAllReduce<T, Op>(val);
+  };
+
+  if (Mode == SegmentedMode::kSum) {
+    T acc = SumOp::Init();
+    for (IndexT i = begin + lane; i < end; i += num_lanes) {
+      acc = SumOp::Apply(acc, values[i]);
+    }
+    acc = reduce(acc, SumOp());
+    if (lane == 0) {
+      out[segment] = acc;
+    }
+    return;
+  }
+
+  // remaining modes all start from the segment max for stability
+  T max_val = MaxOp::Init();
+  for (IndexT i = begin + lane; i < end; i += num_lanes) {
+    max_val = MaxOp::Apply(max_val, values[i]);
+  }
+  max_val = reduce(max_val, MaxOp());
+
+  if (Mode == SegmentedMode::kMax) {
+    if (lane == 0) {
+      out[segment] = max_val;
+    }
+    return;
+  }
+
+  T sum_exp = SumOp::Init();
+  for (IndexT i = begin + lane; i < end; i += num_lanes) {
+    sum_exp = SumOp::Apply(
+        sum_exp, exp(static_cast<T>(values[i] - max_val)));
+  }
+  sum_exp = reduce(sum_exp, SumOp());
+
+  if (Mode == SegmentedMode::kLogsumexp) {
+    if (lane == 0) {
+      out[segment] = log(sum_exp) + max_val;
+    }
+    return;
+  }
+
+  // softmax writes back over the packed layout
+  const T inv_sum = static_cast<T>(1.0) / sum_exp;
+  for (IndexT i = begin + lane; i < end; i += num_lanes) {
+    out[i] = exp(static_cast<T>(values[i] - max_val)) * inv_sum;
+  }
+}
+
+template <typename T, typename IndexT, SegmentedMode Mode>
+__global__ void SegmentedWarpKernel(const T* values,
+                                    const IndexT* offsets,
+                                    int num_segments,
+                                    T* out) {
+  const int warp_id =
+      (blockIdx.x * blockDim.x + threadIdx.x) / kSegmentedWarpSize;
+  if (warp_id >= num_segments) {
+    return;
+  }
+  const IndexT begin = offsets[warp_id];
+  const IndexT end = offsets[warp_id + 1];
+  if (end - begin > kSegmentedWarpLimit) {
+    return;  // the block kernel owns long segments
+  }
+  const int lane = threadIdx.x % kSegmentedWarpSize;
+  SegmentedApply<T, IndexT, Mode>(
+      values, begin, end, lane, kSegmentedWarpSize, nullptr, out, warp_id);
+}
+
+template <typename T, typename IndexT, SegmentedMode Mode>
+__global__ void SegmentedBlockKernel(const T* values,
+                                     const IndexT* offsets,
+                                     int num_segments,
+                                     T* out) {
+  __shared__ T shared[kSegmentedBlockDim / kSegmentedWarpSize];
+  const int segment = blockIdx.x;
+  if (segment >= num_segments) {
+    return;
+  }
+  const IndexT begin = offsets[segment];
+  const IndexT end = offsets[segment + 1];
+  if (end - begin <= kSegmentedWarpLimit) {
+    return;  // the warp kernel already handled it
+  }
+  SegmentedApply<T, IndexT, Mode>(values,
+                                  begin,
+                                  end,
+                                  threadIdx.x,
+                                  blockDim.x,
+                                  shared,
+                                  out,
+                                  segment);
+}
+
+template <typename T, typename IndexT, SegmentedMode Mode>
+void LaunchSegmented(const phi::GPUContext& dev_ctx,
+                     const T* values,
+                     const IndexT* offsets,
+                     int num_segments,
+                     T* out) {
+  if (num_segments <= 0) {
+    return;
+  }
+  auto stream = dev_ctx.stream();
+  const int warps_per_block = kSegmentedBlockDim / kSegmentedWarpSize;
+  const int warp_grid =
+      (num_segments + warps_per_block - 1) / warps_per_block;
+  SegmentedWarpKernel<T, IndexT, Mode>
+      <<<warp_grid, kSegmentedBlockDim, 0, stream>>>(
+          values, offsets, num_segments, out);
+  SegmentedBlockKernel<T, IndexT, Mode>
+      <<<num_segments, kSegmentedBlockDim, 0, stream>>>(
+          values, offsets, num_segments, out);
+}
+
+// out[s] = sum of segment s; shape [num_segments]
+template <typename T, typename IndexT>
+void SegmentedReduceSum(const phi::GPUContext& dev_ctx,
+                        const T* values,
+                        const IndexT* offsets,
+                        int num_segments,
+                        T* out) {
+  LaunchSegmented<T, IndexT, SegmentedMode::kSum>(
+      dev_ctx, values, offsets, num_segments, out);
+}
+
+// out[s] = max of segment s; shape [num_segments]
+template <typename T, typename IndexT>
+void SegmentedReduceMax(const phi::GPUContext& dev_ctx,
+                        const T* values,
+                        const IndexT* offsets,
+                        int num_segments,
+                        T* out) {
+  LaunchSegmented<T, IndexT, SegmentedMode::kMax>(
+      dev_ctx, values, offsets, num_segments, out);
+}
+
+// out[s] = log(sum(exp(segment s))), max-shifted; shape [num_segments]
+template <typename T, typename IndexT>
+void SegmentedLogsumexp(const phi::GPUContext& dev_ctx,
+                        const T* values,
+                        const IndexT* offsets,
+                        int num_segments,
+                        T* out) {
+  LaunchSegmented<T, IndexT, SegmentedMode::kLogsumexp>(
+      dev_ctx, values, offsets, num_segments, out);
+}
+
+// out has the same packed layout as values; each segment sums to one
+template <typename T, typename IndexT>
+void SegmentedSoftmax(const phi::GPUContext& dev_ctx,
+                      const T* values,
+                      const IndexT* offsets,
+                      int num_segments,
+                      T* out) {
+  LaunchSegmented<T, IndexT, SegmentedMode::kSoftmax>(
+      dev_ctx, values, offsets, num_segments, out);
+}
+
+}  // namespace phi
+
+#endif
@@ -19,7 +19,6 @@
 #include "paddle/phi/backends/gpu/gpu_primitives.h"
 #include "paddle/phi/common/amp_type_traits.h"
 #include "paddle/phi/core/kernel_registry.h"
-#include "paddle/phi/core/mixed_vector.h"
 
 namespace phi {
 
@@ -156,10 +155,9 @@ void SGDDenseParamSparseGradKernel(
   int thread_x = kThreadsPerBlock;
   int max_threads = dev_ctx.GetMaxPhysicalThreadCount();
   int max_blocks = std::max(max_threads / kThreadsPerBlock, 1);
-  phi::MixVector<int64_t> mixv_in_rows(&in_rows);
   SparseSGDFunctorKernel<<<max_blocks, thread_x, 0, dev_ctx.stream()>>>(
       in_data,
-      mixv_in_rows.CUDAData(dev_ctx.GetPlace()),
+      grad.DeviceRows(dev_ctx.GetPlace()),
       learning_rate.data<T>(),
       out_data,
       in_row_numel,
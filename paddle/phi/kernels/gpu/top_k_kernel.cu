@@ -20,7 +20,6 @@
 #include "paddle/phi/common/bfloat16.h"
 #include "paddle/phi/core/kernel_registry.h"
 #include "paddle/phi/core/tensor_utils.h"
-#include "paddle/phi/kernels/funcs/gather.cu.h"
 #include "paddle/phi/kernels/funcs/math_function.h"
 #include "paddle/phi/kernels/funcs/top_k_function_cuda.h"
 
@@ -126,12 +125,14 @@ void TopkKernel(const Context& dev_ctx,
     }
 
 #if defined(PADDLE_WITH_CUDA) && CUDA_VERSION >= 9000
-    if (input_width >= 1024 && in_dims.size() == 1) {
+    if (input_width >= 1024) {
       // 1. Gather TopK, but without sorting
       constexpr int max_num_threads = 1024;
+      constexpr int64_t kMaxGridX = 8192;
+      const int radix_grid = static_cast<int>(std::min(input_height, kMaxGridX));
       if (largest) {
         phi::funcs::RadixTopK<T, true>
-            <<<input_height, max_num_threads, 0, dev_ctx.stream()>>>(
+            <<<radix_grid, max_num_threads, 0, dev_ctx.stream()>>>(
                 input_data,
                 k,
                 input_height,
@@ -140,7 +141,7 @@ void TopkKernel(const Context& dev_ctx,
                 indices_data);
       } else {
         phi::funcs::RadixTopK<T, false>
-            <<<input_height, max_num_threads, 0, dev_ctx.stream()>>>(
+            <<<radix_grid, max_num_threads, 0, dev_ctx.stream()>>>(
                 input_data,
                 k,
                 input_height,
@@ -168,8 +169,18 @@ void TopkKernel(const Context& dev_ctx,
                                     &sorted_output,
                                     &sorted_indices,
                                     largest)) {
-          funcs::GPUGather<int64_t, int64_t>(
-              dev_ctx, *indices, sorted_indices, &gather_indices);
+          // sorted_indices hold per-row positions into the gathered top-k;
+          // map them back to original columns row by row
+          const int64_t remap_n = input_height * k;
+          const int remap_block = 256;
+          const int remap_grid = (remap_n + remap_block - 1) / remap_block;
+          phi::funcs::GatherTopkRowWise<int64_t>
+              <<<remap_grid, remap_block, 0, dev_ctx.stream()>>>(
+                  indices_data,
+                  sorted_indices.data<int64_t>(),
+                  gather_indices.data<int64_t>(),
+                  input_height,
+                  k);
           Copy(dev_ctx, gather_indices, indices->place(), false, indices);
           Copy(dev_ctx, sorted_output, out->place(), false, out);
           return;
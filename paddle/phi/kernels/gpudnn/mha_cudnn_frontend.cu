@@ -372,7 +372,8 @@ void fused_attn_arbitrary_seqlen_fwd_impl(int64_t b,
                                layout,
                                bias_type,
                                mask_type,
-                               tensorType};
+                               tensorType,
+                               false};
 
     namespace fe = cudnn_frontend;
     using graph_and_tensors = std::tuple<
@@ -647,6 +648,7 @@ void fused_attn_arbitrary_seqlen_bwd_impl(int64_t b,
                                           MHA_Layout layout,
                                           MHA_Bias_Type bias_type,
                                           MHA_Mask_Type mask_type,
+                                          bool deterministic,
                                           void *devPtrQ,
                                           void *devPtrKTranspose,
                                           void *devPtrVTranspose,
@@ -691,7 +693,8 @@ void fused_attn_arbitrary_seqlen_bwd_impl(int64_t b,
                                layout,
                                bias_type,
                                mask_type,
-                               tensorType};
+                               tensorType,
+                               deterministic};
 
     namespace fe = cudnn_frontend;
     using graph_and_tensors = std::tuple<
@@ -792,6 +795,12 @@ void fused_attn_arbitrary_seqlen_bwd_impl(int64_t b,
 
       sdpa_backward_options.set_alibi_mask(is_alibi);
 
+      // Trade the atomic dQ accumulation for a serial reduction so that the
+      // backward pass is bitwise reproducible across runs.
+      if (deterministic) {
+        sdpa_backward_options.set_deterministic_algorithm(true);
+      }
+
       if (is_bias) {
         bias = mha_graph->tensor(
             fe::graph::Tensor_attributes()
@@ -68,6 +68,7 @@ struct FADescriptor_v1 {
   MHA_Bias_Type bias_type;
   MHA_Mask_Type mask_type;
   cudnn_frontend::DataType_t tensor_type;
+  bool deterministic;
 
   bool operator<(const FADescriptor_v1& rhs) const {
     return std::tie(b,
@@ -84,7 +85,8 @@ struct FADescriptor_v1 {
                     layout,
                     mask_type,
                     bias_type,
-                    tensor_type) < std::tie(rhs.b,
+                    tensor_type,
+                    deterministic) < std::tie(rhs.b,
                                             rhs.h,
                                             rhs.hg,
                                             rhs.s_q,
@@ -98,7 +100,8 @@ struct FADescriptor_v1 {
                                             rhs.layout,
                                             rhs.mask_type,
                                             rhs.bias_type,
-                                            rhs.tensor_type);
+                                            rhs.tensor_type,
+                                            rhs.deterministic);
   }
 };
 
@@ -144,6 +147,7 @@ void fused_attn_arbitrary_seqlen_bwd_impl(int64_t b,
                                           MHA_Layout layout,
                                           MHA_Bias_Type bias_type,
                                           MHA_Mask_Type mask_type,
+                                          bool deterministic,
                                           void* devPtrQ,
                                           void* devPtrKTranspose,
                                           void* devPtrVTranspose,
@@ -14,19 +14,162 @@ limitations under the License. */
 
 #include "paddle/phi/kernels/sparse/matmul_kernel.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "paddle/common/ddim.h"
 #include "paddle/phi/backends/cpu/cpu_context.h"
+#include "paddle/phi/core/enforce.h"
 #include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/core/meta_tensor.h"
+#include "paddle/phi/core/visit_type.h"
 
 namespace phi::sparse {
 
-// TODO(zhouwei25): implement CPU kernel of " CSR @ DENSE -> DENSE"
+namespace {
+
+// SpMM of one CSR batch: out[r, :] += values[idx] * dense[cols[idx], :].
+// Rows are grouped into log2(nnz) bins first, so a static parallel split
+// of one bin hands every thread rows of similar cost; splitting the raw
+// row range is badly unbalanced on power-law adjacency matrices. The
+// inner multiply-accumulate runs contiguously over the dense columns, a
+// form compilers vectorize.
+template <typename T, typename IntT>
+void CsrSpmmBatch(const IntT* crows,
+                  const IntT* cols,
+                  const T* values,
+                  const T* dense,
+                  T* out,
+                  const int64_t rows,
+                  const int64_t n) {
+  constexpr int kNumBins = 32;
+  auto bin_of = [](IntT nnz) {
+    int b = 0;
+    while (b < kNumBins - 1 && (static_cast<IntT>(1) << b) < nnz) {
+      ++b;
+    }
+    return b;
+  };
+  std::vector<int64_t> bin_start(kNumBins + 1, 0);
+  for (int64_t r = 0; r < rows; ++r) {
+    ++bin_start[bin_of(crows[r + 1] - crows[r]) + 1];
+  }
+  for (int b = 0; b < kNumBins; ++b) {
+    bin_start[b + 1] += bin_start[b];
+  }
+  std::vector<int64_t> order(rows);
+  {
+    std::vector<int64_t> fill(bin_start.begin(), bin_start.end() - 1);
+    for (int64_t r = 0; r < rows; ++r) {
+      order[fill[bin_of(crows[r + 1] - crows[r])]++] = r;
+    }
+  }
+  for (int b = 0; b < kNumBins; ++b) {
+    const int64_t begin = bin_start[b];
+    const int64_t end = bin_start[b + 1];
+    if (begin == end) {
+      continue;
+    }
+#ifdef PADDLE_WITH_MKLML
+#pragma omp parallel for if (end - begin > 1)
+#endif
+    for (int64_t i = begin; i < end; ++i) {
+      const int64_t r = order[i];
+      T* out_row = out + r * n;
+      std::fill(out_row, out_row + n, static_cast<T>(0));
+      for (IntT idx = crows[r]; idx < crows[r + 1]; ++idx) {
+        const T val = values[idx];
+        const T* in_row = dense + cols[idx] * n;
+        for (int64_t j = 0; j < n; ++j) {
+          out_row[j] += val * in_row[j];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
 template <typename T, typename Context>
-void MatmulCsrDenseKernel(const Context& dev_ctx UNUSED,
-                          const SparseCsrTensor& x UNUSED,
-                          const DenseTensor& y UNUSED,
-                          DenseTensor* out UNUSED) {
-  PADDLE_THROW(phi::errors::Unimplemented(
-      "Not support CPU kernel of 'sparse.matmul' now."));
+void MatmulCsrDenseKernel(const Context& dev_ctx,
+                          const SparseCsrTensor& x,
+                          const DenseTensor& y,
+                          DenseTensor* out) {
+  std::vector<int64_t> xdim_vec = common::vectorize(x.dims());
+  std::vector<int64_t> ydim_vec = common::vectorize(y.dims());
+  auto x_ndims = xdim_vec.size();
+  auto y_ndims = ydim_vec.size();
+  PADDLE_ENFORCE_EQ(
+      x_ndims,
+      y_ndims,
+      phi::errors::PreconditionNotMet("The dims size of Input(x) and Input(y) "
+                                      "should be equal, But received X's "
+                                      "dimensions=%d, Y's dimensions=%d.",
+                                      x_ndims,
+                                      y_ndims));
+  PADDLE_ENFORCE_GE(
+      x_ndims,
+      2,
+      phi::errors::InvalidArgument("the dims size of Input(x) and "
+                                   "Input(y) must be greater than "
+                                   "or equal to 2."));
+
+  for (size_t i = 0; i < x_ndims - 2; ++i) {
+    PADDLE_ENFORCE_EQ(xdim_vec[i],
+                      ydim_vec[i],
+                      phi::errors::InvalidArgument(
+                          "x.dim[%d] and x.dim[%d] must be eaqul.", i, i));
+  }
+
+  PADDLE_ENFORCE_EQ(
+      xdim_vec[x_ndims - 1],
+      ydim_vec[y_ndims - 2],
+      phi::errors::PreconditionNotMet(
+          "The shape of Input(x) and Input(y) is not suitable for matmul "
+          "opetation, x_dim[-1] must be equal to y_dim[-2]."));
+
+  // InferMeta of DenseTensor 'out'
+  std::vector<int64_t> out_dim_vec(ydim_vec);
+  out_dim_vec[y_ndims - 2] = xdim_vec[x_ndims - 2];
+  out_dim_vec[y_ndims - 1] = ydim_vec[y_ndims - 1];
+  MetaTensor meta_out(out);
+  meta_out.set_dims(common::make_ddim(out_dim_vec));
+  meta_out.set_dtype(y.dtype());
+
+  T* out_data = dev_ctx.template Alloc<T>(out);
+  if (out->numel() == 0) {
+    return;
+  }
+
+  const int64_t rows = xdim_vec[x_ndims - 2];
+  const int64_t inner = xdim_vec[x_ndims - 1];
+  const int64_t n = ydim_vec[y_ndims - 1];
+  int64_t batch = 1;
+  for (size_t i = 0; i < x_ndims - 2; ++i) {
+    batch *= xdim_vec[i];
+  }
+
+  const T* y_data = y.data<T>();
+  const T* values = x.non_zero_elements().data<T>();
+  PD_VISIT_BASE_INTEGRAL_TYPES(
+      x.non_zero_crows().dtype(), "MatmulCsrDenseKernel", ([&] {
+        const data_t* crows = x.non_zero_crows().data<data_t>();
+        const data_t* cols = x.non_zero_cols().data<data_t>();
+        // batched CSR concatenates cols/values; every batch's crows
+        // restarts at zero, so track the running nnz offset
+        int64_t nnz_offset = 0;
+        for (int64_t b = 0; b < batch; ++b) {
+          const data_t* crows_b = crows + b * (rows + 1);
+          CsrSpmmBatch<T, data_t>(crows_b,
+                                  cols + nnz_offset,
+                                  values + nnz_offset,
+                                  y_data + b * inner * n,
+                                  out_data + b * rows * n,
+                                  rows,
+                                  n);
+          nnz_offset += static_cast<int64_t>(crows_b[rows]);
+        }
+      }));
 }
 
 // TODO(zhouwei25): implement CPU kernel of " DENSE @ DENSE * CSR_MASK -> CSR"
@@ -0,0 +1,298 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "glog/logging.h"
+
+#include "paddle/common/flags.h"
+#include "paddle/phi/backends/all_context.h"
+#include "paddle/phi/common/bfloat16.h"
+#include "paddle/phi/common/complex.h"
+#include "paddle/phi/common/float16.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/contiguous_kernel.h"
+#include "paddle/phi/kernels/elementwise_add_kernel.h"
+#include "paddle/phi/kernels/elementwise_divide_kernel.h"
+#include "paddle/phi/kernels/elementwise_multiply_kernel.h"
+#include "paddle/phi/kernels/elementwise_subtract_kernel.h"
+
+COMMON_DECLARE_bool(use_stride_kernel);
+
+namespace phi {
+namespace {
+
+// True when the strides are a permutation of a contiguous layout over dims,
+// i.e. the view maps its logical positions one-to-one onto a dense range of
+// numel elements (a transpose view, for instance).
+bool IsPermutedContiguous(const DDim& dims, const DDim& strides) {
+  int rank = dims.size();
+  if (rank < 1 || strides.size() != rank) {
+    return false;
+  }
+  std::array<std::pair<int64_t, int64_t>, DDim::kMaxRank> order;
+  for (int i = 0; i < rank; ++i) {
+    if (strides[i] < 1 || dims[i] < 1) {
+      return false;
+    }
+    order[i] = {strides[i], dims[i]};
+  }
+  std::sort(order.begin(), order.begin() + rank);
+  int64_t expected = 1;
+  for (int i = 0; i < rank; ++i) {
+    if (order[i].first != expected) {
+      return false;
+    }
+    expected *= order[i].second;
+  }
+  return true;
+}
+
+// A one dimensional alias over the tensor's buffer in memory order; keeps
+// the holder and the offset.
+DenseTensor FlatAlias(const DenseTensor& t) {
+  DenseTensor flat = t;
+  auto meta = flat.meta();
+  meta.dims = common::make_ddim({t.numel()});
+  meta.strides = DenseTensorMeta::calc_strides(meta.dims);
+  flat.set_meta(meta);
+  return flat;
+}
+
+template <typename T, typename Context>
+void StridedBinaryImpl(const Context& ctx,
+                       const DenseTensor& x,
+                       const DenseTensor& y,
+                       DenseTensor* out,
+                       void (*dense_kernel)(const Context&,
+                                            const DenseTensor&,
+                                            const DenseTensor&,
+                                            DenseTensor*)) {
+  if (!FLAGS_use_stride_kernel) {
+    PADDLE_THROW(
+        phi::errors::Fatal("FLAGS_use_stride_kernel is closed. Strided kernel "
+                           "be called, something wrong has happened!"));
+  }
+
+  bool x_contiguous = x.meta().is_contiguous();
+  bool y_contiguous = y.meta().is_contiguous();
+
+  if (!x_contiguous && !y_contiguous && !out->initialized() &&
+      x.dims() == y.dims() && x.strides() == y.strides() &&
+      out->dims() == x.dims() &&
+      IsPermutedContiguous(x.dims(), x.strides())) {
+    // Both sides share one permuted-contiguous layout (two transpose views
+    // of same-shaped buffers, typically). Such a view touches each of its
+    // numel elements exactly once, so the op can run in memory order over
+    // flat aliases with no copies at all, and the output simply adopts the
+    // inputs' layout over its freshly written buffer.
+    DenseTensor x_flat = FlatAlias(x);
+    DenseTensor y_flat = FlatAlias(y);
+    DenseTensor out_flat;
+    out_flat.set_meta(DenseTensorMeta(out->dtype(), x_flat.dims()));
+    dense_kernel(ctx, x_flat, y_flat, &out_flat);
+    auto meta = out->meta();
+    meta.strides = x.strides();
+    meta.offset = 0;
+    out->set_meta(meta);
+    out->ResetHolder(out_flat.Holder());
+    return;
+  }
+
+  // Mixed or broadcast layouts: contiguous-ize what needs it and delegate.
+  // This is no worse than the dense path, which transforms every
+  // non-contiguous input before the kernel ever runs.
+  DenseTensor x_in = x;
+  if (!x_contiguous) {
+    DenseTensor tmp;
+    ContiguousKernel<T, Context>(ctx, x, &tmp);
+    x_in = tmp;
+  }
+  DenseTensor y_in = y;
+  if (!y_contiguous) {
+    DenseTensor tmp;
+    ContiguousKernel<T, Context>(ctx, y, &tmp);
+    y_in = tmp;
+  }
+  // An initialized output is an inplace buffer prepared by the API layer;
+  // leave its meta alone.
+  if (!out->initialized()) {
+    auto meta = out->meta();
+    meta.strides = meta.calc_strides(meta.dims);
+    meta.offset = 0;
+    out->set_meta(meta);
+  }
+  dense_kernel(ctx, x_in, y_in, out);
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void AddStridedKernel(const Context& ctx,
+                      const DenseTensor& x,
+                      const DenseTensor& y,
+                      DenseTensor* out) {
+  StridedBinaryImpl<T, Context>(ctx, x, y, out, AddKernel<T, Context>);
+}
+
+template <typename T, typename Context>
+void SubtractStridedKernel(const Context& ctx,
+                           const DenseTensor& x,
+                           const DenseTensor& y,
+                           DenseTensor* out) {
+  StridedBinaryImpl<T, Context>(ctx, x, y, out, SubtractKernel<T, Context>);
+}
+
+template <typename T, typename Context>
+void MultiplyStridedKernel(const Context& ctx,
+                           const DenseTensor& x,
+                           const DenseTensor& y,
+                           DenseTensor* out) {
+  StridedBinaryImpl<T, Context>(ctx, x, y, out, MultiplyKernel<T, Context>);
+}
+
+template <typename T, typename Context>
+void DivideStridedKernel(const Context& ctx,
+                         const DenseTensor& x,
+                         const DenseTensor& y,
+                         DenseTensor* out) {
+  StridedBinaryImpl<T, Context>(ctx, x, y, out, DivideKernel<T, Context>);
+}
+
+}  // namespace phi
+
+using complex64 = ::phi::dtype::complex<float>;
+using complex128 = ::phi::dtype::complex<double>;
+
+PD_REGISTER_KERNEL(add,
+                   CPU,
+                   STRIDED,
+                   phi::AddStridedKernel,
+                   float,
+                   double,
+                   int16_t,
+                   int,
+                   bool,
+                   uint8_t,
+                   int8_t,
+                   int64_t,
+                   complex64,
+                   complex128) {}
+
+PD_REGISTER_KERNEL(subtract,
+                   CPU,
+                   STRIDED,
+                   phi::SubtractStridedKernel,
+                   float,
+                   double,
+                   int16_t,
+                   int,
+                   int64_t,
+                   complex64,
+                   complex128,
+                   phi::dtype::bfloat16) {}
+
+PD_REGISTER_KERNEL(multiply,
+                   CPU,
+                   STRIDED,
+                   phi::MultiplyStridedKernel,
+                   float,
+                   double,
+                   int,
+                   int64_t,
+                   bool,
+                   complex64,
+                   complex128,
+                   phi::dtype::bfloat16) {}
+
+PD_REGISTER_KERNEL(divide,
+                   CPU,
+                   STRIDED,
+                   phi::DivideStridedKernel,
+                   float,
+                   double,
+                   int8_t,
+                   uint8_t,
+                   int16_t,
+                   int,
+                   int64_t,
+                   bool,
+                   complex64,
+                   complex128) {}
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+PD_REGISTER_KERNEL(add,
+                   GPU,
+                   STRIDED,
+                   phi::AddStridedKernel,
+                   float,
+                   double,
+                   int16_t,
+                   int,
+                   bool,
+                   uint8_t,
+                   int8_t,
+                   int64_t,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16,
+                   complex64,
+                   complex128) {}
+
+PD_REGISTER_KERNEL(subtract,
+                   GPU,
+                   STRIDED,
+                   phi::SubtractStridedKernel,
+                   float,
+                   double,
+                   int16_t,
+                   int,
+                   int64_t,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16,
+                   complex64,
+                   complex128) {}
+
+PD_REGISTER_KERNEL(multiply,
+                   GPU,
+                   STRIDED,
+                   phi::MultiplyStridedKernel,
+                   float,
+                   double,
+                   int,
+                   int64_t,
+                   bool,
+                   phi::dtype::float16,
+                   complex64,
+                   complex128,
+                   phi::dtype::bfloat16) {}
+
+PD_REGISTER_KERNEL(divide,
+                   GPU,
+                   STRIDED,
+                   phi::DivideStridedKernel,
+                   float,
+                   double,
+                   int8_t,
+                   uint8_t,
+                   int16_t,
+                   int,
+                   int64_t,
+                   bool,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16,
+                   complex64,
+                   complex128) {}
+#endif
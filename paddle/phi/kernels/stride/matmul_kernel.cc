@@ -0,0 +1,126 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/phi/kernels/matmul_kernel.h"
+
+#include "glog/logging.h"
+
+#include "paddle/common/flags.h"
+#include "paddle/phi/backends/all_context.h"
+#include "paddle/phi/common/bfloat16.h"
+#include "paddle/phi/common/complex.h"
+#include "paddle/phi/common/float16.h"
+#include "paddle/phi/core/kernel_registry.h"
+#include "paddle/phi/kernels/contiguous_kernel.h"
+
+COMMON_DECLARE_bool(use_stride_kernel);
+
+namespace phi {
+namespace {
+
+// Returns true when the tensor is a view of a contiguous buffer with only
+// its last two axes swapped, which the GEMM can consume directly by
+// flipping its transpose flag instead of materializing a contiguous copy.
+// On success the tensor's meta is rewritten to the underlying contiguous
+// layout and *transpose is flipped.
+bool FoldTransposedMatrix(DenseTensor* tensor, bool* transpose) {
+  const auto& dims = tensor->dims();
+  const auto& strides = tensor->strides();
+  int rank = dims.size();
+  if (rank < 2 || strides.size() != rank) {
+    return false;
+  }
+  DDim folded_dims = dims;
+  std::swap(folded_dims[rank - 1], folded_dims[rank - 2]);
+  DDim expected = DenseTensorMeta::calc_strides(folded_dims);
+  std::swap(expected[rank - 1], expected[rank - 2]);
+  if (strides != expected) {
+    return false;
+  }
+  auto meta = tensor->meta();
+  meta.dims = folded_dims;
+  meta.strides = DenseTensorMeta::calc_strides(folded_dims);
+  tensor->set_meta(meta);
+  *transpose = !*transpose;
+  return true;
+}
+
+}  // namespace
+
+template <typename T, typename Context>
+void MatmulStridedKernel(const Context& ctx,
+                         const DenseTensor& x,
+                         const DenseTensor& y,
+                         bool transpose_x,
+                         bool transpose_y,
+                         DenseTensor* out) {
+  if (!FLAGS_use_stride_kernel) {
+    PADDLE_THROW(
+        phi::errors::Fatal("FLAGS_use_stride_kernel is closed. Strided kernel "
+                           "be called, something wrong has happened!"));
+  }
+
+  DenseTensor x_in = x;
+  bool trans_x = transpose_x;
+  if (!x.meta().is_contiguous() && !FoldTransposedMatrix(&x_in, &trans_x)) {
+    DenseTensor tmp;
+    ContiguousKernel<T, Context>(ctx, x, &tmp);
+    x_in = tmp;
+  }
+
+  DenseTensor y_in = y;
+  bool trans_y = transpose_y;
+  if (!y.meta().is_contiguous() && !FoldTransposedMatrix(&y_in, &trans_y)) {
+    DenseTensor tmp;
+    ContiguousKernel<T, Context>(ctx, y, &tmp);
+    y_in = tmp;
+  }
+
+  if (!out->initialized()) {
+    auto meta = out->meta();
+    meta.strides = meta.calc_strides(meta.dims);
+    meta.offset = 0;
+    out->set_meta(meta);
+  }
+
+  MatmulKernel<T, Context>(ctx, x_in, y_in, trans_x, trans_y, out);
+}
+
+}  // namespace phi
+
+PD_REGISTER_KERNEL(matmul,
+                   CPU,
+                   STRIDED,
+                   phi::MatmulStridedKernel,
+                   float,
+                   double,
+                   int32_t,
+                   int64_t,
+                   phi::dtype::complex<float>,
+                   phi::dtype::complex<double>) {}
+
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+PD_REGISTER_KERNEL(matmul,
+                   GPU,
+                   STRIDED,
+                   phi::MatmulStridedKernel,
+                   float,
+                   double,
+                   int32_t,
+                   int64_t,
+                   phi::dtype::float16,
+                   phi::dtype::bfloat16,
+                   phi::dtype::complex<float>,
+                   phi::dtype::complex<double>) {}
+#endif
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <set>
+#include <vector>
+
 #include "paddle/pir/include/core/interface_value.h"
 #include "paddle/pir/include/core/ir_context.h"
 #include "paddle/pir/include/core/storage_manager.h"
@@ -106,9 +109,15 @@ class IR_API AbstractType {
   explicit AbstractType(TypeId type_id,
                         const Dialect &dialect,
                         std::set<InterfaceValue> &&interface_set)
-      : type_id_(type_id),
-        dialect_(dialect),
-        interface_set_(std::move(interface_set)) {}
+      : type_id_(type_id), dialect_(dialect) {
+    // Flatten the ordered set into a sorted table so interface dispatch is
+    // a binary search over contiguous memory.
+    interface_table_.reserve(interface_set.size());
+    while (!interface_set.empty()) {
+      interface_table_.push_back(
+          std::move(interface_set.extract(interface_set.begin()).value()));
+    }
+  }
 
   AbstractType(const AbstractType &) = delete;
 
@@ -120,8 +129,8 @@ class IR_API AbstractType {
   /// Dialect to which this type was registered
   const Dialect &dialect_;
 
-  /// A collection of the interfaces registered to this type.
-  std::set<InterfaceValue> interface_set_;
+  /// The interfaces registered to this type, sorted by TypeId.
+  std::vector<InterfaceValue> interface_table_;
 
   /// Trait will be recorded by TypeId.
   uint32_t num_traits_ = 0;
@@ -16,6 +16,7 @@
 
 #include <any>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,12 @@ struct PassExecutionState {
   bool pass_failed;
   AnalysisManager am;
   PreservedAnalyses preserved_analyses;
+
+  // Incremental verification (see PassManager::EnableIncrementalVerification):
+  // set once the pass declares it records every op it touches, together with
+  // the recorded ops that are still alive at the end of the run.
+  bool tracks_dirty_ops{false};
+  std::vector<Operation*> dirty_ops;
 };
 
 struct PassInfo {
@@ -88,6 +95,14 @@ class IR_API Pass {
 
   const detail::PassInfo& pass_info() const { return pass_info_; }
 
+  // Return a fresh instance of this pass for running concurrently on a
+  // disjoint piece of IR (see PassManager::EnableParallelDispatch). Each
+  // worker thread gets its own copy, so the execution state stored on the
+  // pass is never shared. Passes whose Run only depends on the operation it
+  // is given can override this; the default of nullptr keeps the pass (and
+  // the whole pipeline it belongs to) on the sequential path.
+  virtual std::unique_ptr<Pass> Clone() const { return nullptr; }
+
   // Get a reference to the attributed previously set.
   template <typename AttrType>
   AttrType& Get(const std::string& attr_name) const {
@@ -182,6 +197,17 @@ class IR_API Pass {
 
   void SignalPassFailure();
 
+  // Declare that this run records every operation the pass creates or
+  // modifies. Under incremental verification the manager then verifies only
+  // the recorded ops (and the users of their results) instead of walking
+  // the whole module; an empty record means nothing needs re-verifying.
+  void EnableDirtyOpTracking();
+
+  // Record an op this pass created or modified; implies
+  // EnableDirtyOpTracking. Ops erased later in the same run must not stay
+  // recorded.
+  void MarkDirtyOp(Operation* op);
+
  private:
   detail::PassInfo pass_info_;
 
@@ -115,6 +115,33 @@ class IR_API PassManager {
 
   void AddInstrumentation(std::unique_ptr<PassInstrumentation> pi);
 
+  // Run the pipeline concurrently over the isolated operations of each
+  // nested block, MLIR-style: every worker thread owns a clone of the whole
+  // pipeline and processes a disjoint set of sub-operations, so no pass
+  // state is shared across threads. `num_threads` of 0 means use the
+  // hardware concurrency.
+  //
+  // The parallel path is only taken when every pass in the pipeline
+  // overrides Pass::Clone; otherwise execution silently stays sequential.
+  // Instrumented runs (EnableIRPrinting, EnablePassTiming, ...) also stay
+  // sequential so that instrumentation callbacks remain ordered.
+  //
+  // Thread-safety contract: IrContext's interned storage (types, attributes
+  // and op infos) is guarded by spin locks and may be queried or extended
+  // from any worker thread. Anything that mutates IR, however, is only safe
+  // on the sub-operation a worker owns; in particular each worker must
+  // create its own Builder instead of sharing one across threads.
+  void EnableParallelDispatch(size_t num_threads = 0);
+
+  // Verify lazily instead of walking the whole module after every pass:
+  // passes that record the ops they touched (Pass::MarkDirtyOp) get only
+  // those ops and the users of their results verified, and passes whose
+  // statistics report zero applied changes are not verified at all. Passes
+  // doing neither still get the full walk. Full verification after every
+  // pass remains the default and is the setting to fall back to when
+  // narrowing down a verifier failure.
+  void EnableIncrementalVerification() { incremental_verify_ = true; }
+
  private:
   bool Initialize(IrContext *context);
 
@@ -127,8 +154,14 @@ class IR_API PassManager {
 
   bool verify_{true};
 
+  bool incremental_verify_{false};
+
   bool disable_log_{false};
 
+  bool parallel_dispatch_{false};
+
+  size_t parallel_num_threads_{0};
+
   std::vector<std::unique_ptr<Pass>> passes_;
 
   std::unique_ptr<Pass> pass_adaptor_;
@@ -29,12 +29,14 @@ void OpInfo::AttachInterface(InterfaceValue &&interface_value) {
 
 void OpInfoImpl::AttachInterface(InterfaceValue &&interface_value) {
   auto type_id = interface_value.type_id();
-  auto success = interface_set_.insert(std::move(interface_value)).second;
+  auto iter = std::lower_bound(
+      interface_table_.begin(), interface_table_.end(), interface_value);
   PADDLE_ENFORCE_EQ(
-      success,
+      iter == interface_table_.end() || iter->type_id() != type_id,
       true,
       phi::errors::InvalidArgument(
           "Interface: id[%u] is already registered. inset failed", type_id));
+  interface_table_.insert(iter, std::move(interface_value));
   VLOG(10) << "Attach a interface: id[" << type_id << "]. to " << op_name_;
 }
 
@@ -47,15 +49,22 @@ OpInfoImpl::OpInfoImpl(std::set<InterfaceValue> &&interface_set,
                        const char **p_attributes,
                        VerifyPtr verify_sig,
                        VerifyPtr verify_region)
-    : interface_set_(std::move(interface_set)),
-      dialect_(dialect),
+    : dialect_(dialect),
       op_id_(op_id),
       op_name_(op_name),
       num_traits_(num_traits),
       num_attributes_(num_attributes),
       p_attributes_(p_attributes),
       verify_sig_(verify_sig),
-      verify_region_(verify_region) {}
+      verify_region_(verify_region) {
+  // The set is already ordered by TypeId; moving it out in iteration order
+  // yields the sorted flat dispatch table.
+  interface_table_.reserve(interface_set.size());
+  while (!interface_set.empty()) {
+    interface_table_.push_back(
+        std::move(interface_set.extract(interface_set.begin()).value()));
+  }
+}
 
 OpInfo OpInfoImpl::Create(Dialect *dialect,
                           TypeId op_id,
@@ -125,12 +134,16 @@ bool OpInfoImpl::HasTrait(TypeId trait_id) const {
 }
 
 bool OpInfoImpl::HasInterface(TypeId interface_id) const {
-  return interface_set_.find(interface_id) != interface_set_.end();
+  return GetInterfaceImpl(interface_id) != nullptr;
 }
 
 void *OpInfoImpl::GetInterfaceImpl(TypeId interface_id) const {
-  auto iter = interface_set_.find(interface_id);
-  return iter != interface_set_.end() ? iter->model() : nullptr;
+  auto iter = std::lower_bound(interface_table_.begin(),
+                               interface_table_.end(),
+                               InterfaceValue(interface_id));
+  return iter != interface_table_.end() && iter->type_id() == interface_id
+             ? iter->model()
+             : nullptr;
 }
 
 void OpInfoImpl::Destroy() {
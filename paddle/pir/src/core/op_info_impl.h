@@ -19,6 +19,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "paddle/pir/include/core/builtin_attribute.h"
 #include "paddle/pir/include/core/op_base.h"
@@ -90,7 +91,10 @@ class OpInfoImpl {
   ~OpInfoImpl() = default;
   void Destroy();
 
-  std::set<InterfaceValue> interface_set_;
+  /// Interface dispatch table: InterfaceValues sorted by TypeId, probed by
+  /// binary search over contiguous memory on every HasInterface /
+  /// GetInterfaceImpl query.
+  std::vector<InterfaceValue> interface_table_;
 
   /// The dialect of this Op belong to.
   Dialect *dialect_;
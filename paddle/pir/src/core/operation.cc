@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <glog/logging.h>
+#include <array>
 #include <cstdint>
 #include <ostream>
+#include <vector>
 
 #include "paddle/common/enforce.h"
 #include "paddle/pir/include/core/block.h"
@@ -33,6 +35,68 @@ using detail::OpOperandImpl;
 using detail::OpOutlineResultImpl;
 using detail::OpResultImpl;
 
+namespace {
+
+// Operations are created and destroyed in large batches while building and
+// rewriting modules, and their blocks (results + op + operands + regions)
+// share a handful of small sizes. Recycling those blocks through a
+// thread-local, size-bucketed free list keeps a 100k-op build/teardown from
+// churning and fragmenting the system heap with one malloc/free per op.
+// Oversized blocks and overflow beyond the per-bucket cap go straight to
+// aligned_malloc/aligned_free; everything still cached is released when the
+// owning thread exits.
+class OpMemoryCache {
+ public:
+  static constexpr size_t kAlignment = 8;
+  static constexpr size_t kMaxBlockSize = 2048;
+  static constexpr size_t kMaxBlocksPerBucket = 8192;
+
+  void *Allocate(size_t size) {
+    const size_t bucket = BucketIndex(size);
+    if (bucket < buckets_.size() && !buckets_[bucket].empty()) {
+      void *ptr = buckets_[bucket].back();
+      buckets_[bucket].pop_back();
+      return ptr;
+    }
+    return detail::aligned_malloc(RoundUp(size), kAlignment);
+  }
+
+  void Release(void *ptr, size_t size) {
+    const size_t bucket = BucketIndex(size);
+    if (bucket < buckets_.size() &&
+        buckets_[bucket].size() < kMaxBlocksPerBucket) {
+      buckets_[bucket].push_back(ptr);
+      return;
+    }
+    detail::aligned_free(ptr);
+  }
+
+  ~OpMemoryCache() {
+    for (auto &bucket : buckets_) {
+      for (void *ptr : bucket) {
+        detail::aligned_free(ptr);
+      }
+    }
+  }
+
+ private:
+  static size_t RoundUp(size_t size) {
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+  }
+  // Blocks are bucketed by their rounded size, so Allocate and Release agree
+  // on the bucket as long as both receive the same requested size.
+  static size_t BucketIndex(size_t size) { return RoundUp(size) / kAlignment; }
+
+  std::array<std::vector<void *>, kMaxBlockSize / kAlignment + 1> buckets_;
+};
+
+OpMemoryCache &ThisThreadOpMemoryCache() {
+  thread_local OpMemoryCache cache;
+  return cache;
+}
+
+}  // namespace
+
 Operation *Operation::Create(OperationArgument &&argument) {
   Operation *op = Create(argument.inputs,
                          argument.attributes,
@@ -75,9 +139,9 @@ Operation *Operation::Create(const std::vector<Value> &inputs,
   size_t region_mem_size = num_regions * sizeof(Region);
   size_t base_size = result_mem_size + op_mem_size + operand_mem_size +
                      region_mem_size + block_operand_size;
-  // 2. Malloc memory.
+  // 2. Malloc memory, preferably recycled from a previously destroyed op.
   char *base_ptr =
-      reinterpret_cast<char *>(detail::aligned_malloc(base_size, 8));
+      reinterpret_cast<char *>(ThisThreadOpMemoryCache().Allocate(base_size));
 
   auto name = op_info ? op_info.name() : "";
   VLOG(10) << "Create Operation [" << name
@@ -149,8 +213,9 @@ Operation *Operation::Clone(IrMapping &ir_mapping, CloneOptions options) const {
   }
 
   std::vector<Type> output_types;
-  for (auto &result : results()) {
-    output_types.push_back(result.type());
+  output_types.reserve(num_results_);
+  for (uint32_t i = 0; i < num_results_; ++i) {
+    output_types.push_back(result(i).type());
   }
 
   std::vector<Block *> successors = {};
@@ -208,10 +273,23 @@ void Operation::Destroy() {
     }
   }
 
-  // 4. Deconstruct Operation.
+  // 4. Compute the layout sizes while the header fields are still alive, the
+  // whole block is handed back to the memory cache at the end.
+  size_t result_mem_size =
+      num_results_ > OUTLINE_RESULT_IDX
+          ? sizeof(detail::OpOutlineResultImpl) *
+                    (num_results_ - OUTLINE_RESULT_IDX) +
+                sizeof(detail::OpInlineResultImpl) * OUTLINE_RESULT_IDX
+          : sizeof(detail::OpInlineResultImpl) * num_results_;
+  size_t base_size = result_mem_size + sizeof(Operation) +
+                     sizeof(detail::OpOperandImpl) * num_operands_ +
+                     sizeof(detail::BlockOperandImpl) * num_successors_ +
+                     sizeof(Region) * num_regions_;
+
+  // 5. Deconstruct Operation.
   this->~Operation();
 
-  // 5. Deconstruct OpOperand.
+  // 6. Deconstruct OpOperand.
   for (size_t idx = 0; idx < num_operands_; idx++) {
     detail::OpOperandImpl *op_operand_impl = operand(idx).impl_;
     if (op_operand_impl) {
@@ -219,7 +297,7 @@ void Operation::Destroy() {
     }
   }
 
-  // 6. Deconstruct BlockOperand.
+  // 7. Deconstruct BlockOperand.
   for (size_t idx = 0; idx < num_successors_; idx++) {
     detail::BlockOperandImpl *block_operand_impl = block_operands_ + idx;
     if (block_operand_impl) {
@@ -227,18 +305,12 @@ void Operation::Destroy() {
     }
   }
 
-  // 7. Free memory.
-  size_t result_mem_size =
-      num_results_ > OUTLINE_RESULT_IDX
-          ? sizeof(detail::OpOutlineResultImpl) *
-                    (num_results_ - OUTLINE_RESULT_IDX) +
-                sizeof(detail::OpInlineResultImpl) * OUTLINE_RESULT_IDX
-          : sizeof(detail::OpInlineResultImpl) * num_results_;
+  // 8. Hand the memory back for reuse by the next Create.
   void *aligned_ptr = reinterpret_cast<char *>(this) - result_mem_size;
 
-  VLOG(10) << "Destroy Operation [" << name() << "]: {ptr = " << aligned_ptr
-           << ", size = " << result_mem_size << "} done.";
-  detail::aligned_free(aligned_ptr);
+  VLOG(10) << "Destroy Operation: {ptr = " << aligned_ptr
+           << ", size = " << base_size << "} done.";
+  ThisThreadOpMemoryCache().Release(aligned_ptr, base_size);
 }
 
 IrContext *Operation::ir_context() const { return info_.ir_context(); }
@@ -264,6 +336,7 @@ Operation::Operation(const AttributeMap &attributes,
 ///
 std::vector<Value> Operation::results() const {
   std::vector<Value> res;
+  res.reserve(num_results());
   for (uint32_t i = 0; i < num_results(); ++i) {
     res.push_back(result(i));
   }
@@ -275,6 +348,7 @@ std::vector<Value> Operation::results() const {
 ///
 std::vector<OpOperand> Operation::operands() const {
   std::vector<OpOperand> res;
+  res.reserve(num_operands());
   for (uint32_t i = 0; i < num_operands(); ++i) {
     res.push_back(operand(i));
   }
@@ -287,6 +361,7 @@ Value Operation::operand_source(uint32_t index) const {
 
 std::vector<Value> Operation::operands_source() const {
   std::vector<Value> res;
+  res.reserve(num_operands());
   for (uint32_t i = 0; i < num_operands(); ++i) {
     res.push_back(operand_source(i));
   }
@@ -372,9 +447,12 @@ void Operation::Erase() {
 }
 
 bool Operation::use_empty() {
-  auto res = results();
-  return std::all_of(
-      res.begin(), res.end(), [](Value result) { return result.use_empty(); });
+  // Hot query in dead code elimination; check the inline results in place
+  // rather than materializing a vector of them first.
+  for (uint32_t i = 0; i < num_results_; ++i) {
+    if (!result(i).use_empty()) return false;
+  }
+  return true;
 }
 
 void Operation::ReplaceAllUsesWith(const std::vector<Value> &values) {
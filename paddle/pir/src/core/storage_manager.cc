@@ -22,18 +22,27 @@
 
 namespace pir {
 // This is a structure for creating, caching, and looking up Storage of
-// parametric types.
+// parametric types. The cache is sharded by parameter hash so that
+// concurrent uniquing requests for different parameters of the same type
+// only contend when they land in the same shard; the (potentially
+// expensive) equal_func and constructor both run under a single shard
+// lock only.
 struct ParametricStorageManager {
   using StorageBase = StorageManager::StorageBase;
 
+  // Must be a power of two, see ShardOf.
+  static constexpr size_t kShardNum = 16;
+
   explicit ParametricStorageManager(std::function<void(StorageBase *)> destroy)
       : destroy_(destroy) {}
 
   ~ParametricStorageManager() {  // NOLINT
-    for (const auto &instance : parametric_instances_) {
-      destroy_(instance.second);
+    for (auto &shard : shards_) {
+      for (const auto &instance : shard.instances) {
+        destroy_(instance.second);
+      }
+      shard.instances.clear();
     }
-    parametric_instances_.clear();
   }
 
   // Get the storage of parametric type, if not in the cache, create and
@@ -41,8 +50,10 @@ struct ParametricStorageManager {
   StorageBase *GetOrCreate(std::size_t hash_value,
                            std::function<bool(StorageBase *)> equal_func,
                            std::function<StorageBase *()> constructor) {
-    if (parametric_instances_.count(hash_value) != 0) {
-      auto pr = parametric_instances_.equal_range(hash_value);
+    Shard &shard = ShardOf(hash_value);
+    std::lock_guard<pir::SpinLock> guard(shard.lock);
+    if (shard.instances.count(hash_value) != 0) {
+      auto pr = shard.instances.equal_range(hash_value);
       while (pr.first != pr.second) {
         if (equal_func(pr.first->second)) {
           VLOG(10) << "Found a cached parametric storage of: [param_hash="
@@ -54,7 +65,7 @@ struct ParametricStorageManager {
       }
     }
     StorageBase *storage = constructor();
-    parametric_instances_.emplace(hash_value, storage);
+    shard.instances.emplace(hash_value, storage);
     VLOG(10) << "No cache found, construct and cache a new parametric storage "
                 "of: [param_hash="
              << hash_value << ", storage_ptr=" << storage << "].";
@@ -62,9 +73,18 @@ struct ParametricStorageManager {
   }
 
  private:
-  // In order to prevent hash conflicts, the unordered_multimap data structure
-  // is used for storage.
-  std::unordered_multimap<size_t, StorageBase *> parametric_instances_;
+  struct Shard {
+    // In order to prevent hash conflicts, the unordered_multimap data
+    // structure is used for storage.
+    std::unordered_multimap<size_t, StorageBase *> instances;
+    pir::SpinLock lock;
+  };
+
+  Shard &ShardOf(std::size_t hash_value) {
+    return shards_[hash_value & (kShardNum - 1)];
+  }
+
+  Shard shards_[kShardNum];
   std::function<void(StorageBase *)> destroy_;
 };
 
@@ -77,15 +97,22 @@ StorageManager::StorageBase *StorageManager::GetParametricStorageImpl(
     std::size_t hash_value,
     std::function<bool(const StorageBase *)> equal_func,
     std::function<StorageBase *()> constructor) {
-  std::lock_guard<pir::SpinLock> guard(parametric_instance_lock_);
   VLOG(10) << "Try to get a parametric storage of: [TypeId_hash="
            << std::hash<pir::TypeId>()(type_id) << ", param_hash=" << hash_value
            << "].";
-  if (parametric_instance_.find(type_id) == parametric_instance_.end()) {
-    IR_THROW("The input data pointer is null.");
+  ParametricStorageManager *parametric_storage = nullptr;
+  {
+    // Hold the type map lock only for the lookup; registered managers are
+    // never erased, so the pointer stays valid after the lock is released
+    // and uniquing of distinct types can proceed in parallel.
+    std::lock_guard<pir::SpinLock> guard(parametric_instance_lock_);
+    auto iter = parametric_instance_.find(type_id);
+    if (iter == parametric_instance_.end()) {
+      IR_THROW("The input data pointer is null.");
+    }
+    parametric_storage = iter->second.get();
   }
-  ParametricStorageManager &parametric_storage = *parametric_instance_[type_id];
-  return parametric_storage.GetOrCreate(hash_value, equal_func, constructor);
+  return parametric_storage->GetOrCreate(hash_value, equal_func, constructor);
 }
 
 StorageManager::StorageBase *StorageManager::GetParameterlessStorageImpl(
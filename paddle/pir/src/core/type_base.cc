@@ -13,14 +13,21 @@
 // limitations under the License.
 
 #include "paddle/pir/include/core/type_base.h"
+
+#include <algorithm>
+
 #include "glog/logging.h"
 #include "paddle/pir/include/core/ir_context.h"
 
 namespace pir {
 
 void *AbstractType::GetInterfaceImpl(TypeId interface_id) const {
-  auto iter = interface_set_.find(interface_id);
-  return iter == interface_set_.end() ? nullptr : iter->model();
+  auto iter = std::lower_bound(interface_table_.begin(),
+                               interface_table_.end(),
+                               InterfaceValue(interface_id));
+  return iter != interface_table_.end() && iter->type_id() == interface_id
+             ? iter->model()
+             : nullptr;
 }
 
 }  // namespace pir
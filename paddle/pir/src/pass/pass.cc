@@ -13,6 +13,13 @@
 // limitations under the License.
 
 #include "paddle/pir/include/pass/pass.h"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "paddle/pir/include/core/ir_context.h"
 #include "paddle/pir/include/core/operation.h"
 #include "paddle/pir/include/core/program.h"
@@ -59,6 +66,21 @@ AnalysisManager Pass::analysis_manager() {
                     phi::errors::InvalidArgument("pass state has no value"));
   return pass_state_->am;
 }
+
+void Pass::EnableDirtyOpTracking() {
+  PADDLE_ENFORCE_EQ(pass_state_.has_value(),
+                    true,
+                    phi::errors::InvalidArgument("pass state has no value"));
+  pass_state_->tracks_dirty_ops = true;
+}
+
+void Pass::MarkDirtyOp(Operation* op) {
+  PADDLE_ENFORCE_EQ(pass_state_.has_value(),
+                    true,
+                    phi::errors::InvalidArgument("pass state has no value"));
+  pass_state_->tracks_dirty_ops = true;
+  pass_state_->dirty_ops.push_back(op);
+}
 //===----------------------------------------------------------------------===//
 // PatternRewritePass
 //===----------------------------------------------------------------------===//
@@ -94,6 +116,22 @@ void PatternRewritePass::Run(Operation* op) {
 //----------------------------------------------------------------------------------------------//
 // PassAdaptor
 //----------------------------------------------------------------------------------------------//
+namespace {
+// Whether the statistics recorded through Pass::AddStatistics state that the
+// pass applied no rewrites, meaning the IR is unchanged since the last
+// verification. Passes without statistics report false (unknown).
+bool ReportsNoChange(Pass* pass) {
+  if (pass->Has("__match_count__")) {
+    return pass->Get<int64_t>("__match_count__") == 0;
+  }
+  if (pass->Has("__match_count_1__") && pass->Has("__match_count_2__")) {
+    return pass->Get<int64_t>("__match_count_1__") == 0 &&
+           pass->Get<int64_t>("__match_count_2__") == 0;
+  }
+  return false;
+}
+}  // namespace
+
 void detail::PassAdaptor::Run(Operation* op, uint8_t opt_level, bool verify) {
   RunImpl(op, opt_level, verify);
 }
@@ -103,19 +141,101 @@ void detail::PassAdaptor::RunImpl(Operation* op,
                                   bool verify) {
   auto last_am = analysis_manager();
 
+  std::vector<Operation*> nested_ops;
   for (size_t i = 0; i < op->num_regions(); ++i) {
     auto& region = op->region(i);
     for (auto& block : region) {
-      for (auto& op : block) {
-        AnalysisManagerHolder am(&op, last_am.GetPassInstrumentor());
-        if (!RunPipeline(*pm_, &op, am, opt_level, verify))
-          return SignalPassFailure();
+      for (auto& inner_op : block) {
+        nested_ops.push_back(&inner_op);
+      }
+    }
+  }
+
+  // Nested operations are isolated from each other, so with enough of them
+  // the pipeline can be dispatched across worker threads. Instrumented runs
+  // stay sequential to keep the instrumentation callbacks ordered, and so
+  // does any pipeline containing a pass that does not support cloning.
+  if (pm_->parallel_dispatch_ && nested_ops.size() > 1 &&
+      !last_am.GetPassInstrumentor()) {
+    size_t num_threads = pm_->parallel_num_threads_ > 0
+                             ? pm_->parallel_num_threads_
+                             : std::thread::hardware_concurrency();
+    num_threads = std::min(std::max<size_t>(num_threads, 1), nested_ops.size());
+    auto worker_pms = ClonePipelines(*pm_, num_threads);
+    if (!worker_pms.empty()) {
+      if (!RunParallel(worker_pms, nested_ops, opt_level, verify)) {
+        SignalPassFailure();
       }
+      return;
     }
+    VLOG(4) << "Parallel dispatch disabled: some pass in the pipeline does "
+               "not override Pass::Clone.";
+  }
+
+  for (auto* inner_op : nested_ops) {
+    AnalysisManagerHolder am(inner_op, last_am.GetPassInstrumentor());
+    if (!RunPipeline(*pm_, inner_op, am, opt_level, verify))
+      return SignalPassFailure();
   }
   return;
 }
 
+std::vector<std::unique_ptr<PassManager>> detail::PassAdaptor::ClonePipelines(
+    const PassManager& pm, size_t num_pipelines) {
+  std::vector<std::unique_ptr<PassManager>> worker_pms;
+  worker_pms.reserve(num_pipelines);
+  for (size_t i = 0; i < num_pipelines; ++i) {
+    auto worker_pm =
+        std::make_unique<PassManager>(pm.context(), pm.opt_level_);
+    worker_pm->incremental_verify_ = pm.incremental_verify_;
+    for (auto& pass : pm.passes()) {
+      auto cloned = pass->Clone();
+      if (!cloned) return {};
+      if (!cloned->Initialize(pm.context())) return {};
+      worker_pm->AddPass(std::move(cloned));
+    }
+    worker_pms.push_back(std::move(worker_pm));
+  }
+  return worker_pms;
+}
+
+bool detail::PassAdaptor::RunParallel(
+    const std::vector<std::unique_ptr<PassManager>>& worker_pms,
+    const std::vector<Operation*>& ops,
+    uint8_t opt_level,
+    bool verify) {
+  std::atomic<size_t> next_op{0};
+  std::atomic<bool> failed{false};
+
+  auto work = [&](PassManager* worker_pm) {
+    while (!failed.load(std::memory_order_relaxed)) {
+      size_t idx = next_op.fetch_add(1, std::memory_order_relaxed);
+      if (idx >= ops.size()) break;
+      AnalysisManagerHolder am(ops[idx], nullptr);
+      try {
+        if (!RunPipeline(*worker_pm, ops[idx], am, opt_level, verify)) {
+          failed.store(true, std::memory_order_relaxed);
+        }
+      } catch (const std::exception& e) {
+        // Exceptions must not escape a worker thread; record the failure
+        // and let the caller surface it through SignalPassFailure.
+        LOG(ERROR) << "Pass pipeline threw on a worker thread: " << e.what();
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(worker_pms.size() - 1);
+  for (size_t i = 1; i < worker_pms.size(); ++i) {
+    workers.emplace_back(work, worker_pms[i].get());
+  }
+  work(worker_pms[0].get());
+  for (auto& worker : workers) worker.join();
+
+  return !failed.load();
+}
+
 bool detail::PassAdaptor::RunPipeline(const PassManager& pm,
                                       Operation* op,
                                       AnalysisManager am,
@@ -128,7 +248,8 @@ bool detail::PassAdaptor::RunPipeline(const PassManager& pm,
 
   for (auto& pass : pm.passes()) {
     if (pass->CanApplyOn(op)) {
-      if (!RunPass(pass.get(), op, am, opt_level, verify)) {
+      if (!RunPass(
+              pass.get(), op, am, opt_level, verify, pm.incremental_verify_)) {
         return false;
       }
     }
@@ -139,7 +260,12 @@ bool detail::PassAdaptor::RunPipeline(const PassManager& pm,
   }
 
   // Apply pass manager on all nested ir.
-  if (!RunPass(pm.pass_adaptor_.get(), op, am, opt_level, verify)) {
+  if (!RunPass(pm.pass_adaptor_.get(),
+               op,
+               am,
+               opt_level,
+               verify,
+               pm.incremental_verify_)) {
     return false;
   }
 
@@ -150,7 +276,8 @@ bool detail::PassAdaptor::RunPass(Pass* pass,
                                   Operation* op,
                                   AnalysisManager am,
                                   uint8_t opt_level,
-                                  bool verify) {
+                                  bool verify,
+                                  bool incremental_verify) {
   if (opt_level < pass->pass_info().opt_level) return true;
 
   pass->pass_state_ = PassExecutionState(op, am);
@@ -160,6 +287,13 @@ bool detail::PassAdaptor::RunPass(Pass* pass,
   if (auto* adaptor = dynamic_cast<PassAdaptor*>(pass)) {
     adaptor->Run(op, opt_level, verify);
   } else {
+    if (incremental_verify) {
+      // Stale statistics from an earlier run on another op would make
+      // ReportsNoChange lie below.
+      pass->Erase("__match_count__");
+      pass->Erase("__match_count_1__");
+      pass->Erase("__match_count_2__");
+    }
     if (instrumentor) instrumentor->RunBeforePass(pass, op);
     pass->Run(op);
     if (instrumentor) instrumentor->RunAfterPass(pass, op);
@@ -168,7 +302,25 @@ bool detail::PassAdaptor::RunPass(Pass* pass,
 
   if (!pass_failed && verify) {
     bool verify_recursively = !dynamic_cast<PassAdaptor*>(pass);
-    pir::Verify(op, verify_recursively);
+    auto& state = *pass->pass_state();
+    if (incremental_verify && state.tracks_dirty_ops) {
+      // The pass recorded exactly what it touched: verify those ops and the
+      // users of their results, whose own invariants may depend on them.
+      for (auto* dirty_op : state.dirty_ops) {
+        pir::Verify(dirty_op, /*verify_recursively=*/true);
+        for (uint32_t i = 0; i < dirty_op->num_results(); ++i) {
+          auto result = dirty_op->result(i);
+          for (auto it = result.use_begin(); it != result.use_end(); ++it) {
+            it->owner()->Verify();
+          }
+        }
+      }
+    } else if (incremental_verify && ReportsNoChange(pass)) {
+      // Zero applied rewrites: the IR is exactly what the previous
+      // verification already covered.
+    } else {
+      pir::Verify(op, verify_recursively);
+    }
   }
 
   return !pass_failed;
@@ -204,6 +356,11 @@ bool PassManager::Initialize(IrContext* context) {
   return true;
 }
 
+void PassManager::EnableParallelDispatch(size_t num_threads) {
+  parallel_dispatch_ = true;
+  parallel_num_threads_ = num_threads;
+}
+
 void PassManager::AddInstrumentation(std::unique_ptr<PassInstrumentation> pi) {
   if (!instrumentor_) instrumentor_ = std::make_unique<PassInstrumentor>();
 
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "paddle/pir/include/pass/pass.h"
 
 namespace pir {
@@ -34,11 +37,26 @@ class PassAdaptor final : public Pass {
  private:
   void RunImpl(Operation* op, uint8_t opt_level, bool verify);
 
+  // Run the pipeline over `ops` with `num_threads` worker threads, each
+  // owning one of the cloned pipelines in `worker_pms`. Returns false if any
+  // pipeline run failed.
+  static bool RunParallel(
+      const std::vector<std::unique_ptr<PassManager>>& worker_pms,
+      const std::vector<Operation*>& ops,
+      uint8_t opt_level,
+      bool verify);
+
+  // Build `num_pipelines` clones of pm's pipeline for parallel dispatch.
+  // Returns an empty vector when some pass does not support cloning.
+  static std::vector<std::unique_ptr<PassManager>> ClonePipelines(
+      const PassManager& pm, size_t num_pipelines);
+
   static bool RunPass(Pass* pass,
                       Operation* op,
                       AnalysisManager am,
                       uint8_t opt_level,
-                      bool verify);
+                      bool verify,
+                      bool incremental_verify);
 
   static bool RunPipeline(const PassManager& pm,
                           Operation* op,
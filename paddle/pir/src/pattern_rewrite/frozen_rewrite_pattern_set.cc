@@ -43,12 +43,15 @@ FrozenRewritePatternSet::FrozenRewritePatternSet(
                           std::function<bool(OpInfo)> callback) {
     if (op_info_map.empty())
       op_info_map = pattern->ir_context()->registered_op_info_map();
+    // Index the pattern under every op it can root on before handing over
+    // ownership; moving inside the loop would leave the later buckets
+    // holding dangling null entries.
     for (auto& info_map : op_info_map) {
       if (callback(info_map.second))
         impl_->op_specific_native_pattern_map_[info_map.second].push_back(
             pattern.get());
-      impl_->op_specific_native_patterns_.push_back(std::move(pattern));
     }
+    impl_->op_specific_native_patterns_.push_back(std::move(pattern));
   };
 
   for (std::unique_ptr<RewritePattern>& pat : patterns.native_patterns()) {
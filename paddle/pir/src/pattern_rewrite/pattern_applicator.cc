@@ -72,10 +72,12 @@ bool PatternApplicator::MatchAndRewrite(
     std::function<bool(const Pattern&)> can_apply,
     std::function<void(const Pattern&)> on_failure,
     std::function<bool(const Pattern&)> on_success) {
-  // whether there are patterns matching this operation type.
-  std::vector<const RewritePattern*> op_patterns;
+  // Only consult the patterns indexed under this operation type; copying
+  // the bucket here would cost an allocation per visited op.
+  static const std::vector<const RewritePattern*> kNoPatterns;
   auto pattern_it = patterns_.find(op->info());
-  if (pattern_it != patterns_.end()) op_patterns = pattern_it->second;
+  const std::vector<const RewritePattern*>& op_patterns =
+      pattern_it == patterns_.end() ? kNoPatterns : pattern_it->second;
 
   unsigned op_it = 0, op_e = op_patterns.size();
   unsigned any_it = 0, any_e = any_op_patterns_.size();
@@ -406,3 +406,58 @@ TEST(DataTypeTransform, CPUTransform) {
     }
   }
 }
+
+TEST(DataTypeTransform, CPUTransformLarge) {
+  // large enough to take the vectorized multi-threaded fp16/bf16 fast path
+  auto place = phi::CPUPlace();
+
+  auto kernel_fp16 = phi::KernelKey(
+      place, phi::DataLayout::ALL_LAYOUT, phi::DataType::FLOAT16);
+
+  auto kernel_bf16 = phi::KernelKey(
+      place, phi::DataLayout::ALL_LAYOUT, phi::DataType::BFLOAT16);
+
+  auto kernel_fp32 = phi::KernelKey(
+      place, phi::DataLayout::ALL_LAYOUT, phi::DataType::FLOAT32);
+
+  // odd size exercises the vector tails of every chunk
+  int data_number = (1 << 21) + 3;
+
+  phi::DenseTensor in;
+  phi::DenseTensor out;
+  phi::DenseTensor back;
+
+  float* in_data_float =
+      in.mutable_data<float>(common::make_ddim({data_number}), place);
+  for (int i = 0; i < data_number; ++i) {
+    in_data_float[i] = static_cast<float>(i % 2048) - 1024.5f;
+  }
+
+  // round trip float -> float16 -> float
+  paddle::framework::TransDataType(kernel_fp32, kernel_fp16, in, &out);
+  paddle::platform::float16* out_data_fp16 =
+      out.data<paddle::platform::float16>();
+  for (int i = 0; i < data_number; ++i) {
+    ASSERT_EQ(out_data_fp16[i].x,
+              static_cast<paddle::platform::float16>(in_data_float[i]).x);
+  }
+  paddle::framework::TransDataType(kernel_fp16, kernel_fp32, out, &back);
+  float* back_data_float = back.data<float>();
+  for (int i = 0; i < data_number; ++i) {
+    ASSERT_EQ(back_data_float[i], static_cast<float>(out_data_fp16[i]));
+  }
+
+  // round trip float -> bfloat16 -> float
+  paddle::framework::TransDataType(kernel_fp32, kernel_bf16, in, &out);
+  paddle::platform::bfloat16* out_data_bf16 =
+      out.data<paddle::platform::bfloat16>();
+  for (int i = 0; i < data_number; ++i) {
+    ASSERT_EQ(out_data_bf16[i].x,
+              static_cast<paddle::platform::bfloat16>(in_data_float[i]).x);
+  }
+  paddle::framework::TransDataType(kernel_bf16, kernel_fp32, out, &back);
+  back_data_float = back.data<float>();
+  for (int i = 0; i < data_number; ++i) {
+    ASSERT_EQ(back_data_float[i], static_cast<float>(out_data_bf16[i]));
+  }
+}
@@ -15,6 +15,8 @@ limitations under the License. */
 #include "paddle/fluid/framework/scope.h"
 
 #include "gtest/gtest.h"
+#include "paddle/fluid/framework/variable.h"
+#include "paddle/phi/core/dense_tensor.h"
 
 namespace paddle {
 namespace framework {
@@ -77,3 +79,67 @@ TEST(Scope, GetAllNames) {
 
   EXPECT_STREQ("a", str.c_str());
 }
+
+TEST(Scope, FindVarById) {
+  Scope s;
+  Variable* v = s.Var("a");
+
+  size_t id = s.ResolveVarId("a");
+  EXPECT_EQ(s.ResolveVarId("a"), id);
+  EXPECT_EQ(v, s.FindVarById(id));
+
+  // ids for missing names resolve to nullptr until the variable exists
+  size_t missing = s.ResolveVarId("b");
+  EXPECT_EQ(nullptr, s.FindVarById(missing));
+  Variable* b = s.Var("b");
+  EXPECT_EQ(b, s.FindVarById(missing));
+
+  EXPECT_EQ(nullptr, s.FindVarById(12345));
+}
+
+TEST(Scope, ReadOnlyScope) {
+  Scope params;
+  Variable* shared = params.Var("w");
+
+  Scope s1;
+  Scope s2;
+  s1.LinkReadOnlyScope(&params);
+  s2.LinkReadOnlyScope(&params);
+
+  EXPECT_EQ(shared, s1.FindVar("w"));
+  EXPECT_EQ(shared, s2.FindVar("w"));
+
+  // a local variable shadows the shared one for its own scope only
+  Variable* local = s1.Var("w");
+  EXPECT_EQ(local, s1.FindVar("w"));
+  EXPECT_EQ(shared, s2.FindVar("w"));
+
+  // kids reach the read-only scope through their ancestors
+  Scope& kid = s2.NewScope();
+  EXPECT_EQ(shared, kid.FindVar("w"));
+}
+
+TEST(Scope, VarCopyOnWrite) {
+  Scope params;
+  auto* src = params.Var("w")->GetMutable<phi::DenseTensor>();
+  src->Resize({3});
+  auto* src_data = src->mutable_data<float>(phi::CPUPlace());
+  for (int i = 0; i < 3; ++i) {
+    src_data[i] = static_cast<float>(i);
+  }
+
+  Scope s;
+  s.LinkReadOnlyScope(&params);
+  Variable* local = s.VarCopyOnWrite("w");
+  EXPECT_NE(local, params.FindVar("w"));
+  EXPECT_EQ(local, s.FindVar("w"));
+
+  auto* dst = local->GetMutable<phi::DenseTensor>();
+  ASSERT_EQ(dst->numel(), 3);
+  dst->data<float>()[1] = 42.0f;
+  // the shared copy is untouched
+  EXPECT_EQ(src_data[1], 1.0f);
+
+  // a second call returns the existing copy instead of copying again
+  EXPECT_EQ(local, s.VarCopyOnWrite("w"));
+}
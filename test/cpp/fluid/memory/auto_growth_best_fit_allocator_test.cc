@@ -14,13 +14,16 @@
 
 #include "paddle/fluid/memory/allocation/auto_growth_best_fit_allocator.h"
 
+#include <cstdio>
 #include <cstdlib>
+#include <string>
 
 #include "gtest/gtest.h"
 #include "paddle/fluid/memory/allocation/aligned_allocator.h"
 
 PD_DECLARE_bool(free_idle_chunk);
 PD_DECLARE_bool(free_when_no_cache_hit);
+PD_DECLARE_bool(auto_growth_thread_local_arena);
 
 namespace paddle {
 namespace memory {
@@ -171,6 +174,67 @@ TEST(test_auto_growth_allocator, test_free_when_no_cache_hit) {
   TestFreeWhenNoCacheHit(true);
 }
 
+TEST(test_auto_growth_allocator, test_chunk_layout_snapshot) {
+  FLAGS_free_idle_chunk = false;
+  FLAGS_free_when_no_cache_hit = false;
+
+  size_t alignment = 4096;
+  std::string path = "/tmp/auto_growth_chunk_layout_test.txt";
+
+  auto recorded_allocator = std::make_shared<RecordedAllocator>();
+  auto underlying_allocator =
+      std::make_shared<AlignedAllocator>(recorded_allocator, alignment);
+  {
+    auto ag_allocator = std::make_shared<AutoGrowthBestFitAllocator>(
+        underlying_allocator, alignment);
+    auto a1 = ag_allocator->Allocate(8192);
+    auto a2 = ag_allocator->Allocate(16384);
+    ag_allocator->SaveChunkLayout(path);
+  }
+
+  // A fresh allocator restored from the snapshot starts with the same
+  // chunks pre-carved, so warmed-up sizes allocate without growing.
+  auto restored_allocator = std::make_shared<AutoGrowthBestFitAllocator>(
+      underlying_allocator, alignment);
+  restored_allocator->RestoreChunkLayout(path);
+  size_t carved_size = recorded_allocator->AllocatedSize();
+  ASSERT_GT(carved_size, 0UL);
+
+  auto allocation = restored_allocator->Allocate(8192);
+  ASSERT_EQ(recorded_allocator->AllocatedSize(), carved_size);
+
+  std::remove(path.c_str());
+}
+
+TEST(test_auto_growth_allocator, test_thread_local_arena) {
+  FLAGS_free_idle_chunk = false;
+  FLAGS_free_when_no_cache_hit = false;
+  FLAGS_auto_growth_thread_local_arena = true;
+
+  auto recorded_allocator = std::make_shared<RecordedAllocator>();
+  size_t alignment = 4096;
+  size_t memory_size = 8192;
+  auto underlying_allocator =
+      std::make_shared<AlignedAllocator>(recorded_allocator, alignment);
+  auto ag_allocator = std::make_shared<AutoGrowthBestFitAllocator>(
+      underlying_allocator, alignment);
+
+  // Repeated same-size alloc/free cycles on one thread should be served
+  // from the per-thread arena without growing the underlying pool.
+  for (size_t i = 0; i < 10; ++i) {
+    auto allocation = ag_allocator->Allocate(memory_size);
+    allocation.reset();
+    ASSERT_EQ(recorded_allocator->AllocatedSize(), memory_size + alignment);
+  }
+
+  // Release() flushes the arenas back to the shared pool so that the
+  // now-idle chunk can be freed.
+  ag_allocator->Release(phi::CPUPlace());
+  ASSERT_EQ(recorded_allocator->AllocatedSize(), 0UL);
+
+  FLAGS_auto_growth_thread_local_arena = false;
+}
+
 }  // namespace allocation
 }  // namespace memory
 }  // namespace paddle
@@ -46,6 +46,39 @@ TEST(MemoryMapAllocation, test_allocation_base) {
   }
 }
 
+TEST(SharedWeightSegment, publish_seal_and_map) {
+  std::string name = "test_model_" + std::to_string(getpid());
+  size_t data_size = 4UL * 1024;
+
+  // Consumers cannot map a segment that was never published.
+  ASSERT_EQ(TryMapSharedWeightSegment(name), nullptr);
+
+  // 1. first process publishes and fills the segment
+  auto publisher = PublishSharedWeightSegment(name, data_size);
+  ASSERT_NE(publisher, nullptr);
+  auto* writer_ptr = static_cast<int32_t*>(publisher->ptr());
+  for (int32_t i = 0; i < 1024; ++i) {
+    writer_ptr[i] = i;
+  }
+
+  // 2. unsealed segments stay invisible, and double publishing fails
+  ASSERT_EQ(TryMapSharedWeightSegment(name), nullptr);
+  ASSERT_EQ(PublishSharedWeightSegment(name, data_size), nullptr);
+
+  // 3. after sealing, other processes map the weights copy-on-write
+  SealSharedWeightSegment(publisher);
+  auto consumer = TryMapSharedWeightSegment(name);
+  ASSERT_NE(consumer, nullptr);
+  ASSERT_EQ(consumer->size(), data_size);
+  auto* reader_ptr = static_cast<const int32_t*>(consumer->ptr());
+  for (int32_t i = 0; i < 1024; ++i) {
+    ASSERT_EQ(reader_ptr[i], i);
+  }
+
+  RemoveSharedWeightSegment(name);
+  ASSERT_EQ(TryMapSharedWeightSegment(name), nullptr);
+}
+
 }  // namespace allocation
 }  // namespace memory
 }  // namespace paddle
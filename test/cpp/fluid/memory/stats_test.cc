@@ -173,5 +173,31 @@ TEST_F(StatsTest, HostReservedTest) {
   RunTests();
 }
 
+TEST(AllocationEventTracerTest, RecordAndDump) {
+  auto& tracer = AllocationEventTracer::GetInstance();
+  tracer.Enable(4);  // already a power of two
+  AllocationEventTracer::SetOpContext("matmul");
+
+  tracer.Record(1024, 0, /*is_host=*/true);
+  tracer.Record(-1024, 0, /*is_host=*/true);
+
+  auto events = tracer.Dump();
+  ASSERT_EQ(events.size(), 2UL);
+  EXPECT_EQ(events[0].size, 1024);
+  EXPECT_EQ(events[1].size, -1024);
+  EXPECT_TRUE(events[0].is_host);
+  EXPECT_STREQ(events[0].op_context, "matmul");
+
+  // The ring keeps only the newest `capacity` events once it wraps.
+  for (int64_t i = 0; i < 6; ++i) {
+    tracer.Record(i, 0, /*is_host=*/true);
+  }
+  events = tracer.Dump();
+  ASSERT_EQ(events.size(), 4UL);
+  EXPECT_EQ(events.back().size, 5);
+
+  tracer.Disable();
+}
+
 }  // namespace memory
 }  // namespace paddle
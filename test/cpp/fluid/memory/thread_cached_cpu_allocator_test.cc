@@ -0,0 +1,77 @@
+// Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "paddle/fluid/memory/allocation/thread_cached_cpu_allocator.h"
+
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+
+namespace paddle {
+namespace memory {
+namespace allocation {
+
+class CountingAllocator : public Allocator {
+ public:
+  size_t alloc_count_{0};
+  size_t free_count_{0};
+
+ protected:
+  phi::Allocation *AllocateImpl(size_t size) override {
+    ++alloc_count_;
+    return new Allocation(malloc(size), size, phi::CPUPlace());  // NOLINT
+  }
+
+  void FreeImpl(phi::Allocation *allocation) override {
+    ++free_count_;
+    free(allocation->ptr());  // NOLINT
+    delete allocation;
+  }
+};
+
+TEST(thread_cached_cpu_allocator, small_allocations_are_cached) {
+  auto underlying = std::make_shared<CountingAllocator>();
+  auto allocator = std::make_shared<ThreadCachedCPUAllocator>(underlying);
+
+  // Repeated alloc/free of the same size class should hit the underlying
+  // allocator only once.
+  for (size_t i = 0; i < 100; ++i) {
+    auto allocation = allocator->Allocate(100);
+    ASSERT_GE(allocation->size(), 100UL);
+    allocation.reset();
+  }
+  ASSERT_EQ(underlying->alloc_count_, 1UL);
+  ASSERT_EQ(underlying->free_count_, 0UL);
+
+  // Release drops the calling thread's cache back to the underlying pool.
+  allocator->Release(phi::CPUPlace());
+  ASSERT_EQ(underlying->free_count_, 1UL);
+}
+
+TEST(thread_cached_cpu_allocator, large_allocations_pass_through) {
+  auto underlying = std::make_shared<CountingAllocator>();
+  auto allocator = std::make_shared<ThreadCachedCPUAllocator>(underlying);
+
+  for (size_t i = 0; i < 3; ++i) {
+    auto allocation =
+        allocator->Allocate(ThreadCachedCPUAllocator::kMaxCachedSize + 1);
+    allocation.reset();
+  }
+  ASSERT_EQ(underlying->alloc_count_, 3UL);
+  ASSERT_EQ(underlying->free_count_, 3UL);
+}
+
+}  // namespace allocation
+}  // namespace memory
+}  // namespace paddle
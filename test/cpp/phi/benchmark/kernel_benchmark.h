@@ -0,0 +1,220 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paddle/phi/api/lib/utils/allocator.h"
+#include "paddle/phi/backends/context_pool.h"
+#include "paddle/phi/common/data_type.h"
+#include "paddle/phi/common/int_array.h"
+#include "paddle/phi/common/scalar.h"
+#include "paddle/phi/core/dense_tensor.h"
+#include "paddle/phi/core/kernel_context.h"
+#include "paddle/phi/core/kernel_factory.h"
+
+namespace phi {
+namespace tests {
+
+// Runs one phi kernel in isolation and reports wall time per iteration,
+// so kernel regressions can be chased without hand-writing a driver each
+// time. The kernel is looked up through KernelFactory (so the benchmark
+// exercises the same dispatch as production) and executed against the
+// real DeviceContext for the default place of this build (GPU when built
+// with CUDA/HIP, otherwise CPU).
+//
+// Instantiate through PHI_KERNEL_BENCHMARK below; the body sets up the
+// KernelContext and is re-run for every shape in the shape set:
+//
+//   PHI_KERNEL_BENCHMARK(add, "add", phi::DataType::FLOAT32,
+//                        {1024, 1024}, {4096, 4096}) {
+//     runner->AddInput(runner->shape());
+//     runner->AddInput(runner->shape());
+//     runner->AddOutput(runner->shape());
+//   }
+class KernelBenchmarkRunner {
+ public:
+  KernelBenchmarkRunner(const std::string& kernel_name,
+                        DataType dtype,
+                        std::vector<int64_t> shape)
+      : dtype_(dtype), shape_(std::move(shape)) {
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+    place_ = GPUPlace();
+    backend_ = Backend::GPU;
+#else
+    place_ = CPUPlace();
+    backend_ = Backend::CPU;
+#endif
+    dev_ctx_ = DeviceContextPool::Instance().Get(place_);
+    allocator_ =
+        std::make_unique<paddle::experimental::DefaultAllocator>(place_);
+    auto kernel_result = KernelFactory::Instance().SelectKernelOrThrowError(
+        kernel_name, KernelKey(backend_, DataLayout::ALL_LAYOUT, dtype));
+    kernel_ = &kernel_result.kernel;
+    ctx_ = std::make_unique<KernelContext>(dev_ctx_);
+  }
+
+  const std::vector<int64_t>& shape() const { return shape_; }
+  DataType dtype() const { return dtype_; }
+
+  DenseTensor* AddInput(const std::vector<int64_t>& dims) {
+    DenseTensor* t = NewInput(dims);
+    ctx_->EmplaceBackInput(t);
+    return t;
+  }
+
+  // n inputs of the same shape, passed to the kernel as one tensor list
+  // (e.g. the inputs of concat).
+  void AddInputList(size_t n, const std::vector<int64_t>& dims) {
+    int start = static_cast<int>(ctx_->InputsSize());
+    for (size_t i = 0; i < n; ++i) {
+      ctx_->EmplaceBackInputWithoutSetRange(NewInput(dims));
+    }
+    ctx_->AssignInputRange(std::make_pair(start, start + static_cast<int>(n)),
+                           input_list_count_++);
+  }
+
+  template <typename AttrT>
+  void AddAttr(const AttrT& attr) {
+    ctx_->EmplaceBackAttr(attr);
+  }
+
+  // Sets the output meta only; the kernel allocates, as it would when
+  // driven by an infer-meta pass.
+  DenseTensor* AddOutput(const std::vector<int64_t>& dims) {
+    tensors_.emplace_back(std::make_shared<DenseTensor>());
+    DenseTensor* t = tensors_.back().get();
+    t->set_meta(
+        DenseTensorMeta(dtype_, common::make_ddim(dims), DataLayout::NCHW));
+    bytes_per_iter_ += NumBytes(dims);
+    ctx_->EmplaceBackOutput(t);
+    return t;
+  }
+
+  // Warms up, then doubles the iteration count until one timed batch
+  // spans at least kMinBatchNs, and reports ns/iter and the effective
+  // bandwidth over all input and output bytes.
+  void Run(const std::string& label) {
+    constexpr int kWarmupIters = 3;
+    constexpr int64_t kMinBatchNs = 50 * 1000 * 1000;
+    constexpr int kMaxIters = 1 << 20;
+    for (int i = 0; i < kWarmupIters; ++i) {
+      (*kernel_)(ctx_.get());
+    }
+    dev_ctx_->Wait();
+    int iters = 8;
+    int64_t elapsed_ns = 0;
+    while (true) {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iters; ++i) {
+        (*kernel_)(ctx_.get());
+      }
+      dev_ctx_->Wait();
+      elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+      if (elapsed_ns >= kMinBatchNs || iters >= kMaxIters) {
+        break;
+      }
+      iters *= 2;
+    }
+    double ns_per_iter = static_cast<double>(elapsed_ns) / iters;
+    double gb_per_sec = ns_per_iter > 0
+                            ? static_cast<double>(bytes_per_iter_) / ns_per_iter
+                            : 0.0;
+    std::cout << "[phi-bench] " << label << " shape=" << ShapeString()
+              << " iters=" << iters << " ns/iter=" << ns_per_iter
+              << " GB/s=" << gb_per_sec << std::endl;
+  }
+
+ private:
+  DenseTensor* NewInput(const std::vector<int64_t>& dims) {
+    tensors_.emplace_back(std::make_shared<DenseTensor>(
+        allocator_.get(),
+        DenseTensorMeta(dtype_, common::make_ddim(dims), DataLayout::NCHW)));
+    DenseTensor* t = tensors_.back().get();
+    dev_ctx_->Alloc(t, dtype_);
+    // Fill with a small repeating pattern where the memory is host
+    // visible; device inputs stay as allocated, which is fine for timing.
+    if (place_.GetType() == AllocationType::CPU &&
+        dtype_ == DataType::FLOAT32) {
+      auto* data = t->data<float>();
+      for (int64_t i = 0; i < t->numel(); ++i) {
+        data[i] = static_cast<float>(i % 255) * 0.5f;
+      }
+    }
+    bytes_per_iter_ += NumBytes(dims);
+    return t;
+  }
+
+  size_t NumBytes(const std::vector<int64_t>& dims) const {
+    int64_t numel = 1;
+    for (int64_t d : dims) {
+      numel *= d;
+    }
+    return static_cast<size_t>(numel) * phi::SizeOf(dtype_);
+  }
+
+  std::string ShapeString() const {
+    std::ostringstream os;
+    os << "[";
+    for (size_t i = 0; i < shape_.size(); ++i) {
+      os << (i == 0 ? "" : ",") << shape_[i];
+    }
+    os << "]";
+    return os.str();
+  }
+
+  DataType dtype_;
+  std::vector<int64_t> shape_;
+  Place place_;
+  Backend backend_;
+  DeviceContext* dev_ctx_{nullptr};
+  const Kernel* kernel_{nullptr};
+  std::unique_ptr<paddle::experimental::DefaultAllocator> allocator_;
+  std::unique_ptr<KernelContext> ctx_;
+  std::vector<std::shared_ptr<DenseTensor>> tensors_;
+  size_t input_list_count_{0};
+  size_t bytes_per_iter_{0};
+};
+
+}  // namespace tests
+}  // namespace phi
+
+// Defines one benchmark as a gtest case. The body receives
+// `KernelBenchmarkRunner* runner` and is invoked once per shape in the
+// trailing shape set; each invocation gets a fresh runner for the shape.
+#define PHI_KERNEL_BENCHMARK(bench_name, kernel_name, data_type, ...)     \
+  static void PhiKernelBenchmark_##bench_name(                            \
+      phi::tests::KernelBenchmarkRunner* runner);                         \
+  TEST(KernelBenchmark, bench_name) {                                     \
+    const std::vector<std::vector<int64_t>> shapes = {__VA_ARGS__};       \
+    for (const auto& shape : shapes) {                                    \
+      phi::tests::KernelBenchmarkRunner runner(                           \
+          kernel_name, data_type, shape);                                 \
+      PhiKernelBenchmark_##bench_name(&runner);                           \
+      runner.Run(#bench_name);                                            \
+    }                                                                     \
+  }                                                                       \
+  static void PhiKernelBenchmark_##bench_name(                            \
+      phi::tests::KernelBenchmarkRunner* runner)
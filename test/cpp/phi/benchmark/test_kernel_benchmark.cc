@@ -0,0 +1,103 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include <gtest/gtest.h>
+
+#include "paddle/phi/core/kernel_registry.h"
+#include "test/cpp/phi/benchmark/kernel_benchmark.h"
+
+PD_DECLARE_KERNEL(add, CPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(sum, CPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(concat, CPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(transpose, CPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(matmul, CPU, ALL_LAYOUT);
+#if defined(PADDLE_WITH_CUDA) || defined(PADDLE_WITH_HIP)
+PD_DECLARE_KERNEL(add, KPS, ALL_LAYOUT);
+PD_DECLARE_KERNEL(sum, KPS, ALL_LAYOUT);
+PD_DECLARE_KERNEL(concat, GPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(transpose, GPU, ALL_LAYOUT);
+PD_DECLARE_KERNEL(matmul, GPU, ALL_LAYOUT);
+#endif
+
+namespace phi {
+namespace tests {
+
+// y has the shape of the trailing dimension only, so the add broadcasts
+// it over the leading dimensions.
+PHI_KERNEL_BENCHMARK(add_broadcast,
+                     "add",
+                     phi::DataType::FLOAT32,
+                     {1024, 1024},
+                     {64, 256, 256}) {
+  const auto& shape = runner->shape();
+  runner->AddInput(shape);
+  runner->AddInput({shape.back()});
+  runner->AddOutput(shape);
+}
+
+// Reduce over the leading dimension.
+PHI_KERNEL_BENCHMARK(reduce_sum,
+                     "sum",
+                     phi::DataType::FLOAT32,
+                     {1024, 1024},
+                     {4096, 1024}) {
+  const auto& shape = runner->shape();
+  runner->AddInput(shape);
+  runner->AddAttr(phi::IntArray(std::vector<int64_t>{0}));
+  runner->AddAttr(runner->dtype());  // out_dtype
+  runner->AddAttr(false);            // keep_dim
+  runner->AddOutput(
+      std::vector<int64_t>(shape.begin() + 1, shape.end()));
+}
+
+PHI_KERNEL_BENCHMARK(concat_axis0,
+                     "concat",
+                     phi::DataType::FLOAT32,
+                     {256, 1024},
+                     {1024, 1024}) {
+  constexpr size_t kNumInputs = 4;
+  auto out_shape = runner->shape();
+  runner->AddInputList(kNumInputs, runner->shape());
+  runner->AddAttr(phi::Scalar(0));  // axis
+  out_shape[0] *= kNumInputs;
+  runner->AddOutput(out_shape);
+}
+
+PHI_KERNEL_BENCHMARK(transpose_2d,
+                     "transpose",
+                     phi::DataType::FLOAT32,
+                     {1024, 1024},
+                     {4096, 1024}) {
+  const auto& shape = runner->shape();
+  runner->AddInput(shape);
+  runner->AddAttr(std::vector<int>{1, 0});
+  runner->AddOutput({shape[1], shape[0]});
+}
+
+// Shape entries are {m, k, n}.
+PHI_KERNEL_BENCHMARK(matmul_nn,
+                     "matmul",
+                     phi::DataType::FLOAT32,
+                     {256, 256, 256},
+                     {1024, 1024, 1024}) {
+  const auto& shape = runner->shape();
+  runner->AddInput({shape[0], shape[1]});
+  runner->AddInput({shape[1], shape[2]});
+  runner->AddAttr(false);  // transpose_x
+  runner->AddAttr(false);  // transpose_y
+  runner->AddOutput({shape[0], shape[2]});
+}
+
+}  // namespace tests
+}  // namespace phi
@@ -0,0 +1,57 @@
+/* Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License. */
+
+#include "gtest/gtest.h"
+#include "paddle/phi/core/kernel_context.h"
+
+namespace phi {
+namespace tests {
+
+TEST(KernelScratchArena, bump_and_reset) {
+  KernelScratchArena arena;
+
+  void* a = arena.Allocate(100);
+  void* b = arena.Allocate(100);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  ASSERT_NE(a, b);
+
+  // After Reset, the same slab memory is handed out again.
+  arena.Reset();
+  void* c = arena.Allocate(100);
+  ASSERT_EQ(a, c);
+}
+
+TEST(KernelScratchArena, alignment_and_large_blocks) {
+  KernelScratchArena arena;
+
+  void* p = arena.Allocate(10, 256);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(p) % 256, 0UL);
+
+  // Requests larger than the default slab get their own slab.
+  void* big = arena.Allocate(1 << 20);
+  ASSERT_NE(big, nullptr);
+  memset(big, 0, 1 << 20);
+}
+
+TEST(KernelScratchArena, context_scratch) {
+  KernelContext ctx;
+  void* p = ctx.ScratchAlloc(64);
+  ASSERT_NE(p, nullptr);
+  ctx.ResetScratch();
+  ASSERT_EQ(ctx.ScratchAlloc(64), p);
+}
+
+}  // namespace tests
+}  // namespace phi
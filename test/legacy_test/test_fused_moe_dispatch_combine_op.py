@@ -0,0 +1,164 @@
+# Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import unittest
+
+import numpy as np
+
+import paddle
+from paddle import _C_ops
+
+paddle.seed(42)
+
+
+def ref_dispatch(x, logits, k, capacity):
+    n, d = x.shape
+    e = logits.shape[1]
+    shifted = logits - logits.max(axis=1, keepdims=True)
+    probs = np.exp(shifted) / np.exp(shifted).sum(axis=1, keepdims=True)
+    expert_id = np.zeros((n, k), dtype=np.int32)
+    weights = np.zeros((n, k), dtype=np.float32)
+    for i in range(n):
+        order = np.argsort(-logits[i], kind="stable")
+        expert_id[i] = order[:k]
+        weights[i] = probs[i][order[:k]]
+    dispatched = np.zeros((e * capacity, d), dtype=x.dtype)
+    scatter_index = np.full((n, k), -1, dtype=np.int32)
+    used = np.zeros(e, dtype=np.int64)
+    for i in range(n):
+        for kk in range(k):
+            expert = expert_id[i, kk]
+            if used[expert] < capacity:
+                slot = expert * capacity + used[expert]
+                used[expert] += 1
+                scatter_index[i, kk] = slot
+                dispatched[slot] = x[i]
+            else:
+                weights[i, kk] = 0.0
+    return dispatched, weights, scatter_index, expert_id, used
+
+
+def ref_combine(expert_out, weights, scatter_index):
+    n, k = weights.shape
+    d = expert_out.shape[1]
+    y = np.zeros((n, d), dtype=np.float32)
+    for i in range(n):
+        for kk in range(k):
+            slot = scatter_index[i, kk]
+            if slot >= 0:
+                y[i] += weights[i, kk] * expert_out[slot].astype(np.float32)
+    return y
+
+
+@unittest.skipIf(
+    not paddle.is_compiled_with_cuda(), "core is not compiled with CUDA"
+)
+class TestFusedMoeDispatchCombineOp(unittest.TestCase):
+    def config(self):
+        self.num_tokens = 128
+        self.hidden_size = 16
+        self.num_experts = 8
+        self.k = 2
+        # small enough that some tokens get dropped
+        self.capacity = 24
+        self.dtype = np.float32
+        self.atol = 1e-5
+
+    def setUp(self):
+        self.config()
+        paddle.disable_static(place=paddle.CUDAPlace(0))
+        np.random.seed(7)
+        self.x = np.random.uniform(
+            -1, 1, (self.num_tokens, self.hidden_size)
+        ).astype(self.dtype)
+        # well-separated logits so top-k is stable under float rounding
+        self.logits = (
+            np.random.permutation(self.num_tokens * self.num_experts)
+            .reshape(self.num_tokens, self.num_experts)
+            .astype(self.dtype)
+            / 37.0
+        )
+
+    def test_dispatch_and_combine(self):
+        (
+            dispatched_ref,
+            weights_ref,
+            scatter_index_ref,
+            expert_id_ref,
+            expert_count_ref,
+        ) = ref_dispatch(self.x, self.logits, self.k, self.capacity)
+
+        tensor_x = paddle.to_tensor(self.x, stop_gradient=False)
+        tensor_logits = paddle.to_tensor(self.logits, stop_gradient=False)
+        (
+            dispatched,
+            weights,
+            scatter_index,
+            expert_id,
+            expert_count,
+        ) = _C_ops.fused_moe_dispatch(
+            tensor_x, tensor_logits, self.k, self.capacity
+        )
+        np.testing.assert_array_equal(expert_id.numpy(), expert_id_ref)
+        np.testing.assert_array_equal(scatter_index.numpy(), scatter_index_ref)
+        np.testing.assert_array_equal(expert_count.numpy(), expert_count_ref)
+        np.testing.assert_allclose(
+            weights.numpy(), weights_ref, rtol=1e-5, atol=self.atol
+        )
+        np.testing.assert_allclose(
+            dispatched.numpy(), dispatched_ref, rtol=1e-5, atol=self.atol
+        )
+
+        # run the dispatched tokens through an "expert" and combine back
+        expert_out_np = np.random.uniform(
+            -1, 1, dispatched_ref.shape
+        ).astype(self.dtype)
+        expert_out = paddle.to_tensor(expert_out_np, stop_gradient=False)
+        y = _C_ops.fused_moe_combine(expert_out, weights, scatter_index)
+        y_ref = ref_combine(expert_out_np, weights_ref, scatter_index_ref)
+        np.testing.assert_allclose(
+            y.numpy(), y_ref, rtol=1e-5, atol=self.atol
+        )
+
+        # backward: y -> combine -> dispatch closes the chain to x/logits
+        dout = np.random.uniform(-1, 1, y.shape).astype(self.dtype)
+        paddle.autograd.backward([y], [paddle.to_tensor(dout)])
+
+        # expert_out grad: each kept slot gets its weight times the token's
+        # output gradient
+        d_expert_out_ref = np.zeros_like(expert_out_np)
+        for i in range(self.num_tokens):
+            for kk in range(self.k):
+                slot = scatter_index_ref[i, kk]
+                if slot >= 0:
+                    d_expert_out_ref[slot] = weights_ref[i, kk] * dout[i]
+        np.testing.assert_allclose(
+            expert_out.grad.numpy(),
+            d_expert_out_ref,
+            rtol=1e-5,
+            atol=self.atol,
+        )
+        self.assertFalse(tensor_x.grad is None)
+        self.assertFalse(tensor_logits.grad is None)
+
+
+class TestFusedMoeDispatchCombineOpFp16(TestFusedMoeDispatchCombineOp):
+    def config(self):
+        super().config()
+        self.dtype = np.float16
+        self.atol = 1e-2
+
+
+if __name__ == "__main__":
+    unittest.main()
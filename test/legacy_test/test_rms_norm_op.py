@@ -362,6 +362,76 @@ class TestRMSNormOp(unittest.TestCase):
                     rtol=rtol,
                 )
 
+    def test_rms_norm_residual_backward(self):
+        def get_paddle_tensor(shape, dtype, bound=0.5):
+            tmp = paddle.uniform(shape, dtype=dtype, min=-bound, max=bound)
+            tmp.stop_gradient = False
+            return tmp
+
+        def naive_residual_rms_norm(x, residual, gamma):
+            return naive_rms_norm(x + residual, gamma)
+
+        def fused_residual_rms_norm(x, residual, gamma):
+            out = paddle.incubate.nn.functional.fused_rms_norm(
+                x, gamma, None, 1e-5, begin_norm_axis=1, residual=residual
+            )
+            return out[0]
+
+        def get_forward_backward(func, seed, dtype):
+            paddle.disable_static()
+            paddle.seed(seed)
+            x = get_paddle_tensor([2, 256], dtype)
+            residual = get_paddle_tensor([2, 256], dtype)
+            scale = get_paddle_tensor([256], dtype)
+            out_g = paddle.randn([2, 256], dtype)
+            out = func(x, residual, scale)
+            paddle.autograd.backward([out], [out_g], True)
+            return out, (x.grad, residual.grad, scale.grad)
+
+        dtypes = [paddle.float32]
+        if paddle.amp.is_bfloat16_supported('gpu'):
+            dtypes.append(paddle.bfloat16)
+        if paddle.amp.is_float16_supported('gpu'):
+            dtypes.append(paddle.float16)
+        for dtype in dtypes:
+            raw_out, raw_grads = get_forward_backward(
+                naive_residual_rms_norm, seed=2024, dtype=dtype
+            )
+            fused_out, fused_grads = get_forward_backward(
+                fused_residual_rms_norm, seed=2024, dtype=dtype
+            )
+            # forward rtol
+            rtol = 1e-5 if dtype == paddle.float32 else 1e-2
+            np.testing.assert_allclose(
+                raw_out.astype(paddle.float32).numpy(),
+                fused_out.astype(paddle.float32).numpy(),
+                rtol=rtol,
+            )
+            # backward rtol, only check float32 grad
+            rtol = 1e-3
+            if dtype == paddle.float32:
+                raw_x_grad, raw_residual_grad, raw_scale_grad = raw_grads
+                (
+                    fused_x_grad,
+                    fused_residual_grad,
+                    fused_scale_grad,
+                ) = fused_grads
+                np.testing.assert_allclose(
+                    raw_x_grad.astype(paddle.float32).numpy(),
+                    fused_x_grad.astype(paddle.float32).numpy(),
+                    rtol=rtol,
+                )
+                np.testing.assert_allclose(
+                    raw_residual_grad.astype(paddle.float32).numpy(),
+                    fused_residual_grad.astype(paddle.float32).numpy(),
+                    rtol=rtol,
+                )
+                np.testing.assert_allclose(
+                    raw_scale_grad.astype(paddle.float32).numpy(),
+                    fused_scale_grad.astype(paddle.float32).numpy(),
+                    rtol=rtol,
+                )
+
 
 @unittest.skipIf(
     not core.is_compiled_with_cuda() and not paddle.is_compiled_with_rocm(),
@@ -0,0 +1,129 @@
+# Copyright (c) 2026 PaddlePaddle Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Emit the build-time kernel allowlist header from a model scan.
+
+Scans the given inference programs for the ops they use, maps each op to its
+phi kernel name, and writes paddle/phi/core/kernel_allowlist.h. Building with
+-DPADDLE_WITH_KERNEL_ALLOWLIST then compiles out every PD_REGISTER_KERNEL
+instantiation that is not listed (see kernel_registry.h).
+
+Usage:
+    python tools/prune_kernel_allowlist.py \
+        --models path/to/model1.pdmodel path/to/model2.pdmodel \
+        --backends CPU GPU \
+        --extra-kernels full cast memcpy_d2h memcpy_h2d \
+        --output paddle/phi/core/kernel_allowlist.h
+"""
+
+import argparse
+
+import paddle
+from paddle.base import core
+
+# Kernels the framework itself needs regardless of what the scanned models
+# contain: feed/fetch, dtype/place transfer, and tensor initialization.
+ALWAYS_KEPT_KERNELS = [
+    'cast',
+    'full',
+    'memcpy',
+    'memcpy_d2h',
+    'memcpy_h2d',
+    'transfer_layout',
+]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Generate paddle/phi/core/kernel_allowlist.h '
+        'from inference models.'
+    )
+    parser.add_argument(
+        '--models',
+        nargs='+',
+        required=True,
+        help='Paths of serialized inference programs (*.pdmodel).',
+    )
+    parser.add_argument(
+        '--backends',
+        nargs='+',
+        default=['CPU', 'GPU'],
+        help='Backends to keep for each kernel (default: CPU GPU).',
+    )
+    parser.add_argument(
+        '--extra-kernels',
+        nargs='*',
+        default=[],
+        help='Kernel names to keep in addition to the scanned ones.',
+    )
+    parser.add_argument(
+        '--output',
+        default='paddle/phi/core/kernel_allowlist.h',
+        help='Path of the generated header.',
+    )
+    return parser.parse_args()
+
+
+def collect_op_types(model_path):
+    with open(model_path, 'rb') as f:
+        program = paddle.static.deserialize_program(f.read())
+    op_types = set()
+    for block in program.blocks:
+        for op in block.ops:
+            op_types.add(op.type)
+    return op_types
+
+
+def op_to_kernel_name(op_type):
+    # Ops renamed between the fluid op layer and phi (e.g. elementwise_add ->
+    # add) are resolved through the compat mapping; ops without a mapping keep
+    # their own name.
+    try:
+        return core._get_phi_kernel_name(op_type)
+    except (AttributeError, RuntimeError, ValueError):
+        return op_type
+
+
+def main():
+    args = parse_args()
+
+    kernel_names = set(ALWAYS_KEPT_KERNELS) | set(args.extra_kernels)
+    for model_path in args.models:
+        for op_type in collect_op_types(model_path):
+            kernel_names.add(op_to_kernel_name(op_type))
+            # Serving images may still build the grad kernels of listed ops
+            # out; training deployments pass them via --extra-kernels.
+
+    lines = [
+        '// Generated by tools/prune_kernel_allowlist.py, do not edit.',
+        '// Kernels listed here survive a -DPADDLE_WITH_KERNEL_ALLOWLIST',
+        '// build; everything else registered via PD_REGISTER_KERNEL is',
+        '// compiled out.',
+        '#pragma once',
+        '',
+    ]
+    for name in sorted(kernel_names):
+        for backend in args.backends:
+            lines.append(f'#define PD_ALLOW_KERNEL_{name}_{backend} 1')
+    lines.append('')
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(lines))
+    print(
+        f'Wrote {args.output}: {len(kernel_names)} kernels x '
+        f'{len(args.backends)} backends.'
+    )
+
+
+if __name__ == '__main__':
+    main()